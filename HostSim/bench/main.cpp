@@ -0,0 +1,170 @@
+/**
+ * @file main.cpp
+ * @author Piotr Zapart www.hexefx.com
+ * @brief CPU load of the partitioned convolver per IR length:
+ * 		non-uniform partitions against uniform block sized ones,
+ * 		separate real FFTs per channel against packed stereo FFTs,
+ * 		average, 99th percentile and worst block in % of the audio
+ * 		block time, worst block of a crossfade to another IR,
+ * 		memory in the RAM and in the PSRAM.
+ * 		The loads are measured on the host, they show the ratios
+ * 		and the spread of the block costs, not the Teensy numbers.
+ * @version 0.1
+ * @date 2024-03-14
+ */
+#include <Arduino.h>
+#include <getopt.h>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include "AudioFilterIRConvolver_F32.h"
+
+typedef struct
+{
+	float32_t avg;
+	float32_t p99;
+	float32_t max;
+} load_t;
+
+static void usage(const char *name)
+{
+	printf("Usage: %s [options]\r\n"
+		   "  -l ms,ms,...   IR lengths (default 50,100,200,500,1000,2000)\r\n"
+		   "  -s seconds     audio processed per IR (default 4)\r\n"
+		   "  -r rate        sample rate (default 44100)\r\n"
+		   "  -u             skip the uniform partitioning, slow for the long IRs\r\n"
+		   "  -d             doubler: different IRs for the left and the right channel\r\n", name);
+}
+
+static std::string format(const load_t &load)
+{
+	char buf[48];
+	snprintf(buf, sizeof(buf), "%.1f/%.1f/%.1f", load.avg, load.p99, load.max);
+	return buf;
+}
+
+static bool run(AudioFilterIRConvolver_F32 &conv, const std::vector<float32_t> &ir, const std::vector<float32_t> &irR,
+				uint16_t partMax, bool packing, uint32_t blocks, float32_t blockNs, load_t &load)
+{
+	conv.packing_set(packing);
+	if (irR.empty() ? !conv.load(ir.data(), ir.size(), partMax) : !conv.load(ir.data(), irR.data(), ir.size(), partMax))
+		return false;
+	float32_t L[AUDIO_BLOCK_SAMPLES], R[AUDIO_BLOCK_SAMPLES];
+	std::vector<uint32_t> times(blocks);
+	uint64_t sum = 0;
+	for (uint32_t b = 0; b < blocks; b++)
+	{
+		for (uint32_t i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+		{
+			L[i] = (float32_t)rand() / RAND_MAX - 0.5f;
+			R[i] = (float32_t)rand() / RAND_MAX - 0.5f;
+		}
+		const uint32_t t0 = ARM_DWT_CYCCNT;
+		conv.processBlock(L, R, AUDIO_BLOCK_SAMPLES);
+		const uint32_t t = ARM_DWT_CYCCNT - t0;
+		sum += t;
+		times[b] = t;
+	}
+	std::sort(times.begin(), times.end());
+	load.avg = 100.0f * (float32_t)sum / blocks / blockNs;
+	load.p99 = 100.0f * times[blocks * 99 / 100] / blockNs;
+	load.max = 100.0f * times[blocks - 1] / blockNs;
+	return true;
+}
+
+// worst block while the current and a new IR of the same length run in parallel
+static float32_t crossfade(AudioFilterIRConvolver_F32 &conv, const std::vector<float32_t> &ir, float32_t blockNs)
+{
+	IRPartitions_F32 parts;
+	if (!parts.prepare(ir.data(), ir.size()) || !conv.crossfade(parts)) return -1.0f;
+	float32_t L[AUDIO_BLOCK_SAMPLES], R[AUDIO_BLOCK_SAMPLES];
+	uint32_t worst = 0;
+	while (conv.isFading())
+	{
+		for (uint32_t i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+		{
+			L[i] = (float32_t)rand() / RAND_MAX - 0.5f;
+			R[i] = (float32_t)rand() / RAND_MAX - 0.5f;
+		}
+		const uint32_t t0 = ARM_DWT_CYCCNT;
+		conv.processBlock(L, R, AUDIO_BLOCK_SAMPLES);
+		worst = max(worst, ARM_DWT_CYCCNT - t0);
+	}
+	conv.crossfadeDone();
+	return 100.0f * worst / blockNs;
+}
+
+int main(int argc, char **argv)
+{
+	std::vector<float32_t> lengths = {50, 100, 200, 500, 1000, 2000};
+	float32_t seconds = 4.0f;
+	float32_t rate = AUDIO_SAMPLE_RATE_EXACT;
+	bool uniform = true;
+	bool doubler = false;
+	int opt;
+	while ((opt = getopt(argc, argv, "l:s:r:udh")) != -1)
+	{
+		switch (opt)
+		{
+			case 'l':
+			{
+				lengths.clear();
+				std::string s = optarg;
+				size_t p = 0;
+				while (p < s.size())
+				{
+					lengths.push_back(atof(s.c_str() + p));
+					p = s.find(',', p);
+					if (p == std::string::npos) break;
+					p++;
+				}
+				break;
+			}
+			case 's': seconds = atof(optarg); break;
+			case 'r': rate = atof(optarg); break;
+			case 'u': uniform = false; break;
+			case 'd': doubler = true; break;
+			default: usage(argv[0]); return opt == 'h' ? 0 : 1;
+		}
+	}
+	const uint32_t blocks = max(1u, (uint32_t)(seconds * rate / AUDIO_BLOCK_SAMPLES));
+	const float32_t blockNs = 1e9f * AUDIO_BLOCK_SAMPLES / rate;
+
+	printf("Block %u samples at %.0fHz, %u blocks per IR\r\n", AUDIO_BLOCK_SAMPLES, rate, blocks);
+	printf("%8s %8s  %-32s %8s %9s  %-17s %-9s %-17s %s\r\n", "IR ms", "samples", "partitions", "RAM kB", "PSRAM kB",
+		   "avg/p99/max%", "xfade%", "packed FFT", uniform ? "uniform avg/p99/max%" : "");
+	AudioFilterIRConvolver_F32 *conv = new AudioFilterIRConvolver_F32();
+	for (float32_t ms : lengths)
+	{
+		const uint32_t len = max(1u, (uint32_t)(ms * 0.001f * rate));
+		std::vector<float32_t> ir(len), irR(doubler ? len : 0);
+		// decaying noise, like a room response
+		for (uint32_t i = 0; i < len; i++)
+			ir[i] = ((float32_t)rand() / RAND_MAX - 0.5f) * expf(-6.9f * i / len);
+		for (uint32_t i = 0; i < irR.size(); i++)
+			irR[i] = ((float32_t)rand() / RAND_MAX - 0.5f) * expf(-6.9f * i / len);
+
+		load_t nupc, packed, upc;
+		if (!run(*conv, ir, irR, IR_CONV_PART_MAX, true, blocks, blockNs, packed) ||
+			!run(*conv, ir, irR, IR_CONV_PART_MAX, false, blocks, blockNs, nupc))
+		{
+			printf("%8.0f %8u  out of memory\r\n", ms, len);
+			continue;
+		}
+		std::string layout;
+		IRPartitions_F32 &parts = conv->getIR();
+		for (uint8_t l = 0; l < parts.getLevels(); l++)
+		{
+			const IRPartitions_F32::level_t &lv = parts.getLevel(l);
+			layout += std::to_string(lv.size) + "x" + std::to_string(lv.count) + " ";
+		}
+		const float32_t ram = conv->getBytesRAM() / 1024.0f, psram = conv->getBytesPSRAM() / 1024.0f;
+		printf("%8.0f %8u  %-32s %8.1f %9.1f  %-17s %-9.1f %-17s", ms, len, layout.c_str(), ram, psram,
+			   format(nupc).c_str(), crossfade(*conv, ir, blockNs), format(packed).c_str());
+		if (uniform && run(*conv, ir, irR, AUDIO_BLOCK_SAMPLES, false, blocks, blockNs, upc))
+			printf(" %s", format(upc).c_str());
+		printf("\r\n");
+	}
+	delete conv;
+	return 0;
+}
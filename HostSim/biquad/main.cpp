@@ -0,0 +1,153 @@
+/**
+ * @file main.cpp
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Cost of the stereo biquad cascades per stage count:
+ * 		BiquadStereo_F32 (both channels as lanes of one loop, fixed and
+ * 		ramped coefficients) against two CMSIS df2T cascades, one per
+ * 		channel, and the interleaved CMSIS stereo cascade, in ns per
+ * 		block and % of the audio block time, and the largest difference
+ * 		of the outputs.
+ * 		The times are measured on the host, they show the ratios, not the
+ * 		Teensy numbers.
+ * @version 0.1
+ * @date 2024-03-19
+ */
+#include <Arduino.h>
+#include <getopt.h>
+#include <vector>
+#include "BiquadStereo_F32.h"
+
+typedef enum
+{
+	PATH_CMSIS,			// arm_biquad_cascade_df2T_f32 per channel
+	PATH_INTERLEAVED,	// interleave, arm_biquad_cascade_stereo_df2T_f32, deinterleave
+	PATH_LANES,			// BiquadStereo_F32::process()
+	PATH_RAMP,			// BiquadStereo_F32::ramp()
+	PATH_COUNT
+} path_t;
+
+static const char *pathNames[PATH_COUNT] = {"CMSIS L+R", "interleaved", "lanes", "lanes ramp"};
+
+static void usage(const char *name)
+{
+	printf("Usage: %s [options]\r\n"
+		   "  -s seconds     audio processed per stage count (default 10)\r\n"
+		   "  -n stages      max stages (default %u)\r\n", name, BIQUAD_STEREO_STAGES_MAX);
+}
+
+// peaking EQ sections spread over the audio band, CMSIS signs
+static void design(uint8_t stages, float32_t *c)
+{
+	for (uint8_t s = 0; s < stages; s++)
+	{
+		const double w = 2.0 * M_PI * 100.0 * pow(4.0, s) / AUDIO_SAMPLE_RATE_EXACT;
+		const double A = pow(10.0, (s & 1 ? -6.0 : 6.0) / 40.0), alpha = sin(w) / (2.0 * 0.7);
+		const double a0 = 1.0 + alpha / A;
+		c[5 * s + 0] = (1.0 + alpha * A) / a0;
+		c[5 * s + 1] = -2.0 * cos(w) / a0;
+		c[5 * s + 2] = (1.0 - alpha * A) / a0;
+		c[5 * s + 3] = 2.0 * cos(w) / a0;
+		c[5 * s + 4] = -(1.0 - alpha / A) / a0;
+	}
+}
+
+// total ns of the path over the blocks, the outputs of the last block in L, R
+static uint64_t run(path_t path, uint8_t stages, const float32_t *c, const std::vector<float32_t> &in, uint32_t blocks,
+					float32_t *L, float32_t *R)
+{
+	float32_t stL[2 * BIQUAD_STEREO_STAGES_MAX], stR[2 * BIQUAD_STEREO_STAGES_MAX], stS[4 * BIQUAD_STEREO_STAGES_MAX];
+	float32_t inter[2 * AUDIO_BLOCK_SAMPLES];
+	arm_biquad_cascade_df2T_instance_f32 biquadL, biquadR;
+	arm_biquad_cascade_stereo_df2T_instance_f32 biquadS;
+	arm_biquad_cascade_df2T_init_f32(&biquadL, stages, c, stL);
+	arm_biquad_cascade_df2T_init_f32(&biquadR, stages, c, stR);
+	arm_biquad_cascade_stereo_df2T_init_f32(&biquadS, stages, c, stS);
+	BiquadStereo_F32 lanes;
+	lanes.init(stages, c);
+	uint64_t sum = 0;
+	for (uint32_t b = 0; b < blocks; b++)
+	{
+		const float32_t *x = in.data() + (b % 64) * 2 * AUDIO_BLOCK_SAMPLES;
+		memcpy(L, x, AUDIO_BLOCK_SAMPLES * sizeof(float32_t));
+		memcpy(R, x + AUDIO_BLOCK_SAMPLES, AUDIO_BLOCK_SAMPLES * sizeof(float32_t));
+		const uint32_t t0 = ARM_DWT_CYCCNT;
+		switch (path)
+		{
+			case PATH_CMSIS:
+				arm_biquad_cascade_df2T_f32(&biquadL, L, L, AUDIO_BLOCK_SAMPLES);
+				arm_biquad_cascade_df2T_f32(&biquadR, R, R, AUDIO_BLOCK_SAMPLES);
+				break;
+			case PATH_INTERLEAVED:
+				for (uint32_t i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+				{
+					inter[2 * i] = L[i];
+					inter[2 * i + 1] = R[i];
+				}
+				arm_biquad_cascade_stereo_df2T_f32(&biquadS, inter, inter, AUDIO_BLOCK_SAMPLES);
+				for (uint32_t i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+				{
+					L[i] = inter[2 * i];
+					R[i] = inter[2 * i + 1];
+				}
+				break;
+			case PATH_LANES:
+				lanes.process(L, R, AUDIO_BLOCK_SAMPLES);
+				break;
+			case PATH_RAMP:
+				lanes.ramp(L, R, AUDIO_BLOCK_SAMPLES, c, c);
+				break;
+			default: break;
+		}
+		sum += ARM_DWT_CYCCNT - t0;
+	}
+	return sum;
+}
+
+int main(int argc, char **argv)
+{
+	float32_t seconds = 10.0f;
+	uint8_t stagesMax = BIQUAD_STEREO_STAGES_MAX;
+	int opt;
+	while ((opt = getopt(argc, argv, "s:n:h")) != -1)
+	{
+		switch (opt)
+		{
+			case 's': seconds = atof(optarg); break;
+			case 'n': stagesMax = constrain(atoi(optarg), 1, BIQUAD_STEREO_STAGES_MAX); break;
+			default: usage(argv[0]); return opt == 'h' ? 0 : 1;
+		}
+	}
+	const uint32_t blocks = max(1u, (uint32_t)(seconds * AUDIO_SAMPLE_RATE_EXACT / AUDIO_BLOCK_SAMPLES));
+	const float32_t blockNs = 1e9f * AUDIO_BLOCK_SAMPLES / AUDIO_SAMPLE_RATE_EXACT;
+	std::vector<float32_t> in(64 * 2 * AUDIO_BLOCK_SAMPLES);
+	for (float32_t &x : in) x = (float32_t)rand() / RAND_MAX - 0.5f;
+
+	printf("Block %u samples, %u blocks per stage count, ns per block (%% of the block time)\r\n", AUDIO_BLOCK_SAMPLES, blocks);
+	printf("%6s", "stages");
+	for (uint8_t p = 0; p < PATH_COUNT; p++) printf("  %-18s", pathNames[p]);
+	printf("  %8s  %s\r\n", "speedup", "max diff");
+	int result = 0;
+	for (uint8_t stages = 1; stages <= stagesMax; stages++)
+	{
+		float32_t c[5 * BIQUAD_STEREO_STAGES_MAX];
+		float32_t L[PATH_COUNT][AUDIO_BLOCK_SAMPLES], R[PATH_COUNT][AUDIO_BLOCK_SAMPLES];
+		double ns[PATH_COUNT];
+		design(stages, c);
+		printf("%6u", stages);
+		for (uint8_t p = 0; p < PATH_COUNT; p++)
+		{
+			ns[p] = (double)run((path_t)p, stages, c, in, blocks, L[p], R[p]) / blocks;
+			char buf[32];
+			snprintf(buf, sizeof(buf), "%.0f (%.2f%%)", ns[p], 100.0 * ns[p] / blockNs);
+			printf("  %-18s", buf);
+		}
+		// all the paths run the same recursion
+		float32_t diff = 0.0f;
+		for (uint8_t p = 1; p < PATH_COUNT; p++)
+			for (uint32_t i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+				diff = max(diff, max(fabsf(L[p][i] - L[PATH_CMSIS][i]), fabsf(R[p][i] - R[PATH_CMSIS][i])));
+		printf("  %7.2fx  %.2g\r\n", ns[PATH_CMSIS] / max(ns[PATH_LANES], 1.0), diff);
+		if (!(diff < 1e-4f)) result = 1;
+	}
+	return result;
+}
@@ -0,0 +1,184 @@
+/**
+ * @file Arduino.h
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Host (Linux) stand-in for the Teensy4 Arduino core.
+ * 		Provides the subset of the core used by the examples and the
+ * 		audio libraries: Serial, usbMIDI, GPIO no-ops, timing and the
+ * 		Teensy memory section/cache macros.
+ * 		millis()/micros() run on the simulated audio clock, so the
+ * 		timing in loop() follows the processed audio, not the wall clock.
+ * 		ARM_DWT_CYCCNT counts host nanoseconds, F_CPU_ACTUAL is set to 1GHz
+ * 		to keep the cycles -> time conversions used in the code valid.
+ * @version 0.1
+ * @date 2024-03-01
+ */
+#ifndef _HOSTSIM_ARDUINO_H_
+#define _HOSTSIM_ARDUINO_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <math.h>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HIGH			(1)
+#define LOW				(0)
+#define INPUT			(0)
+#define OUTPUT			(1)
+#define INPUT_PULLUP	(2)
+#define INPUT_PULLDOWN	(3)
+
+#ifndef PI
+#define PI 			3.1415926535897932384626433832795
+#endif
+#define HALF_PI 	1.5707963267948966192313216916398
+#define TWO_PI 		6.283185307179586476925286766559
+#define DEG_TO_RAD 	0.017453292519943295769236907684886
+#define RAD_TO_DEG 	57.295779513082320876798154814105
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+// Teensy memory sections and attributes, all regular memory on the host
+#define FLASHMEM
+#define PROGMEM
+#define DMAMEM
+#define EXTMEM
+#define FASTRUN
+#define F(s)	(s)
+
+// cycle counter in host nanoseconds
+#define F_CPU_ACTUAL	(1000000000UL)
+#define F_CPU			F_CPU_ACTUAL
+#define ARM_DWT_CYCCNT	(hostsim_cycles())
+uint32_t hostsim_cycles();
+
+extern volatile uint32_t SCB_AIRCR;	// writes are ignored
+extern uint8_t external_psram_size;
+
+inline void __disable_irq() {}
+inline void __enable_irq() {}
+inline void yield() {}
+inline void arm_dcache_flush(void *, uint32_t) {}
+inline void arm_dcache_delete(void *, uint32_t) {}
+inline void arm_dcache_flush_delete(void *, uint32_t) {}
+inline void *extmem_malloc(size_t size) { return malloc(size); }
+inline void *extmem_calloc(size_t nmemb, size_t size) { return calloc(nmemb, size); }
+inline void extmem_free(void *ptr) { free(ptr); }
+
+uint32_t millis();
+uint32_t micros();
+inline void delay(uint32_t) {}
+inline void delayMicroseconds(uint32_t) {}
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+uint8_t digitalRead(uint8_t pin);
+inline void digitalWriteFast(uint8_t pin, uint8_t val) { digitalWrite(pin, val); }
+inline uint8_t digitalReadFast(uint8_t pin) { return digitalRead(pin); }
+inline void digitalToggleFast(uint8_t pin) { digitalWrite(pin, !digitalRead(pin)); }
+inline void digitalToggle(uint8_t pin) { digitalToggleFast(pin); }
+inline int analogRead(uint8_t) { return 0; }
+
+inline long map(long x, long in_min, long in_max, long out_min, long out_max)
+{
+	return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+inline long random(long howbig) { return howbig > 0 ? rand() % howbig : 0; }
+inline long random(long howsmall, long howbig) { return howsmall < howbig ? howsmall + random(howbig - howsmall) : howsmall; }
+
+#ifdef __cplusplus
+template <class A, class B>
+constexpr auto min(A &&a, B &&b) -> decltype(a < b ? a : b) { return a < b ? a : b; }
+template <class A, class B>
+constexpr auto max(A &&a, B &&b) -> decltype(a > b ? a : b) { return a > b ? a : b; }
+
+class Print
+{
+public:
+	virtual ~Print() {}
+	virtual size_t write(uint8_t c) = 0;
+	virtual size_t write(const uint8_t *buf, size_t len);
+	size_t write(const char *str) { return write((const uint8_t *)str, strlen(str)); }
+	size_t print(const char *s) { return write(s); }
+	size_t print(char c) { return write((uint8_t)c); }
+	size_t print(int n) { return printf("%d", n); }
+	size_t print(unsigned int n) { return printf("%u", n); }
+	size_t print(long n) { return printf("%ld", n); }
+	size_t print(unsigned long n) { return printf("%lu", n); }
+	size_t print(double n, int digits = 2) { return printf("%.*f", digits, n); }
+	size_t println() { return write("\r\n"); }
+	template <typename T>
+	size_t println(T val) { return print(val) + println(); }
+	size_t println(double n, int digits) { return print(n, digits) + println(); }
+	size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+	virtual void flush() {}
+};
+
+class Stream : public Print
+{
+public:
+	virtual int available() { return 0; }
+	virtual int read() { return -1; }
+	virtual int peek() { return -1; }
+};
+
+/**
+ * @brief Serial port, the output goes to stdout if enabled by the host runner
+ */
+class HostSerial : public Stream
+{
+public:
+	void begin(uint32_t) {}
+	size_t write(uint8_t c) override;
+	size_t write(const uint8_t *buf, size_t len) override;
+	using Print::write;
+	operator bool() { return true; }
+	void enable(bool state) { enabled = state; }
+private:
+	bool enabled = false;
+};
+extern HostSerial Serial;
+
+/**
+ * @brief USB MIDI device, the host runner queues the events
+ * 		which are dispatched to the callbacks by read()
+ */
+class HostMIDI
+{
+public:
+	enum
+	{
+		NoteOff = 0x80, NoteOn = 0x90, ControlChange = 0xB0,
+		ProgramChange = 0xC0, Clock = 0xF8
+	};
+	void setHandleNoteOn(void (*fptr)(byte channel, byte note, byte velocity)) { noteOn = fptr; }
+	void setHandleNoteOff(void (*fptr)(byte channel, byte note, byte velocity)) { noteOff = fptr; }
+	void setHandleControlChange(void (*fptr)(byte channel, byte control, byte value)) { controlChange = fptr; }
+	void setHandleProgramChange(void (*fptr)(byte channel, byte program)) { programChange = fptr; }
+	void setHandleClock(void (*fptr)(void)) { clock = fptr; }
+	/**
+	 * @brief Dispatch one queued event
+	 * @return true if an event was processed
+	 */
+	bool read(uint8_t channel = 0);
+	bool queue(uint8_t type, uint8_t channel, uint8_t data1, uint8_t data2);
+private:
+	static const uint32_t queueSize = 64;
+	struct { uint8_t type, channel, data1, data2; } events[queueSize];
+	uint32_t head = 0, tail = 0;
+	void (*noteOn)(byte, byte, byte) = NULL;
+	void (*noteOff)(byte, byte, byte) = NULL;
+	void (*controlChange)(byte, byte, byte) = NULL;
+	void (*programChange)(byte, byte) = NULL;
+	void (*clock)(void) = NULL;
+};
+extern HostMIDI usbMIDI;
+
+#endif // __cplusplus
+
+#endif // _HOSTSIM_ARDUINO_H_
@@ -0,0 +1,16 @@
+/**
+ * @file Audio.h
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Host (Linux) stand-in for the Teensy Audio library header,
+ * 		only the base classes and the codec controls are provided.
+ * @version 0.1
+ * @date 2024-03-01
+ */
+#ifndef _HOSTSIM_AUDIO_H_
+#define _HOSTSIM_AUDIO_H_
+
+#include <Arduino.h>
+#include "AudioStream.h"
+#include "HostSim_IO_F32.h"
+
+#endif // _HOSTSIM_AUDIO_H_
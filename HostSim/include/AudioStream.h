@@ -0,0 +1,86 @@
+/**
+ * @file AudioStream.h
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Host (Linux) stand-in for the Teensy AudioStream base class.
+ * 		Keeps the update list in the object construction order, like
+ * 		the Teensy audio library, and measures the update() time of each
+ * 		object. CPU usage is reported in % of the audio block period,
+ * 		same as on the Teensy, but in host CPU time.
+ * @version 0.1
+ * @date 2024-03-01
+ */
+#ifndef _HOSTSIM_AUDIOSTREAM_H_
+#define _HOSTSIM_AUDIOSTREAM_H_
+
+#include <Arduino.h>
+
+#ifndef AUDIO_BLOCK_SAMPLES
+#define AUDIO_BLOCK_SAMPLES  		128
+#endif
+#ifndef AUDIO_SAMPLE_RATE_EXACT
+#define AUDIO_SAMPLE_RATE_EXACT 	44117.64706f
+#endif
+#define AUDIO_SAMPLE_RATE 			AUDIO_SAMPLE_RATE_EXACT
+
+// update() time in ns -> % of the audio block period
+#define CYCLE_COUNTER_APPROX_PERCENT(n) \
+	((float)(n) * (100.0f * AUDIO_SAMPLE_RATE_EXACT / (AUDIO_BLOCK_SAMPLES * 1.0e9f)))
+
+class AudioStream
+{
+public:
+	AudioStream(unsigned char ninput);
+	virtual ~AudioStream();
+	virtual void update(void) = 0;
+
+	float processorUsage(void) { return CYCLE_COUNTER_APPROX_PERCENT(cpu_cycles); }
+	float processorUsageMax(void) { return CYCLE_COUNTER_APPROX_PERCENT(cpu_cycles_max); }
+	void processorUsageMaxReset(void) { cpu_cycles_max = cpu_cycles; }
+	bool isActive(void) { return active; }
+
+	/**
+	 * @brief Run one audio block, calls update() of all active objects
+	 * 			in the construction order. Replaces the audio interrupt.
+	 */
+	static void update_all(void);
+
+	static uint32_t cpu_cycles_total;
+	static uint32_t cpu_cycles_total_max;
+
+	// host side statistics, not reset by the sketch
+	typedef struct
+	{
+		uint64_t cycles_sum;
+		uint32_t cycles_peak;
+		uint32_t updates;
+		uint32_t pool_peak;			// max F32 blocks in use during the update()
+		uint32_t alloc_failures;	// allocate_f32() returned NULL in the update()
+	} host_stats_t;
+	static AudioStream *first(void) { return first_update; }
+	AudioStream *next(void) { return next_update; }
+	const host_stats_t &hostStats(void) { return host_stats; }
+	static const host_stats_t &hostStatsTotal(void) { return host_stats_total; }
+
+protected:
+	// block pool events, counted for the object being updated
+	static void hostPoolEvent(uint32_t used, bool failed);
+	bool active;
+	unsigned char num_inputs;
+	uint32_t cpu_cycles;
+	uint32_t cpu_cycles_max;
+
+private:
+	static AudioStream *first_update;
+	static AudioStream *current_update;
+	AudioStream *next_update;
+	host_stats_t host_stats;
+	static host_stats_t host_stats_total;
+};
+
+inline float AudioProcessorUsage(void) { return CYCLE_COUNTER_APPROX_PERCENT(AudioStream::cpu_cycles_total); }
+inline float AudioProcessorUsageMax(void) { return CYCLE_COUNTER_APPROX_PERCENT(AudioStream::cpu_cycles_total_max); }
+inline void AudioProcessorUsageMaxReset(void) { AudioStream::cpu_cycles_total_max = AudioStream::cpu_cycles_total; }
+inline void AudioNoInterrupts(void) {}
+inline void AudioInterrupts(void) {}
+
+#endif // _HOSTSIM_AUDIOSTREAM_H_
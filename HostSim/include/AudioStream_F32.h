@@ -0,0 +1,100 @@
+/**
+ * @file AudioStream_F32.h
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Host (Linux) stand-in for the OpenAudio AudioStream_F32 class:
+ * 		float audio block pool, connections, receive/transmit/release
+ * 		with the same reference counting rules as on the Teensy. The pool
+ * 		is lock-free and counts the usage and failures per object.
+ * @version 0.1
+ * @date 2024-03-01
+ */
+#ifndef _HOSTSIM_AUDIOSTREAM_F32_H_
+#define _HOSTSIM_AUDIOSTREAM_F32_H_
+
+#include <Arduino.h>
+#include "AudioStream.h"
+#include "arm_math.h"
+
+class AudioStream_F32;
+class AudioConnection_F32;
+
+typedef struct audio_block_f32_struct
+{
+	unsigned char ref_count;
+	unsigned char memory_pool_index;
+	unsigned char reserved1;
+	unsigned char reserved2;
+	float32_t data[AUDIO_BLOCK_SAMPLES];
+	const int full_length = AUDIO_BLOCK_SAMPLES;
+	int length = AUDIO_BLOCK_SAMPLES;
+	float fs_Hz = AUDIO_SAMPLE_RATE;
+	unsigned long id;
+} audio_block_f32_t;
+
+class AudioConnection_F32
+{
+public:
+	AudioConnection_F32(AudioStream_F32 &source, unsigned char sourceOutput,
+						AudioStream_F32 &destination, unsigned char destinationInput);
+	AudioConnection_F32(AudioStream_F32 &source, AudioStream_F32 &destination)
+		: AudioConnection_F32(source, 0, destination, 0) {}
+	~AudioConnection_F32() { disconnect(); }
+	int connect(void);
+	int disconnect(void);
+private:
+	AudioStream_F32 &src;
+	AudioStream_F32 &dst;
+	unsigned char src_index;
+	unsigned char dest_index;
+	AudioConnection_F32 *next_dest;
+	bool isConnected;
+	friend class AudioStream_F32;
+};
+
+#define AudioMemory_F32(num) ({ \
+	static audio_block_f32_t data_f32[num]; \
+	AudioStream_F32::initialize_f32_memory(data_f32, num); \
+})
+
+class AudioStream_F32 : public AudioStream
+{
+public:
+	AudioStream_F32(unsigned char n_input_f32, audio_block_f32_t **iqueue);
+	static void initialize_f32_memory(audio_block_f32_t *data, unsigned int num);
+	static uint8_t f32_memory_used;
+	static uint8_t f32_memory_used_max;
+	static audio_block_f32_t *allocate_f32(void);
+	static void release(audio_block_f32_t *block);
+
+	/**
+	 * @brief Host side pool calibration: AudioMemory_F32() gets the
+	 * 			largest pool instead of the requested size, the peak usage
+	 * 			is the minimum pool size the graph needs. Set before setup().
+	 */
+	static void hostPoolCalibrate(bool state) { pool_calibrate_f32 = state; }
+	static bool hostPoolCalibrating(void) { return pool_calibrate_f32; }
+	// number of blocks requested with AudioMemory_F32()
+	static uint32_t hostPoolRequested(void) { return pool_requested_f32; }
+
+protected:
+	audio_block_f32_t *receiveReadOnly_f32(unsigned int index = 0);
+	audio_block_f32_t *receiveWritable_f32(unsigned int index = 0);
+	void transmit(audio_block_f32_t *block, unsigned char index = 0);
+
+private:
+	AudioConnection_F32 *destination_list_f32;
+	audio_block_f32_t **inputQueue_f32;
+	unsigned char num_inputs_f32;
+	static audio_block_f32_t *memory_pool_f32;
+	static uint32_t memory_pool_size_f32;
+	static uint32_t memory_pool_available_mask_f32[];
+	static uint32_t pool_requested_f32;
+	static bool pool_calibrate_f32;
+	friend class AudioConnection_F32;
+};
+
+inline uint8_t AudioMemoryUsage_F32(void) { return AudioStream_F32::f32_memory_used; }
+inline uint8_t AudioMemoryUsageMax_F32(void) { return AudioStream_F32::f32_memory_used_max; }
+inline void AudioMemoryUsageMaxReset_F32(void) { AudioStream_F32::f32_memory_used_max = AudioStream_F32::f32_memory_used; }
+
+#endif // _HOSTSIM_AUDIOSTREAM_F32_H_
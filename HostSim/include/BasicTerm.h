@@ -0,0 +1,45 @@
+/**
+ * @file BasicTerm.h
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Host (Linux) stand-in for the BasicTerm library,
+ * 		writes the VT100 sequences to the serial port.
+ * @version 0.1
+ * @date 2024-03-01
+ */
+#ifndef _HOSTSIM_BASICTERM_H_
+#define _HOSTSIM_BASICTERM_H_
+
+#include <Arduino.h>
+
+#define BT_NORMAL		0
+#define BT_REVERSE		1
+#define BT_UNDERLINE	2
+#define BT_BLINK		4
+#define BT_BOLD			8
+
+#define BT_BLACK		0
+#define BT_RED			1
+#define BT_GREEN		2
+#define BT_YELLOW		3
+#define BT_BLUE			4
+#define BT_MAGENTA		5
+#define BT_CYAN			6
+#define BT_WHITE		7
+
+class BasicTerm
+{
+public:
+	BasicTerm(Stream *s) : serial(s) {}
+	void init(void) { set_attribute(BT_NORMAL); }
+	void cls(void) { serial->print("\x1b[2J"); }
+	void show_cursor(bool show) { serial->print(show ? "\x1b[?25h" : "\x1b[?25l"); }
+	void position(uint8_t row, uint8_t col) { serial->printf("\x1b[%u;%uH", row + 1, col + 1); }
+	void set_attribute(uint8_t) { serial->print("\x1b[0m"); }
+	void set_color(uint8_t fg, uint8_t bg) { serial->printf("\x1b[%u;%um", fg + 30, bg + 40); }
+	void erase_line(void) { serial->print("\x1b[2K"); }
+	void beep(void) {}
+private:
+	Stream *serial;
+};
+
+#endif // _HOSTSIM_BASICTERM_H_
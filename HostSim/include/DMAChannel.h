@@ -0,0 +1,141 @@
+/**
+ * @file DMAChannel.h
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Host (Linux) stand-in for the Teensy4 DMAChannel/DMASetting,
+ * 		memory to memory transfers only: triggerManual() runs one minor
+ * 		loop of the channel TCD (NBYTES contiguous bytes), as a software
+ * 		request of the eDMA. At the end of the major loop (CITER down to
+ * 		0) the channel is done, or the scatter/gather loads the next TCD,
+ * 		which runs its first minor loop if its START bit is set. A major
+ * 		loop of several minor loops needs a trigger per minor loop.
+ * 		The transfer ends before the call returns, the timing of the DMA
+ * 		engine is not modelled.
+ * @version 0.1
+ * @date 2024-03-21
+ */
+#ifndef _HOSTSIM_DMACHANNEL_H_
+#define _HOSTSIM_DMACHANNEL_H_
+
+#include <Arduino.h>
+
+#define DMA_TCD_CSR_START		(0x0001)
+#define DMA_TCD_CSR_INTMAJOR	(0x0002)
+#define DMA_TCD_CSR_DREQ		(0x0008)
+#define DMA_TCD_CSR_ESG			(0x0010)
+#define DMA_TCD_CSR_ACTIVE		(0x0040)
+#define DMA_TCD_CSR_DONE		(0x0080)
+#define DMA_TCD_ATTR_SSIZE(n)	(((n) & 0x7) << 8)
+#define DMA_TCD_ATTR_DSIZE(n)	((n) & 0x7)
+
+class DMABaseClass
+{
+public:
+	typedef struct
+	{
+		volatile const void *volatile SADDR;
+		int16_t SOFF;
+		uint16_t ATTR;
+		uint32_t NBYTES;
+		int32_t SLAST;
+		volatile void *volatile DADDR;
+		int16_t DOFF;
+		volatile uint16_t CITER;
+		intptr_t DLASTSGA;			// int32_t on the Teensy, a pointer with the scatter/gather
+		volatile uint16_t CSR;
+		volatile uint16_t BITER;
+	} TCD_t;
+	TCD_t *TCD;
+
+	void sourceBuffer(volatile const unsigned int p[], unsigned int len)
+	{
+		TCD->SADDR = p;
+		TCD->SOFF = 4;
+		TCD->ATTR = (TCD->ATTR & 0x00FF) | DMA_TCD_ATTR_SSIZE(2);
+		TCD->NBYTES = 4;
+		TCD->SLAST = -(int32_t)len;
+		TCD->BITER = TCD->CITER = len / 4;
+	}
+	void destinationBuffer(volatile unsigned int p[], unsigned int len)
+	{
+		TCD->DADDR = p;
+		TCD->DOFF = 4;
+		TCD->ATTR = (TCD->ATTR & 0xFF00) | DMA_TCD_ATTR_DSIZE(2);
+		TCD->NBYTES = 4;
+		TCD->DLASTSGA = -(int32_t)len;
+		TCD->BITER = TCD->CITER = len / 4;
+	}
+	void replaceSettingsOnCompletion(const DMABaseClass &settings)
+	{
+		TCD->DLASTSGA = (intptr_t)settings.TCD;
+		TCD->CSR &= ~DMA_TCD_CSR_DONE;
+		TCD->CSR |= DMA_TCD_CSR_ESG;
+	}
+	void disableOnCompletion() {TCD->CSR |= DMA_TCD_CSR_DREQ;}
+	void interruptAtCompletion() {TCD->CSR |= DMA_TCD_CSR_INTMAJOR;}
+protected:
+	DMABaseClass() {}
+};
+
+class DMASetting : public DMABaseClass
+{
+public:
+	DMASetting()
+	{
+		TCD = &tcddata;
+		memset(&tcddata, 0, sizeof(tcddata));
+	}
+private:
+	TCD_t tcddata __attribute__((aligned(32)));
+};
+
+class DMAChannel : public DMABaseClass
+{
+public:
+	DMAChannel() {begin();}
+	void begin(bool force_initialization = false)
+	{
+		(void)force_initialization;
+		TCD = &tcddata;
+		memset(&tcddata, 0, sizeof(tcddata));
+		channel = 0;
+	}
+	DMAChannel &operator=(const DMASetting &rhs)
+	{
+		*TCD = *rhs.TCD;
+		return *this;
+	}
+	void enable() {}
+	void disable() {}
+	void triggerManual()
+	{
+		TCD->CSR &= ~DMA_TCD_CSR_DONE;
+		for (;;)
+		{
+			// one minor loop
+			memcpy((void *)TCD->DADDR, (const void *)TCD->SADDR, TCD->NBYTES);
+			TCD->SADDR = (const uint8_t *)TCD->SADDR + TCD->NBYTES;
+			TCD->DADDR = (uint8_t *)TCD->DADDR + TCD->NBYTES;
+			TCD->CSR &= ~DMA_TCD_CSR_START;
+			if (--TCD->CITER) return;		// waits for the next request
+			TCD->SADDR = (const uint8_t *)TCD->SADDR + TCD->SLAST;
+			if (!(TCD->CSR & DMA_TCD_CSR_ESG))
+			{
+				TCD->DADDR = (uint8_t *)TCD->DADDR + TCD->DLASTSGA;
+				TCD->CITER = TCD->BITER;
+				TCD->CSR |= DMA_TCD_CSR_DONE;
+				return;
+			}
+			// scatter/gather: the next TCD replaces the channel one
+			*TCD = *(const TCD_t *)TCD->DLASTSGA;
+			if (!(TCD->CSR & DMA_TCD_CSR_START)) return;
+		}
+	}
+	bool complete() {return TCD->CSR & DMA_TCD_CSR_DONE;}
+	void clearComplete() {TCD->CSR &= ~DMA_TCD_CSR_DONE;}
+	bool error() {return false;}
+	uint8_t channel;
+private:
+	TCD_t tcddata;
+};
+
+#endif // _HOSTSIM_DMACHANNEL_H_
@@ -0,0 +1,78 @@
+/**
+ * @file FS.h
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Host (Linux) stand-in for the Teensy file system API (FS.h):
+ * 		File and FS on top of a host directory, used by SD.h.
+ * 		Copies of a File share the open file like on the Teensy,
+ * 		it is closed with the last copy.
+ * @version 0.1
+ * @date 2024-03-15
+ */
+#ifndef _HOSTSIM_FS_H_
+#define _HOSTSIM_FS_H_
+
+#include <Arduino.h>
+#include <memory>
+#include <string>
+
+#define FILE_READ			(0)
+#define FILE_WRITE			(1)		// append, the file is created if missing
+#define FILE_WRITE_BEGIN	(2)		// write from the start, the file is created if missing
+
+enum SeekMode
+{
+	SeekSet = 0,
+	SeekCur = 1,
+	SeekEnd = 2
+};
+
+struct HostFileImpl;
+
+class File : public Stream
+{
+public:
+	File() {}
+	File(std::shared_ptr<HostFileImpl> impl) : f(impl) {}
+	size_t read(void *buf, size_t nbyte);
+	int read() override;
+	int peek() override;
+	int available() override;
+	size_t write(uint8_t c) override { return write(&c, 1); }
+	size_t write(const uint8_t *buf, size_t len) override;
+	size_t write(const void *buf, size_t len) { return write((const uint8_t *)buf, len); }
+	using Print::write;
+	void flush() override;
+	bool seek(uint64_t pos, int mode = SeekSet);
+	uint64_t position();
+	uint64_t size();
+	void close();
+	bool isOpen() { return (bool)f; }
+	operator bool() { return isOpen(); }
+	const char *name();
+	bool isDirectory();
+	File openNextFile(uint8_t mode = FILE_READ);
+	void rewindDirectory();
+private:
+	std::shared_ptr<HostFileImpl> f;
+};
+
+class FS
+{
+public:
+	File open(const char *filename, uint8_t mode = FILE_READ);
+	bool exists(const char *filepath);
+	bool mkdir(const char *filepath);
+	bool rename(const char *oldfilepath, const char *newfilepath);
+	bool remove(const char *filepath);
+	bool rmdir(const char *filepath);
+	/**
+	 * @brief Host only: directory the file system root is mapped to
+	 */
+	void setRoot(const char *dir) { root = dir; }
+	const char *getRoot() { return root.c_str(); }
+protected:
+	std::string root = ".";
+	std::string hostPath(const char *path);
+};
+
+#endif // _HOSTSIM_FS_H_
@@ -0,0 +1,78 @@
+/**
+ * @file HostRT.h
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Real time helpers for the live host runner (Linux):
+ * 		memory locking, SCHED_FIFO threads and the allocation trap.
+ * 		The trap replaces malloc/free (and with them new/delete) and the
+ * 		pthread mutex/rwlock locks of the program. A thread arms it around
+ * 		its audio callback, every allocation, free or lock while armed is
+ * 		counted with its caller address, or aborts the program in the
+ * 		abort mode (the core dump shows the stack). Only the calls going
+ * 		through the dynamic linker are seen, the ones inside the C library
+ * 		are not.
+ * 		Linking HostRT.cpp installs the replacements for the whole program,
+ * 		the other threads only pay a thread local flag check.
+ * @version 0.1
+ * @date 2024-03-12
+ */
+#ifndef _HOSTRT_H_
+#define _HOSTRT_H_
+
+#include <Arduino.h>
+#include <pthread.h>
+
+#define HOSTRT_TRAP_SITES		(16)
+
+class HostRT
+{
+public:
+	/**
+	 * @brief Lock the current and future memory of the process, stop the
+	 * 			allocator from returning memory to the system and prefault
+	 * 			the stack of the calling thread
+	 * @return false if mlockall() failed (no CAP_IPC_LOCK or RLIMIT_MEMLOCK too low)
+	 */
+	static bool lockMemory();
+	/**
+	 * @brief Start a thread with the SCHED_FIFO policy, the stack is
+	 * 			prefaulted before the function runs. Falls back to a normal
+	 * 			thread if the process may not use real time priorities.
+	 *
+	 * @param priority 1..99, 0 = normal thread
+	 * @return false if no thread could be started
+	 */
+	static bool startThread(pthread_t &thread, void *(*func)(void *), void *arg, int priority);
+	/**
+	 * @brief Scheduling policy and priority of the calling thread as text,
+	 * 			ie. "SCHED_FIFO 80"
+	 */
+	static const char *schedName(char *buf, size_t len);
+	static void prefaultStack();
+
+	typedef enum
+	{
+		TRAP_ALLOC,		// malloc, calloc, realloc, memalign, new
+		TRAP_FREE,		// free, delete
+		TRAP_LOCK,		// pthread_mutex_lock, pthread_rwlock_rd/wrlock
+		TRAP_KINDS
+	} trap_kind_t;
+	/**
+	 * @brief Arm or disarm the trap for the calling thread
+	 */
+	static void trapArm(bool state);
+	static bool trapArmed();
+	/**
+	 * @brief Abort at the first trapped call instead of counting it
+	 */
+	static void trapAbort(bool state);
+	static uint32_t trapCount(trap_kind_t kind);
+	static uint32_t trapTotal();
+	/**
+	 * @brief Print the counts and the first HOSTRT_TRAP_SITES distinct call
+	 * 			sites (symbols need the executable linked with -rdynamic)
+	 */
+	static void trapReport(FILE *out);
+	static void trapReset();
+};
+
+#endif // _HOSTRT_H_
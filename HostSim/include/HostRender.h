@@ -0,0 +1,83 @@
+/**
+ * @file HostRender.h
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Multi threaded offline renderer for the host (Linux).
+ * 		Runs many independent tracks (input file + its own chain of
+ * 		AudioChainStage_F32 effects) on a pool of worker threads.
+ * 		The work unit is one block of one stage of one track. The stages
+ * 		of a track are pipelined: while stage k processes block n, stage
+ * 		k+1 can process block n-1 on another thread. Every track buffer
+ * 		is processed in place, the result is the same as a serial run.
+ * 		Each worker has its own task queue, idle workers steal tasks
+ * 		from the other queues, so long and short tracks are balanced.
+ * @version 0.1
+ * @date 2024-03-11
+ */
+#ifndef _HOSTRENDER_H_
+#define _HOSTRENDER_H_
+
+#include <Arduino.h>
+#include <vector>
+#include <string>
+#include "AudioStream_F32.h"
+#include "AudioChain_F32.h"
+
+class HostRenderTrack
+{
+public:
+	std::string name;
+	std::vector<AudioChainStage_F32 *> stages;	// owned by the caller, one set per track
+	std::vector<float32_t> L, R;				// input, replaced by the output
+};
+
+class HostRender
+{
+public:
+	/**
+	 * @brief Render all the tracks
+	 *
+	 * @param tracks tracks, the stages must not be shared between tracks
+	 * @param threads number of worker threads
+	 * @param blockLen samples per block, max AUDIO_BLOCK_SAMPLES
+	 * @return wall time in seconds
+	 */
+	static double run(std::vector<HostRenderTrack *> &tracks, uint32_t threads, uint16_t blockLen = AUDIO_BLOCK_SAMPLES);
+};
+
+/**
+ * @brief Runs an AudioStream_F32 effect (library object) as a chain stage
+ * 		outside the audio scheduler: the block is sent to the object from
+ * 		a feed object, its update() is called and the output is taken from
+ * 		a capture object. Extra inputs (side chain) get the same signal.
+ * 		The object must not be connected to anything else.
+ */
+class AudioStreamStage_F32 : public AudioChainStage_F32
+{
+public:
+	AudioStreamStage_F32(AudioStream_F32 &effect, uint8_t inputs = 2);
+	~AudioStreamStage_F32();
+	void processBlock(float32_t *L, float32_t *R, uint16_t len) override;
+private:
+	class Feed : public AudioStream_F32
+	{
+	public:
+		Feed() : AudioStream_F32(0, NULL) {}
+		void update(void) {}
+		void send(audio_block_f32_t *block, unsigned char index) { transmit(block, index); }
+	};
+	class Capture : public AudioStream_F32
+	{
+	public:
+		Capture() : AudioStream_F32(2, inputQueueArray) {}
+		void update(void) {}
+		audio_block_f32_t *take(unsigned int index) { return receiveReadOnly_f32(index); }
+	private:
+		audio_block_f32_t *inputQueueArray[2];
+	};
+	AudioStream_F32 &effect;
+	Feed feed;
+	Capture capture;
+	std::vector<AudioConnection_F32 *> cables;
+};
+
+#endif // _HOSTRENDER_H_
@@ -0,0 +1,97 @@
+/**
+ * @file HostSim.h
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Host (Linux) simulator of the Teensy audio system.
+ * 		Replaces the I2S interrupt with a loop processing the input WAV
+ * 		file block by block as fast as possible. The sketch setup() and
+ * 		loop() are called like on the Teensy, loop() once per audio block.
+ * 		The input and output endpoints (HostSim_IO_F32.h) read and write
+ * 		the audio at the current simulated time.
+ * @version 0.1
+ * @date 2024-03-01
+ */
+#ifndef _HOSTSIM_H_
+#define _HOSTSIM_H_
+
+#include <Arduino.h>
+#include <vector>
+#include "AudioStream_F32.h"
+
+class HostSim
+{
+public:
+	/**
+	 * @brief Load the input signal from a WAV file, mono files are
+	 * 			copied to both channels
+	 */
+	static bool loadInput(const char *path);
+	/**
+	 * @brief Generate the input signal
+	 *
+	 * @param type "sine" (110Hz), "noise" or "impulse"
+	 * @param seconds signal length
+	 */
+	static bool generateInput(const char *type, float32_t seconds);
+	static bool saveOutput(const char *path);
+	/**
+	 * @brief Process one audio block and advance the simulated time
+	 */
+	static void processBlock();
+	/**
+	 * @brief Allocate the output for the input + tail
+	 * @return number of audio blocks to process
+	 */
+	static uint32_t prepare(float32_t tailSeconds);
+	static uint64_t sampleTime() { return samplePos; }
+	static float32_t inputSampleRate() { return inFs; }
+	static const std::vector<float32_t> &input(uint8_t channel) { return channel ? inR : inL; }
+	/**
+	 * @brief Print the per object CPU usage in % of the audio block period
+	 * 			(host CPU time), the peak number of blocks in use during
+	 * 			its update() and the failed allocations, and the audio
+	 * 			memory usage
+	 */
+	static void report(FILE *out, double wallSeconds);
+	/**
+	 * @brief Print the audio block pool usage: peak against the size set
+	 * 			with AudioMemory_F32(), the allocation failures, and in
+	 * 			the calibration mode the minimum pool size
+	 * @return peak number of blocks in use
+	 */
+	static uint32_t reportPool(FILE *out);
+	/**
+	 * @brief Measure the delay of the output against the input (cross
+	 * 			correlation peak) and print it together with the estimated
+	 * 			round trip latency on the Teensy: one block of input DMA
+	 * 			and one block of output DMA buffering are added.
+	 * 			Use a noise or impulse input, periodic signals are ambiguous.
+	 *
+	 * @return measured delay in samples, -1 if there is no output
+	 */
+	static int32_t reportLatency(FILE *out);
+	/**
+	 * @brief Check the output for NaN or Inf samples
+	 */
+	static bool outputValid();
+	/**
+	 * @brief Live mode (real time runner): the endpoints read and write
+	 * 			these AUDIO_BLOCK_SAMPLES long buffers instead of the input
+	 * 			and output signals, set before every processBlock().
+	 * 			The outputs are added, clear them before the block.
+	 * 			NULL pointers switch back to the signals.
+	 */
+	static void setLiveBuffers(const float32_t *inL, const float32_t *inR, float32_t *outL, float32_t *outR);
+
+	// used by the audio endpoints
+	static void readInput(float32_t *L, float32_t *R, uint32_t len);
+	static void writeOutput(const float32_t *L, const float32_t *R, uint32_t len);
+
+private:
+	static std::vector<float32_t> inL, inR, outL, outR;
+	static float32_t inFs;
+	static uint64_t samplePos;
+	static const float32_t *liveInL, *liveInR;
+	static float32_t *liveOutL, *liveOutR;
+};
+
+#endif // _HOSTSIM_H_
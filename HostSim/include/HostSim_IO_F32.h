@@ -0,0 +1,75 @@
+/**
+ * @file HostSim_IO_F32.h
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Host (Linux) audio endpoints replacing the I2S input/output
+ * 		objects and the codec controls. The inputs read the input WAV
+ * 		file, the outputs write the output WAV file. The I2S class names
+ * 		used by the examples are aliases of the WAV endpoints, so the
+ * 		example graphs build unchanged.
+ * @version 0.1
+ * @date 2024-03-01
+ */
+#ifndef _HOSTSIM_IO_F32_H_
+#define _HOSTSIM_IO_F32_H_
+
+#include <Arduino.h>
+#include "AudioStream_F32.h"
+
+class AudioInputWAV_F32 : public AudioStream_F32
+{
+public:
+	AudioInputWAV_F32() : AudioStream_F32(0, NULL) { active = true; }
+	AudioInputWAV_F32(const void *) : AudioInputWAV_F32() {}	// AudioSettings_F32 variant
+	virtual void update(void);
+};
+
+class AudioOutputWAV_F32 : public AudioStream_F32
+{
+public:
+	AudioOutputWAV_F32() : AudioStream_F32(2, inputQueueArray) {}
+	AudioOutputWAV_F32(const void *) : AudioOutputWAV_F32() {}
+	virtual void update(void);
+private:
+	audio_block_f32_t *inputQueueArray[2];
+};
+
+typedef AudioInputWAV_F32 AudioInputI2S_F32;
+typedef AudioInputWAV_F32 AudioInputI2S2_F32;
+typedef AudioOutputWAV_F32 AudioOutputI2S_F32;
+typedef AudioOutputWAV_F32 AudioOutputI2S2_F32;
+
+#define AUDIO_INPUT_LINEIN	0
+#define AUDIO_INPUT_MIC		1
+
+/**
+ * @brief Codec controls, all settings are accepted and ignored
+ */
+class AudioControlWM8731
+{
+public:
+	bool enable(void) { return true; }
+	bool disable(void) { return true; }
+	bool inputSelect(int) { return true; }
+	bool inputLevel(float) { return true; }
+	bool volume(float) { return true; }
+	bool hp_filter(bool) { return true; }
+	bool dcBias_filter(bool) { return true; }
+};
+
+class AudioControlSGTL5000
+{
+public:
+	bool enable(void) { return true; }
+	bool disable(void) { return true; }
+	bool inputSelect(int) { return true; }
+	bool volume(float) { return true; }
+	bool lineInLevel(uint8_t) { return true; }
+	bool lineInLevel(uint8_t, uint8_t) { return true; }
+	bool lineOutLevel(uint8_t) { return true; }
+	bool micGain(unsigned int) { return true; }
+	bool unmuteHeadphone(void) { return true; }
+	bool adcHighPassFilterDisable(void) { return true; }
+	bool adcHighPassFilterEnable(void) { return true; }
+};
+
+#endif // _HOSTSIM_IO_F32_H_
@@ -0,0 +1,17 @@
+/**
+ * @file OpenAudio_ArduinoLibrary.h
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Host (Linux) stand-in for the OpenAudio library header:
+ * 		AudioStream_F32 core and the WAV file endpoints used in place
+ * 		of the I2S input/output objects.
+ * @version 0.1
+ * @date 2024-03-01
+ */
+#ifndef _HOSTSIM_OPENAUDIO_ARDUINOLIBRARY_H_
+#define _HOSTSIM_OPENAUDIO_ARDUINOLIBRARY_H_
+
+#include <Arduino.h>
+#include "AudioStream_F32.h"
+#include "HostSim_IO_F32.h"
+
+#endif // _HOSTSIM_OPENAUDIO_ARDUINOLIBRARY_H_
@@ -0,0 +1,26 @@
+/**
+ * @file SD.h
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Host (Linux) stand-in for the Teensy SD library, the card is
+ * 		a host directory (runner option -f dir, default the current one)
+ * @version 0.1
+ * @date 2024-03-15
+ */
+#ifndef _HOSTSIM_SD_H_
+#define _HOSTSIM_SD_H_
+
+#include "FS.h"
+
+#define BUILTIN_SDCARD	(254)
+
+class SDClass : public FS
+{
+public:
+	/**
+	 * @return false if the root directory does not exist
+	 */
+	bool begin(uint8_t csPin = BUILTIN_SDCARD);
+};
+extern SDClass SD;
+
+#endif // _HOSTSIM_SD_H_
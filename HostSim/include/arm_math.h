@@ -0,0 +1,168 @@
+/**
+ * @file arm_math.h
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Host (Linux) implementation of the CMSIS-DSP subset used by
+ * 		the audio libraries. Plain C reference code with the same
+ * 		data layouts and scaling as CMSIS, it is not optimized.
+ * @version 0.1
+ * @date 2024-03-01
+ */
+#ifndef _HOSTSIM_ARM_MATH_H_
+#define _HOSTSIM_ARM_MATH_H_
+
+#include <stdint.h>
+#include <math.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef float float32_t;
+typedef double float64_t;
+typedef int8_t q7_t;
+typedef int16_t q15_t;
+typedef int32_t q31_t;
+
+typedef enum
+{
+	ARM_MATH_SUCCESS = 0,
+	ARM_MATH_ARGUMENT_ERROR = -1,
+	ARM_MATH_LENGTH_ERROR = -2,
+	ARM_MATH_SIZE_MISMATCH = -3,
+	ARM_MATH_NANINF = -4,
+	ARM_MATH_SINGULAR = -5,
+	ARM_MATH_TEST_FAILURE = -6
+} arm_status;
+
+// basic math
+void arm_fill_f32(float32_t value, float32_t *pDst, uint32_t blockSize);
+void arm_copy_f32(const float32_t *pSrc, float32_t *pDst, uint32_t blockSize);
+void arm_scale_f32(const float32_t *pSrc, float32_t scale, float32_t *pDst, uint32_t blockSize);
+void arm_offset_f32(const float32_t *pSrc, float32_t offset, float32_t *pDst, uint32_t blockSize);
+void arm_add_f32(const float32_t *pSrcA, const float32_t *pSrcB, float32_t *pDst, uint32_t blockSize);
+void arm_sub_f32(const float32_t *pSrcA, const float32_t *pSrcB, float32_t *pDst, uint32_t blockSize);
+void arm_mult_f32(const float32_t *pSrcA, const float32_t *pSrcB, float32_t *pDst, uint32_t blockSize);
+void arm_negate_f32(const float32_t *pSrc, float32_t *pDst, uint32_t blockSize);
+void arm_abs_f32(const float32_t *pSrc, float32_t *pDst, uint32_t blockSize);
+void arm_dot_prod_f32(const float32_t *pSrcA, const float32_t *pSrcB, uint32_t blockSize, float32_t *result);
+void arm_float_to_q15(const float32_t *pSrc, q15_t *pDst, uint32_t blockSize);
+void arm_q15_to_float(const q15_t *pSrc, float32_t *pDst, uint32_t blockSize);
+
+// statistics
+void arm_max_f32(const float32_t *pSrc, uint32_t blockSize, float32_t *pResult, uint32_t *pIndex);
+void arm_min_f32(const float32_t *pSrc, uint32_t blockSize, float32_t *pResult, uint32_t *pIndex);
+void arm_mean_f32(const float32_t *pSrc, uint32_t blockSize, float32_t *pResult);
+void arm_rms_f32(const float32_t *pSrc, uint32_t blockSize, float32_t *pResult);
+void arm_power_f32(const float32_t *pSrc, uint32_t blockSize, float32_t *pResult);
+
+// fast math
+float32_t arm_sin_f32(float32_t x);
+float32_t arm_cos_f32(float32_t x);
+arm_status arm_sqrt_f32(float32_t in, float32_t *pOut);
+
+// complex math, interleaved re,im
+void arm_cmplx_mult_cmplx_f32(const float32_t *pSrcA, const float32_t *pSrcB, float32_t *pDst, uint32_t numSamples);
+void arm_cmplx_mag_f32(const float32_t *pSrc, float32_t *pDst, uint32_t numSamples);
+void arm_cmplx_mag_squared_f32(const float32_t *pSrc, float32_t *pDst, uint32_t numSamples);
+void arm_cmplx_conj_f32(const float32_t *pSrc, float32_t *pDst, uint32_t numSamples);
+
+// filters
+typedef struct
+{
+	uint32_t numStages;
+	float32_t *pState;
+	const float32_t *pCoeffs;
+} arm_biquad_casd_df1_inst_f32;
+
+typedef struct
+{
+	uint8_t numStages;
+	float32_t *pState;
+	const float32_t *pCoeffs;
+} arm_biquad_cascade_df2T_instance_f32;
+
+typedef struct
+{
+	uint8_t numStages;
+	float32_t *pState;
+	const float32_t *pCoeffs;
+} arm_biquad_cascade_stereo_df2T_instance_f32;
+
+typedef struct
+{
+	uint16_t numTaps;
+	float32_t *pState;
+	const float32_t *pCoeffs;
+} arm_fir_instance_f32;
+
+// coefficients per stage: b0, b1, b2, a1, a2 (feedback coefficients with the sign already inverted)
+void arm_biquad_cascade_df1_init_f32(arm_biquad_casd_df1_inst_f32 *S, uint8_t numStages, const float32_t *pCoeffs, float32_t *pState);
+void arm_biquad_cascade_df1_f32(const arm_biquad_casd_df1_inst_f32 *S, const float32_t *pSrc, float32_t *pDst, uint32_t blockSize);
+void arm_biquad_cascade_df2T_init_f32(arm_biquad_cascade_df2T_instance_f32 *S, uint8_t numStages, const float32_t *pCoeffs, float32_t *pState);
+void arm_biquad_cascade_df2T_f32(const arm_biquad_cascade_df2T_instance_f32 *S, const float32_t *pSrc, float32_t *pDst, uint32_t blockSize);
+void arm_biquad_cascade_stereo_df2T_init_f32(arm_biquad_cascade_stereo_df2T_instance_f32 *S, uint8_t numStages, const float32_t *pCoeffs, float32_t *pState);
+void arm_biquad_cascade_stereo_df2T_f32(const arm_biquad_cascade_stereo_df2T_instance_f32 *S, const float32_t *pSrc, float32_t *pDst, uint32_t blockSize);
+// pState has to be numTaps + blockSize - 1 long, coefficients in time reversed order
+void arm_fir_init_f32(arm_fir_instance_f32 *S, uint16_t numTaps, const float32_t *pCoeffs, float32_t *pState, uint32_t blockSize);
+void arm_fir_f32(const arm_fir_instance_f32 *S, const float32_t *pSrc, float32_t *pDst, uint32_t blockSize);
+
+// transforms
+typedef struct
+{
+	uint16_t fftLen;
+	const float32_t *pTwiddle;
+	const uint16_t *pBitRevTable;
+	uint16_t bitRevLength;
+} arm_cfft_instance_f32;
+
+typedef struct
+{
+	arm_cfft_instance_f32 Sint;
+	uint16_t fftLenRFFT;
+	const float32_t *pTwiddleRFFT;
+} arm_rfft_fast_instance_f32;
+
+typedef struct
+{
+	uint16_t fftLen;
+	uint8_t ifftFlag;
+	uint8_t bitReverseFlag;
+	float32_t onebyfftLen;
+} arm_cfft_radix4_instance_f32;
+
+typedef arm_cfft_radix4_instance_f32 arm_cfft_radix2_instance_f32;
+
+extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len16;
+extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len32;
+extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len64;
+extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len128;
+extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len256;
+extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len512;
+extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len1024;
+extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len2048;
+extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len4096;
+
+/**
+ * In place complex FFT of fftLen interleaved re,im pairs.
+ * The inverse transform is scaled by 1/fftLen, bitReverseFlag = 0
+ * leaves the output in the bit reversed order.
+ */
+arm_status arm_cfft_init_f32(arm_cfft_instance_f32 *S, uint16_t fftLen);
+void arm_cfft_f32(const arm_cfft_instance_f32 *S, float32_t *p1, uint8_t ifftFlag, uint8_t bitReverseFlag);
+arm_status arm_cfft_radix4_init_f32(arm_cfft_radix4_instance_f32 *S, uint16_t fftLen, uint8_t ifftFlag, uint8_t bitReverseFlag);
+void arm_cfft_radix4_f32(const arm_cfft_radix4_instance_f32 *S, float32_t *pSrc);
+arm_status arm_cfft_radix2_init_f32(arm_cfft_radix2_instance_f32 *S, uint16_t fftLen, uint8_t ifftFlag, uint8_t bitReverseFlag);
+void arm_cfft_radix2_f32(const arm_cfft_radix2_instance_f32 *S, float32_t *pSrc);
+/**
+ * Real FFT of fftLen samples, the spectrum is packed as
+ * DC, Nyquist, re[1], im[1] ... re[fftLen/2-1], im[fftLen/2-1].
+ * The inverse transform is scaled by 1/fftLen.
+ */
+arm_status arm_rfft_fast_init_f32(arm_rfft_fast_instance_f32 *S, uint16_t fftLen);
+void arm_rfft_fast_f32(const arm_rfft_fast_instance_f32 *S, float32_t *p, float32_t *pOut, uint8_t ifftFlag);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _HOSTSIM_ARM_MATH_H_
@@ -0,0 +1,127 @@
+/**
+ * @file main.cpp
+ * @author Piotr Zapart www.hexefx.com
+ * @brief IR preprocessing tool: leading silence removal, minimum phase
+ * 		conversion and tail truncation of WAV impulse responses with the
+ * 		same code the device uses (IRTrim_F32), and how many samples and
+ * 		convolver partitions it saves.
+ * @version 0.1
+ * @date 2024-03-16
+ */
+#include <Arduino.h>
+#include <getopt.h>
+#include <string>
+#include <vector>
+#include "IRTrim_F32.h"
+#include "IRLoader_F32.h"
+#include "AudioFilterIRConvolver_F32.h"
+#include "../src/wav_file.h"
+
+static void usage(const char *name)
+{
+	fprintf(stderr,
+		"usage: %s [options] ir.wav ...\n"
+		"  -s dB           leading silence threshold re peak (default -60, 0 = off)\n"
+		"  -m              convert to minimum phase\n"
+		"  -t dB           tail threshold, remaining energy re total (default -60, 0 = off)\n"
+		"  -l ms           maximum length\n"
+		"  -r              resample to the audio rate first, like the device\n"
+		"  -o dir          write the processed IRs (32bit float) to dir\n", name);
+}
+
+static uint16_t partitions(uint32_t len, float32_t rate, uint16_t partMax)
+{
+	// the convolver runs at the audio rate
+	return IRPartitions_F32::count((uint32_t)ceilf(len * AUDIO_SAMPLE_RATE_EXACT / rate), partMax);
+}
+
+int main(int argc, char **argv)
+{
+	float32_t leadDb = -60.0f, tailDb = -60.0f, maxMs = 0.0f;
+	bool minPhase = false, resample = false;
+	const char *outDir = NULL;
+	int opt;
+	while ((opt = getopt(argc, argv, "s:mt:l:ro:h")) != -1)
+	{
+		switch (opt)
+		{
+			case 's': leadDb = atof(optarg); break;
+			case 'm': minPhase = true; break;
+			case 't': tailDb = atof(optarg); break;
+			case 'l': maxMs = atof(optarg); break;
+			case 'r': resample = true; break;
+			case 'o': outDir = optarg; break;
+			default: usage(argv[0]); return opt == 'h' ? 0 : 1;
+		}
+	}
+	if (optind >= argc)
+	{
+		usage(argv[0]);
+		return 1;
+	}
+	printf("%-24s %7s %17s %8s %17s %17s\r\n", "IR", "rate", "length ms", "lead ms", "partitions", "uniform parts");
+	uint64_t tapsIn = 0, tapsOut = 0;
+	uint32_t partsIn = 0, partsOut = 0;
+	int result = 0;
+	for (int i = optind; i < argc; i++)
+	{
+		std::vector<float> L, R;
+		float32_t rate;
+		const char *name = strrchr(argv[i], '/') ? strrchr(argv[i], '/') + 1 : argv[i];
+		if (!wav_read(argv[i], L, R, rate) || L.empty())
+		{
+			printf("%-24s read error\r\n", name);
+			result = 1;
+			continue;
+		}
+		if (resample && fabsf(rate / AUDIO_SAMPLE_RATE_EXACT - 1.0f) > IR_LOADER_RATE_TOLERANCE)
+		{
+			uint32_t n;
+			float32_t *res = IRLoader_F32::resample(L.data(), L.size(), rate, AUDIO_SAMPLE_RATE_EXACT, n);
+			L.assign(res, res + n);
+			extmem_free(res);
+			rate = AUDIO_SAMPLE_RATE_EXACT;
+		}
+		const uint32_t len = L.size();
+		uint32_t n = len;
+		if (leadDb < 0.0f) n = IRTrim_F32::leading(L.data(), n, leadDb);
+		const uint32_t lead = len - n;
+		if (minPhase && !IRTrim_F32::minimumPhase(L.data(), n))
+			printf("%-24s too long for the minimum phase conversion, skipped\r\n", name);
+		if (tailDb < 0.0f) n = IRTrim_F32::tail(L.data(), n, tailDb);
+		if (maxMs > 0.0f && n > maxMs * 0.001f * rate)
+		{
+			n = max((uint32_t)(maxMs * 0.001f * rate), (uint32_t)1);
+			IRTrim_F32::fadeOut(L.data(), n);
+		}
+		L.resize(n);
+
+		const uint16_t pIn = partitions(len, rate, IR_CONV_PART_MAX), pOut = partitions(n, rate, IR_CONV_PART_MAX);
+		const uint16_t uIn = partitions(len, rate, AUDIO_BLOCK_SAMPLES), uOut = partitions(n, rate, AUDIO_BLOCK_SAMPLES);
+		char lenStr[32], partStr[32], uniStr[32];
+		snprintf(lenStr, sizeof(lenStr), "%.1f -> %.1f", len * 1000.0f / rate, n * 1000.0f / rate);
+		snprintf(partStr, sizeof(partStr), "%u -> %u", pIn, pOut);
+		snprintf(uniStr, sizeof(uniStr), "%u -> %u", uIn, uOut);
+		printf("%-24s %7.0f %17s %8.2f %17s %17s\r\n", name, rate, lenStr, lead * 1000.0f / rate, partStr, uniStr);
+		tapsIn += len;
+		tapsOut += n;
+		partsIn += uIn;
+		partsOut += uOut;
+		if (outDir)
+		{
+			const std::string path = std::string(outDir) + "/" + name;
+			if (!wav_write(path.c_str(), L, L, rate))
+			{
+				printf("%-24s write error %s\r\n", name, path.c_str());
+				result = 1;
+			}
+		}
+	}
+	if (tapsIn)
+	{
+		printf("Saved %llu of %llu taps (%.1f%%), %u of %u block partitions (%.1f%%)\r\n",
+			   (unsigned long long)(tapsIn - tapsOut), (unsigned long long)tapsIn, 100.0f * (tapsIn - tapsOut) / tapsIn,
+			   partsIn - partsOut, partsIn, partsIn ? 100.0f * (partsIn - partsOut) / partsIn : 0.0f);
+	}
+	return result;
+}
@@ -0,0 +1,212 @@
+/**
+ * @file main.cpp
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Offline batch renderer: runs the amp chain of the NeuralAmpModeler
+ * 		example over many input files on all cores, see HostRender.h.
+ * 		Every track gets its own chain:
+ * 			amp -> tone stack -> gate -> delay -> reverb -> cabsim
+ * 		The library effects are used when built with hexefx_audiolib_F32,
+ * 		otherwise the chain is the amp only.
+ * @version 0.1
+ * @date 2024-03-11
+ */
+#include <Arduino.h>
+#include <getopt.h>
+#include <thread>
+#include <memory>
+#include "HostRender.h"
+#include "RTNeural_F32.h"
+#include "../src/wav_file.h"
+#ifdef HOSTRENDER_HEXEFX
+#include "hexefx_audio_F32.h"
+#endif
+
+#ifdef HOSTRENDER_HEXEFX
+#define TRACK_STAGES	(6)
+#else
+#define TRACK_STAGES	(1)
+#endif
+
+class TrackChain
+{
+public:
+	TrackChain(uint8_t model, uint8_t factor)
+	{
+		amp.changeModel(model);
+		amp.oversample(factor);
+		track.stages.push_back(&amp);
+#ifdef HOSTRENDER_HEXEFX
+		// same settings as the example at startup
+		gate.setOpeningTime(0.01f);
+		gate.setClosingTime(0.05f);
+		gate.setHoldTime(0.2f);
+		gate.setThreshold(-65);
+		echo.time(0.5f);
+		echo.feedback(0.3f);
+		echo.mix(0.20f);
+		reverb.time(0.6f);
+		reverb.bass_cut(0.75f);
+		reverb.treble_cut(0.8f);
+		reverb.mix(0.2f);
+		cabsim.ir_load(6);
+		track.stages.push_back(&toneStackStage);
+		track.stages.push_back(&gateStage);
+		track.stages.push_back(&echoStage);
+		track.stages.push_back(&reverbStage);
+		track.stages.push_back(&cabsimStage);
+#endif
+	}
+	HostRenderTrack track;
+private:
+	AudioEffectRTNeural_F32 amp;
+#ifdef HOSTRENDER_HEXEFX
+	AudioFilterEqualizer3bandStereo_F32	toneStack;
+	AudioEffectNoiseGateStereo_F32 gate;
+	AudioEffectDelayStereo_F32 echo = AudioEffectDelayStereo_F32(1000, true);
+	AudioEffectSpringReverb_F32 reverb;
+	AudioFilterIRCabsim_F32 cabsim;
+	AudioStreamStage_F32 toneStackStage = AudioStreamStage_F32(toneStack);
+	AudioStreamStage_F32 gateStage = AudioStreamStage_F32(gate, 4);	// side chain fed with the gate input
+	AudioStreamStage_F32 echoStage = AudioStreamStage_F32(echo);
+	AudioStreamStage_F32 reverbStage = AudioStreamStage_F32(reverb);
+	AudioStreamStage_F32 cabsimStage = AudioStreamStage_F32(cabsim);
+#endif
+};
+
+typedef struct
+{
+	std::string name;
+	std::vector<float32_t> L, R;
+} input_t;
+
+static void usage(const char *name)
+{
+	fprintf(stderr,
+		"usage: %s [options] input.wav ...\n"
+		"  -g tracks:sec   generated noise tracks instead of files\n"
+		"  -o dir          write the outputs to dir/<input>_render.wav\n"
+		"  -j threads      worker threads (default: all cores)\n"
+		"  -m model        amp model (default 1)\n"
+		"  -x factor       amp oversampling 1, 2 or 4 (default 1)\n"
+		"  -S              scaling table, render with 1, 2, 4 .. threads\n", name);
+}
+
+static double render(std::vector<input_t> &inputs, uint32_t threads, uint8_t model, uint8_t factor,
+					 std::vector<std::unique_ptr<TrackChain>> &chains)
+{
+	std::vector<HostRenderTrack *> tracks;
+	chains.clear();
+	for (input_t &in : inputs)
+	{
+		chains.emplace_back(new TrackChain(model, factor));
+		HostRenderTrack &tr = chains.back()->track;
+		tr.name = in.name;
+		tr.L = in.L;
+		tr.R = in.R;
+		tracks.push_back(&tr);
+	}
+	return HostRender::run(tracks, threads);
+}
+
+int main(int argc, char **argv)
+{
+	uint32_t threads = std::max(1u, std::thread::hardware_concurrency());
+	uint32_t genTracks = 0;
+	float genSeconds = 0.0f;
+	const char *outDir = NULL;
+	uint8_t model = 1, factor = 1;
+	bool scaling = false;
+	int opt;
+	while ((opt = getopt(argc, argv, "g:o:j:m:x:Sh")) != -1)
+	{
+		switch (opt)
+		{
+			case 'g':
+				if (sscanf(optarg, "%u:%f", &genTracks, &genSeconds) != 2) { usage(argv[0]); return 1; }
+				break;
+			case 'o': outDir = optarg; break;
+			case 'j': threads = std::max(1, atoi(optarg)); break;
+			case 'm': model = atoi(optarg); break;
+			case 'x': factor = atoi(optarg); break;
+			case 'S': scaling = true; break;
+			default: usage(argv[0]); return opt == 'h' ? 0 : 1;
+		}
+	}
+	AudioMemory_F32(256);
+
+	std::vector<input_t> inputs;
+	for (int i = optind; i < argc; i++)
+	{
+		input_t in;
+		float fs;
+		in.name = argv[i];
+		if (!wav_read(argv[i], in.L, in.R, fs))
+		{
+			fprintf(stderr, "Can't read the input %s\n", argv[i]);
+			return 1;
+		}
+		if (fabsf(fs - AUDIO_SAMPLE_RATE_EXACT) > 1000.0f)
+			fprintf(stderr, "Warning: %s sample rate %.0fHz, the audio runs at %.0fHz\n", argv[i], fs, AUDIO_SAMPLE_RATE_EXACT);
+		inputs.push_back(std::move(in));
+	}
+	uint32_t seed = 22222;
+	for (uint32_t t = 0; t < genTracks; t++)
+	{
+		input_t in;
+		in.name = "noise" + std::to_string(t) + ".wav";
+		in.L.resize((size_t)(genSeconds * AUDIO_SAMPLE_RATE_EXACT));
+		for (float32_t &x : in.L)
+		{
+			seed = seed * 1664525u + 1013904223u;
+			x = 0.5f * ((float32_t)(int32_t)seed / 2147483648.0f);
+		}
+		in.R = in.L;
+		inputs.push_back(std::move(in));
+	}
+	if (inputs.empty())
+	{
+		usage(argv[0]);
+		return 1;
+	}
+	double audioSeconds = 0.0;
+	for (input_t &in : inputs) audioSeconds += (double)in.L.size() / AUDIO_SAMPLE_RATE_EXACT;
+
+	std::vector<std::unique_ptr<TrackChain>> chains;
+	std::vector<uint32_t> runs;
+	if (scaling)
+		for (uint32_t n = 1; n < threads; n *= 2) runs.push_back(n);
+	runs.push_back(threads);
+	fprintf(stderr, "%u tracks, %.1fs of audio, %u stages per track, block = %d samples\n",
+			(uint32_t)inputs.size(), audioSeconds, TRACK_STAGES, AUDIO_BLOCK_SAMPLES);
+	fprintf(stderr, "threads  time      real time  per core%s\n", scaling ? "  speedup" : "");
+	double wall1 = 0.0;
+	for (uint32_t n : runs)
+	{
+		double wall = render(inputs, n, model, factor, chains);
+		if (n == 1) wall1 = wall;
+		fprintf(stderr, "%-7u  %6.2fs  %8.1fx  %7.1fx", n, wall, audioSeconds / wall, audioSeconds / wall / n);
+		if (scaling) fprintf(stderr, "  %6.2f", wall1 / wall);
+		fprintf(stderr, "\n");
+	}
+
+	if (outDir)
+	{
+		for (std::unique_ptr<TrackChain> &c : chains)
+		{
+			std::string base = c->track.name.substr(c->track.name.find_last_of('/') + 1);
+			base = base.substr(0, base.find_last_of('.'));
+			std::string path = std::string(outDir) + "/" + base + "_render.wav";
+			if (!wav_write(path.c_str(), c->track.L, c->track.R, AUDIO_SAMPLE_RATE_EXACT))
+			{
+				fprintf(stderr, "Can't write the output %s\n", path.c_str());
+				return 1;
+			}
+		}
+	}
+	if (AudioStream::hostStatsTotal().alloc_failures)
+	{
+		fprintf(stderr, "Audio block allocation failures!\n");
+		return 2;
+	}
+	return 0;
+}
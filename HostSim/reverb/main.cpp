@@ -0,0 +1,130 @@
+/**
+ * @file main.cpp
+ * @author Piotr Zapart www.hexefx.com
+ * @brief CPU load of the Dattorro plate reverb: the network block by
+ * 		block per line with the tank halves as lanes against the same
+ * 		network sample by sample, average, 99th percentile and worst block
+ * 		in % of the audio block time, and the largest difference of the
+ * 		outputs.
+ * 		The lanes run also with the tank in the PSRAM, read by the CPU
+ * 		and DMA staged, with the PSRAM accesses per block: the cache lines
+ * 		the CPU touches, the DMA transfers and the kB they move.
+ * 		The loads are measured on the host, they show the ratios, not the
+ * 		Teensy numbers. The host PSRAM is the heap and the DMA a memcpy.
+ * @version 0.1
+ * @date 2024-03-21
+ */
+#include <Arduino.h>
+#include <getopt.h>
+#include <vector>
+#include <algorithm>
+#include "AudioEffectPlateDattorro_F32.h"
+
+typedef struct
+{
+	float32_t avg;
+	float32_t p99;
+	float32_t max;
+} load_t;
+
+static void usage(const char *name)
+{
+	printf("Usage: %s [options]\r\n"
+		   "  -s seconds     audio processed (default 10)\r\n"
+		   "  -z size        reverb size 0.0 .. 1.0 (default 0.8)\r\n", name);
+}
+
+// noise bursts with silence between them, the output of both channels in out
+static load_t run(AudioEffectPlateDattorro_F32 &reverb, uint32_t blocks, float32_t blockNs, std::vector<float32_t> &out)
+{
+	float32_t L[AUDIO_BLOCK_SAMPLES], R[AUDIO_BLOCK_SAMPLES];
+	std::vector<uint32_t> times(blocks);
+	uint64_t sum = 0;
+	out.resize(2 * blocks * AUDIO_BLOCK_SAMPLES);
+	srand(1);
+	for (uint32_t b = 0; b < blocks; b++)
+	{
+		const bool burst = (b % 200) < 20;
+		for (uint32_t i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+		{
+			L[i] = burst ? (float32_t)rand() / RAND_MAX - 0.5f : 0.0f;
+			R[i] = burst ? (float32_t)rand() / RAND_MAX - 0.5f : 0.0f;
+		}
+		const uint32_t t0 = ARM_DWT_CYCCNT;
+		reverb.processBlock(L, R, AUDIO_BLOCK_SAMPLES);
+		const uint32_t t = ARM_DWT_CYCCNT - t0;
+		sum += t;
+		times[b] = t;
+		memcpy(&out[2 * b * AUDIO_BLOCK_SAMPLES], L, sizeof(L));
+		memcpy(&out[(2 * b + 1) * AUDIO_BLOCK_SAMPLES], R, sizeof(R));
+	}
+	std::sort(times.begin(), times.end());
+	load_t load;
+	load.avg = 100.0f * (float32_t)sum / blocks / blockNs;
+	load.p99 = 100.0f * times[blocks * 99 / 100] / blockNs;
+	load.max = 100.0f * times[blocks - 1] / blockNs;
+	return load;
+}
+
+int main(int argc, char **argv)
+{
+	float32_t seconds = 10.0f, size = 0.8f;
+	int opt;
+	while ((opt = getopt(argc, argv, "s:z:h")) != -1)
+	{
+		switch (opt)
+		{
+			case 's': seconds = atof(optarg); break;
+			case 'z': size = atof(optarg); break;
+			default: usage(argv[0]); return opt == 'h' ? 0 : 1;
+		}
+	}
+	const uint32_t blocks = max(1u, (uint32_t)(seconds * AUDIO_SAMPLE_RATE_EXACT / AUDIO_BLOCK_SAMPLES));
+	const float32_t blockNs = 1e9f * AUDIO_BLOCK_SAMPLES / AUDIO_SAMPLE_RATE_EXACT;
+	// sample by sample, lanes, lanes with the tank in the PSRAM: CPU, DMA
+	const uint8_t runs = 4;
+	AudioEffectPlateDattorro_F32 *reverb[runs];
+	for (uint8_t k = 0; k < runs; k++) reverb[k] = new AudioEffectPlateDattorro_F32(k >= 2);
+	for (uint8_t k = 0; k < runs; k++)
+	{
+		if (!reverb[k]->isReady())
+		{
+			printf("out of memory\r\n");
+			return 1;
+		}
+	}
+	std::vector<float32_t> out[runs];
+	load_t load[runs];
+	for (uint8_t k = 0; k < runs; k++)
+	{
+		reverb[k]->size(size);
+		reverb[k]->mix(1.0f);
+		reverb[k]->lanes_set(k != 0);
+		reverb[k]->staging_set(k == 3);
+		reverb[k]->resetMemStats();
+		load[k] = run(*reverb[k], blocks, blockNs, out[k]);
+	}
+	float32_t diff = 0.0f, peak = 0.0f;
+	for (uint32_t i = 0; i < out[0].size(); i++)
+	{
+		for (uint8_t k = 1; k < runs; k++) diff = max(diff, fabsf(out[k][i] - out[0][i]));
+		peak = max(peak, fabsf(out[0][i]));
+	}
+	printf("Block %u samples, %u blocks, delay lines %.1fkB\r\n", AUDIO_BLOCK_SAMPLES, blocks, reverb[0]->getBytes() / 1024.0f);
+	printf("%-18s %-16s %s\r\n", "", "avg/p99/max%", "PSRAM per block: CPU lines, DMA transfers, DMA kB");
+	const char *names[runs] = {"sample by sample", "lanes", "lanes PSRAM", "lanes PSRAM DMA"};
+	for (uint8_t k = 0; k < runs; k++)
+	{
+		printf("%-18s %.2f/%.2f/%.2f", names[k], load[k].avg, load[k].p99, load[k].max);
+		if (k >= 2)
+		{
+			const DelayMemory_F32::stats_t &st = reverb[k]->getMemStats();
+			const float32_t n = max(st.blocks, 1u);
+			printf("   %.1f, %.1f, %.2f (misses %u, DMA timeouts %u)", st.cpuLines / n, st.dmaTransfers / n, st.dmaBytes / n / 1024.0f, st.misses, st.dmaTimeouts);
+		}
+		printf("\r\n");
+	}
+	printf("speedup %.2fx, max difference %.2g (peak %.2g)\r\n", load[0].avg / max(load[1].avg, 1e-6f), diff, peak);
+	for (uint8_t k = 0; k < runs; k++) delete reverb[k];
+	return diff <= 1e-5f * max(peak, 1.0f) ? 0 : 1;
+}
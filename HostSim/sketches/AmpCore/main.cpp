@@ -0,0 +1,236 @@
+/**
+ * @file main.cpp
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Neural amp only graph for the host simulator, uses the
+ * 		AudioEffectRTNeural_F32 sources from the NeuralAmpModeler example
+ * 		and no external audio library.
+ * 		Signal chain:
+ * 		input ------>chain [amp, cab + tone stack] ------> output
+ * 		The amp runs as a stage of AudioChain_F32, in place on the
+ * 		chain buffers, more stages can be added to the chain.
+ * 		Model changes are prepared by a background task in loop().
+ * 		The cab stage is added if there are WAV impulse responses in
+ * 		the /ir directory of the SD card (host: runner option -f dir),
+ * 		they are loaded by a background task, from the spectrum cache
+ * 		files after the first time. The tone stack runs after the cab
+ * 		(both are linear), with the baked EQ mode it is folded into the
+ * 		IR when the knobs rest.
+ * 
+ * 		MIDI controls:
+ * 			note 40..48 - amp model, 49 - amp stage on/off (not run when off),
+ * 			50/51/52 - oversampling 1x/2x/4x
+ * 			note 53.. - user IR, sorted by the file name
+ * 			note 18..27 - tone stack model, 28 - baked EQ on/off
+ * 			CC 81/82/83 - bass/mid/treble, CC 84 - tone stack gain
+ * 			CC 85 - amp gain
+ * @version 0.1
+ * @date 2024-03-01
+ */
+#include <Arduino.h>
+#include "Audio.h"
+#include "OpenAudio_ArduinoLibrary.h"
+#include "RTNeural_F32.h"
+#include "AudioChain_F32.h"
+#include "AudioProfiler_F32.h"
+#include "AudioTasks_F32.h"
+#include "AudioFilterIRConvolver_F32.h"
+#include "IRLoader_F32.h"
+#include "AudioFilterToneStackAnalog_F32.h"
+#include "AudioFilterCabEQ_F32.h"
+#include <SD.h>
+
+#define USER_IR_MAX		(32)
+
+#ifndef DBG_SERIAL 
+	#define DBG_SERIAL Serial
+#endif
+
+AudioControlWM8731              codec;
+AudioInputI2S2_F32				i2s_in;
+AudioEffectRTNeural_F32			amp;		// not connected, runs inside the chain
+AudioFilterIRConvolver_F32		cab;		// not connected, runs inside cabEq
+AudioFilterToneStackAnalog_F32	toneStack;	// not connected, runs inside cabEq
+AudioFilterCabEQ_F32			cabEq(cab, toneStack);
+AudioChain_F32					chain;
+AudioOutputI2S2_F32     		i2s_out;
+
+AudioConnection_F32     cable0(i2s_in, 0, chain, 0);
+AudioConnection_F32     cable1(i2s_in, 1, chain, 1);
+AudioConnection_F32		cable2(chain, 0, i2s_out, 0); 
+AudioConnection_F32		cable3(chain, 1, i2s_out, 1);
+
+AudioProfiler_F32				profiler;	// has to be the last audio object
+AudioTaskScheduler_F32			tasks;		// background work run in loop()
+
+IRLoader_F32 irLoader(SD);
+IRPartitions_F32 irParts;
+IRLoader_F32::options_t irOpt;		// leading silence and tail below -60dB removed, see setup()
+char irNames[USER_IR_MAX][IR_LOADER_NAME_MAX];
+uint16_t irCount = 0;
+uint16_t irNo = 0;
+uint16_t irLoading = 0;
+void loadUserIR();
+void cb_IRLoaded(AudioTask_F32 &task, void *ctx);
+void cb_IRSwitched(AudioTask_F32 &task, void *ctx);
+
+// hands the loaded IR to cabEq, waits while the previous one is still switched in
+class IRHandOver : public AudioTask_F32
+{
+public:
+	state_t step() override {return cabEq.crossfade(irParts) ? TASK_DONE : TASK_WAIT;}
+} irHandOver;
+
+void cb_NoteOn(byte channel, byte note, byte velocity);
+void cb_ControlChange(byte channel, byte control, byte value);
+
+uint32_t timeNow, timeLast;
+
+void setup()
+{
+	DBG_SERIAL.begin(115200);
+	AudioMemory_F32(20);
+	if (!codec.enable()) DBG_SERIAL.println("Codec init error!");
+	usbMIDI.setHandleNoteOn(cb_NoteOn);
+	usbMIDI.setHandleControlChange(cb_ControlChange);
+	chain.add(amp);
+	amp.setTaskScheduler(tasks);
+	profiler.add(i2s_in, "in");
+	profiler.add(chain, "chain");
+	profiler.add(i2s_out, "out");
+	amp.changeModel(1);
+	irOpt.leadDb = -60.0f;
+	irOpt.tailDb = -60.0f;
+	if (SD.begin(BUILTIN_SDCARD) && (irCount = irLoader.scan("/ir", irNames, USER_IR_MAX)) > 0)
+	{
+		chain.add(cabEq);
+		toneStack.setModel(TONESTACK_MODEL_BASSMAN);
+		toneStack.setGain(2.0f);
+		cabEq.bake_set(true);
+		tasks.post(cabEq, AudioTaskScheduler_F32::PRIO_LOW);
+		loadUserIR();
+	}
+	for (uint8_t i = 1; i <= amp.getModelCount(); i++)
+	{
+		const NeuralAmpRegistry_F32::entry_t *m = amp.getModelInfo(i);
+		DBG_SERIAL.printf("Amp model %d: %s load=%2.2f%% %s\r\n", i, m->arch->getName(), m->arch->getLoad(),
+							amp.fitsBudget(i, 1) ? "" : "OVER BUDGET!");
+	}
+}
+
+void loop()
+{
+	usbMIDI.read();
+	tasks.run();
+	timeNow = millis();
+	if (timeNow - timeLast > 500)
+	{
+		float32_t load_amp = chain.stageUsageMax(0);
+		chain.stageUsageMaxReset();
+		float32_t load = AudioProcessorUsageMax();
+		AudioProcessorUsageMaxReset();
+		DBG_SERIAL.printf("CPU usage: amp=%2.2f%% (%dx) max = %2.2f%%  model %d\r\n",
+						 load_amp, amp.getOversample(), load, amp.getModel());
+		if (irCount) DBG_SERIAL.printf("Tone stack: %s, %s\r\n", toneStack.getName(), cabEq.isBaked() ? "baked into the IR" : "live");
+		profiler.print(DBG_SERIAL);
+		timeLast = timeNow;
+	}
+}
+
+// the IR is prepared in the background steps of the loader while the current one plays
+void loadUserIR()
+{
+	if (irLoader.isQueued() || irHandOver.isQueued()) return;	// the callbacks start the latest irNo
+	char path[IR_LOADER_NAME_MAX + 8];
+	irLoading = irNo;
+	snprintf(path, sizeof(path), "/ir/%s", irNames[irLoading]);
+	irLoader.start(path, irParts, irOpt);
+	tasks.post(irLoader, AudioTaskScheduler_F32::PRIO_LOW, cb_IRLoaded);
+}
+
+void cb_IRLoaded(AudioTask_F32 &task, void *ctx)
+{
+	(void)task;
+	(void)ctx;
+	// cabEq crossfades the convolver to the new IR, irParts is kept until it takes it
+	if (irLoader.isOk() && tasks.post(irHandOver, AudioTaskScheduler_F32::PRIO_LOW, cb_IRSwitched)) return;
+	DBG_SERIAL.printf("IR %s load error!\r\n", irNames[irLoading]);
+	irParts.free();
+	if (irNo != irLoading) loadUserIR();
+}
+
+void cb_IRSwitched(AudioTask_F32 &task, void *ctx)
+{
+	(void)task;
+	(void)ctx;
+	DBG_SERIAL.printf("IR %d: %s %2.1fms (trimmed from %2.1fms) %s, %2.1fms in %d steps\r\n", irLoading, irNames[irLoading],
+					  irLoader.getLengthOut() * 1000.0f / AUDIO_SAMPLE_RATE_EXACT,
+					  irLoader.getLengthIn() * 1000.0f / AUDIO_SAMPLE_RATE_EXACT,
+					  irLoader.getSource() == IRLoader_F32::SRC_CACHE ? "from cache" : "from WAV", irLoader.getLoadTime(),
+					  (int)irLoader.getSteps());
+	if (irNo != irLoading) loadUserIR();
+}
+
+void cb_NoteOn(byte channel, byte note, byte velocity)
+{
+	(void)channel;
+	(void)velocity;
+	switch(note)
+	{
+		case 40 ... 48:
+			amp.changeModel(note-40);
+			break;
+		case 49:
+			chain.stageEnable(0, !chain.stageEnabled(0));
+			break;
+		case 50:
+			amp.oversample(1);
+			break;
+		case 51:
+			amp.oversample(2);
+			break;
+		case 52:
+			amp.oversample(4);
+			break;
+		case 18 ... 27:
+			toneStack.setModel((tonestack_model_t)((note - 18) % TONESTACK_MODEL_COUNT));
+			break;
+		case 28:
+			cabEq.bake_set(!cabEq.bake_get());
+			break;
+		case 53 ... 53 + USER_IR_MAX - 1:
+			if (note - 53 < irCount)
+			{
+				irNo = note - 53;
+				loadUserIR();
+			}
+			break;
+		default:
+			break;
+	}
+}
+
+void cb_ControlChange(byte channel, byte control, byte value)
+{
+	(void)channel;
+	float32_t tmp = (float32_t) value / 127.0f;
+	switch(control)
+	{
+		case 81:
+			toneStack.setBass(tmp);
+			break;
+		case 82:
+			toneStack.setMid(tmp);
+			break;
+		case 83:
+			toneStack.setTreble(tmp);
+			break;
+		case 84:
+			toneStack.setGain(tmp * 4.0f);
+			break;
+		case 85:
+			amp.gain(tmp);
+			break;
+		default:
+			break;
+	}
+}
@@ -0,0 +1,118 @@
+/**
+ * @file Arduino.cpp
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Host (Linux) stand-in for the Teensy4 Arduino core
+ * @version 0.1
+ * @date 2024-03-01
+ */
+#include <Arduino.h>
+#include <chrono>
+#include "HostSim.h"
+
+HostSerial Serial;
+HostMIDI usbMIDI;
+volatile uint32_t SCB_AIRCR = 0;
+uint8_t external_psram_size = 8;
+
+static uint8_t pinState[64];
+
+uint32_t hostsim_cycles()
+{
+	using namespace std::chrono;
+	return (uint32_t)duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+uint32_t millis()
+{
+	return (uint32_t)(HostSim::sampleTime() * 1000ull / (uint64_t)AUDIO_SAMPLE_RATE_EXACT);
+}
+
+uint32_t micros()
+{
+	return (uint32_t)(HostSim::sampleTime() * 1000000ull / (uint64_t)AUDIO_SAMPLE_RATE_EXACT);
+}
+
+void pinMode(uint8_t, uint8_t) {}
+
+void digitalWrite(uint8_t pin, uint8_t val)
+{
+	if (pin < sizeof(pinState)) pinState[pin] = val ? HIGH : LOW;
+}
+
+uint8_t digitalRead(uint8_t pin)
+{
+	return pin < sizeof(pinState) ? pinState[pin] : LOW;
+}
+
+size_t Print::write(const uint8_t *buf, size_t len)
+{
+	size_t n = 0;
+	while (len--) n += write(*buf++);
+	return n;
+}
+
+size_t Print::printf(const char *format, ...)
+{
+	char buf[256];
+	va_list args;
+	va_start(args, format);
+	int len = vsnprintf(buf, sizeof(buf), format, args);
+	va_end(args);
+	if (len < 0) return 0;
+	return write((const uint8_t *)buf, (size_t)len < sizeof(buf) ? (size_t)len : sizeof(buf) - 1);
+}
+
+size_t HostSerial::write(uint8_t c)
+{
+	if (enabled) fputc(c, stdout);
+	return 1;
+}
+
+size_t HostSerial::write(const uint8_t *buf, size_t len)
+{
+	if (enabled) fwrite(buf, 1, len, stdout);
+	return len;
+}
+
+bool HostMIDI::queue(uint8_t type, uint8_t channel, uint8_t data1, uint8_t data2)
+{
+	uint32_t next = (head + 1) % queueSize;
+	if (next == tail) return false;
+	events[head].type = type;
+	events[head].channel = channel;
+	events[head].data1 = data1;
+	events[head].data2 = data2;
+	head = next;
+	return true;
+}
+
+bool HostMIDI::read(uint8_t channel)
+{
+	if (head == tail) return false;
+	uint8_t type = events[tail].type;
+	uint8_t ch = events[tail].channel;
+	uint8_t d1 = events[tail].data1;
+	uint8_t d2 = events[tail].data2;
+	tail = (tail + 1) % queueSize;
+	if (channel && ch != channel && type != Clock) return true;
+	switch (type)
+	{
+		case NoteOn:
+			if (noteOn) noteOn(ch, d1, d2);
+			break;
+		case NoteOff:
+			if (noteOff) noteOff(ch, d1, d2);
+			break;
+		case ControlChange:
+			if (controlChange) controlChange(ch, d1, d2);
+			break;
+		case ProgramChange:
+			if (programChange) programChange(ch, d1);
+			break;
+		case Clock:
+			if (clock) clock();
+			break;
+		default: break;
+	}
+	return true;
+}
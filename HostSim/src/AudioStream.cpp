@@ -0,0 +1,245 @@
+/**
+ * @file AudioStream.cpp
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Host (Linux) stand-in for the Teensy AudioStream and the
+ * 		OpenAudio AudioStream_F32 classes
+ * @version 0.1
+ * @date 2024-03-01
+ */
+#include "AudioStream.h"
+#include "AudioStream_F32.h"
+
+#define F32_POOL_MAX_BLOCKS		(256)
+
+AudioStream *AudioStream::first_update = NULL;
+AudioStream *AudioStream::current_update = NULL;
+uint32_t AudioStream::cpu_cycles_total = 0;
+uint32_t AudioStream::cpu_cycles_total_max = 0;
+AudioStream::host_stats_t AudioStream::host_stats_total = {0, 0, 0, 0, 0};
+
+AudioStream::AudioStream(unsigned char ninput)
+	: active(false), num_inputs(ninput), cpu_cycles(0), cpu_cycles_max(0),
+	  next_update(NULL), host_stats({0, 0, 0, 0, 0})
+{
+	// update order = construction order
+	if (first_update == NULL)
+	{
+		first_update = this;
+	}
+	else
+	{
+		AudioStream *p = first_update;
+		while (p->next_update) p = p->next_update;
+		p->next_update = this;
+	}
+}
+
+AudioStream::~AudioStream()
+{
+	// the Teensy objects live forever, the renderer creates and deletes them
+	AudioStream **p = &first_update;
+	while (*p && *p != this) p = &(*p)->next_update;
+	if (*p) *p = next_update;
+}
+
+void AudioStream::update_all(void)
+{
+	uint32_t totalcycles = ARM_DWT_CYCCNT;
+	for (AudioStream *p = first_update; p; p = p->next_update)
+	{
+		if (!p->active) continue;
+		current_update = p;
+		// blocks held when the update starts, allocations raise the peak
+		if (AudioStream_F32::f32_memory_used > p->host_stats.pool_peak)
+			p->host_stats.pool_peak = AudioStream_F32::f32_memory_used;
+		uint32_t cycles = ARM_DWT_CYCCNT;
+		p->update();
+		cycles = ARM_DWT_CYCCNT - cycles;
+		current_update = NULL;
+		p->cpu_cycles = cycles;
+		if (cycles > p->cpu_cycles_max) p->cpu_cycles_max = cycles;
+		p->host_stats.cycles_sum += cycles;
+		p->host_stats.updates++;
+		if (cycles > p->host_stats.cycles_peak) p->host_stats.cycles_peak = cycles;
+	}
+	totalcycles = ARM_DWT_CYCCNT - totalcycles;
+	cpu_cycles_total = totalcycles;
+	if (totalcycles > cpu_cycles_total_max) cpu_cycles_total_max = totalcycles;
+	host_stats_total.cycles_sum += totalcycles;
+	host_stats_total.updates++;
+	if (totalcycles > host_stats_total.cycles_peak) host_stats_total.cycles_peak = totalcycles;
+}
+
+void AudioStream::hostPoolEvent(uint32_t used, bool failed)
+{
+	// allocations outside the audio cycle (setup, loop) go to the total only
+	// atomic, the renderer allocates from several threads
+	host_stats_t &st = current_update ? current_update->host_stats : host_stats_total;
+	uint32_t peak = __atomic_load_n(&st.pool_peak, __ATOMIC_RELAXED);
+	while (used > peak && !__atomic_compare_exchange_n(&st.pool_peak, &peak, used, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+	peak = __atomic_load_n(&host_stats_total.pool_peak, __ATOMIC_RELAXED);
+	while (used > peak && !__atomic_compare_exchange_n(&host_stats_total.pool_peak, &peak, used, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+	if (failed)
+	{
+		__atomic_add_fetch(&st.alloc_failures, 1, __ATOMIC_RELAXED);
+		if (current_update) __atomic_add_fetch(&host_stats_total.alloc_failures, 1, __ATOMIC_RELAXED);
+	}
+}
+
+// ---------------------------------------------------------------- F32 blocks
+uint8_t AudioStream_F32::f32_memory_used = 0;
+uint8_t AudioStream_F32::f32_memory_used_max = 0;
+audio_block_f32_t *AudioStream_F32::memory_pool_f32 = NULL;
+uint32_t AudioStream_F32::memory_pool_size_f32 = 0;
+uint32_t AudioStream_F32::memory_pool_available_mask_f32[F32_POOL_MAX_BLOCKS / 32];
+uint32_t AudioStream_F32::pool_requested_f32 = 0;
+bool AudioStream_F32::pool_calibrate_f32 = false;
+
+AudioStream_F32::AudioStream_F32(unsigned char n_input_f32, audio_block_f32_t **iqueue)
+	: AudioStream(n_input_f32), destination_list_f32(NULL), inputQueue_f32(iqueue),
+	  num_inputs_f32(n_input_f32)
+{
+	for (int i = 0; i < n_input_f32; i++) inputQueue_f32[i] = NULL;
+}
+
+void AudioStream_F32::initialize_f32_memory(audio_block_f32_t *data, unsigned int num)
+{
+	pool_requested_f32 = num;
+	if (pool_calibrate_f32)
+	{
+		// the largest pool, the report shows the number of blocks really needed
+		static audio_block_f32_t calibration_pool[F32_POOL_MAX_BLOCKS];
+		data = calibration_pool;
+		num = F32_POOL_MAX_BLOCKS;
+	}
+	if (num > F32_POOL_MAX_BLOCKS) num = F32_POOL_MAX_BLOCKS;
+	memory_pool_f32 = data;
+	memory_pool_size_f32 = num;
+	memset(memory_pool_available_mask_f32, 0, sizeof(memory_pool_available_mask_f32));
+	for (unsigned int i = 0; i < num; i++)
+	{
+		memory_pool_available_mask_f32[i >> 5] |= (1u << (i & 31));
+		data[i].memory_pool_index = i;
+	}
+	f32_memory_used = 0;
+	f32_memory_used_max = 0;
+}
+
+// Lock-free: the free mask words are claimed with compare and swap, the
+// counters and reference counts are atomic, no interrupt or lock is
+// needed when blocks are allocated and released from several contexts.
+audio_block_f32_t *AudioStream_F32::allocate_f32(void)
+{
+	for (uint32_t w = 0; w < (memory_pool_size_f32 + 31) / 32; w++)
+	{
+		uint32_t avail = __atomic_load_n(&memory_pool_available_mask_f32[w], __ATOMIC_RELAXED);
+		while (avail)
+		{
+			uint32_t bit = __builtin_ctz(avail);
+			if (!__atomic_compare_exchange_n(&memory_pool_available_mask_f32[w], &avail, avail & ~(1u << bit),
+											 true, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+				continue;	// avail reloaded, try again
+			audio_block_f32_t *block = memory_pool_f32 + (w << 5) + bit;
+			block->ref_count = 1;
+			block->length = AUDIO_BLOCK_SAMPLES;
+			uint8_t used = __atomic_add_fetch(&f32_memory_used, 1, __ATOMIC_RELAXED);
+			uint8_t max = __atomic_load_n(&f32_memory_used_max, __ATOMIC_RELAXED);
+			while (used > max && !__atomic_compare_exchange_n(&f32_memory_used_max, &max, used,
+															  true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+			hostPoolEvent(used, false);
+			return block;
+		}
+	}
+	hostPoolEvent(f32_memory_used, true);
+	return NULL;
+}
+
+void AudioStream_F32::release(audio_block_f32_t *block)
+{
+	if (block == NULL) return;
+	if (__atomic_sub_fetch(&block->ref_count, 1, __ATOMIC_ACQ_REL) > 0) return;
+	uint32_t idx = block->memory_pool_index;
+	__atomic_fetch_or(&memory_pool_available_mask_f32[idx >> 5], 1u << (idx & 31), __ATOMIC_RELEASE);
+	__atomic_sub_fetch(&f32_memory_used, 1, __ATOMIC_RELAXED);
+}
+
+void AudioStream_F32::transmit(audio_block_f32_t *block, unsigned char index)
+{
+	if (block == NULL) return;
+	for (AudioConnection_F32 *c = destination_list_f32; c != NULL; c = c->next_dest)
+	{
+		if (c->src_index != index || !c->isConnected) continue;
+		if (c->dst.inputQueue_f32[c->dest_index] == NULL)
+		{
+			c->dst.inputQueue_f32[c->dest_index] = block;
+			__atomic_add_fetch(&block->ref_count, 1, __ATOMIC_RELAXED);
+		}
+	}
+}
+
+audio_block_f32_t *AudioStream_F32::receiveReadOnly_f32(unsigned int index)
+{
+	if (index >= num_inputs_f32) return NULL;
+	audio_block_f32_t *in = inputQueue_f32[index];
+	inputQueue_f32[index] = NULL;
+	return in;
+}
+
+audio_block_f32_t *AudioStream_F32::receiveWritable_f32(unsigned int index)
+{
+	if (index >= num_inputs_f32) return NULL;
+	audio_block_f32_t *in = inputQueue_f32[index];
+	inputQueue_f32[index] = NULL;
+	if (in && in->ref_count > 1)
+	{
+		// shared block, the writer gets its own copy
+		audio_block_f32_t *p = allocate_f32();
+		if (p)
+		{
+			memcpy(p->data, in->data, sizeof(p->data));
+			p->length = in->length;
+			p->fs_Hz = in->fs_Hz;
+			p->id = in->id;
+		}
+		release(in);
+		in = p;
+	}
+	return in;
+}
+
+// ---------------------------------------------------------------- connections
+AudioConnection_F32::AudioConnection_F32(AudioStream_F32 &source, unsigned char sourceOutput,
+										 AudioStream_F32 &destination, unsigned char destinationInput)
+	: src(source), dst(destination), src_index(sourceOutput), dest_index(destinationInput),
+	  next_dest(NULL), isConnected(false)
+{
+	connect();
+}
+
+int AudioConnection_F32::connect(void)
+{
+	if (isConnected) return 0;
+	if (dest_index >= dst.num_inputs_f32) return 2;
+	AudioConnection_F32 **p = &src.destination_list_f32;
+	while (*p) p = &(*p)->next_dest;
+	*p = this;
+	next_dest = NULL;
+	src.active = true;
+	dst.active = true;
+	isConnected = true;
+	return 0;
+}
+
+int AudioConnection_F32::disconnect(void)
+{
+	if (!isConnected) return 1;
+	AudioConnection_F32 **p = &src.destination_list_f32;
+	while (*p && *p != this) p = &(*p)->next_dest;
+	if (*p) *p = next_dest;
+	// drop a block waiting in the input queue
+	AudioStream_F32::release(dst.inputQueue_f32[dest_index]);
+	dst.inputQueue_f32[dest_index] = NULL;
+	isConnected = false;
+	next_dest = NULL;
+	return 0;
+}
@@ -0,0 +1,183 @@
+/**
+ * @file FS.cpp
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Host (Linux) stand-in for the Teensy file system API and the SD library
+ * @version 0.1
+ * @date 2024-03-15
+ */
+#include "FS.h"
+#include "SD.h"
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+SDClass SD;
+
+struct HostFileImpl
+{
+	FILE *file = NULL;
+	DIR *dir = NULL;
+	std::string path;		// host path
+	std::string name;		// name without the directory
+	~HostFileImpl()
+	{
+		if (file) fclose(file);
+		if (dir) closedir(dir);
+	}
+};
+
+static std::shared_ptr<HostFileImpl> openPath(const std::string &path, uint8_t mode)
+{
+	std::shared_ptr<HostFileImpl> impl = std::make_shared<HostFileImpl>();
+	impl->path = path;
+	size_t slash = path.find_last_of('/');
+	impl->name = slash == std::string::npos ? path : path.substr(slash + 1);
+	struct stat st;
+	if (stat(path.c_str(), &st) == 0 && S_ISDIR(st.st_mode))
+	{
+		if (mode != FILE_READ || !(impl->dir = opendir(path.c_str()))) return NULL;
+		return impl;
+	}
+	switch (mode)
+	{
+		case FILE_READ:
+			impl->file = fopen(path.c_str(), "rb");
+			break;
+		case FILE_WRITE:
+			impl->file = fopen(path.c_str(), "ab+");
+			break;
+		default:
+			impl->file = fopen(path.c_str(), "rb+");
+			if (!impl->file) impl->file = fopen(path.c_str(), "wb+");
+			break;
+	}
+	return impl->file ? impl : NULL;
+}
+
+size_t File::read(void *buf, size_t nbyte)
+{
+	return f && f->file ? fread(buf, 1, nbyte, f->file) : 0;
+}
+
+int File::read()
+{
+	uint8_t c;
+	return read(&c, 1) == 1 ? c : -1;
+}
+
+int File::peek()
+{
+	if (!f || !f->file) return -1;
+	int c = fgetc(f->file);
+	if (c != EOF) ungetc(c, f->file);
+	return c == EOF ? -1 : c;
+}
+
+int File::available()
+{
+	if (!f || !f->file) return 0;
+	return (int)min(size() - position(), (uint64_t)INT32_MAX);
+}
+
+size_t File::write(const uint8_t *buf, size_t len)
+{
+	return f && f->file ? fwrite(buf, 1, len, f->file) : 0;
+}
+
+void File::flush()
+{
+	if (f && f->file) fflush(f->file);
+}
+
+bool File::seek(uint64_t pos, int mode)
+{
+	return f && f->file && fseeko(f->file, (off_t)pos, mode == SeekEnd ? SEEK_END : mode == SeekCur ? SEEK_CUR : SEEK_SET) == 0;
+}
+
+uint64_t File::position()
+{
+	return f && f->file ? (uint64_t)ftello(f->file) : 0;
+}
+
+uint64_t File::size()
+{
+	if (!f || !f->file) return 0;
+	fflush(f->file);
+	struct stat st;
+	return fstat(fileno(f->file), &st) == 0 ? (uint64_t)st.st_size : 0;
+}
+
+void File::close()
+{
+	f.reset();
+}
+
+const char *File::name()
+{
+	return f ? f->name.c_str() : "";
+}
+
+bool File::isDirectory()
+{
+	return f && f->dir;
+}
+
+File File::openNextFile(uint8_t mode)
+{
+	if (!f || !f->dir) return File();
+	struct dirent *e;
+	while ((e = readdir(f->dir)) != NULL)
+	{
+		if (!strcmp(e->d_name, ".") || !strcmp(e->d_name, "..")) continue;
+		return File(openPath(f->path + "/" + e->d_name, mode));
+	}
+	return File();
+}
+
+void File::rewindDirectory()
+{
+	if (f && f->dir) rewinddir(f->dir);
+}
+
+std::string FS::hostPath(const char *path)
+{
+	return root + (path[0] == '/' ? "" : "/") + path;
+}
+
+File FS::open(const char *filename, uint8_t mode)
+{
+	return File(openPath(hostPath(filename), mode));
+}
+
+bool FS::exists(const char *filepath)
+{
+	struct stat st;
+	return stat(hostPath(filepath).c_str(), &st) == 0;
+}
+
+bool FS::mkdir(const char *filepath)
+{
+	return ::mkdir(hostPath(filepath).c_str(), 0777) == 0;
+}
+
+bool FS::rename(const char *oldfilepath, const char *newfilepath)
+{
+	return ::rename(hostPath(oldfilepath).c_str(), hostPath(newfilepath).c_str()) == 0;
+}
+
+bool FS::remove(const char *filepath)
+{
+	return ::unlink(hostPath(filepath).c_str()) == 0;
+}
+
+bool FS::rmdir(const char *filepath)
+{
+	return ::rmdir(hostPath(filepath).c_str()) == 0;
+}
+
+bool SDClass::begin(uint8_t csPin)
+{
+	(void)csPin;
+	struct stat st;
+	return stat(root.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+}
@@ -0,0 +1,292 @@
+/**
+ * @file HostRT.cpp
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Real time helpers for the live host runner (Linux)
+ * @version 0.1
+ * @date 2024-03-12
+ */
+#include "HostRT.h"
+#include <dlfcn.h>
+#include <execinfo.h>
+#include <malloc.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <errno.h>
+#include <cxxabi.h>
+#include <string>
+
+#define HOSTRT_STACK_SIZE		(512 * 1024)
+#define HOSTRT_STACK_PREFAULT	(64 * 1024)
+#define HOSTRT_SITE_FRAMES		(6)
+
+typedef struct
+{
+	uint8_t kind;
+	uint8_t frames;
+	uint32_t hits;
+	void *stack[HOSTRT_SITE_FRAMES];
+} trap_site_t;
+
+static thread_local bool trapArmedFlag = false;
+static bool trapAbortMode = false;
+static uint32_t trapCounts[HostRT::TRAP_KINDS];
+static trap_site_t trapSites[HOSTRT_TRAP_SITES];
+static uint32_t trapSiteCount = 0;
+static const char *trapKindName[HostRT::TRAP_KINDS] = {"alloc", "free", "lock"};
+
+static void trapHit(HostRT::trap_kind_t kind)
+{
+	trapArmedFlag = false;		// backtrace() and the bookkeeping must not trap again
+	__atomic_add_fetch(&trapCounts[kind], 1, __ATOMIC_RELAXED);
+	if (trapAbortMode)
+	{
+		static const char msg[][64] = {"HostRT: allocation on the audio thread!\n",
+									   "HostRT: free on the audio thread!\n",
+									   "HostRT: lock on the audio thread!\n"};
+		ssize_t r = write(STDERR_FILENO, msg[kind], strlen(msg[kind]));
+		(void)r;
+		abort();
+	}
+	void *stack[HOSTRT_SITE_FRAMES + 2];
+	// skip trapHit() and the replaced function
+	int n = backtrace(stack, HOSTRT_SITE_FRAMES + 2) - 2;
+	if (n > 0)
+	{
+		const uint32_t count = std::min<uint32_t>(__atomic_load_n(&trapSiteCount, __ATOMIC_ACQUIRE), HOSTRT_TRAP_SITES);
+		uint32_t i;
+		for (i = 0; i < count; i++)
+		{
+			trap_site_t &s = trapSites[i];
+			if (s.kind == kind && s.frames == n && !memcmp(s.stack, stack + 2, n * sizeof(void *)))
+			{
+				__atomic_add_fetch(&s.hits, 1, __ATOMIC_RELAXED);
+				break;
+			}
+		}
+		if (i == count)
+		{
+			const uint32_t slot = __atomic_fetch_add(&trapSiteCount, 1, __ATOMIC_ACQ_REL);
+			if (slot < HOSTRT_TRAP_SITES)
+			{
+				trap_site_t &s = trapSites[slot];
+				s.kind = kind;
+				s.frames = n;
+				memcpy(s.stack, stack + 2, n * sizeof(void *));
+				__atomic_store_n(&s.hits, 1, __ATOMIC_RELEASE);
+			}
+		}
+	}
+	trapArmedFlag = true;
+}
+
+#define TRAP(kind) do { if (__builtin_expect(trapArmedFlag, 0)) trapHit(kind); } while (0)
+
+// ---------------------------------------------------------------- replaced C library functions
+extern "C"
+{
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t n, size_t size);
+void *__libc_realloc(void *ptr, size_t size);
+void *__libc_memalign(size_t alignment, size_t size);
+void __libc_free(void *ptr);
+
+void *malloc(size_t size)
+{
+	TRAP(HostRT::TRAP_ALLOC);
+	return __libc_malloc(size);
+}
+
+void *calloc(size_t n, size_t size)
+{
+	TRAP(HostRT::TRAP_ALLOC);
+	return __libc_calloc(n, size);
+}
+
+void *realloc(void *ptr, size_t size)
+{
+	TRAP(HostRT::TRAP_ALLOC);
+	return __libc_realloc(ptr, size);
+}
+
+void *memalign(size_t alignment, size_t size)
+{
+	TRAP(HostRT::TRAP_ALLOC);
+	return __libc_memalign(alignment, size);
+}
+
+void *aligned_alloc(size_t alignment, size_t size)
+{
+	TRAP(HostRT::TRAP_ALLOC);
+	return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void **ptr, size_t alignment, size_t size)
+{
+	TRAP(HostRT::TRAP_ALLOC);
+	if (alignment % sizeof(void *) || (alignment & (alignment - 1))) return EINVAL;
+	void *p = __libc_memalign(alignment, size);
+	if (!p) return ENOMEM;
+	*ptr = p;
+	return 0;
+}
+
+void free(void *ptr)
+{
+	if (ptr) TRAP(HostRT::TRAP_FREE);
+	__libc_free(ptr);
+}
+
+// the real lock functions are looked up on the first call
+static void *realFunction(void **fn, const char *name)
+{
+	void *p = __atomic_load_n(fn, __ATOMIC_ACQUIRE);
+	if (!p)
+	{
+		p = dlsym(RTLD_NEXT, name);
+		__atomic_store_n(fn, p, __ATOMIC_RELEASE);
+	}
+	return p;
+}
+
+int pthread_mutex_lock(pthread_mutex_t *mutex) noexcept
+{
+	static void *fn = NULL;
+	TRAP(HostRT::TRAP_LOCK);
+	return ((int (*)(pthread_mutex_t *))realFunction(&fn, "pthread_mutex_lock"))(mutex);
+}
+
+int pthread_rwlock_rdlock(pthread_rwlock_t *lock) noexcept
+{
+	static void *fn = NULL;
+	TRAP(HostRT::TRAP_LOCK);
+	return ((int (*)(pthread_rwlock_t *))realFunction(&fn, "pthread_rwlock_rdlock"))(lock);
+}
+
+int pthread_rwlock_wrlock(pthread_rwlock_t *lock) noexcept
+{
+	static void *fn = NULL;
+	TRAP(HostRT::TRAP_LOCK);
+	return ((int (*)(pthread_rwlock_t *))realFunction(&fn, "pthread_rwlock_wrlock"))(lock);
+}
+} // extern "C"
+
+// ---------------------------------------------------------------- memory and threads
+bool HostRT::lockMemory()
+{
+	// freed memory stays in the process, no mmap()ed chunks which would be unmapped
+	mallopt(M_TRIM_THRESHOLD, -1);
+	mallopt(M_MMAP_MAX, 0);
+	bool ok = mlockall(MCL_CURRENT | MCL_FUTURE) == 0;
+	prefaultStack();
+	// backtrace() loads libgcc_s on the first call, not in the trap
+	void *frames[2];
+	backtrace(frames, 2);
+	return ok;
+}
+
+__attribute__((noinline)) void HostRT::prefaultStack()
+{
+	volatile uint8_t buf[HOSTRT_STACK_PREFAULT];
+	memset((void *)buf, 0, sizeof(buf));
+}
+
+typedef struct
+{
+	void *(*func)(void *);
+	void *arg;
+} thread_start_t;
+
+static void *threadEntry(void *p)
+{
+	thread_start_t start = *(thread_start_t *)p;
+	delete (thread_start_t *)p;
+	HostRT::prefaultStack();
+	return start.func(start.arg);
+}
+
+bool HostRT::startThread(pthread_t &thread, void *(*func)(void *), void *arg, int priority)
+{
+	thread_start_t *start = new thread_start_t{func, arg};
+	pthread_attr_t attr;
+	pthread_attr_init(&attr);
+	pthread_attr_setstacksize(&attr, HOSTRT_STACK_SIZE);
+	int err = EPERM;
+	if (priority > 0)
+	{
+		sched_param param;
+		param.sched_priority = std::min(priority, sched_get_priority_max(SCHED_FIFO));
+		pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+		pthread_attr_setschedpolicy(&attr, SCHED_FIFO);
+		pthread_attr_setschedparam(&attr, &param);
+		err = pthread_create(&thread, &attr, threadEntry, start);
+	}
+	if (err == EPERM)
+	{
+		// no real time privileges (RLIMIT_RTPRIO, CAP_SYS_NICE): normal thread
+		pthread_attr_setinheritsched(&attr, PTHREAD_INHERIT_SCHED);
+		err = pthread_create(&thread, &attr, threadEntry, start);
+	}
+	pthread_attr_destroy(&attr);
+	if (err) delete start;
+	return err == 0;
+}
+
+const char *HostRT::schedName(char *buf, size_t len)
+{
+	int policy;
+	sched_param param;
+	pthread_getschedparam(pthread_self(), &policy, &param);
+	if (policy == SCHED_FIFO || policy == SCHED_RR)
+		snprintf(buf, len, "%s %d", policy == SCHED_FIFO ? "SCHED_FIFO" : "SCHED_RR", param.sched_priority);
+	else
+		snprintf(buf, len, "SCHED_OTHER (no real time priority)");
+	return buf;
+}
+
+// ---------------------------------------------------------------- trap control
+void HostRT::trapArm(bool state) { trapArmedFlag = state; }
+bool HostRT::trapArmed() { return trapArmedFlag; }
+void HostRT::trapAbort(bool state) { trapAbortMode = state; }
+uint32_t HostRT::trapCount(trap_kind_t kind) { return __atomic_load_n(&trapCounts[kind], __ATOMIC_RELAXED); }
+
+uint32_t HostRT::trapTotal()
+{
+	uint32_t n = 0;
+	for (int k = 0; k < TRAP_KINDS; k++) n += trapCount((trap_kind_t)k);
+	return n;
+}
+
+void HostRT::trapReset()
+{
+	for (int k = 0; k < TRAP_KINDS; k++) __atomic_store_n(&trapCounts[k], 0, __ATOMIC_RELAXED);
+	__atomic_store_n(&trapSiteCount, 0, __ATOMIC_RELEASE);
+}
+
+void HostRT::trapReport(FILE *out)
+{
+	fprintf(out, "Allocation trap: %u allocations, %u frees, %u locks on the audio thread\r\n",
+			trapCount(TRAP_ALLOC), trapCount(TRAP_FREE), trapCount(TRAP_LOCK));
+	const uint32_t count = std::min<uint32_t>(trapSiteCount, HOSTRT_TRAP_SITES);
+	for (uint32_t i = 0; i < count; i++)
+	{
+		const trap_site_t &s = trapSites[i];
+		fprintf(out, "  %-5s x%-6u", trapKindName[s.kind], s.hits);
+		for (uint8_t f = 0; f < s.frames; f++)
+		{
+			Dl_info info;
+			if (dladdr(s.stack[f], &info) && info.dli_sname)
+			{
+				int status;
+				char *name = abi::__cxa_demangle(info.dli_sname, NULL, NULL, &status);
+				std::string sym = status == 0 ? name : info.dli_sname;
+				free(name);
+				if (sym.size() > 60) sym = sym.substr(0, 57) + "...";
+				fprintf(out, " %s %s", f ? "<-" : "", sym.c_str());
+			}
+			else
+				fprintf(out, " %s %p", f ? "<-" : "", s.stack[f]);
+		}
+		fprintf(out, "\r\n");
+	}
+}
@@ -0,0 +1,410 @@
+/**
+ * @file HostRT_main.cpp
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Live (real time) runner of the sketches: the audio graph is
+ * 		updated from a real time thread at the audio block rate, loop()
+ * 		runs on the main thread like on the Teensy.
+ * 		Backends:
+ * 			timer - clock driven thread, the input signal is looped and the
+ * 					output recorded or dropped, needs no sound card
+ * 			jack  - JACK client (built when the JACK headers are found),
+ * 					the graph runs in the JACK process callback. With the
+ * 					jackd dummy driver it needs no sound card either.
+ * 		The memory is locked, the block pool and the models are set up and
+ * 		the pending parameter changes applied before the audio starts.
+ * 		The allocation trap is armed in the audio callback, the report
+ * 		lists the xruns, the callback time and the trapped calls.
+ * @version 0.1
+ * @date 2024-03-12
+ */
+#include <Arduino.h>
+#include <getopt.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <algorithm>
+#include "HostSim.h"
+#include <SD.h>
+#include "HostRT.h"
+#include "wav_file.h"
+#ifdef HOSTSIM_JACK
+#include <jack/jack.h>
+#endif
+
+// blocks processed before the audio starts, applies the setup() parameter changes
+#define HOSTRT_WARMUP_BLOCKS	(8)
+
+void setup();
+void loop();
+
+typedef struct
+{
+	uint32_t time_ms;
+	uint8_t type;
+	uint8_t data1;
+	uint8_t data2;
+} midi_event_t;
+
+typedef struct
+{
+	std::atomic<uint64_t> blocks;
+	std::atomic<uint64_t> xruns;
+	std::atomic<uint32_t> callbackMax;	// ns
+	std::atomic<uint32_t> lateMax;		// wake up latency, ns
+} rt_stats_t;
+
+static volatile sig_atomic_t stopRequest = 0;
+static rt_stats_t stats;
+static uint32_t callbackWork = 0;		// synthetic load in the callback, ns
+static std::atomic<bool> loadRunning(false);
+static char audioSched[48] = "not started";
+static std::vector<float32_t> recL, recR;
+static std::atomic<size_t> recPos(0);
+
+static const double blockNs = AUDIO_BLOCK_SAMPLES * 1e9 / AUDIO_SAMPLE_RATE_EXACT;
+
+static void usage(const char *name)
+{
+	fprintf(stderr,
+		"usage: %s [options]\n"
+		"  -b backend      timer (default) or jack\n"
+		"  -d seconds      run time, default: until Ctrl+C\n"
+		"  -i file.wav     input looped by the timer backend (default: generated sine)\n"
+		"  -g type[:sec]   generate the input: sine, noise, impulse (default sine:2)\n"
+		"  -o file.wav     record the output, needs -d\n"
+		"  -n note@sec     send a MIDI note on at the given time\n"
+		"  -c cc=val@sec   send a MIDI control change at the given time\n"
+		"  -f dir          directory used as the SD card (default: the current one)\n"
+		"  -s              print the serial output of the sketch\n"
+		"  -p priority     SCHED_FIFO priority of the audio thread (default 80, 0 = normal)\n"
+		"  -L threads      synthetic CPU load: busy threads with normal priority\n"
+		"  -w percent      synthetic CPU load: extra work in the audio callback,\n"
+		"                  %% of the block period\n"
+		"  -T              abort at the first allocation or lock on the audio thread\n"
+		"  -S name         JACK server name\n", name);
+}
+
+static void onSignal(int) { stopRequest = 1; }
+
+static void maxUpdate(std::atomic<uint32_t> &max, uint32_t value)
+{
+	uint32_t m = max.load(std::memory_order_relaxed);
+	while (value > m && !max.compare_exchange_weak(m, value, std::memory_order_relaxed));
+}
+
+// one audio block through the graph, called from the audio thread
+static void runBlock(const float32_t *inL, const float32_t *inR, float32_t *outL, float32_t *outR)
+{
+	HostRT::trapArm(true);
+	const uint32_t t0 = ARM_DWT_CYCCNT;
+	memset(outL, 0, AUDIO_BLOCK_SAMPLES * sizeof(float32_t));
+	memset(outR, 0, AUDIO_BLOCK_SAMPLES * sizeof(float32_t));
+	HostSim::setLiveBuffers(inL, inR, outL, outR);
+	HostSim::processBlock();
+	while (ARM_DWT_CYCCNT - t0 < callbackWork);
+	const uint32_t t = ARM_DWT_CYCCNT - t0;
+	HostRT::trapArm(false);
+	maxUpdate(stats.callbackMax, t);
+	stats.blocks++;
+	const size_t pos = recPos.load(std::memory_order_relaxed);
+	if (pos + AUDIO_BLOCK_SAMPLES <= recL.size())
+	{
+		memcpy(&recL[pos], outL, AUDIO_BLOCK_SAMPLES * sizeof(float32_t));
+		memcpy(&recR[pos], outR, AUDIO_BLOCK_SAMPLES * sizeof(float32_t));
+		recPos.store(pos + AUDIO_BLOCK_SAMPLES, std::memory_order_relaxed);
+	}
+}
+
+// ---------------------------------------------------------------- timer backend
+static uint64_t clockNs()
+{
+	timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static void *timerThread(void *)
+{
+	static float32_t inL[AUDIO_BLOCK_SAMPLES], inR[AUDIO_BLOCK_SAMPLES];
+	static float32_t outL[AUDIO_BLOCK_SAMPLES], outR[AUDIO_BLOCK_SAMPLES];
+	const std::vector<float32_t> &srcL = HostSim::input(0);
+	const std::vector<float32_t> &srcR = HostSim::input(1);
+	const size_t srcLen = std::min(srcL.size(), srcR.size());
+	size_t srcPos = 0;
+	HostRT::schedName(audioSched, sizeof(audioSched));
+
+	uint64_t start = clockNs();
+	uint64_t period = 0;
+	while (!stopRequest)
+	{
+		// no drift: the wake up times are computed from the start
+		const uint64_t wake = start + (uint64_t)(++period * blockNs);
+		const timespec ts = {(time_t)(wake / 1000000000ull), (long)(wake % 1000000000ull)};
+		clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+		const uint64_t now = clockNs();
+		const uint64_t late = now > wake ? now - wake : 0;
+		// the block has to be done before the DMA needs it, one period after the wake up
+		uint64_t deadline = wake + (uint64_t)blockNs;
+		maxUpdate(stats.lateMax, (uint32_t)std::min<uint64_t>(late, UINT32_MAX));
+		if (late >= blockNs)
+		{
+			// whole periods missed, the codec would have played them out: start again from now
+			stats.xruns += (uint64_t)(late / blockNs);
+			start = now - (uint64_t)(period * blockNs);
+			deadline = now + (uint64_t)blockNs;
+		}
+		for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+		{
+			inL[i] = srcLen ? srcL[srcPos] : 0.0f;
+			inR[i] = srcLen ? srcR[srcPos] : 0.0f;
+			if (++srcPos >= srcLen) srcPos = 0;
+		}
+		runBlock(inL, inR, outL, outR);
+		if (clockNs() > deadline) stats.xruns++;
+	}
+	return NULL;
+}
+
+// ---------------------------------------------------------------- JACK backend
+#ifdef HOSTSIM_JACK
+static jack_client_t *jackClient = NULL;
+static jack_port_t *jackIn[2], *jackOut[2];
+
+static int jackProcess(jack_nframes_t frames, void *)
+{
+	static bool first = true;
+	if (first)
+	{
+		HostRT::schedName(audioSched, sizeof(audioSched));
+		first = false;
+	}
+	const float32_t *inL = (const float32_t *)jack_port_get_buffer(jackIn[0], frames);
+	const float32_t *inR = (const float32_t *)jack_port_get_buffer(jackIn[1], frames);
+	float32_t *outL = (float32_t *)jack_port_get_buffer(jackOut[0], frames);
+	float32_t *outR = (float32_t *)jack_port_get_buffer(jackOut[1], frames);
+	for (jack_nframes_t n = 0; n + AUDIO_BLOCK_SAMPLES <= frames; n += AUDIO_BLOCK_SAMPLES)
+		runBlock(inL + n, inR + n, outL + n, outR + n);
+	return 0;
+}
+
+static int jackXrun(void *)
+{
+	stats.xruns++;
+	return 0;
+}
+
+static void jackShutdown(void *) { stopRequest = 1; }
+
+static bool jackStart(const char *server)
+{
+	jack_status_t status;
+	jackClient = jack_client_open("hexefx_hostsim", server ? JackServerName : JackNullOption, &status, server);
+	if (!jackClient)
+	{
+		fprintf(stderr, "Can't connect to the JACK server (status 0x%x), start one with: jackd -R -d dummy\n", status);
+		return false;
+	}
+	const jack_nframes_t frames = jack_get_buffer_size(jackClient);
+	if (frames % AUDIO_BLOCK_SAMPLES)
+	{
+		fprintf(stderr, "JACK buffer size %u is not a multiple of the audio block (%d samples)\n",
+				frames, AUDIO_BLOCK_SAMPLES);
+		return false;
+	}
+	const jack_nframes_t fs = jack_get_sample_rate(jackClient);
+	if (fabs(fs - AUDIO_SAMPLE_RATE_EXACT) > 1000.0)
+		fprintf(stderr, "Warning: JACK runs at %uHz, the audio graph at %.0fHz\n", fs, AUDIO_SAMPLE_RATE_EXACT);
+	jack_set_process_callback(jackClient, jackProcess, NULL);
+	jack_set_xrun_callback(jackClient, jackXrun, NULL);
+	jack_on_shutdown(jackClient, jackShutdown, NULL);
+	jackIn[0] = jack_port_register(jackClient, "in_L", JACK_DEFAULT_AUDIO_TYPE, JackPortIsInput, 0);
+	jackIn[1] = jack_port_register(jackClient, "in_R", JACK_DEFAULT_AUDIO_TYPE, JackPortIsInput, 0);
+	jackOut[0] = jack_port_register(jackClient, "out_L", JACK_DEFAULT_AUDIO_TYPE, JackPortIsOutput, 0);
+	jackOut[1] = jack_port_register(jackClient, "out_R", JACK_DEFAULT_AUDIO_TYPE, JackPortIsOutput, 0);
+	if (!jackIn[0] || !jackIn[1] || !jackOut[0] || !jackOut[1] || jack_activate(jackClient))
+	{
+		fprintf(stderr, "Can't activate the JACK client\n");
+		return false;
+	}
+	// to the system ports if there are any, the dummy driver has them too
+	const char **ports = jack_get_ports(jackClient, NULL, JACK_DEFAULT_AUDIO_TYPE, JackPortIsPhysical | JackPortIsOutput);
+	for (int i = 0; ports && ports[i] && i < 2; i++) jack_connect(jackClient, ports[i], jack_port_name(jackIn[i]));
+	jack_free(ports);
+	ports = jack_get_ports(jackClient, NULL, JACK_DEFAULT_AUDIO_TYPE, JackPortIsPhysical | JackPortIsInput);
+	for (int i = 0; ports && ports[i] && i < 2; i++) jack_connect(jackClient, jack_port_name(jackOut[i]), ports[i]);
+	jack_free(ports);
+	return true;
+}
+
+static void jackStop()
+{
+	if (!jackClient) return;
+	jack_deactivate(jackClient);
+	jack_client_close(jackClient);
+	jackClient = NULL;
+}
+#endif
+
+// ---------------------------------------------------------------- synthetic load
+static void loadThread()
+{
+	// streams through a buffer larger than the caches: CPU and memory bus load
+	std::vector<uint8_t> buf(16 * 1024 * 1024);
+	uint8_t v = 0;
+	while (loadRunning.load(std::memory_order_relaxed)) memset(buf.data(), v++, buf.size());
+}
+
+int main(int argc, char **argv)
+{
+	const char *inFile = NULL;
+	const char *outFile = NULL;
+	const char *backend = "timer";
+	const char *server = NULL;
+	char genType[16] = "sine";
+	float genSeconds = 2.0f;
+	float duration = 0.0f;
+	int priority = 80;
+	uint32_t loadThreads = 0;
+	std::vector<midi_event_t> events;
+	int opt;
+	while ((opt = getopt(argc, argv, "b:d:i:g:o:n:c:f:sp:L:w:TS:h")) != -1)
+	{
+		unsigned int a, b;
+		float t;
+		switch (opt)
+		{
+			case 'b': backend = optarg; break;
+			case 'd': duration = atof(optarg); break;
+			case 'i': inFile = optarg; break;
+			case 'o': outFile = optarg; break;
+			case 'g':
+				if (sscanf(optarg, "%15[a-z]:%f", genType, &genSeconds) < 1) { usage(argv[0]); return 1; }
+				break;
+			case 'n':
+				if (sscanf(optarg, "%u@%f", &a, &t) != 2) { usage(argv[0]); return 1; }
+				events.push_back({(uint32_t)(t * 1000.0f), HostMIDI::NoteOn, (uint8_t)a, 127});
+				break;
+			case 'c':
+				if (sscanf(optarg, "%u=%u@%f", &a, &b, &t) != 3) { usage(argv[0]); return 1; }
+				events.push_back({(uint32_t)(t * 1000.0f), HostMIDI::ControlChange, (uint8_t)a, (uint8_t)b});
+				break;
+			case 'f': SD.setRoot(optarg); break;
+			case 's': Serial.enable(true); break;
+			case 'p': priority = atoi(optarg); break;
+			case 'L': loadThreads = atoi(optarg); break;
+			case 'w': callbackWork = (uint32_t)(atof(optarg) * 0.01 * blockNs); break;
+			case 'T': HostRT::trapAbort(true); break;
+			case 'S': server = optarg; break;
+			default: usage(argv[0]); return opt == 'h' ? 0 : 1;
+		}
+	}
+	const bool jack = !strcmp(backend, "jack");
+	if (!jack && strcmp(backend, "timer"))
+	{
+		usage(argv[0]);
+		return 1;
+	}
+#ifndef HOSTSIM_JACK
+	if (jack)
+	{
+		fprintf(stderr, "Built without JACK, install the JACK development files and rebuild\n");
+		return 1;
+	}
+#endif
+	if (outFile && duration <= 0.0f)
+	{
+		fprintf(stderr, "Recording the output needs the run time (-d)\n");
+		return 1;
+	}
+	std::stable_sort(events.begin(), events.end(),
+					 [](const midi_event_t &x, const midi_event_t &y) { return x.time_ms < y.time_ms; });
+	if (inFile ? !HostSim::loadInput(inFile) : !HostSim::generateInput(genType, genSeconds))
+	{
+		fprintf(stderr, "Can't %s the input %s\n", inFile ? "read" : "generate", inFile ? inFile : genType);
+		return 1;
+	}
+
+	// everything allocated from here on stays in RAM
+	if (!HostRT::lockMemory())
+		fprintf(stderr, "Warning: can't lock the memory (ulimit -l / CAP_IPC_LOCK), page faults possible\n");
+	setup();
+	// setup() queued the model and parameter changes, apply them now: the
+	// model weights and buffers are ready before the first real time block
+	{
+		static float32_t silence[AUDIO_BLOCK_SAMPLES], scratchL[AUDIO_BLOCK_SAMPLES], scratchR[AUDIO_BLOCK_SAMPLES];
+		for (int i = 0; i < HOSTRT_WARMUP_BLOCKS; i++)
+		{
+			HostSim::setLiveBuffers(silence, silence, scratchL, scratchR);
+			HostSim::processBlock();
+		}
+		AudioProcessorUsageMaxReset();
+	}
+	if (outFile)
+	{
+		recL.assign((size_t)(duration * AUDIO_SAMPLE_RATE_EXACT), 0.0f);
+		recR.assign(recL.size(), 0.0f);
+	}
+
+	std::vector<std::thread> load;
+	loadRunning = true;
+	for (uint32_t i = 0; i < loadThreads; i++) load.emplace_back(loadThread);
+
+	signal(SIGINT, onSignal);
+	signal(SIGTERM, onSignal);
+	pthread_t audioThread;
+	bool started = false;
+#ifdef HOSTSIM_JACK
+	if (jack) started = jackStart(server);
+#else
+	(void)server;
+#endif
+	if (!jack)
+	{
+		started = HostRT::startThread(audioThread, timerThread, NULL, priority);
+		if (!started) fprintf(stderr, "Can't start the audio thread\n");
+	}
+	auto t0 = std::chrono::steady_clock::now();
+	const uint32_t ms0 = millis();
+	size_t nextEvent = 0;
+	double wall = 0.0;
+	while (started && !stopRequest && (duration <= 0.0f || wall < duration))
+	{
+		// event times relative to the start of the live audio
+		while (nextEvent < events.size() && events[nextEvent].time_ms <= millis() - ms0)
+		{
+			const midi_event_t &e = events[nextEvent++];
+			usbMIDI.queue(e.type, 1, e.data1, e.data2);
+		}
+		loop();
+		usleep(1000);
+		wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+	}
+	stopRequest = 1;
+#ifdef HOSTSIM_JACK
+	if (jack) jackStop();
+#endif
+	if (!jack && started) pthread_join(audioThread, NULL);
+	loadRunning = false;
+	for (std::thread &t : load) t.join();
+	if (Serial) fflush(stdout);
+	if (!started) return 1;
+
+	const double hours = wall / 3600.0;
+	fprintf(stderr, "\n");
+	HostSim::report(stderr, wall);
+	fprintf(stderr, "Live run: %s backend, audio thread %s, %u load threads, +%.0f%% callback load\r\n",
+			backend, audioSched, loadThreads, 100.0 * callbackWork / blockNs);
+	fprintf(stderr, "Xruns: %llu in %.1fs, %.1f per hour, callback max %.2f%% of the block period, wake up latency max %.0fus\r\n",
+			(unsigned long long)stats.xruns.load(), wall, hours > 0.0 ? stats.xruns.load() / hours : 0.0,
+			100.0 * stats.callbackMax.load() / blockNs, stats.lateMax.load() / 1000.0);
+	HostRT::trapReport(stderr);
+	if (outFile && !wav_write(outFile, recL, recR, AUDIO_SAMPLE_RATE_EXACT))
+	{
+		fprintf(stderr, "Can't write the output %s\n", outFile);
+		return 1;
+	}
+	return HostRT::trapTotal() ? 3 : 0;
+}
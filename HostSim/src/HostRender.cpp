@@ -0,0 +1,203 @@
+/**
+ * @file HostRender.cpp
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Multi threaded offline renderer for the host (Linux).
+ * @version 0.1
+ * @date 2024-03-11
+ */
+#include "HostRender.h"
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <memory>
+
+namespace
+{
+
+typedef struct
+{
+	uint32_t track;
+	uint32_t stage;
+} task_t;
+
+typedef struct
+{
+	HostRenderTrack *track;
+	uint32_t blocks;
+	std::unique_ptr<std::atomic<uint32_t>[]> done;	// blocks finished per stage
+	std::unique_ptr<std::atomic<bool>[]> busy;		// stage queued or running
+} track_state_t;
+
+class Scheduler
+{
+public:
+	Scheduler(std::vector<HostRenderTrack *> &tracks, uint32_t threads, uint16_t blockLen)
+		: queues(threads), locks(threads), blockLen(blockLen)
+	{
+		uint64_t tasks = 0;
+		state.resize(tracks.size());
+		for (size_t t = 0; t < tracks.size(); t++)
+		{
+			track_state_t &st = state[t];
+			const size_t n = std::min(tracks[t]->L.size(), tracks[t]->R.size());
+			const uint32_t stages = tracks[t]->stages.size();
+			st.track = tracks[t];
+			st.blocks = (n + blockLen - 1) / blockLen;
+			st.done.reset(new std::atomic<uint32_t>[stages]);
+			st.busy.reset(new std::atomic<bool>[stages]);
+			for (uint32_t s = 0; s < stages; s++)
+			{
+				st.done[s] = 0;
+				st.busy[s] = false;
+			}
+			tasks += (uint64_t)st.blocks * stages;
+		}
+		remaining = tasks;
+		// first stage of every track, spread over the workers
+		for (size_t t = 0; t < state.size(); t++)
+			if (state[t].track->stages.size()) schedule(t, 0, t % threads);
+	}
+
+	void worker(uint32_t id)
+	{
+		task_t task;
+		while (remaining.load())
+		{
+			if (!pop(id, task) && !steal(id, task))
+			{
+				std::this_thread::yield();
+				continue;
+			}
+			execute(task, id);
+		}
+	}
+
+private:
+	std::vector<track_state_t> state;
+	std::vector<std::deque<task_t>> queues;
+	std::vector<std::mutex> locks;
+	std::atomic<uint64_t> remaining;
+	uint16_t blockLen;
+
+	bool ready(uint32_t t, uint32_t s)
+	{
+		const track_state_t &st = state[t];
+		const uint32_t next = st.done[s].load();
+		if (next >= st.blocks) return false;
+		return s == 0 || st.done[s - 1].load() > next;
+	}
+
+	// queue the next block of a stage if it is ready and not queued or running yet
+	void schedule(uint32_t t, uint32_t s, uint32_t id)
+	{
+		if (s >= state[t].track->stages.size()) return;
+		while (ready(t, s))
+		{
+			bool idle = false;
+			if (!state[t].busy[s].compare_exchange_strong(idle, true)) return;	// the owner reschedules
+			if (ready(t, s))
+			{
+				std::lock_guard<std::mutex> lock(locks[id]);
+				queues[id].push_back({t, s});
+				return;
+			}
+			state[t].busy[s] = false;
+		}
+	}
+
+	void execute(const task_t &task, uint32_t id)
+	{
+		track_state_t &st = state[task.track];
+		HostRenderTrack &tr = *st.track;
+		const uint32_t b = st.done[task.stage].load();
+		const size_t pos = (size_t)b * blockLen;
+		const size_t n = std::min(tr.L.size(), tr.R.size());
+		const uint16_t len = (uint16_t)std::min<size_t>(blockLen, n - pos);
+		tr.stages[task.stage]->processBlock(&tr.L[pos], &tr.R[pos], len);
+		st.done[task.stage] = b + 1;
+		st.busy[task.stage] = false;
+		remaining--;
+		// the next stage first: keeps the block in the cache of this core
+		schedule(task.track, task.stage + 1, id);
+		schedule(task.track, task.stage, id);
+	}
+
+	bool pop(uint32_t id, task_t &task)
+	{
+		std::lock_guard<std::mutex> lock(locks[id]);
+		if (queues[id].empty()) return false;
+		task = queues[id].back();
+		queues[id].pop_back();
+		return true;
+	}
+
+	bool steal(uint32_t id, task_t &task)
+	{
+		const uint32_t n = queues.size();
+		for (uint32_t i = 1; i < n; i++)
+		{
+			const uint32_t victim = (id + i) % n;
+			std::lock_guard<std::mutex> lock(locks[victim]);
+			if (queues[victim].empty()) continue;
+			task = queues[victim].front();
+			queues[victim].pop_front();
+			return true;
+		}
+		return false;
+	}
+};
+
+} // namespace
+
+double HostRender::run(std::vector<HostRenderTrack *> &tracks, uint32_t threads, uint16_t blockLen)
+{
+	if (threads == 0) threads = 1;
+	if (blockLen == 0 || blockLen > AUDIO_BLOCK_SAMPLES) blockLen = AUDIO_BLOCK_SAMPLES;
+	Scheduler scheduler(tracks, threads, blockLen);
+	auto t0 = std::chrono::steady_clock::now();
+	std::vector<std::thread> workers;
+	for (uint32_t i = 1; i < threads; i++) workers.emplace_back(&Scheduler::worker, &scheduler, i);
+	scheduler.worker(0);
+	for (std::thread &w : workers) w.join();
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+// ---------------------------------------------------------------- library effects as stages
+AudioStreamStage_F32::AudioStreamStage_F32(AudioStream_F32 &effect, uint8_t inputs) : effect(effect)
+{
+	for (uint8_t i = 0; i < inputs; i++) cables.push_back(new AudioConnection_F32(feed, i & 1, effect, i));
+	cables.push_back(new AudioConnection_F32(effect, 0, capture, 0));
+	cables.push_back(new AudioConnection_F32(effect, 1, capture, 1));
+}
+
+AudioStreamStage_F32::~AudioStreamStage_F32()
+{
+	for (AudioConnection_F32 *c : cables) delete c;
+}
+
+void AudioStreamStage_F32::processBlock(float32_t *L, float32_t *R, uint16_t len)
+{
+	audio_block_f32_t *inL = AudioStream_F32::allocate_f32();
+	audio_block_f32_t *inR = AudioStream_F32::allocate_f32();
+	if (inL && inR)
+	{
+		// the library effects work on full blocks, a short last block is padded
+		memset(inL->data, 0, sizeof(inL->data));
+		memset(inR->data, 0, sizeof(inR->data));
+		memcpy(inL->data, L, len * sizeof(float32_t));
+		memcpy(inR->data, R, len * sizeof(float32_t));
+		feed.send(inL, 0);
+		feed.send(inR, 1);
+	}
+	AudioStream_F32::release(inL);
+	AudioStream_F32::release(inR);
+	effect.update();
+	audio_block_f32_t *outL = capture.take(0);
+	audio_block_f32_t *outR = capture.take(1);
+	if (outL) memcpy(L, outL->data, len * sizeof(float32_t));
+	if (outR) memcpy(R, outR->data, len * sizeof(float32_t));
+	AudioStream_F32::release(outL);
+	AudioStream_F32::release(outR);
+}
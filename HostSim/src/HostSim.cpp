@@ -0,0 +1,215 @@
+/**
+ * @file HostSim.cpp
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Host (Linux) simulator of the Teensy audio system
+ * @version 0.1
+ * @date 2024-03-01
+ */
+#include "HostSim.h"
+#include "wav_file.h"
+#include <cxxabi.h>
+#include <typeinfo>
+#include <string>
+#include <cmath>
+#include <algorithm>
+
+std::vector<float32_t> HostSim::inL, HostSim::inR, HostSim::outL, HostSim::outR;
+float32_t HostSim::inFs = AUDIO_SAMPLE_RATE_EXACT;
+uint64_t HostSim::samplePos = 0;
+const float32_t *HostSim::liveInL = NULL, *HostSim::liveInR = NULL;
+float32_t *HostSim::liveOutL = NULL, *HostSim::liveOutR = NULL;
+
+bool HostSim::loadInput(const char *path)
+{
+	return wav_read(path, inL, inR, inFs);
+}
+
+bool HostSim::generateInput(const char *type, float32_t seconds)
+{
+	const uint32_t len = (uint32_t)(seconds * AUDIO_SAMPLE_RATE_EXACT);
+	inFs = AUDIO_SAMPLE_RATE_EXACT;
+	inL.assign(len, 0.0f);
+	if (!strcmp(type, "sine"))
+	{
+		for (uint32_t i = 0; i < len; i++)
+			inL[i] = 0.5f * sinf(TWO_PI * 110.0 * i / AUDIO_SAMPLE_RATE_EXACT);
+	}
+	else if (!strcmp(type, "noise"))
+	{
+		uint32_t seed = 22222;
+		for (uint32_t i = 0; i < len; i++)
+		{
+			seed = seed * 1664525u + 1013904223u;
+			inL[i] = 0.5f * ((float32_t)(int32_t)seed / 2147483648.0f);
+		}
+	}
+	else if (!strcmp(type, "impulse"))
+	{
+		if (len) inL[0] = 1.0f;
+	}
+	else return false;
+	inR = inL;
+	return true;
+}
+
+bool HostSim::saveOutput(const char *path)
+{
+	return wav_write(path, outL, outR, AUDIO_SAMPLE_RATE_EXACT);
+}
+
+uint32_t HostSim::prepare(float32_t tailSeconds)
+{
+	const uint64_t len = inL.size() + (uint64_t)(tailSeconds * AUDIO_SAMPLE_RATE_EXACT);
+	const uint32_t blocks = (uint32_t)((len + AUDIO_BLOCK_SAMPLES - 1) / AUDIO_BLOCK_SAMPLES);
+	// no allocation or page faults in the timed output update
+	outL.resize(samplePos + (uint64_t)blocks * AUDIO_BLOCK_SAMPLES, 0.0f);
+	outR.resize(samplePos + (uint64_t)blocks * AUDIO_BLOCK_SAMPLES, 0.0f);
+	return blocks;
+}
+
+void HostSim::processBlock()
+{
+	AudioStream::update_all();
+	samplePos += AUDIO_BLOCK_SAMPLES;
+}
+
+void HostSim::setLiveBuffers(const float32_t *inL, const float32_t *inR, float32_t *outL, float32_t *outR)
+{
+	liveInL = inL;
+	liveInR = inR;
+	liveOutL = outL;
+	liveOutR = outR;
+}
+
+void HostSim::readInput(float32_t *L, float32_t *R, uint32_t len)
+{
+	if (liveInL)
+	{
+		memcpy(L, liveInL, len * sizeof(float32_t));
+		memcpy(R, liveInR, len * sizeof(float32_t));
+		return;
+	}
+	for (uint32_t i = 0; i < len; i++)
+	{
+		const uint64_t n = samplePos + i;
+		L[i] = n < inL.size() ? inL[n] : 0.0f;
+		R[i] = n < inR.size() ? inR[n] : 0.0f;
+	}
+}
+
+void HostSim::writeOutput(const float32_t *L, const float32_t *R, uint32_t len)
+{
+	// more than one output object: the outputs are mixed
+	if (liveOutL)
+	{
+		for (uint32_t i = 0; i < len; i++)
+		{
+			liveOutL[i] += L[i];
+			liveOutR[i] += R[i];
+		}
+		return;
+	}
+	if (outL.size() < samplePos + len)
+	{
+		outL.resize(samplePos + len, 0.0f);
+		outR.resize(samplePos + len, 0.0f);
+	}
+	for (uint32_t i = 0; i < len; i++)
+	{
+		outL[samplePos + i] += L[i];
+		outR[samplePos + i] += R[i];
+	}
+}
+
+bool HostSim::outputValid()
+{
+	for (size_t i = 0; i < outL.size(); i++)
+		if (!std::isfinite(outL[i]) || !std::isfinite(outR[i])) return false;
+	return true;
+}
+
+int32_t HostSim::reportLatency(FILE *out)
+{
+	const uint32_t maxLag = 4096;
+	const uint64_t window = std::min<uint64_t>(inL.size(), (uint64_t)AUDIO_SAMPLE_RATE_EXACT);
+	if (outL.size() < window + maxLag || window == 0) return -1;
+	int32_t lag = -1;
+	double peak = 0.0;
+	for (uint32_t l = 0; l < maxLag; l++)
+	{
+		double acc = 0.0;
+		for (uint64_t n = 0; n < window; n++)
+			acc += (double)(inL[n] + inR[n]) * (double)(outL[n + l] + outR[n + l]);
+		if (fabs(acc) > peak)
+		{
+			peak = fabs(acc);
+			lag = l;
+		}
+	}
+	if (lag < 0) return -1;
+	const double ms = 1000.0 / AUDIO_SAMPLE_RATE_EXACT;
+	const int32_t buffering = 2 * AUDIO_BLOCK_SAMPLES;
+	fprintf(out, "Latency: processing %d samples (%.2fms), with I2S DMA buffering %d samples (%.2fms), codec not included\r\n",
+			lag, lag * ms, lag + buffering, (lag + buffering) * ms);
+	return lag;
+}
+
+static std::string typeName(AudioStream *p)
+{
+	int status;
+	char *name = abi::__cxa_demangle(typeid(*p).name(), NULL, NULL, &status);
+	std::string s = status == 0 ? name : typeid(*p).name();
+	free(name);
+	return s;
+}
+
+void HostSim::report(FILE *out, double wallSeconds)
+{
+	const double audioSeconds = (double)samplePos / AUDIO_SAMPLE_RATE_EXACT;
+	fprintf(out, "Processed %.2fs of audio in %.2fs (%.1fx real time), block = %d samples\r\n",
+			audioSeconds, wallSeconds, wallSeconds > 0.0 ? audioSeconds / wallSeconds : 0.0, AUDIO_BLOCK_SAMPLES);
+	fprintf(out, "CPU usage in %% of the block period (host CPU time):\r\n");
+	fprintf(out, "  #   avg      max      blocks  fails  object\r\n");
+	uint32_t idx = 0;
+	for (AudioStream *p = AudioStream::first(); p; p = p->next(), idx++)
+	{
+		const AudioStream::host_stats_t &st = p->hostStats();
+		if (!st.updates) continue;
+		fprintf(out, "  %-3u %6.2f%%  %6.2f%%  %6u  %5u  %s\r\n", idx,
+				CYCLE_COUNTER_APPROX_PERCENT((double)st.cycles_sum / st.updates),
+				CYCLE_COUNTER_APPROX_PERCENT(st.cycles_peak), st.pool_peak, st.alloc_failures,
+				typeName(p).c_str());
+	}
+	const AudioStream::host_stats_t &tot = AudioStream::hostStatsTotal();
+	if (tot.updates)
+	{
+		fprintf(out, "      %6.2f%%  %6.2f%%  %6u  %5u  total, %.1fns per sample\r\n",
+				CYCLE_COUNTER_APPROX_PERCENT((double)tot.cycles_sum / tot.updates),
+				CYCLE_COUNTER_APPROX_PERCENT(tot.cycles_peak), tot.pool_peak, tot.alloc_failures,
+				(double)tot.cycles_sum / ((double)tot.updates * AUDIO_BLOCK_SAMPLES));
+	}
+	reportPool(out);
+}
+
+uint32_t HostSim::reportPool(FILE *out)
+{
+	const AudioStream::host_stats_t &tot = AudioStream::hostStatsTotal();
+	const uint32_t requested = AudioStream_F32::hostPoolRequested();
+	const uint32_t peak = tot.pool_peak;
+	fprintf(out, "Audio memory F32: max %u of %u blocks used", peak, requested);
+	if (AudioStream_F32::hostPoolCalibrating())
+	{
+		// the peak is the minimum for this input and these settings
+		fprintf(out, ", calibrated minimum AudioMemory_F32(%u)", peak);
+		if (requested > peak)
+			fprintf(out, ", %u bytes to spare", (uint32_t)((requested - peak) * sizeof(audio_block_f32_t)));
+		else if (requested < peak)
+			fprintf(out, ", %u blocks missing!", peak - requested);
+	}
+	else if (tot.alloc_failures)
+	{
+		fprintf(out, ", %u allocation failures, dropouts! Calibrate with -m", tot.alloc_failures);
+	}
+	fprintf(out, "\r\n");
+	return peak;
+}
@@ -0,0 +1,37 @@
+/**
+ * @file HostSim_IO_F32.cpp
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Host (Linux) audio endpoints
+ * @version 0.1
+ * @date 2024-03-01
+ */
+#include "HostSim_IO_F32.h"
+#include "HostSim.h"
+
+void AudioInputWAV_F32::update(void)
+{
+	audio_block_f32_t *blockL = allocate_f32();
+	audio_block_f32_t *blockR = allocate_f32();
+	if (!blockL || !blockR)
+	{
+		if (blockL) release(blockL);
+		if (blockR) release(blockR);
+		return;
+	}
+	HostSim::readInput(blockL->data, blockR->data, AUDIO_BLOCK_SAMPLES);
+	transmit(blockL, 0);
+	transmit(blockR, 1);
+	release(blockL);
+	release(blockR);
+}
+
+void AudioOutputWAV_F32::update(void)
+{
+	static const float32_t silence[AUDIO_BLOCK_SAMPLES] = {0.0f};
+	audio_block_f32_t *blockL = receiveReadOnly_f32(0);
+	audio_block_f32_t *blockR = receiveReadOnly_f32(1);
+	HostSim::writeOutput(blockL ? blockL->data : silence,
+						 blockR ? blockR->data : silence, AUDIO_BLOCK_SAMPLES);
+	if (blockL) release(blockL);
+	if (blockR) release(blockR);
+}
@@ -0,0 +1,127 @@
+/**
+ * @file HostSim_main.cpp
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Host (Linux) simulator runner: calls the sketch setup(), then
+ * 		processes the input block by block calling loop() after each block,
+ * 		writes the output WAV file and prints the CPU usage report.
+ * @version 0.1
+ * @date 2024-03-01
+ */
+#include <Arduino.h>
+#include <getopt.h>
+#include <chrono>
+#include <algorithm>
+#include "HostSim.h"
+#include <SD.h>
+
+void setup();
+void loop();
+
+typedef struct
+{
+	uint32_t time_ms;
+	uint8_t type;
+	uint8_t data1;
+	uint8_t data2;
+} midi_event_t;
+
+static void usage(const char *name)
+{
+	fprintf(stderr,
+		"usage: %s [options]\n"
+		"  -i file.wav     input file (default: generated sine)\n"
+		"  -g type[:sec]   generate the input: sine, noise, impulse (default sine:2)\n"
+		"  -o file.wav     output file\n"
+		"  -t seconds      tail processed after the end of the input (default 1)\n"
+		"  -n note@sec     send a MIDI note on at the given time\n"
+		"  -c cc=val@sec   send a MIDI control change at the given time\n"
+		"  -f dir          directory used as the SD card (default: the current one)\n"
+		"  -s              print the serial output of the sketch\n"
+		"  -l              measure the latency (use a noise or impulse input)\n"
+		"  -m              calibrate the audio memory: run with the largest block pool\n"
+		"                  and report the minimum AudioMemory_F32() size\n", name);
+}
+
+int main(int argc, char **argv)
+{
+	const char *inFile = NULL;
+	const char *outFile = NULL;
+	char genType[16] = "sine";
+	float genSeconds = 2.0f;
+	float tailSeconds = 1.0f;
+	bool latency = false;
+	std::vector<midi_event_t> events;
+	int opt;
+	while ((opt = getopt(argc, argv, "i:g:o:t:n:c:f:slmh")) != -1)
+	{
+		unsigned int a, b;
+		float t;
+		switch (opt)
+		{
+			case 'i': inFile = optarg; break;
+			case 'o': outFile = optarg; break;
+			case 'g':
+				if (sscanf(optarg, "%15[a-z]:%f", genType, &genSeconds) < 1) { usage(argv[0]); return 1; }
+				break;
+			case 't': tailSeconds = atof(optarg); break;
+			case 'n':
+				if (sscanf(optarg, "%u@%f", &a, &t) != 2) { usage(argv[0]); return 1; }
+				events.push_back({(uint32_t)(t * 1000.0f), HostMIDI::NoteOn, (uint8_t)a, 127});
+				break;
+			case 'c':
+				if (sscanf(optarg, "%u=%u@%f", &a, &b, &t) != 3) { usage(argv[0]); return 1; }
+				events.push_back({(uint32_t)(t * 1000.0f), HostMIDI::ControlChange, (uint8_t)a, (uint8_t)b});
+				break;
+			case 'f': SD.setRoot(optarg); break;
+			case 's': Serial.enable(true); break;
+			case 'l': latency = true; break;
+			case 'm': AudioStream_F32::hostPoolCalibrate(true); break;
+			default: usage(argv[0]); return opt == 'h' ? 0 : 1;
+		}
+	}
+	std::stable_sort(events.begin(), events.end(),
+					 [](const midi_event_t &x, const midi_event_t &y) { return x.time_ms < y.time_ms; });
+
+	if (inFile ? !HostSim::loadInput(inFile) : !HostSim::generateInput(genType, genSeconds))
+	{
+		fprintf(stderr, "Can't %s the input %s\n", inFile ? "read" : "generate", inFile ? inFile : genType);
+		return 1;
+	}
+	if (fabsf(HostSim::inputSampleRate() - AUDIO_SAMPLE_RATE_EXACT) > 1000.0f)
+		fprintf(stderr, "Warning: input sample rate %.0fHz, the audio runs at %.0fHz\n",
+				HostSim::inputSampleRate(), AUDIO_SAMPLE_RATE_EXACT);
+
+	setup();
+
+	const uint32_t blocks = HostSim::prepare(tailSeconds);
+	size_t nextEvent = 0;
+	auto t0 = std::chrono::steady_clock::now();
+	for (uint32_t b = 0; b < blocks; b++)
+	{
+		while (nextEvent < events.size() && events[nextEvent].time_ms <= millis())
+		{
+			const midi_event_t &e = events[nextEvent++];
+			usbMIDI.queue(e.type, 1, e.data1, e.data2);
+		}
+		HostSim::processBlock();
+		loop();
+	}
+	double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+	if (Serial) fflush(stdout);
+
+	fprintf(stderr, "\n");
+	HostSim::report(stderr, wall);
+	if (latency && HostSim::reportLatency(stderr) < 0)
+		fprintf(stderr, "Latency: not measured, the output is too short\n");
+	if (outFile && !HostSim::saveOutput(outFile))
+	{
+		fprintf(stderr, "Can't write the output %s\n", outFile);
+		return 1;
+	}
+	if (!HostSim::outputValid())
+	{
+		fprintf(stderr, "Output contains NaN/Inf samples!\n");
+		return 2;
+	}
+	return 0;
+}
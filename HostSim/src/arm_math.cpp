@@ -0,0 +1,477 @@
+/**
+ * @file arm_math.cpp
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Host (Linux) implementation of the CMSIS-DSP subset
+ * @version 0.1
+ * @date 2024-03-01
+ */
+#include "arm_math.h"
+#include <string.h>
+#include <vector>
+#include <mutex>
+
+// ---------------------------------------------------------------- basic math
+void arm_fill_f32(float32_t value, float32_t *pDst, uint32_t blockSize)
+{
+	while (blockSize--) *pDst++ = value;
+}
+void arm_copy_f32(const float32_t *pSrc, float32_t *pDst, uint32_t blockSize)
+{
+	memmove(pDst, pSrc, blockSize * sizeof(float32_t));
+}
+void arm_scale_f32(const float32_t *pSrc, float32_t scale, float32_t *pDst, uint32_t blockSize)
+{
+	while (blockSize--) *pDst++ = *pSrc++ * scale;
+}
+void arm_offset_f32(const float32_t *pSrc, float32_t offset, float32_t *pDst, uint32_t blockSize)
+{
+	while (blockSize--) *pDst++ = *pSrc++ + offset;
+}
+void arm_add_f32(const float32_t *pSrcA, const float32_t *pSrcB, float32_t *pDst, uint32_t blockSize)
+{
+	while (blockSize--) *pDst++ = *pSrcA++ + *pSrcB++;
+}
+void arm_sub_f32(const float32_t *pSrcA, const float32_t *pSrcB, float32_t *pDst, uint32_t blockSize)
+{
+	while (blockSize--) *pDst++ = *pSrcA++ - *pSrcB++;
+}
+void arm_mult_f32(const float32_t *pSrcA, const float32_t *pSrcB, float32_t *pDst, uint32_t blockSize)
+{
+	while (blockSize--) *pDst++ = *pSrcA++ * *pSrcB++;
+}
+void arm_negate_f32(const float32_t *pSrc, float32_t *pDst, uint32_t blockSize)
+{
+	while (blockSize--) *pDst++ = -*pSrc++;
+}
+void arm_abs_f32(const float32_t *pSrc, float32_t *pDst, uint32_t blockSize)
+{
+	while (blockSize--) *pDst++ = fabsf(*pSrc++);
+}
+void arm_dot_prod_f32(const float32_t *pSrcA, const float32_t *pSrcB, uint32_t blockSize, float32_t *result)
+{
+	float32_t acc = 0.0f;
+	while (blockSize--) acc += *pSrcA++ * *pSrcB++;
+	*result = acc;
+}
+void arm_float_to_q15(const float32_t *pSrc, q15_t *pDst, uint32_t blockSize)
+{
+	while (blockSize--)
+	{
+		float32_t x = *pSrc++ * 32768.0f;
+		x = x > 32767.0f ? 32767.0f : (x < -32768.0f ? -32768.0f : x);
+		*pDst++ = (q15_t)x;
+	}
+}
+void arm_q15_to_float(const q15_t *pSrc, float32_t *pDst, uint32_t blockSize)
+{
+	while (blockSize--) *pDst++ = (float32_t)*pSrc++ / 32768.0f;
+}
+
+// ---------------------------------------------------------------- statistics
+void arm_max_f32(const float32_t *pSrc, uint32_t blockSize, float32_t *pResult, uint32_t *pIndex)
+{
+	uint32_t idx = 0;
+	for (uint32_t i = 1; i < blockSize; i++)
+		if (pSrc[i] > pSrc[idx]) idx = i;
+	*pResult = pSrc[idx];
+	*pIndex = idx;
+}
+void arm_min_f32(const float32_t *pSrc, uint32_t blockSize, float32_t *pResult, uint32_t *pIndex)
+{
+	uint32_t idx = 0;
+	for (uint32_t i = 1; i < blockSize; i++)
+		if (pSrc[i] < pSrc[idx]) idx = i;
+	*pResult = pSrc[idx];
+	*pIndex = idx;
+}
+void arm_mean_f32(const float32_t *pSrc, uint32_t blockSize, float32_t *pResult)
+{
+	float32_t sum = 0.0f;
+	for (uint32_t i = 0; i < blockSize; i++) sum += pSrc[i];
+	*pResult = sum / (float32_t)blockSize;
+}
+void arm_power_f32(const float32_t *pSrc, uint32_t blockSize, float32_t *pResult)
+{
+	arm_dot_prod_f32(pSrc, pSrc, blockSize, pResult);
+}
+void arm_rms_f32(const float32_t *pSrc, uint32_t blockSize, float32_t *pResult)
+{
+	float32_t pwr;
+	arm_power_f32(pSrc, blockSize, &pwr);
+	*pResult = sqrtf(pwr / (float32_t)blockSize);
+}
+
+// ---------------------------------------------------------------- fast math
+float32_t arm_sin_f32(float32_t x) { return sinf(x); }
+float32_t arm_cos_f32(float32_t x) { return cosf(x); }
+arm_status arm_sqrt_f32(float32_t in, float32_t *pOut)
+{
+	if (in >= 0.0f)
+	{
+		*pOut = sqrtf(in);
+		return ARM_MATH_SUCCESS;
+	}
+	*pOut = 0.0f;
+	return ARM_MATH_ARGUMENT_ERROR;
+}
+
+// ---------------------------------------------------------------- complex math
+void arm_cmplx_mult_cmplx_f32(const float32_t *pSrcA, const float32_t *pSrcB, float32_t *pDst, uint32_t numSamples)
+{
+	while (numSamples--)
+	{
+		const float32_t a = *pSrcA++, b = *pSrcA++;
+		const float32_t c = *pSrcB++, d = *pSrcB++;
+		*pDst++ = a * c - b * d;
+		*pDst++ = a * d + b * c;
+	}
+}
+void arm_cmplx_mag_f32(const float32_t *pSrc, float32_t *pDst, uint32_t numSamples)
+{
+	while (numSamples--)
+	{
+		*pDst++ = sqrtf(pSrc[0] * pSrc[0] + pSrc[1] * pSrc[1]);
+		pSrc += 2;
+	}
+}
+void arm_cmplx_mag_squared_f32(const float32_t *pSrc, float32_t *pDst, uint32_t numSamples)
+{
+	while (numSamples--)
+	{
+		*pDst++ = pSrc[0] * pSrc[0] + pSrc[1] * pSrc[1];
+		pSrc += 2;
+	}
+}
+void arm_cmplx_conj_f32(const float32_t *pSrc, float32_t *pDst, uint32_t numSamples)
+{
+	while (numSamples--)
+	{
+		*pDst++ = pSrc[0];
+		*pDst++ = -pSrc[1];
+		pSrc += 2;
+	}
+}
+
+// ---------------------------------------------------------------- filters
+void arm_biquad_cascade_df1_init_f32(arm_biquad_casd_df1_inst_f32 *S, uint8_t numStages, const float32_t *pCoeffs, float32_t *pState)
+{
+	S->numStages = numStages;
+	S->pCoeffs = pCoeffs;
+	S->pState = pState;
+	memset(pState, 0, 4u * numStages * sizeof(float32_t));
+}
+
+void arm_biquad_cascade_df1_f32(const arm_biquad_casd_df1_inst_f32 *S, const float32_t *pSrc, float32_t *pDst, uint32_t blockSize)
+{
+	const float32_t *pIn = pSrc;
+	const float32_t *c = S->pCoeffs;
+	float32_t *st = S->pState;
+	for (uint32_t stage = 0; stage < S->numStages; stage++)
+	{
+		float32_t x1 = st[0], x2 = st[1], y1 = st[2], y2 = st[3];
+		for (uint32_t i = 0; i < blockSize; i++)
+		{
+			const float32_t x0 = pIn[i];
+			const float32_t y0 = c[0] * x0 + c[1] * x1 + c[2] * x2 + c[3] * y1 + c[4] * y2;
+			x2 = x1; x1 = x0;
+			y2 = y1; y1 = y0;
+			pDst[i] = y0;
+		}
+		st[0] = x1; st[1] = x2; st[2] = y1; st[3] = y2;
+		st += 4;
+		c += 5;
+		pIn = pDst;
+	}
+}
+
+void arm_biquad_cascade_df2T_init_f32(arm_biquad_cascade_df2T_instance_f32 *S, uint8_t numStages, const float32_t *pCoeffs, float32_t *pState)
+{
+	S->numStages = numStages;
+	S->pCoeffs = pCoeffs;
+	S->pState = pState;
+	memset(pState, 0, 2u * numStages * sizeof(float32_t));
+}
+
+void arm_biquad_cascade_df2T_f32(const arm_biquad_cascade_df2T_instance_f32 *S, const float32_t *pSrc, float32_t *pDst, uint32_t blockSize)
+{
+	const float32_t *pIn = pSrc;
+	const float32_t *c = S->pCoeffs;
+	float32_t *st = S->pState;
+	for (uint32_t stage = 0; stage < S->numStages; stage++)
+	{
+		float32_t d1 = st[0], d2 = st[1];
+		for (uint32_t i = 0; i < blockSize; i++)
+		{
+			const float32_t x = pIn[i];
+			const float32_t y = c[0] * x + d1;
+			d1 = c[1] * x + c[3] * y + d2;
+			d2 = c[2] * x + c[4] * y;
+			pDst[i] = y;
+		}
+		st[0] = d1; st[1] = d2;
+		st += 2;
+		c += 5;
+		pIn = pDst;
+	}
+}
+
+void arm_biquad_cascade_stereo_df2T_init_f32(arm_biquad_cascade_stereo_df2T_instance_f32 *S, uint8_t numStages, const float32_t *pCoeffs, float32_t *pState)
+{
+	S->numStages = numStages;
+	S->pCoeffs = pCoeffs;
+	S->pState = pState;
+	memset(pState, 0, 4u * numStages * sizeof(float32_t));
+}
+
+void arm_biquad_cascade_stereo_df2T_f32(const arm_biquad_cascade_stereo_df2T_instance_f32 *S, const float32_t *pSrc, float32_t *pDst, uint32_t blockSize)
+{
+	const float32_t *pIn = pSrc;
+	const float32_t *c = S->pCoeffs;
+	float32_t *st = S->pState;
+	for (uint32_t stage = 0; stage < S->numStages; stage++)
+	{
+		float32_t d1a = st[0], d2a = st[1], d1b = st[2], d2b = st[3];
+		for (uint32_t i = 0; i < blockSize; i++)
+		{
+			const float32_t xa = pIn[2 * i], xb = pIn[2 * i + 1];
+			const float32_t ya = c[0] * xa + d1a;
+			const float32_t yb = c[0] * xb + d1b;
+			d1a = c[1] * xa + c[3] * ya + d2a;
+			d1b = c[1] * xb + c[3] * yb + d2b;
+			d2a = c[2] * xa + c[4] * ya;
+			d2b = c[2] * xb + c[4] * yb;
+			pDst[2 * i] = ya;
+			pDst[2 * i + 1] = yb;
+		}
+		st[0] = d1a; st[1] = d2a; st[2] = d1b; st[3] = d2b;
+		st += 4;
+		c += 5;
+		pIn = pDst;
+	}
+}
+
+void arm_fir_init_f32(arm_fir_instance_f32 *S, uint16_t numTaps, const float32_t *pCoeffs, float32_t *pState, uint32_t blockSize)
+{
+	S->numTaps = numTaps;
+	S->pCoeffs = pCoeffs;
+	S->pState = pState;
+	memset(pState, 0, (numTaps + blockSize - 1u) * sizeof(float32_t));
+}
+
+void arm_fir_f32(const arm_fir_instance_f32 *S, const float32_t *pSrc, float32_t *pDst, uint32_t blockSize)
+{
+	const uint32_t numTaps = S->numTaps;
+	float32_t *st = S->pState;
+	// state holds numTaps-1 old samples followed by the new block
+	memcpy(st + numTaps - 1u, pSrc, blockSize * sizeof(float32_t));
+	for (uint32_t i = 0; i < blockSize; i++)
+	{
+		float32_t acc = 0.0f;
+		for (uint32_t k = 0; k < numTaps; k++)
+			acc += st[i + k] * S->pCoeffs[k];
+		pDst[i] = acc;
+	}
+	memmove(st, st + blockSize, (numTaps - 1u) * sizeof(float32_t));
+}
+
+// ---------------------------------------------------------------- transforms
+#define CFFT_INSTANCE(len) const arm_cfft_instance_f32 arm_cfft_sR_f32_len##len = {len, NULL, NULL, 0};
+CFFT_INSTANCE(16)
+CFFT_INSTANCE(32)
+CFFT_INSTANCE(64)
+CFFT_INSTANCE(128)
+CFFT_INSTANCE(256)
+CFFT_INSTANCE(512)
+CFFT_INSTANCE(1024)
+CFFT_INSTANCE(2048)
+CFFT_INSTANCE(4096)
+
+static bool isPow2(uint32_t n)
+{
+	return n >= 2 && (n & (n - 1)) == 0;
+}
+
+/**
+ * @brief twiddle factors e^(-j*2*pi*k/N), k = 0..N/2-1, computed once per size,
+ * 			thread safe for the multi threaded renderer
+ */
+static const float32_t *twiddles(uint32_t N)
+{
+	static std::vector<float32_t> tables[17];
+	static std::once_flag done[17];
+	uint32_t log2N = 0;
+	while ((1u << log2N) < N) log2N++;
+	std::vector<float32_t> &t = tables[log2N];
+	std::call_once(done[log2N], [&t, N]()
+	{
+		t.resize(N);
+		for (uint32_t k = 0; k < N / 2; k++)
+		{
+			t[2 * k] = (float32_t)cos(2.0 * M_PI * k / N);
+			t[2 * k + 1] = (float32_t)-sin(2.0 * M_PI * k / N);
+		}
+	});
+	return t.data();
+}
+
+static void bitReverse(float32_t *p, uint32_t N)
+{
+	for (uint32_t i = 1, j = 0; i < N; i++)
+	{
+		uint32_t bit = N >> 1;
+		for (; j & bit; bit >>= 1) j ^= bit;
+		j ^= bit;
+		if (i < j)
+		{
+			float32_t tmp = p[2 * i]; p[2 * i] = p[2 * j]; p[2 * j] = tmp;
+			tmp = p[2 * i + 1]; p[2 * i + 1] = p[2 * j + 1]; p[2 * j + 1] = tmp;
+		}
+	}
+}
+
+static void cfft(float32_t *p, uint32_t N, bool inverse, bool bitReverseOutput)
+{
+	const float32_t *tw = twiddles(N);
+	bitReverse(p, N);
+	for (uint32_t len = 2; len <= N; len <<= 1)
+	{
+		const uint32_t half = len >> 1;
+		const uint32_t step = N / len;
+		for (uint32_t i = 0; i < N; i += len)
+		{
+			for (uint32_t k = 0; k < half; k++)
+			{
+				const float32_t wr = tw[2 * k * step];
+				const float32_t wi = inverse ? -tw[2 * k * step + 1] : tw[2 * k * step + 1];
+				float32_t *a = p + 2 * (i + k);
+				float32_t *b = p + 2 * (i + k + half);
+				const float32_t br = b[0] * wr - b[1] * wi;
+				const float32_t bi = b[0] * wi + b[1] * wr;
+				b[0] = a[0] - br;
+				b[1] = a[1] - bi;
+				a[0] += br;
+				a[1] += bi;
+			}
+		}
+	}
+	if (inverse)
+	{
+		const float32_t scale = 1.0f / (float32_t)N;
+		for (uint32_t i = 0; i < 2 * N; i++) p[i] *= scale;
+	}
+	if (bitReverseOutput) bitReverse(p, N);
+}
+
+arm_status arm_cfft_init_f32(arm_cfft_instance_f32 *S, uint16_t fftLen)
+{
+	if (!isPow2(fftLen) || fftLen > 4096) return ARM_MATH_ARGUMENT_ERROR;
+	S->fftLen = fftLen;
+	S->pTwiddle = NULL;
+	S->pBitRevTable = NULL;
+	S->bitRevLength = 0;
+	return ARM_MATH_SUCCESS;
+}
+
+void arm_cfft_f32(const arm_cfft_instance_f32 *S, float32_t *p1, uint8_t ifftFlag, uint8_t bitReverseFlag)
+{
+	cfft(p1, S->fftLen, ifftFlag != 0, bitReverseFlag == 0);
+}
+
+arm_status arm_cfft_radix4_init_f32(arm_cfft_radix4_instance_f32 *S, uint16_t fftLen, uint8_t ifftFlag, uint8_t bitReverseFlag)
+{
+	if (!isPow2(fftLen) || fftLen > 4096) return ARM_MATH_ARGUMENT_ERROR;
+	S->fftLen = fftLen;
+	S->ifftFlag = ifftFlag;
+	S->bitReverseFlag = bitReverseFlag;
+	S->onebyfftLen = 1.0f / (float32_t)fftLen;
+	return ARM_MATH_SUCCESS;
+}
+
+void arm_cfft_radix4_f32(const arm_cfft_radix4_instance_f32 *S, float32_t *pSrc)
+{
+	cfft(pSrc, S->fftLen, S->ifftFlag != 0, S->bitReverseFlag == 0);
+}
+
+arm_status arm_cfft_radix2_init_f32(arm_cfft_radix2_instance_f32 *S, uint16_t fftLen, uint8_t ifftFlag, uint8_t bitReverseFlag)
+{
+	return arm_cfft_radix4_init_f32(S, fftLen, ifftFlag, bitReverseFlag);
+}
+
+void arm_cfft_radix2_f32(const arm_cfft_radix2_instance_f32 *S, float32_t *pSrc)
+{
+	arm_cfft_radix4_f32(S, pSrc);
+}
+
+arm_status arm_rfft_fast_init_f32(arm_rfft_fast_instance_f32 *S, uint16_t fftLen)
+{
+	if (!isPow2(fftLen) || fftLen < 32 || fftLen > 4096) return ARM_MATH_ARGUMENT_ERROR;
+	S->fftLenRFFT = fftLen;
+	S->pTwiddleRFFT = NULL;
+	return arm_cfft_init_f32(&S->Sint, fftLen / 2);
+}
+
+/**
+ * Real FFT done as a complex FFT of half the length, the even/odd
+ * samples packed into the real/imaginary parts, followed by the split step.
+ */
+void arm_rfft_fast_f32(const arm_rfft_fast_instance_f32 *S, float32_t *p, float32_t *pOut, uint8_t ifftFlag)
+{
+	const uint32_t N = S->fftLenRFFT;
+	const uint32_t M = N / 2;
+	const float32_t *tw = twiddles(N);
+	if (!ifftFlag)
+	{
+		memcpy(pOut, p, N * sizeof(float32_t));
+		cfft(pOut, M, false, false);
+		const float32_t z0r = pOut[0], z0i = pOut[1];
+		for (uint32_t k = 1; k <= M / 2; k++)
+		{
+			const uint32_t mk = M - k;
+			const float32_t zkr = pOut[2 * k], zki = pOut[2 * k + 1];
+			const float32_t zmr = pOut[2 * mk], zmi = pOut[2 * mk + 1];
+			// even/odd spectra: E = (Z[k] + conj(Z[M-k])) / 2, O = (Z[k] - conj(Z[M-k])) / 2j
+			const float32_t er = 0.5f * (zkr + zmr), ei = 0.5f * (zki - zmi);
+			const float32_t or_ = 0.5f * (zki + zmi), oi = -0.5f * (zkr - zmr);
+			const float32_t wr = tw[2 * k], wi = tw[2 * k + 1];
+			const float32_t tr = or_ * wr - oi * wi, ti = or_ * wi + oi * wr;
+			pOut[2 * k] = er + tr;
+			pOut[2 * k + 1] = ei + ti;
+			if (mk != k)
+			{
+				// X[M-k] = conj(E[k]) - conj(W^k * O[k])
+				pOut[2 * mk] = er - tr;
+				pOut[2 * mk + 1] = -(ei - ti);
+			}
+		}
+		pOut[0] = z0r + z0i;	// DC
+		pOut[1] = z0r - z0i;	// Nyquist
+	}
+	else
+	{
+		memcpy(pOut, p, N * sizeof(float32_t));
+		const float32_t dc = pOut[0], ny = pOut[1];
+		for (uint32_t k = 1; k <= M / 2; k++)
+		{
+			const uint32_t mk = M - k;
+			const float32_t xkr = pOut[2 * k], xki = pOut[2 * k + 1];
+			const float32_t xmr = pOut[2 * mk], xmi = pOut[2 * mk + 1];
+			// E = (X[k] + conj(X[M-k])) / 2, O = (X[k] - conj(X[M-k])) * conj(W^k) / 2
+			const float32_t er = 0.5f * (xkr + xmr), ei = 0.5f * (xki - xmi);
+			const float32_t dr = 0.5f * (xkr - xmr), di = 0.5f * (xki + xmi);
+			const float32_t wr = tw[2 * k], wi = -tw[2 * k + 1];
+			const float32_t or_ = dr * wr - di * wi, oi = dr * wi + di * wr;
+			// Z[k] = E + jO, Z[M-k] = conj(E) + j*conj(O)
+			pOut[2 * k] = er - oi;
+			pOut[2 * k + 1] = ei + or_;
+			if (mk != k)
+			{
+				pOut[2 * mk] = er + oi;
+				pOut[2 * mk + 1] = -ei + or_;
+			}
+		}
+		pOut[0] = 0.5f * (dc + ny);
+		pOut[1] = 0.5f * (dc - ny);
+		// inverse of the half length transform returns the even/odd samples
+		cfft(pOut, M, true, false);
+	}
+}
@@ -0,0 +1,125 @@
+/**
+ * @file wav_file.cpp
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Minimal WAV file reader/writer for the host simulator.
+ * @version 0.1
+ * @date 2024-03-01
+ */
+#include "wav_file.h"
+#include <stdio.h>
+#include <string.h>
+
+#define WAV_FORMAT_PCM			(1)
+#define WAV_FORMAT_FLOAT		(3)
+#define WAV_FORMAT_EXTENSIBLE	(0xFFFE)
+
+static uint32_t rd16(const uint8_t *p) { return p[0] | (p[1] << 8); }
+static uint32_t rd32(const uint8_t *p) { return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24); }
+static void wr16(uint8_t *p, uint32_t v) { p[0] = v; p[1] = v >> 8; }
+static void wr32(uint8_t *p, uint32_t v) { p[0] = v; p[1] = v >> 8; p[2] = v >> 16; p[3] = v >> 24; }
+
+static float decodeSample(const uint8_t *p, uint32_t format, uint32_t bits)
+{
+	if (format == WAV_FORMAT_FLOAT)
+	{
+		if (bits == 32)
+		{
+			float f;
+			memcpy(&f, p, 4);
+			return f;
+		}
+		double d;
+		memcpy(&d, p, 8);
+		return (float)d;
+	}
+	switch (bits)
+	{
+		case 16: return (float)(int16_t)rd16(p) / 32768.0f;
+		case 24: return (float)((int32_t)(((uint32_t)p[0] << 8) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 24)) >> 8) / 8388608.0f;
+		case 32: return (float)((double)(int32_t)rd32(p) / 2147483648.0);
+		default: return 0.0f;
+	}
+}
+
+bool wav_read(const char *path, std::vector<float> &left, std::vector<float> &right, float &sampleRate)
+{
+	FILE *f = fopen(path, "rb");
+	if (!f) return false;
+	std::vector<uint8_t> file;
+	uint8_t buf[4096];
+	size_t n;
+	while ((n = fread(buf, 1, sizeof(buf), f)) > 0) file.insert(file.end(), buf, buf + n);
+	fclose(f);
+
+	if (file.size() < 12 || memcmp(&file[0], "RIFF", 4) || memcmp(&file[8], "WAVE", 4)) return false;
+	uint32_t format = 0, channels = 0, bits = 0;
+	const uint8_t *data = NULL;
+	uint32_t dataSize = 0;
+	size_t pos = 12;
+	while (pos + 8 <= file.size())
+	{
+		const uint8_t *chunk = &file[pos];
+		uint32_t size = rd32(chunk + 4);
+		size_t avail = file.size() - pos - 8;
+		if (size > avail) size = avail;		// truncated file, use what is there
+		if (!memcmp(chunk, "fmt ", 4) && size >= 16)
+		{
+			format = rd16(chunk + 8);
+			channels = rd16(chunk + 10);
+			sampleRate = (float)rd32(chunk + 12);
+			bits = rd16(chunk + 22);
+			if (format == WAV_FORMAT_EXTENSIBLE && size >= 26) format = rd16(chunk + 32);
+		}
+		else if (!memcmp(chunk, "data", 4))
+		{
+			data = chunk + 8;
+			dataSize = size;
+		}
+		pos += 8 + size + (size & 1);
+	}
+	if (!data || !channels) return false;
+	if (!(format == WAV_FORMAT_PCM && (bits == 16 || bits == 24 || bits == 32))
+		&& !(format == WAV_FORMAT_FLOAT && (bits == 32 || bits == 64)))
+		return false;
+
+	const uint32_t bytes = bits / 8;
+	const uint32_t frames = dataSize / (bytes * channels);
+	left.resize(frames);
+	right.resize(frames);
+	for (uint32_t i = 0; i < frames; i++)
+	{
+		const uint8_t *frame = data + i * bytes * channels;
+		left[i] = decodeSample(frame, format, bits);
+		right[i] = channels > 1 ? decodeSample(frame + bytes, format, bits) : left[i];
+	}
+	return true;
+}
+
+bool wav_write(const char *path, const std::vector<float> &left, const std::vector<float> &right, float sampleRate)
+{
+	FILE *f = fopen(path, "wb");
+	if (!f) return false;
+	const uint32_t frames = left.size() < right.size() ? left.size() : right.size();
+	const uint32_t dataSize = frames * 2 * sizeof(float);
+	uint8_t hdr[44];
+	memcpy(hdr, "RIFF", 4);
+	wr32(hdr + 4, 36 + dataSize);
+	memcpy(hdr + 8, "WAVEfmt ", 8);
+	wr32(hdr + 16, 16);
+	wr16(hdr + 20, WAV_FORMAT_FLOAT);
+	wr16(hdr + 22, 2);
+	wr32(hdr + 24, (uint32_t)(sampleRate + 0.5f));
+	wr32(hdr + 28, (uint32_t)(sampleRate + 0.5f) * 2 * sizeof(float));
+	wr16(hdr + 32, 2 * sizeof(float));
+	wr16(hdr + 34, 32);
+	memcpy(hdr + 36, "data", 4);
+	wr32(hdr + 40, dataSize);
+	bool ok = fwrite(hdr, 1, sizeof(hdr), f) == sizeof(hdr);
+	for (uint32_t i = 0; i < frames && ok; i++)
+	{
+		float frame[2] = {left[i], right[i]};
+		ok = fwrite(frame, sizeof(float), 2, f) == 2;
+	}
+	fclose(f);
+	return ok;
+}
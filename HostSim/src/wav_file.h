@@ -0,0 +1,24 @@
+/**
+ * @file wav_file.h
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Minimal WAV file reader/writer for the host simulator.
+ * 		Reads 16/24/32bit PCM and 32/64bit float files, writes 32bit float.
+ * @version 0.1
+ * @date 2024-03-01
+ */
+#ifndef _WAV_FILE_H_
+#define _WAV_FILE_H_
+
+#include <stdint.h>
+#include <vector>
+
+/**
+ * @brief Read a WAV file, mono files are returned in both channels,
+ * 			only the first two channels of multichannel files are used
+ *
+ * @return false if the file can't be read or the format is not supported
+ */
+bool wav_read(const char *path, std::vector<float> &left, std::vector<float> &right, float &sampleRate);
+bool wav_write(const char *path, const std::vector<float> &left, const std::vector<float> &right, float sampleRate);
+
+#endif // _WAV_FILE_H_
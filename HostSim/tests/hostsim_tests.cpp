@@ -0,0 +1,1500 @@
+/**
+ * @file hostsim_tests.cpp
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Checks of the host simulator: block reference counting,
+ * 		CMSIS-DSP stand-ins against reference implementations, WAV I/O,
+ * 		and of the in-tree audio objects running on it.
+ * @version 0.1
+ * @date 2024-03-01
+ */
+#include <Arduino.h>
+#include <complex>
+#include <vector>
+#include <thread>
+#include <string>
+#include "AudioStream_F32.h"
+#include "HostSim.h"
+#include "../src/wav_file.h"
+#include "AudioChain_F32.h"
+#include "AudioProfiler_F32.h"
+#include "AudioParamQueue_F32.h"
+#include "AudioTasks_F32.h"
+#include "AudioFilterIRConvolver_F32.h"
+#include "IRLoader_F32.h"
+#include "IRTrim_F32.h"
+#include "AudioFilterToneStackAnalog_F32.h"
+#include "AudioFilterCabEQ_F32.h"
+#include "BiquadStereo_F32.h"
+#include "AudioEffectPlateDattorro_F32.h"
+#include "DelayMemory_F32.h"
+#include <SD.h>
+#include "RTNeural_F32.h"
+#include "HostRender.h"
+#include "HostRT.h"
+#include <mutex>
+#include <unistd.h>
+
+class TestSource_F32 : public AudioStream_F32
+{
+public:
+	TestSource_F32() : AudioStream_F32(0, NULL) {}
+	void update(void)
+	{
+		audio_block_f32_t *block = allocate_f32();
+		if (!block) return;
+		for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++) block->data[i] = (float32_t)i;
+		transmit(block, 0);
+		release(block);
+	}
+};
+
+class TestSink_F32 : public AudioStream_F32
+{
+public:
+	TestSink_F32(bool writable) : AudioStream_F32(1, inputQueueArray), writable(writable) {}
+	void update(void)
+	{
+		audio_block_f32_t *block = writable ? receiveWritable_f32(0) : receiveReadOnly_f32(0);
+		if (!block) return;
+		if (writable) block->data[0] = -1.0f;
+		first = block->data[0];
+		last = block->data[AUDIO_BLOCK_SAMPLES - 1];
+		release(block);
+	}
+	float32_t first = 0.0f, last = 0.0f;
+private:
+	audio_block_f32_t *inputQueueArray[1];
+	bool writable;
+};
+
+TestSource_F32 source;
+TestSink_F32 sinkRW(true);	// updated first, has to copy the shared block
+TestSink_F32 sinkRO(false);
+AudioConnection_F32 cable0(source, 0, sinkRW, 0);
+AudioConnection_F32 cable1(source, 0, sinkRO, 0);
+
+// connected by the test, inactive until then
+class TestStage_F32 : public AudioChainStage_F32
+{
+public:
+	TestStage_F32(float32_t gain, float32_t offset) : gain(gain), offset(offset) {}
+	void processBlock(float32_t *L, float32_t *R, uint16_t len) override
+	{
+		for (uint16_t i = 0; i < len; i++)
+		{
+			L[i] = L[i] * gain + offset;
+			R[i] = R[i] * gain - offset;
+		}
+	}
+private:
+	float32_t gain, offset;
+};
+// feedback echo, decays after the input stops
+class TestDecay_F32 : public AudioChainStage_F32
+{
+public:
+	void processBlock(float32_t *L, float32_t *R, uint16_t len) override
+	{
+		for (uint16_t i = 0; i < len; i++)
+		{
+			state = L[i] * 0.001f + state * 0.99f;
+			L[i] += state;
+			R[i] += state;
+		}
+	}
+	float32_t state = 0.0f;
+};
+// sparse echo: an impulse when fired, repeats every 3 blocks at half the level
+class TestEcho_F32 : public AudioChainStage_F32
+{
+public:
+	void processBlock(float32_t *L, float32_t *R, uint16_t len) override
+	{
+		for (uint16_t i = 0; i < len; i++)
+		{
+			const float32_t y = buf[pos];
+			buf[pos] = (fire && i == len - 1 ? 1.0f : 0.0f) + 0.5f * y;
+			pos = (pos + 1) % (3 * AUDIO_BLOCK_SAMPLES);
+			L[i] += y;
+			R[i] += y;
+		}
+		fire = false;
+	}
+	bool fire = false;
+	float32_t buf[3 * AUDIO_BLOCK_SAMPLES] = {};
+	uint32_t pos = 0;
+};
+TestSource_F32 chainSource;
+AudioChain_F32 chain;
+TestSink_F32 chainSinkL(false);
+TestSink_F32 chainSinkR(false);
+TestStage_F32 stageScale(2.0f, 0.0f);
+TestStage_F32 stageOffset(1.0f, 1.0f);
+TestDecay_F32 stageDecay;
+TestEcho_F32 stageEcho;
+
+// busy for a set part of the block period
+class TestLoad_F32 : public AudioStream_F32
+{
+public:
+	TestLoad_F32() : AudioStream_F32(0, NULL) { active = true; }
+	void update(void)
+	{
+		const uint32_t ns = (uint32_t)(load * 1.0e7f * AUDIO_BLOCK_SAMPLES / AUDIO_SAMPLE_RATE_EXACT);
+		uint32_t t0 = ARM_DWT_CYCCNT;
+		while (ARM_DWT_CYCCNT - t0 < ns);
+	}
+	float32_t load = 0.0f;
+};
+TestLoad_F32 loadLight;
+TestLoad_F32 loadHeavy;
+AudioEffectRTNeural_F32 amp;	// run by the test with processBlock()
+AudioProfiler_F32 profiler;		// last object, reads the loads of the current cycle
+
+static int checkBlocks()
+{
+	AudioMemory_F32(4);
+	for (int i = 0; i < 3; i++) HostSim::processBlock();
+	if (sinkRW.first != -1.0f || sinkRO.first != 0.0f || sinkRO.last != (float32_t)(AUDIO_BLOCK_SAMPLES - 1))
+	{
+		printf("  FAIL: writable block not copied from the shared one!\n");
+		return 1;
+	}
+	if (AudioMemoryUsage_F32() != 0 || AudioMemoryUsageMax_F32() != 2)
+	{
+		printf("  FAIL: block memory used %u max %u, expected 0 and 2\n", AudioMemoryUsage_F32(), AudioMemoryUsageMax_F32());
+		return 1;
+	}
+	return 0;
+}
+
+static int checkPool()
+{
+	// the source takes the only block, the writable sink can't get its copy
+	AudioMemory_F32(1);
+	const uint32_t failures = sinkRW.hostStats().alloc_failures;
+	HostSim::processBlock();
+	if (sinkRW.hostStats().alloc_failures == failures || sinkRO.hostStats().alloc_failures != 0
+		|| source.hostStats().pool_peak < 1)
+	{
+		printf("  FAIL: allocation failure not attributed to the object\n");
+		return 1;
+	}
+
+	// lock-free allocator used from several threads
+	AudioMemory_F32(64);
+	bool collision = false;
+	auto worker = [&collision](float32_t tag)
+	{
+		for (int i = 0; i < 20000; i++)
+		{
+			audio_block_f32_t *b = AudioStream_F32::allocate_f32();
+			if (!b) continue;
+			b->data[0] = tag;
+			if (i & 1) std::this_thread::yield();
+			if (b->data[0] != tag) collision = true;
+			AudioStream_F32::release(b);
+		}
+	};
+	std::vector<std::thread> threads;
+	for (int t = 0; t < 4; t++) threads.emplace_back(worker, (float32_t)t);
+	for (std::thread &t : threads) t.join();
+	if (collision || AudioMemoryUsage_F32() != 0)
+	{
+		printf("  FAIL: concurrent allocation, block shared %d, %u blocks not released\n", collision, AudioMemoryUsage_F32());
+		return 1;
+	}
+	AudioMemory_F32(4);
+	return 0;
+}
+
+static int checkChain()
+{
+	AudioConnection_F32 c0(chainSource, 0, chain, 0);
+	AudioConnection_F32 c1(chainSource, 0, chain, 1);
+	AudioConnection_F32 c2(chain, 0, chainSinkL, 0);
+	AudioConnection_F32 c3(chain, 1, chainSinkR, 0);
+	const float32_t x = (float32_t)(AUDIO_BLOCK_SAMPLES - 1);
+
+	chain.add(stageScale);
+	chain.add(stageOffset);
+	HostSim::processBlock();
+	if (chainSinkL.last != 2.0f * x + 1.0f || chainSinkR.last != 2.0f * x - 1.0f)
+	{
+		printf("  FAIL: chain output %f %f, expected %f %f\n", chainSinkL.last, chainSinkR.last, 2.0f * x + 1.0f, 2.0f * x - 1.0f);
+		return 1;
+	}
+	chain.move(1, 0);
+	HostSim::processBlock();
+	if (chainSinkL.last != 2.0f * (x + 1.0f) || chain.get(0) != &stageOffset)
+	{
+		printf("  FAIL: chain order not changed\n");
+		return 1;
+	}
+	chain.remove(0);
+	chain.bypass_set(true);
+	HostSim::processBlock();
+	if (chain.size() != 1 || chainSinkL.last != x)
+	{
+		printf("  FAIL: chain bypass\n");
+		return 1;
+	}
+	if (AudioMemoryUsage_F32() != 0)
+	{
+		printf("  FAIL: chain leaks audio blocks\n");
+		return 1;
+	}
+	return 0;
+}
+
+static int checkChainBypass()
+{
+	AudioConnection_F32 c0(chainSource, 0, chain, 0);
+	AudioConnection_F32 c1(chainSource, 0, chain, 1);
+	AudioConnection_F32 c2(chain, 0, chainSinkL, 0);
+	AudioConnection_F32 c3(chain, 1, chainSinkR, 0);
+	const float32_t x = (float32_t)(AUDIO_BLOCK_SAMPLES - 1);
+
+	chain.clear();
+	chain.bypass_set(false);
+	chain.add(stageScale);
+	chain.add(stageDecay);
+	chain.stageTail(1, true);
+	for (int i = 0; i < 4; i++) HostSim::processBlock();
+	// disabled, no tail: not run at all
+	chain.stageEnable(0, false);
+	HostSim::processBlock();
+	if (chain.stageRunning(0) || chainSinkR.last < x + 1.0f || chainSinkR.last > 2.0f * x)
+	{
+		printf("  FAIL: disabled chain stage still processed\n");
+		return 1;
+	}
+	// tail mode: runs until the echo decays, then the chain passes through
+	chain.stageEnable(1, false);
+	int blocks = 0;
+	while (chain.stageRunning(1) && blocks < 1000)
+	{
+		HostSim::processBlock();
+		blocks++;
+	}
+	const float32_t state = stageDecay.state;
+	HostSim::processBlock();
+	if (blocks < 2 || blocks >= 1000 || chainSinkL.last != x || stageDecay.state != state)
+	{
+		printf("  FAIL: chain stage tail, stopped after %d blocks, output %f\n", blocks, chainSinkL.last);
+		return 1;
+	}
+	chain.stageEnable(0, true);
+	HostSim::processBlock();
+	if (!chain.stageRunning(0) || chainSinkL.last != 2.0f * x)
+	{
+		printf("  FAIL: chain stage not enabled again\n");
+		return 1;
+	}
+	// a disabled amp stage keeps taking its settings, the queue does not fill up
+	chain.add(amp);
+	chain.stageEnable(2, false);
+	bool posted = true;
+	for (int i = 0; i < 2 * NEURAL_AMP_EVENT_QUEUE; i++)
+	{
+		posted = posted && amp.gain(i & 1 ? 0.5f : 0.75f);
+		HostSim::processBlock();
+	}
+	if (!posted || amp.getGain() != 0.5f)
+	{
+		printf("  FAIL: disabled amp stage gain %f, queue full %d\n", amp.getGain(), !posted);
+		return 1;
+	}
+	amp.gain(1.0f);
+	HostSim::processBlock();
+	chain.clear();
+	return 0;
+}
+
+static int checkChainTail()
+{
+	AudioConnection_F32 c0(chainSource, 0, chain, 0);
+	AudioConnection_F32 c1(chainSource, 0, chain, 1);
+	AudioConnection_F32 c2(chain, 0, chainSinkL, 0);
+	AudioConnection_F32 c3(chain, 1, chainSinkR, 0);
+	const float32_t x = (float32_t)(AUDIO_BLOCK_SAMPLES - 1);
+	const float32_t blockMs = 1000.0f * AUDIO_BLOCK_SAMPLES / AUDIO_SAMPLE_RATE_EXACT;
+
+	// the echoes come after 2 silent blocks, the hold covers the gap
+	chain.clear();
+	chain.bypass_set(false);
+	chain.add(stageEcho);
+	chain.stageTail(0, true, AUDIO_CHAIN_TAIL_THRESHOLD, 4.0f * blockMs);
+	chain.stageEnable(0, false);
+	stageEcho.fire = true;
+	int blocks = 0, echoes = 0;
+	while (chain.stageRunning(0) && blocks < 1000)
+	{
+		HostSim::processBlock();
+		if (chainSinkL.last != x) echoes++;
+		blocks++;
+	}
+	// 0.5^14 is above -90dB
+	if (echoes < 14 || blocks >= 1000)
+	{
+		printf("  FAIL: chain echo tail stopped after %d blocks, %d echoes\n", blocks, echoes);
+		return 1;
+	}
+	chain.clear();
+	return 0;
+}
+
+static int checkProfiler()
+{
+	AudioProfiler_F32::stats_t light, heavy, graph;
+	profiler.add(loadLight, "light");
+	profiler.add(loadHeavy, "heavy");
+	profiler.setOverrunThreshold(50.0f);
+	// host timing has some jitter (preemption), the busy loops only set
+	// the lower bound of the loads, the run is repeated if disturbed
+	for (int attempt = 0; attempt < 5; attempt++)
+	{
+		profiler.reset();
+		loadLight.load = 5.0f;
+		for (int i = 0; i < 200; i++)
+		{
+			loadHeavy.load = i == 100 ? 60.0f : 1.0f;
+			HostSim::processBlock();
+		}
+		profiler.getStats(0, light);
+		profiler.getStats(1, heavy);
+		profiler.getStats(2, graph);
+		if (light.blocks != 200 || light.p50 < 5.0f || heavy.max < 60.0f || graph.max < 65.0f)
+		{
+			printf("  FAIL: profiler p50 light %.2f max heavy %.2f graph %.2f\n", light.p50, heavy.max, graph.max);
+			return 1;
+		}
+		// the spike is counted and attributed, the slowest block breakdown kept
+		if (light.p50 < 10.0f && heavy.p50 < 5.0f && profiler.getOverruns() == 1
+			&& heavy.overruns == 1 && heavy.worst >= 60.0f && light.worst >= 5.0f)
+			break;
+		if (attempt == 4)
+		{
+			printf("  FAIL: profiler overruns %u heavy %u, slowest block heavy %.2f light %.2f\n",
+				   profiler.getOverruns(), heavy.overruns, heavy.worst, light.worst);
+			return 1;
+		}
+	}
+	loadLight.load = 0.0f;
+	loadHeavy.load = 0.0f;
+	return 0;
+}
+
+static int checkParamQueue()
+{
+	AudioParamQueue_F32<4> q;
+	audio_param_event_t e;
+	const uint32_t t = q.now();
+	bool ok = q.post(1, 0.5f) && q.post(2, 1.0f, t + 10) && q.post(3, 2.0f, t + 40) && q.post(4, 3.0f);
+	ok = ok && !q.post(5, 0.0f);	// full
+	// block 0..31: now and +10 due, +40 waits for the next block, order kept
+	ok = ok && q.pop(e, 32) && e.id == 1 && e.time == 0;
+	ok = ok && q.pop(e, 32) && e.id == 2 && e.time == 10;
+	ok = ok && !q.pop(e, 32);
+	q.advance(32);
+	ok = ok && q.now() == t + 32 && q.pop(e, 32) && e.id == 3 && e.time == 8;
+	ok = ok && q.pop(e, 32) && e.id == 4 && e.time == 0 && !q.pop(e, 32);
+	if (!ok)
+	{
+		printf("  FAIL: parameter queue order or timing\n");
+		return 1;
+	}
+	AudioParamRamp_F32 ramp(0.0f, 4);
+	ramp.set(1.0f);
+	float32_t v[5];
+	for (int i = 0; i < 5; i++) v[i] = ramp.next();
+	if (v[0] != 0.25f || v[1] != 0.5f || v[3] != 1.0f || v[4] != 1.0f || ramp.isRamping())
+	{
+		printf("  FAIL: parameter ramp %f %f %f %f\n", v[0], v[1], v[3], v[4]);
+		return 1;
+	}
+
+	// amp settings are applied by the audio update, at the block start
+	float32_t L[AUDIO_BLOCK_SAMPLES], R[AUDIO_BLOCK_SAMPLES];
+	for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++) L[i] = R[i] = 0.1f * sinf(0.1f * i);
+	amp.changeModel(0);
+	amp.oversample(2);
+	if (amp.getOversample() != 1)
+	{
+		printf("  FAIL: amp setting applied outside the audio update\n");
+		return 1;
+	}
+	amp.processBlock(L, R, AUDIO_BLOCK_SAMPLES);
+	if (amp.getOversample() != 2 || L[5] != 0.1f * sinf(0.5f))
+	{
+		printf("  FAIL: amp oversampling %d, bypass output %f\n", amp.getOversample(), L[5]);
+		return 1;
+	}
+	amp.changeModel(2);
+	amp.processBlock(L, R, AUDIO_BLOCK_SAMPLES);
+	if (amp.getModel() != 2 || L[5] == 0.1f * sinf(0.5f))
+	{
+		printf("  FAIL: amp model %d not changed\n", amp.getModel());
+		return 1;
+	}
+	// gain changed while bypassed, in effect when the model is back
+	amp.changeModel(0);
+	amp.processBlock(L, R, AUDIO_BLOCK_SAMPLES);
+	amp.gain(0.25f);
+	amp.processBlock(L, R, AUDIO_BLOCK_SAMPLES);
+	amp.changeModel(2);
+	amp.processBlock(L, R, AUDIO_BLOCK_SAMPLES);
+	const float32_t g = amp.getGain();
+	amp.gain(1.0f);
+	amp.processBlock(L, R, AUDIO_BLOCK_SAMPLES);
+	if (g != 0.25f || amp.getGain() != 1.0f)
+	{
+		printf("  FAIL: amp gain %f after a change in bypass\n", g);
+		return 1;
+	}
+	return 0;
+}
+
+static int checkRender()
+{
+	// stateful stages, the result depends on the block order of every stage
+	const uint32_t tracks = 5, stages = 3;
+	std::vector<TestDecay_F32> decays(tracks * 2), refDecays(tracks * 2);
+	TestStage_F32 scale(2.0f, 0.5f);		// no state, shared by the tracks
+	std::vector<HostRenderTrack> tr(tracks);
+	std::vector<HostRenderTrack *> list;
+	std::vector<std::vector<float32_t>> refL(tracks), refR(tracks);
+	for (uint32_t t = 0; t < tracks; t++)
+	{
+		const uint32_t len = 1000 + 777 * t;	// short last block
+		tr[t].L.resize(len);
+		tr[t].R.resize(len);
+		for (uint32_t i = 0; i < len; i++)
+		{
+			tr[t].L[i] = sinf(0.01f * i * (t + 1));
+			tr[t].R[i] = cosf(0.02f * i);
+		}
+		refL[t] = tr[t].L;
+		refR[t] = tr[t].R;
+		tr[t].stages = {&decays[2 * t], &scale, &decays[2 * t + 1]};
+		list.push_back(&tr[t]);
+		for (uint32_t pos = 0; pos < len; pos += 32)
+		{
+			const uint16_t n = std::min<uint32_t>(32, len - pos);
+			refDecays[2 * t].processBlock(&refL[t][pos], &refR[t][pos], n);
+			scale.processBlock(&refL[t][pos], &refR[t][pos], n);
+			refDecays[2 * t + 1].processBlock(&refL[t][pos], &refR[t][pos], n);
+		}
+	}
+	HostRender::run(list, 4, 32);
+	for (uint32_t t = 0; t < tracks; t++)
+	{
+		if (tr[t].L != refL[t] || tr[t].R != refR[t] || tr[t].stages.size() != stages)
+		{
+			printf("  FAIL: multi threaded render of track %u differs from the serial one\n", t);
+			return 1;
+		}
+	}
+	return 0;
+}
+
+static int checkTrap()
+{
+	HostRT::trapReset();
+	HostRT::trapArm(true);
+	std::vector<float32_t> *v = new std::vector<float32_t>(64);
+	delete v;
+	std::mutex m;
+	m.lock();
+	m.unlock();
+	HostRT::trapArm(false);
+	if (HostRT::trapCount(HostRT::TRAP_ALLOC) != 2 || HostRT::trapCount(HostRT::TRAP_FREE) != 2 ||
+		HostRT::trapCount(HostRT::TRAP_LOCK) != 1)
+	{
+		printf("  FAIL: allocation trap counted %u allocations, %u frees, %u locks\n", HostRT::trapCount(HostRT::TRAP_ALLOC),
+			   HostRT::trapCount(HostRT::TRAP_FREE), HostRT::trapCount(HostRT::TRAP_LOCK));
+		return 1;
+	}
+	// the amp model and oversampling changes are applied in the audio update
+	AudioEffectRTNeural_F32 amp;
+	float32_t L[AUDIO_BLOCK_SAMPLES], R[AUDIO_BLOCK_SAMPLES];
+	HostRT::trapReset();
+	for (uint8_t model = 1; model <= amp.getModelCount(); model++)
+	{
+		amp.changeModel(model);
+		amp.oversample(model & 1 ? 4 : 2);
+		amp.gain(0.5f);
+		for (int b = 0; b < 2; b++)
+		{
+			for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++) L[i] = R[i] = 0.3f * sinf(0.05f * i);
+			HostRT::trapArm(true);
+			amp.processBlock(L, R, AUDIO_BLOCK_SAMPLES);
+			HostRT::trapArm(false);
+		}
+	}
+	if (HostRT::trapTotal())
+	{
+		printf("  FAIL: the amp allocates or locks in the audio update:\n");
+		HostRT::trapReport(stdout);
+		return 1;
+	}
+	HostRT::trapReset();
+	return 0;
+}
+
+class TestTask_F32 : public AudioTask_F32
+{
+public:
+	TestTask_F32(char id, uint8_t steps, std::string &log, bool *gate = NULL) : id(id), left(steps), log(log), gate(gate) {}
+	state_t step() override
+	{
+		if (gate && !*gate) return TASK_WAIT;
+		log += id;
+		return --left ? TASK_CONTINUE : TASK_DONE;
+	}
+private:
+	char id;
+	uint8_t left;
+	std::string &log;
+	bool *gate;
+};
+
+static void testTaskDone(AudioTask_F32 &task, void *ctx)
+{
+	(void)task;
+	(*(uint32_t *)ctx)++;
+}
+
+static int checkTasks()
+{
+	AudioTaskScheduler_F32 tasks;
+	std::string log;
+	bool open = false;
+	uint32_t done = 0;
+	TestTask_F32 a('a', 2, log), b('b', 2, log), c('c', 3, log), w('w', 1, log, &open);
+	tasks.post(a, AudioTaskScheduler_F32::PRIO_LOW, testTaskDone, &done);
+	tasks.post(w, AudioTaskScheduler_F32::PRIO_HIGH, testTaskDone, &done);
+	tasks.post(b, AudioTaskScheduler_F32::PRIO_NORMAL, testTaskDone, &done);
+	tasks.post(c, AudioTaskScheduler_F32::PRIO_NORMAL, testTaskDone, &done);
+	tasks.run(100000);
+	// w waits for the "audio update", the others run by priority, FIFO within a priority
+	if (log != "bbcccaa" || done != 3 || tasks.pending() != 1)
+	{
+		printf("  FAIL: task order %s, %u done, %u pending\n", log.c_str(), done, tasks.pending());
+		return 1;
+	}
+	open = true;
+	tasks.run(100000);
+	if (log != "bbcccaaw" || done != 4 || tasks.pending() != 0 || w.getSteps() != 2)
+	{
+		printf("  FAIL: waiting task not resumed: %s\n", log.c_str());
+		return 1;
+	}
+
+	AudioPublished_F32<uint32_t> pub;
+	uint32_t *v = pub.edit();
+	*v = 5;
+	pub.publish();
+	if (pub.edit() != NULL || *pub.acquire() != 5 || pub.edit() == NULL || pub.edit() == pub.current())
+	{
+		printf("  FAIL: published buffer reused before the consumer took the new one\n");
+		return 1;
+	}
+
+	// background model loading gives the same output as the loading in the audio update
+	AudioEffectRTNeural_F32 ampIsr, ampTask;
+	ampTask.setTaskScheduler(tasks);
+	const uint8_t models[] = {3, 3, 5, 0, 2, 7, 7, 1};
+	float32_t L1[AUDIO_BLOCK_SAMPLES], R1[AUDIO_BLOCK_SAMPLES], L2[AUDIO_BLOCK_SAMPLES], R2[AUDIO_BLOCK_SAMPLES];
+	for (uint32_t b = 0; b < 3 * sizeof(models); b++)
+	{
+		if (b % 3 == 0)
+		{
+			const uint8_t m = models[b / 3] % (ampIsr.getModelCount() + 1);
+			ampIsr.changeModel(m);
+			ampTask.changeModel(m);
+			if (b == 9)
+			{
+				ampIsr.oversample(2);
+				ampTask.oversample(2);
+			}
+			tasks.run(100000);
+		}
+		for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++) L1[i] = R1[i] = L2[i] = R2[i] = 0.4f * sinf(0.03f * (b * AUDIO_BLOCK_SAMPLES + i));
+		ampIsr.processBlock(L1, R1, AUDIO_BLOCK_SAMPLES);
+		ampTask.processBlock(L2, R2, AUDIO_BLOCK_SAMPLES);
+		if (memcmp(L1, L2, sizeof(L1)) || ampIsr.getModel() != ampTask.getModel() || ampTask.modelPending())
+		{
+			printf("  FAIL: amp with background model loading differs in block %u\n", b);
+			return 1;
+		}
+	}
+	return 0;
+}
+
+static int checkConvolver()
+{
+	// IR spanning all the levels, against the direct convolution
+	const uint32_t irLen = 6000, len = 64 * AUDIO_BLOCK_SAMPLES;
+	std::vector<float32_t> ir(irLen), irR(irLen), inL(len), inR(len);
+	srand(7);
+	for (uint32_t i = 0; i < irLen; i++) ir[i] = ((float32_t)rand() / RAND_MAX - 0.5f) * expf(-(float32_t)i / 1500.0f);
+	for (uint32_t i = 0; i < irLen; i++) irR[i] = ((float32_t)rand() / RAND_MAX - 0.5f) * expf(-(float32_t)i / 1000.0f);
+	for (uint32_t i = 0; i < len; i++)
+	{
+		inL[i] = (float32_t)rand() / RAND_MAX - 0.5f;
+		inR[i] = i == 37 ? 1.0f : 0.0f;
+	}
+	// packed stereo FFTs, uniform, separate real FFTs, separate IRs for L and R
+	const uint16_t partMax[4] = {IR_CONV_PART_MAX, AUDIO_BLOCK_SAMPLES, IR_CONV_PART_MAX, IR_CONV_PART_MAX};
+	for (uint8_t mode = 0; mode < 4; mode++)
+	{
+		AudioFilterIRConvolver_F32 *conv = new AudioFilterIRConvolver_F32();
+		conv->packing_set(mode != 2);
+		const bool loaded = mode == 3 ? conv->load(ir.data(), irR.data(), irLen, partMax[mode]) : conv->load(ir.data(), irLen, partMax[mode]);
+		if (!loaded || conv->getIR().getLevels() != (mode == 1 ? 1 : 5) || conv->isStereo() != (mode == 3))
+		{
+			printf("  FAIL: convolver IR preparation, %u levels\n", conv->getIR().getLevels());
+			return 1;
+		}
+		const std::vector<float32_t> &hR = mode == 3 ? irR : ir;
+		std::vector<float32_t> L = inL, R = inR;
+		for (uint32_t b = 0; b < len; b += AUDIO_BLOCK_SAMPLES)
+			conv->processBlock(&L[b], &R[b], AUDIO_BLOCK_SAMPLES);
+		delete conv;
+		double err = 0.0;
+		for (uint32_t n = 0; n < len; n++)
+		{
+			double y = 0.0;
+			for (uint32_t k = 0; k < irLen && k <= n; k++) y += (double)ir[k] * inL[n - k];
+			err = std::max(err, fabs(y - L[n]));
+			// impulse response, no added latency
+			err = std::max(err, (double)fabsf((n >= 37 && n < irLen + 37 ? hR[n - 37] : 0.0f) - R[n]));
+		}
+		if (err > 1e-4)
+		{
+			printf("  FAIL: convolver output (max partition %u, mode %u) differs by %g\n", partMax[mode], mode, err);
+			return 1;
+		}
+	}
+	return 0;
+}
+
+static int checkCabEQ()
+{
+	// baked EQ against the convolver followed by the live tone stack
+	const uint32_t irLen = 3000;
+	std::vector<float32_t> ir(irLen);
+	srand(13);
+	for (uint32_t i = 0; i < irLen; i++) ir[i] = ((float32_t)rand() / RAND_MAX - 0.5f) * expf(-(float32_t)i / 300.0f);
+	AudioFilterIRConvolver_F32 *refCab = new AudioFilterIRConvolver_F32(), *cab = new AudioFilterIRConvolver_F32();
+	AudioFilterToneStackAnalog_F32 refEq, eq;
+	AudioFilterCabEQ_F32 *cabEq = new AudioFilterCabEQ_F32(*cab, eq);
+	AudioTaskScheduler_F32 tasks;
+	refEq.setTone(0.3f, 0.7f, 0.8f);
+	eq.setTone(0.3f, 0.7f, 0.8f);
+	refCab->load(ir.data(), irLen);
+	cabEq->load(ir.data(), irLen);
+	cabEq->bake_set(true);
+	cabEq->setSettleTime(50);
+	tasks.post(*cabEq);
+	int result = 0;
+	float32_t L[AUDIO_BLOCK_SAMPLES], R[AUDIO_BLOCK_SAMPLES], rL[AUDIO_BLOCK_SAMPLES], rR[AUDIO_BLOCK_SAMPLES];
+	// phases: 0 live until baked, 1 baked, 2 baking off: live, 3 knob moved, baking on: live until baked, 4 baked
+	// the switches crossfade the EQ'd plain IR and the baked one, every block is checked
+	double err[5] = {0.0, 0.0, 0.0, 0.0, 0.0}, errSwitch = 0.0, peak = 0.0;
+	uint8_t phase = 0;
+	uint32_t phaseBlocks = 0, switchBlocks = 0;
+	for (uint32_t b = 0; b < 3000 && phase < 5; b++)
+	{
+		for (uint32_t i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+		{
+			rL[i] = L[i] = (float32_t)rand() / RAND_MAX - 0.5f;
+			rR[i] = R[i] = (float32_t)rand() / RAND_MAX - 0.5f;
+		}
+		refCab->processBlock(rL, rR, AUDIO_BLOCK_SAMPLES);
+		refEq.processBlock(rL, rR, AUDIO_BLOCK_SAMPLES);
+		const bool switching = !cab->exchangeDone();
+		cabEq->processBlock(L, R, AUDIO_BLOCK_SAMPLES);
+		tasks.run(1000000);
+		phaseBlocks++;
+		double e = 0.0;
+		for (uint32_t i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+		{
+			e = std::max(e, (double)std::max(fabsf(L[i] - rL[i]), fabsf(R[i] - rR[i])));
+			peak = std::max(peak, (double)fabsf(rL[i]));
+		}
+		if (switching || !cab->exchangeDone())
+		{
+			errSwitch = std::max(errSwitch, e);
+			switchBlocks++;
+		}
+		// the live EQ settles after a knob change and after it restarted with its old state
+		else if (phaseBlocks > 64) err[phase] = std::max(err[phase], e);
+		const bool next = phase == 0 || phase == 3 ? cabEq->isBaked() :
+						  phase == 2 ? !cabEq->isBaked() && phaseBlocks > 200 : phaseBlocks > 200;
+		if (next)
+		{
+			if (phase == 1) cabEq->bake_set(false);
+			if (phase == 2)
+			{
+				refEq.setBass(0.9f);
+				eq.setBass(0.9f);
+				cabEq->bake_set(true);
+			}
+			phase++;
+			phaseBlocks = 0;
+		}
+	}
+	const uint32_t bakes = cabEq->getBakeCount();
+	delete cabEq;
+	delete cab;
+	delete refCab;
+	if (phase < 5 || bakes != 2 || switchBlocks < 3 * IR_CONV_XFADE_MS * AUDIO_SAMPLE_RATE_EXACT / 1000.0f / AUDIO_BLOCK_SAMPLES)
+	{
+		printf("  FAIL: baked EQ not switched, phase %u, %u bakes, %u blocks switching\n", phase, bakes, switchBlocks);
+		return 1;
+	}
+	for (uint8_t p = 0; p < 5; p++)
+	{
+		// live: same arithmetic, baked: the EQ response after the IR end is cut
+		const bool live = p == 0 || p == 2 || p == 3;
+		if (err[p] > (live ? 1e-5 : 2e-3) * peak)
+		{
+			printf("  FAIL: baked EQ phase %u differs by %g (peak %g)\n", p, err[p], peak);
+			result = 1;
+		}
+	}
+	if (errSwitch > 2e-3 * peak)
+	{
+		printf("  FAIL: baked EQ switch differs by %g (peak %g)\n", errSwitch, peak);
+		result = 1;
+	}
+	return result;
+}
+
+static float32_t blockRms(const float32_t *x)
+{
+	float32_t sum = 0.0f;
+	for (uint32_t i = 0; i < AUDIO_BLOCK_SAMPLES; i++) sum += x[i] * x[i];
+	return sqrtf(sum / AUDIO_BLOCK_SAMPLES);
+}
+
+static int checkCrossfade()
+{
+	// IR change while playing: the loader task prepares the new IR, both run for the fade time
+	char dir[] = "/tmp/hostsim_xfXXXXXX";
+	if (!mkdtemp(dir)) return 1;
+	SD.setRoot(dir);
+	const uint32_t lenA = 6000, lenB = 2500;
+	std::vector<float> irA(lenA), irB(lenB);
+	srand(17);
+	for (uint32_t i = 0; i < lenA; i++) irA[i] = ((float)rand() / RAND_MAX - 0.5f) * expf(-(float)i / 1500.0f);
+	for (uint32_t i = 0; i < lenB; i++) irB[i] = ((float)rand() / RAND_MAX - 0.5f) * expf(-(float)i / 300.0f);
+	wav_write((std::string(dir) + "/b.wav").c_str(), irB, irB, AUDIO_SAMPLE_RATE_EXACT);
+	AudioFilterIRConvolver_F32 *conv = new AudioFilterIRConvolver_F32(), *refA = new AudioFilterIRConvolver_F32(),
+							   *refB = new AudioFilterIRConvolver_F32();
+	conv->load(irA.data(), lenA);
+	refA->load(irA.data(), lenA);
+	refB->load(irB.data(), lenB);
+	IRLoader_F32 loader(SD);
+	IRLoader_F32::options_t opt;
+	opt.normalize = IRLoader_F32::NORM_NONE;
+	opt.cache = false;
+	IRPartitions_F32 parts;
+	AudioTaskScheduler_F32 tasks;
+	SD.begin();
+	loader.start("/b.wav", parts, opt);
+	tasks.post(loader);
+	int result = 0;
+	const uint32_t fadeBlocks = ((uint32_t)(20.0f * AUDIO_SAMPLE_RATE_EXACT / 1000.0f) + AUDIO_BLOCK_SAMPLES - 1) / AUDIO_BLOCK_SAMPLES;
+	uint32_t loadSteps = 0, fading = 0, after = 0;
+	double errA = 0.0, errB = 0.0, gap = 1e9;
+	float32_t L[AUDIO_BLOCK_SAMPLES], R[AUDIO_BLOCK_SAMPLES], aL[AUDIO_BLOCK_SAMPLES], aR[AUDIO_BLOCK_SAMPLES];
+	float32_t bL[AUDIO_BLOCK_SAMPLES], bR[AUDIO_BLOCK_SAMPLES];
+	for (uint32_t b = 0; b < 200; b++)
+	{
+		for (uint32_t i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+		{
+			L[i] = aL[i] = bL[i] = (float32_t)rand() / RAND_MAX - 0.5f;
+			R[i] = aR[i] = bR[i] = (float32_t)rand() / RAND_MAX - 0.5f;
+		}
+		const bool fade = conv->isFading();
+		conv->processBlock(L, R, AUDIO_BLOCK_SAMPLES);
+		refA->processBlock(aL, aR, AUDIO_BLOCK_SAMPLES);
+		refB->processBlock(bL, bR, AUDIO_BLOCK_SAMPLES);
+		if (fade)
+		{
+			fading++;
+			// no muted gap: the sum of the two uncorrelated outputs keeps at least 1/sqrt(2) of the level
+			gap = std::min(gap, (double)(blockRms(L) / std::min(blockRms(aL), blockRms(bL))));
+		}
+		else if (!loadSteps)
+		{
+			for (uint32_t i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+				errA = std::max(errA, (double)std::max(fabsf(L[i] - aL[i]), fabsf(R[i] - aR[i])));
+		}
+		else if (conv->crossfadeDone() && ++after > lenB / AUDIO_BLOCK_SAMPLES + 1)
+		{
+			// the new delay lines are filled
+			for (uint32_t i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+				errB = std::max(errB, (double)std::max(fabsf(L[i] - bL[i]), fabsf(R[i] - bR[i])));
+		}
+		// one loader step per audio block
+		if (loader.isQueued()) tasks.run(1);
+		else if (!loadSteps)
+		{
+			loadSteps = loader.getSteps();
+			if (!loader.isOk() || !conv->crossfade(parts))
+			{
+				printf("  FAIL: IR crossfade start\n");
+				result = 1;
+				break;
+			}
+		}
+	}
+	const bool freed = conv->getBytesRAM() == refB->getBytesRAM() && conv->getBytesPSRAM() == refB->getBytesPSRAM();
+	if (!result && (loadSteps < (uint32_t)IRPartitions_F32::count(lenB) + 1u || fading != fadeBlocks || !freed))
+	{
+		printf("  FAIL: IR crossfade: %u load steps, %u fade blocks, old IR %s\n", loadSteps, fading, freed ? "freed" : "not freed");
+		result = 1;
+	}
+	if (!result && (errA > 1e-4 || errB > 1e-4 || gap < 0.5))
+	{
+		printf("  FAIL: IR crossfade output: error %g before, %g after, level dip %g\n", errA, errB, gap);
+		result = 1;
+	}
+	delete conv;
+	delete refA;
+	delete refB;
+
+	// baked EQ: back to the plain IR, crossfade, baked again
+	AudioFilterToneStackAnalog_F32 eq;
+	AudioFilterIRConvolver_F32 *cab = new AudioFilterIRConvolver_F32();
+	AudioFilterCabEQ_F32 *cabEq = new AudioFilterCabEQ_F32(*cab, eq);
+	cabEq->load(irA.data(), lenA);
+	cabEq->bake_set(true);
+	cabEq->setSettleTime(20);
+	tasks.post(*cabEq);
+	parts.prepare(irB.data(), lenB);
+	float32_t level = 0.0f, low = 1e9f;
+	bool started = false;
+	for (uint32_t b = 0; b < 1000 && !result; b++)
+	{
+		for (uint32_t i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+		{
+			L[i] = (float32_t)rand() / RAND_MAX - 0.5f;
+			R[i] = (float32_t)rand() / RAND_MAX - 0.5f;
+		}
+		cabEq->processBlock(L, R, AUDIO_BLOCK_SAMPLES);
+		tasks.run(1000000);
+		if (started)
+		{
+			low = std::min(low, blockRms(L));
+			if (cabEq->crossfadeDone() && cabEq->isBaked()) break;
+		}
+		else if (cabEq->isBaked())
+		{
+			level = blockRms(L);
+			started = cabEq->crossfade(parts);
+		}
+	}
+	if (!result && (!started || !cabEq->isBaked() || cab->getIR().getLength() != lenB ||
+					cabEq->getBakeCount() != 2 || low < 0.1f * level))
+	{
+		printf("  FAIL: baked EQ crossfade: IR length %u, %u bakes, level %g -> %g\n",
+			   cab->getIR().getLength(), cabEq->getBakeCount(), level, low);
+		result = 1;
+	}
+	tasks.cancel(*cabEq);
+	delete cabEq;
+	delete cab;
+	SD.remove("b.wav");
+	rmdir(dir);
+	return result;
+}
+
+// magnitude in dB of the tone stack sections: biquad b0 b1 b2 -a1 -a2, 1st order 1 b1 -a1
+static double toneStackDb(const float32_t *c, double freq)
+{
+	const std::complex<double> z = std::polar(1.0, -2.0 * M_PI * freq / AUDIO_SAMPLE_RATE_EXACT);
+	double k[TONESTACK_COEFFS];
+	for (uint8_t n = 0; n < TONESTACK_COEFFS; n++) k[n] = c[n];
+	const std::complex<double> h = (k[0] + k[1] * z + k[2] * z * z) / (1.0 - k[3] * z - k[4] * z * z) *
+								   (1.0 + k[5] * z) / (1.0 - k[6] * z);
+	return 20.0 * log10(std::abs(h));
+}
+
+static int checkToneStack()
+{
+	// interpolated tables against the exact circuit
+	double worst = 0.0;
+	srand(19);
+	for (uint8_t m = 0; m < TONESTACK_MODEL_COUNT; m++)
+	{
+		for (uint32_t p = 0; p < 50; p++)
+		{
+			const float32_t b = (float32_t)rand() / RAND_MAX, md = (float32_t)rand() / RAND_MAX, t = (float32_t)rand() / RAND_MAX;
+			float32_t exact[TONESTACK_COEFFS], interp[TONESTACK_COEFFS];
+			AudioFilterToneStackAnalog_F32::design((tonestack_model_t)m, b, md, t, exact);
+			AudioFilterToneStackAnalog_F32::interpolate(toneStackTables[m], b, md, t, 1.0f, interp);
+			for (double f = 30.0; f < 12000.0; f *= 1.2)
+				worst = std::max(worst, fabs(toneStackDb(interp, f) - toneStackDb(exact, f)));
+		}
+	}
+	if (worst > 0.3)
+	{
+		printf("  FAIL: tone stack tables differ from the circuit by %.3fdB\n", worst);
+		return 1;
+	}
+	// knob jump with a sine input: no step larger than the ones of the sine itself
+	AudioFilterToneStackAnalog_F32 ts;
+	ts.setModel(TONESTACK_MODEL_JCM800);
+	ts.setTone(0.1f, 0.9f, 0.0f);
+	float32_t L[AUDIO_BLOCK_SAMPLES], R[AUDIO_BLOCK_SAMPLES], last = 0.0f;
+	double stepSteady = 0.0, stepChange = 0.0, peak = 0.0;
+	for (uint32_t b = 0; b < 300; b++)
+	{
+		if (b == 100) ts.setTone(1.0f, 0.1f, 1.0f);
+		// expression pedal sweep, a new position every block
+		if (b >= 200) ts.setTreble(0.5f + 0.5f * sinf(b * 0.3f));
+		for (uint32_t i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+			L[i] = R[i] = sinf(2.0f * PI * 300.0f * (b * AUDIO_BLOCK_SAMPLES + i) / AUDIO_SAMPLE_RATE_EXACT);
+		ts.processBlock(L, R, AUDIO_BLOCK_SAMPLES);
+		for (uint32_t i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+		{
+			const double step = fabsf(L[i] - last);
+			last = L[i];
+			peak = std::max(peak, (double)fabsf(L[i]));
+			if (b >= 50 && b < 100) stepSteady = std::max(stepSteady, step);
+			if (b >= 100) stepChange = std::max(stepChange, step);
+			if (L[i] != R[i] || !std::isfinite(L[i])) stepChange = 1e9;
+		}
+	}
+	// the step of a sine is 2 pi f / fs of its peak
+	const double stepMax = 1.1 * peak * 2.0 * PI * 300.0 / AUDIO_SAMPLE_RATE_EXACT;
+	if (stepChange > stepMax)
+	{
+		printf("  FAIL: tone stack knob change step %g, sine step %g (max %g)\n", stepChange, stepSteady, stepMax);
+		return 1;
+	}
+	return 0;
+}
+
+static int checkIRLoader()
+{
+	char dir[] = "/tmp/hostsim_irXXXXXX";
+	if (!mkdtemp(dir)) return 1;
+	SD.setRoot(dir);
+	const uint32_t irLen = 3000, sineLen = 4800;
+	std::vector<float> ir(irLen), sine(sineLen);
+	srand(11);
+	for (uint32_t i = 0; i < irLen; i++) ir[i] = ((float)rand() / RAND_MAX - 0.5f) * expf(-(float)i / 600.0f);
+	for (uint32_t i = 0; i < sineLen; i++) sine[i] = sinf(2.0f * PI * 1000.0f * i / 48000.0f);
+	wav_write((std::string(dir) + "/cab.wav").c_str(), ir, ir, AUDIO_SAMPLE_RATE_EXACT);
+	wav_write((std::string(dir) + "/48k.wav").c_str(), sine, sine, 48000.0f);
+
+	IRLoader_F32 loader(SD);
+	IRLoader_F32::options_t opt;
+	opt.normalize = IRLoader_F32::NORM_NONE;
+	IRPartitions_F32 ref, first, cached;
+	ref.prepare(ir.data(), irLen);
+	char names[4][IR_LOADER_NAME_MAX];
+	int result = 0;
+	bool same = true;
+	if (!SD.begin() || loader.scan("/", names, 4) != 2 || strcmp(names[0], "48k.wav") || strcmp(names[1], "cab.wav"))
+	{
+		printf("  FAIL: IR file scan\n");
+		result = 1;
+	}
+	else if (!loader.load("/cab.wav", first, opt) || loader.getSource() != IRLoader_F32::SRC_WAV ||
+			 !loader.load("/cab.wav", cached, opt) || loader.getSource() != IRLoader_F32::SRC_CACHE)
+	{
+		printf("  FAIL: IR load from the WAV file and then from the cache, source %d\n", loader.getSource());
+		result = 1;
+	}
+	for (uint8_t l = 0; !result && l < ref.getLevels(); l++)
+	{
+		const IRPartitions_F32::level_t &a = ref.getLevel(l), &b = first.getLevel(l), &c = cached.getLevel(l);
+		const size_t bytes = a.count * 2 * a.size * sizeof(float32_t);
+		same &= first.getLevels() == ref.getLevels() && cached.getLevels() == ref.getLevels() &&
+				!memcmp(a.spectra, b.spectra, bytes) && !memcmp(a.spectra, c.spectra, bytes);
+	}
+	if (!result && !same)
+	{
+		printf("  FAIL: IR spectra from the WAV file or the cache differ\n");
+		result = 1;
+	}
+	// other options: the cache is rebuilt
+	opt.normalize = IRLoader_F32::NORM_PEAK;
+	if (!result && (!loader.load("/cab.wav", cached, opt) || loader.getSource() != IRLoader_F32::SRC_WAV))
+	{
+		printf("  FAIL: IR cache not rebuilt for new options\n");
+		result = 1;
+	}
+	// minimum phase of an IR too long for the cepstrum: reported, also from the cache,
+	// converted when the tail trim makes it short enough
+	opt.normalize = IRLoader_F32::NORM_NONE;
+	opt.minPhase = true;
+	if (!result && (!loader.load("/cab.wav", cached, opt) || loader.getMinPhase() ||
+					!loader.load("/cab.wav", cached, opt) || loader.getSource() != IRLoader_F32::SRC_CACHE || loader.getMinPhase()))
+	{
+		printf("  FAIL: IR minimum phase of a %u sample IR reported as done\n", irLen);
+		result = 1;
+	}
+	opt.tailDb = -20.0f;
+	if (!result && (!loader.load("/cab.wav", cached, opt) || !loader.getMinPhase() || loader.getLengthOut() > IR_TRIM_MINPHASE_FFT / 2))
+	{
+		printf("  FAIL: IR minimum phase after the tail trim, %u samples\n", loader.getLengthOut());
+		result = 1;
+	}
+	opt.minPhase = false;
+	opt.tailDb = 0.0f;
+	// 48kHz file resampled to the audio rate
+	float32_t *res;
+	uint32_t resLen;
+	opt.normalize = IRLoader_F32::NORM_NONE;
+	if (!result && loader.readSamples("/48k.wav", opt, res, resLen))
+	{
+		double err = 0.0;
+		for (uint32_t n = 200; n < resLen - 200; n++)
+			err = std::max(err, fabs(res[n] - sin(2.0 * M_PI * 1000.0 * n / AUDIO_SAMPLE_RATE_EXACT)));
+		extmem_free(res);
+		if (err > 1e-3 || fabsf(resLen - sineLen * AUDIO_SAMPLE_RATE_EXACT / 48000.0f) > 1.0f)
+		{
+			printf("  FAIL: IR resampling error %g, length %u\n", err, resLen);
+			result = 1;
+		}
+	}
+	else if (!result)
+	{
+		printf("  FAIL: IR resampling\n");
+		result = 1;
+	}
+	// background load of a resampled file: read and resampled in chunks, one per step,
+	// the same spectra as the whole file at once
+	IRPartitions_F32 stepped, whole;
+	opt.cache = false;
+	loader.start("/48k.wav", stepped, opt);
+	uint32_t steps = 1;
+	while (loader.step() != AudioTask_F32::TASK_DONE) steps++;
+	const uint32_t chunks = (sineLen + IR_LOADER_READ_CHUNK - 1) / IR_LOADER_READ_CHUNK +
+							(loader.getLengthIn() + IR_LOADER_RESAMPLE_CHUNK - 1) / IR_LOADER_RESAMPLE_CHUNK;
+	same = loader.isOk() && loader.readSamples("/48k.wav", opt, res, resLen) && whole.prepare(res, resLen) &&
+		   whole.getLevels() == stepped.getLevels();
+	if (res) extmem_free(res);
+	for (uint8_t l = 0; same && l < whole.getLevels(); l++)
+	{
+		const IRPartitions_F32::level_t &a = whole.getLevel(l), &b = stepped.getLevel(l);
+		same = !memcmp(a.spectra, b.spectra, a.count * 2 * a.size * sizeof(float32_t));
+	}
+	if (!result && (!same || steps < chunks + 2))
+	{
+		printf("  FAIL: IR background load in %u steps, %s the whole file\n", steps, same ? "same as" : "differs from");
+		result = 1;
+	}
+	const char *files[] = {"cab.wav", "cab.irc", "48k.wav"};
+	for (const char *f : files) SD.remove(f);
+	rmdir(dir);
+	return result;
+}
+
+static int checkIRTrim()
+{
+	const uint32_t pre = 100, irLen = 1000, N = 4096;
+	std::vector<float> ir(irLen, 0.0f);
+	srand(12);
+	for (uint32_t i = pre; i < irLen; i++) ir[i] = ((float)rand() / RAND_MAX - 0.5f) * expf(-(float)(i - pre) / 150.0f);
+	ir[pre] = 0.5f;
+	int result = 0;
+	// leading silence: the pre-roll is kept
+	std::vector<float> t = ir;
+	uint32_t len = IRTrim_F32::leading(t.data(), irLen, -60.0f);
+	if (len != irLen - pre + IR_TRIM_PREROLL || t[IR_TRIM_PREROLL] != ir[pre])
+	{
+		printf("  FAIL: IR leading silence, length %u\n", len);
+		result = 1;
+	}
+	// minimum phase: same magnitude response, the energy moves to the start
+	std::vector<float> a(N, 0.0f), b(N, 0.0f), fa(N), fb(N);
+	memcpy(a.data(), t.data(), len * sizeof(float));
+	memcpy(b.data(), t.data(), len * sizeof(float));
+	if (!IRTrim_F32::minimumPhase(b.data(), len))
+	{
+		printf("  FAIL: IR minimum phase conversion\n");
+		return 1;
+	}
+	double early = 0.0, earlyMin = 0.0;
+	for (uint32_t i = 0; i < 50; i++)
+	{
+		early += (double)a[i] * a[i];
+		earlyMin += (double)b[i] * b[i];
+	}
+	arm_rfft_fast_instance_f32 fft;
+	arm_rfft_fast_init_f32(&fft, N);
+	arm_rfft_fast_f32(&fft, a.data(), fa.data(), 0);
+	arm_rfft_fast_f32(&fft, b.data(), fb.data(), 0);
+	double err = 0.0, peak = 0.0;
+	for (uint32_t k = 2; k < N; k += 2)
+	{
+		const double ma = hypot(fa[k], fa[k + 1]), mb = hypot(fb[k], fb[k + 1]);
+		err = std::max(err, fabs(ma - mb));
+		peak = std::max(peak, ma);
+	}
+	if (err > 0.01 * peak || earlyMin <= early)
+	{
+		printf("  FAIL: IR minimum phase, magnitude error %g, energy of 50 samples %g -> %g\n", err / peak, early, earlyMin);
+		result = 1;
+	}
+	// tail: the remaining energy after the cut is below the threshold
+	t = ir;
+	len = IRTrim_F32::tail(t.data(), irLen, -40.0f);
+	double total = 0.0, rest = 0.0;
+	for (uint32_t i = 0; i < irLen; i++) total += (double)ir[i] * ir[i];
+	for (uint32_t i = len; i < irLen; i++) rest += (double)ir[i] * ir[i];
+	if (len >= irLen || rest >= total * 1e-4 || rest + (double)ir[len - 1] * ir[len - 1] < total * 1e-4 ||
+		t[len - 1] != 0.0f)
+	{
+		printf("  FAIL: IR tail, length %u, remaining energy %g dB\n", len, 10.0 * log10(rest / total));
+		result = 1;
+	}
+	return result;
+}
+
+static int checkFFT()
+{
+	const uint32_t N = 256;
+	std::vector<float32_t> x(N), spec(N), y(N);
+	for (uint32_t i = 0; i < N; i++) x[i] = sinf(0.3f * i) + 0.25f * cosf(1.7f * i + 0.5f) + 0.1f;
+
+	// reference DFT
+	std::vector<std::complex<double>> X(N / 2 + 1);
+	for (uint32_t k = 0; k <= N / 2; k++)
+		for (uint32_t n = 0; n < N; n++)
+			X[k] += (double)x[n] * std::polar(1.0, -2.0 * M_PI * k * n / N);
+
+	arm_rfft_fast_instance_f32 rfft;
+	arm_rfft_fast_init_f32(&rfft, N);
+	std::vector<float32_t> tmp = x;
+	arm_rfft_fast_f32(&rfft, tmp.data(), spec.data(), 0);
+	double err = fabs(spec[0] - X[0].real()) + fabs(spec[1] - X[N / 2].real());
+	for (uint32_t k = 1; k < N / 2; k++)
+		err = std::max(err, std::abs(std::complex<double>(spec[2 * k], spec[2 * k + 1]) - X[k]));
+	if (err > 1e-3)
+	{
+		printf("  FAIL: rfft differs from the DFT by %g\n", err);
+		return 1;
+	}
+	arm_rfft_fast_f32(&rfft, spec.data(), y.data(), 1);
+	for (uint32_t i = 0; i < N; i++)
+	{
+		if (fabsf(y[i] - x[i]) > 1e-5f)
+		{
+			printf("  FAIL: inverse rfft sample %u = %f, expected %f\n", i, y[i], x[i]);
+			return 1;
+		}
+	}
+
+	// complex roundtrip, output left in the bit reversed order and restored
+	std::vector<float32_t> c(2 * N);
+	for (uint32_t i = 0; i < 2 * N; i++) c[i] = x[i % N] * (i & 1 ? -0.5f : 1.0f);
+	std::vector<float32_t> c0 = c;
+	arm_cfft_f32(&arm_cfft_sR_f32_len256, c.data(), 0, 1);
+	arm_cfft_f32(&arm_cfft_sR_f32_len256, c.data(), 1, 1);
+	for (uint32_t i = 0; i < 2 * N; i++)
+	{
+		if (fabsf(c[i] - c0[i]) > 1e-5f)
+		{
+			printf("  FAIL: cfft roundtrip value %u = %f, expected %f\n", i, c[i], c0[i]);
+			return 1;
+		}
+	}
+	return 0;
+}
+
+static int checkBiquads()
+{
+	// 2 stages, b0 b1 b2 a1 a2
+	const float32_t coeffs[10] = {0.2f, 0.4f, 0.2f, 0.6f, -0.3f, 1.0f, -1.5f, 0.7f, 1.2f, -0.5f};
+	float32_t state1[8], state2[4], stateS[8];
+	arm_biquad_casd_df1_inst_f32 df1;
+	arm_biquad_cascade_df2T_instance_f32 df2T;
+	arm_biquad_cascade_stereo_df2T_instance_f32 st;
+	arm_biquad_cascade_df1_init_f32(&df1, 2, coeffs, state1);
+	arm_biquad_cascade_df2T_init_f32(&df2T, 2, coeffs, state2);
+	arm_biquad_cascade_stereo_df2T_init_f32(&st, 2, coeffs, stateS);
+
+	float32_t x[64], y1[64], y2[64], xs[128], ys[128];
+	for (int blk = 0; blk < 4; blk++)
+	{
+		for (int i = 0; i < 64; i++)
+		{
+			x[i] = sinf(0.05f * (blk * 64 + i)) + (i == 3 ? 1.0f : 0.0f);
+			xs[2 * i] = x[i];
+			xs[2 * i + 1] = -x[i];
+		}
+		arm_biquad_cascade_df1_f32(&df1, x, y1, 64);
+		arm_biquad_cascade_df2T_f32(&df2T, x, y2, 64);
+		arm_biquad_cascade_stereo_df2T_f32(&st, xs, ys, 64);
+		for (int i = 0; i < 64; i++)
+		{
+			if (fabsf(y1[i] - y2[i]) > 1e-4f || ys[2 * i] != y2[i] || ys[2 * i + 1] != -y2[i])
+			{
+				printf("  FAIL: biquad structures differ at sample %d\n", blk * 64 + i);
+				return 1;
+			}
+		}
+	}
+	return 0;
+}
+
+static int checkBiquadStereo()
+{
+	// 3 stages, b0 b1 b2 a1 a2, the ramp goes to the second set
+	const float32_t coeffs[15] = {0.2f, 0.4f, 0.2f, 0.6f, -0.3f, 1.0f, -1.5f, 0.7f, 1.2f, -0.5f, 0.9f, 0.1f, 0.0f, -0.2f, 0.0f};
+	const float32_t target[15] = {0.3f, 0.2f, 0.1f, 0.5f, -0.4f, 1.0f, -1.2f, 0.5f, 1.3f, -0.6f, 1.0f, 0.3f, 0.0f, 0.1f, 0.0f};
+	float32_t stateL[6], stateR[6];
+	arm_biquad_cascade_df2T_instance_f32 refL, refR;
+	arm_biquad_cascade_df2T_init_f32(&refL, 3, coeffs, stateL);
+	arm_biquad_cascade_df2T_init_f32(&refR, 3, coeffs, stateR);
+	BiquadStereo_F32 lanes;
+	if (lanes.init(0, coeffs) || lanes.init(BIQUAD_STEREO_STAGES_MAX + 1, coeffs) || !lanes.init(3, coeffs))
+	{
+		printf("  FAIL: stereo biquad stage count check\n");
+		return 1;
+	}
+	// odd block lengths, the states carry over
+	float32_t L[77], R[77], xL[77], xR[77];
+	uint32_t n = 0;
+	for (int blk = 0; blk < 5; blk++)
+	{
+		const uint16_t len = 13 + 16 * blk;
+		for (int i = 0; i < len; i++, n++)
+		{
+			L[i] = xL[i] = sinf(0.05f * n) + (n == 3 ? 1.0f : 0.0f);
+			R[i] = xR[i] = cosf(0.21f * n);
+		}
+		arm_biquad_cascade_df2T_f32(&refL, xL, xL, len);
+		arm_biquad_cascade_df2T_f32(&refR, xR, xR, len);
+		lanes.process(L, R, len);
+		for (int i = 0; i < len; i++)
+		{
+			if (fabsf(L[i] - xL[i]) > 1e-5f || fabsf(R[i] - xR[i]) > 1e-5f)
+			{
+				printf("  FAIL: stereo biquad differs from the CMSIS cascade at sample %d\n", (int)(n - len + i));
+				return 1;
+			}
+		}
+	}
+	// ramp against a per sample recomputed single stage reference
+	float32_t c[15], s[12] = {0};
+	lanes.reset();
+	for (int i = 0; i < 64; i++) L[i] = R[i] = xL[i] = sinf(0.3f * i);
+	lanes.ramp(L, R, 64, coeffs, target);
+	for (int i = 0; i < 64; i++)
+	{
+		for (int k = 0; k < 15; k++) c[k] = coeffs[k] + (target[k] - coeffs[k]) * (i + 1) / 64.0f;
+		float32_t x = xL[i];
+		for (int st = 0; st < 3; st++)
+		{
+			const float32_t y = c[5 * st] * x + s[2 * st];
+			s[2 * st] = c[5 * st + 1] * x + c[5 * st + 3] * y + s[2 * st + 1];
+			s[2 * st + 1] = c[5 * st + 2] * x + c[5 * st + 4] * y;
+			x = y;
+		}
+		if (fabsf(L[i] - x) > 1e-4f || L[i] != R[i])
+		{
+			printf("  FAIL: stereo biquad ramp differs at sample %d\n", i);
+			return 1;
+		}
+	}
+	return 0;
+}
+
+static int checkPlateReverb()
+{
+	// block and lane processing against sample by sample: the same network,
+	// odd block lengths, settings changed while running
+	AudioEffectPlateDattorro_F32 lanes, samples;
+	if (!lanes.isReady() || !samples.isReady())
+	{
+		printf("  FAIL: plate reverb out of memory\n");
+		return 1;
+	}
+	samples.lanes_set(false);
+	float32_t L[2][AUDIO_BLOCK_SAMPLES], R[2][AUDIO_BLOCK_SAMPLES];
+	double diff = 0.0, early = 0.0, late = 0.0;
+	uint32_t n = 0;
+	srand(23);
+	for (uint32_t b = 0; b < 1000; b++)
+	{
+		const uint16_t len = b % 3 ? AUDIO_BLOCK_SAMPLES : AUDIO_BLOCK_SAMPLES - 1 - b % 37;
+		if (b == 300)
+		{
+			lanes.size(0.9f);
+			samples.size(0.9f);
+			lanes.hidamp(0.3f);
+			samples.hidamp(0.3f);
+			lanes.diffusion(0.5f);
+			samples.diffusion(0.5f);
+		}
+		for (uint16_t i = 0; i < len; i++, n++)
+		{
+			// noise bursts, then the tail
+			const bool burst = n < 4000 || (n > 40000 && n < 44000);
+			L[0][i] = L[1][i] = burst ? (float32_t)rand() / RAND_MAX - 0.5f : 0.0f;
+			R[0][i] = R[1][i] = burst ? (float32_t)rand() / RAND_MAX - 0.5f : 0.0f;
+		}
+		lanes.processBlock(L[0], R[0], len);
+		samples.processBlock(L[1], R[1], len);
+		for (uint16_t i = 0; i < len; i++)
+		{
+			diff = std::max(diff, (double)std::max(fabsf(L[0][i] - L[1][i]), fabsf(R[0][i] - R[1][i])));
+			if (!std::isfinite(L[0][i]) || !std::isfinite(R[0][i])) diff = 1e9;
+			const uint32_t m = n - len + i;
+			if (m > 8000 && m < 12000) early = std::max(early, (double)fabsf(L[0][i]));
+			if (m > 60000 && m < 64000) late = std::max(late, (double)fabsf(L[0][i]));
+		}
+	}
+	if (diff > 1e-5)
+	{
+		printf("  FAIL: plate reverb lanes differ from sample by sample by %g\n", diff);
+		return 1;
+	}
+	// a tail after the bursts that decays
+	if (early < 1e-3 || late < 1e-4 || late > early)
+	{
+		printf("  FAIL: plate reverb tail %g after the first burst, %g after the second\n", early, late);
+		return 1;
+	}
+	return 0;
+}
+
+static int checkDelayMemory()
+{
+	// staged PSRAM lines against the RAM: ring wraps, reads of the block being
+	// written, spans not requested (CPU fallback)
+	DelayMemory_F32 ram, ext;
+	const uint32_t sizes[2] = {256, 512};
+	if (!ram.begin(2, sizes, false) || !ext.begin(2, sizes, true) || !ext.staging_get())
+	{
+		printf("  FAIL: delay memory not allocated\n");
+		return 1;
+	}
+	float32_t x[AUDIO_BLOCK_SAMPLES], a[AUDIO_BLOCK_SAMPLES], b[AUDIO_BLOCK_SAMPLES];
+	uint32_t pos = 0, errors = 0;
+	srand(5);
+	for (uint32_t blk = 0; blk < 200; blk++)
+	{
+		const uint16_t len = blk % 4 ? AUDIO_BLOCK_SAMPLES : 1 + blk % AUDIO_BLOCK_SAMPLES;
+		DelayMemory_F32 *m[2] = {&ram, &ext};
+		for (uint8_t k = 0; k < 2; k++)
+		{
+			m[k]->block(pos, len);
+			m[k]->request(0, pos - 200, len);
+			if (blk % 2) m[k]->request(1, pos - 300, len);
+			m[k]->fetch();
+		}
+		for (uint8_t l = 0; l < 2; l++)
+		{
+			for (uint16_t i = 0; i < len; i++) x[i] = (float32_t)rand() / RAND_MAX;
+			ram.read(l, pos - 200 - 100 * l, a, len);
+			ext.read(l, pos - 200 - 100 * l, b, len);
+			errors += memcmp(a, b, len * sizeof(float32_t)) != 0;
+			ram.write(l, pos, x, len);
+			ext.write(l, pos, x, len);
+		}
+		// half of it written in this block
+		ram.read(0, pos - len / 2, a, len);
+		ext.read(0, pos - len / 2, b, len);
+		errors += memcmp(a, b, len * sizeof(float32_t)) != 0;
+		ram.commit();
+		ext.commit();
+		pos += len;
+	}
+	ext.sync();
+	const DelayMemory_F32::stats_t &st = ext.getStats();
+	if (errors || !st.misses || !st.dmaTransfers || st.dmaTimeouts)
+	{
+		printf("  FAIL: delay memory %u blocks differ, %u misses, %u transfers, %u DMA timeouts\n", errors, st.misses, st.dmaTransfers, st.dmaTimeouts);
+		return 1;
+	}
+	// the plate reverb tank in the PSRAM, staged: the RAM output, no CPU access
+	AudioEffectPlateDattorro_F32 inRam, inPsram(true);
+	if (!inRam.isReady() || !inPsram.isReady() || !inPsram.staging_get())
+	{
+		printf("  FAIL: plate reverb out of memory\n");
+		return 1;
+	}
+	float32_t L[2][AUDIO_BLOCK_SAMPLES], R[2][AUDIO_BLOCK_SAMPLES];
+	for (uint32_t blk = 0; blk < 600; blk++)
+	{
+		const uint16_t len = blk % 3 ? AUDIO_BLOCK_SAMPLES : AUDIO_BLOCK_SAMPLES - 1 - blk % 37;
+		if (blk == 200)
+		{
+			inRam.size(0.9f);
+			inPsram.size(0.9f);
+		}
+		for (uint16_t i = 0; i < len; i++)
+		{
+			const bool burst = blk < 30;
+			L[0][i] = L[1][i] = burst ? (float32_t)rand() / RAND_MAX - 0.5f : 0.0f;
+			R[0][i] = R[1][i] = burst ? (float32_t)rand() / RAND_MAX - 0.5f : 0.0f;
+		}
+		inRam.processBlock(L[0], R[0], len);
+		inPsram.processBlock(L[1], R[1], len);
+		if (memcmp(L[0], L[1], len * sizeof(float32_t)) || memcmp(R[0], R[1], len * sizeof(float32_t))) errors++;
+	}
+	const DelayMemory_F32::stats_t &rs = inPsram.getMemStats();
+	if (errors || rs.cpuLines || rs.misses || !rs.dmaTransfers || rs.dmaTimeouts)
+	{
+		printf("  FAIL: staged plate reverb %u blocks differ, %u CPU lines, %u misses, %u transfers, %u DMA timeouts\n",
+			   errors, rs.cpuLines, rs.misses, rs.dmaTransfers, rs.dmaTimeouts);
+		return 1;
+	}
+	return 0;
+}
+
+static int checkWav()
+{
+	std::vector<float> L = {0.0f, 0.5f, -0.25f, 1.0f}, R = {0.1f, -0.1f, 0.2f, -1.0f}, L2, R2;
+	float fs;
+	const char *path = "hostsim_tests.wav";
+	if (!wav_write(path, L, R, 44100.0f) || !wav_read(path, L2, R2, fs) || L2 != L || R2 != R || fs != 44100.0f)
+	{
+		printf("  FAIL: wav roundtrip\n");
+		return 1;
+	}
+	remove(path);
+	return 0;
+}
+
+int main()
+{
+	int result = 0;
+	printf("TESTING HOST SIMULATOR...\n");
+	result |= checkBlocks();
+	result |= checkPool();
+	result |= checkChain();
+	result |= checkChainBypass();
+	result |= checkChainTail();
+	result |= checkProfiler();
+	result |= checkParamQueue();
+	result |= checkRender();
+	result |= checkTrap();
+	result |= checkTasks();
+	result |= checkConvolver();
+	result |= checkCabEQ();
+	result |= checkToneStack();
+	result |= checkIRLoader();
+	result |= checkCrossfade();
+	result |= checkIRTrim();
+	result |= checkFFT();
+	result |= checkBiquads();
+	result |= checkBiquadStereo();
+	result |= checkPlateReverb();
+	result |= checkDelayMemory();
+	result |= checkWav();
+	if (result == 0) printf("SUCCESS\n");
+	return result;
+}
@@ -0,0 +1,141 @@
+/**
+ * @file main.cpp
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Generates the coefficient tables of AudioFilterToneStackAnalog_F32:
+ * 		the exact circuit design on the knob grid of every model at the
+ * 		audio sample rate of the build. Prints the worst deviation of the
+ * 		interpolated response from the exact one between the grid points.
+ * @version 0.1
+ * @date 2024-03-18
+ */
+#include <Arduino.h>
+#include <getopt.h>
+#include <vector>
+#include "AudioFilterToneStackAnalog_F32.h"
+
+#define CHECK_POINTS		(500)		// random knob positions per model
+#define CHECK_FREQS			(64)		// 30Hz .. 12kHz
+
+static void usage(const char *name)
+{
+	fprintf(stderr,
+		"usage: %s [options]\n"
+		"  -o file         write the tables (AudioFilterToneStackTables_F32.cpp)\n"
+		"  -c              only check the interpolation error\n", name);
+}
+
+// float literal, exact round trip
+static void printFloat(FILE *f, float32_t x)
+{
+	char buf[32];
+	snprintf(buf, sizeof(buf), "%.9g", (double)x);
+	fprintf(f, "%s%sf", buf, strpbrk(buf, ".e") ? "" : ".0");
+}
+
+static void gridDesign(tonestack_model_t m, float32_t *table)
+{
+	const float32_t step = 1.0f / (TONESTACK_GRID - 1);
+	for (uint32_t i = 0; i < TONESTACK_GRID * TONESTACK_GRID * TONESTACK_GRID; i++)
+	{
+		AudioFilterToneStackAnalog_F32::design(m, (i / (TONESTACK_GRID * TONESTACK_GRID)) * step,
+											   ((i / TONESTACK_GRID) % TONESTACK_GRID) * step,
+											   (i % TONESTACK_GRID) * step, table + i * TONESTACK_COEFFS);
+	}
+}
+
+static double magDb(const float32_t *c, double w)
+{
+	// biquad b0 b1 b2 -a1 -a2, 1st order 1 b1 -a1
+	const double nr = c[0] + c[1] * cos(w) + c[2] * cos(2.0 * w), ni = -c[1] * sin(w) - c[2] * sin(2.0 * w);
+	const double dr = 1.0 - c[3] * cos(w) - c[4] * cos(2.0 * w), di = c[3] * sin(w) + c[4] * sin(2.0 * w);
+	const double n1r = 1.0 + c[5] * cos(w), n1i = -c[5] * sin(w);
+	const double d1r = 1.0 - c[6] * cos(w), d1i = c[6] * sin(w);
+	return 10.0 * log10((nr * nr + ni * ni) * (n1r * n1r + n1i * n1i) / ((dr * dr + di * di) * (d1r * d1r + d1i * d1i)));
+}
+
+static double check(tonestack_model_t m, const float32_t *table)
+{
+	double worst = 0.0;
+	float32_t exact[TONESTACK_COEFFS], interp[TONESTACK_COEFFS];
+	for (uint32_t p = 0; p < CHECK_POINTS; p++)
+	{
+		const float32_t b = (float32_t)rand() / RAND_MAX, md = (float32_t)rand() / RAND_MAX, t = (float32_t)rand() / RAND_MAX;
+		AudioFilterToneStackAnalog_F32::design(m, b, md, t, exact);
+		AudioFilterToneStackAnalog_F32::interpolate(table, b, md, t, 1.0f, interp);
+		for (uint32_t f = 0; f < CHECK_FREQS; f++)
+		{
+			const double w = 2.0 * M_PI * 30.0 * pow(400.0, (double)f / (CHECK_FREQS - 1)) / AUDIO_SAMPLE_RATE_EXACT;
+			worst = std::max(worst, fabs(magDb(interp, w) - magDb(exact, w)));
+		}
+	}
+	return worst;
+}
+
+int main(int argc, char **argv)
+{
+	const char *out = NULL;
+	bool checkOnly = false;
+	int opt;
+	while ((opt = getopt(argc, argv, "o:ch")) != -1)
+	{
+		switch (opt)
+		{
+			case 'o': out = optarg; break;
+			case 'c': checkOnly = true; break;
+			default: usage(argv[0]); return opt == 'h' ? 0 : 1;
+		}
+	}
+	if (!out && !checkOnly)
+	{
+		usage(argv[0]);
+		return 1;
+	}
+	std::vector<float32_t> tables(TONESTACK_MODEL_COUNT * TONESTACK_TABLE_SIZE);
+	srand(1);
+	for (uint8_t m = 0; m < TONESTACK_MODEL_COUNT; m++)
+	{
+		float32_t *table = &tables[m * TONESTACK_TABLE_SIZE];
+		gridDesign((tonestack_model_t)m, table);
+		printf("%-16s grid %u^3, worst interpolation error %.3fdB\n", AudioFilterToneStackAnalog_F32::getName((tonestack_model_t)m),
+			   TONESTACK_GRID, check((tonestack_model_t)m, table));
+	}
+	if (checkOnly) return 0;
+	FILE *f = fopen(out, "w");
+	if (!f)
+	{
+		fprintf(stderr, "can't write %s\n", out);
+		return 1;
+	}
+	fprintf(f, "/**\n"
+			   " * @file AudioFilterToneStackTables_F32.cpp\n"
+			   " * @author Piotr Zapart www.hexefx.com\n"
+			   " * @brief Coefficient tables of AudioFilterToneStackAnalog_F32, generated\n"
+			   " * \t\tby tonestack_tables (HostSim), do not edit.\n"
+			   " * \t\t%u^3 knob positions per model (bass, mid, treble 0..1, the\n"
+			   " * \t\ttreble changes fastest), %u coefficients each.\n"
+			   " * @version 0.1\n"
+			   " * @date 2024-03-18\n"
+			   " */\n"
+			   "#include \"AudioFilterToneStackAnalog_F32.h\"\n\n"
+			   "const float32_t toneStackTableRate = %.5ff;\n\n"
+			   "PROGMEM const float32_t toneStackTables[TONESTACK_MODEL_COUNT][TONESTACK_TABLE_SIZE] =\n{\n",
+			TONESTACK_GRID, TONESTACK_COEFFS, (double)AUDIO_SAMPLE_RATE_EXACT);
+	for (uint8_t m = 0; m < TONESTACK_MODEL_COUNT; m++)
+	{
+		fprintf(f, "\t// %s\n\t{\n", AudioFilterToneStackAnalog_F32::getName((tonestack_model_t)m));
+		for (uint32_t i = 0; i < TONESTACK_GRID * TONESTACK_GRID * TONESTACK_GRID; i++)
+		{
+			const float32_t *c = &tables[m * TONESTACK_TABLE_SIZE + i * TONESTACK_COEFFS];
+			fprintf(f, "\t\t");
+			for (uint8_t n = 0; n < TONESTACK_COEFFS; n++)
+			{
+				printFloat(f, c[n]);
+				fprintf(f, n < TONESTACK_COEFFS - 1 ? ", " : ",\n");
+			}
+		}
+		fprintf(f, "\t},\n");
+	}
+	fprintf(f, "};\n");
+	fclose(f);
+	return 0;
+}
@@ -16,6 +16,7 @@
 #include "dense/dense.h"
 #include "gru/gru.h"
 #include "gru/gru.tpp"
+#include "layer_profiler.h"
 #include "lstm/lstm.h"
 #include "lstm/lstm.tpp"
 
@@ -68,6 +69,9 @@ public:
     {
         layers.push_back(layer);
         outs.push_back(vec_type(layer->out_size, (T)0));
+#if RTNEURAL_ENABLE_PROFILING
+        profiles.emplace_back();
+#endif
     }
 
     /** Resets the state of the network layers. */
@@ -80,12 +84,25 @@ public:
     /** Performs forward propagation for this model. */
     inline T forward(const T* input)
     {
+#if RTNEURAL_ENABLE_PROFILING
+        auto start = ProfilerClock::now();
         layers[0]->forward(input, outs[0].data());
+        profiles[0].add(ProfilerClock::elapsed(start, ProfilerClock::now()));
 
         for(int i = 1; i < (int)layers.size(); ++i)
         {
+            start = ProfilerClock::now();
             layers[i]->forward(outs[i - 1].data(), outs[i].data());
+            profiles[i].add(ProfilerClock::elapsed(start, ProfilerClock::now()));
         }
+#else
+        layers[0]->forward(input, outs[0].data());
+
+        for(int i = 1; i < (int)layers.size(); ++i)
+        {
+            layers[i]->forward(outs[i - 1].data(), outs[i].data());
+        }
+#endif
 
         return outs.back()[0];
     }
@@ -96,6 +113,21 @@ public:
         return outs.back().data();
     }
 
+#if RTNEURAL_ENABLE_PROFILING
+    /** Returns the forward pass cost statistics of the layer at index `idx`. */
+    const LayerProfile& getLayerProfile(int idx) const noexcept
+    {
+        return profiles[idx];
+    }
+
+    /** Clears the cost statistics of all layers. */
+    void resetLayerProfiles() noexcept
+    {
+        for(auto& p : profiles)
+            p.reset();
+    }
+#endif
+
     /** A vector storing the network layers in sequential order. */
     std::vector<Layer<T>*> layers;
 
@@ -110,6 +142,10 @@ private:
 
     const int in_size;
     std::vector<vec_type> outs;
+
+#if RTNEURAL_ENABLE_PROFILING
+    std::vector<LayerProfile> profiles;
+#endif
 };
 
 } // namespace RTNeural
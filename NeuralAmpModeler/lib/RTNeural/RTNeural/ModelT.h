@@ -56,40 +56,168 @@ namespace modelt_detail
         forEachInTuple(std::forward<Fn>(fn), std::forward<Tuple>(tuple), TupleIndexSequenceRange<start, num> {});
     }
 
-    // unrolled loop for forward inferencing
+    /** The type of the layer at index `idx`, or void past the end of the tuple. */
+    template <size_t idx, typename Tuple, bool = (idx < std::tuple_size<Tuple>::value)>
+    struct layer_at
+    {
+        using type = void;
+    };
+
+    template <size_t idx, typename Tuple>
+    struct layer_at<idx, Tuple, true>
+    {
+        using type = std::tuple_element_t<idx, Tuple>;
+    };
+
+    /**
+     * Pairs of adjacent layers that can run as a single fused kernel.
+     * A specialization provides `forward(layer, nextLayer, ins)`, which
+     * must fill `nextLayer.outs` exactly like running the two layers one
+     * after another would. The outputs of the first layer are not stored.
+     */
+    template <typename LayerType, typename NextLayerType, typename = void>
+    struct fused_pair : std::false_type
+    {
+    };
+
+#if !RTNEURAL_USE_EIGEN && !RTNEURAL_USE_XSIMD
+    /** Element-wise activations that can be applied inside the kernel of the previous layer. */
+    template <typename LayerType>
+    struct elementwise_activation : std::false_type
+    {
+    };
+
+    template <typename T, int size>
+    struct elementwise_activation<TanhActivationT<T, size>> : std::true_type
+    {
+        static inline T apply(T x) noexcept { return std::tanh(x); }
+    };
+
+    template <typename T, int size>
+    struct elementwise_activation<ReLuActivationT<T, size>> : std::true_type
+    {
+        static inline T apply(T x) noexcept { return std::max((T)0, x); }
+    };
+
+    template <typename T, int size>
+    struct elementwise_activation<SigmoidActivationT<T, size>> : std::true_type
+    {
+        static inline T apply(T x) noexcept { return sigmoid(x); }
+    };
+
+    template <typename T, int size, int AlphaNumerator, int AlphaDenominator>
+    struct elementwise_activation<ELuActivationT<T, size, AlphaNumerator, AlphaDenominator>> : std::true_type
+    {
+        static inline T apply(T x) noexcept
+        {
+            static constexpr T alpha = (T)AlphaNumerator / (T)AlphaDenominator;
+            return x > (T)0 ? x : (alpha * (std::exp(x) - (T)1));
+        }
+    };
+
+    /** Dense layer followed by an activation: the activation is applied to each output as it is computed. */
+    template <typename T, int in_size, int out_size, typename ActivationType>
+    struct fused_pair<DenseT<T, in_size, out_size>, ActivationType, std::enable_if_t<elementwise_activation<ActivationType>::value>> : std::true_type
+    {
+        template <typename InsType>
+        static inline void forward(DenseT<T, in_size, out_size>& dense, ActivationType& activation, const InsType& ins) noexcept
+        {
+            dense.forward(ins, [&activation](int i, T x) noexcept
+                { activation.outs[i] = elementwise_activation<ActivationType>::apply(x); });
+        }
+    };
+
+    /** GRU followed by a dense layer: the dense dot products are accumulated while the GRU outputs are updated. */
+    template <typename T, int in_size, int hidden_size, SampleRateCorrectionMode mode, int out_size>
+    struct fused_pair<GRULayerT<T, in_size, hidden_size, mode>, DenseT<T, hidden_size, out_size>> : std::true_type
+    {
+        template <typename InsType>
+        static inline void forward(GRULayerT<T, in_size, hidden_size, mode>& gru, DenseT<T, hidden_size, out_size>& dense, const InsType& ins) noexcept
+        {
+            T acc[out_size] {};
+            gru.forward(ins, [&dense, &acc](int k, T x) noexcept
+                {
+                    for(int i = 0; i < out_size; ++i)
+                        acc[i] = acc[i] + x * dense.getWeight(i, k); });
+
+            for(int i = 0; i < out_size; ++i)
+                dense.outs[i] = acc[i] + dense.getBias(i);
+        }
+    };
+#endif
+
+    // unrolled loop for forward inferencing, running the fused layer pairs where possible
     template <size_t idx, size_t Niter>
     struct forward_unroll
     {
-        template <typename T>
-        static void call(T& t)
+        template <typename T, typename InsType>
+        static void call(T& t, const InsType& ins)
         {
-            std::get<idx>(t).forward(std::get<idx - 1>(t).outs);
-            forward_unroll<idx + 1, Niter - 1>::call(t);
+            using pair_type = fused_pair<typename layer_at<idx, T>::type, typename layer_at<idx + 1, T>::type>;
+            forward(t, ins, std::integral_constant<bool, (Niter > 1) && pair_type::value> {});
+        }
+
+    private:
+        template <typename T, typename InsType>
+        static void forward(T& t, const InsType& ins, std::false_type)
+        {
+            std::get<idx>(t).forward(ins);
+            forward_unroll<idx + 1, Niter - 1>::call(t, std::get<idx>(t).outs);
+        }
+
+        template <typename T, typename InsType>
+        static void forward(T& t, const InsType& ins, std::true_type)
+        {
+            using pair_type = fused_pair<typename layer_at<idx, T>::type, typename layer_at<idx + 1, T>::type>;
+            pair_type::forward(std::get<idx>(t), std::get<idx + 1>(t), ins);
+            forward_unroll<idx + 2, Niter - 2>::call(t, std::get<idx + 1>(t).outs);
         }
     };
 
     template <size_t idx>
     struct forward_unroll<idx, 0>
     {
-        template <typename T>
-        static void call(T&) { }
+        template <typename T, typename InsType>
+        static void call(T&, const InsType&) { }
     };
 
-    template <typename T, typename LayerType>
-    void loadLayer(LayerType&, int&, const nlohmann::json&, const std::string&, int, bool debug)
+#if RTNEURAL_ENABLE_PROFILING
+    // unrolled loop for forward inferencing, with per-layer cost measurement
+    template <size_t idx, size_t Niter>
+    struct forward_unroll_profiled
+    {
+        template <typename T, typename ProfilesType>
+        static void call(T& t, ProfilesType& profiles)
+        {
+            const auto start = ProfilerClock::now();
+            std::get<idx>(t).forward(std::get<idx - 1>(t).outs);
+            profiles[idx].add(ProfilerClock::elapsed(start, ProfilerClock::now()));
+            forward_unroll_profiled<idx + 1, Niter - 1>::call(t, profiles);
+        }
+    };
+
+    template <size_t idx>
+    struct forward_unroll_profiled<idx, 0>
+    {
+        template <typename T, typename ProfilesType>
+        static void call(T&, ProfilesType&) { }
+    };
+#endif
+
+    template <typename T, typename LayerType, typename WeightsType>
+    void loadLayer(LayerType&, int&, const nlohmann::json&, const WeightsType&, const std::string&, int, bool debug)
     {
         json_parser::debug_print("Loading a no-op layer!", debug);
     }
 
-    template <typename T, int in_size, int out_size>
-    void loadLayer(DenseT<T, in_size, out_size>& dense, int& json_stream_idx, const nlohmann::json& l,
+    template <typename T, int in_size, int out_size, typename WeightsType>
+    void loadLayer(DenseT<T, in_size, out_size>& dense, int& json_stream_idx, const nlohmann::json& l, const WeightsType& weights,
         const std::string& type, int layerDims, bool debug)
     {
         using namespace json_parser;
 
         debug_print("Layer: " + type, debug);
         debug_print("  Dims: " + std::to_string(layerDims), debug);
-        const auto& weights = l["weights"];
 
         if(checkDense<T>(dense, type, layerDims, debug))
             loadDense<T>(dense, weights);
@@ -106,15 +234,14 @@ namespace modelt_detail
         }
     }
 
-    template <typename T, int in_size, int out_size, int kernel_size, int dilation_rate, bool dynamic_state>
-    void loadLayer(Conv1DT<T, in_size, out_size, kernel_size, dilation_rate, dynamic_state>& conv, int& json_stream_idx, const nlohmann::json& l,
+    template <typename T, int in_size, int out_size, int kernel_size, int dilation_rate, bool dynamic_state, typename WeightsType>
+    void loadLayer(Conv1DT<T, in_size, out_size, kernel_size, dilation_rate, dynamic_state>& conv, int& json_stream_idx, const nlohmann::json& l, const WeightsType& weights,
         const std::string& type, int layerDims, bool debug)
     {
         using namespace json_parser;
 
         debug_print("Layer: " + type, debug);
         debug_print("  Dims: " + std::to_string(layerDims), debug);
-        const auto& weights = l["weights"];
         const auto kernel = l["kernel_size"].back().get<int>();
         const auto dilation = l["dilation"].back().get<int>();
 
@@ -133,17 +260,16 @@ namespace modelt_detail
         }
     }
     template <typename T, int num_filters_in_t, int num_filters_out_t, int num_features_in_t, int kernel_size_time_t,
-        int kernel_size_feature_t, int dilation_rate_t, int stride_t, bool valid_pad_t>
+        int kernel_size_feature_t, int dilation_rate_t, int stride_t, bool valid_pad_t, typename WeightsType>
     void loadLayer(Conv2DT<T, num_filters_in_t, num_filters_out_t, num_features_in_t, kernel_size_time_t,
                        kernel_size_feature_t, dilation_rate_t, stride_t, valid_pad_t>& conv,
-        int& json_stream_idx, const nlohmann::json& l,
+        int& json_stream_idx, const nlohmann::json& l, const WeightsType& weights,
         const std::string& type, int layerDims, bool debug)
     {
         using namespace json_parser;
 
         debug_print("Layer: " + type, debug);
         debug_print("  Dims: " + std::to_string(layerDims), debug);
-        const auto& weights = l["weights"];
         const auto kernel_time = l["kernel_size_time"].back().get<int>();
         const auto kernel_feature = l["kernel_size_feature"].back().get<int>();
 
@@ -166,15 +292,14 @@ namespace modelt_detail
         }
     }
 
-    template <typename T, int in_size, int out_size, SampleRateCorrectionMode mode>
-    void loadLayer(GRULayerT<T, in_size, out_size, mode>& gru, int& json_stream_idx, const nlohmann::json& l,
+    template <typename T, int in_size, int out_size, SampleRateCorrectionMode mode, typename WeightsType>
+    void loadLayer(GRULayerT<T, in_size, out_size, mode>& gru, int& json_stream_idx, const nlohmann::json& l, const WeightsType& weights,
         const std::string& type, int layerDims, bool debug)
     {
         using namespace json_parser;
 
         debug_print("Layer: " + type, debug);
         debug_print("  Dims: " + std::to_string(layerDims), debug);
-        const auto& weights = l["weights"];
 
         if(checkGRU<T>(gru, type, layerDims, debug))
             loadGRU<T>(gru, weights);
@@ -182,15 +307,14 @@ namespace modelt_detail
         json_stream_idx++;
     }
 
-    template <typename T, int in_size, int out_size, SampleRateCorrectionMode mode>
-    void loadLayer(LSTMLayerT<T, in_size, out_size, mode>& lstm, int& json_stream_idx, const nlohmann::json& l,
+    template <typename T, int in_size, int out_size, SampleRateCorrectionMode mode, typename WeightsType>
+    void loadLayer(LSTMLayerT<T, in_size, out_size, mode>& lstm, int& json_stream_idx, const nlohmann::json& l, const WeightsType& weights,
         const std::string& type, int layerDims, bool debug)
     {
         using namespace json_parser;
 
         debug_print("Layer: " + type, debug);
         debug_print("  Dims: " + std::to_string(layerDims), debug);
-        const auto& weights = l["weights"];
 
         if(checkLSTM<T>(lstm, type, layerDims, debug))
             loadLSTM<T>(lstm, weights);
@@ -198,15 +322,14 @@ namespace modelt_detail
         json_stream_idx++;
     }
 
-    template <typename T, int size>
-    void loadLayer(PReLUActivationT<T, size>& prelu, int& json_stream_idx, const nlohmann::json& l,
+    template <typename T, int size, typename WeightsType>
+    void loadLayer(PReLUActivationT<T, size>& prelu, int& json_stream_idx, const nlohmann::json& l, const WeightsType& weights,
         const std::string& type, int layerDims, bool debug)
     {
         using namespace json_parser;
 
         debug_print("Layer: " + type, debug);
         debug_print("  Dims: " + std::to_string(layerDims), debug);
-        const auto& weights = l["weights"];
 
         if(checkPReLU<T>(prelu, type, layerDims, debug))
             loadPReLU<T>(prelu, weights);
@@ -214,15 +337,14 @@ namespace modelt_detail
         json_stream_idx++;
     }
 
-    template <typename T, int size, bool affine>
-    void loadLayer(BatchNorm1DT<T, size, affine>& batch_norm, int& json_stream_idx, const nlohmann::json& l,
+    template <typename T, int size, bool affine, typename WeightsType>
+    void loadLayer(BatchNorm1DT<T, size, affine>& batch_norm, int& json_stream_idx, const nlohmann::json& l, const WeightsType& weights,
         const std::string& type, int layerDims, bool debug)
     {
         using namespace json_parser;
 
         debug_print("Layer: " + type, debug);
         debug_print("  Dims: " + std::to_string(layerDims), debug);
-        const auto& weights = l["weights"];
 
         if(checkBatchNorm<T>(batch_norm, type, layerDims, weights, debug))
         {
@@ -233,15 +355,14 @@ namespace modelt_detail
         json_stream_idx++;
     }
 
-    template <typename T, int num_filters, int num_features, bool affine>
-    void loadLayer(BatchNorm2DT<T, num_filters, num_features, affine>& batch_norm, int& json_stream_idx, const nlohmann::json& l,
+    template <typename T, int num_filters, int num_features, bool affine, typename WeightsType>
+    void loadLayer(BatchNorm2DT<T, num_filters, num_features, affine>& batch_norm, int& json_stream_idx, const nlohmann::json& l, const WeightsType& weights,
         const std::string& type, int layerDims, bool debug)
     {
         using namespace json_parser;
 
         debug_print("Layer: " + type, debug);
         debug_print("  Dims: " + std::to_string(layerDims), debug);
-        const auto& weights = l["weights"];
 
         if(checkBatchNorm2D<T>(batch_norm, type, layerDims, weights, debug))
         {
@@ -252,28 +373,84 @@ namespace modelt_detail
         json_stream_idx++;
     }
 
-    template <typename T, int in_size, typename... Layers>
-    void parseJson(const nlohmann::json& parent, std::tuple<Layers...>& layers, const bool debug = false, std::initializer_list<std::string> custom_layers = {})
+    /** Checks the input shape of a model file against the model's input size. */
+    template <int in_size>
+    bool checkInShape(const nlohmann::json& shape, const bool debug)
     {
         using namespace json_parser;
 
-        auto shape = parent["in_shape"];
-        auto json_layers = parent["layers"];
-
-        if(!shape.is_array() || !json_layers.is_array())
-            return;
+        if(!shape.is_array())
+            return false;
 
         // If 4D: nDims is num_features * num_channels
-        const int nDims = shape.size() == 4 ? shape[2].get<int>() * shape[3].get<int>() : shape.back().get<int>();
+        const int nDims = getShapeDims(shape);
 
         debug_print("# dimensions: " + std::to_string(nDims), debug);
 
         if(nDims != in_size)
         {
             debug_print("Incorrect input size!", debug);
+            return false;
+        }
+
+        return true;
+    }
+
+    /** Loads one layer of the model from the json layer `l` and its weights. */
+    template <typename T, typename LayerType, typename WeightsType>
+    void loadModelLayer(LayerType& layer, int& json_stream_idx, const nlohmann::json& l, const WeightsType& weights,
+        const bool debug, std::initializer_list<std::string> custom_layers)
+    {
+        using namespace json_parser;
+
+        const auto type = l["type"].get<std::string>();
+
+        // If 4D: layerDims is num_features * num_channels
+        const int layerDims = getShapeDims(l["shape"]);
+
+        if(layer.isActivation()) // activation layers don't need initialisation
+        {
+            if(!l.contains("activation"))
+            {
+                debug_print("No activation layer expected!", debug);
+                return;
+            }
+
+            const auto activationType = l["activation"].get<std::string>();
+            if(!activationType.empty())
+            {
+                debug_print("  activation: " + activationType, debug);
+                checkActivation(layer, activationType, layerDims, debug);
+            }
+
+            json_stream_idx++;
             return;
         }
 
+        if(std::find(custom_layers.begin(), custom_layers.end(), type) != custom_layers.end())
+        {
+            debug_print("Skipping loading weights for custom layer: " + type, debug);
+            json_stream_idx++;
+            return;
+        }
+
+        modelt_detail::loadLayer<T>(layer, json_stream_idx, l, weights, type, layerDims, debug);
+    }
+
+    template <typename T, int in_size, typename... Layers>
+    void parseJson(const nlohmann::json& parent, std::tuple<Layers...>& layers, const bool debug = false, std::initializer_list<std::string> custom_layers = {})
+    {
+        using namespace json_parser;
+
+        const auto& shape = parent["in_shape"];
+        const auto& json_layers = parent["layers"];
+
+        if(!shape.is_array() || !json_layers.is_array())
+            return;
+
+        if(!checkInShape<in_size>(shape, debug))
+            return;
+
         int json_stream_idx = 0;
         modelt_detail::forEachInTuple([&](auto& layer, size_t)
             {
@@ -283,41 +460,59 @@ namespace modelt_detail
                     return;
                 }
 
-                const auto l = json_layers.at(json_stream_idx);
-                const auto type = l["type"].get<std::string>();
-                const auto layerShape = l["shape"];
+                const auto& l = json_layers.at(json_stream_idx);
+                loadModelLayer<T>(layer, json_stream_idx, l, l["weights"], debug, custom_layers); },
+            layers);
+    }
 
-                // If 4D: layerDims is num_features * num_channels
-                const int layerDims = layerShape.size() == 4 ? layerShape[2].get<int>() * layerShape[3].get<int>() : layerShape.back().get<int>();
+    /**
+     * Loads the model weights with ModelStreamParser, without holding the
+     * json document for the whole model in memory. Every json layer is
+     * handed to the model layers in turn, until one of them consumes it
+     * (a dense layer followed by its activation shares one json layer).
+     */
+    template <typename T, int in_size, typename... Layers>
+    void parseJsonStream(std::ifstream& jsonStream, std::tuple<Layers...>& layers, const bool debug = false, std::initializer_list<std::string> custom_layers = {})
+    {
+        using namespace json_parser;
 
-                if(layer.isActivation()) // activation layers don't need initialisation
-                {
-                    if(!l.contains("activation"))
-                    {
-                        debug_print("No activation layer expected!", debug);
-                        return;
-                    }
+        const auto startPos = jsonStream.tellg();
 
-                    const auto activationType = l["activation"].get<std::string>();
-                    if(!activationType.empty())
+        int json_stream_idx = 0;
+        size_t layer_idx = 0;
+
+        ModelStreamParser<T> parser;
+        parser.parse(
+            jsonStream,
+            [&](const nlohmann::json& shape)
+            { return checkInShape<in_size>(shape, debug); },
+            [&](const nlohmann::json& l, const WeightsView<T>& weights)
+            {
+                const int start_idx = json_stream_idx;
+                modelt_detail::forEachInTuple([&](auto& layer, size_t idx)
                     {
-                        debug_print("  activation: " + activationType, debug);
-                        checkActivation(layer, activationType, layerDims, debug);
-                    }
+                        if(idx < layer_idx || json_stream_idx != start_idx)
+                            return;
 
-                    json_stream_idx++;
-                    return;
-                }
+                        layer_idx++;
+                        loadModelLayer<T>(layer, json_stream_idx, l, weights, debug, custom_layers); },
+                    layers);
+                return true;
+            });
 
-                if(std::find(custom_layers.begin(), custom_layers.end(), type) != custom_layers.end())
-                {
-                    debug_print ("Skipping loading weights for custom layer: " + type, debug);
-                    json_stream_idx++;
-                    return;
-                }
+        if(parser.layersBeforeShape())
+        {
+            jsonStream.clear();
+            jsonStream.seekg(startPos);
 
-                modelt_detail::loadLayer<T>(layer, json_stream_idx, l, type, layerDims, debug); },
-            layers);
+            nlohmann::json parent;
+            jsonStream >> parent;
+            parseJson<T, in_size>(parent, layers, debug, custom_layers);
+            return;
+        }
+
+        for(; layer_idx < sizeof...(Layers); ++layer_idx)
+            debug_print("Too many layers!", debug);
     }
 } // namespace modelt_detail
 #endif // DOXYGEN
@@ -387,8 +582,7 @@ public:
 #else // RTNEURAL_USE_STL
         std::copy(input, input + in_size, v_ins);
 #endif
-        std::get<0>(layers).forward(v_ins);
-        modelt_detail::forward_unroll<1, n_layers - 1>::call(layers);
+        forwardLayers(v_ins);
 
 #if RTNEURAL_USE_XSIMD
         for(int i = 0; i < v_out_size; ++i)
@@ -414,8 +608,7 @@ public:
         v_ins[0] = input[0];
 #endif
 
-        std::get<0>(layers).forward(v_ins);
-        modelt_detail::forward_unroll<1, n_layers - 1>::call(layers);
+        forwardLayers(v_ins);
 
 #if RTNEURAL_USE_XSIMD
         for(int i = 0; i < v_out_size; ++i)
@@ -443,12 +636,38 @@ public:
     /** Loads neural network model weights from a json stream. */
     void parseJson(std::ifstream& jsonStream, const bool debug = false, std::initializer_list<std::string> custom_layers = {})
     {
-        nlohmann::json parent;
-        jsonStream >> parent;
-        return parseJson(parent, debug, custom_layers);
+        modelt_detail::parseJsonStream<T, in_size>(jsonStream, layers, debug, custom_layers);
+    }
+
+#if RTNEURAL_ENABLE_PROFILING
+    /** Returns the forward pass cost statistics of the layer at index `idx`. */
+    const LayerProfile& getLayerProfile(size_t idx) const noexcept
+    {
+        return profiles[idx];
+    }
+
+    /** Clears the cost statistics of all layers. */
+    void resetLayerProfiles() noexcept
+    {
+        for(auto& p : profiles)
+            p.reset();
     }
+#endif
 
 private:
+    template <typename InsType>
+    inline void forwardLayers(const InsType& ins) noexcept
+    {
+#if RTNEURAL_ENABLE_PROFILING
+        const auto start = ProfilerClock::now();
+        std::get<0>(layers).forward(ins);
+        profiles[0].add(ProfilerClock::elapsed(start, ProfilerClock::now()));
+        modelt_detail::forward_unroll_profiled<1, n_layers - 1>::call(layers, profiles);
+#else
+        modelt_detail::forward_unroll<0, n_layers>::call(layers, ins);
+#endif
+    }
+
 #if RTNEURAL_USE_XSIMD
     using v_type = xsimd::simd_type<T>;
     static constexpr auto v_size = (int)v_type::size;
@@ -469,6 +688,10 @@ private:
 
     std::tuple<Layers...> layers;
     static constexpr size_t n_layers = sizeof...(Layers);
+
+#if RTNEURAL_ENABLE_PROFILING
+    std::array<LayerProfile, n_layers> profiles {};
+#endif
 };
 
 #if RTNEURAL_USE_EIGEN || !RTNEURAL_USE_XSIMD
@@ -536,8 +759,7 @@ public:
             for(int i = 0; i < v_num_filters_in; ++i)
                 v_ins[feature_index * num_filters_in + i] = xsimd::load_aligned(load_arr + i * v_size);
         }
-        std::get<0>(layers).forward(v_ins);
-        modelt_detail::forward_unroll<1, n_layers - 1>::call(layers);
+        modelt_detail::forward_unroll<0, n_layers>::call(layers, v_ins);
 
         for(int feature_index = 0; feature_index < num_features_out; ++feature_index)
         {
@@ -565,9 +787,7 @@ public:
     /** Loads neural network model weights from a json stream. */
     void parseJson(std::ifstream& jsonStream, const bool debug = false, std::initializer_list<std::string> custom_layers = {})
     {
-        nlohmann::json parent;
-        jsonStream >> parent;
-        return parseJson(parent, debug, custom_layers);
+        modelt_detail::parseJsonStream<T, input_size>(jsonStream, layers, debug, custom_layers);
     }
 
 private:
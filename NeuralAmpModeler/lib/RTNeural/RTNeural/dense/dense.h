@@ -195,6 +195,18 @@ public:
             outs[i] = std::inner_product(ins, ins + in_size, &weights[i * in_size], (T)0) + bias[i];
     }
 
+    /**
+     * Performs forward propagation for this layer, passing each output
+     * value to `outputFn(i, value)` instead of storing it in `outs`.
+     * Used by ModelT to fuse the layer with a following activation.
+     */
+    template <typename OutputFn>
+    inline void forward(const T (&ins)[in_size], OutputFn&& outputFn) noexcept
+    {
+        for(int i = 0; i < out_size; ++i)
+            outputFn(i, std::inner_product(ins, ins + in_size, &weights[i * in_size], (T)0) + bias[i]);
+    }
+
     /**
      * Sets the layer weights from a given vector.
      *
@@ -241,6 +253,12 @@ public:
             bias[i] = b[i];
     }
 
+    /** Returns the weights value at the given indices. */
+    T getWeight(int i, int k) const noexcept { return weights[i * in_size + k]; }
+
+    /** Returns the bias value at the given index. */
+    T getBias(int i) const noexcept { return bias[i]; }
+
     T outs alignas(RTNEURAL_DEFAULT_ALIGNMENT)[out_size];
 
 private:
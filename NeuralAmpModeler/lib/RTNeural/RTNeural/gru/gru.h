@@ -174,9 +174,51 @@ public:
     void reset();
 
     /** Performs forward propagation for this layer. */
+    inline void forward(const T (&ins)[in_size]) noexcept
+    {
+        computeGates(ins);
+        computeOutput([](int, T) noexcept {});
+    }
+
+    /**
+     * Performs forward propagation for this layer, and passes each
+     * output value to `outputFn(i, value)` as soon as it is computed.
+     * Used by ModelT to fuse the layer with a following dense layer.
+     */
+    template <typename OutputFn>
+    inline void forward(const T (&ins)[in_size], OutputFn&& outputFn) noexcept
+    {
+        computeGates(ins);
+        computeOutput(outputFn);
+    }
+
+    /**
+     * Sets the layer kernel weights.
+     *
+     * The weights vector must have size weights[in_size][3 * out_size]
+     */
+    void setWVals(const std::vector<std::vector<T>>& wVals);
+
+    /**
+     * Sets the layer recurrent weights.
+     *
+     * The weights vector must have size weights[out_size][3 * out_size]
+     */
+    void setUVals(const std::vector<std::vector<T>>& uVals);
+
+    /**
+     * Sets the layer bias.
+     *
+     * The bias vector must have size weights[2][3 * out_size]
+     */
+    void setBVals(const std::vector<std::vector<T>>& bVals);
+
+    T outs alignas(RTNEURAL_DEFAULT_ALIGNMENT)[out_size];
+
+private:
     template <int N = in_size>
     inline typename std::enable_if<(N > 1), void>::type
-    forward(const T (&ins)[in_size]) noexcept
+    computeGates(const T (&ins)[in_size]) noexcept
     {
         // compute zt
         recurrent_mat_mul(outs, Uz, zt);
@@ -195,14 +237,11 @@ public:
         kernel_mat_mul(ins, Wh, kernel_outs);
         for(int i = 0; i < out_size; ++i)
             ht[i] = std::tanh(rt[i] * (ct[i] + bh1[i]) + bh0[i] + kernel_outs[i]);
-
-        computeOutput();
     }
 
-    /** Performs forward propagation for this layer. */
     template <int N = in_size>
     inline typename std::enable_if<N == 1, void>::type
-    forward(const T (&ins)[in_size]) noexcept
+    computeGates(const T (&ins)[in_size]) noexcept
     {
         // compute zt
         recurrent_mat_mul(outs, Uz, zt);
@@ -218,58 +257,38 @@ public:
         recurrent_mat_mul(outs, Uh, ct);
         for(int i = 0; i < out_size; ++i)
             ht[i] = std::tanh(rt[i] * (ct[i] + bh1[i]) + bh0[i] + (Wh_1[i] * ins[0]));
-
-        computeOutput();
     }
 
-    /**
-     * Sets the layer kernel weights.
-     *
-     * The weights vector must have size weights[in_size][3 * out_size]
-     */
-    void setWVals(const std::vector<std::vector<T>>& wVals);
-
-    /**
-     * Sets the layer recurrent weights.
-     *
-     * The weights vector must have size weights[out_size][3 * out_size]
-     */
-    void setUVals(const std::vector<std::vector<T>>& uVals);
-
-    /**
-     * Sets the layer bias.
-     *
-     * The bias vector must have size weights[2][3 * out_size]
-     */
-    void setBVals(const std::vector<std::vector<T>>& bVals);
-
-    T outs alignas(RTNEURAL_DEFAULT_ALIGNMENT)[out_size];
-
-private:
-    template <SampleRateCorrectionMode srCorr = sampleRateCorr>
+    template <SampleRateCorrectionMode srCorr = sampleRateCorr, typename OutputFn>
     inline std::enable_if_t<srCorr == SampleRateCorrectionMode::None, void>
-    computeOutput() noexcept
+    computeOutput(OutputFn&& outputFn) noexcept
     {
         for(int i = 0; i < out_size; ++i)
+        {
             outs[i] = ((T)1.0 - zt[i]) * ht[i] + zt[i] * outs[i];
+            outputFn(i, outs[i]);
+        }
     }
 
-    template <SampleRateCorrectionMode srCorr = sampleRateCorr>
+    template <SampleRateCorrectionMode srCorr = sampleRateCorr, typename OutputFn>
     inline std::enable_if_t<srCorr != SampleRateCorrectionMode::None, void>
-    computeOutput() noexcept
+    computeOutput(OutputFn&& outputFn) noexcept
     {
         for(int i = 0; i < out_size; ++i)
             outs_delayed[delayWriteIdx][i] = ((T)1.0 - zt[i]) * ht[i] + zt[i] * outs[i];
 
-        processDelay(outs_delayed, outs, delayWriteIdx);
+        processDelay(outs_delayed, outs, delayWriteIdx, outputFn);
     }
 
-    template <SampleRateCorrectionMode srCorr = sampleRateCorr>
+    template <SampleRateCorrectionMode srCorr = sampleRateCorr, typename OutputFn>
     inline std::enable_if_t<srCorr == SampleRateCorrectionMode::NoInterp, void>
-    processDelay(std::vector<std::array<T, out_size>>& delayVec, T (&out)[out_size], int delayWriteIndex) noexcept
+    processDelay(std::vector<std::array<T, out_size>>& delayVec, T (&out)[out_size], int delayWriteIndex, OutputFn&& outputFn) noexcept
     {
         for(int i = 0; i < out_size; ++i)
+        {
             out[i] = delayVec[0][i];
+            outputFn(i, out[i]);
+        }
 
         for(int j = 0; j < delayWriteIndex; ++j)
         {
@@ -278,12 +297,15 @@ private:
         }
     }
 
-    template <SampleRateCorrectionMode srCorr = sampleRateCorr>
+    template <SampleRateCorrectionMode srCorr = sampleRateCorr, typename OutputFn>
     inline std::enable_if_t<srCorr == SampleRateCorrectionMode::LinInterp, void>
-    processDelay(std::vector<std::array<T, out_size>>& delayVec, T (&out)[out_size], int delayWriteIndex) noexcept
+    processDelay(std::vector<std::array<T, out_size>>& delayVec, T (&out)[out_size], int delayWriteIndex, OutputFn&& outputFn) noexcept
     {
         for(int i = 0; i < out_size; ++i)
+        {
             out[i] = delayPlus1Mult * delayVec[0][i] + delayMult * delayVec[1][i];
+            outputFn(i, out[i]);
+        }
 
         for(int j = 0; j < delayWriteIndex; ++j)
         {
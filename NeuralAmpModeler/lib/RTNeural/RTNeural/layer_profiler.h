@@ -0,0 +1,89 @@
+#pragma once
+
+#if RTNEURAL_ENABLE_PROFILING
+
+#include <cstdint>
+#include <limits>
+
+#if defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_8M_MAIN__)
+#define RTNEURAL_PROFILER_DWT 1
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define RTNEURAL_PROFILER_TSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define RTNEURAL_PROFILER_TSC 1
+#else
+#include <chrono>
+#endif
+
+namespace RTNeural
+{
+
+/**
+ * Clock source used for the per-layer profiling.
+ *
+ * On Cortex-M this reads the DWT cycle counter (CYCCNT), which has
+ * to be enabled before use (the Teensy core does this at startup).
+ * On x86 the time stamp counter is used, and on all other platforms
+ * the ticks are nanoseconds from `std::chrono::steady_clock`.
+ */
+struct ProfilerClock
+{
+    using tick_type = uint64_t;
+
+    static inline tick_type now() noexcept
+    {
+#if RTNEURAL_PROFILER_DWT
+        return *reinterpret_cast<volatile uint32_t*>(0xE0001004);
+#elif RTNEURAL_PROFILER_TSC
+        return __rdtsc();
+#else
+        return (tick_type)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+#endif
+    }
+
+    /** Returns the ticks elapsed between two calls to `now()`. */
+    static inline tick_type elapsed(tick_type start, tick_type end) noexcept
+    {
+#if RTNEURAL_PROFILER_DWT
+        return (uint32_t)((uint32_t)end - (uint32_t)start); // CYCCNT wraps at 32 bits
+#else
+        return end - start;
+#endif
+    }
+};
+
+/** Running cost statistics of one layer's forward pass, in ProfilerClock ticks. */
+struct LayerProfile
+{
+    uint64_t count = 0;
+    uint64_t total = 0;
+    uint64_t min = std::numeric_limits<uint64_t>::max();
+    uint64_t max = 0;
+
+    inline void add(uint64_t ticks) noexcept
+    {
+        count++;
+        total += ticks;
+        min = ticks < min ? ticks : min;
+        max = ticks > max ? ticks : max;
+    }
+
+    /** Returns the mean cost of one forward pass, or zero if nothing was measured. */
+    double mean() const noexcept
+    {
+        return count > 0 ? (double)total / (double)count : 0.0;
+    }
+
+    void reset() noexcept
+    {
+        *this = LayerProfile {};
+    }
+};
+
+} // namespace RTNeural
+
+#endif // RTNEURAL_ENABLE_PROFILING
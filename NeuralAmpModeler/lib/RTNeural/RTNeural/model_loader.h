@@ -2,6 +2,7 @@
 
 #include "../modules/json/json.hpp"
 #include "Model.h"
+#include "model_stream_parser.h"
 #include <fstream>
 #include <memory>
 #include <string>
@@ -34,32 +35,32 @@ namespace json_parser
 #endif
 
     /** Loads weights for a Dense (or DenseT) layer from a json representation of the layer weights. */
-    template <typename T, typename DenseType>
-    void loadDense(DenseType& dense, const nlohmann::json& weights)
+    template <typename T, typename DenseType, typename WeightsType>
+    void loadDense(DenseType& dense, const WeightsType& weights)
     {
         // load weights
         std::vector<std::vector<T>> denseWeights(dense.out_size);
         for(auto& w : denseWeights)
             w.resize(dense.in_size, (T)0);
 
-        auto layerWeights = weights.at(0);
+        const auto& layerWeights = weights.at(0);
         for(size_t i = 0; i < layerWeights.size(); ++i)
         {
-            auto lw = layerWeights.at(i);
+            const auto& lw = layerWeights.at(i);
             for(size_t j = 0; j < lw.size(); ++j)
-                denseWeights.at(j).at(i) = lw.at(j).get<T>();
+                denseWeights.at(j).at(i) = lw.at(j).template get<T>();
         }
 
         dense.setWeights(denseWeights);
 
         // load biases
-        std::vector<T> denseBias = weights.at(1).get<std::vector<T>>();
+        std::vector<T> denseBias = weights.at(1).template get<std::vector<T>>();
         dense.setBias(denseBias.data());
     }
 
     /** Creates a Dense layer from a json representation of the layer weights. */
-    template <typename T>
-    std::unique_ptr<Dense<T>> createDense(int in_size, int out_size, const nlohmann::json& weights)
+    template <typename T, typename WeightsType>
+    std::unique_ptr<Dense<T>> createDense(int in_size, int out_size, const WeightsType& weights)
     {
         auto dense = std::make_unique<Dense<T>>(in_size, out_size);
         loadDense<T>(*dense.get(), weights);
@@ -86,8 +87,8 @@ namespace json_parser
     }
 
     /** Loads weights for a Conv1D (or Conv1DT) layer from a json representation of the layer weights. */
-    template <typename T, typename Conv1DType>
-    void loadConv1D(Conv1DType& conv, int kernel_size, int /*dilation*/, const nlohmann::json& weights)
+    template <typename T, typename Conv1DType, typename WeightsType>
+    void loadConv1D(Conv1DType& conv, int kernel_size, int /*dilation*/, const WeightsType& weights)
     {
         // load weights
         std::vector<std::vector<std::vector<T>>> convWeights(conv.out_size);
@@ -99,28 +100,28 @@ namespace json_parser
                 w.resize(kernel_size, (T)0);
         }
 
-        auto layerWeights = weights.at(0);
+        const auto& layerWeights = weights.at(0);
         for(size_t i = 0; i < layerWeights.size(); ++i)
         {
-            auto lw = layerWeights.at(i);
+            const auto& lw = layerWeights.at(i);
             for(size_t j = 0; j < lw.size(); ++j)
             {
-                auto l = lw.at(j);
+                const auto& l = lw.at(j);
                 for(size_t k = 0; k < l.size(); ++k)
-                    convWeights.at(k).at(j).at(kernel_size - 1 - i) = l.at(k).get<T>();
+                    convWeights.at(k).at(j).at(kernel_size - 1 - i) = l.at(k).template get<T>();
             }
         }
 
         conv.setWeights(convWeights);
 
         // load biases
-        std::vector<T> convBias = weights.at(1).get<std::vector<T>>();
+        std::vector<T> convBias = weights.at(1).template get<std::vector<T>>();
         conv.setBias(convBias);
     }
 
     /** Loads weights for a Conv2D (or Conv2DT) layer from a json representation of the layer weights. */
-    template <typename T, typename Conv2DType>
-    void loadConv2D(Conv2DType& conv2d, const nlohmann::json& weights)
+    template <typename T, typename Conv2DType, typename WeightsType>
+    void loadConv2D(Conv2DType& conv2d, const WeightsType& weights)
     {
         // load weights
         std::vector<std::vector<std::vector<std::vector<T>>>> convWeights(conv2d.kernel_size_time);
@@ -139,22 +140,22 @@ namespace json_parser
 
         // In Tensorflow (JSON file): [kernel_size_time, kernel_size_feature, num_filters_in, num_filters_out]
         // In RTNeural conv2d::setWeights: [kernel_size_time, num_filters_out, num_filters_in, kernel_size_feature]
-        auto layerWeights = weights.at(0);
+        const auto& layerWeights = weights.at(0);
         // Kernel Size Time
         for(size_t i = 0; i < layerWeights.size(); ++i)
         {
-            auto l1 = layerWeights.at(i);
+            const auto& l1 = layerWeights.at(i);
             // Kernel Size feature
             for(size_t j = 0; j < l1.size(); ++j)
             {
-                auto l2 = l1.at(j);
+                const auto& l2 = l1.at(j);
                 // Num filters in
                 for(size_t k = 0; k < l2.size(); ++k)
                 {
-                    auto l3 = l2.at(k);
+                    const auto& l3 = l2.at(k);
                     // Num filters out
                     for(size_t p = 0; p < l3.size(); ++p)
-                        convWeights.at(i).at(p).at(k).at(j) = l3.at(p).get<T>();
+                        convWeights.at(i).at(p).at(k).at(j) = l3.at(p).template get<T>();
                 }
             }
         }
@@ -162,14 +163,14 @@ namespace json_parser
         conv2d.setWeights(convWeights);
 
         // load biases
-        std::vector<T> convBias = weights.at(1).get<std::vector<T>>();
+        std::vector<T> convBias = weights.at(1).template get<std::vector<T>>();
         conv2d.setBias(convBias);
     }
 
     /** Creates a Conv1D layer from a json representation of the layer weights. */
-    template <typename T>
+    template <typename T, typename WeightsType>
     std::unique_ptr<Conv1D<T>> createConv1D(int in_size, int out_size,
-        int kernel_size, int dilation, const nlohmann::json& weights)
+        int kernel_size, int dilation, const WeightsType& weights)
     {
         auto conv = std::make_unique<Conv1D<T>>(in_size, out_size, kernel_size, dilation);
         loadConv1D<T>(*conv.get(), kernel_size, dilation, weights);
@@ -208,9 +209,9 @@ namespace json_parser
         return true;
     }
 
-    template <typename T>
+    template <typename T, typename WeightsType>
     std::unique_ptr<Conv2D<T>> createConv2D(int num_filters_in, int num_features_in, int num_filters_out,
-        int kernel_size_time, int kernel_size_feature, int dilation, int stride, bool valid_pad, const nlohmann::json& weights)
+        int kernel_size_time, int kernel_size_feature, int dilation, int stride, bool valid_pad, const WeightsType& weights)
     {
         auto conv = std::make_unique<Conv2D<T>>(num_filters_in, num_filters_out, num_features_in, kernel_size_time, kernel_size_feature, dilation, stride, valid_pad);
         loadConv2D<T>(*conv.get(), weights);
@@ -262,20 +263,20 @@ namespace json_parser
     }
 
     /** Loads weights for a GRULayer (or GRULayerT) from a json representation of the layer weights. */
-    template <typename T, typename GRUType>
-    void loadGRU(GRUType& gru, const nlohmann::json& weights)
+    template <typename T, typename GRUType, typename WeightsType>
+    void loadGRU(GRUType& gru, const WeightsType& weights)
     {
         // load kernel weights
         std::vector<std::vector<T>> kernelWeights(gru.in_size);
         for(auto& w : kernelWeights)
             w.resize(3 * gru.out_size, (T)0);
 
-        auto layerWeights = weights.at(0);
+        const auto& layerWeights = weights.at(0);
         for(size_t i = 0; i < layerWeights.size(); ++i)
         {
-            auto lw = layerWeights.at(i);
+            const auto& lw = layerWeights.at(i);
             for(size_t j = 0; j < lw.size(); ++j)
-                kernelWeights.at(i).at(j) = lw.at(j).get<T>();
+                kernelWeights.at(i).at(j) = lw.at(j).template get<T>();
         }
 
         gru.setWVals(kernelWeights);
@@ -285,12 +286,12 @@ namespace json_parser
         for(auto& w : recurrentWeights)
             w.resize(3 * gru.out_size, (T)0);
 
-        auto layerWeights2 = weights.at(1);
+        const auto& layerWeights2 = weights.at(1);
         for(size_t i = 0; i < layerWeights2.size(); ++i)
         {
-            auto lw = layerWeights2.at(i);
+            const auto& lw = layerWeights2.at(i);
             for(size_t j = 0; j < lw.size(); ++j)
-                recurrentWeights.at(i).at(j) = lw.at(j).get<T>();
+                recurrentWeights.at(i).at(j) = lw.at(j).template get<T>();
         }
 
         gru.setUVals(recurrentWeights);
@@ -300,20 +301,20 @@ namespace json_parser
         for(auto& b : gruBias)
             b.resize(3 * gru.out_size, (T)0);
 
-        auto layerBias = weights.at(2);
+        const auto& layerBias = weights.at(2);
         for(size_t i = 0; i < layerBias.size(); ++i)
         {
-            auto lw = layerBias.at(i);
+            const auto& lw = layerBias.at(i);
             for(size_t j = 0; j < lw.size(); ++j)
-                gruBias.at(i).at(j) = lw.at(j).get<T>();
+                gruBias.at(i).at(j) = lw.at(j).template get<T>();
         }
 
         gru.setBVals(gruBias);
     }
 
     /** Creates a GRULayer from a json representation of the layer weights. */
-    template <typename T>
-    std::unique_ptr<GRULayer<T>> createGRU(int in_size, int out_size, const nlohmann::json& weights)
+    template <typename T, typename WeightsType>
+    std::unique_ptr<GRULayer<T>> createGRU(int in_size, int out_size, const WeightsType& weights)
     {
         auto gru = std::make_unique<GRULayer<T>>(in_size, out_size);
         loadGRU<T>(*gru.get(), weights);
@@ -340,20 +341,20 @@ namespace json_parser
     }
 
     /** Loads weights for a LSTMLayer (or LSTMLayerT) from a json representation of the layer weights. */
-    template <typename T, typename LSTMType>
-    void loadLSTM(LSTMType& lstm, const nlohmann::json& weights)
+    template <typename T, typename LSTMType, typename WeightsType>
+    void loadLSTM(LSTMType& lstm, const WeightsType& weights)
     {
         // load kernel weights
         std::vector<std::vector<T>> kernelWeights(lstm.in_size);
         for(auto& w : kernelWeights)
             w.resize(4 * lstm.out_size, (T)0);
 
-        auto layerWeights = weights.at(0);
+        const auto& layerWeights = weights.at(0);
         for(size_t i = 0; i < layerWeights.size(); ++i)
         {
-            auto lw = layerWeights.at(i);
+            const auto& lw = layerWeights.at(i);
             for(size_t j = 0; j < lw.size(); ++j)
-                kernelWeights.at(i).at(j) = lw.at(j).get<T>();
+                kernelWeights.at(i).at(j) = lw.at(j).template get<T>();
         }
 
         lstm.setWVals(kernelWeights);
@@ -363,24 +364,24 @@ namespace json_parser
         for(auto& w : recurrentWeights)
             w.resize(4 * lstm.out_size, (T)0);
 
-        auto layerWeights2 = weights.at(1);
+        const auto& layerWeights2 = weights.at(1);
         for(size_t i = 0; i < layerWeights2.size(); ++i)
         {
-            auto lw = layerWeights2.at(i);
+            const auto& lw = layerWeights2.at(i);
             for(size_t j = 0; j < lw.size(); ++j)
-                recurrentWeights.at(i).at(j) = lw.at(j).get<T>();
+                recurrentWeights.at(i).at(j) = lw.at(j).template get<T>();
         }
 
         lstm.setUVals(recurrentWeights);
 
         // load biases
-        std::vector<T> lstmBias = weights.at(2).get<std::vector<T>>();
+        std::vector<T> lstmBias = weights.at(2).template get<std::vector<T>>();
         lstm.setBVals(lstmBias);
     }
 
     /** Creates a LSTMLayer from a json representation of the layer weights. */
-    template <typename T>
-    std::unique_ptr<LSTMLayer<T>> createLSTM(int in_size, int out_size, const nlohmann::json& weights)
+    template <typename T, typename WeightsType>
+    std::unique_ptr<LSTMLayer<T>> createLSTM(int in_size, int out_size, const WeightsType& weights)
     {
         auto lstm = std::make_unique<LSTMLayer<T>>(in_size, out_size);
         loadLSTM<T>(*lstm.get(), weights);
@@ -407,16 +408,16 @@ namespace json_parser
     }
 
     /** Loads weights for a PReLUActivation (or PReLUActivationT) from a json representation of the layer weights. */
-    template <typename T, typename PReLUType>
-    void loadPReLU(PReLUType& prelu, const nlohmann::json& weights)
+    template <typename T, typename PReLUType, typename WeightsType>
+    void loadPReLU(PReLUType& prelu, const WeightsType& weights)
     {
-        std::vector<T> preluWeights = weights.at(0).at(0).get<std::vector<T>>();
+        std::vector<T> preluWeights = weights.at(0).at(0).template get<std::vector<T>>();
         prelu.setAlphaVals(preluWeights);
     }
 
     /** Creates a PReLUActivation from a json representation of the layer weights. */
-    template <typename T>
-    std::unique_ptr<PReLUActivation<T>> createPReLU(int in_size, const nlohmann::json& weights)
+    template <typename T, typename WeightsType>
+    std::unique_ptr<PReLUActivation<T>> createPReLU(int in_size, const WeightsType& weights)
     {
         auto prelu = std::make_unique<PReLUActivation<T>>(in_size);
         loadPReLU<T>(*prelu.get(), weights);
@@ -443,33 +444,33 @@ namespace json_parser
     }
 
     /** Loads weights for a BatchNorm1DLayer (or BatchNorm1DT) or BatchNorm2DLayer (or BatchNorm2DT) from a json representation of the layer weights. */
-    template <typename T, typename BatchNormType>
-    void loadBatchNorm(BatchNormType& batch_norm, const nlohmann::json& weights, bool affine)
+    template <typename T, typename BatchNormType, typename WeightsType>
+    void loadBatchNorm(BatchNormType& batch_norm, const WeightsType& weights, bool affine)
     {
         if(affine)
         {
-            batch_norm.setGamma(weights.at(0).get<std::vector<T>>());
-            batch_norm.setBeta(weights.at(1).get<std::vector<T>>());
-            batch_norm.setRunningMean(weights.at(2).get<std::vector<T>>());
-            batch_norm.setRunningVariance(weights.at(3).get<std::vector<T>>());
+            batch_norm.setGamma(weights.at(0).template get<std::vector<T>>());
+            batch_norm.setBeta(weights.at(1).template get<std::vector<T>>());
+            batch_norm.setRunningMean(weights.at(2).template get<std::vector<T>>());
+            batch_norm.setRunningVariance(weights.at(3).template get<std::vector<T>>());
         }
         else
         {
-            batch_norm.setRunningMean(weights.at(0).get<std::vector<T>>());
-            batch_norm.setRunningVariance(weights.at(1).get<std::vector<T>>());
+            batch_norm.setRunningMean(weights.at(0).template get<std::vector<T>>());
+            batch_norm.setRunningVariance(weights.at(1).template get<std::vector<T>>());
         }
     }
 
     /** Loads weights for a BatchNorm1DLayer (or BatchNorm1DT) from a json representation of the layer weights. */
-    template <typename T, typename BatchNormType>
-    void loadBatchNorm(BatchNormType& batch_norm, const nlohmann::json& weights)
+    template <typename T, typename BatchNormType, typename WeightsType>
+    void loadBatchNorm(BatchNormType& batch_norm, const WeightsType& weights)
     {
         loadBatchNorm<T>(batch_norm, weights, BatchNormType::is_affine);
     }
 
     /** Creates a BatchNorm1DLayer from a json representation of the layer weights. */
-    template <typename T>
-    std::unique_ptr<BatchNorm1DLayer<T>> createBatchNorm(int size, const nlohmann::json& weights, T epsilon)
+    template <typename T, typename WeightsType>
+    std::unique_ptr<BatchNorm1DLayer<T>> createBatchNorm(int size, const WeightsType& weights, T epsilon)
     {
         auto batch_norm = std::make_unique<BatchNorm1DLayer<T>>(size);
         loadBatchNorm<T>(*batch_norm.get(), weights, weights.size() == 4);
@@ -477,8 +478,8 @@ namespace json_parser
         return std::move(batch_norm);
     }
 
-    template <typename T>
-    std::unique_ptr<BatchNorm2DLayer<T>> createBatchNorm2D(int num_filters_in, int num_features_in, const nlohmann::json& weights, T epsilon)
+    template <typename T, typename WeightsType>
+    std::unique_ptr<BatchNorm2DLayer<T>> createBatchNorm2D(int num_filters_in, int num_features_in, const WeightsType& weights, T epsilon)
     {
         auto batch_norm = std::make_unique<BatchNorm2DLayer<T>>(num_filters_in, num_features_in);
         loadBatchNorm<T>(*batch_norm.get(), weights, weights.size() == 4);
@@ -487,8 +488,8 @@ namespace json_parser
     }
 
     /** Checks that a BatchNorm1DLayer (or BatchNorm1DT) has the given dimensions. */
-    template <typename T, typename BatchNormType>
-    bool checkBatchNorm(const BatchNormType& batch_norm, const std::string& type, int layerDims, const nlohmann::json& weights, const bool debug)
+    template <typename T, typename BatchNormType, typename WeightsType>
+    bool checkBatchNorm(const BatchNormType& batch_norm, const std::string& type, int layerDims, const WeightsType& weights, const bool debug)
     {
         if(type != "batchnorm")
         {
@@ -517,8 +518,8 @@ namespace json_parser
     }
 
     /** Checks that a BatchNorm2DLayer (or BatchNorm2DT) has the given dimensions. */
-    template <typename T, typename BatchNormType>
-    bool checkBatchNorm2D(const BatchNormType& batch_norm, const std::string& type, int layerDims, const nlohmann::json& weights, const bool debug)
+    template <typename T, typename BatchNormType, typename WeightsType>
+    bool checkBatchNorm2D(const BatchNormType& batch_norm, const std::string& type, int layerDims, const WeightsType& weights, const bool debug)
     {
         if(type != "batchnorm2d")
         {
@@ -595,17 +596,121 @@ namespace json_parser
         return true;
     }
 
+    /** Returns the number of input dimensions for a model or layer shape. */
+    inline int getShapeDims(const nlohmann::json& shape)
+    {
+        // In case of 4 dimensional input (conv2d): multiply channel axis and feature axis to get layer dim
+        return shape.size() == 4 ? shape[2].get<int>() * shape[3].get<int>() : shape.back().get<int>();
+    }
+
+    /**
+     * Creates the layer(s) described by the json object `l` and adds them
+     * to the model. The weights can either be the json "weights" entry, or
+     * a WeightsView collected by ModelStreamParser.
+     */
+    template <typename T, typename WeightsType>
+    bool parseLayer(Model<T>& model, const nlohmann::json& l, const WeightsType& weights, const bool debug = false)
+    {
+        const auto type = l.at("type").get<std::string>();
+        debug_print("Layer: " + type, debug);
+
+        const int layerDims = getShapeDims(l.at("shape"));
+
+        debug_print("  Dims: " + std::to_string(layerDims), debug);
+
+        auto add_activation = [=](Model<T>& _model, const nlohmann::json& _l)
+        {
+            if(_l.contains("activation"))
+            {
+                const auto activationType = _l["activation"].get<std::string>();
+                if(!activationType.empty())
+                {
+                    debug_print("  activation: " + activationType, debug);
+                    auto activation = createActivation<T>(activationType, layerDims);
+                    _model.addLayer(activation.release());
+                }
+            }
+        };
+
+        if(type == "dense" || type == "time-distributed-dense")
+        {
+            auto dense = createDense<T>(model.getNextInSize(), layerDims, weights);
+            model.addLayer(dense.release());
+            add_activation(model, l);
+        }
+        else if(type == "conv1d")
+        {
+            const auto kernel_size = l.at("kernel_size").back().get<int>();
+            const auto dilation = l.at("dilation").back().get<int>();
+
+            auto conv = createConv1D<T>(model.getNextInSize(), layerDims, kernel_size, dilation, weights);
+            model.addLayer(conv.release());
+            add_activation(model, l);
+        }
+        else if(type == "conv2d")
+        {
+            const auto kernel_size_time = l.at("kernel_size_time").back().get<int>();
+            const auto kernel_size_feature = l.at("kernel_size_feature").back().get<int>();
+            const auto dilation = l.at("dilation").back().get<int>();
+            const auto stride = l.at("strides").back().get<int>();
+            const auto num_filters_in = l.at("num_filters_in").back().get<int>();
+            const auto num_features_in = l.at("num_features_in").back().get<int>();
+            const auto num_filters_out = l.at("num_filters_out").back().get<int>();
+            const bool valid_pad = l.at("padding").get<std::string>() == "valid";
+
+            auto conv = createConv2D<T>(num_filters_in, num_features_in, num_filters_out, kernel_size_time, kernel_size_feature, dilation, stride, valid_pad, weights);
+
+            // Check the layer
+            if(!checkConv2D<T>(*conv, "conv2d", layerDims, kernel_size_time, kernel_size_feature, dilation, stride, valid_pad, debug))
+                return false;
+
+            model.addLayer(conv.release());
+            add_activation(model, l);
+        }
+        else if(type == "gru")
+        {
+            auto gru = createGRU<T>(model.getNextInSize(), layerDims, weights);
+            model.addLayer(gru.release());
+        }
+        else if(type == "lstm")
+        {
+            auto lstm = createLSTM<T>(model.getNextInSize(), layerDims, weights);
+            model.addLayer(lstm.release());
+        }
+        else if(type == "prelu")
+        {
+            auto prelu = createPReLU<T>(model.getNextInSize(), weights);
+            model.addLayer(prelu.release());
+        }
+        else if(type == "batchnorm")
+        {
+            auto batch_norm = createBatchNorm<T>(model.getNextInSize(), weights, l.at("epsilon").template get<T>());
+            model.addLayer(batch_norm.release());
+        }
+        else if(type == "batchnorm2d")
+        {
+            auto batch_norm = createBatchNorm2D<T>(l.at("num_filters_in"), l.at("num_features_in"), weights, l.at("epsilon").template get<T>());
+            model.addLayer(batch_norm.release());
+        }
+        else if(type == "activation")
+        {
+            add_activation(model, l);
+        }
+
+        return true;
+    }
+
     /** Creates a neural network model from a json stream. */
     template <typename T>
     std::unique_ptr<Model<T>> parseJson(const nlohmann::json& parent, const bool debug = false)
     {
-        auto shape = parent.at("in_shape");
-        auto layers = parent.at("layers");
+        const auto& shape = parent.at("in_shape");
+        const auto& layers = parent.at("layers");
 
         if(!shape.is_array() || !layers.is_array())
             return {};
 
-        const int nDims = shape.size() == 4 ? shape[2].get<int>() * shape[3].get<int>() : shape.back().get<int>();
+        const int nDims = getShapeDims(shape);
 
         debug_print("# dimensions: " + std::to_string(nDims), debug);
 
@@ -613,108 +718,57 @@ namespace json_parser
 
         for(const auto& l : layers)
         {
-            const auto type = l.at("type").get<std::string>();
-            debug_print("Layer: " + type, debug);
-
-            const auto layerShape = l.at("shape");
-
-            // In case of 4 dimensional input (conv2d): multiply channel axis and feature axis to get layer dim
-            const int layerDims = layerShape.size() == 4 ? layerShape[2].get<int>() * layerShape[3].get<int>() : layerShape.back().get<int>();
+            if(!parseLayer<T>(*model, l, l.at("weights"), debug))
+                return {};
+        }
 
-            debug_print("  Dims: " + std::to_string(layerDims), debug);
+        return std::move(model);
+    }
 
-            const auto weights = l.at("weights");
+    /**
+     * Creates a neural network model from a json stream.
+     *
+     * The model is read with ModelStreamParser, so the json document for
+     * the whole model is never held in memory: only the layer currently
+     * being loaded is. Files with the "layers" before the "in_shape" fall
+     * back to parsing the whole json document.
+     */
+    template <typename T>
+    std::unique_ptr<Model<T>> parseJson(std::ifstream& jsonStream, const bool debug = false)
+    {
+        const auto startPos = jsonStream.tellg();
 
-            auto add_activation = [=](std::unique_ptr<Model<T>>& _model, const nlohmann::json& _l)
+        std::unique_ptr<Model<T>> model;
+        ModelStreamParser<T> parser;
+        const bool ok = parser.parse(
+            jsonStream,
+            [&](const nlohmann::json& shape)
             {
-                if(_l.contains("activation"))
-                {
-                    const auto activationType = _l["activation"].get<std::string>();
-                    if(!activationType.empty())
-                    {
-                        debug_print("  activation: " + activationType, debug);
-                        auto activation = createActivation<T>(activationType, layerDims);
-                        _model->addLayer(activation.release());
-                    }
-                }
-            };
+                if(!shape.is_array())
+                    return false;
 
-            if(type == "dense" || type == "time-distributed-dense")
-            {
-                auto dense = createDense<T>(model->getNextInSize(), layerDims, weights);
-                model->addLayer(dense.release());
-                add_activation(model, l);
-            }
-            else if(type == "conv1d")
-            {
-                const auto kernel_size = l.at("kernel_size").back().get<int>();
-                const auto dilation = l.at("dilation").back().get<int>();
+                const int nDims = getShapeDims(shape);
+                debug_print("# dimensions: " + std::to_string(nDims), debug);
+                model = std::make_unique<Model<T>>(nDims);
+                return true;
+            },
+            [&](const nlohmann::json& l, const WeightsView<T>& weights)
+            { return parseLayer<T>(*model, l, weights, debug); });
 
-                auto conv = createConv1D<T>(model->getNextInSize(), layerDims, kernel_size, dilation, weights);
-                model->addLayer(conv.release());
-                add_activation(model, l);
-            }
-            else if(type == "conv2d")
-            {
-                const auto kernel_size_time = l.at("kernel_size_time").back().get<int>();
-                const auto kernel_size_feature = l.at("kernel_size_feature").back().get<int>();
-                const auto dilation = l.at("dilation").back().get<int>();
-                const auto stride = l.at("strides").back().get<int>();
-                const auto num_filters_in = l.at("num_filters_in").back().get<int>();
-                const auto num_features_in = l.at("num_features_in").back().get<int>();
-                const auto num_filters_out = l.at("num_filters_out").back().get<int>();
-                const bool valid_pad = l.at("padding").get<std::string>() == "valid";
-
-                auto conv = createConv2D<T>(num_filters_in, num_features_in, num_filters_out, kernel_size_time, kernel_size_feature, dilation, stride, valid_pad, weights);
-
-                // Check the layer
-                if(!checkConv2D<T>(*conv, "conv2d", layerDims, kernel_size_time, kernel_size_feature, dilation, stride, valid_pad, debug))
-                    return {};
-
-                model->addLayer(conv.release());
-                add_activation(model, l);
-            }
-            else if(type == "gru")
-            {
-                auto gru = createGRU<T>(model->getNextInSize(), layerDims, weights);
-                model->addLayer(gru.release());
-            }
-            else if(type == "lstm")
-            {
-                auto lstm = createLSTM<T>(model->getNextInSize(), layerDims, weights);
-                model->addLayer(lstm.release());
-            }
-            else if(type == "prelu")
-            {
-                auto prelu = createPReLU<T>(model->getNextInSize(), weights);
-                model->addLayer(prelu.release());
-            }
-            else if(type == "batchnorm")
-            {
-                auto batch_norm = createBatchNorm<T>(model->getNextInSize(), weights, l.at("epsilon").get<T>());
-                model->addLayer(batch_norm.release());
-            }
-            else if(type == "batchnorm2d")
-            {
-                auto batch_norm = createBatchNorm2D<T>(l.at("num_filters_in"), l.at("num_features_in"), weights, l.at("epsilon").get<T>());
-                model->addLayer(batch_norm.release());
-            }
-            else if(type == "activation")
-            {
-                add_activation(model, l);
-            }
+        if(parser.layersBeforeShape())
+        {
+            jsonStream.clear();
+            jsonStream.seekg(startPos);
+
+            nlohmann::json parent;
+            jsonStream >> parent;
+            return parseJson<T>(parent, debug);
         }
 
-        return std::move(model);
-    }
+        if(!ok)
+            return {};
 
-    /** Creates a neural network model from a json stream. */
-    template <typename T>
-    std::unique_ptr<Model<T>> parseJson(std::ifstream& jsonStream, const bool debug = false)
-    {
-        nlohmann::json parent;
-        jsonStream >> parent;
-        return parseJson<T>(parent, debug);
+        return model;
     }
 
 } // namespace json_parser
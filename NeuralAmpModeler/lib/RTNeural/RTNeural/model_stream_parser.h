@@ -0,0 +1,496 @@
+#pragma once
+
+#include "../modules/json/json.hpp"
+#include <functional>
+#include <istream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace RTNeural
+{
+namespace json_parser
+{
+    /**
+     * Non-owning view of a weights tensor (or a slice of it), stored
+     * as a flat row-major array. Mirrors the parts of the nlohmann::json
+     * interface used by the layer loaders, so that the loaders can read
+     * the weights from either representation.
+     */
+    template <typename T>
+    class TensorView
+    {
+    public:
+        TensorView(const T* tensorData, const size_t* tensorDims, size_t tensorRank)
+            : data(tensorData)
+            , dims(tensorDims)
+            , rank(tensorRank)
+        {
+        }
+
+        /** Returns the size of the outermost dimension. */
+        size_t size() const noexcept { return rank > 0 ? dims[0] : 0; }
+
+        /** Returns a view of the sub-tensor at index `idx` of the outermost dimension. */
+        TensorView at(size_t idx) const
+        {
+            if(rank == 0 || idx >= dims[0])
+                throw std::out_of_range("TensorView index " + std::to_string(idx) + " is out of range!");
+
+            size_t stride = 1;
+            for(size_t d = 1; d < rank; ++d)
+                stride *= dims[d];
+
+            return { data + idx * stride, dims + 1, rank - 1 };
+        }
+
+        TensorView operator[](size_t idx) const { return at(idx); }
+
+        /** Returns the value of a scalar, or the values of a one-dimensional tensor as a std::vector. */
+        template <typename U>
+        U get() const
+        {
+            return getAs(Tag<U> {});
+        }
+
+    private:
+        template <typename U>
+        struct Tag
+        {
+        };
+
+        template <typename U>
+        U getAs(Tag<U>) const
+        {
+            if(rank != 0)
+                throw std::domain_error("TensorView is not a scalar!");
+            return static_cast<U>(*data);
+        }
+
+        std::vector<T> getAs(Tag<std::vector<T>>) const
+        {
+            if(rank != 1)
+                throw std::domain_error("TensorView is not one-dimensional!");
+            return std::vector<T>(data, data + dims[0]);
+        }
+
+        const T* data;
+        const size_t* dims;
+        size_t rank;
+    };
+
+    /** The list of weight tensors of a single layer, as collected by ModelStreamParser. */
+    template <typename T>
+    class WeightsView
+    {
+    public:
+        struct TensorInfo
+        {
+            size_t valuesOffset;
+            size_t dimsOffset;
+            size_t rank;
+        };
+
+        WeightsView(const std::vector<T>& weightValues, const std::vector<size_t>& weightDims, const std::vector<TensorInfo>& weightTensors)
+            : values(weightValues)
+            , dims(weightDims)
+            , tensors(weightTensors)
+        {
+        }
+
+        /** Returns the number of weight tensors. */
+        size_t size() const noexcept { return tensors.size(); }
+
+        /** Returns a view of the weight tensor at index `idx`. */
+        TensorView<T> at(size_t idx) const
+        {
+            const auto& info = tensors.at(idx);
+            return { values.data() + info.valuesOffset, dims.data() + info.dimsOffset, info.rank };
+        }
+
+        TensorView<T> operator[](size_t idx) const { return at(idx); }
+
+    private:
+        const std::vector<T>& values;
+        const std::vector<size_t>& dims;
+        const std::vector<TensorInfo>& tensors;
+    };
+
+    /**
+     * Streaming (SAX) parser for RTNeural model files.
+     *
+     * Instead of building a json document for the whole model, the parser
+     * only keeps the layer that is currently being read. The small layer
+     * attributes (type, shape, activation, ...) are collected into a json
+     * object, while the weights are written straight into a flat array of
+     * numbers which is reused for every layer. The extra memory needed for
+     * loading a model is therefore bounded by the size of its largest layer.
+     *
+     * The "in_shape" entry is expected to come before the "layers" array,
+     * which is always the case for files exported by the RTNeural python
+     * utilities. `layersBeforeShape()` reports files where this is not the
+     * case, so that the caller can fall back to the json document parser.
+     */
+    template <typename T>
+    class ModelStreamParser
+    {
+    public:
+        using ShapeCallback = std::function<bool(const nlohmann::json&)>;
+        using LayerCallback = std::function<bool(const nlohmann::json&, const WeightsView<T>&)>;
+
+        /**
+         * Parses a model from the stream, calling `onShape` with the
+         * "in_shape" entry and `onLayer` with every completed layer.
+         * Returns false if parsing was stopped by one of the callbacks,
+         * or if the weights are not rectangular tensors. Malformed json
+         * throws a nlohmann::json::parse_error, like the document parser.
+         */
+        bool parse(std::istream& stream, ShapeCallback onShape, LayerCallback onLayer)
+        {
+            shapeCallback = std::move(onShape);
+            layerCallback = std::move(onLayer);
+
+            depth = 0;
+            skipDepth = 0;
+            inLayers = false;
+            inWeights = false;
+            hasShape = false;
+            shapeMissing = false;
+            capture = nullptr;
+            builderStack.clear();
+            tensorCounts.clear();
+
+            return nlohmann::json::sax_parse(stream, this);
+        }
+
+        /** Returns true if the last parse stopped because a layer came before "in_shape". */
+        bool layersBeforeShape() const noexcept { return shapeMissing; }
+
+        // nlohmann::json SAX interface
+        bool null() { return scalar(nullptr); }
+        bool boolean(bool val) { return scalar(val); }
+        bool number_integer(nlohmann::json::number_integer_t val) { return number(val); }
+        bool number_unsigned(nlohmann::json::number_unsigned_t val) { return number(val); }
+        bool number_float(nlohmann::json::number_float_t val, const std::string&) { return number(val); }
+        bool string(std::string& val) { return scalar(val); }
+        bool binary(nlohmann::json::binary_t&) { return false; }
+
+        bool start_object(std::size_t)
+        {
+            const auto level = depth++;
+            if(skipDepth > 0)
+                return ++skipDepth, true;
+
+            if(capture != nullptr)
+                return builderStart(nlohmann::json::object()), true;
+
+            if(inWeights)
+                return false; // weights can only contain arrays of numbers
+
+            if(level == 0) // root object
+                return true;
+
+            if(level == 2 && inLayers) // new layer
+            {
+                layerInfo = nlohmann::json::object();
+                values.clear();
+                dims.clear();
+                tensors.clear();
+                return true;
+            }
+
+            if(beginValue())
+                builderStart(nlohmann::json::object());
+            else
+                ++skipDepth;
+
+            return true;
+        }
+
+        bool key(std::string& val)
+        {
+            if(skipDepth > 0)
+                return true;
+
+            if(capture != nullptr)
+                builderKey = val;
+            else
+                currentKey = val;
+
+            return true;
+        }
+
+        bool end_object()
+        {
+            const auto level = --depth;
+            if(skipDepth > 0)
+                return --skipDepth, true;
+
+            if(capture != nullptr)
+                return builderEnd();
+
+            if(level == 2 && inLayers) // layer completed
+            {
+                if(!hasShape)
+                {
+                    shapeMissing = true;
+                    return false;
+                }
+
+                return layerCallback(layerInfo, WeightsView<T> { values, dims, tensors });
+            }
+
+            return true;
+        }
+
+        bool start_array(std::size_t)
+        {
+            const auto level = depth++;
+            if(skipDepth > 0)
+                return ++skipDepth, true;
+
+            if(capture != nullptr)
+                return builderStart(nlohmann::json::array()), true;
+
+            if(inWeights)
+                return tensorStartArray(), true;
+
+            if(level == 0 || (level == 2 && inLayers)) // the root and the layers must be objects
+                return false;
+
+            if(level == 1 && currentKey == "layers")
+                return inLayers = true, true;
+
+            if(level == 3 && inLayers && currentKey == "weights")
+                return inWeights = true, true;
+
+            if(beginValue())
+                builderStart(nlohmann::json::array());
+            else
+                ++skipDepth;
+
+            return true;
+        }
+
+        bool end_array()
+        {
+            const auto level = --depth;
+            if(skipDepth > 0)
+                return --skipDepth, true;
+
+            if(capture != nullptr)
+                return builderEnd();
+
+            if(inWeights)
+            {
+                if(level == 3) // end of the weights list
+                    return inWeights = false, true;
+
+                return tensorEndArray();
+            }
+
+            if(level == 1 && inLayers)
+                inLayers = false;
+
+            return true;
+        }
+
+        template <class Exception>
+        bool parse_error(std::size_t, const std::string&, const Exception& ex)
+        {
+            throw ex;
+        }
+
+    private:
+        /** Decides where a value starting at the current position goes, returns false if it should be ignored. */
+        bool beginValue()
+        {
+            const auto level = depth - 1;
+            if(level == 1 && currentKey == "in_shape")
+            {
+                capture = &inShape;
+                return true;
+            }
+
+            if(level == 3 && inLayers)
+            {
+                capture = &layerInfo[currentKey];
+                return true;
+            }
+
+            return false;
+        }
+
+        template <typename V>
+        bool number(V val)
+        {
+            if(inWeights && skipDepth == 0 && capture == nullptr)
+                return tensorValue((T)val);
+
+            return scalar(val);
+        }
+
+        template <typename V>
+        bool scalar(V&& val)
+        {
+            if(skipDepth > 0)
+                return true;
+
+            if(capture != nullptr)
+                return builderValue(nlohmann::json(std::forward<V>(val)));
+
+            if(inWeights || (depth == 2 && inLayers)) // weights can only contain numbers, layers must be objects
+                return false;
+
+            ++depth; // a scalar is a value one level down, like the contents of a container
+            const bool keep = beginValue();
+            --depth;
+
+            return keep ? builderValue(nlohmann::json(std::forward<V>(val))) : true;
+        }
+
+        // collecting the (small) json values of the layer attributes and the input shape
+        void builderStart(nlohmann::json&& container)
+        {
+            builderStack.push_back(builderAdd(std::move(container)));
+        }
+
+        nlohmann::json* builderAdd(nlohmann::json&& val)
+        {
+            if(builderStack.empty())
+            {
+                *capture = std::move(val);
+                return capture;
+            }
+
+            auto* parent = builderStack.back();
+            if(parent->is_array())
+            {
+                parent->push_back(std::move(val));
+                return &parent->back();
+            }
+
+            auto& child = (*parent)[builderKey];
+            child = std::move(val);
+            return &child;
+        }
+
+        bool builderValue(nlohmann::json&& val)
+        {
+            builderAdd(std::move(val));
+            return builderStack.empty() ? builderDone() : true;
+        }
+
+        bool builderEnd()
+        {
+            builderStack.pop_back();
+            return builderStack.empty() ? builderDone() : true;
+        }
+
+        bool builderDone()
+        {
+            const bool isShape = capture == &inShape;
+            capture = nullptr;
+
+            if(isShape)
+            {
+                hasShape = true;
+                return shapeCallback(inShape);
+            }
+
+            return true;
+        }
+
+        // collecting the weights tensors into the flat values array
+        void tensorStartArray()
+        {
+            if(tensorCounts.empty()) // new tensor
+            {
+                tensorDims.clear();
+                tensors.push_back({ values.size(), 0, 0 });
+            }
+            else
+            {
+                tensorCounts.back()++;
+            }
+
+            tensorCounts.push_back(0);
+            if(tensorDims.size() < tensorCounts.size())
+                tensorDims.push_back(unknownDim());
+        }
+
+        bool tensorValue(T val)
+        {
+            if(tensorCounts.empty()) // a scalar directly inside the weights list
+            {
+                tensors.push_back({ values.size(), dims.size(), 0 });
+                values.push_back(val);
+                return true;
+            }
+
+            // numbers and arrays can't be mixed, and numbers have to be on the innermost level
+            if(tensorCounts.size() < tensorDims.size())
+                return false;
+
+            tensorCounts.back()++;
+            values.push_back(val);
+            return true;
+        }
+
+        bool tensorEndArray()
+        {
+            const auto level = tensorCounts.size() - 1;
+            const auto count = tensorCounts.back();
+            tensorCounts.pop_back();
+
+            // all the arrays on the same level must have the same size
+            if(tensorDims[level] == unknownDim())
+                tensorDims[level] = count;
+            else if(tensorDims[level] != count)
+                return false;
+
+            if(tensorCounts.empty()) // tensor completed
+            {
+                auto& info = tensors.back();
+                info.dimsOffset = dims.size();
+                info.rank = tensorDims.size();
+                dims.insert(dims.end(), tensorDims.begin(), tensorDims.end());
+
+                size_t numValues = 1;
+                for(auto d : tensorDims)
+                    numValues *= d;
+
+                return values.size() - info.valuesOffset == numValues;
+            }
+
+            return true;
+        }
+
+        static constexpr size_t unknownDim() { return (size_t)-1; }
+
+        ShapeCallback shapeCallback;
+        LayerCallback layerCallback;
+
+        int depth = 0;
+        int skipDepth = 0;
+        std::string currentKey;
+        bool inLayers = false;
+        bool hasShape = false;
+        bool shapeMissing = false;
+
+        nlohmann::json inShape;
+        nlohmann::json layerInfo;
+        nlohmann::json* capture = nullptr;
+        std::vector<nlohmann::json*> builderStack;
+        std::string builderKey;
+
+        bool inWeights = false;
+        std::vector<size_t> tensorCounts;
+        std::vector<size_t> tensorDims;
+
+        std::vector<T> values;
+        std::vector<size_t> dims;
+        std::vector<typename WeightsView<T>::TensorInfo> tensors;
+    };
+} // namespace json_parser
+} // namespace RTNeural
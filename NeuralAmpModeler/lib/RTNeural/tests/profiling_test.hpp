@@ -0,0 +1,80 @@
+#pragma once
+
+#include <iostream>
+#include <RTNeural.h>
+
+#if RTNEURAL_ENABLE_PROFILING
+namespace profiling_test
+{
+int checkProfile(const RTNeural::LayerProfile& profile, uint64_t expectedCount, size_t layerIdx)
+{
+    if(profile.count != expectedCount)
+    {
+        std::cout << "  FAIL: layer " << layerIdx << " measured " << profile.count
+                  << " forward passes, expected " << expectedCount << std::endl;
+        return 1;
+    }
+
+    if(expectedCount > 0 && ((double)profile.min > profile.mean() || profile.mean() > (double)profile.max))
+    {
+        std::cout << "  FAIL: layer " << layerIdx << " statistics out of order! min: " << profile.min
+                  << ", mean: " << profile.mean() << ", max: " << profile.max << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+} // namespace profiling_test
+#endif
+
+int profilingTest()
+{
+#if RTNEURAL_ENABLE_PROFILING
+    using namespace RTNeural;
+    using TestType = double;
+    constexpr int numSamples = 1000;
+
+    std::cout << "TESTING PER-LAYER PROFILING..." << std::endl;
+    int result = 0;
+
+    std::ifstream jsonStream1("models/gru_1d.json", std::ifstream::binary);
+    auto model = json_parser::parseJson<TestType>(jsonStream1);
+    model->reset();
+
+    std::ifstream jsonStream2("models/gru_1d.json", std::ifstream::binary);
+    ModelT<TestType, 1, 1,
+        GRULayerT<TestType, 1, 8>,
+        DenseT<TestType, 8, 8>,
+        SigmoidActivationT<TestType, 8>,
+        DenseT<TestType, 8, 1>>
+        modelT;
+    modelT.parseJson(jsonStream2);
+    modelT.reset();
+
+    for(int n = 0; n < numSamples; ++n)
+    {
+        TestType input[] = { std::sin((TestType)n * (TestType)0.01) };
+        model->forward(input);
+        modelT.forward(input);
+    }
+
+    for(size_t i = 0; i < model->layers.size(); ++i)
+        result |= profiling_test::checkProfile(model->getLayerProfile((int)i), numSamples, i);
+
+    for(size_t i = 0; i < 4; ++i)
+        result |= profiling_test::checkProfile(modelT.getLayerProfile(i), numSamples, i);
+
+    model->resetLayerProfiles();
+    modelT.resetLayerProfiles();
+    result |= profiling_test::checkProfile(model->getLayerProfile(0), 0, 0);
+    result |= profiling_test::checkProfile(modelT.getLayerProfile(0), 0, 0);
+
+    if(result == 0)
+        std::cout << "SUCCESS" << std::endl;
+
+    return result;
+#else
+    std::cout << "Per-layer profiling is not enabled, skipping..." << std::endl;
+    return 0;
+#endif
+}
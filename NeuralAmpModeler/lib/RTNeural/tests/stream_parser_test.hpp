@@ -0,0 +1,157 @@
+#pragma once
+
+#include <iostream>
+#include <sstream>
+#include <RTNeural.h>
+
+#include "load_csv.hpp"
+#include "test_configs.hpp"
+
+namespace stream_parser_test
+{
+using TestType = double;
+
+/** Checks that the streamed model gives exactly the same output as the one loaded from the json document. */
+int compareWithDocumentParser(const TestConfig& test)
+{
+    std::ifstream jsonStream1(test.model_file, std::ifstream::binary);
+    nlohmann::json parent;
+    jsonStream1 >> parent;
+    auto docModel = RTNeural::json_parser::parseJson<TestType>(parent);
+
+    std::ifstream jsonStream2(test.model_file, std::ifstream::binary);
+    auto streamModel = RTNeural::json_parser::parseJson<TestType>(jsonStream2);
+
+    if(docModel == nullptr || streamModel == nullptr)
+    {
+        std::cout << "  FAIL: " << test.name << " model could not be loaded!" << std::endl;
+        return 1;
+    }
+
+    if(docModel->layers.size() != streamModel->layers.size())
+    {
+        std::cout << "  FAIL: " << test.name << " streamed model has " << streamModel->layers.size()
+                  << " layers, expected " << docModel->layers.size() << std::endl;
+        return 1;
+    }
+
+    docModel->reset();
+    streamModel->reset();
+
+    std::ifstream pythonX(test.x_data_file);
+    const auto xData = load_csv::loadFile<TestType>(pythonX);
+
+    for(size_t n = 0; n < xData.size(); ++n)
+    {
+        TestType input[] = { xData[n] };
+        const auto yDoc = docModel->forward(input);
+        const auto yStream = streamModel->forward(input);
+        if(yDoc != yStream)
+        {
+            std::cout << "  FAIL: " << test.name << " output mismatch at sample " << n << std::endl;
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+int checkFallback()
+{
+    // layers before the input shape can't be streamed, the parser has to report it
+    std::istringstream stream(R"({ "layers": [ { "type": "dense", "shape": [ null, 1 ], "weights": [ [ [ 1.0 ] ], [ 0.0 ] ] } ],
+                                   "in_shape": [ null, 1 ] })");
+
+    RTNeural::json_parser::ModelStreamParser<TestType> parser;
+    const auto ok = parser.parse(
+        stream, [](const nlohmann::json&)
+        { return true; },
+        [](const nlohmann::json&, const RTNeural::json_parser::WeightsView<TestType>&)
+        { return true; });
+
+    if(ok || !parser.layersBeforeShape())
+    {
+        std::cout << "  FAIL: layers before the input shape were not reported!" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+int checkWeights()
+{
+    std::istringstream stream(R"({ "in_shape": [ null, 2 ], "layers": [
+        { "type": "dense", "activation": "tanh", "shape": [ null, 3 ], "extra": { "a": [ 1, { "b": 2 } ] },
+          "weights": [ [ [ 1, 2, 3 ], [ 4, 5, 6 ] ], [ 0.5, -0.5, 0.25 ], 7 ] } ] })");
+
+    int result = 0;
+    int numLayers = 0;
+
+    RTNeural::json_parser::ModelStreamParser<TestType> parser;
+    const auto ok = parser.parse(
+        stream, [](const nlohmann::json& shape)
+        { return shape.back().get<int>() == 2; },
+        [&](const nlohmann::json& l, const RTNeural::json_parser::WeightsView<TestType>& weights)
+        {
+            numLayers++;
+            if(l.at("type") != "dense" || l.at("activation") != "tanh" || l.at("shape").back() != 3
+                || l.at("extra").at("a").at(1).at("b") != 2 || l.contains("weights"))
+            {
+                std::cout << "  FAIL: layer attributes not collected correctly!" << std::endl;
+                result = 1;
+            }
+
+            if(weights.size() != 3 || weights.at(0).size() != 2 || weights.at(0).at(1).size() != 3
+                || weights.at(0).at(1).at(2).get<TestType>() != (TestType)6
+                || weights.at(1).get<std::vector<TestType>>() != std::vector<TestType> { 0.5, -0.5, 0.25 }
+                || weights.at(2).get<TestType>() != (TestType)7)
+            {
+                std::cout << "  FAIL: weights not collected correctly!" << std::endl;
+                result = 1;
+            }
+
+            return true;
+        });
+
+    if(!ok || numLayers != 1)
+    {
+        std::cout << "  FAIL: model could not be parsed!" << std::endl;
+        return 1;
+    }
+
+    // ragged weights can't be loaded into a layer
+    std::istringstream raggedStream(R"({ "in_shape": [ null, 2 ], "layers": [
+        { "type": "dense", "shape": [ null, 2 ], "weights": [ [ [ 1, 2 ], [ 3 ] ] ] } ] })");
+
+    const auto raggedOk = parser.parse(
+        raggedStream, [](const nlohmann::json&)
+        { return true; },
+        [](const nlohmann::json&, const RTNeural::json_parser::WeightsView<TestType>&)
+        { return true; });
+
+    if(raggedOk)
+    {
+        std::cout << "  FAIL: ragged weights were accepted!" << std::endl;
+        result = 1;
+    }
+
+    return result;
+}
+} // namespace stream_parser_test
+
+int streamParserTest()
+{
+    std::cout << "TESTING STREAMING MODEL PARSER..." << std::endl;
+
+    int result = 0;
+    result |= stream_parser_test::checkWeights();
+    result |= stream_parser_test::checkFallback();
+
+    for(auto& testConfig : tests)
+        result |= stream_parser_test::compareWithDocumentParser(testConfig.second);
+
+    if(result == 0)
+        std::cout << "SUCCESS" << std::endl;
+
+    return result;
+}
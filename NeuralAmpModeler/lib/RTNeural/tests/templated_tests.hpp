@@ -4,6 +4,58 @@
 #include "test_configs.hpp"
 #include <iostream>
 
+#if MODELT_AVAILABLE && !RTNEURAL_USE_EIGEN && !RTNEURAL_USE_XSIMD
+namespace templated_tests
+{
+template <typename T, int in_size, int out_size, typename... Layers>
+constexpr int numLayers(const RTNeural::ModelT<T, in_size, out_size, Layers...>*) { return (int)sizeof...(Layers); }
+
+// runs the model layers one after another, without the fused layer kernels
+template <int idx, int n_layers>
+struct ForwardUnfused
+{
+    template <typename ModelType, typename InsType>
+    static void call(ModelType& model, const InsType& ins)
+    {
+        model.template get<idx>().forward(ins);
+        ForwardUnfused<idx + 1, n_layers>::call(model, model.template get<idx>().outs);
+    }
+};
+
+template <int n_layers>
+struct ForwardUnfused<n_layers, n_layers>
+{
+    template <typename ModelType, typename InsType>
+    static void call(ModelType&, const InsType&) { }
+};
+
+/** Checks that the model gives exactly the same output with and without the fused layer kernels. */
+template <typename T, typename ModelType>
+int checkFusedLayers(const TestConfig& test, const std::vector<T>& xData, const std::vector<T>& yData)
+{
+    constexpr auto n_layers = numLayers((ModelType*)nullptr);
+
+    std::ifstream jsonStream(test.model_file, std::ifstream::binary);
+    ModelType refModel;
+    refModel.parseJson(jsonStream);
+    refModel.reset();
+
+    for(size_t n = 0; n < xData.size(); ++n)
+    {
+        T input alignas(RTNEURAL_DEFAULT_ALIGNMENT)[1] = { xData[n] };
+        ForwardUnfused<0, n_layers>::call(refModel, input);
+        if(refModel.template get<n_layers - 1>().outs[0] != yData[n])
+        {
+            std::cout << "FAIL: fused layers output differs at sample " << n << std::endl;
+            return 1;
+        }
+    }
+
+    return 0;
+}
+} // namespace templated_tests
+#endif
+
 template <typename T, typename ModelType>
 int runTestTemplated(const TestConfig& test)
 {
@@ -27,6 +79,11 @@ int runTestTemplated(const TestConfig& test)
         yData[n] = model.forward(input);
     }
 
+#if MODELT_AVAILABLE && !RTNEURAL_USE_EIGEN && !RTNEURAL_USE_XSIMD
+    if(templated_tests::checkFusedLayers<T, ModelType>(test, xData, yData))
+        return 1;
+#endif
+
     size_t nErrs = 0;
     T max_error = (T)0;
     for(size_t n = 0; n < xData.size(); ++n)
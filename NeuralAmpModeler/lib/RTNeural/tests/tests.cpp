@@ -3,7 +3,9 @@
 #include "conv2d_model.h"
 #include "load_csv.hpp"
 #include "model_test.hpp"
+#include "profiling_test.hpp"
 #include "sample_rate_rnn_test.hpp"
+#include "stream_parser_test.hpp"
 #include "templated_tests.hpp"
 #include "test_configs.hpp"
 #include "torch_conv1d_test.hpp"
@@ -25,6 +27,8 @@ void help()
     std::cout << "    approx" << std::endl;
     std::cout << "    sample_rate_rnn" << std::endl;
     std::cout << "    bad_model" << std::endl;
+    std::cout << "    profiling" << std::endl;
+    std::cout << "    stream_parser" << std::endl;
     std::cout << "    torch" << std::endl;
     for(auto& testConfig : tests)
         std::cout << "    " << testConfig.first << std::endl;
@@ -114,6 +118,8 @@ int main(int argc, char* argv[])
         result |= torchGRUTest();
         result |= torchConv1DTest();
         result |= torchLSTMTest();
+        result |= profilingTest();
+        result |= streamParserTest();
 
         for(auto& testConfig : tests)
         {
@@ -155,6 +161,16 @@ int main(int argc, char* argv[])
         return badModelTest();
     }
 
+    if(arg == "profiling")
+    {
+        return profilingTest();
+    }
+
+    if(arg == "stream_parser")
+    {
+        return streamParserTest();
+    }
+
     if(arg == "torch")
     {
         int result = 0;
@@ -0,0 +1,170 @@
+/**
+ * @file AudioChain_F32.cpp
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Serial effect chain running the stages in place in one update().
+ * @version 0.1
+ * @date 2024-03-04
+ */
+#include "AudioChain_F32.h"
+
+void AudioChain_F32::update()
+{
+	audio_block_f32_t *blockL, *blockR;
+
+	if (bp || running == 0) // pass through
+	{
+		blockL = AudioStream_F32::receiveReadOnly_f32(0);
+		blockR = AudioStream_F32::receiveReadOnly_f32(1);
+		for (uint8_t i = 0; i < count; i++) stages[i].stage->idleBlock(blockL ? blockL->length : AUDIO_BLOCK_SAMPLES);
+		if (blockL) AudioStream_F32::transmit(blockL, 0);
+		if (blockR) AudioStream_F32::transmit(blockR, 1);
+		if (blockL) AudioStream_F32::release(blockL);
+		if (blockR) AudioStream_F32::release(blockR);
+		return;
+	}
+	blockL = AudioStream_F32::receiveWritable_f32(0);
+	blockR = AudioStream_F32::receiveWritable_f32(1);
+	if (!blockL || !blockR)
+	{
+		if (blockL) AudioStream_F32::release(blockL);
+		if (blockR) AudioStream_F32::release(blockR);
+		return;
+	}
+	const uint16_t len = blockL->length;
+	bool stopped = false;
+	for (uint8_t i = 0; i < count; i++)
+	{
+		stage_t &s = stages[i];
+		if (s.mode == STAGE_OFF)
+		{
+			s.stage->idleBlock(len);
+			continue;
+		}
+		uint32_t t0 = ARM_DWT_CYCCNT;
+		if (s.mode == STAGE_ON)
+		{
+			s.stage->processBlock(blockL->data, blockR->data, len);
+		}
+		else // tail: silent input, output added to the dry signal
+		{
+			float32_t peakL, peakR;
+			uint32_t idx;
+			arm_fill_f32(0.0f, tailL, len);
+			arm_fill_f32(0.0f, tailR, len);
+			s.stage->processBlock(tailL, tailR, len);
+			arm_add_f32(blockL->data, tailL, blockL->data, len);
+			arm_add_f32(blockR->data, tailR, blockR->data, len);
+			arm_abs_f32(tailL, tailL, len);
+			arm_abs_f32(tailR, tailR, len);
+			arm_max_f32(tailL, len, &peakL, &idx);
+			arm_max_f32(tailR, len, &peakR, &idx);
+			if (peakL >= s.tailThreshold || peakR >= s.tailThreshold) s.tailQuiet = 0;
+			else if ((s.tailQuiet += len) >= s.tailHold)
+			{
+				s.mode = STAGE_OFF;
+				stopped = true;
+			}
+		}
+		uint32_t cycles = ARM_DWT_CYCCNT - t0;
+		if (cycles > s.cyclesMax) s.cyclesMax = cycles;
+	}
+	if (stopped) countRunning();
+	AudioStream_F32::transmit(blockL, 0);
+	AudioStream_F32::transmit(blockR, 1);
+	AudioStream_F32::release(blockL);
+	AudioStream_F32::release(blockR);
+}
+
+void AudioChain_F32::countRunning()
+{
+	uint8_t n = 0;
+	for (uint8_t i = 0; i < count; i++)
+		if (stages[i].mode != STAGE_OFF) n++;
+	running = n;
+}
+
+bool AudioChain_F32::insert(uint8_t pos, AudioChainStage_F32 &stage)
+{
+	if (count >= AUDIO_CHAIN_MAX_STAGES || pos > count) return false;
+	__disable_irq();
+	for (uint8_t i = count; i > pos; i--) stages[i] = stages[i - 1];
+	stages[pos].stage = &stage;
+	stages[pos].cyclesMax = 0;
+	stages[pos].tailThreshold = 0.0f;
+	stages[pos].tailHold = 0;
+	stages[pos].tailQuiet = 0;
+	stages[pos].mode = STAGE_ON;
+	stages[pos].enabled = true;
+	count++;
+	countRunning();
+	__enable_irq();
+	return true;
+}
+
+bool AudioChain_F32::remove(uint8_t pos)
+{
+	if (pos >= count) return false;
+	__disable_irq();
+	for (uint8_t i = pos; i < count - 1; i++) stages[i] = stages[i + 1];
+	count--;
+	countRunning();
+	__enable_irq();
+	return true;
+}
+
+bool AudioChain_F32::move(uint8_t from, uint8_t to)
+{
+	if (from >= count || to >= count) return false;
+	__disable_irq();
+	stage_t s = stages[from];
+	int8_t dir = to > from ? 1 : -1;
+	for (uint8_t i = from; i != to; i += dir) stages[i] = stages[i + dir];
+	stages[to] = s;
+	__enable_irq();
+	return true;
+}
+
+bool AudioChain_F32::stageEnable(uint8_t pos, bool state)
+{
+	if (pos >= count) return false;
+	__disable_irq();
+	stage_t &s = stages[pos];
+	s.enabled = state;
+	if (state) s.mode = STAGE_ON;
+	else if (s.mode == STAGE_ON)
+	{
+		s.mode = s.tailThreshold > 0.0f ? STAGE_TAIL : STAGE_OFF;
+		s.tailQuiet = 0;
+	}
+	countRunning();
+	__enable_irq();
+	return true;
+}
+
+bool AudioChain_F32::stageTail(uint8_t pos, bool state, float32_t thresholdDb, float32_t holdMs)
+{
+	if (pos >= count) return false;
+	float32_t thr = state ? powf(10.0f, thresholdDb / 20.0f) : 0.0f;
+	uint32_t hold = (uint32_t)(max(holdMs, 0.0f) * AUDIO_SAMPLE_RATE_EXACT / 1000.0f);
+	__disable_irq();
+	stages[pos].tailThreshold = thr;
+	stages[pos].tailHold = hold;
+	if (!state && stages[pos].mode == STAGE_TAIL) stages[pos].mode = STAGE_OFF;
+	countRunning();
+	__enable_irq();
+	return true;
+}
+
+float32_t AudioChain_F32::stageUsageMax(uint8_t pos)
+{
+	if (pos >= count) return 0.0f;
+	const float32_t block_cycles = (float32_t)F_CPU_ACTUAL * AUDIO_BLOCK_SAMPLES / AUDIO_SAMPLE_RATE_EXACT;
+	return 100.0f * (float32_t)stages[pos].cyclesMax / block_cycles;
+}
+
+void AudioChain_F32::stageUsageMaxReset()
+{
+	__disable_irq();
+	for (uint8_t i = 0; i < count; i++) stages[i].cyclesMax = 0;
+	__enable_irq();
+}
@@ -0,0 +1,175 @@
+/**
+ * @file AudioChain_F32.h
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Serial effect chain running the stages in place in one update().
+ * 		Instead of connecting the effects with AudioConnection_F32 objects,
+ * 		where every stage receives, transmits and releases its own pool
+ * 		blocks, the chain takes one pair of writable blocks and passes
+ * 		the buffers through the processBlock() of each stage.
+ * 		The order of the stages can be changed at runtime.
+ * 		Disabled stages are not run, only their idleBlock(). A stage in the tail mode
+ * 		(reverb, delay) keeps running on a silent input after it was
+ * 		disabled, its output is added to the dry signal until it stays
+ * 		below the threshold for the hold time, then it stops.
+ * 		A stage object which is also an AudioStream_F32 effect must not
+ * 		be connected with cables, unconnected objects are not updated
+ * 		by the audio scheduler.
+ * @version 0.1
+ * @date 2024-03-04
+ */
+#ifndef _AUDIOCHAIN_F32_H_
+#define _AUDIOCHAIN_F32_H_
+
+#include <Arduino.h>
+#include "AudioStream_F32.h"
+#include "arm_math.h"
+
+#define AUDIO_CHAIN_MAX_STAGES	(16)
+#define AUDIO_CHAIN_TAIL_THRESHOLD	(-90.0f)	// dB, tail peak level where a disabled stage stops
+#define AUDIO_CHAIN_TAIL_HOLD_MS	(1000.0f)	// time the tail has to stay below the threshold
+
+/**
+ * @brief Interface of the effects usable in AudioChain_F32
+ */
+class AudioChainStage_F32
+{
+public:
+	virtual ~AudioChainStage_F32() {}
+	/**
+	 * @brief Process a stereo block in place
+	 *
+	 * @param L left channel buffer
+	 * @param R right channel buffer
+	 * @param len number of samples, max AUDIO_BLOCK_SAMPLES
+	 */
+	virtual void processBlock(float32_t *L, float32_t *R, uint16_t len) = 0;
+	/**
+	 * @brief Called instead of processBlock() while the stage is off or
+	 * 			the chain is bypassed, to keep the parameter queues and
+	 * 			clocks running
+	 */
+	virtual void idleBlock(uint16_t len) {(void)len;}
+};
+
+/**
+ * @brief Linear time invariant stage (EQ, tone stack) whose response can be
+ * 			applied offline to other signals, ie. folded into an IR
+ */
+class AudioChainLinearStage_F32 : public AudioChainStage_F32
+{
+public:
+	/**
+	 * @brief Clear the state of the audio path
+	 */
+	virtual void reset() = 0;
+	/**
+	 * @brief Changes with every change of the settings
+	 */
+	virtual uint32_t getVersion() = 0;
+	/**
+	 * @brief Start the offline filter: snapshot of the current settings,
+	 * 			zero state. Not used by the audio path, call from loop().
+	 */
+	virtual void offlineReset() = 0;
+	/**
+	 * @brief Filter a mono buffer in place with the offline filter,
+	 * 			the state continues between the calls
+	 */
+	virtual void offlineProcess(float32_t *buf, uint32_t len) = 0;
+};
+
+class AudioChain_F32 : public AudioStream_F32
+{
+public:
+	AudioChain_F32() : AudioStream_F32(2, inputQueueArray_f32) {}
+	virtual void update(void);
+	/**
+	 * @brief Append a stage to the end of the chain
+	 * @return false if the chain is full
+	 */
+	bool add(AudioChainStage_F32 &stage) { return insert(count, stage); }
+	/**
+	 * @brief Insert a stage before the position pos
+	 * @return false if the chain is full or pos is out of range
+	 */
+	bool insert(uint8_t pos, AudioChainStage_F32 &stage);
+	bool remove(uint8_t pos);
+	/**
+	 * @brief Move a stage from one position to another, the stages
+	 * 			in between shift by one
+	 */
+	bool move(uint8_t from, uint8_t to);
+	void clear()
+	{
+		__disable_irq();
+		count = 0;
+		running = 0;
+		__enable_irq();
+	}
+	uint8_t size() {return count;}
+	AudioChainStage_F32 *get(uint8_t pos) {return pos < count ? stages[pos].stage : NULL;}
+	/**
+	 * @brief Enable or disable a stage, a disabled stage costs no cpu time
+	 * 			(after its tail decayed in the tail mode)
+	 */
+	bool stageEnable(uint8_t pos, bool state);
+	bool stageEnabled(uint8_t pos) {return pos < count ? stages[pos].enabled : false;}
+	/**
+	 * @brief Tail mode of a stage: when disabled, the stage runs on silence
+	 * 			and its output is added to the dry signal until the peak
+	 * 			level stays below the threshold for the hold time
+	 *
+	 * @param thresholdDb tail level in dB where the stage stops
+	 * @param holdMs at least the longest delay of the stage, the echoes of
+	 * 			a delay or a predelayed reverb come after silent gaps
+	 */
+	bool stageTail(uint8_t pos, bool state, float32_t thresholdDb = AUDIO_CHAIN_TAIL_THRESHOLD,
+				   float32_t holdMs = AUDIO_CHAIN_TAIL_HOLD_MS);
+	/**
+	 * @brief true if the stage is processed: enabled or its tail is decaying
+	 */
+	bool stageRunning(uint8_t pos) {return pos < count ? stages[pos].mode != STAGE_OFF : false;}
+	/**
+	 * @brief Bypass the whole chain, the input is passed to the output
+	 */
+	void bypass_set(bool state)
+	{
+		__disable_irq();
+		bp = state;
+		__enable_irq();
+	}
+	bool bypass_get(void) {return bp;}
+	/**
+	 * @brief Max CPU load of a stage in % of the audio block time
+	 * 			since the last reset
+	 */
+	float32_t stageUsageMax(uint8_t pos);
+	void stageUsageMaxReset();
+private:
+	typedef enum
+	{
+		STAGE_OFF,
+		STAGE_ON,
+		STAGE_TAIL
+	} stage_mode_t;
+	typedef struct
+	{
+		AudioChainStage_F32 *stage;
+		uint32_t cyclesMax;
+		float32_t tailThreshold;	// linear peak, 0 = no tail mode
+		uint32_t tailHold;			// samples below the threshold before the stage stops
+		uint32_t tailQuiet;			// samples below the threshold so far
+		stage_mode_t mode;
+		bool enabled;
+	} stage_t;
+	audio_block_f32_t *inputQueueArray_f32[2];
+	stage_t stages[AUDIO_CHAIN_MAX_STAGES];
+	float32_t tailL[AUDIO_BLOCK_SAMPLES];
+	float32_t tailR[AUDIO_BLOCK_SAMPLES];
+	uint8_t count = 0;
+	uint8_t running = 0;		// stages not off
+	void countRunning();
+	bool bp = false;
+};
+
+#endif // _AUDIOCHAIN_F32_H_
@@ -0,0 +1,384 @@
+/**
+ * @file AudioEffectPlateDattorro_F32.cpp
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Stereo plate reverb, Dattorro tank, block and lane processing
+ * @version 0.1
+ * @date 2024-03-20
+ */
+#include "AudioEffectPlateDattorro_F32.h"
+
+// delay lengths of the paper at PLATE_REF_RATE
+const uint16_t AudioEffectPlateDattorro_F32::diffuserDelays[PLATE_DIFFUSERS] = {142, 107, 379, 277};
+const uint16_t AudioEffectPlateDattorro_F32::tankDelays[2][TANK_LINES] =
+{
+	//	AP1		D1		AP2		D2
+	{	672,	4453,	1800,	3720},
+	{	908,	4217,	2656,	3163}
+};
+const AudioEffectPlateDattorro_F32::tap_t AudioEffectPlateDattorro_F32::taps[2][PLATE_TAPS] =
+{
+	{
+		{TANK_D1, 1, 266, 0.6f}, {TANK_D1, 1, 2974, 0.6f}, {TANK_AP2, 1, 1913, -0.6f}, {TANK_D2, 1, 1996, 0.6f},
+		{TANK_D1, 0, 1990, -0.6f}, {TANK_AP2, 0, 187, -0.6f}, {TANK_D2, 0, 1066, -0.6f}
+	},
+	{
+		{TANK_D1, 0, 353, 0.6f}, {TANK_D1, 0, 3627, 0.6f}, {TANK_AP2, 0, 1228, -0.6f}, {TANK_D2, 0, 2673, 0.6f},
+		{TANK_D1, 1, 2111, -0.6f}, {TANK_AP2, 1, 335, -0.6f}, {TANK_D2, 1, 121, -0.6f}
+	}
+};
+
+#define PLATE_DECAY_DIFF1		(-0.7f)		// modulated allpasses, inverted
+
+// power of 2 size for the delay, the block written after the reads
+static uint32_t lineSize(uint32_t delay)
+{
+	uint32_t n = 1;
+	while (n < delay + AUDIO_BLOCK_SAMPLES) n <<= 1;
+	return n;
+}
+
+AudioEffectPlateDattorro_F32::AudioEffectPlateDattorro_F32(bool psram) : AudioStream_F32(2, inputQueueArray_f32)
+{
+	const float32_t f = AUDIO_SAMPLE_RATE_EXACT / PLATE_REF_RATE;
+	excursion = PLATE_EXCURSION * f;
+	gatherExc = (uint32_t)excursion + 2;
+	if (gatherExc > PLATE_GATHER_PAD) linesLong = false;
+	uint32_t diffSizes[PLATE_DIFFUSERS], tankSizes[2 * TANK_LINES];
+	for (uint8_t k = 0; k < PLATE_DIFFUSERS; k++)
+	{
+		diffuser[k].delay = max(1u, (uint32_t)(diffuserDelays[k] * f + 0.5f));
+		diffuser[k].id = k;
+		diffSizes[k] = lineSize(diffuser[k].delay);
+	}
+	for (uint8_t lane = 0; lane < 2; lane++)
+	{
+		for (uint8_t n = 0; n < TANK_LINES; n++)
+		{
+			line_t &l = tank[lane][n];
+			l.delay = (uint32_t)(tankDelays[lane][n] * f + 0.5f);
+			l.id = lane * TANK_LINES + n;
+			tankSizes[l.id] = lineSize(l.delay + (n == TANK_AP1 ? gatherExc : 0));
+			const uint32_t shortest = n == TANK_AP1 ? l.delay - min(l.delay, gatherExc) : l.delay;
+			if (shortest < AUDIO_BLOCK_SAMPLES) linesLong = false;
+		}
+	}
+	// the taps of a channel are on the lines of both halves
+	for (uint8_t ch = 0; ch < 2; ch++)
+	{
+		for (uint8_t t = 0; t < PLATE_TAPS; t++)
+			tapDelay[ch][t] = min((uint32_t)(taps[ch][t].delay * f + 0.5f), tank[taps[ch][t].lane][taps[ch][t].line].delay);
+	}
+	if (!diffMem.begin(PLATE_DIFFUSERS, diffSizes, false) || !tankMem.begin(2 * TANK_LINES, tankSizes, psram))
+	{
+		diffMem.end();
+		tankMem.end();
+		return;
+	}
+	// the staging needs the lanes
+	if (!linesLong) tankMem.staging_set(false);
+	for (uint8_t k = 0; k < PLATE_DIFFUSERS; k++)
+	{
+		diffuser[k].buf = diffMem.getLine(k);
+		diffuser[k].mask = diffMem.getMask(k);
+	}
+	for (uint8_t lane = 0; lane < 2; lane++)
+	{
+		for (uint8_t n = 0; n < TANK_LINES; n++)
+		{
+			line_t &l = tank[lane][n];
+			l.buf = tankMem.getLine(l.id);
+			l.mask = tankMem.getMask(l.id);
+		}
+	}
+	ready = true;
+	const float32_t w = 2.0f * PI * PLATE_LFO_HZ / AUDIO_SAMPLE_RATE_EXACT;
+	lfoRot[0] = cosf(w);
+	lfoRot[1] = sinf(w);
+	reset();
+}
+
+void AudioEffectPlateDattorro_F32::reset()
+{
+	diffMem.reset();
+	tankMem.reset();
+	bwState = 0.0f;
+	dampState[0] = dampState[1] = 0.0f;
+}
+
+void AudioEffectPlateDattorro_F32::size(float32_t n)
+{
+	decay = 0.1f + 0.85f * constrain(n, 0.0f, 1.0f);
+}
+
+void AudioEffectPlateDattorro_F32::diffusion(float32_t n)
+{
+	n = constrain(n, 0.0f, 1.0f);
+	__disable_irq();
+	inDiff1 = 0.75f * n;
+	inDiff2 = 0.625f * n;
+	__enable_irq();
+}
+
+void AudioEffectPlateDattorro_F32::hidamp(float32_t n)
+{
+	damp = 0.0005f + 0.8f * constrain(n, 0.0f, 1.0f);
+}
+
+void AudioEffectPlateDattorro_F32::lowpass(float32_t n)
+{
+	bandwidth = 0.9995f * (0.05f + 0.95f * constrain(n, 0.0f, 1.0f));
+}
+
+void AudioEffectPlateDattorro_F32::mix(float32_t n)
+{
+	n = constrain(n, 0.0f, 1.0f);
+	__disable_irq();
+	wet = n;
+	dry = 1.0f - n;
+	__enable_irq();
+}
+
+// delays of the modulated allpasses for the block, sine and cosine LFO
+void AudioEffectPlateDattorro_F32::modulation(uint16_t len)
+{
+	float32_t s = lfo[0], c = lfo[1];
+	for (uint16_t i = 0; i < len; i++)
+	{
+		const float32_t sn = s * lfoRot[0] + c * lfoRot[1];
+		c = c * lfoRot[0] - s * lfoRot[1];
+		s = sn;
+		mod[0][i] = tank[0][TANK_AP1].delay + excursion * s;
+		mod[1][i] = tank[1][TANK_AP1].delay + excursion * c;
+	}
+	// keep the amplitude at 1
+	const float32_t g = 1.5f - 0.5f * (s * s + c * c);
+	lfo[0] = s * g;
+	lfo[1] = c * g;
+}
+
+// allpass over the block in chunks of max its delay: the samples read in a
+// chunk are older than the chunk, the loop has no dependency between the samples
+void AudioEffectPlateDattorro_F32::allpass(DelayMemory_F32 &m, const line_t &l, float32_t g, float32_t *x, uint16_t len)
+{
+	float32_t w[AUDIO_BLOCK_SAMPLES];
+	for (uint16_t o = 0; o < len;)
+	{
+		const uint16_t n = min((uint32_t)(len - o), l.delay);
+		m.read(l.id, pos + o - l.delay, w, n);
+		for (uint16_t i = 0; i < n; i++)
+		{
+			const float32_t v = x[o + i] + g * w[i];
+			x[o + i] = w[i] - g * v;
+			w[i] = v;
+		}
+		m.write(l.id, pos + o, w, n);
+		o += n;
+	}
+}
+
+void AudioEffectPlateDattorro_F32::processLanes(float32_t *L, float32_t *R, uint16_t len)
+{
+	const float32_t dec = decay, dampK = 1.0f - damp, bw = bandwidth;
+	const float32_t decDiff2 = constrain(dec + 0.15f, 0.25f, 0.5f);
+	const float32_t gIn[PLATE_DIFFUSERS] = {inDiff1, inDiff1, inDiff2, inDiff2};
+	float32_t x[AUDIO_BLOCK_SAMPLES], t[2][AUDIO_BLOCK_SAMPLES], u[2][AUDIO_BLOCK_SAMPLES];
+	float32_t g[AUDIO_BLOCK_SAMPLES + 2 * PLATE_GATHER_PAD];
+	// everything the tank reads in the block, fetched while the input runs
+	tankMem.block(pos, len);
+	for (uint8_t lane = 0; lane < 2; lane++)
+	{
+		const line_t *l = tank[lane];
+		tankMem.request(l[TANK_D2].id, pos - l[TANK_D2].delay, len);
+		tankMem.request(l[TANK_AP1].id, pos - l[TANK_AP1].delay - gatherExc, len + 2 * gatherExc);
+		tankMem.request(l[TANK_D1].id, pos - l[TANK_D1].delay, len);
+		tankMem.request(l[TANK_AP2].id, pos - l[TANK_AP2].delay, len);
+	}
+	for (uint8_t ch = 0; ch < 2; ch++)
+	{
+		for (uint8_t k = 0; k < PLATE_TAPS; k++)
+			tankMem.request(tank[taps[ch][k].lane][taps[ch][k].line].id, pos - tapDelay[ch][k], len);
+	}
+	tankMem.fetch();
+	// bandwidth filter, recursive
+	float32_t s = bwState;
+	for (uint16_t i = 0; i < len; i++)
+	{
+		s += bw * (0.5f * (L[i] + R[i]) - s);
+		x[i] = s;
+	}
+	bwState = s;
+	for (uint8_t k = 0; k < PLATE_DIFFUSERS; k++) allpass(diffMem, diffuser[k], gIn[k], x, len);
+	// tank inputs, the crossed feedback from the other half
+	tankMem.read(tank[1][TANK_D2].id, pos - tank[1][TANK_D2].delay, t[0], len);
+	tankMem.read(tank[0][TANK_D2].id, pos - tank[0][TANK_D2].delay, t[1], len);
+	for (uint8_t lane = 0; lane < 2; lane++)
+	{
+		for (uint16_t i = 0; i < len; i++) t[lane][i] = x[i] + dec * t[lane][i];
+		// modulated allpass: interpolated reads from the range of the block,
+		// g[0] is delay + gatherExc samples back, then the block math
+		const line_t &ap = tank[lane][TANK_AP1];
+		tankMem.read(ap.id, pos - ap.delay - gatherExc, g, len + 2 * gatherExc);
+		const uint32_t g0 = ap.delay + gatherExc;
+		for (uint16_t i = 0; i < len; i++)
+		{
+			const float32_t d = mod[lane][i];
+			const uint32_t di = (uint32_t)d;
+			const float32_t fr = d - di;
+			const float32_t a = g[g0 + i - di], b = g[g0 + i - di - 1];
+			u[lane][i] = a + fr * (b - a);
+		}
+		for (uint16_t i = 0; i < len; i++)
+		{
+			const float32_t v = t[lane][i] + PLATE_DECAY_DIFF1 * u[lane][i];
+			t[lane][i] = u[lane][i] - PLATE_DECAY_DIFF1 * v;
+			u[lane][i] = v;
+		}
+		tankMem.write(ap.id, pos, u[lane], len);
+		// 1st delay
+		const line_t &d1 = tank[lane][TANK_D1];
+		tankMem.read(d1.id, pos - d1.delay, u[lane], len);
+		tankMem.write(d1.id, pos, t[lane], len);
+	}
+	// damping, both halves in one loop
+	float32_t s0 = dampState[0], s1 = dampState[1];
+	for (uint16_t i = 0; i < len; i++)
+	{
+		s0 += dampK * (u[0][i] - s0);
+		s1 += dampK * (u[1][i] - s1);
+		u[0][i] = dec * s0;
+		u[1][i] = dec * s1;
+	}
+	dampState[0] = s0;
+	dampState[1] = s1;
+	for (uint8_t lane = 0; lane < 2; lane++)
+	{
+		allpass(tankMem, tank[lane][TANK_AP2], decDiff2, u[lane], len);
+		tankMem.write(tank[lane][TANK_D2].id, pos, u[lane], len);
+	}
+	// output taps, t is free now
+	for (uint8_t ch = 0; ch < 2; ch++)
+	{
+		float32_t *out = t[ch];
+		memset(out, 0, len * sizeof(float32_t));
+		for (uint8_t k = 0; k < PLATE_TAPS; k++)
+		{
+			const tap_t &tp = taps[ch][k];
+			tankMem.read(tank[tp.lane][tp.line].id, pos - tapDelay[ch][k], x, len);
+			for (uint16_t i = 0; i < len; i++) out[i] += tp.gain * x[i];
+		}
+	}
+	// the written samples back to the PSRAM, in the background until the next block
+	tankMem.commit();
+	const float32_t dr = dry, wt = wet;
+	for (uint16_t i = 0; i < len; i++)
+	{
+		L[i] = dr * L[i] + wt * t[0][i];
+		R[i] = dr * R[i] + wt * t[1][i];
+	}
+}
+
+// the same network sample by sample through all the lines
+void AudioEffectPlateDattorro_F32::processSamples(float32_t *L, float32_t *R, uint16_t len)
+{
+	const float32_t dec = decay, dampK = 1.0f - damp, bw = bandwidth;
+	const float32_t decDiff2 = constrain(dec + 0.15f, 0.25f, 0.5f);
+	const float32_t gIn[PLATE_DIFFUSERS] = {inDiff1, inDiff1, inDiff2, inDiff2};
+	const float32_t dr = dry, wt = wet;
+	for (uint16_t i = 0; i < len; i++)
+	{
+		const uint32_t p = pos + i;
+		bwState += bw * (0.5f * (L[i] + R[i]) - bwState);
+		float32_t x = bwState;
+		for (uint8_t k = 0; k < PLATE_DIFFUSERS; k++)
+		{
+			const line_t &l = diffuser[k];
+			const float32_t w = l.buf[(p - l.delay) & l.mask];
+			const float32_t v = x + gIn[k] * w;
+			x = w - gIn[k] * v;
+			l.buf[p & l.mask] = v;
+		}
+		const float32_t fb[2] = {tank[1][TANK_D2].buf[(p - tank[1][TANK_D2].delay) & tank[1][TANK_D2].mask],
+								 tank[0][TANK_D2].buf[(p - tank[0][TANK_D2].delay) & tank[0][TANK_D2].mask]};
+		for (uint8_t lane = 0; lane < 2; lane++)
+		{
+			float32_t t = x + dec * fb[lane];
+			const line_t &ap = tank[lane][TANK_AP1];
+			const float32_t d = mod[lane][i];
+			const uint32_t di = (uint32_t)d;
+			const float32_t fr = d - di;
+			const float32_t a = ap.buf[(p - di) & ap.mask], b = ap.buf[(p - di - 1) & ap.mask];
+			const float32_t w = a + fr * (b - a);
+			const float32_t v = t + PLATE_DECAY_DIFF1 * w;
+			t = w - PLATE_DECAY_DIFF1 * v;
+			ap.buf[p & ap.mask] = v;
+			const line_t &d1 = tank[lane][TANK_D1];
+			const float32_t y = d1.buf[(p - d1.delay) & d1.mask];
+			d1.buf[p & d1.mask] = t;
+			dampState[lane] += dampK * (y - dampState[lane]);
+			t = dec * dampState[lane];
+			const line_t &ap2 = tank[lane][TANK_AP2];
+			const float32_t w2 = ap2.buf[(p - ap2.delay) & ap2.mask];
+			const float32_t v2 = t + decDiff2 * w2;
+			t = w2 - decDiff2 * v2;
+			ap2.buf[p & ap2.mask] = v2;
+			const line_t &d2 = tank[lane][TANK_D2];
+			d2.buf[p & d2.mask] = t;
+		}
+		float32_t out[2] = {0.0f, 0.0f};
+		for (uint8_t ch = 0; ch < 2; ch++)
+		{
+			for (uint8_t k = 0; k < PLATE_TAPS; k++)
+			{
+				const tap_t &tp = taps[ch][k];
+				const line_t &l = tank[tp.lane][tp.line];
+				out[ch] += tp.gain * l.buf[(p - tapDelay[ch][k]) & l.mask];
+			}
+		}
+		L[i] = dr * L[i] + wt * out[0];
+		R[i] = dr * R[i] + wt * out[1];
+	}
+}
+
+void AudioEffectPlateDattorro_F32::processBlock(float32_t *L, float32_t *R, uint16_t len)
+{
+	if (bp || !ready || !len) return;
+	modulation(len);
+	// the staged tank is not accessible sample by sample
+	if (linesLong && (lanes || tankMem.staging_get())) processLanes(L, R, len);
+	else processSamples(L, R, len);
+	pos += len;
+}
+
+void AudioEffectPlateDattorro_F32::update()
+{
+	audio_block_f32_t *blockL, *blockR;
+	if (bp || !ready) // handle bypass
+	{
+		blockL = AudioStream_F32::receiveReadOnly_f32(0);
+		blockR = AudioStream_F32::receiveReadOnly_f32(1);
+		if (!blockL || !blockR)
+		{
+			if (blockL) AudioStream_F32::release(blockL);
+			if (blockR) AudioStream_F32::release(blockR);
+			return;
+		}
+		AudioStream_F32::transmit(blockL, 0);
+		AudioStream_F32::transmit(blockR, 1);
+		AudioStream_F32::release(blockL);
+		AudioStream_F32::release(blockR);
+		return;
+	}
+	blockL = AudioStream_F32::receiveWritable_f32(0);
+	blockR = AudioStream_F32::receiveWritable_f32(1);
+	if (!blockL || !blockR)
+	{
+		if (blockL) AudioStream_F32::release(blockL);
+		if (blockR) AudioStream_F32::release(blockR);
+		return;
+	}
+	processBlock(blockL->data, blockR->data, blockL->length);
+	AudioStream_F32::transmit(blockL, 0);
+	AudioStream_F32::transmit(blockR, 1);
+	AudioStream_F32::release(blockL);
+	AudioStream_F32::release(blockR);
+}
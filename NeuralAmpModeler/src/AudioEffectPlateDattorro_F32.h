@@ -0,0 +1,166 @@
+/**
+ * @file AudioEffectPlateDattorro_F32.h
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Stereo plate reverb, the figure of eight tank of J. Dattorro
+ * 		("Effect Design Part 1: Reverberator and Other Filters", 1997):
+ * 		a bandwidth filter and 4 input diffusers feed two tank halves,
+ * 		each a modulated allpass, a delay, a damping filter and a second
+ * 		allpass and delay, crossing over into the other half. The outputs
+ * 		are sums of taps of the tank lines.
+ *
+ * 		The network runs block by block per line instead of sample by
+ * 		sample through all the lines: every tank line is longer than an
+ * 		audio block, the samples a line reads in a block were written in
+ * 		the previous blocks. A delay line is a copy, an allpass is a
+ * 		multiply-add over the block with no dependency between the
+ * 		samples (the compiler vectorizes it, the M7 dual issues it), the
+ * 		two tank halves run as two lanes of the same loops. The only
+ * 		recursions left per sample are the bandwidth and the damping
+ * 		one-pole filters, the damping runs both halves in one loop.
+ * 		The input diffusers shorter than a block run in chunks of their
+ * 		length.
+ * 		lanes_set(false) runs the same network sample by sample, the
+ * 		reference for the tests and bench_reverb of the host simulator.
+ *
+ * 		With the tank in the PSRAM the lines are a DelayMemory_F32 with
+ * 		the DMA staging on: every span the block reads (the feedback, the
+ * 		range of the modulated allpass, the outputs and the taps) is
+ * 		known at the block start, one DMA chain fetches them to the RAM
+ * 		while the input filters and diffusers run, the written samples
+ * 		go back by DMA after the block. The CPU does not access the PSRAM,
+ * 		the output is the same as with the RAM. The input diffusers are
+ * 		short, they stay in the RAM.
+ * @version 0.1
+ * @date 2024-03-20
+ */
+#ifndef _AUDIOEFFECTPLATEDATTORRO_F32_H_
+#define _AUDIOEFFECTPLATEDATTORRO_F32_H_
+
+#include <Arduino.h>
+#include "AudioStream_F32.h"
+#include "arm_math.h"
+#include "AudioChain_F32.h"
+#include "DelayMemory_F32.h"
+
+#define PLATE_REF_RATE			(29761.0f)		// sample rate of the delay lengths of the paper
+#define PLATE_DIFFUSERS			(4)
+#define PLATE_EXCURSION			(16.0f)			// modulation depth at the reference rate, samples
+#define PLATE_LFO_HZ			(1.0f)
+#define PLATE_TAPS				(7)				// output taps per channel
+#define PLATE_GATHER_PAD		(64)			// max modulation range of the block read, samples
+
+class AudioEffectPlateDattorro_F32 : public AudioStream_F32, public AudioChainStage_F32
+{
+public:
+	/**
+	 * @param psram tank lines in the external PSRAM instead of the RAM,
+	 * 			DMA staged
+	 */
+	AudioEffectPlateDattorro_F32(bool psram = false);
+	virtual void update(void);
+	void processBlock(float32_t *L, float32_t *R, uint16_t len) override;
+	/**
+	 * @brief Decay time 0.0 .. 1.0
+	 */
+	void size(float32_t n);
+	/**
+	 * @brief Input diffusion 0.0 .. 1.0
+	 */
+	void diffusion(float32_t n);
+	/**
+	 * @brief Treble damping in the tank 0.0 .. 1.0
+	 */
+	void hidamp(float32_t n);
+	/**
+	 * @brief Input bandwidth 0.0 (dark) .. 1.0 (full)
+	 */
+	void lowpass(float32_t n);
+	/**
+	 * @brief Dry/wet 0.0 .. 1.0
+	 */
+	void mix(float32_t n);
+	void bypass_set(bool state) {bp = state;}
+	bool bypass_get() {return bp;}
+	bool bypass_tgl() {bp = !bp; return bp;}
+	/**
+	 * @brief Block and lane processing (default), false: sample by sample,
+	 * 			same output
+	 */
+	void lanes_set(bool state) {lanes = state;}
+	bool lanes_get() {return lanes;}
+	/**
+	 * @brief DMA staging of the PSRAM tank (default on), false: the CPU
+	 * 			reads the PSRAM through the cache. The staged tank runs
+	 * 			the lanes only.
+	 */
+	void staging_set(bool state) {tankMem.staging_set(state && linesLong);}
+	bool staging_get() {return tankMem.staging_get();}
+	/**
+	 * @brief PSRAM access statistics of the tank
+	 */
+	const DelayMemory_F32::stats_t &getMemStats() {return tankMem.getStats();}
+	void resetMemStats() {tankMem.resetStats();}
+	/**
+	 * @brief Clear the delay lines
+	 */
+	void reset();
+	bool isReady() {return ready;}
+	uint32_t getBytes() {return diffMem.getBytes() + tankMem.getBytes();}
+private:
+	typedef struct
+	{
+		float32_t *buf;			// direct access, sample by sample
+		uint32_t mask;			// power of 2 size - 1
+		uint32_t delay;
+		uint8_t id;				// in its DelayMemory_F32
+	} line_t;
+	typedef struct
+	{
+		uint8_t line;			// TANK_xx
+		uint8_t lane;
+		uint16_t delay;			// at the reference rate
+		float32_t gain;
+	} tap_t;
+	enum
+	{
+		TANK_AP1,				// modulated allpass
+		TANK_D1,
+		TANK_AP2,
+		TANK_D2,
+		TANK_LINES
+	};
+	static const uint16_t diffuserDelays[PLATE_DIFFUSERS];
+	static const uint16_t tankDelays[2][TANK_LINES];
+	static const tap_t taps[2][PLATE_TAPS];
+	audio_block_f32_t *inputQueueArray_f32[2];
+	line_t diffuser[PLATE_DIFFUSERS];
+	line_t tank[2][TANK_LINES];
+	uint32_t tapDelay[2][PLATE_TAPS];
+	DelayMemory_F32 diffMem;
+	DelayMemory_F32 tankMem;
+	bool ready = false;
+	uint32_t pos = 0;						// write position, common to all the lines
+	float32_t excursion;
+	uint32_t gatherExc;						// modulated allpass read range around the delay
+	// settings
+	volatile float32_t decay = 0.5f;
+	volatile float32_t inDiff1 = 0.75f, inDiff2 = 0.625f;
+	volatile float32_t damp = 0.0005f;
+	volatile float32_t bandwidth = 0.9995f;
+	volatile float32_t wet = 0.5f, dry = 0.5f;
+	bool bp = false;
+	bool lanes = true;
+	bool linesLong = true;					// all tank lines longer than a block, lanes possible
+	// filter states and the modulation
+	float32_t bwState = 0.0f;
+	float32_t dampState[2] = {0.0f, 0.0f};
+	float32_t lfo[2] = {0.0f, 1.0f};		// sin, cos
+	float32_t lfoRot[2];
+	float32_t mod[2][AUDIO_BLOCK_SAMPLES];	// modulated allpass delays of the block
+	void modulation(uint16_t len);
+	void allpass(DelayMemory_F32 &m, const line_t &l, float32_t g, float32_t *x, uint16_t len);
+	void processLanes(float32_t *L, float32_t *R, uint16_t len);
+	void processSamples(float32_t *L, float32_t *R, uint16_t len);
+};
+
+#endif // _AUDIOEFFECTPLATEDATTORRO_F32_H_
@@ -0,0 +1,209 @@
+/**
+ * @file AudioFilterCabEQ_F32.cpp
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Cabinet IR convolver with an EQ folded into the IR
+ * @version 0.1
+ * @date 2024-03-17
+ */
+#include "AudioFilterCabEQ_F32.h"
+#include "IRTrim_F32.h"
+
+AudioFilterCabEQ_F32::~AudioFilterCabEQ_F32()
+{
+	if (irRaw) extmem_free(irRaw);
+	if (irBaked) extmem_free(irBaked);
+}
+
+void AudioFilterCabEQ_F32::setSettleTime(uint32_t ms)
+{
+	settleBlocks = (uint32_t)(ms * AUDIO_SAMPLE_RATE_EXACT / 1000.0f / AUDIO_BLOCK_SAMPLES);
+}
+
+// the EQ runs again from the next block, the baking is dropped.
+// Only before a load(): the convolver restarts from silence too
+void AudioFilterCabEQ_F32::goLive()
+{
+	__disable_irq();
+	baked = false;
+	__enable_irq();
+	eq.reset();
+	state = ST_LIVE;
+	incoming.free();
+	newIR = false;
+	spare.free();
+	spareValid = false;
+	if (irBaked)
+	{
+		extmem_free(irBaked);
+		irBaked = NULL;
+	}
+}
+
+bool AudioFilterCabEQ_F32::load(const float32_t *ir, uint32_t len, uint16_t partMax)
+{
+	goLive();
+	if (!cab.load(ir, len, partMax)) return false;
+	return captureIR(cab.getIR());
+}
+
+bool AudioFilterCabEQ_F32::load(IRPartitions_F32 &parts)
+{
+	goLive();
+	if (!cab.load(parts)) return false;
+	return captureIR(cab.getIR());
+}
+
+bool AudioFilterCabEQ_F32::crossfade(IRPartitions_F32 &parts)
+{
+	if (newIR) return false;
+	incoming.swap(parts);
+	parts.free();
+	newIR = true;
+	return true;
+}
+
+// plain IR samples from the spectra, the source of the baking
+bool AudioFilterCabEQ_F32::captureIR(IRPartitions_F32 &ir)
+{
+	if (irRaw) extmem_free(irRaw);
+	irRaw = NULL;
+	irLen = ir.getLength();
+	if (irLen) irRaw = (float32_t *)extmem_malloc(irLen * sizeof(float32_t));
+	if (!irRaw)
+	{
+		irLen = 0;
+		return false;
+	}
+	for (uint16_t p = 0; p < ir.getPartitions(); p++) ir.inverse(irRaw, p);
+	// the largest partition used gives the same layout
+	partMax = ir.getLevel(ir.getLevels() - 1).size;
+	return true;
+}
+
+// the convolver exchanges the plain and the baked spectra, processBlock() follows
+bool AudioFilterCabEQ_F32::startSwitch()
+{
+	if (!cab.exchange(spare)) return false;
+	state = ST_SWITCH;
+	return true;
+}
+
+// start of a crossfade to the incoming IR
+AudioTask_F32::state_t AudioFilterCabEQ_F32::change()
+{
+	if (state == ST_BAKED)
+	{
+		// the plain IR back first, the crossfade follows in ST_LIVE
+		changeBlock = blocks;
+		startSwitch();
+		return TASK_WAIT;
+	}
+	// drop the baking, no bake source if out of memory
+	spare.free();
+	spareValid = false;
+	if (irBaked)
+	{
+		extmem_free(irBaked);
+		irBaked = NULL;
+	}
+	captureIR(incoming);
+	newIR = false;
+	if (!cab.crossfade(incoming))
+	{
+		incoming.free();
+		state = ST_LIVE;
+		return TASK_WAIT;
+	}
+	state = ST_FADE;
+	return TASK_WAIT;
+}
+
+AudioTask_F32::state_t AudioFilterCabEQ_F32::step()
+{
+	const uint32_t v = eq.getVersion();
+	if (v != version)
+	{
+		version = v;
+		changeBlock = blocks;
+		if (state == ST_FILTER || state == ST_TRANSFORM) state = ST_LIVE;	// outdated, start again
+	}
+	if (newIR && state != ST_SWITCH && state != ST_FADE) return change();
+	switch (state)
+	{
+		case ST_LIVE:
+			if (!bakeOn || !irRaw || !cab.isReady() || cab.isStereo() || blocks - changeBlock < settleBlocks)
+				return TASK_WAIT;
+			if (spareValid && spareVersion == version)
+			{
+				// baked spectra still valid, ie. after a short knob touch
+				startSwitch();
+				return TASK_WAIT;
+			}
+			if (!irBaked) irBaked = (float32_t *)extmem_malloc(irLen * sizeof(float32_t));
+			if (!irBaked) return TASK_WAIT;
+			spareValid = false;
+			bakeVersion = version;
+			eq.offlineReset();
+			pos = 0;
+			state = ST_FILTER;
+			return TASK_CONTINUE;
+		case ST_FILTER:
+		{
+			const uint32_t n = min(irLen - pos, (uint32_t)CABEQ_FILTER_CHUNK);
+			memcpy(irBaked + pos, irRaw + pos, n * sizeof(float32_t));
+			eq.offlineProcess(irBaked + pos, n);
+			pos += n;
+			if (pos < irLen) return TASK_CONTINUE;
+			IRTrim_F32::fadeOut(irBaked, irLen);
+			if (!spare.setup(irLen, partMax) || !spare.sameLayout(cab.getIR()))
+			{
+				spare.free();
+				state = ST_LIVE;
+				changeBlock = blocks;		// retry after the settle time
+				return TASK_WAIT;
+			}
+			pos = 0;
+			state = ST_TRANSFORM;
+			return TASK_CONTINUE;
+		}
+		case ST_TRANSFORM:
+			spare.transform(irBaked, pos++);
+			if (pos < spare.getPartitions()) return TASK_CONTINUE;
+			extmem_free(irBaked);
+			irBaked = NULL;
+			spareValid = true;
+			spareVersion = bakeVersion;
+			bakeCount++;
+			state = ST_LIVE;		// switched from there, retried if the convolver is busy
+			startSwitch();
+			return TASK_WAIT;
+		case ST_SWITCH:
+			if (!cab.exchangeDone()) return TASK_WAIT;
+			state = baked ? ST_BAKED : ST_LIVE;
+			return TASK_WAIT;
+		case ST_BAKED:
+			if (bakeOn && version == spareVersion) return TASK_WAIT;
+			// knob moved or baking off: back to the plain IR and the live EQ
+			changeBlock = blocks;
+			startSwitch();
+			return TASK_WAIT;
+		case ST_FADE:
+			if (!cab.crossfadeDone()) return TASK_WAIT;
+			changeBlock = blocks;
+			state = ST_LIVE;
+			return TASK_WAIT;
+	}
+	return TASK_WAIT;
+}
+
+void AudioFilterCabEQ_F32::processBlock(float32_t *L, float32_t *R, uint16_t len)
+{
+	blocks++;
+	// in the switch window L/R is the output of the new spectra, xL/xR of the old ones
+	const int32_t n = cab.processBlock(L, R, len, xL, xR);
+	if (n == 0) baked = !baked;
+	if (!baked) eq.processBlock(L, R, len);
+	if (n < 0) return;
+	if (baked) eq.processBlock(xL, xR, len);
+	cab.exchangeMix(L, R, xL, xR, n, len);
+}
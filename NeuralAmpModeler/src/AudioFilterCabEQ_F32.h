@@ -0,0 +1,123 @@
+/**
+ * @file AudioFilterCabEQ_F32.h
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Cabinet IR convolver with an EQ/tone stack, optionally folded
+ * 		into the IR ("baked EQ").
+ * 		Both stages are linear, the EQ runs after the convolver (the same
+ * 		result as before it). With the baking on, a background task waits
+ * 		until the EQ settings did not change for the settle time, filters
+ * 		the IR with the EQ, transforms the partitions and switches the
+ * 		convolver to the new spectra, then the EQ stops: it costs nothing
+ * 		per sample. When a knob moves, the convolver is switched back to
+ * 		the plain IR and the EQ runs live again until the knobs rest.
+ * 		The switch keeps the delay lines of the convolver
+ * 		(AudioFilterIRConvolver_F32::exchange()): for the crossfade window
+ * 		the convolver gives the output of both spectra, the EQ runs on the
+ * 		plain one and the two paths are crossfaded. The EQ is not reset,
+ * 		going live it starts from the state it stopped with, which decays
+ * 		while its output is faded in.
+ * 		The IR is cut to its length after the filtering, the EQ response
+ * 		longer than the IR tail is lost (5ms fade out).
+ *
+ * 		Usage: add this object to an AudioChain_F32 instead of the
+ * 		convolver and the EQ, load the IRs with load() of this object,
+ * 		post it once to the task scheduler (it keeps polling the EQ).
+ * 		crossfade() changes the IR while playing: the task switches
+ * 		back to the plain IR if baked, crossfades the convolver to the
+ * 		new IR and bakes it again after the settle time.
+ * 		Mono IRs only.
+ * @version 0.1
+ * @date 2024-03-17
+ */
+#ifndef _AUDIOFILTERCABEQ_F32_H_
+#define _AUDIOFILTERCABEQ_F32_H_
+
+#include <Arduino.h>
+#include "AudioStream_F32.h"
+#include "arm_math.h"
+#include "AudioChain_F32.h"
+#include "AudioTasks_F32.h"
+#include "AudioFilterIRConvolver_F32.h"
+
+#define CABEQ_SETTLE_MS			(200)		// EQ settings unchanged this long before baking
+#define CABEQ_FILTER_CHUNK		(4096)		// IR samples filtered per task step
+
+class AudioFilterCabEQ_F32 : public AudioChainStage_F32, public AudioTask_F32
+{
+public:
+	AudioFilterCabEQ_F32(AudioFilterIRConvolver_F32 &cab, AudioChainLinearStage_F32 &eq) : cab(cab), eq(eq) {}
+	~AudioFilterCabEQ_F32();
+	void processBlock(float32_t *L, float32_t *R, uint16_t len) override;
+	/**
+	 * @brief Background work, post the object once to the scheduler
+	 */
+	state_t step() override;
+	/**
+	 * @brief Load an IR into the convolver, the EQ goes live, see
+	 * 			AudioFilterIRConvolver_F32::load()
+	 */
+	bool load(const float32_t *ir, uint32_t len, uint16_t partMax = IR_CONV_PART_MAX);
+	bool load(IRPartitions_F32 &parts);
+	/**
+	 * @brief Change the IR without muting, see
+	 * 			AudioFilterIRConvolver_F32::crossfade(). The spectra are
+	 * 			taken over, parts is empty after the call, the switch is
+	 * 			done by step().
+	 * @return false if the previous change is not finished
+	 */
+	bool crossfade(IRPartitions_F32 &parts);
+	bool crossfadeDone() {return !newIR && state != ST_FADE;}
+	/**
+	 * @brief Baked EQ mode on/off (default off: the EQ always runs live)
+	 */
+	void bake_set(bool state) {bakeOn = state;}
+	bool bake_get() {return bakeOn;}
+	/**
+	 * @brief true while the EQ is folded into the IR
+	 */
+	bool isBaked() {return baked;}
+	void setSettleTime(uint32_t ms);
+	/**
+	 * @brief Number of completed bakes, for the statistics
+	 */
+	uint32_t getBakeCount() {return bakeCount;}
+private:
+	typedef enum
+	{
+		ST_LIVE,			// EQ running
+		ST_FILTER,			// filtering the IR with the EQ
+		ST_TRANSFORM,		// spectra of the filtered IR
+		ST_SWITCH,			// convolver crossfading between the plain and the baked spectra
+		ST_BAKED,			// EQ in the IR
+		ST_FADE				// convolver crossfading to a new IR
+	} bake_state_t;
+	AudioFilterIRConvolver_F32 &cab;
+	AudioChainLinearStage_F32 &eq;
+	IRPartitions_F32 spare;					// the spectra not in the convolver: baked while live, plain while baked
+	IRPartitions_F32 incoming;				// next IR for crossfade()
+	bool newIR = false;
+	float32_t *irRaw = NULL;				// the plain IR, PSRAM
+	float32_t *irBaked = NULL;				// filtered IR during the baking
+	uint32_t irLen = 0;
+	uint16_t partMax = IR_CONV_PART_MAX;
+	bake_state_t state = ST_LIVE;
+	uint32_t pos = 0;
+	uint32_t version = 0;					// last seen EQ version
+	uint32_t bakeVersion = 0;				// EQ version being baked
+	uint32_t spareVersion = 0;				// EQ version of the baked spectra
+	bool spareValid = false;
+	uint32_t changeBlock = 0;				// block count of the last EQ change
+	uint32_t settleBlocks = (uint32_t)(CABEQ_SETTLE_MS * AUDIO_SAMPLE_RATE_EXACT / 1000.0f / AUDIO_BLOCK_SAMPLES);
+	uint32_t bakeCount = 0;
+	volatile uint32_t blocks = 0;
+	volatile bool baked = false;			// spectra in the convolver, flipped by the audio update
+	bool bakeOn = false;
+	float32_t xL[AUDIO_BLOCK_SAMPLES];		// output of the old spectra during a switch
+	float32_t xR[AUDIO_BLOCK_SAMPLES];
+	void goLive();
+	bool startSwitch();
+	bool captureIR(IRPartitions_F32 &ir);
+	state_t change();
+};
+
+#endif // _AUDIOFILTERCABEQ_F32_H_
@@ -0,0 +1,751 @@
+/**
+ * @file AudioFilterIRConvolver_F32.cpp
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Stereo convolution with long impulse responses, non-uniform partitioned
+ * @version 0.1
+ * @date 2024-03-14
+ */
+#include "AudioFilterIRConvolver_F32.h"
+#include <utility>
+
+static uint32_t nextPow2(uint32_t n)
+{
+	uint32_t p = 1;
+	while (p < n) p <<= 1;
+	return p;
+}
+
+// constant CMSIS instances, arm_cfft_init_f32() is missing in older CMSIS versions
+static const arm_cfft_instance_f32 *cfftInstance(uint32_t n)
+{
+	switch (n)
+	{
+		case 64: return &arm_cfft_sR_f32_len64;
+		case 128: return &arm_cfft_sR_f32_len128;
+		case 256: return &arm_cfft_sR_f32_len256;
+		case 512: return &arm_cfft_sR_f32_len512;
+		case 1024: return &arm_cfft_sR_f32_len1024;
+		case 2048: return &arm_cfft_sR_f32_len2048;
+		case 4096: return &arm_cfft_sR_f32_len4096;
+		default: return NULL;
+	}
+}
+
+// the head level lives in the RAM, the tail levels in the PSRAM
+static float32_t *allocBuf(uint32_t floats, bool ext, uint32_t &bytesRAM, uint32_t &bytesPSRAM)
+{
+	const uint32_t bytes = floats * sizeof(float32_t);
+	float32_t *p = (float32_t *)(ext ? extmem_malloc(bytes) : malloc(bytes));
+	if (p)
+	{
+		memset(p, 0, bytes);
+		if (ext) bytesPSRAM += bytes;
+		else bytesRAM += bytes;
+	}
+	return p;
+}
+
+static void freeBuf(float32_t *&p, bool ext)
+{
+	if (!p) return;
+	if (ext) extmem_free(p);
+	else ::free(p);
+	p = NULL;
+}
+
+// ---------------------------------------------------------------- IR partitions
+// partition layout without the buffers, returns the number of levels, 0 if invalid
+uint8_t IRPartitions_F32::plan(uint32_t len, uint16_t partMax, level_t *lv)
+{
+	if (!len || partMax < AUDIO_BLOCK_SAMPLES || partMax > IR_CONV_PART_MAX || (partMax & (partMax - 1)))
+		return 0;
+	uint8_t n = 0;
+	uint32_t offset = 0;
+	uint32_t size = AUDIO_BLOCK_SAMPLES;
+	while (offset < len)
+	{
+		if (n == IR_CONV_MAX_LEVELS) return 0;
+		const uint32_t left = (len - offset + size - 1) / size;
+		uint32_t count = left;
+		if (size < partMax) count = min(left, (uint32_t)(n ? 2 : IR_CONV_HEAD_PARTS));
+		lv[n].size = size;
+		lv[n].count = count;
+		lv[n].offset = offset;
+		lv[n].spectra = NULL;
+		n++;
+		offset += count * size;
+		if (size < partMax) size <<= 1;
+	}
+	return n;
+}
+
+uint16_t IRPartitions_F32::count(uint32_t len, uint16_t partMax)
+{
+	level_t lv[IR_CONV_MAX_LEVELS];
+	const uint8_t n = plan(len, partMax, lv);
+	uint16_t parts = 0;
+	for (uint8_t l = 0; l < n; l++) parts += lv[l].count;
+	return parts;
+}
+
+bool IRPartitions_F32::setup(uint32_t len, uint16_t partMax)
+{
+	free();
+	const uint8_t n = plan(len, partMax, level);
+	if (!n) return false;
+	for (levels = 0; levels < n; levels++)
+	{
+		level_t &lv = level[levels];
+		lv.spectra = allocBuf(lv.count * 2 * lv.size, levels > 0, bytesRAM, bytesPSRAM);
+		if (!lv.spectra) { free(); return false; }
+		partitions += lv.count;
+	}
+	length = len;
+	return true;
+}
+
+void IRPartitions_F32::transform(const float32_t *ir, uint16_t part)
+{
+	uint8_t l = 0;
+	while (l < levels - 1 && part >= level[l].count) part -= level[l++].count;
+	level_t &lv = level[l];
+	const uint32_t P = lv.size;
+	const uint32_t start = lv.offset + part * P;
+	const uint32_t n = min(P, length - start);
+	float32_t *spec = lv.spectra + part * 2 * P;
+	// zero padded partition, transformed in place: the rfft input is a scratch buffer
+	float32_t *buf = (float32_t *)malloc(2 * P * sizeof(float32_t));
+	if (!buf) return;
+	memset(buf, 0, 2 * P * sizeof(float32_t));
+	memcpy(buf, ir + start, n * sizeof(float32_t));
+	arm_rfft_fast_instance_f32 fft;
+	arm_rfft_fast_init_f32(&fft, 2 * P);
+	arm_rfft_fast_f32(&fft, buf, spec, 0);
+	::free(buf);
+}
+
+void IRPartitions_F32::inverse(float32_t *ir, uint16_t part)
+{
+	uint8_t l = 0;
+	while (l < levels - 1 && part >= level[l].count) part -= level[l++].count;
+	level_t &lv = level[l];
+	const uint32_t P = lv.size;
+	const uint32_t start = lv.offset + part * P;
+	const uint32_t n = min(P, length - start);
+	// the rfft input is modified, transform a copy
+	float32_t *buf = (float32_t *)malloc(4 * P * sizeof(float32_t));
+	if (!buf) return;
+	memcpy(buf, lv.spectra + part * 2 * P, 2 * P * sizeof(float32_t));
+	arm_rfft_fast_instance_f32 fft;
+	arm_rfft_fast_init_f32(&fft, 2 * P);
+	arm_rfft_fast_f32(&fft, buf, buf + 2 * P, 1);
+	memcpy(ir + start, buf + 2 * P, n * sizeof(float32_t));
+	::free(buf);
+}
+
+bool IRPartitions_F32::sameLayout(IRPartitions_F32 &other)
+{
+	if (levels != other.levels || length != other.length) return false;
+	for (uint8_t l = 0; l < levels; l++)
+		if (level[l].size != other.level[l].size || level[l].count != other.level[l].count) return false;
+	return true;
+}
+
+bool IRPartitions_F32::prepare(const float32_t *ir, uint32_t len, uint16_t partMax)
+{
+	if (!setup(len, partMax)) return false;
+	for (uint16_t p = 0; p < partitions; p++) transform(ir, p);
+	return true;
+}
+
+void IRPartitions_F32::free()
+{
+	for (uint8_t l = 0; l < levels; l++) freeBuf(level[l].spectra, l > 0);
+	levels = 0;
+	partitions = 0;
+	length = 0;
+	bytesRAM = 0;
+	bytesPSRAM = 0;
+}
+
+void IRPartitions_F32::swap(IRPartitions_F32 &other)
+{
+	for (uint8_t l = 0; l < IR_CONV_MAX_LEVELS; l++) std::swap(level[l], other.level[l]);
+	std::swap(levels, other.levels);
+	std::swap(partitions, other.partitions);
+	std::swap(length, other.length);
+	std::swap(bytesRAM, other.bytesRAM);
+	std::swap(bytesPSRAM, other.bytesPSRAM);
+}
+
+// ---------------------------------------------------------------- convolver
+// mute, drop a running crossfade or exchange, free the runtime state
+void AudioFilterIRConvolver_F32::stop()
+{
+	__disable_irq();
+	ready = false;
+	fadeReq = false;
+	fading = false;
+	engine[cur].exchangeParts = NULL;
+	engine[cur].exchangeStarted = false;
+	__enable_irq();
+	engine[cur ^ 1].free();
+	engine[cur].freeState();
+}
+
+bool AudioFilterIRConvolver_F32::start()
+{
+	if (!engine[cur].start(packing)) return false;
+	blockCount = 0;
+	__disable_irq();
+	ready = true;
+	__enable_irq();
+	return true;
+}
+
+bool AudioFilterIRConvolver_F32::load(const float32_t *irData, uint32_t len, uint16_t partMax)
+{
+	stop();
+	Engine &e = engine[cur];
+	e.irR.free();
+	if (!e.ir.prepare(irData, len, partMax)) return false;
+	return start();
+}
+
+bool AudioFilterIRConvolver_F32::load(IRPartitions_F32 &parts)
+{
+	stop();
+	Engine &e = engine[cur];
+	e.irR.free();
+	e.ir.swap(parts);
+	return start();
+}
+
+bool AudioFilterIRConvolver_F32::load(const float32_t *irL, const float32_t *irRight, uint32_t len, uint16_t partMax)
+{
+	stop();
+	Engine &e = engine[cur];
+	if (!e.ir.prepare(irL, len, partMax) || !e.irR.prepare(irRight, len, partMax))
+	{
+		e.free();
+		return false;
+	}
+	return start();
+}
+
+bool AudioFilterIRConvolver_F32::load(IRPartitions_F32 &partsL, IRPartitions_F32 &partsR)
+{
+	if (!partsL.sameLayout(partsR)) return false;
+	stop();
+	Engine &e = engine[cur];
+	e.ir.swap(partsL);
+	e.irR.swap(partsR);
+	return start();
+}
+
+bool AudioFilterIRConvolver_F32::crossfade(IRPartitions_F32 &parts, float32_t ms)
+{
+	if (!ready) return load(parts);
+	if (isFading() || !exchangeDone()) return false;
+	Engine &e = engine[cur ^ 1];
+	e.free();
+	e.ir.swap(parts);
+	if (!e.start(packing)) return false;
+	fadeLen = max((uint32_t)AUDIO_BLOCK_SAMPLES, (uint32_t)(ms * AUDIO_SAMPLE_RATE_EXACT / 1000.0f));
+	__disable_irq();
+	fadeReq = true;
+	__enable_irq();
+	return true;
+}
+
+// the audio update never frees memory, the old IR goes here
+bool AudioFilterIRConvolver_F32::crossfadeDone()
+{
+	if (isFading()) return false;
+	engine[cur ^ 1].free();
+	return true;
+}
+
+bool AudioFilterIRConvolver_F32::exchange(IRPartitions_F32 &parts, float32_t ms)
+{
+	Engine &e = engine[cur];
+	if (!ready || isFading() || e.isStereo() || !exchangeDone() || !e.ir.sameLayout(parts)) return false;
+	if (!e.allocExchange()) return false;
+	const uint32_t partMax = e.ir.getLevel(e.ir.getLevels() - 1).size;
+	const uint32_t len = max((uint32_t)AUDIO_BLOCK_SAMPLES, (uint32_t)(ms * AUDIO_SAMPLE_RATE_EXACT / 1000.0f));
+	__disable_irq();
+	e.exchangeLen = (len + partMax - 1) / partMax * partMax;
+	e.exchangeMask = 0;
+	e.exchangeStarted = false;
+	e.exchangeParts = &parts;
+	__enable_irq();
+	return true;
+}
+
+void AudioFilterIRConvolver_F32::exchangeMix(float32_t *L, float32_t *R, const float32_t *xL, const float32_t *xR, int32_t n, uint16_t len)
+{
+	const float32_t k = PI / engine[cur].exchangeLen;
+	for (uint32_t i = 0; i < len; i++)
+	{
+		const float32_t g = 0.5f - 0.5f * arm_cos_f32(k * (n + i));
+		L[i] = xL[i] + g * (L[i] - xL[i]);
+		R[i] = xR[i] + g * (R[i] - xR[i]);
+	}
+}
+
+void AudioFilterIRConvolver_F32::reset()
+{
+	bool r = ready;
+	__disable_irq();
+	ready = false;
+	__enable_irq();
+	engine[cur].reset();
+	if (isFading()) engine[cur ^ 1].reset();
+	blockCount = 0;
+	__disable_irq();
+	ready = r;
+	__enable_irq();
+}
+
+// ---------------------------------------------------------------- engine
+bool AudioFilterIRConvolver_F32::Engine::start(bool packing)
+{
+	if (!ir.getLevels()) return false;
+	if (!allocState(packing))
+	{
+		free();
+		return false;
+	}
+	reset();
+	return true;
+}
+
+bool AudioFilterIRConvolver_F32::Engine::allocState(bool packing)
+{
+	const uint32_t B = AUDIO_BLOCK_SAMPLES;
+	uint32_t outSpan = 0;
+	uint32_t partMax = B;
+	uint32_t workLen = 0;
+	for (uint8_t l = 0; l < ir.getLevels(); l++)
+	{
+		const IRPartitions_F32::level_t &lv = ir.getLevel(l);
+		state_t &st = state[l];
+		const uint32_t P = lv.size;
+		st.blocks = P / B;
+		// the result of a segment ending at t covers t-P+offset..t-1+offset and is
+		// ready m+delay-1 blocks later, at t+(m+delay-2)B: offset >= 2P-2B+delay*B
+		const int32_t slack = ((int32_t)lv.offset - 2 * (int32_t)P + 2 * (int32_t)B) / (int32_t)B;
+		if (slack < 0) return false;
+		st.delay = min((uint32_t)slack, (uint32_t)(l % 3));
+		st.fdlIdx = 0;
+		// both channels are transformed in the same block below 4 blocks, see runLevel()
+		st.packed = packing && st.blocks < 4;
+		arm_rfft_fast_init_f32(&st.fft, 2 * P);
+		if (st.packed && !(st.cfft = cfftInstance(2 * P))) return false;
+		workLen = max(workLen, (st.packed ? 4 : 2) * P);
+		for (uint8_t ch = 0; ch < 2; ch++)
+		{
+			st.fdl[ch] = allocBuf(lv.count * 2 * P, l > 0, bytesRAM, bytesPSRAM);
+			st.acc[ch] = allocBuf(2 * P, false, bytesRAM, bytesPSRAM);
+			if (!st.fdl[ch] || !st.acc[ch]) return false;
+		}
+		// farthest output sample written, relative to the start of the current block
+		outSpan = max(outSpan, lv.offset + 2 * B - (st.blocks + st.delay) * B + B);
+		partMax = max(partMax, P);
+	}
+	// input: 2P samples up to 2 blocks back + the current block
+	const uint32_t inLen = nextPow2(2 * partMax + 4 * B);
+	const uint32_t outLen = nextPow2(outSpan + B);
+	for (uint8_t ch = 0; ch < 2; ch++)
+	{
+		inRing[ch] = allocBuf(inLen, false, bytesRAM, bytesPSRAM);
+		outRing[ch] = allocBuf(outLen, false, bytesRAM, bytesPSRAM);
+		if (!inRing[ch] || !outRing[ch]) return false;
+	}
+	work = allocBuf(workLen, false, bytesRAM, bytesPSRAM);
+	if (!work) return false;
+	inMask = inLen - 1;
+	outMask = outLen - 1;
+	return true;
+}
+
+// buffers of the exchange window, kept until the state is freed
+bool AudioFilterIRConvolver_F32::Engine::allocExchange()
+{
+	for (uint8_t l = 0; l < ir.getLevels(); l++)
+	{
+		const uint32_t P = ir.getLevel(l).size;
+		for (uint8_t ch = 0; ch < 2; ch++)
+		{
+			if (!state[l].xacc[ch]) state[l].xacc[ch] = allocBuf(2 * P, false, bytesRAM, bytesPSRAM);
+			if (!state[l].xacc[ch]) return false;
+		}
+	}
+	for (uint8_t ch = 0; ch < 2; ch++)
+	{
+		if (!xRing[ch]) xRing[ch] = allocBuf(outMask + 1, false, bytesRAM, bytesPSRAM);
+		if (!xRing[ch]) return false;
+	}
+	return true;
+}
+
+void AudioFilterIRConvolver_F32::Engine::freeState()
+{
+	for (uint8_t l = 0; l < IR_CONV_MAX_LEVELS; l++)
+	{
+		for (uint8_t ch = 0; ch < 2; ch++)
+		{
+			freeBuf(state[l].fdl[ch], l > 0);
+			freeBuf(state[l].acc[ch], false);
+			freeBuf(state[l].xacc[ch], false);
+		}
+	}
+	for (uint8_t ch = 0; ch < 2; ch++)
+	{
+		freeBuf(inRing[ch], false);
+		freeBuf(outRing[ch], false);
+		freeBuf(xRing[ch], false);
+	}
+	freeBuf(work, false);
+	bytesRAM = 0;
+	bytesPSRAM = 0;
+}
+
+void AudioFilterIRConvolver_F32::Engine::reset()
+{
+	for (uint8_t l = 0; l < ir.getLevels(); l++)
+	{
+		const IRPartitions_F32::level_t &lv = ir.getLevel(l);
+		for (uint8_t ch = 0; ch < 2; ch++)
+		{
+			memset(state[l].fdl[ch], 0, lv.count * 2 * lv.size * sizeof(float32_t));
+			memset(state[l].acc[ch], 0, 2 * lv.size * sizeof(float32_t));
+		}
+		state[l].fdlIdx = 0;
+		state[l].dual = false;
+	}
+	for (uint8_t ch = 0; ch < 2; ch++)
+	{
+		if (inRing[ch]) memset(inRing[ch], 0, (inMask + 1) * sizeof(float32_t));
+		if (outRing[ch]) memset(outRing[ch], 0, (outMask + 1) * sizeof(float32_t));
+		if (xRing[ch]) memset(xRing[ch], 0, (outMask + 1) * sizeof(float32_t));
+	}
+}
+
+/**
+ * @brief acc += x * h for both channels, spectra in the arm_rfft_fast_f32
+ * 			format: DC and Nyquist (real) in the first pair
+ */
+static void cmac2(float32_t *accL, float32_t *accR, const float32_t *xL, const float32_t *xR,
+				  const float32_t *hL, const float32_t *hR, uint32_t n)
+{
+	accL[0] += xL[0] * hL[0];
+	accL[1] += xL[1] * hL[1];
+	accR[0] += xR[0] * hR[0];
+	accR[1] += xR[1] * hR[1];
+	for (uint32_t i = 2; i < n; i += 2)
+	{
+		accL[i] += xL[i] * hL[i] - xL[i + 1] * hL[i + 1];
+		accL[i + 1] += xL[i] * hL[i + 1] + xL[i + 1] * hL[i];
+		accR[i] += xR[i] * hR[i] - xR[i + 1] * hR[i + 1];
+		accR[i + 1] += xR[i] * hR[i + 1] + xR[i + 1] * hR[i];
+	}
+}
+
+/**
+ * @brief Spectrum Z of the complex signal l + jr (n points) -> real spectra
+ * 			of l and r (arm_rfft_fast_f32 format, n floats each):
+ * 			L[k] = (Z[k] + conj(Z[n-k])) / 2, R[k] = (Z[k] - conj(Z[n-k])) / 2j
+ */
+static void unpack2(const float32_t *z, float32_t *xL, float32_t *xR, uint32_t n)
+{
+	xL[0] = z[0];
+	xR[0] = z[1];
+	xL[1] = z[n];		// Nyquist, Z[n/2]
+	xR[1] = z[n + 1];
+	for (uint32_t k = 1; k < n / 2; k++)
+	{
+		const float32_t ar = z[2 * k], ai = z[2 * k + 1];
+		const float32_t br = z[2 * (n - k)], bi = z[2 * (n - k) + 1];
+		xL[2 * k] = 0.5f * (ar + br);
+		xL[2 * k + 1] = 0.5f * (ai - bi);
+		xR[2 * k] = 0.5f * (ai + bi);
+		xR[2 * k + 1] = 0.5f * (br - ar);
+	}
+}
+
+/**
+ * @brief Real spectra of l and r -> spectrum of l + jr:
+ * 			Z[k] = L[k] + jR[k], Z[n-k] = conj(L[k]) + j conj(R[k])
+ */
+static void pack2(const float32_t *xL, const float32_t *xR, float32_t *z, uint32_t n)
+{
+	z[0] = xL[0];
+	z[1] = xR[0];
+	z[n] = xL[1];
+	z[n + 1] = xR[1];
+	for (uint32_t k = 1; k < n / 2; k++)
+	{
+		const float32_t lr = xL[2 * k], li = xL[2 * k + 1];
+		const float32_t rr = xR[2 * k], ri = xR[2 * k + 1];
+		z[2 * k] = lr - ri;
+		z[2 * k + 1] = li + rr;
+		z[2 * (n - k)] = lr + ri;
+		z[2 * (n - k) + 1] = rr - li;
+	}
+}
+
+// one block of the work of a level, pos = first sample of the current block
+void AudioFilterIRConvolver_F32::Engine::runLevel(uint8_t l, uint32_t pos, uint32_t blockCount)
+{
+	const uint32_t B = AUDIO_BLOCK_SAMPLES;
+	const IRPartitions_F32::level_t &lv = ir.getLevel(l);
+	state_t &st = state[l];
+	const uint32_t P = lv.size;
+	const uint32_t N = 2 * P;
+	const uint32_t m = st.blocks;
+	const uint32_t K = lv.count;
+	// slice of the segment work done in this block, m is a power of 2
+	const uint32_t slice = (blockCount + 1 + m - st.delay) & (m - 1);
+	// end of the input segment being processed
+	const uint32_t t = pos + B - (st.delay + slice) * B;
+	// levels of 4+ blocks do the FFTs of the two channels in separate blocks:
+	// L and R forward in slices 0 and 1, multiply-adds in 1..m-2, inverse in m-2 and m-1
+	// smaller levels transform both channels together with one complex FFT
+	const bool split = m >= 4;
+	// exchange: the segments with their output from the window start on take the
+	// new spectra, in the window the old ones (then in exchangeParts) run too
+	if (slice == 0)
+	{
+		st.dual = false;
+		const uint32_t o = t - P + lv.offset;
+		if (exchangeParts && exchangeStarted && (int32_t)(o - exchangeStart) >= 0)
+		{
+			if (!(exchangeMask & (1 << l)))
+			{
+				ir.swapLevel(*exchangeParts, l);
+				exchangeMask |= 1 << l;
+			}
+			st.dual = (int32_t)(o - exchangeEnd) < 0;
+		}
+	}
+	IRPartitions_F32 *old = exchangeParts;
+	const float32_t *hOld = st.dual && old ? old->getLevel(l).spectra : NULL;
+	if (st.packed && slice == 0)
+	{
+		st.fdlIdx = st.fdlIdx ? st.fdlIdx - 1 : K - 1;
+		for (uint32_t i = 0; i < N; i++)
+		{
+			const uint32_t idx = (t - N + i) & inMask;
+			work[2 * i] = inRing[0][idx];
+			work[2 * i + 1] = inRing[1][idx];
+		}
+		arm_cfft_f32(st.cfft, work, 0, 1);
+		unpack2(work, st.fdl[0] + st.fdlIdx * N, st.fdl[1] + st.fdlIdx * N, N);
+		memset(st.acc[0], 0, N * sizeof(float32_t));
+		memset(st.acc[1], 0, N * sizeof(float32_t));
+		if (hOld)
+		{
+			memset(st.xacc[0], 0, N * sizeof(float32_t));
+			memset(st.xacc[1], 0, N * sizeof(float32_t));
+		}
+	}
+	for (uint8_t ch = 0; ch < 2 && !st.packed; ch++)
+	{
+		if (slice != (split ? ch : 0)) continue;
+		if (ch == 0) st.fdlIdx = st.fdlIdx ? st.fdlIdx - 1 : K - 1;
+		// spectrum of the last 2P input samples
+		for (uint32_t i = 0; i < N; i++) work[i] = inRing[ch][(t - N + i) & inMask];
+		arm_rfft_fast_f32(&st.fft, work, st.fdl[ch] + st.fdlIdx * N, 0);
+		memset(st.acc[ch], 0, N * sizeof(float32_t));
+		if (hOld) memset(st.xacc[ch], 0, N * sizeof(float32_t));
+	}
+	// partition k is applied to the input spectrum k segments old
+	const uint32_t first = split ? 1 : 0;
+	const uint32_t slices = split ? m - 2 : m;
+	if (slice >= first && slice < first + slices)
+	{
+		const uint32_t j = slice - first;
+		const uint32_t kEnd = ((j + 1) * K) / slices;
+		const float32_t *hR = isStereo() ? irR.getLevel(l).spectra : lv.spectra;
+		for (uint32_t k = (j * K) / slices; k < kEnd; k++)
+		{
+			uint32_t idx = st.fdlIdx + k;
+			if (idx >= K) idx -= K;
+			cmac2(st.acc[0], st.acc[1], st.fdl[0] + idx * N, st.fdl[1] + idx * N, lv.spectra + k * N, hR + k * N, N);
+			if (hOld) cmac2(st.xacc[0], st.xacc[1], st.fdl[0] + idx * N, st.fdl[1] + idx * N, hOld + k * N, hOld + k * N, N);
+		}
+	}
+	if (st.packed && slice == m - 1)
+	{
+		// l + jr back in one inverse FFT
+		pack2(st.acc[0], st.acc[1], work, N);
+		arm_cfft_f32(st.cfft, work, 1, 1);
+		const uint32_t start = t - P + lv.offset;
+		for (uint32_t i = 0; i < P; i++)
+		{
+			const uint32_t idx = (start + i) & outMask;
+			outRing[0][idx] += work[2 * (P + i)];
+			outRing[1][idx] += work[2 * (P + i) + 1];
+		}
+		if (hOld)
+		{
+			pack2(st.xacc[0], st.xacc[1], work, N);
+			arm_cfft_f32(st.cfft, work, 1, 1);
+			for (uint32_t i = 0; i < P; i++)
+			{
+				const uint32_t idx = (start + i) & outMask;
+				xRing[0][idx] += work[2 * (P + i)];
+				xRing[1][idx] += work[2 * (P + i) + 1];
+			}
+		}
+	}
+	for (uint8_t ch = 0; ch < 2 && !st.packed; ch++)
+	{
+		if (slice != (split ? m - 2 + ch : m - 1)) continue;
+		// the last P samples of the overlap-save output go to t-P+offset..
+		arm_rfft_fast_f32(&st.fft, st.acc[ch], work, 1);
+		const uint32_t start = t - P + lv.offset;
+		float32_t *out = outRing[ch];
+		for (uint32_t i = 0; i < P; i++) out[(start + i) & outMask] += work[P + i];
+		if (!hOld) continue;
+		arm_rfft_fast_f32(&st.fft, st.xacc[ch], work, 1);
+		out = xRing[ch];
+		for (uint32_t i = 0; i < P; i++) out[(start + i) & outMask] += work[P + i];
+	}
+}
+
+int32_t AudioFilterIRConvolver_F32::Engine::process(float32_t *L, float32_t *R, uint32_t blockCount, float32_t *xL, float32_t *xR)
+{
+	const uint32_t B = AUDIO_BLOCK_SAMPLES;
+	const uint32_t pos = blockCount * B;
+	if (exchangeParts && !exchangeStarted)
+	{
+		// the next multiple of the largest partition no level has started the work for:
+		// the segment with the output from there on starts at most offset samples before
+		uint32_t ahead = 0, partMax = B;
+		for (uint8_t l = 0; l < ir.getLevels(); l++)
+		{
+			ahead = max(ahead, (uint32_t)ir.getLevel(l).offset);
+			partMax = max(partMax, (uint32_t)ir.getLevel(l).size);
+		}
+		exchangeStart = (pos + ahead + B + partMax - 1) & ~(partMax - 1);
+		exchangeEnd = exchangeStart + exchangeLen;
+		exchangeStarted = true;
+	}
+	for (uint32_t i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+	{
+		inRing[0][(pos + i) & inMask] = L[i];
+		inRing[1][(pos + i) & inMask] = R[i];
+	}
+	for (uint8_t l = 0; l < ir.getLevels(); l++) runLevel(l, pos, blockCount);
+	for (uint32_t i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+	{
+		const uint32_t idx = (pos + i) & outMask;
+		L[i] = outRing[0][idx];
+		R[i] = outRing[1][idx];
+		outRing[0][idx] = 0.0f;
+		outRing[1][idx] = 0.0f;
+	}
+	if (!exchangeParts || !exchangeStarted || (int32_t)(pos - exchangeStart) < 0) return -1;
+	for (uint32_t i = 0; i < B; i++)
+	{
+		const uint32_t idx = (pos + i) & outMask;
+		xL[i] = xRing[0][idx];
+		xR[i] = xRing[1][idx];
+		xRing[0][idx] = 0.0f;
+		xRing[1][idx] = 0.0f;
+	}
+	const int32_t n = pos - exchangeStart;
+	// the last block of the window, the old spectra are not used any more
+	if ((int32_t)(pos + B - exchangeEnd) >= 0)
+	{
+		exchangeStarted = false;
+		exchangeParts = NULL;
+	}
+	return n;
+}
+
+void AudioFilterIRConvolver_F32::processBlock(float32_t *L, float32_t *R, uint16_t len)
+{
+	const int32_t n = processBlock(L, R, len, fadeL, fadeR);
+	if (n >= 0) exchangeMix(L, R, fadeL, fadeR, n, len);
+}
+
+int32_t AudioFilterIRConvolver_F32::processBlock(float32_t *L, float32_t *R, uint16_t len, float32_t *xL, float32_t *xR)
+{
+	if (bp || len != AUDIO_BLOCK_SAMPLES) return -1;
+	if (!ready)
+	{
+		memset(L, 0, len * sizeof(float32_t));
+		memset(R, 0, len * sizeof(float32_t));
+		return -1;
+	}
+	if (fadeReq)
+	{
+		fadeReq = false;
+		fading = true;
+		fadePos = 0;
+	}
+	if (fading)
+	{
+		// the new IR starts with empty delay lines, its output builds up during the fade
+		memcpy(fadeL, L, len * sizeof(float32_t));
+		memcpy(fadeR, R, len * sizeof(float32_t));
+		engine[cur ^ 1].process(fadeL, fadeR, blockCount);
+	}
+	const int32_t x = engine[cur].process(L, R, blockCount, xL, xR);
+	if (fading)
+	{
+		const float32_t k = PI / fadeLen;
+		for (uint32_t i = 0; i < len; i++)
+		{
+			const uint32_t n = fadePos + i;
+			const float32_t g = n < fadeLen ? 0.5f - 0.5f * arm_cos_f32(k * n) : 1.0f;
+			L[i] += g * (fadeL[i] - L[i]);
+			R[i] += g * (fadeR[i] - R[i]);
+		}
+		fadePos += len;
+		if (fadePos >= fadeLen)
+		{
+			cur ^= 1;
+			fading = false;
+		}
+	}
+	blockCount++;
+	return x;
+}
+
+void AudioFilterIRConvolver_F32::update()
+{
+	audio_block_f32_t *blockL, *blockR;
+	if (bp) // handle bypass
+	{
+		blockL = AudioStream_F32::receiveReadOnly_f32(0);
+		blockR = AudioStream_F32::receiveReadOnly_f32(1);
+		if (!blockL || !blockR)
+		{
+			if (blockL) AudioStream_F32::release(blockL);
+			if (blockR) AudioStream_F32::release(blockR);
+			return;
+		}
+		AudioStream_F32::transmit(blockL, 0);
+		AudioStream_F32::transmit(blockR, 1);
+		AudioStream_F32::release(blockL);
+		AudioStream_F32::release(blockR);
+		return;
+	}
+	blockL = AudioStream_F32::receiveWritable_f32(0);
+	blockR = AudioStream_F32::receiveWritable_f32(1);
+	if (!blockL || !blockR)
+	{
+		if (blockL) AudioStream_F32::release(blockL);
+		if (blockR) AudioStream_F32::release(blockR);
+		return;
+	}
+	processBlock(blockL->data, blockR->data, blockL->length);
+	AudioStream_F32::transmit(blockL, 0);
+	AudioStream_F32::transmit(blockR, 1);
+	AudioStream_F32::release(blockL);
+	AudioStream_F32::release(blockR);
+}
@@ -0,0 +1,318 @@
+/**
+ * @file AudioFilterIRConvolver_F32.h
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Stereo convolution with long impulse responses (rooms, reverbs,
+ * 		mic'd cabinets), non-uniform partitioned.
+ * 		The IR is split into partitions growing with the distance from
+ * 		its start. The head is made of a few block sized partitions
+ * 		convolved in every block, so there is no latency added to the one
+ * 		of the audio block. The next levels double the partition size
+ * 		(2 partitions each) up to IR_CONV_PART_MAX, the rest of the tail
+ * 		uses the largest size. Every level is a uniformly partitioned
+ * 		overlap-save convolution with a frequency domain delay line.
+ * 		A level with a partition of m blocks gets a new input segment
+ * 		every m blocks and spreads its work over the next m blocks:
+ * 		the forward FFT in the first one, the spectrum multiply-adds
+ * 		of its partitions evenly and the inverse FFT in the last one.
+ * 		From 4 blocks up the FFTs of the two channels go to separate
+ * 		blocks, halving the cost of the FFT blocks. Optionally the smaller
+ * 		levels, where both channels are transformed in the same block,
+ * 		pack L and R into the real and imaginary parts of one complex
+ * 		FFT (packing_set()): the two real spectra are separated with the
+ * 		conjugate symmetry for the multiply-adds and joined again for one
+ * 		inverse FFT of both channels.
+ * 		The channels can use different IRs (doubler, stereo cabinet
+ * 		or room), then only the multiply-adds are done twice.
+ * 		The level offsets leave 2 blocks of slack, used to shift the
+ * 		FFT blocks of the levels against each other, so the cost of
+ * 		every block stays close to the average.
+ *
+ * 		The IR spectra of the tail levels and their delay lines are
+ * 		stored in the PSRAM (extmem_malloc, falls back to the RAM
+ * 		without PSRAM), the head level, the accumulators and the
+ * 		input/output rings are in the RAM.
+ *
+ * 		Usage: load() the IR in loop() (the output is muted during the
+ * 		preparation) or pass it prepared spectra (IRLoader_F32), then connect the object with cables or add it to
+ * 		an AudioChain_F32. Full audio blocks only.
+ * 		To change the IR while playing, prepare the spectra in the
+ * 		background and crossfade() to them: both IRs run for the fade
+ * 		time, the CPU load of the convolver doubles for that time.
+ * @version 0.1
+ * @date 2024-03-14
+ */
+#ifndef _AUDIOFILTERIRCONVOLVER_F32_H_
+#define _AUDIOFILTERIRCONVOLVER_F32_H_
+
+#include <Arduino.h>
+#include "AudioStream_F32.h"
+#include "arm_math.h"
+#include "AudioChain_F32.h"
+
+#define IR_CONV_HEAD_PARTS		(4)			// block sized partitions at the IR start, min 2
+#define IR_CONV_PART_MAX		(2048)		// largest partition, FFT size 2x, max 4096 for arm_rfft_fast_f32
+#define IR_CONV_MAX_LEVELS		(10)
+#define IR_CONV_XFADE_MS		(20.0f)		// default crossfade time of crossfade()
+
+/**
+ * @brief IR cut into the partitions of the convolver and their spectra
+ */
+class IRPartitions_F32
+{
+public:
+	typedef struct
+	{
+		uint16_t size;			// partition size P
+		uint16_t count;			// number of partitions K
+		uint32_t offset;		// first IR sample of the level
+		float32_t *spectra;		// K spectra of the zero padded partitions, 2P floats each (arm_rfft_fast_f32 format)
+	} level_t;
+
+	IRPartitions_F32() {}
+	~IRPartitions_F32() {free();}
+	/**
+	 * @brief Compute the partition layout for an IR and allocate the spectra
+	 *
+	 * @param len IR length in samples
+	 * @param partMax largest partition, power of 2, AUDIO_BLOCK_SAMPLES
+	 * 			gives a uniformly partitioned convolution
+	 * @return false if out of memory or invalid sizes
+	 */
+	bool setup(uint32_t len, uint16_t partMax = IR_CONV_PART_MAX);
+	/**
+	 * @brief Number of partitions setup() would make, 0 if invalid
+	 */
+	static uint16_t count(uint32_t len, uint16_t partMax = IR_CONV_PART_MAX);
+	/**
+	 * @brief FFT of one partition (0..getPartitions()-1), in the layout order
+	 *
+	 * @param ir the whole IR, setup() length
+	 */
+	void transform(const float32_t *ir, uint16_t part);
+	/**
+	 * @brief IR samples of one partition back from its spectrum, the
+	 * 			inverse of transform()
+	 *
+	 * @param ir the whole IR, getLength() samples
+	 */
+	void inverse(float32_t *ir, uint16_t part);
+	/**
+	 * @brief setup() and transform() of all the partitions
+	 */
+	bool prepare(const float32_t *ir, uint32_t len, uint16_t partMax = IR_CONV_PART_MAX);
+	void free();
+	/**
+	 * @brief Exchange the spectra with another object, no copying
+	 */
+	void swap(IRPartitions_F32 &other);
+	/**
+	 * @brief Exchange the spectra of one level, same layout required
+	 */
+	void swapLevel(IRPartitions_F32 &other, uint8_t l) {float32_t *p = level[l].spectra; level[l].spectra = other.level[l].spectra; other.level[l].spectra = p;}
+	/**
+	 * @brief Same levels, partition sizes and counts
+	 */
+	bool sameLayout(IRPartitions_F32 &other);
+
+	uint32_t getLength() {return length;}
+	uint8_t getLevels() {return levels;}
+	uint16_t getPartitions() {return partitions;}
+	const level_t &getLevel(uint8_t l) {return level[l];}
+	/**
+	 * @brief Memory used by the spectra
+	 */
+	uint32_t getBytesRAM() {return bytesRAM;}
+	uint32_t getBytesPSRAM() {return bytesPSRAM;}
+private:
+	static uint8_t plan(uint32_t len, uint16_t partMax, level_t *lv);
+	level_t level[IR_CONV_MAX_LEVELS];
+	uint8_t levels = 0;
+	uint16_t partitions = 0;
+	uint32_t length = 0;
+	uint32_t bytesRAM = 0;
+	uint32_t bytesPSRAM = 0;
+};
+
+class AudioFilterIRConvolver_F32 : public AudioStream_F32, public AudioChainStage_F32
+{
+public:
+	AudioFilterIRConvolver_F32() : AudioStream_F32(2, inputQueueArray_f32) {}
+	virtual void update(void);
+	/**
+	 * @brief Convolve a stereo block in place, len has to be AUDIO_BLOCK_SAMPLES
+	 */
+	void processBlock(float32_t *L, float32_t *R, uint16_t len) override;
+	/**
+	 * @brief processBlock() with the two outputs of an exchange(): during
+	 * 			its crossfade window L/R get the output of the new spectra,
+	 * 			xL/xR the one of the old spectra, mix them with exchangeMix()
+	 * @return sample position of the block in the window, -1 outside
+	 * 			of it (xL/xR not written)
+	 */
+	int32_t processBlock(float32_t *L, float32_t *R, uint16_t len, float32_t *xL, float32_t *xR);
+	/**
+	 * @brief Prepare the IR and switch to it, call from loop()
+	 * 			The output is muted until the preparation is finished.
+	 *
+	 * @param ir IR samples at the audio sample rate, not used after the call
+	 * @param len IR length in samples
+	 * @param partMax largest partition size, see IRPartitions_F32::setup()
+	 * @return false if out of memory, the convolver stays muted
+	 */
+	bool load(const float32_t *ir, uint32_t len, uint16_t partMax = IR_CONV_PART_MAX);
+	/**
+	 * @brief Switch to already prepared spectra (ie. read from a cache file),
+	 * 			call from loop(). The spectra are taken over, parts gets
+	 * 			the previous ones.
+	 * @return false if out of memory, the convolver stays muted
+	 */
+	bool load(IRPartitions_F32 &parts);
+	/**
+	 * @brief Separate IRs for the left and the right channel, ie. a doubler
+	 * 			or a stereo room, same length
+	 */
+	bool load(const float32_t *irL, const float32_t *irR, uint32_t len, uint16_t partMax = IR_CONV_PART_MAX);
+	/**
+	 * @brief Separate prepared spectra for the channels, the same partition
+	 * 			layout (IR length and partMax) is required
+	 */
+	bool load(IRPartitions_F32 &partsL, IRPartitions_F32 &partsR);
+	/**
+	 * @brief Switch to other prepared spectra without muting: the new IR
+	 * 			gets its own delay lines and runs in parallel with the
+	 * 			current one for the crossfade time, then the current one
+	 * 			stops. Any layout, the spectra are taken over, parts is
+	 * 			empty after the call. Call from loop(), then keep calling
+	 * 			crossfadeDone() until true, it frees the old IR.
+	 * 			Acts like load() if no IR is loaded yet.
+	 *
+	 * @param ms crossfade time, raised cosine
+	 * @return false if out of memory (the current IR keeps running),
+	 * 			a crossfade or an exchange is running
+	 */
+	bool crossfade(IRPartitions_F32 &parts, float32_t ms = IR_CONV_XFADE_MS);
+	bool crossfadeDone();
+	bool isFading() {return fadeReq || fading;}
+	/**
+	 * @brief Switch to other spectra of the same layout without muting and
+	 * 			without clearing the delay lines, ie. the same IR with an EQ
+	 * 			applied. Call from loop(). The output segments of every
+	 * 			level start at multiples of its partition size, so all the
+	 * 			levels take the new spectra for the same output sample, the
+	 * 			next multiple of the largest partition the work of no level
+	 * 			has started for. From there, for the fade time rounded up to
+	 * 			the largest partition, the levels run the old spectra too
+	 * 			(the multiply-adds and the inverse FFTs twice) and the output
+	 * 			crossfades. parts gets the previous spectra, it must not be
+	 * 			touched until exchangeDone(). Mono IR only, load() cancels a
+	 * 			running exchange.
+	 * @return false if not ready, stereo IRs, other layout, out of memory
+	 * 			or an exchange or a crossfade is running
+	 */
+	bool exchange(IRPartitions_F32 &parts, float32_t ms = IR_CONV_XFADE_MS);
+	bool exchangeDone() {return engine[cur].exchangeParts == NULL;}
+	/**
+	 * @brief Raised cosine crossfade of the exchange window, L/R: output
+	 * 			of the new spectra, xL/xR: the old ones, n: position
+	 * 			returned by processBlock()
+	 */
+	void exchangeMix(float32_t *L, float32_t *R, const float32_t *xL, const float32_t *xR, int32_t n, uint16_t len);
+	/**
+	 * @brief Clear the delay lines, ie. after a bypass
+	 */
+	void reset();
+	void bypass_set(bool state) {bp = state;}
+	bool bypass_get() {return bp;}
+	/**
+	 * @brief Packed complex FFT of both channels for the levels without
+	 * 			the split FFT blocks, false: separate real FFTs (default).
+	 * 			The unpack/pack passes replace the split/merge passes of
+	 * 			arm_rfft_fast_f32, no gain measured on the host.
+	 * 			Applied by the next load().
+	 */
+	void packing_set(bool state) {packing = state;}
+	bool packing_get() {return packing;}
+	bool isReady() {return ready;}
+	bool isStereo() {return engine[cur].isStereo();}
+	/**
+	 * @brief The running IR, the old one during a crossfade
+	 */
+	IRPartitions_F32 &getIR(uint8_t ch = 0) {return ch && isStereo() ? engine[cur].irR : engine[cur].ir;}
+	/**
+	 * @brief Memory used by the spectra, the delay lines and the buffers,
+	 * 			both IRs during a crossfade
+	 */
+	uint32_t getBytesRAM() {return engine[0].getBytesRAM() + engine[1].getBytesRAM();}
+	uint32_t getBytesPSRAM() {return engine[0].getBytesPSRAM() + engine[1].getBytesPSRAM();}
+private:
+	typedef struct
+	{
+		arm_rfft_fast_instance_f32 fft;
+		const arm_cfft_instance_f32 *cfft;	// packed L+jR transform
+		bool packed;
+		uint16_t blocks;			// partition size in audio blocks, m
+		uint16_t delay;				// blocks the work is shifted by, within the slack
+		uint16_t fdlIdx;			// delay line slot of the newest input spectrum
+		float32_t *fdl[2];			// K input spectra per channel
+		float32_t *acc[2];			// output spectrum being accumulated
+		float32_t *xacc[2];			// the same with the old spectra during an exchange
+		bool dual;					// segment in the exchange window
+	} state_t;
+	/**
+	 * @brief One IR with its delay lines, two of them run during a crossfade
+	 */
+	class Engine
+	{
+	public:
+		~Engine() {freeState();}
+		IRPartitions_F32 ir;
+		IRPartitions_F32 irR;			// right channel IR, empty if the same as the left one
+		IRPartitions_F32 * volatile exchangeParts = NULL;	// old spectra once the levels switched
+		uint16_t exchangeMask = 0;		// levels switched
+		bool exchangeStarted = false;	// window set by the audio update
+		uint32_t exchangeStart = 0;		// output sample positions of the window
+		uint32_t exchangeEnd = 0;
+		uint32_t exchangeLen = 0;
+		bool allocExchange();
+		bool isStereo() {return irR.getLevels() > 0;}
+		/**
+		 * @brief Runtime state for the current spectra, everything is freed on failure
+		 */
+		bool start(bool packing);
+		void freeState();
+		void free() {freeState(); ir.free(); irR.free();}
+		void reset();
+		int32_t process(float32_t *L, float32_t *R, uint32_t blockCount, float32_t *xL = NULL, float32_t *xR = NULL);
+		uint32_t getBytesRAM() {return ir.getBytesRAM() + irR.getBytesRAM() + bytesRAM;}
+		uint32_t getBytesPSRAM() {return ir.getBytesPSRAM() + irR.getBytesPSRAM() + bytesPSRAM;}
+	private:
+		state_t state[IR_CONV_MAX_LEVELS] = {};
+		float32_t *inRing[2] = {NULL, NULL};
+		float32_t *outRing[2] = {NULL, NULL};
+		float32_t *xRing[2] = {NULL, NULL};	// output of the old spectra during an exchange
+		float32_t *work = NULL;			// FFT input/output
+		uint32_t inMask = 0;
+		uint32_t outMask = 0;
+		uint32_t bytesRAM = 0;
+		uint32_t bytesPSRAM = 0;
+		bool allocState(bool packing);
+		void runLevel(uint8_t l, uint32_t pos, uint32_t blockCount);
+	};
+	audio_block_f32_t *inputQueueArray_f32[2];
+	Engine engine[2];
+	volatile uint8_t cur = 0;		// running engine, the other one fades in
+	uint32_t blockCount = 0;
+	float32_t fadeL[AUDIO_BLOCK_SAMPLES];	// input copy for the incoming IR, old output of an exchange
+	float32_t fadeR[AUDIO_BLOCK_SAMPLES];
+	uint32_t fadeLen = 0;			// samples
+	uint32_t fadePos = 0;
+	volatile bool fadeReq = false;
+	volatile bool fading = false;
+	volatile bool ready = false;
+	bool bp = false;
+	bool packing = false;
+	void stop();
+	bool start();
+};
+
+#endif // _AUDIOFILTERIRCONVOLVER_F32_H_
@@ -0,0 +1,334 @@
+/**
+ * @file AudioFilterToneStackAnalog_F32.cpp
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Stereo passive tone stack models
+ * @version 0.1
+ * @date 2024-03-17
+ */
+#include "AudioFilterToneStackAnalog_F32.h"
+
+// component values of the circuits: R1 treble pot, R2 bass pot, R3 mid pot, R4 slope resistor
+const AudioFilterToneStackAnalog_F32::circuit_t AudioFilterToneStackAnalog_F32::circuits[TONESTACK_MODEL_COUNT] =
+{
+	//	R1		R2		R3		R4		C1			C2			C3
+	{	250e3f,	1e6f,	25e3f,	56e3f,	250e-12f,	20e-9f,	20e-9f,	"Bassman"},
+	{	250e3f,	250e3f,	4.8e3f,	100e3f,	250e-12f,	100e-9f,	47e-9f,	"Princeton"},
+	{	250e3f,	250e3f,	10e3f,	100e3f,	120e-12f,	100e-9f,	47e-9f,	"Twin Reverb"},
+	{	250e3f,	250e3f,	25e3f,	100e3f,	250e-12f,	100e-9f,	47e-9f,	"Mesa Mark"},
+	{	220e3f,	1e6f,	22e3f,	33e3f,	470e-12f,	22e-9f,	22e-9f,	"JCM800"},
+	{	250e3f,	1e6f,	25e3f,	56e3f,	500e-12f,	22e-9f,	22e-9f,	"JCM2000"},
+	{	250e3f,	1e6f,	25e3f,	33e3f,	270e-12f,	22e-9f,	22e-9f,	"JTM45"},
+	{	250e3f,	250e3f,	25e3f,	56e3f,	250e-12f,	47e-9f,	47e-9f,	"Marshall 2199"},
+	{	1e6f,	1e6f,	10e3f,	100e3f,	50e-12f,	22e-9f,	22e-9f,	"AC30"},
+	{	250e3f,	1e6f,	25e3f,	47e3f,	470e-12f,	20e-9f,	20e-9f,	"Soldano SLO"},
+};
+
+// largest real root of z^3 + p*z^2 + q*z + s: the same root for all the knob
+// positions, so the factored sections change smoothly between the grid points
+static double largestRoot(double p, double q, double s)
+{
+	// depressed cubic y^3 + a*y + b, z = y - p/3
+	const double a = q - p * p / 3.0;
+	const double b = 2.0 * p * p * p / 27.0 - p * q / 3.0 + s;
+	const double disc = b * b / 4.0 + a * a * a / 27.0;
+	double y;
+	if (disc > 0.0)
+	{
+		const double r = sqrt(disc);
+		y = cbrt(-b / 2.0 + r) + cbrt(-b / 2.0 - r);
+	}
+	else
+	{
+		// three real roots, k = 0 of the trigonometric solution is the largest
+		const double r = sqrt(-a / 3.0);
+		y = r > 0.0 ? 2.0 * r * cos(acos(constrain(-b / (2.0 * r * r * r), -1.0, 1.0)) / 3.0) : 0.0;
+	}
+	double z = y - p / 3.0;
+	// polish, the closed form loses digits with the roots close to 1
+	for (uint8_t i = 0; i < 3; i++)
+	{
+		const double f = ((z + p) * z + q) * z + s, d = (3.0 * z + 2.0 * p) * z + q;
+		if (d != 0.0) z -= f / d;
+	}
+	return z;
+}
+
+AudioFilterToneStackAnalog_F32::AudioFilterToneStackAnalog_F32() : AudioStream_F32(2, inputQueueArray_f32)
+{
+	smoothK = 1.0f - expf(-AUDIO_BLOCK_SAMPLES / (TONESTACK_SMOOTH_MS * 0.001f * AUDIO_SAMPLE_RATE_EXACT));
+	knob[0] = bass;
+	knob[1] = mid;
+	knob[2] = treble;
+	knob[3] = gain;
+	setModel(model);
+	const float32_t *g = grid();
+	if (g) interpolate(g, bass, mid, treble, gain, cur);
+	else design(model, bass, mid, treble, cur);
+	expand(cur, coeffs);
+	cascade.init(TONESTACK_STAGES, coeffs);
+	arm_biquad_cascade_df2T_init_f32(&biquadOff, TONESTACK_STAGES, offCoeffs, offState);
+	reset();
+	pending = false;
+}
+
+AudioFilterToneStackAnalog_F32::~AudioFilterToneStackAnalog_F32()
+{
+	if (ramGrid) free(ramGrid);
+}
+
+void AudioFilterToneStackAnalog_F32::setModel(tonestack_model_t m)
+{
+	if (m >= TONESTACK_MODEL_COUNT) return;
+	if (fabsf(toneStackTableRate - AUDIO_SAMPLE_RATE_EXACT) > 0.5f)
+	{
+		// tables for another sample rate: the grid of this model in the RAM
+		float32_t *g = (float32_t *)malloc(TONESTACK_TABLE_SIZE * sizeof(float32_t));
+		if (!g) return;
+		for (uint32_t i = 0; i < TONESTACK_GRID * TONESTACK_GRID * TONESTACK_GRID; i++)
+		{
+			const float32_t step = 1.0f / (TONESTACK_GRID - 1);
+			design(m, (i / (TONESTACK_GRID * TONESTACK_GRID)) * step, ((i / TONESTACK_GRID) % TONESTACK_GRID) * step,
+				   (i % TONESTACK_GRID) * step, g + i * TONESTACK_COEFFS);
+		}
+		float32_t *old = ramGrid;
+		__disable_irq();
+		ramGrid = g;
+		model = m;
+		__enable_irq();
+		if (old) free(old);
+	}
+	else model = m;
+	change();
+}
+
+const char *AudioFilterToneStackAnalog_F32::getName(tonestack_model_t m)
+{
+	return m < TONESTACK_MODEL_COUNT ? circuits[m].name : "";
+}
+
+void AudioFilterToneStackAnalog_F32::setTone(float32_t b, float32_t m, float32_t t)
+{
+	bass = constrain(b, 0.0f, 1.0f);
+	mid = constrain(m, 0.0f, 1.0f);
+	treble = constrain(t, 0.0f, 1.0f);
+	change();
+}
+
+void AudioFilterToneStackAnalog_F32::setGain(float32_t g)
+{
+	gain = g;
+	change();
+}
+
+void AudioFilterToneStackAnalog_F32::change()
+{
+	__disable_irq();
+	pending = true;
+	version++;
+	__enable_irq();
+}
+
+const float32_t *AudioFilterToneStackAnalog_F32::grid()
+{
+	return ramGrid ? ramGrid : fabsf(toneStackTableRate - AUDIO_SAMPLE_RATE_EXACT) > 0.5f ? NULL : toneStackTables[model];
+}
+
+void AudioFilterToneStackAnalog_F32::design(tonestack_model_t model, float32_t bass, float32_t mid, float32_t treble, float32_t *c)
+{
+	const circuit_t &cc = circuits[model];
+	const double R1 = cc.R1, R2 = cc.R2, R3 = cc.R3, R4 = cc.R4;
+	const double C1 = cc.C1, C2 = cc.C2, C3 = cc.C3;
+	const double t = treble, m = mid;
+	const double l = exp((bass - 1.0) * 3.4);		// log taper
+	// analog transfer function (b1 s + b2 s^2 + b3 s^3) / (a0 + a1 s + a2 s^2 + a3 s^3)
+	const double b1 = t * C1 * R1 + m * C3 * R3 + l * (C1 * R2 + C2 * R2) + (C1 * R3 + C2 * R3);
+	const double b2 = t * (C1 * C2 * R1 * R4 + C1 * C3 * R1 * R4) - m * m * (C1 * C3 * R3 * R3 + C2 * C3 * R3 * R3)
+					+ m * (C1 * C3 * R1 * R3 + C1 * C3 * R3 * R3 + C2 * C3 * R3 * R3)
+					+ l * (C1 * C2 * R1 * R2 + C1 * C2 * R2 * R4 + C1 * C3 * R2 * R4)
+					+ l * m * (C1 * C3 * R2 * R3 + C2 * C3 * R2 * R3)
+					+ (C1 * C2 * R1 * R3 + C1 * C2 * R3 * R4 + C1 * C3 * R3 * R4);
+	const double b3 = l * m * (C1 * C2 * C3 * R1 * R2 * R3 + C1 * C2 * C3 * R2 * R3 * R4)
+					- m * m * (C1 * C2 * C3 * R1 * R3 * R3 + C1 * C2 * C3 * R3 * R3 * R4)
+					+ m * (C1 * C2 * C3 * R1 * R3 * R3 + C1 * C2 * C3 * R3 * R3 * R4)
+					+ t * C1 * C2 * C3 * R1 * R3 * R4 - t * m * C1 * C2 * C3 * R1 * R3 * R4
+					+ t * l * C1 * C2 * C3 * R1 * R2 * R4;
+	const double a0 = 1.0;
+	const double a1 = (C1 * R1 + C1 * R3 + C2 * R3 + C2 * R4 + C3 * R4) + m * C3 * R3 + l * (C1 * R2 + C2 * R2);
+	const double a2 = m * (C1 * C3 * R1 * R3 - C2 * C3 * R3 * R4 + C1 * C3 * R3 * R3 + C2 * C3 * R3 * R3)
+					+ l * m * (C1 * C3 * R2 * R3 + C2 * C3 * R2 * R3)
+					- m * m * (C1 * C3 * R3 * R3 + C2 * C3 * R3 * R3)
+					+ l * (C1 * C2 * R2 * R4 + C1 * C2 * R1 * R2 + C1 * C3 * R2 * R4 + C2 * C3 * R2 * R4)
+					+ (C1 * C2 * R1 * R4 + C1 * C3 * R1 * R4 + C1 * C2 * R3 * R4 + C1 * C2 * R1 * R3 + C1 * C3 * R3 * R4 + C2 * C3 * R3 * R4);
+	const double a3 = l * m * (C1 * C2 * C3 * R1 * R2 * R3 + C1 * C2 * C3 * R2 * R3 * R4)
+					- m * m * (C1 * C2 * C3 * R1 * R3 * R3 + C1 * C2 * C3 * R3 * R3 * R4)
+					+ m * (C1 * C2 * C3 * R3 * R3 * R4 + C1 * C2 * C3 * R1 * R3 * R3 - C1 * C2 * C3 * R1 * R3 * R4)
+					+ l * C1 * C2 * C3 * R1 * R2 * R4 + C1 * C2 * C3 * R1 * R3 * R4;
+	// bilinear transform
+	const double k = 2.0 * AUDIO_SAMPLE_RATE_EXACT, k2 = k * k, k3 = k2 * k;
+	const double B[4] = {-b1 * k - b2 * k2 - b3 * k3, -b1 * k + b2 * k2 + 3.0 * b3 * k3,
+						 b1 * k + b2 * k2 - 3.0 * b3 * k3, b1 * k - b2 * k2 + b3 * k3};
+	const double A[4] = {-a0 - a1 * k - a2 * k2 - a3 * k3, -3.0 * a0 - a1 * k + a2 * k2 + 3.0 * a3 * k3,
+						 -3.0 * a0 + a1 * k + a2 * k2 - 3.0 * a3 * k3, -a0 + a1 * k - a2 * k2 + a3 * k3};
+	// B0 + B1 z^-1 + B2 z^-2 + B3 z^-3 = (1 - r z^-1)(B0 + q1 z^-1 + q2 z^-2)
+	const double rb = largestRoot(B[1] / B[0], B[2] / B[0], B[3] / B[0]);
+	const double ra = largestRoot(A[1] / A[0], A[2] / A[0], A[3] / A[0]);
+	const double q1 = B[1] + B[0] * rb, q2 = B[2] + q1 * rb;
+	const double p1 = A[1] + A[0] * ra, p2 = A[2] + p1 * ra;
+	// CMSIS signs: b0, b1, b2, -a1, -a2 of the biquad, b1, -a1 of the 1st order section
+	c[0] = B[0] / A[0];
+	c[1] = q1 / A[0];
+	c[2] = q2 / A[0];
+	c[3] = -p1 / A[0];
+	c[4] = -p2 / A[0];
+	c[5] = -rb;
+	c[6] = ra;
+}
+
+void AudioFilterToneStackAnalog_F32::interpolate(const float32_t *grid, float32_t bass, float32_t mid, float32_t treble,
+												 float32_t gain, float32_t *c)
+{
+	const float32_t pos[3] = {bass, mid, treble};
+	uint32_t idx[3];
+	float32_t frac[3];
+	for (uint8_t k = 0; k < 3; k++)
+	{
+		const float32_t x = constrain(pos[k], 0.0f, 1.0f) * (TONESTACK_GRID - 1);
+		idx[k] = min((uint32_t)x, (uint32_t)(TONESTACK_GRID - 2));
+		frac[k] = x - idx[k];
+	}
+	memset(c, 0, TONESTACK_COEFFS * sizeof(float32_t));
+	for (uint8_t corner = 0; corner < 8; corner++)
+	{
+		float32_t w = 1.0f;
+		uint32_t i = 0;
+		for (uint8_t k = 0; k < 3; k++)
+		{
+			const uint8_t up = (corner >> k) & 1;
+			w *= up ? frac[k] : 1.0f - frac[k];
+			i = i * TONESTACK_GRID + idx[k] + up;
+		}
+		const float32_t *g = grid + i * TONESTACK_COEFFS;
+		for (uint8_t n = 0; n < TONESTACK_COEFFS; n++) c[n] += w * g[n];
+	}
+	for (uint8_t n = 0; n < 3; n++) c[n] *= gain;
+}
+
+// the 2 stage cascade in the CMSIS format, the 1st order section has b0 = 1
+void AudioFilterToneStackAnalog_F32::expand(const float32_t *c, float32_t *cascade)
+{
+	const float32_t cf[5 * TONESTACK_STAGES] = {c[0], c[1], c[2], c[3], c[4], 1.0f, c[5], 0.0f, c[6], 0.0f};
+	memcpy(cascade, cf, sizeof(cf));
+}
+
+float32_t AudioFilterToneStackAnalog_F32::response(float32_t freq)
+{
+	const float32_t *g = grid();
+	float32_t c[TONESTACK_COEFFS], cascade[5 * TONESTACK_STAGES];
+	if (!g) return 0.0f;
+	interpolate(g, bass, mid, treble, gain, c);
+	expand(c, cascade);
+	const double w = 2.0 * M_PI * freq / AUDIO_SAMPLE_RATE_EXACT;
+	double mag = 1.0;
+	for (uint8_t s = 0; s < TONESTACK_STAGES; s++)
+	{
+		const float32_t *cs = cascade + 5 * s;
+		// |b0 + b1 e^-jw + b2 e^-2jw| / |1 - a1 e^-jw - a2 e^-2jw| with the CMSIS signs
+		const double nr = cs[0] + cs[1] * cos(w) + cs[2] * cos(2.0 * w), ni = -cs[1] * sin(w) - cs[2] * sin(2.0 * w);
+		const double dr = 1.0 - cs[3] * cos(w) - cs[4] * cos(2.0 * w), di = cs[3] * sin(w) + cs[4] * sin(2.0 * w);
+		mag *= sqrt((nr * nr + ni * ni) / (dr * dr + di * di));
+	}
+	return mag;
+}
+
+void AudioFilterToneStackAnalog_F32::reset()
+{
+	__disable_irq();
+	cascade.reset();
+	__enable_irq();
+}
+
+void AudioFilterToneStackAnalog_F32::offlineReset()
+{
+	// the settings the audio update settles to
+	const float32_t *g = grid();
+	float32_t c[TONESTACK_COEFFS];
+	if (g) interpolate(g, bass, mid, treble, gain, c);
+	else memcpy(c, cur, sizeof(c));
+	expand(c, offCoeffs);
+	offBp = bp;
+	memset(offState, 0, sizeof(offState));
+}
+
+void AudioFilterToneStackAnalog_F32::offlineProcess(float32_t *buf, uint32_t len)
+{
+	if (!offBp) arm_biquad_cascade_df2T_f32(&biquadOff, buf, buf, len);
+}
+
+// coefficients moving linearly from cur to target over the block
+void AudioFilterToneStackAnalog_F32::ramp(float32_t *L, float32_t *R, uint16_t len, const float32_t *target)
+{
+	float32_t to[5 * TONESTACK_STAGES];
+	expand(target, to);
+	cascade.ramp(L, R, len, coeffs, to);
+	memcpy(cur, target, sizeof(cur));
+	memcpy(coeffs, to, sizeof(coeffs));
+}
+
+void AudioFilterToneStackAnalog_F32::processBlock(float32_t *L, float32_t *R, uint16_t len)
+{
+	if (bp) return;
+	const float32_t *g = grid();
+	if ((settled && !pending) || !g || !len)
+	{
+		cascade.process(L, R, len);
+		return;
+	}
+	pending = false;
+	// one pole smoothing of the knobs per block, the coefficients ramp over the samples
+	const float32_t target[4] = {bass, mid, treble, gain};
+	bool done = true;
+	for (uint8_t k = 0; k < 4; k++)
+	{
+		knob[k] += smoothK * (target[k] - knob[k]);
+		if (fabsf(target[k] - knob[k]) <= 1e-4f * (k == 3 ? max(fabsf(target[k]), 1.0f) : 1.0f)) knob[k] = target[k];
+		else done = false;
+	}
+	float32_t c[TONESTACK_COEFFS];
+	interpolate(g, knob[0], knob[1], knob[2], knob[3], c);
+	ramp(L, R, len, c);
+	settled = done;
+}
+
+void AudioFilterToneStackAnalog_F32::update()
+{
+	audio_block_f32_t *blockL, *blockR;
+	if (bp) // handle bypass
+	{
+		blockL = AudioStream_F32::receiveReadOnly_f32(0);
+		blockR = AudioStream_F32::receiveReadOnly_f32(1);
+		if (!blockL || !blockR)
+		{
+			if (blockL) AudioStream_F32::release(blockL);
+			if (blockR) AudioStream_F32::release(blockR);
+			return;
+		}
+		AudioStream_F32::transmit(blockL, 0);
+		AudioStream_F32::transmit(blockR, 1);
+		AudioStream_F32::release(blockL);
+		AudioStream_F32::release(blockR);
+		return;
+	}
+	blockL = AudioStream_F32::receiveWritable_f32(0);
+	blockR = AudioStream_F32::receiveWritable_f32(1);
+	if (!blockL || !blockR)
+	{
+		if (blockL) AudioStream_F32::release(blockL);
+		if (blockR) AudioStream_F32::release(blockR);
+		return;
+	}
+	processBlock(blockL->data, blockR->data, blockL->length);
+	AudioStream_F32::transmit(blockL, 0);
+	AudioStream_F32::transmit(blockR, 1);
+	AudioStream_F32::release(blockL);
+	AudioStream_F32::release(blockR);
+}
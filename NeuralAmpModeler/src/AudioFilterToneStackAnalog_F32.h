@@ -0,0 +1,147 @@
+/**
+ * @file AudioFilterToneStackAnalog_F32.h
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Stereo passive tone stack (bass/mid/treble) of the classic amps,
+ * 		the 3rd order analog transfer function of the circuit (D.T. Yeh,
+ * 		J.O. Smith, "Discretization of the '59 Fender Bassman tone stack")
+ * 		with the component values of each model, bilinear transformed.
+ * 		The digital filter is factored into a biquad and a 1st order
+ * 		section, run as a 2 stage df2T biquad cascade, both channels in
+ * 		one pass (BiquadStereo_F32).
+ * 		The coefficients are not computed at runtime: a table per model
+ * 		holds them on a grid of the knob positions (bass x mid x treble,
+ * 		TONESTACK_GRID points each), generated on the host by the
+ * 		tonestack_tables tool, see HostSim. The audio update smooths the
+ * 		knob positions, interpolates the table (trilinear) once per block
+ * 		and ramps the coefficients linearly over the samples of the block,
+ * 		so setTone() is cheap and can be called every block (expression
+ * 		pedal, envelope) without zipper noise. The interpolated sections
+ * 		stay stable: the stable biquads form a convex set.
+ * 		If the audio sample rate differs from the one of the tables, the
+ * 		grid of the current model is computed in the RAM by setModel().
+ *
+ * 		The filter is linear and time invariant while the knobs rest, it
+ * 		can be folded into a cabinet IR, see AudioFilterCabEQ_F32.
+ * @version 0.1
+ * @date 2024-03-17
+ */
+#ifndef _AUDIOFILTERTONESTACKANALOG_F32_H_
+#define _AUDIOFILTERTONESTACKANALOG_F32_H_
+
+#include <Arduino.h>
+#include "AudioStream_F32.h"
+#include "arm_math.h"
+#include "AudioChain_F32.h"
+#include "BiquadStereo_F32.h"
+
+#define TONESTACK_STAGES		(2)			// biquad + 1st order section
+#define TONESTACK_COEFFS		(7)			// per grid point: b0 b1 b2 -a1 -a2 of the biquad, b1 -a1 of the 1st order section
+#define TONESTACK_GRID			(9)			// table points per knob
+#define TONESTACK_SMOOTH_MS		(20.0f)		// knob smoothing time constant
+
+typedef enum
+{
+	TONESTACK_MODEL_BASSMAN,
+	TONESTACK_MODEL_PRINCETON,
+	TONESTACK_MODEL_TWIN,
+	TONESTACK_MODEL_MESA,
+	TONESTACK_MODEL_JCM800,
+	TONESTACK_MODEL_JCM2000,
+	TONESTACK_MODEL_JTM45,
+	TONESTACK_MODEL_M2199,
+	TONESTACK_MODEL_AC30,
+	TONESTACK_MODEL_SOLDANO,
+	TONESTACK_MODEL_COUNT
+} tonestack_model_t;
+
+#define TONESTACK_TABLE_SIZE	(TONESTACK_GRID * TONESTACK_GRID * TONESTACK_GRID * TONESTACK_COEFFS)
+
+/**
+ * @brief Generated coefficient tables, AudioFilterToneStackTables_F32.cpp
+ * 			[model][bass][mid][treble][coefficient], without the output gain
+ */
+extern const float32_t toneStackTableRate;
+extern const float32_t toneStackTables[TONESTACK_MODEL_COUNT][TONESTACK_TABLE_SIZE];
+
+class AudioFilterToneStackAnalog_F32 : public AudioStream_F32, public AudioChainLinearStage_F32
+{
+public:
+	AudioFilterToneStackAnalog_F32();
+	~AudioFilterToneStackAnalog_F32();
+	virtual void update(void);
+	void processBlock(float32_t *L, float32_t *R, uint16_t len) override;
+	void setModel(tonestack_model_t model);
+	tonestack_model_t getModel() {return model;}
+	const char *getName() {return getName(model);}
+	static const char *getName(tonestack_model_t model);
+	/**
+	 * @brief Knob positions 0.0 .. 1.0, the bass pot is logarithmic.
+	 * 			The audio update moves to the new positions smoothly.
+	 */
+	void setTone(float32_t bass, float32_t mid, float32_t treble);
+	void setBass(float32_t bass) {setTone(bass, mid, treble);}
+	void setMid(float32_t mid) {setTone(bass, mid, treble);}
+	void setTreble(float32_t treble) {setTone(bass, mid, treble);}
+	/**
+	 * @brief Output gain, linear, compensates the loss of the passive circuit
+	 */
+	void setGain(float32_t g);
+	void bypass_set(bool state) {bp = state; version++;}
+	bool bypass_get() {return bp;}
+	/**
+	 * @brief Magnitude response at a frequency for the current settings
+	 * 			(the table interpolation, after the smoothing)
+	 */
+	float32_t response(float32_t freq);
+	/**
+	 * @brief Exact coefficients of the circuit at the knob positions,
+	 * 			TONESTACK_COEFFS values without the gain, the source of the
+	 * 			tables
+	 */
+	static void design(tonestack_model_t model, float32_t bass, float32_t mid, float32_t treble, float32_t *c);
+	/**
+	 * @brief Table interpolation, TONESTACK_COEFFS values
+	 */
+	static void interpolate(const float32_t *grid, float32_t bass, float32_t mid, float32_t treble, float32_t gain, float32_t *c);
+
+	void reset() override;
+	uint32_t getVersion() override {return version;}
+	void offlineReset() override;
+	void offlineProcess(float32_t *buf, uint32_t len) override;
+private:
+	typedef struct
+	{
+		float32_t R1, R2, R3, R4;
+		float32_t C1, C2, C3;
+		const char *name;
+	} circuit_t;
+	static const circuit_t circuits[TONESTACK_MODEL_COUNT];
+	audio_block_f32_t *inputQueueArray_f32[2];
+	volatile tonestack_model_t model = TONESTACK_MODEL_BASSMAN;
+	// settings, the targets of the smoothing
+	volatile float32_t bass = 0.5f;
+	volatile float32_t mid = 0.5f;
+	volatile float32_t treble = 0.5f;
+	volatile float32_t gain = 1.0f;
+	volatile bool pending = false;			// settings changed since the last block
+	volatile uint32_t version = 0;
+	bool bp = false;
+	// audio update
+	float32_t knob[4];						// smoothed bass, mid, treble, gain
+	float32_t cur[TONESTACK_COEFFS];		// coefficients at the end of the last block
+	bool settled = true;
+	float32_t smoothK;
+	float32_t coeffs[5 * TONESTACK_STAGES];		// cascade coefficients while the knobs rest
+	BiquadStereo_F32 cascade;
+	float32_t offCoeffs[5 * TONESTACK_STAGES];	// snapshot for offlineProcess()
+	float32_t offState[2 * TONESTACK_STAGES];
+	bool offBp = false;
+	arm_biquad_cascade_df2T_instance_f32 biquadOff;
+	float32_t *ramGrid = NULL;				// grid of the current model if the tables are for another sample rate
+	const float32_t *grid();
+	void change();
+	void ramp(float32_t *L, float32_t *R, uint16_t len, const float32_t *target);
+	static void expand(const float32_t *c, float32_t *cascade);
+};
+
+#endif // _AUDIOFILTERTONESTACKANALOG_F32_H_
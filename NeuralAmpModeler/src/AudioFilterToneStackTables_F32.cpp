@@ -0,0 +1,7337 @@
+/**
+ * @file AudioFilterToneStackTables_F32.cpp
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Coefficient tables of AudioFilterToneStackAnalog_F32, generated
+ * 		by tonestack_tables (HostSim), do not edit.
+ * 		9^3 knob positions per model (bass, mid, treble 0..1, the
+ * 		treble changes fastest), 7 coefficients each.
+ * @version 0.1
+ * @date 2024-03-18
+ */
+#include "AudioFilterToneStackAnalog_F32.h"
+
+const float32_t toneStackTableRate = 44117.64844f;
+
+PROGMEM const float32_t toneStackTables[TONESTACK_MODEL_COUNT][TONESTACK_TABLE_SIZE] =
+{
+	// Bassman
+	{
+		0.0135230552f, 0.00304343342f, -0.0104796216f, 1.63671207f, -0.65206933f, -1.0f, 0.992399752f,
+		0.11790479f, -0.201704174f, 0.0899264887f, 1.63671207f, -0.65206933f, -1.0f, 0.992399752f,
+		0.222286522f, -0.406451792f, 0.190332592f, 1.63671207f, -0.65206933f, -1.0f, 0.992399752f,
+		0.326668262f, -0.611199379f, 0.290738702f, 1.63671207f, -0.65206933f, -1.0f, 0.992399752f,
+		0.431049973f, -0.815946996f, 0.391144812f, 1.63671207f, -0.65206933f, -1.0f, 0.992399752f,
+		0.535431683f, -1.02069461f, 0.491550922f, 1.63671207f, -0.65206933f, -1.0f, 0.992399752f,
+		0.639813423f, -1.22544217f, 0.591957033f, 1.63671207f, -0.65206933f, -1.0f, 0.992399752f,
+		0.744195163f, -1.43018985f, 0.692363143f, 1.63671207f, -0.65206933f, -1.0f, 0.992399752f,
+		0.848576903f, -1.63493741f, 0.792769253f, 1.63671207f, -0.65206933f, -1.0f, 0.992399752f,
+		0.0742263794f, -0.101718284f, 0.033839561f, 1.63888156f, -0.654467523f, -1.0f, 0.992582619f,
+		0.172184929f, -0.29365778f, 0.127860367f, 1.63888156f, -0.654467523f, -1.0f, 0.992582619f,
+		0.270143479f, -0.485597283f, 0.221881166f, 1.63888156f, -0.654467523f, -1.0f, 0.992582619f,
+		0.368102044f, -0.677536786f, 0.315901965f, 1.63888156f, -0.654467523f, -1.0f, 0.992582619f,
+		0.466060579f, -0.869476318f, 0.409922749f, 1.63888156f, -0.654467523f, -1.0f, 0.992582619f,
+		0.564019144f, -1.06141579f, 0.503943563f, 1.63888156f, -0.654467523f, -1.0f, 0.992582619f,
+		0.661977708f, -1.25335526f, 0.597964346f, 1.63888156f, -0.654467523f, -1.0f, 0.992582619f,
+		0.759936213f, -1.44529486f, 0.69198513f, 1.63888156f, -0.654467523f, -1.0f, 0.992582619f,
+		0.857894778f, -1.63723433f, 0.786005974f, 1.63888156f, -0.654467523f, -1.0f, 0.992582619f,
+		0.127889946f, -0.194060549f, 0.0728190765f, 1.640293f, -0.656222761f, -1.0f, 0.992762268f,
+		0.220170215f, -0.374654204f, 0.161172211f, 1.640293f, -0.656222761f, -1.0f, 0.992762268f,
+		0.312450469f, -0.555247903f, 0.249525338f, 1.640293f, -0.656222761f, -1.0f, 0.992762268f,
+		0.404730737f, -0.735841513f, 0.337878466f, 1.640293f, -0.656222761f, -1.0f, 0.992762268f,
+		0.497011006f, -0.916435182f, 0.426231593f, 1.640293f, -0.656222761f, -1.0f, 0.992762268f,
+		0.589291275f, -1.09702885f, 0.51458472f, 1.640293f, -0.656222761f, -1.0f, 0.992762268f,
+		0.681571543f, -1.27762246f, 0.602937877f, 1.640293f, -0.656222761f, -1.0f, 0.992762268f,
+		0.773851812f, -1.45821619f, 0.691290975f, 1.640293f, -0.656222761f, -1.0f, 0.992762268f,
+		0.866132081f, -1.6388098f, 0.779644132f, 1.640293f, -0.656222761f, -1.0f, 0.992762268f,
+		0.175670877f, -0.275977045f, 0.107301265f, 1.64098573f, -0.657379329f, -1.0f, 0.992937982f,
+		0.262895316f, -0.446442664f, 0.190582365f, 1.64098573f, -0.657379329f, -1.0f, 0.992937982f,
+		0.35011977f, -0.616908312f, 0.273863465f, 1.64098573f, -0.657379329f, -1.0f, 0.992937982f,
+		0.437344193f, -0.78737396f, 0.357144564f, 1.64098573f, -0.657379329f, -1.0f, 0.992937982f,
+		0.524568617f, -0.957839608f, 0.440425664f, 1.64098573f, -0.657379329f, -1.0f, 0.992937982f,
+		0.611793101f, -1.1283052f, 0.523706734f, 1.64098573f, -0.657379329f, -1.0f, 0.992937982f,
+		0.699017525f, -1.2987709f, 0.606987834f, 1.64098573f, -0.657379329f, -1.0f, 0.992937982f,
+		0.786241949f, -1.46923649f, 0.690268934f, 1.64098573f, -0.657379329f, -1.0f, 0.992937982f,
+		0.873466432f, -1.63970208f, 0.773550034f, 1.64098573f, -0.657379329f, -1.0f, 0.992937982f,
+		0.218485832f, -0.349034935f, 0.13794449f, 1.6409694f, -0.657956898f, -1.0f, 0.993109405f,
+		0.301179916f, -0.510395706f, 0.216651544f, 1.6409694f, -0.657956898f, -1.0f, 0.993109405f,
+		0.383873999f, -0.671756506f, 0.295358568f, 1.6409694f, -0.657956898f, -1.0f, 0.993109405f,
+		0.466568083f, -0.833117247f, 0.374065608f, 1.6409694f, -0.657956898f, -1.0f, 0.993109405f,
+		0.549262166f, -0.994478047f, 0.452772647f, 1.6409694f, -0.657956898f, -1.0f, 0.993109405f,
+		0.63195622f, -1.15583885f, 0.531479716f, 1.6409694f, -0.657956898f, -1.0f, 0.993109405f,
+		0.714650273f, -1.31719959f, 0.610186756f, 1.6409694f, -0.657956898f, -1.0f, 0.993109405f,
+		0.797344387f, -1.47856033f, 0.688893795f, 1.6409694f, -0.657956898f, -1.0f, 0.993109405f,
+		0.88003844f, -1.63992119f, 0.767600834f, 1.6409694f, -0.657956898f, -1.0f, 0.993109405f,
+		0.257070303f, -0.414476305f, 0.16526553f, 1.64022326f, -0.657950759f, -1.0f, 0.99327606f,
+		0.335681647f, -0.567597866f, 0.239816815f, 1.64022326f, -0.657950759f, -1.0f, 0.99327606f,
+		0.414293021f, -0.720719397f, 0.314368099f, 1.64022326f, -0.657950759f, -1.0f, 0.99327606f,
+		0.492904365f, -0.873840988f, 0.388919383f, 1.64022326f, -0.657950759f, -1.0f, 0.99327606f,
+		0.571515739f, -1.02696252f, 0.463470668f, 1.64022326f, -0.657950759f, -1.0f, 0.99327606f,
+		0.650127053f, -1.18008411f, 0.538021922f, 1.64022326f, -0.657950759f, -1.0f, 0.99327606f,
+		0.728738427f, -1.33320558f, 0.612573206f, 1.64022326f, -0.657950759f, -1.0f, 0.99327606f,
+		0.807349801f, -1.48632717f, 0.687124491f, 1.64022326f, -0.657950759f, -1.0f, 0.99327606f,
+		0.885961115f, -1.63944876f, 0.761675775f, 1.64022326f, -0.657950759f, -1.0f, 0.99327606f,
+		0.292021245f, -0.473288715f, 0.189668655f, 1.63869369f, -0.657330573f, -1.0f, 0.993437827f,
+		0.366934359f, -0.618907094f, 0.260416061f, 1.63869369f, -0.657330573f, -1.0f, 0.993437827f,
+		0.441847444f, -0.764525414f, 0.331163496f, 1.63869369f, -0.657330573f, -1.0f, 0.993437827f,
+		0.516760588f, -0.910143793f, 0.401910901f, 1.63869369f, -0.657330573f, -1.0f, 0.993437827f,
+		0.591673672f, -1.05576217f, 0.472658306f, 1.63869369f, -0.657330573f, -1.0f, 0.993437827f,
+		0.666586757f, -1.20138049f, 0.543405712f, 1.63869369f, -0.657330573f, -1.0f, 0.993437827f,
+		0.741499841f, -1.34699893f, 0.614153147f, 1.63869369f, -0.657330573f, -1.0f, 0.993437827f,
+		0.816412985f, -1.49261725f, 0.684900582f, 1.63869369f, -0.657330573f, -1.0f, 0.993437827f,
+		0.89132607f, -1.63823569f, 0.755647957f, 1.63869369f, -0.657330573f, -1.0f, 0.993437827f,
+		0.32382822f, -0.526254356f, 0.211464897f, 1.6362865f, -0.656035483f, -1.0f, 0.993594468f,
+		0.395375729f, -0.664996922f, 0.27870357f, 1.6362865f, -0.656035483f, -1.0f, 0.993594468f,
+		0.466923267f, -0.803739488f, 0.345942199f, 1.6362865f, -0.656035483f, -1.0f, 0.993594468f,
+		0.538470805f, -0.942482054f, 0.413180858f, 1.6362865f, -0.656035483f, -1.0f, 0.993594468f,
+		0.610018313f, -1.08122468f, 0.480419517f, 1.6362865f, -0.656035483f, -1.0f, 0.993594468f,
+		0.681565821f, -1.21996725f, 0.547658145f, 1.6362865f, -0.656035483f, -1.0f, 0.993594468f,
+		0.753113329f, -1.35870981f, 0.614896834f, 1.6362865f, -0.656035483f, -1.0f, 0.993594468f,
+		0.824660897f, -1.49745238f, 0.682135463f, 1.6362865f, -0.656035483f, -1.0f, 0.993594468f,
+		0.896208405f, -1.63619494f, 0.749374151f, 1.6362865f, -0.656035483f, -1.0f, 0.993594468f,
+		0.352896363f, -0.57398206f, 0.230883241f, 1.6328541f, -0.653964937f, -1.0f, 0.993746042f,
+		0.421368092f, -0.706383049f, 0.294857979f, 1.6328541f, -0.653964937f, -1.0f, 0.993746042f,
+		0.489839852f, -0.838784039f, 0.358832687f, 1.6328541f, -0.653964937f, -1.0f, 0.993746042f,
+		0.558311582f, -0.971184969f, 0.422807425f, 1.6328541f, -0.653964937f, -1.0f, 0.993746042f,
+		0.626783311f, -1.10358596f, 0.486782163f, 1.6328541f, -0.653964937f, -1.0f, 0.993746042f,
+		0.695255101f, -1.23598695f, 0.550756872f, 1.6328541f, -0.653964937f, -1.0f, 0.993746042f,
+		0.76372683f, -1.36838794f, 0.61473161f, 1.6328541f, -0.653964937f, -1.0f, 0.993746042f,
+		0.83219856f, -1.50078893f, 0.678706348f, 1.6328541f, -0.653964937f, -1.0f, 0.993746042f,
+		0.90067035f, -1.6331898f, 0.742681086f, 1.6328541f, -0.653964937f, -1.0f, 0.993746042f,
+		0.013582658f, 0.00305684726f, -0.0105258105f, 1.64465809f, -0.657571554f, -1.0f, 0.993031502f,
+		0.117958084f, -0.202597886f, 0.0907845125f, 1.64465809f, -0.657571554f, -1.0f, 0.993031502f,
+		0.222333506f, -0.408252627f, 0.192094833f, 1.64465809f, -0.657571554f, -1.0f, 0.993031502f,
+		0.326708943f, -0.613907337f, 0.293405175f, 1.64465809f, -0.657571554f, -1.0f, 0.993031502f,
+		0.431084365f, -0.819562078f, 0.394715488f, 1.64465809f, -0.657571554f, -1.0f, 0.993031502f,
+		0.535459757f, -1.02521682f, 0.496025801f, 1.64465809f, -0.657571554f, -1.0f, 0.993031502f,
+		0.639835179f, -1.23087156f, 0.597336113f, 1.64465809f, -0.657571554f, -1.0f, 0.993031502f,
+		0.744210601f, -1.4365263f, 0.698646486f, 1.64465809f, -0.657571554f, -1.0f, 0.993031502f,
+		0.848586023f, -1.64218104f, 0.799956799f, 1.64465809f, -0.657571554f, -1.0f, 0.993031502f,
+		0.0742857233f, -0.102290325f, 0.0342268385f, 1.64773667f, -0.660625994f, -1.0f, 0.993171632f,
+		0.172237992f, -0.295166671f, 0.129181266f, 1.64773667f, -0.660625994f, -1.0f, 0.993171632f,
+		0.270190269f, -0.48804304f, 0.224135682f, 1.64773667f, -0.660625994f, -1.0f, 0.993171632f,
+		0.368142545f, -0.680919409f, 0.319090098f, 1.64773667f, -0.660625994f, -1.0f, 0.993171632f,
+		0.466094822f, -0.873795748f, 0.414044529f, 1.64773667f, -0.660625994f, -1.0f, 0.993171632f,
+		0.564047098f, -1.06667209f, 0.50899893f, 1.64773667f, -0.660625994f, -1.0f, 0.993171632f,
+		0.661999345f, -1.25954854f, 0.603953362f, 1.64773667f, -0.660625994f, -1.0f, 0.993171632f,
+		0.759951651f, -1.45242488f, 0.698907793f, 1.64773667f, -0.660625994f, -1.0f, 0.993171632f,
+		0.857903898f, -1.64530122f, 0.793862224f, 1.64773667f, -0.660625994f, -1.0f, 0.993171632f,
+		0.127949715f, -0.195266694f, 0.0736754164f, 1.65019155f, -0.663133204f, -1.0f, 0.993311286f,
+		0.220223665f, -0.37683627f, 0.163000882f, 1.65019155f, -0.663133204f, -1.0f, 0.993311286f,
+		0.312497616f, -0.558405876f, 0.252326369f, 1.65019155f, -0.663133204f, -1.0f, 0.993311286f,
+		0.404771537f, -0.739975452f, 0.341651827f, 1.65019155f, -0.663133204f, -1.0f, 0.993311286f,
+		0.497045487f, -0.921545029f, 0.430977315f, 1.65019155f, -0.663133204f, -1.0f, 0.993311286f,
+		0.589319408f, -1.1031146f, 0.520302773f, 1.65019155f, -0.663133204f, -1.0f, 0.993311286f,
+		0.681593359f, -1.28468418f, 0.60962826f, 1.65019155f, -0.663133204f, -1.0f, 0.993311286f,
+		0.773867309f, -1.46625376f, 0.698953688f, 1.65019155f, -0.663133204f, -1.0f, 0.993311286f,
+		0.86614126f, -1.64782333f, 0.788279176f, 1.65019155f, -0.663133204f, -1.0f, 0.993311286f,
+		0.175731793f, -0.277885646f, 0.108676873f, 1.65209305f, -0.665159941f, -1.0f, 0.993449807f,
+		0.262949795f, -0.449376792f, 0.192979515f, 1.65209305f, -0.665159941f, -1.0f, 0.993449807f,
+		0.350167781f, -0.620867968f, 0.277282178f, 1.65209305f, -0.665159941f, -1.0f, 0.993449807f,
+		0.437385768f, -0.792359114f, 0.361584812f, 1.65209305f, -0.665159941f, -1.0f, 0.993449807f,
+		0.524603784f, -0.9638502f, 0.445887476f, 1.65209305f, -0.665159941f, -1.0f, 0.993449807f,
+		0.611821771f, -1.13534141f, 0.53019011f, 1.65209305f, -0.665159941f, -1.0f, 0.993449807f,
+		0.699039757f, -1.30683255f, 0.614492774f, 1.65209305f, -0.665159941f, -1.0f, 0.993449807f,
+		0.786257744f, -1.4783237f, 0.698795438f, 1.65209305f, -0.665159941f, -1.0f, 0.993449807f,
+		0.87347579f, -1.64981484f, 0.783098042f, 1.65209305f, -0.665159941f, -1.0f, 0.993449807f,
+		0.218548611f, -0.351738483f, 0.139907345f, 1.65349102f, -0.666754782f, -1.0f, 0.993586659f,
+		0.301236063f, -0.514186561f, 0.219697341f, 1.65349102f, -0.666754782f, -1.0f, 0.993586659f,
+		0.383923471f, -0.676634729f, 0.299487352f, 1.65349102f, -0.666754782f, -1.0f, 0.993586659f,
+		0.466610909f, -0.839082837f, 0.379277349f, 1.65349102f, -0.666754782f, -1.0f, 0.993586659f,
+		0.549298346f, -1.00153089f, 0.459067345f, 1.65349102f, -0.666754782f, -1.0f, 0.993586659f,
+		0.631985784f, -1.16397905f, 0.538857341f, 1.65349102f, -0.666754782f, -1.0f, 0.993586659f,
+		0.714673221f, -1.32642722f, 0.618647337f, 1.65349102f, -0.666754782f, -1.0f, 0.993586659f,
+		0.797360659f, -1.48887527f, 0.698437333f, 1.65349102f, -0.666754782f, -1.0f, 0.993586659f,
+		0.880048096f, -1.65132344f, 0.778227329f, 1.65349102f, -0.666754782f, -1.0f, 0.993586659f,
+		0.257135749f, -0.418097615f, 0.167906091f, 1.65441835f, -0.667951524f, -1.0f, 0.993721426f,
+		0.335740179f, -0.572382987f, 0.243616328f, 1.65441835f, -0.667951524f, -1.0f, 0.993721426f,
+		0.414344609f, -0.726668417f, 0.31932658f, 1.65441835f, -0.667951524f, -1.0f, 0.993721426f,
+		0.492949039f, -0.880953789f, 0.395036817f, 1.65441835f, -0.667951524f, -1.0f, 0.993721426f,
+		0.571553469f, -1.03523922f, 0.470747083f, 1.65441835f, -0.667951524f, -1.0f, 0.993721426f,
+		0.650157869f, -1.18952453f, 0.54645735f, 1.65441835f, -0.667951524f, -1.0f, 0.993721426f,
+		0.728762329f, -1.34380996f, 0.622167587f, 1.65441835f, -0.667951524f, -1.0f, 0.993721426f,
+		0.807366729f, -1.49809539f, 0.697877824f, 1.65441835f, -0.667951524f, -1.0f, 0.993721426f,
+		0.885971189f, -1.6523807f, 0.773588061f, 1.65441835f, -0.667951524f, -1.0f, 0.993721426f,
+		0.292090327f, -0.477990657f, 0.193106905f, 1.65489304f, -0.668771446f, -1.0f, 0.993853629f,
+		0.366996109f, -0.62486738f, 0.265107214f, 1.65489304f, -0.668771446f, -1.0f, 0.993853629f,
+		0.441901892f, -0.771744072f, 0.337107539f, 1.65489304f, -0.668771446f, -1.0f, 0.993853629f,
+		0.516807675f, -0.918620765f, 0.409107834f, 1.65489304f, -0.668771446f, -1.0f, 0.993853629f,
+		0.591713488f, -1.06549752f, 0.481108129f, 1.65489304f, -0.668771446f, -1.0f, 0.993853629f,
+		0.666619301f, -1.21237421f, 0.553108454f, 1.65489304f, -0.668771446f, -1.0f, 0.993853629f,
+		0.741525054f, -1.3592509f, 0.625108778f, 1.65489304f, -0.668771446f, -1.0f, 0.993853629f,
+		0.816430867f, -1.5061276f, 0.697109044f, 1.65489304f, -0.668771446f, -1.0f, 0.993853629f,
+		0.891336679f, -1.65300429f, 0.769109368f, 1.65489304f, -0.668771446f, -1.0f, 0.993853629f,
+		0.323902011f, -0.532253861f, 0.215860769f, 1.65491927f, -0.669224203f, -1.0f, 0.99398309f,
+		0.395441711f, -0.672371924f, 0.28446877f, 1.65491927f, -0.669224203f, -1.0f, 0.99398309f,
+		0.466981441f, -0.812489986f, 0.353076786f, 1.65491927f, -0.669224203f, -1.0f, 0.99398309f,
+		0.538521171f, -0.952608049f, 0.421684802f, 1.65491927f, -0.669224203f, -1.0f, 0.99398309f,
+		0.610060871f, -1.09272611f, 0.490292817f, 1.65491927f, -0.669224203f, -1.0f, 0.99398309f,
+		0.681600571f, -1.23284423f, 0.558900833f, 1.65491927f, -0.669224203f, -1.0f, 0.99398309f,
+		0.753140271f, -1.37296224f, 0.627508879f, 1.65491927f, -0.669224203f, -1.0f, 0.99398309f,
+		0.82468003f, -1.51308036f, 0.696116865f, 1.65491927f, -0.669224203f, -1.0f, 0.99398309f,
+		0.89621973f, -1.65319836f, 0.76472491f, 1.65491927f, -0.669224203f, -1.0f, 0.99398309f,
+		0.352976292f, -0.58157146f, 0.236452192f, 1.65448737f, -0.669308305f, -1.0f, 0.994109571f,
+		0.421439558f, -0.715494275f, 0.301941842f, 1.65448737f, -0.669308305f, -1.0f, 0.994109571f,
+		0.489902854f, -0.84941715f, 0.367431521f, 1.65448737f, -0.669308305f, -1.0f, 0.994109571f,
+		0.55836612f, -0.983340025f, 0.432921171f, 1.65448737f, -0.669308305f, -1.0f, 0.994109571f,
+		0.626829445f, -1.11726284f, 0.498410821f, 1.65448737f, -0.669308305f, -1.0f, 0.994109571f,
+		0.695292711f, -1.25118577f, 0.563900471f, 1.65448737f, -0.669308305f, -1.0f, 0.994109571f,
+		0.763756037f, -1.38510859f, 0.629390121f, 1.65448737f, -0.669308305f, -1.0f, 0.994109571f,
+		0.832219303f, -1.51903141f, 0.69487977f, 1.65448737f, -0.669308305f, -1.0f, 0.994109571f,
+		0.900682569f, -1.65295434f, 0.76036942f, 1.65448737f, -0.669308305f, -1.0f, 0.994109571f,
+		0.0136347115f, 0.00306856213f, -0.0105661489f, 1.65131247f, -0.66218102f, -1.0f, 0.993868411f,
+		0.118004628f, -0.203378394f, 0.0915338546f, 1.65131247f, -0.66218102f, -1.0f, 0.993868411f,
+		0.222374544f, -0.409825355f, 0.193633854f, 1.65131247f, -0.66218102f, -1.0f, 0.993868411f,
+		0.326744467f, -0.616272271f, 0.295733869f, 1.65131247f, -0.66218102f, -1.0f, 0.993868411f,
+		0.431114376f, -0.822719276f, 0.397833884f, 1.65131247f, -0.66218102f, -1.0f, 0.993868411f,
+		0.535484314f, -1.02916622f, 0.499933869f, 1.65131247f, -0.66218102f, -1.0f, 0.993868411f,
+		0.639854193f, -1.23561311f, 0.602033854f, 1.65131247f, -0.66218102f, -1.0f, 0.993868411f,
+		0.744224131f, -1.44206011f, 0.704133868f, 1.65131247f, -0.66218102f, -1.0f, 0.993868411f,
+		0.848594069f, -1.648507f, 0.806233883f, 1.65131247f, -0.66218102f, -1.0f, 0.993868411f,
+		0.07433635f, -0.102778293f, 0.034557201f, 1.65500247f, -0.665680707f, -1.0f, 0.993962109f,
+		0.172283262f, -0.296453834f, 0.130308047f, 1.65500247f, -0.665680707f, -1.0f, 0.993962109f,
+		0.270230174f, -0.490129381f, 0.2260589f, 1.65500247f, -0.665680707f, -1.0f, 0.993962109f,
+		0.368177086f, -0.683804929f, 0.321809739f, 1.65500247f, -0.665680707f, -1.0f, 0.993962109f,
+		0.466123998f, -0.877480447f, 0.417560607f, 1.65500247f, -0.665680707f, -1.0f, 0.993962109f,
+		0.56407094f, -1.07115602f, 0.513311446f, 1.65500247f, -0.665680707f, -1.0f, 0.993962109f,
+		0.662017822f, -1.26483154f, 0.609062314f, 1.65500247f, -0.665680707f, -1.0f, 0.993962109f,
+		0.759964764f, -1.45850706f, 0.704813123f, 1.65500247f, -0.665680707f, -1.0f, 0.993962109f,
+		0.857911646f, -1.6521827f, 0.800563991f, 1.65500247f, -0.665680707f, -1.0f, 0.993962109f,
+		0.127999425f, -0.196269557f, 0.0743874311f, 1.65813243f, -0.668678463f, -1.0f, 0.994057178f,
+		0.220268115f, -0.378650576f, 0.164521366f, 1.65813243f, -0.668678463f, -1.0f, 0.994057178f,
+		0.312536806f, -0.56103158f, 0.254655302f, 1.65813243f, -0.668678463f, -1.0f, 0.994057178f,
+		0.404805481f, -0.743412614f, 0.344789267f, 1.65813243f, -0.668678463f, -1.0f, 0.994057178f,
+		0.497074157f, -0.925793648f, 0.434923202f, 1.65813243f, -0.668678463f, -1.0f, 0.994057178f,
+		0.589342833f, -1.10817468f, 0.525057137f, 1.65813243f, -0.668678463f, -1.0f, 0.994057178f,
+		0.681611538f, -1.29055572f, 0.615191102f, 1.65813243f, -0.668678463f, -1.0f, 0.994057178f,
+		0.773880184f, -1.47293675f, 0.705325007f, 1.65813243f, -0.668678463f, -1.0f, 0.994057178f,
+		0.866148889f, -1.65531778f, 0.795458972f, 1.65813243f, -0.668678463f, -1.0f, 0.994057178f,
+		0.175781041f, -0.27942872f, 0.109788999f, 1.66078329f, -0.671248853f, -1.0f, 0.994153142f,
+		0.262993813f, -0.451748937f, 0.19491753f, 1.66078329f, -0.671248853f, -1.0f, 0.994153142f,
+		0.350206614f, -0.624069154f, 0.280046076f, 1.66078329f, -0.671248853f, -1.0f, 0.994153142f,
+		0.437419385f, -0.796389401f, 0.365174592f, 1.66078329f, -0.671248853f, -1.0f, 0.994153142f,
+		0.524632156f, -0.968709648f, 0.450303137f, 1.66078329f, -0.671248853f, -1.0f, 0.994153142f,
+		0.611844957f, -1.14102983f, 0.535431683f, 1.66078329f, -0.671248853f, -1.0f, 0.994153142f,
+		0.699057758f, -1.31335008f, 0.620560229f, 1.66078329f, -0.671248853f, -1.0f, 0.994153142f,
+		0.786270559f, -1.48567033f, 0.705688715f, 1.66078329f, -0.671248853f, -1.0f, 0.994153142f,
+		0.8734833f, -1.65799057f, 0.790817261f, 1.66078329f, -0.671248853f, -1.0f, 0.994153142f,
+		0.218597829f, -0.353857756f, 0.141445994f, 1.66301787f, -0.673449874f, -1.0f, 0.994249523f,
+		0.301280051f, -0.51715821f, 0.222084925f, 1.66301787f, -0.673449874f, -1.0f, 0.994249523f,
+		0.383962274f, -0.680458724f, 0.302723855f, 1.66301787f, -0.673449874f, -1.0f, 0.994249523f,
+		0.466644496f, -0.843759179f, 0.38336277f, 1.66301787f, -0.673449874f, -1.0f, 0.994249523f,
+		0.549326718f, -1.00705969f, 0.464001715f, 1.66301787f, -0.673449874f, -1.0f, 0.994249523f,
+		0.63200897f, -1.17036009f, 0.54464066f, 1.66301787f, -0.673449874f, -1.0f, 0.994249523f,
+		0.714691222f, -1.3336606f, 0.625279546f, 1.66301787f, -0.673449874f, -1.0f, 0.994249523f,
+		0.797373414f, -1.49696112f, 0.705918491f, 1.66301787f, -0.673449874f, -1.0f, 0.994249523f,
+		0.880055666f, -1.66026163f, 0.786557436f, 1.66301787f, -0.673449874f, -1.0f, 0.994249523f,
+		0.25718534f, -0.420841068f, 0.169906542f, 1.66488528f, -0.675326943f, -1.0f, 0.994345963f,
+		0.335784525f, -0.576008201f, 0.246494815f, 1.66488528f, -0.675326943f, -1.0f, 0.994345963f,
+		0.414383709f, -0.731175303f, 0.323083073f, 1.66488528f, -0.675326943f, -1.0f, 0.994345963f,
+		0.492982894f, -0.886342406f, 0.399671346f, 1.66488528f, -0.675326943f, -1.0f, 0.994345963f,
+		0.571582079f, -1.04150951f, 0.476259619f, 1.66488528f, -0.675326943f, -1.0f, 0.994345963f,
+		0.650181234f, -1.19667661f, 0.552847862f, 1.66488528f, -0.675326943f, -1.0f, 0.994345963f,
+		0.728780448f, -1.35184371f, 0.629436135f, 1.66488528f, -0.675326943f, -1.0f, 0.994345963f,
+		0.807379603f, -1.50701082f, 0.706024408f, 1.66488528f, -0.675326943f, -1.0f, 0.994345963f,
+		0.885978818f, -1.66217792f, 0.782612681f, 1.66488528f, -0.675326943f, -1.0f, 0.994345963f,
+		0.292140692f, -0.4814201f, 0.195614651f, 1.66642308f, -0.676915705f, -1.0f, 0.994442105f,
+		0.367041141f, -0.629214585f, 0.268528759f, 1.66642308f, -0.676915705f, -1.0f, 0.994442105f,
+		0.441941619f, -0.77700907f, 0.341442883f, 1.66642308f, -0.676915705f, -1.0f, 0.994442105f,
+		0.516842067f, -0.924803555f, 0.414357007f, 1.66642308f, -0.676915705f, -1.0f, 0.994442105f,
+		0.591742516f, -1.07259798f, 0.48727113f, 1.66642308f, -0.676915705f, -1.0f, 0.994442105f,
+		0.666643023f, -1.22039247f, 0.560185254f, 1.66642308f, -0.676915705f, -1.0f, 0.994442105f,
+		0.741543472f, -1.36818695f, 0.633099377f, 1.66642308f, -0.676915705f, -1.0f, 0.994442105f,
+		0.81644392f, -1.51598144f, 0.706013501f, 1.66642308f, -0.676915705f, -1.0f, 0.994442105f,
+		0.891344368f, -1.66377592f, 0.778927624f, 1.66642308f, -0.676915705f, -1.0f, 0.994442105f,
+		0.323953599f, -0.536447525f, 0.218933448f, 1.66766059f, -0.678243876f, -1.0f, 0.994537652f,
+		0.395487845f, -0.67752701f, 0.28849864f, 1.66766059f, -0.678243876f, -1.0f, 0.994537652f,
+		0.467022091f, -0.818606555f, 0.358063817f, 1.66766059f, -0.678243876f, -1.0f, 0.994537652f,
+		0.538556337f, -0.959686041f, 0.427629024f, 1.66766059f, -0.678243876f, -1.0f, 0.994537652f,
+		0.610090613f, -1.10076559f, 0.497194201f, 1.66766059f, -0.678243876f, -1.0f, 0.994537652f,
+		0.681624889f, -1.24184513f, 0.566759408f, 1.66766059f, -0.678243876f, -1.0f, 0.994537652f,
+		0.753159106f, -1.38292456f, 0.636324584f, 1.66766059f, -0.678243876f, -1.0f, 0.994537652f,
+		0.824693382f, -1.5240041f, 0.705889761f, 1.66766059f, -0.678243876f, -1.0f, 0.994537652f,
+		0.896227658f, -1.66508365f, 0.775454938f, 1.66766059f, -0.678243876f, -1.0f, 0.994537652f,
+		0.353029549f, -0.586627662f, 0.240162373f, 1.66861939f, -0.679332554f, -1.0f, 0.994632304f,
+		0.421487182f, -0.721564412f, 0.306661308f, 1.66861939f, -0.679332554f, -1.0f, 0.994632304f,
+		0.489944845f, -0.856501222f, 0.373160243f, 1.66861939f, -0.679332554f, -1.0f, 0.994632304f,
+		0.558402479f, -0.991437972f, 0.439659208f, 1.66861939f, -0.679332554f, -1.0f, 0.994632304f,
+		0.626860142f, -1.12637472f, 0.506158113f, 1.66861939f, -0.679332554f, -1.0f, 0.994632304f,
+		0.695317805f, -1.26131153f, 0.572657049f, 1.66861939f, -0.679332554f, -1.0f, 0.994632304f,
+		0.763775468f, -1.39624834f, 0.639156044f, 1.66861939f, -0.679332554f, -1.0f, 0.994632304f,
+		0.832233131f, -1.53118503f, 0.705654979f, 1.66861939f, -0.679332554f, -1.0f, 0.994632304f,
+		0.900690794f, -1.66612184f, 0.772153914f, 1.66861939f, -0.679332554f, -1.0f, 0.994632304f,
+		0.0136769246f, 0.00307806232f, -0.0105988616f, 1.65637827f, -0.66569221f, -1.0f, 0.994877636f,
+		0.118042372f, -0.204011351f, 0.0921415389f, 1.65637827f, -0.66569221f, -1.0f, 0.994877636f,
+		0.222407818f, -0.411100745f, 0.194881946f, 1.65637827f, -0.66569221f, -1.0f, 0.994877636f,
+		0.326773286f, -0.618190169f, 0.297622353f, 1.65637827f, -0.66569221f, -1.0f, 0.994877636f,
+		0.431138724f, -0.825279534f, 0.40036273f, 1.65637827f, -0.66569221f, -1.0f, 0.994877636f,
+		0.535504162f, -1.03236902f, 0.503103137f, 1.65637827f, -0.66569221f, -1.0f, 0.994877636f,
+		0.63986963f, -1.23945832f, 0.605843544f, 1.65637827f, -0.66569221f, -1.0f, 0.994877636f,
+		0.744235098f, -1.44654775f, 0.708583951f, 1.65637827f, -0.66569221f, -1.0f, 0.994877636f,
+		0.848600507f, -1.65363717f, 0.811324358f, 1.65637827f, -0.66569221f, -1.0f, 0.994877636f,
+		0.074376598f, -0.103166327f, 0.034819901f, 1.66044068f, -0.669465899f, -1.0f, 0.994930267f,
+		0.172319263f, -0.297477365f, 0.131204054f, 1.66044068f, -0.669465899f, -1.0f, 0.994930267f,
+		0.270261914f, -0.491788417f, 0.227588221f, 1.66044068f, -0.669465899f, -1.0f, 0.994930267f,
+		0.368204564f, -0.68609947f, 0.323972374f, 1.66044068f, -0.669465899f, -1.0f, 0.994930267f,
+		0.466147214f, -0.880410492f, 0.420356542f, 1.66044068f, -0.669465899f, -1.0f, 0.994930267f,
+		0.564089894f, -1.07472157f, 0.51674068f, 1.66044068f, -0.669465899f, -1.0f, 0.994930267f,
+		0.662032545f, -1.2690326f, 0.613124847f, 1.66044068f, -0.669465899f, -1.0f, 0.994930267f,
+		0.759975195f, -1.46334362f, 0.709509015f, 1.66044068f, -0.669465899f, -1.0f, 0.994930267f,
+		0.857917845f, -1.65765464f, 0.805893183f, 1.66044068f, -0.669465899f, -1.0f, 0.994930267f,
+		0.128038138f, -0.197050512f, 0.0749418885f, 1.66396952f, -0.672756493f, -1.0f, 0.994984627f,
+		0.220302716f, -0.380063415f, 0.165705398f, 1.66396952f, -0.672756493f, -1.0f, 0.994984627f,
+		0.312567323f, -0.563076317f, 0.256468922f, 1.66396952f, -0.672756493f, -1.0f, 0.994984627f,
+		0.404831886f, -0.74608922f, 0.347232431f, 1.66396952f, -0.672756493f, -1.0f, 0.994984627f,
+		0.497096479f, -0.929102123f, 0.43799594f, 1.66396952f, -0.672756493f, -1.0f, 0.994984627f,
+		0.589361072f, -1.11211503f, 0.52875942f, 1.66396952f, -0.672756493f, -1.0f, 0.994984627f,
+		0.681625664f, -1.29512799f, 0.619522989f, 1.66396952f, -0.672756493f, -1.0f, 0.994984627f,
+		0.773890257f, -1.47814083f, 0.710286498f, 1.66396952f, -0.672756493f, -1.0f, 0.994984627f,
+		0.86615485f, -1.66115379f, 0.801050007f, 1.66396952f, -0.672756493f, -1.0f, 0.994984627f,
+		0.175818548f, -0.280603737f, 0.110635877f, 1.66704893f, -0.675640762f, -1.0f, 0.995040536f,
+		0.26302737f, -0.453555316f, 0.196393311f, 1.66704893f, -0.675640762f, -1.0f, 0.995040536f,
+		0.350236177f, -0.626506865f, 0.282150745f, 1.66704893f, -0.675640762f, -1.0f, 0.995040536f,
+		0.437444985f, -0.799458444f, 0.36790821f, 1.66704893f, -0.675640762f, -1.0f, 0.995040536f,
+		0.524653792f, -0.972410023f, 0.453665644f, 1.66704893f, -0.675640762f, -1.0f, 0.995040536f,
+		0.6118626f, -1.14536154f, 0.539423048f, 1.66704893f, -0.675640762f, -1.0f, 0.995040536f,
+		0.699071467f, -1.31831312f, 0.625180542f, 1.66704893f, -0.675640762f, -1.0f, 0.995040536f,
+		0.786280274f, -1.4912647f, 0.710937977f, 1.66704893f, -0.675640762f, -1.0f, 0.995040536f,
+		0.873489082f, -1.66421628f, 0.796695411f, 1.66704893f, -0.675640762f, -1.0f, 0.995040536f,
+		0.218634412f, -0.355433315f, 0.142589927f, 1.66974533f, -0.678179324f, -1.0f, 0.995097697f,
+		0.301312774f, -0.519367516f, 0.223859981f, 1.66974533f, -0.678179324f, -1.0f, 0.995097697f,
+		0.383991122f, -0.683301687f, 0.305130064f, 1.66974533f, -0.678179324f, -1.0f, 0.995097697f,
+		0.46666947f, -0.847235858f, 0.386400104f, 1.66974533f, -0.678179324f, -1.0f, 0.995097697f,
+		0.549347818f, -1.01117003f, 0.467670172f, 1.66974533f, -0.678179324f, -1.0f, 0.995097697f,
+		0.632026196f, -1.17510414f, 0.548940241f, 1.66974533f, -0.678179324f, -1.0f, 0.995097697f,
+		0.714704573f, -1.33903837f, 0.63021028f, 1.66974533f, -0.678179324f, -1.0f, 0.995097697f,
+		0.797382891f, -1.50297248f, 0.711480379f, 1.66974533f, -0.678179324f, -1.0f, 0.995097697f,
+		0.880061269f, -1.66690671f, 0.792750418f, 1.66974533f, -0.678179324f, -1.0f, 0.995097697f,
+		0.257221282f, -0.422828853f, 0.171355978f, 1.67211151f, -0.680420578f, -1.0f, 0.99515599f,
+		0.335816652f, -0.578634799f, 0.248580411f, 1.67211151f, -0.680420578f, -1.0f, 0.99515599f,
+		0.414412022f, -0.734440744f, 0.325804859f, 1.67211151f, -0.680420578f, -1.0f, 0.99515599f,
+		0.493007421f, -0.890246689f, 0.403029293f, 1.67211151f, -0.680420578f, -1.0f, 0.99515599f,
+		0.571602762f, -1.04605269f, 0.480253726f, 1.67211151f, -0.680420578f, -1.0f, 0.99515599f,
+		0.650198162f, -1.20185864f, 0.557478189f, 1.67211151f, -0.680420578f, -1.0f, 0.99515599f,
+		0.728793561f, -1.35766459f, 0.634702623f, 1.67211151f, -0.680420578f, -1.0f, 0.99515599f,
+		0.807388902f, -1.51347053f, 0.711927056f, 1.67211151f, -0.680420578f, -1.0f, 0.99515599f,
+		0.885984302f, -1.66927648f, 0.78915149f, 1.67211151f, -0.680420578f, -1.0f, 0.99515599f,
+		0.292176187f, -0.483836859f, 0.197381884f, 1.67419028f, -0.682403564f, -1.0f, 0.995215118f,
+		0.36707288f, -0.632278085f, 0.270939976f, 1.67419028f, -0.682403564f, -1.0f, 0.995215118f,
+		0.441969603f, -0.78071934f, 0.344498068f, 1.67419028f, -0.682403564f, -1.0f, 0.995215118f,
+		0.516866326f, -0.929160595f, 0.41805616f, 1.67419028f, -0.682403564f, -1.0f, 0.995215118f,
+		0.59176302f, -1.07760191f, 0.491614252f, 1.67419028f, -0.682403564f, -1.0f, 0.995215118f,
+		0.666659713f, -1.22604311f, 0.565172374f, 1.67419028f, -0.682403564f, -1.0f, 0.995215118f,
+		0.741556406f, -1.37448442f, 0.638730466f, 1.67419028f, -0.682403564f, -1.0f, 0.995215118f,
+		0.816453159f, -1.52292562f, 0.712288558f, 1.67419028f, -0.682403564f, -1.0f, 0.995215118f,
+		0.891349852f, -1.67136693f, 0.785846651f, 1.67419028f, -0.682403564f, -1.0f, 0.995215118f,
+		0.323988855f, -0.539315403f, 0.221034765f, 1.67601609f, -0.684160233f, -1.0f, 0.995274901f,
+		0.395519406f, -0.681052446f, 0.29125455f, 1.67601609f, -0.684160233f, -1.0f, 0.995274901f,
+		0.467049927f, -0.82278949f, 0.361474305f, 1.67601609f, -0.684160233f, -1.0f, 0.995274901f,
+		0.538580418f, -0.964526474f, 0.43169409f, 1.67601609f, -0.684160233f, -1.0f, 0.995274901f,
+		0.610110939f, -1.10626352f, 0.501913846f, 1.67601609f, -0.684160233f, -1.0f, 0.995274901f,
+		0.681641459f, -1.24800062f, 0.57213366f, 1.67601609f, -0.684160233f, -1.0f, 0.995274901f,
+		0.75317198f, -1.38973761f, 0.642353415f, 1.67601609f, -0.684160233f, -1.0f, 0.995274901f,
+		0.824702561f, -1.53147459f, 0.712573171f, 1.67601609f, -0.684160233f, -1.0f, 0.995274901f,
+		0.896233082f, -1.67321169f, 0.782792926f, 1.67601609f, -0.684160233f, -1.0f, 0.995274901f,
+		0.353064775f, -0.589974642f, 0.242618337f, 1.67761731f, -0.68571645f, -1.0f, 0.995335162f,
+		0.421518713f, -0.7255826f, 0.309785366f, 1.67761731f, -0.68571645f, -1.0f, 0.995335162f,
+		0.489972621f, -0.861190557f, 0.37695241f, 1.67761731f, -0.68571645f, -1.0f, 0.995335162f,
+		0.558426559f, -0.996798456f, 0.444119453f, 1.67761731f, -0.68571645f, -1.0f, 0.995335162f,
+		0.626880467f, -1.13240647f, 0.511286497f, 1.67761731f, -0.68571645f, -1.0f, 0.995335162f,
+		0.695334435f, -1.26801431f, 0.578453541f, 1.67761731f, -0.68571645f, -1.0f, 0.995335162f,
+		0.763788342f, -1.40362227f, 0.645620584f, 1.67761731f, -0.68571645f, -1.0f, 0.995335162f,
+		0.83224225f, -1.53923023f, 0.712787628f, 1.67761731f, -0.68571645f, -1.0f, 0.995335162f,
+		0.900696158f, -1.67483819f, 0.779954672f, 1.67761731f, -0.68571645f, -1.0f, 0.995335162f,
+		0.0137091475f, 0.0030853143f, -0.0106238332f, 1.6599375f, -0.668161035f, -1.0f, 0.995955825f,
+		0.118071184f, -0.204494506f, 0.092605412f, 1.6599375f, -0.668161035f, -1.0f, 0.995955825f,
+		0.222433224f, -0.412074327f, 0.195834652f, 1.6599375f, -0.668161035f, -1.0f, 0.995955825f,
+		0.32679528f, -0.619654119f, 0.299063891f, 1.6599375f, -0.668161035f, -1.0f, 0.995955825f,
+		0.431157321f, -0.82723397f, 0.402293146f, 1.6599375f, -0.668161035f, -1.0f, 0.995955825f,
+		0.535519361f, -1.03481376f, 0.50552237f, 1.6599375f, -0.668161035f, -1.0f, 0.995955825f,
+		0.639881372f, -1.24239361f, 0.608751595f, 1.6599375f, -0.668161035f, -1.0f, 0.995955825f,
+		0.744243443f, -1.44997346f, 0.711980879f, 1.6599375f, -0.668161035f, -1.0f, 0.995955825f,
+		0.848605454f, -1.6575532f, 0.815210104f, 1.6599375f, -0.668161035f, -1.0f, 0.995955825f,
+		0.0744068623f, -0.10345801f, 0.0350173749f, 1.66420627f, -0.672088802f, -1.0f, 0.995980382f,
+		0.172346309f, -0.298246771f, 0.131877601f, 1.66420627f, -0.672088802f, -1.0f, 0.995980382f,
+		0.270285755f, -0.493035525f, 0.228737816f, 1.66420627f, -0.672088802f, -1.0f, 0.995980382f,
+		0.368225217f, -0.687824249f, 0.325598031f, 1.66420627f, -0.672088802f, -1.0f, 0.995980382f,
+		0.466164678f, -0.882613003f, 0.422458261f, 1.66420627f, -0.672088802f, -1.0f, 0.995980382f,
+		0.56410414f, -1.07740176f, 0.519318461f, 1.66420627f, -0.672088802f, -1.0f, 0.995980382f,
+		0.662043571f, -1.27219057f, 0.616178691f, 1.66420627f, -0.672088802f, -1.0f, 0.995980382f,
+		0.759983063f, -1.46697927f, 0.713038921f, 1.66420627f, -0.672088802f, -1.0f, 0.995980382f,
+		0.857922494f, -1.66176808f, 0.809899151f, 1.66420627f, -0.672088802f, -1.0f, 0.995980382f,
+		0.128066763f, -0.197628185f, 0.075352028f, 1.66795194f, -0.675540566f, -1.0f, 0.996006072f,
+		0.220328316f, -0.381108493f, 0.166581228f, 1.66795194f, -0.675540566f, -1.0f, 0.996006072f,
+		0.312589884f, -0.564588845f, 0.257810444f, 1.66795194f, -0.675540566f, -1.0f, 0.996006072f,
+		0.404851437f, -0.748069108f, 0.349039644f, 1.66795194f, -0.675540566f, -1.0f, 0.996006072f,
+		0.497112989f, -0.93154943f, 0.440268844f, 1.66795194f, -0.675540566f, -1.0f, 0.996006072f,
+		0.589374542f, -1.11502981f, 0.531498075f, 1.66795194f, -0.675540566f, -1.0f, 0.996006072f,
+		0.681636095f, -1.29851007f, 0.622727275f, 1.66795194f, -0.675540566f, -1.0f, 0.996006072f,
+		0.773897648f, -1.48199046f, 0.713956475f, 1.66795194f, -0.675540566f, -1.0f, 0.996006072f,
+		0.86615926f, -1.66547072f, 0.805185676f, 1.66795194f, -0.675540566f, -1.0f, 0.996006072f,
+		0.175845817f, -0.281458348f, 0.111251839f, 1.67125928f, -0.678593755f, -1.0f, 0.996032894f,
+		0.263051748f, -0.454869121f, 0.197466701f, 1.67125928f, -0.678593755f, -1.0f, 0.996032894f,
+		0.350257665f, -0.628279865f, 0.283681542f, 1.67125928f, -0.678593755f, -1.0f, 0.996032894f,
+		0.437463611f, -0.801690638f, 0.369896412f, 1.67125928f, -0.678593755f, -1.0f, 0.996032894f,
+		0.524669528f, -0.975101411f, 0.456111282f, 1.67125928f, -0.678593755f, -1.0f, 0.996032894f,
+		0.611875474f, -1.14851213f, 0.542326152f, 1.67125928f, -0.678593755f, -1.0f, 0.996032894f,
+		0.699081421f, -1.3219229f, 0.628540993f, 1.67125928f, -0.678593755f, -1.0f, 0.996032894f,
+		0.786287308f, -1.49533367f, 0.714755833f, 1.67125928f, -0.678593755f, -1.0f, 0.996032894f,
+		0.873493254f, -1.66874444f, 0.800970733f, 1.67125928f, -0.678593755f, -1.0f, 0.996032894f,
+		0.218660563f, -0.356559187f, 0.14340733f, 1.67419553f, -0.681309581f, -1.0f, 0.996060729f,
+		0.301336139f, -0.520946145f, 0.225128368f, 1.67419553f, -0.681309581f, -1.0f, 0.996060729f,
+		0.384011745f, -0.685333133f, 0.30684942f, 1.67419553f, -0.681309581f, -1.0f, 0.996060729f,
+		0.466687322f, -0.84972012f, 0.388570458f, 1.67419553f, -0.681309581f, -1.0f, 0.996060729f,
+		0.549362898f, -1.01410711f, 0.470291525f, 1.67419553f, -0.681309581f, -1.0f, 0.996060729f,
+		0.632038534f, -1.1784941f, 0.552012563f, 1.67419553f, -0.681309581f, -1.0f, 0.996060729f,
+		0.71471411f, -1.34288108f, 0.63373363f, 1.67419553f, -0.681309581f, -1.0f, 0.996060729f,
+		0.797389686f, -1.50726807f, 0.715454638f, 1.67419553f, -0.681309581f, -1.0f, 0.996060729f,
+		0.880065262f, -1.67165506f, 0.797175705f, 1.67419553f, -0.681309581f, -1.0f, 0.996060729f,
+		0.257246464f, -0.424223036f, 0.172372565f, 1.67681444f, -0.683737159f, -1.0f, 0.996089518f,
+		0.335839182f, -0.580477059f, 0.250043213f, 1.67681444f, -0.683737159f, -1.0f, 0.996089518f,
+		0.4144319f, -0.736731052f, 0.327713847f, 1.67681444f, -0.683737159f, -1.0f, 0.996089518f,
+		0.493024617f, -0.892985106f, 0.405384481f, 1.67681444f, -0.683737159f, -1.0f, 0.996089518f,
+		0.571617305f, -1.04923904f, 0.483055115f, 1.67681444f, -0.683737159f, -1.0f, 0.996089518f,
+		0.650210023f, -1.20549309f, 0.560725749f, 1.67681444f, -0.683737159f, -1.0f, 0.996089518f,
+		0.728802741f, -1.36174715f, 0.638396382f, 1.67681444f, -0.683737159f, -1.0f, 0.996089518f,
+		0.807395458f, -1.51800108f, 0.716067016f, 1.67681444f, -0.683737159f, -1.0f, 0.996089518f,
+		0.885988176f, -1.67425513f, 0.79373765f, 1.67681444f, -0.683737159f, -1.0f, 0.996089518f,
+		0.292200595f, -0.485498995f, 0.198597312f, 1.67915964f, -0.685916364f, -1.0f, 0.996119261f,
+		0.367094725f, -0.634385049f, 0.272598296f, 1.67915964f, -0.685916364f, -1.0f, 0.996119261f,
+		0.441988856f, -0.783271134f, 0.346599311f, 1.67915964f, -0.685916364f, -1.0f, 0.996119261f,
+		0.516882956f, -0.932157218f, 0.420600295f, 1.67915964f, -0.685916364f, -1.0f, 0.996119261f,
+		0.591777086f, -1.08104336f, 0.494601279f, 1.67915964f, -0.685916364f, -1.0f, 0.996119261f,
+		0.666671216f, -1.22992945f, 0.568602264f, 1.67915964f, -0.685916364f, -1.0f, 0.996119261f,
+		0.741565347f, -1.37881541f, 0.642603278f, 1.67915964f, -0.685916364f, -1.0f, 0.996119261f,
+		0.816459477f, -1.5277015f, 0.716604233f, 1.67915964f, -0.685916364f, -1.0f, 0.996119261f,
+		0.891353607f, -1.67658758f, 0.790605247f, 1.67915964f, -0.685916364f, -1.0f, 0.996119261f,
+		0.324012637f, -0.541247487f, 0.222450405f, 1.68126678f, -0.687879741f, -1.0f, 0.996149778f,
+		0.395540655f, -0.683427453f, 0.293111145f, 1.68126678f, -0.687879741f, -1.0f, 0.996149778f,
+		0.467068642f, -0.825607479f, 0.363771915f, 1.68126678f, -0.687879741f, -1.0f, 0.996149778f,
+		0.53859663f, -0.967787445f, 0.434432685f, 1.68126678f, -0.687879741f, -1.0f, 0.996149778f,
+		0.610124648f, -1.10996747f, 0.505093455f, 1.68126678f, -0.687879741f, -1.0f, 0.996149778f,
+		0.681652665f, -1.25214744f, 0.575754225f, 1.68126678f, -0.687879741f, -1.0f, 0.996149778f,
+		0.753180683f, -1.3943274f, 0.646414936f, 1.68126678f, -0.687879741f, -1.0f, 0.996149778f,
+		0.8247087f, -1.53650737f, 0.717075706f, 1.68126678f, -0.687879741f, -1.0f, 0.996149778f,
+		0.896236718f, -1.67868745f, 0.787736475f, 1.68126678f, -0.687879741f, -1.0f, 0.996149778f,
+		0.353088021f, -0.592180789f, 0.244237155f, 1.68316555f, -0.68965435f, -1.0f, 0.996181071f,
+		0.421539485f, -0.728231132f, 0.311844558f, 1.68316555f, -0.68965435f, -1.0f, 0.996181071f,
+		0.48999095f, -0.864281416f, 0.37945196f, 1.68316555f, -0.68965435f, -1.0f, 0.996181071f,
+		0.558442414f, -1.00033176f, 0.447059393f, 1.68316555f, -0.68965435f, -1.0f, 0.996181071f,
+		0.626893878f, -1.1363821f, 0.514666796f, 1.68316555f, -0.68965435f, -1.0f, 0.996181071f,
+		0.695345342f, -1.27243245f, 0.582274199f, 1.68316555f, -0.68965435f, -1.0f, 0.996181071f,
+		0.763796806f, -1.40848279f, 0.649881601f, 1.68316555f, -0.68965435f, -1.0f, 0.996181071f,
+		0.832248271f, -1.54453313f, 0.717489004f, 1.68316555f, -0.68965435f, -1.0f, 0.996181071f,
+		0.900699735f, -1.68058348f, 0.785096407f, 1.68316555f, -0.68965435f, -1.0f, 0.996181071f,
+		0.0137326261f, 0.00309059839f, -0.0106420275f, 1.66230226f, -0.669803023f, -1.0f, 0.996969998f,
+		0.118092179f, -0.204846561f, 0.0929434076f, 1.66230226f, -0.669803023f, -1.0f, 0.996969998f,
+		0.222451732f, -0.412783712f, 0.196528837f, 1.66230226f, -0.669803023f, -1.0f, 0.996969998f,
+		0.326811284f, -0.620720863f, 0.300114274f, 1.66230226f, -0.669803023f, -1.0f, 0.996969998f,
+		0.431170851f, -0.828658044f, 0.403699696f, 1.66230226f, -0.669803023f, -1.0f, 0.996969998f,
+		0.535530388f, -1.03659523f, 0.507285118f, 1.66230226f, -0.669803023f, -1.0f, 0.996969998f,
+		0.639889956f, -1.24453235f, 0.6108706f, 1.66230226f, -0.669803023f, -1.0f, 0.996969998f,
+		0.744249523f, -1.45246947f, 0.714456022f, 1.66230226f, -0.669803023f, -1.0f, 0.996969998f,
+		0.84860909f, -1.66040671f, 0.818041444f, 1.66230226f, -0.669803023f, -1.0f, 0.996969998f,
+		0.0744286552f, -0.103668131f, 0.0351596288f, 1.66667593f, -0.673810661f, -1.0f, 0.996979713f,
+		0.1723658f, -0.298801005f, 0.132362783f, 1.66667593f, -0.673810661f, -1.0f, 0.996979713f,
+		0.270302951f, -0.493933886f, 0.229565948f, 1.66667593f, -0.673810661f, -1.0f, 0.996979713f,
+		0.368240088f, -0.689066768f, 0.326769114f, 1.66667593f, -0.673810661f, -1.0f, 0.996979713f,
+		0.466177255f, -0.884199679f, 0.423972279f, 1.66667593f, -0.673810661f, -1.0f, 0.996979713f,
+		0.564114392f, -1.07933259f, 0.521175444f, 1.66667593f, -0.673810661f, -1.0f, 0.996979713f,
+		0.662051558f, -1.27446544f, 0.61837858f, 1.66667593f, -0.673810661f, -1.0f, 0.996979713f,
+		0.759988725f, -1.46959829f, 0.715581775f, 1.66667593f, -0.673810661f, -1.0f, 0.996979713f,
+		0.857925832f, -1.66473114f, 0.81278491f, 1.66667593f, -0.673810661f, -1.0f, 0.996979713f,
+		0.128087148f, -0.198039442f, 0.0756440163f, 1.67053032f, -0.677344739f, -1.0f, 0.996989965f,
+		0.220346555f, -0.381852508f, 0.167204767f, 1.67053032f, -0.677344739f, -1.0f, 0.996989965f,
+		0.312605947f, -0.565665603f, 0.258765519f, 1.67053032f, -0.677344739f, -1.0f, 0.996989965f,
+		0.404865354f, -0.749478698f, 0.35032627f, 1.67053032f, -0.677344739f, -1.0f, 0.996989965f,
+		0.497124761f, -0.933291733f, 0.441886991f, 1.67053032f, -0.677344739f, -1.0f, 0.996989965f,
+		0.589384139f, -1.11710489f, 0.533447742f, 1.67053032f, -0.677344739f, -1.0f, 0.996989965f,
+		0.681643546f, -1.30091786f, 0.625008523f, 1.67053032f, -0.677344739f, -1.0f, 0.996989965f,
+		0.773902953f, -1.48473096f, 0.716569245f, 1.67053032f, -0.677344739f, -1.0f, 0.996989965f,
+		0.86616236f, -1.66854405f, 0.808129966f, 1.67053032f, -0.677344739f, -1.0f, 0.996989965f,
+		0.175864995f, -0.282059401f, 0.111685038f, 1.67395055f, -0.680482805f, -1.0f, 0.997000694f,
+		0.263068914f, -0.455793142f, 0.198221594f, 1.67395055f, -0.680482805f, -1.0f, 0.997000694f,
+		0.350272804f, -0.629526854f, 0.284758151f, 1.67395055f, -0.680482805f, -1.0f, 0.997000694f,
+		0.437476695f, -0.803260565f, 0.371294737f, 1.67395055f, -0.680482805f, -1.0f, 0.997000694f,
+		0.524680614f, -0.976994276f, 0.457831293f, 1.67395055f, -0.680482805f, -1.0f, 0.997000694f,
+		0.611884475f, -1.15072799f, 0.54436785f, 1.67395055f, -0.680482805f, -1.0f, 0.997000694f,
+		0.699088395f, -1.3244617f, 0.630904436f, 1.67395055f, -0.680482805f, -1.0f, 0.997000694f,
+		0.786292315f, -1.49819541f, 0.717440963f, 1.67395055f, -0.680482805f, -1.0f, 0.997000694f,
+		0.873496234f, -1.67192912f, 0.803977549f, 1.67395055f, -0.680482805f, -1.0f, 0.997000694f,
+		0.218678713f, -0.357341051f, 0.143975005f, 1.67700374f, -0.683286309f, -1.0f, 0.997012019f,
+		0.301352382f, -0.522042513f, 0.22600925f, 1.67700374f, -0.683286309f, -1.0f, 0.997012019f,
+		0.384026051f, -0.686743975f, 0.30804351f, 1.67700374f, -0.683286309f, -1.0f, 0.997012019f,
+		0.466699719f, -0.851445436f, 0.39007777f, 1.67700374f, -0.683286309f, -1.0f, 0.997012019f,
+		0.549373388f, -1.0161469f, 0.472112f, 1.67700374f, -0.683286309f, -1.0f, 0.997012019f,
+		0.632047057f, -1.18084836f, 0.55414629f, 1.67700374f, -0.683286309f, -1.0f, 0.997012019f,
+		0.714720726f, -1.34554982f, 0.63618052f, 1.67700374f, -0.683286309f, -1.0f, 0.997012019f,
+		0.797394395f, -1.51025116f, 0.71821475f, 1.67700374f, -0.683286309f, -1.0f, 0.997012019f,
+		0.880068064f, -1.67495263f, 0.80024904f, 1.67700374f, -0.683286309f, -1.0f, 0.997012019f,
+		0.25726375f, -0.425178736f, 0.173069432f, 1.67974389f, -0.685804605f, -1.0f, 0.997023821f,
+		0.33585462f, -0.581739902f, 0.251045942f, 1.67974389f, -0.685804605f, -1.0f, 0.997023821f,
+		0.414445519f, -0.738301039f, 0.329022437f, 1.67974389f, -0.685804605f, -1.0f, 0.997023821f,
+		0.493036389f, -0.894862235f, 0.406998932f, 1.67974389f, -0.685804605f, -1.0f, 0.997023821f,
+		0.571627259f, -1.05142343f, 0.484975427f, 1.67974389f, -0.685804605f, -1.0f, 0.997023821f,
+		0.650218189f, -1.20798457f, 0.562951922f, 1.67974389f, -0.685804605f, -1.0f, 0.997023821f,
+		0.728809059f, -1.3645457f, 0.640928388f, 1.67974389f, -0.685804605f, -1.0f, 0.997023821f,
+		0.807399929f, -1.52110684f, 0.718904912f, 1.67974389f, -0.685804605f, -1.0f, 0.997023821f,
+		0.885990798f, -1.67766798f, 0.796881378f, 1.67974389f, -0.685804605f, -1.0f, 0.997023821f,
+		0.292217106f, -0.486623108f, 0.199419305f, 1.68221498f, -0.688077569f, -1.0f, 0.997036099f,
+		0.367109478f, -0.635810018f, 0.273719817f, 1.68221498f, -0.688077569f, -1.0f, 0.997036099f,
+		0.442001849f, -0.784996927f, 0.348020345f, 1.68221498f, -0.688077569f, -1.0f, 0.997036099f,
+		0.516894221f, -0.934183836f, 0.422320873f, 1.68221498f, -0.688077569f, -1.0f, 0.997036099f,
+		0.591786623f, -1.08337069f, 0.4966214f, 1.68221498f, -0.688077569f, -1.0f, 0.997036099f,
+		0.666678965f, -1.23255765f, 0.570921898f, 1.68221498f, -0.688077569f, -1.0f, 0.997036099f,
+		0.741571367f, -1.3817445f, 0.645222425f, 1.68221498f, -0.688077569f, -1.0f, 0.997036099f,
+		0.816463768f, -1.53093147f, 0.719522953f, 1.68221498f, -0.688077569f, -1.0f, 0.997036099f,
+		0.891356111f, -1.68011832f, 0.793823481f, 1.68221498f, -0.688077569f, -1.0f, 0.997036099f,
+		0.324028492f, -0.542535961f, 0.223394483f, 1.68445289f, -0.690138161f, -1.0f, 0.997048855f,
+		0.395554811f, -0.685011387f, 0.294349343f, 1.68445289f, -0.690138161f, -1.0f, 0.997048855f,
+		0.467081159f, -0.827486753f, 0.365304172f, 1.68445289f, -0.690138161f, -1.0f, 0.997048855f,
+		0.538607478f, -0.96996218f, 0.436259031f, 1.68445289f, -0.690138161f, -1.0f, 0.997048855f,
+		0.610133827f, -1.11243761f, 0.507213891f, 1.68445289f, -0.690138161f, -1.0f, 0.997048855f,
+		0.681660116f, -1.25491297f, 0.57816875f, 1.68445289f, -0.690138161f, -1.0f, 0.997048855f,
+		0.753186464f, -1.39738834f, 0.649123609f, 1.68445289f, -0.690138161f, -1.0f, 0.997048855f,
+		0.824712813f, -1.53986371f, 0.720078409f, 1.68445289f, -0.690138161f, -1.0f, 0.997048855f,
+		0.896239161f, -1.68233919f, 0.791033268f, 1.68445289f, -0.690138161f, -1.0f, 0.997048855f,
+		0.35310331f, -0.59363085f, 0.245301187f, 1.68648732f, -0.692013383f, -1.0f, 0.997062087f,
+		0.421553135f, -0.729971945f, 0.31319803f, 1.68648732f, -0.692013383f, -1.0f, 0.997062087f,
+		0.49000299f, -0.86631304f, 0.381094903f, 1.68648732f, -0.692013383f, -1.0f, 0.997062087f,
+		0.558452845f, -1.00265419f, 0.448991746f, 1.68648732f, -0.692013383f, -1.0f, 0.997062087f,
+		0.626902699f, -1.13899529f, 0.516888618f, 1.68648732f, -0.692013383f, -1.0f, 0.997062087f,
+		0.695352554f, -1.27533638f, 0.584785461f, 1.68648732f, -0.692013383f, -1.0f, 0.997062087f,
+		0.763802409f, -1.41167748f, 0.652682304f, 1.68648732f, -0.692013383f, -1.0f, 0.997062087f,
+		0.832252264f, -1.54801857f, 0.720579207f, 1.68648732f, -0.692013383f, -1.0f, 0.997062087f,
+		0.900702059f, -1.68435967f, 0.78847605f, 1.68648732f, -0.692013383f, -1.0f, 0.997062087f,
+		0.0137491608f, 0.00309431949f, -0.0106548406f, 1.66382825f, -0.670863569f, -1.0f, 0.997823596f,
+		0.118106969f, -0.205094486f, 0.0931814313f, 1.66382825f, -0.670863569f, -1.0f, 0.997823596f,
+		0.22246477f, -0.413283288f, 0.197017699f, 1.66382825f, -0.670863569f, -1.0f, 0.997823596f,
+		0.326822579f, -0.621472061f, 0.300853968f, 1.66382825f, -0.670863569f, -1.0f, 0.997823596f,
+		0.431180388f, -0.829660892f, 0.404690236f, 1.66382825f, -0.670863569f, -1.0f, 0.997823596f,
+		0.535538197f, -1.03784966f, 0.508526504f, 1.66382825f, -0.670863569f, -1.0f, 0.997823596f,
+		0.639895976f, -1.24603844f, 0.612362802f, 1.66382825f, -0.670863569f, -1.0f, 0.997823596f,
+		0.744253814f, -1.45422733f, 0.71619904f, 1.66382825f, -0.670863569f, -1.0f, 0.997823596f,
+		0.848611593f, -1.6624161f, 0.820035338f, 1.66382825f, -0.670863569f, -1.0f, 0.997823596f,
+		0.0744438842f, -0.1038149f, 0.0352589935f, 1.66825175f, -0.674910307f, -1.0f, 0.997826993f,
+		0.172379419f, -0.299188167f, 0.132701695f, 1.66825175f, -0.674910307f, -1.0f, 0.997826993f,
+		0.270314962f, -0.494561404f, 0.230144396f, 1.66825175f, -0.674910307f, -1.0f, 0.997826993f,
+		0.368250489f, -0.689934671f, 0.327587098f, 1.66825175f, -0.674910307f, -1.0f, 0.997826993f,
+		0.466186047f, -0.885307908f, 0.425029814f, 1.66825175f, -0.674910307f, -1.0f, 0.997826993f,
+		0.564121544f, -1.0806812f, 0.522472501f, 1.66825175f, -0.674910307f, -1.0f, 0.997826993f,
+		0.662057102f, -1.27605438f, 0.619915187f, 1.66825175f, -0.674910307f, -1.0f, 0.997826993f,
+		0.759992659f, -1.47142768f, 0.717357934f, 1.66825175f, -0.674910307f, -1.0f, 0.997826993f,
+		0.857928157f, -1.66680098f, 0.81480062f, 1.66825175f, -0.674910307f, -1.0f, 0.997826993f,
+		0.128101259f, -0.198324308f, 0.0758462697f, 1.67215729f, -0.678484082f, -1.0f, 0.997830629f,
+		0.220359176f, -0.382367879f, 0.167636678f, 1.67215729f, -0.678484082f, -1.0f, 0.997830629f,
+		0.312617093f, -0.566411436f, 0.259427071f, 1.67215729f, -0.678484082f, -1.0f, 0.997830629f,
+		0.40487498f, -0.750455022f, 0.351217479f, 1.67215729f, -0.678484082f, -1.0f, 0.997830629f,
+		0.497132897f, -0.934498608f, 0.443007857f, 1.67215729f, -0.678484082f, -1.0f, 0.997830629f,
+		0.589390814f, -1.11854219f, 0.534798265f, 1.67215729f, -0.678484082f, -1.0f, 0.997830629f,
+		0.681648731f, -1.30258572f, 0.626588643f, 1.67215729f, -0.678484082f, -1.0f, 0.997830629f,
+		0.773906648f, -1.48662937f, 0.71837908f, 1.67215729f, -0.678484082f, -1.0f, 0.997830629f,
+		0.866164505f, -1.67067289f, 0.810169458f, 1.67215729f, -0.678484082f, -1.0f, 0.997830629f,
+		0.175878167f, -0.282472223f, 0.111982562f, 1.67562985f, -0.681662619f, -1.0f, 0.997834384f,
+		0.263080686f, -0.456427723f, 0.198740065f, 1.67562985f, -0.681662619f, -1.0f, 0.997834384f,
+		0.350283176f, -0.630383253f, 0.285497576f, 1.67562985f, -0.681662619f, -1.0f, 0.997834384f,
+		0.437485695f, -0.804338753f, 0.372255087f, 1.67562985f, -0.681662619f, -1.0f, 0.997834384f,
+		0.524688184f, -0.978294253f, 0.459012598f, 1.67562985f, -0.681662619f, -1.0f, 0.997834384f,
+		0.611890733f, -1.15224981f, 0.545770109f, 1.67562985f, -0.681662619f, -1.0f, 0.997834384f,
+		0.699093223f, -1.32620525f, 0.63252759f, 1.67562985f, -0.681662619f, -1.0f, 0.997834384f,
+		0.786295712f, -1.50016081f, 0.719285131f, 1.67562985f, -0.681662619f, -1.0f, 0.997834384f,
+		0.873498201f, -1.67411637f, 0.806042612f, 1.67562985f, -0.681662619f, -1.0f, 0.997834384f,
+		0.218691081f, -0.35787338f, 0.144361481f, 1.67873681f, -0.68450737f, -1.0f, 0.997838378f,
+		0.301363438f, -0.522788942f, 0.226608977f, 1.67873681f, -0.68450737f, -1.0f, 0.997838378f,
+		0.384035796f, -0.687704504f, 0.308856457f, 1.67873681f, -0.68450737f, -1.0f, 0.997838378f,
+		0.466708153f, -0.852620065f, 0.391103953f, 1.67873681f, -0.68450737f, -1.0f, 0.997838378f,
+		0.549380541f, -1.01753557f, 0.473351449f, 1.67873681f, -0.68450737f, -1.0f, 0.997838378f,
+		0.632052898f, -1.18245113f, 0.555598915f, 1.67873681f, -0.68450737f, -1.0f, 0.997838378f,
+		0.714725256f, -1.34736669f, 0.63784641f, 1.67873681f, -0.68450737f, -1.0f, 0.997838378f,
+		0.797397614f, -1.51228225f, 0.720093906f, 1.67873681f, -0.68450737f, -1.0f, 0.997838378f,
+		0.880069971f, -1.67719781f, 0.802341402f, 1.67873681f, -0.68450737f, -1.0f, 0.997838378f,
+		0.257275403f, -0.425823599f, 0.173539668f, 1.68153226f, -0.687067688f, -1.0f, 0.99784255f,
+		0.335865051f, -0.58259201f, 0.251722544f, 1.68153226f, -0.687067688f, -1.0f, 0.99784255f,
+		0.414454699f, -0.739360452f, 0.329905421f, 1.68153226f, -0.687067688f, -1.0f, 0.99784255f,
+		0.493044347f, -0.896128833f, 0.408088297f, 1.68153226f, -0.687067688f, -1.0f, 0.99784255f,
+		0.571633995f, -1.05289721f, 0.486271173f, 1.68153226f, -0.687067688f, -1.0f, 0.99784255f,
+		0.650223672f, -1.20966566f, 0.564454079f, 1.68153226f, -0.687067688f, -1.0f, 0.99784255f,
+		0.728813291f, -1.3664341f, 0.642636955f, 1.68153226f, -0.687067688f, -1.0f, 0.99784255f,
+		0.807402968f, -1.52320254f, 0.720819831f, 1.68153226f, -0.687067688f, -1.0f, 0.99784255f,
+		0.885992587f, -1.67997098f, 0.799002707f, 1.68153226f, -0.687067688f, -1.0f, 0.99784255f,
+		0.292228162f, -0.487374693f, 0.199968904f, 1.6840601f, -0.689383745f, -1.0f, 0.997846961f,
+		0.367119342f, -0.636762738f, 0.274469703f, 1.6840601f, -0.689383745f, -1.0f, 0.997846961f,
+		0.442010552f, -0.786150813f, 0.348970503f, 1.6840601f, -0.689383745f, -1.0f, 0.997846961f,
+		0.516901791f, -0.935538888f, 0.423471302f, 1.6840601f, -0.689383745f, -1.0f, 0.997846961f,
+		0.591793001f, -1.08492696f, 0.497972101f, 1.6840601f, -0.689383745f, -1.0f, 0.997846961f,
+		0.66668421f, -1.23431492f, 0.57247287f, 1.6840601f, -0.689383745f, -1.0f, 0.997846961f,
+		0.74157542f, -1.38370299f, 0.64697367f, 1.6840601f, -0.689383745f, -1.0f, 0.997846961f,
+		0.81646663f, -1.53309107f, 0.721474469f, 1.6840601f, -0.689383745f, -1.0f, 0.997846961f,
+		0.891357839f, -1.68247914f, 0.795975268f, 1.6840601f, -0.689383745f, -1.0f, 0.997846961f,
+		0.324038982f, -0.54338944f, 0.224019825f, 1.68635619f, -0.691488266f, -1.0f, 0.997851551f,
+		0.395564198f, -0.686060548f, 0.295169473f, 1.68635619f, -0.691488266f, -1.0f, 0.997851551f,
+		0.467089415f, -0.828731596f, 0.36631915f, 1.68635619f, -0.691488266f, -1.0f, 0.997851551f,
+		0.538614631f, -0.971402705f, 0.437468797f, 1.68635619f, -0.691488266f, -1.0f, 0.997851551f,
+		0.610139847f, -1.11407375f, 0.508618474f, 1.68635619f, -0.691488266f, -1.0f, 0.997851551f,
+		0.681665063f, -1.25674486f, 0.579768121f, 1.68635619f, -0.691488266f, -1.0f, 0.997851551f,
+		0.753190279f, -1.39941585f, 0.650917768f, 1.68635619f, -0.691488266f, -1.0f, 0.997851551f,
+		0.824715555f, -1.54208696f, 0.722067416f, 1.68635619f, -0.691488266f, -1.0f, 0.997851551f,
+		0.896240771f, -1.68475807f, 0.793217063f, 1.68635619f, -0.691488266f, -1.0f, 0.997851551f,
+		0.353113323f, -0.59458214f, 0.245999262f, 1.68845046f, -0.693408549f, -1.0f, 0.997856319f,
+		0.421562105f, -0.73111403f, 0.31408602f, 1.68845046f, -0.693408549f, -1.0f, 0.997856319f,
+		0.490010887f, -0.867645919f, 0.382172763f, 1.68845046f, -0.693408549f, -1.0f, 0.997856319f,
+		0.558459699f, -1.00417781f, 0.450259537f, 1.68845046f, -0.693408549f, -1.0f, 0.997856319f,
+		0.626908481f, -1.14070964f, 0.51834631f, 1.68845046f, -0.693408549f, -1.0f, 0.997856319f,
+		0.695357263f, -1.27724159f, 0.586433053f, 1.68845046f, -0.693408549f, -1.0f, 0.997856319f,
+		0.763806045f, -1.41377342f, 0.654519796f, 1.68845046f, -0.693408549f, -1.0f, 0.997856319f,
+		0.832254827f, -1.55030537f, 0.72260654f, 1.68845046f, -0.693408549f, -1.0f, 0.997856319f,
+		0.900703609f, -1.6868372f, 0.790693283f, 1.68845046f, -0.693408549f, -1.0f, 0.997856319f,
+		0.0137605267f, 0.0030968776f, -0.0106636491f, 1.66480339f, -0.67154187f, -1.0f, 0.998484254f,
+		0.118117131f, -0.205264911f, 0.0933450535f, 1.66480339f, -0.67154187f, -1.0f, 0.998484254f,
+		0.222473741f, -0.413626701f, 0.19735375f, 1.66480339f, -0.67154187f, -1.0f, 0.998484254f,
+		0.326830328f, -0.621988475f, 0.301362455f, 1.66480339f, -0.67154187f, -1.0f, 0.998484254f,
+		0.431186944f, -0.83035028f, 0.405371159f, 1.66480339f, -0.67154187f, -1.0f, 0.998484254f,
+		0.535543561f, -1.03871202f, 0.509379864f, 1.66480339f, -0.67154187f, -1.0f, 0.998484254f,
+		0.639900148f, -1.24707389f, 0.613388538f, 1.66480339f, -0.67154187f, -1.0f, 0.998484254f,
+		0.744256735f, -1.45543563f, 0.717397273f, 1.66480339f, -0.67154187f, -1.0f, 0.998484254f,
+		0.848613381f, -1.66379738f, 0.821405947f, 1.66480339f, -0.67154187f, -1.0f, 0.998484254f,
+		0.0744542927f, -0.103915222f, 0.035326913f, 1.66924965f, -0.675607324f, -1.0f, 0.998485327f,
+		0.172388732f, -0.299452782f, 0.132933348f, 1.66924965f, -0.675607324f, -1.0f, 0.998485327f,
+		0.270323157f, -0.494990319f, 0.230539784f, 1.66924965f, -0.675607324f, -1.0f, 0.998485327f,
+		0.368257612f, -0.690527856f, 0.328146219f, 1.66924965f, -0.675607324f, -1.0f, 0.998485327f,
+		0.466192037f, -0.886065423f, 0.42575267f, 1.66924965f, -0.675607324f, -1.0f, 0.998485327f,
+		0.564126492f, -1.08160293f, 0.52335912f, 1.66924965f, -0.675607324f, -1.0f, 0.998485327f,
+		0.662060916f, -1.2771405f, 0.62096554f, 1.66924965f, -0.675607324f, -1.0f, 0.998485327f,
+		0.759995341f, -1.47267807f, 0.718571961f, 1.66924965f, -0.675607324f, -1.0f, 0.998485327f,
+		0.857929766f, -1.66821563f, 0.816178381f, 1.66924965f, -0.675607324f, -1.0f, 0.998485327f,
+		0.128110856f, -0.198517919f, 0.0759837255f, 1.67317832f, -0.679199815f, -1.0f, 0.998486519f,
+		0.220367759f, -0.382718146f, 0.167930201f, 1.67317832f, -0.679199815f, -1.0f, 0.998486519f,
+		0.312624633f, -0.566918373f, 0.259876668f, 1.67317832f, -0.679199815f, -1.0f, 0.998486519f,
+		0.404881537f, -0.7511186f, 0.351823151f, 1.67317832f, -0.679199815f, -1.0f, 0.998486519f,
+		0.497138441f, -0.935318828f, 0.443769634f, 1.67317832f, -0.679199815f, -1.0f, 0.998486519f,
+		0.589395344f, -1.119519f, 0.535716116f, 1.67317832f, -0.679199815f, -1.0f, 0.998486519f,
+		0.681652188f, -1.30371928f, 0.627662599f, 1.67317832f, -0.679199815f, -1.0f, 0.998486519f,
+		0.773909092f, -1.48791945f, 0.719609022f, 1.67317832f, -0.679199815f, -1.0f, 0.998486519f,
+		0.866165996f, -1.67211974f, 0.811555505f, 1.67317832f, -0.679199815f, -1.0f, 0.998486519f,
+		0.175887078f, -0.282751143f, 0.112183578f, 1.67667449f, -0.682397068f, -1.0f, 0.998487711f,
+		0.263088644f, -0.456856519f, 0.199090376f, 1.67667449f, -0.682397068f, -1.0f, 0.998487711f,
+		0.350290209f, -0.630961895f, 0.285997152f, 1.67667449f, -0.682397068f, -1.0f, 0.998487711f,
+		0.437491775f, -0.805067241f, 0.372903943f, 1.67667449f, -0.682397068f, -1.0f, 0.998487711f,
+		0.52469331f, -0.979172647f, 0.459810734f, 1.67667449f, -0.682397068f, -1.0f, 0.998487711f,
+		0.611894906f, -1.15327799f, 0.546717525f, 1.67667449f, -0.682397068f, -1.0f, 0.998487711f,
+		0.699096441f, -1.3273834f, 0.633624315f, 1.67667449f, -0.682397068f, -1.0f, 0.998487711f,
+		0.786298037f, -1.50148869f, 0.720531106f, 1.67667449f, -0.682397068f, -1.0f, 0.998487711f,
+		0.873499572f, -1.67559409f, 0.807437897f, 1.67667449f, -0.682397068f, -1.0f, 0.998487711f,
+		0.218699381f, -0.358230919f, 0.144621074f, 1.67980528f, -0.685260713f, -1.0f, 0.998489022f,
+		0.301370859f, -0.523290277f, 0.227011785f, 1.67980528f, -0.685260713f, -1.0f, 0.998489022f,
+		0.384042352f, -0.688349664f, 0.309402496f, 1.67980528f, -0.685260713f, -1.0f, 0.998489022f,
+		0.466713816f, -0.853408992f, 0.391793221f, 1.67980528f, -0.685260713f, -1.0f, 0.998489022f,
+		0.549385309f, -1.01846838f, 0.474183917f, 1.67980528f, -0.685260713f, -1.0f, 0.998489022f,
+		0.632056773f, -1.18352771f, 0.556574643f, 1.67980528f, -0.685260713f, -1.0f, 0.998489022f,
+		0.714728296f, -1.34858704f, 0.638965368f, 1.67980528f, -0.685260713f, -1.0f, 0.998489022f,
+		0.797399759f, -1.51364636f, 0.721356034f, 1.67980528f, -0.685260713f, -1.0f, 0.998489022f,
+		0.880071223f, -1.67870581f, 0.80374676f, 1.67980528f, -0.685260713f, -1.0f, 0.998489022f,
+		0.257283181f, -0.426254123f, 0.173853591f, 1.68262506f, -0.687840164f, -1.0f, 0.998490393f,
+		0.335872024f, -0.583160937f, 0.252174258f, 1.68262506f, -0.687840164f, -1.0f, 0.998490393f,
+		0.414460838f, -0.74006772f, 0.33049494f, 1.68262506f, -0.687840164f, -1.0f, 0.998490393f,
+		0.493049681f, -0.896974504f, 0.408815593f, 1.68262506f, -0.687840164f, -1.0f, 0.998490393f,
+		0.571638525f, -1.05388129f, 0.487136275f, 1.68262506f, -0.687840164f, -1.0f, 0.998490393f,
+		0.650227308f, -1.21078801f, 0.565456927f, 1.68262506f, -0.687840164f, -1.0f, 0.998490393f,
+		0.728816152f, -1.36769485f, 0.643777609f, 1.68262506f, -0.687840164f, -1.0f, 0.998490393f,
+		0.807404995f, -1.52460158f, 0.722098291f, 1.68262506f, -0.687840164f, -1.0f, 0.998490393f,
+		0.885993779f, -1.68150842f, 0.800418913f, 1.68262506f, -0.687840164f, -1.0f, 0.998490393f,
+		0.292235464f, -0.487873435f, 0.200333595f, 1.68517756f, -0.690175414f, -1.0f, 0.998491764f,
+		0.367125899f, -0.637394965f, 0.274967283f, 1.68517756f, -0.690175414f, -1.0f, 0.998491764f,
+		0.442016333f, -0.786916494f, 0.349600971f, 1.68517756f, -0.690175414f, -1.0f, 0.998491764f,
+		0.516906798f, -0.936437964f, 0.424234658f, 1.68517756f, -0.690175414f, -1.0f, 0.998491764f,
+		0.591797233f, -1.08595955f, 0.498868346f, 1.68517756f, -0.690175414f, -1.0f, 0.998491764f,
+		0.666687667f, -1.23548102f, 0.573502004f, 1.68517756f, -0.690175414f, -1.0f, 0.998491764f,
+		0.741578102f, -1.38500249f, 0.648135722f, 1.68517756f, -0.690175414f, -1.0f, 0.998491764f,
+		0.816468537f, -1.53452408f, 0.72276938f, 1.68517756f, -0.690175414f, -1.0f, 0.998491764f,
+		0.891358972f, -1.68404555f, 0.797403097f, 1.68517756f, -0.690175414f, -1.0f, 0.998491764f,
+		0.324045897f, -0.543952286f, 0.2244322f, 1.68749881f, -0.692299426f, -1.0f, 0.998493254f,
+		0.395570397f, -0.686752379f, 0.295710325f, 1.68749881f, -0.692299426f, -1.0f, 0.998493254f,
+		0.467094868f, -0.829552472f, 0.36698845f, 1.68749881f, -0.692299426f, -1.0f, 0.998493254f,
+		0.538619339f, -0.972352624f, 0.438266546f, 1.68749881f, -0.692299426f, -1.0f, 0.998493254f,
+		0.61014384f, -1.11515272f, 0.509544671f, 1.68749881f, -0.692299426f, -1.0f, 0.998493254f,
+		0.681668341f, -1.25795281f, 0.580822766f, 1.68749881f, -0.692299426f, -1.0f, 0.998493254f,
+		0.753192842f, -1.4007529f, 0.652100921f, 1.68749881f, -0.692299426f, -1.0f, 0.998493254f,
+		0.824717343f, -1.54355299f, 0.723379016f, 1.68749881f, -0.692299426f, -1.0f, 0.998493254f,
+		0.896241784f, -1.68635321f, 0.794657111f, 1.68749881f, -0.692299426f, -1.0f, 0.998493254f,
+		0.35311988f, -0.595205545f, 0.246456698f, 1.68961871f, -0.694239497f, -1.0f, 0.998494804f,
+		0.421567976f, -0.731862426f, 0.314667881f, 1.68961871f, -0.694239497f, -1.0f, 0.998494804f,
+		0.490016073f, -0.868519306f, 0.382879078f, 1.68961871f, -0.694239497f, -1.0f, 0.998494804f,
+		0.55846417f, -1.00517619f, 0.451090276f, 1.68961871f, -0.694239497f, -1.0f, 0.998494804f,
+		0.626912236f, -1.14183307f, 0.519301474f, 1.68961871f, -0.694239497f, -1.0f, 0.998494804f,
+		0.695360363f, -1.27848995f, 0.587512672f, 1.68961871f, -0.694239497f, -1.0f, 0.998494804f,
+		0.763808429f, -1.41514683f, 0.65572387f, 1.68961871f, -0.694239497f, -1.0f, 0.998494804f,
+		0.832256556f, -1.55180383f, 0.723935068f, 1.68961871f, -0.694239497f, -1.0f, 0.998494804f,
+		0.900704622f, -1.68846071f, 0.792146206f, 1.68961871f, -0.694239497f, -1.0f, 0.998494804f,
+		0.013768211f, 0.00309860683f, -0.0106696039f, 1.66542685f, -0.671975911f, -1.0f, 0.998966634f,
+		0.118124001f, -0.205380127f, 0.0934556723f, 1.66542685f, -0.671975911f, -1.0f, 0.998966634f,
+		0.22247979f, -0.413858861f, 0.197580948f, 1.66542685f, -0.671975911f, -1.0f, 0.998966634f,
+		0.326835573f, -0.62233758f, 0.301706225f, 1.66542685f, -0.671975911f, -1.0f, 0.998966634f,
+		0.431191385f, -0.830816329f, 0.405831486f, 1.66542685f, -0.671975911f, -1.0f, 0.998966634f,
+		0.535547137f, -1.03929508f, 0.509956777f, 1.66542685f, -0.671975911f, -1.0f, 0.998966634f,
+		0.639902949f, -1.24777377f, 0.614082038f, 1.66542685f, -0.671975911f, -1.0f, 0.998966634f,
+		0.744258761f, -1.45625257f, 0.7182073f, 1.66542685f, -0.671975911f, -1.0f, 0.998966634f,
+		0.848614514f, -1.66473126f, 0.822332621f, 1.66542685f, -0.671975911f, -1.0f, 0.998966634f,
+		0.0744613037f, -0.103982784f, 0.0353726521f, 1.66988349f, -0.676050305f, -1.0f, 0.998966992f,
+		0.172394991f, -0.299631f, 0.133089364f, 1.66988349f, -0.676050305f, -1.0f, 0.998966992f,
+		0.270328701f, -0.495279193f, 0.230806068f, 1.66988349f, -0.676050305f, -1.0f, 0.998966992f,
+		0.36826238f, -0.690927386f, 0.328522772f, 1.66988349f, -0.676050305f, -1.0f, 0.998966992f,
+		0.46619609f, -0.88657558f, 0.426239461f, 1.66988349f, -0.676050305f, -1.0f, 0.998966992f,
+		0.56412977f, -1.08222377f, 0.52395618f, 1.66988349f, -0.676050305f, -1.0f, 0.998966992f,
+		0.662063479f, -1.27787197f, 0.621672869f, 1.66988349f, -0.676050305f, -1.0f, 0.998966992f,
+		0.759997189f, -1.47352016f, 0.719389558f, 1.66988349f, -0.676050305f, -1.0f, 0.998966992f,
+		0.857930839f, -1.66916847f, 0.817106307f, 1.66988349f, -0.676050305f, -1.0f, 0.998966992f,
+		0.128117293f, -0.198647782f, 0.0760759339f, 1.67382252f, -0.679651618f, -1.0f, 0.99896735f,
+		0.220373511f, -0.382953107f, 0.168127105f, 1.67382252f, -0.679651618f, -1.0f, 0.99896735f,
+		0.31262973f, -0.567258418f, 0.260178298f, 1.67382252f, -0.679651618f, -1.0f, 0.99896735f,
+		0.404885948f, -0.751563728f, 0.352229446f, 1.67382252f, -0.679651618f, -1.0f, 0.99896735f,
+		0.497142136f, -0.935869038f, 0.444280624f, 1.67382252f, -0.679651618f, -1.0f, 0.99896735f,
+		0.589398384f, -1.12017429f, 0.536331832f, 1.67382252f, -0.679651618f, -1.0f, 0.99896735f,
+		0.681654572f, -1.3044796f, 0.628382981f, 1.67382252f, -0.679651618f, -1.0f, 0.99896735f,
+		0.773910761f, -1.48878503f, 0.720434189f, 1.67382252f, -0.679651618f, -1.0f, 0.99896735f,
+		0.866167009f, -1.67309034f, 0.812485337f, 1.67382252f, -0.679651618f, -1.0f, 0.99896735f,
+		0.175893024f, -0.282937497f, 0.112317905f, 1.67732906f, -0.682857633f, -1.0f, 0.998967707f,
+		0.263093948f, -0.457143009f, 0.199324444f, 1.67732906f, -0.682857633f, -1.0f, 0.998967707f,
+		0.350294888f, -0.631348491f, 0.286330968f, 1.67732906f, -0.682857633f, -1.0f, 0.998967707f,
+		0.437495828f, -0.805554032f, 0.373337507f, 1.67732906f, -0.682857633f, -1.0f, 0.998967707f,
+		0.524696767f, -0.979759514f, 0.460344046f, 1.67732906f, -0.682857633f, -1.0f, 0.998967707f,
+		0.611897707f, -1.153965f, 0.547350585f, 1.67732906f, -0.682857633f, -1.0f, 0.998967707f,
+		0.699098647f, -1.32817054f, 0.634357154f, 1.67732906f, -0.682857633f, -1.0f, 0.998967707f,
+		0.786299586f, -1.50237608f, 0.721363664f, 1.67732906f, -0.682857633f, -1.0f, 0.998967707f,
+		0.873500526f, -1.67658162f, 0.808370233f, 1.67732906f, -0.682857633f, -1.0f, 0.998967707f,
+		0.218704909f, -0.35846889f, 0.144793838f, 1.68047035f, -0.68572998f, -1.0f, 0.998968065f,
+		0.301375806f, -0.523623943f, 0.227279872f, 1.68047035f, -0.68572998f, -1.0f, 0.998968065f,
+		0.384046704f, -0.688778996f, 0.309765905f, 1.68047035f, -0.68572998f, -1.0f, 0.998968065f,
+		0.466717601f, -0.85393405f, 0.392251939f, 1.68047035f, -0.68572998f, -1.0f, 0.998968065f,
+		0.549388468f, -1.0190891f, 0.474737972f, 1.68047035f, -0.68572998f, -1.0f, 0.998968065f,
+		0.632059395f, -1.18424416f, 0.557223976f, 1.68047035f, -0.68572998f, -1.0f, 0.998968065f,
+		0.714730263f, -1.34939921f, 0.639710009f, 1.68047035f, -0.68572998f, -1.0f, 0.998968065f,
+		0.79740119f, -1.51455426f, 0.722196043f, 1.68047035f, -0.68572998f, -1.0f, 0.998968065f,
+		0.880072057f, -1.67970932f, 0.804682076f, 1.68047035f, -0.68572998f, -1.0f, 0.998968065f,
+		0.257288337f, -0.42653951f, 0.174061686f, 1.68330073f, -0.688318014f, -1.0f, 0.998968482f,
+		0.335876614f, -0.583537996f, 0.252473682f, 1.68330073f, -0.688318014f, -1.0f, 0.998968482f,
+		0.414464891f, -0.740536511f, 0.330885679f, 1.68330073f, -0.688318014f, -1.0f, 0.998968482f,
+		0.493053198f, -0.897535026f, 0.409297705f, 1.68330073f, -0.688318014f, -1.0f, 0.998968482f,
+		0.571641445f, -1.05453348f, 0.487709701f, 1.68330073f, -0.688318014f, -1.0f, 0.998968482f,
+		0.650229752f, -1.211532f, 0.566121697f, 1.68330073f, -0.688318014f, -1.0f, 0.998968482f,
+		0.728818059f, -1.36853051f, 0.644533694f, 1.68330073f, -0.688318014f, -1.0f, 0.998968482f,
+		0.807406306f, -1.52552903f, 0.72294569f, 1.68330073f, -0.688318014f, -1.0f, 0.998968482f,
+		0.885994613f, -1.68252754f, 0.801357687f, 1.68330073f, -0.688318014f, -1.0f, 0.998968482f,
+		0.292240322f, -0.488202661f, 0.200574353f, 1.68586385f, -0.690661967f, -1.0f, 0.998968959f,
+		0.36713022f, -0.637812316f, 0.275295764f, 1.68586385f, -0.690661967f, -1.0f, 0.998968959f,
+		0.442020148f, -0.787421942f, 0.35001719f, 1.68586385f, -0.690661967f, -1.0f, 0.998968959f,
+		0.516910076f, -0.937031567f, 0.424738616f, 1.68586385f, -0.690661967f, -1.0f, 0.998968959f,
+		0.591799974f, -1.08664119f, 0.499460012f, 1.68586385f, -0.690661967f, -1.0f, 0.998968959f,
+		0.666689932f, -1.23625088f, 0.574181437f, 1.68586385f, -0.690661967f, -1.0f, 0.998968959f,
+		0.741579831f, -1.38586044f, 0.648902833f, 1.68586385f, -0.690661967f, -1.0f, 0.998968959f,
+		0.816469789f, -1.53547013f, 0.723624289f, 1.68586385f, -0.690661967f, -1.0f, 0.998968959f,
+		0.891359687f, -1.68507969f, 0.798345685f, 1.68586385f, -0.690661967f, -1.0f, 0.998968959f,
+		0.324050456f, -0.544322312f, 0.224703327f, 1.68819594f, -0.692794621f, -1.0f, 0.998969376f,
+		0.39557445f, -0.687207282f, 0.296065897f, 1.68819594f, -0.692794621f, -1.0f, 0.998969376f,
+		0.467098475f, -0.830092192f, 0.367428482f, 1.68819594f, -0.692794621f, -1.0f, 0.998969376f,
+		0.538622499f, -0.972977161f, 0.438791066f, 1.68819594f, -0.692794621f, -1.0f, 0.998969376f,
+		0.610146463f, -1.11586213f, 0.510153651f, 1.68819594f, -0.692794621f, -1.0f, 0.998969376f,
+		0.681670487f, -1.2587471f, 0.581516206f, 1.68819594f, -0.692794621f, -1.0f, 0.998969376f,
+		0.753194511f, -1.40163195f, 0.652878761f, 1.68819594f, -0.692794621f, -1.0f, 0.998969376f,
+		0.824718475f, -1.54451692f, 0.724241376f, 1.68819594f, -0.692794621f, -1.0f, 0.998969376f,
+		0.896242499f, -1.68740189f, 0.795603931f, 1.68819594f, -0.692794621f, -1.0f, 0.998969376f,
+		0.353124171f, -0.595613718f, 0.246756196f, 1.69032669f, -0.694743335f, -1.0f, 0.998969853f,
+		0.421571821f, -0.732352436f, 0.315048873f, 1.69032669f, -0.694743335f, -1.0f, 0.998969853f,
+		0.49001947f, -0.869091213f, 0.383341551f, 1.69032669f, -0.694743335f, -1.0f, 0.998969853f,
+		0.55846709f, -1.00582993f, 0.451634198f, 1.69032669f, -0.694743335f, -1.0f, 0.998969853f,
+		0.62691474f, -1.14256871f, 0.519926846f, 1.69032669f, -0.694743335f, -1.0f, 0.998969853f,
+		0.695362389f, -1.27930737f, 0.588219523f, 1.69032669f, -0.694743335f, -1.0f, 0.998969853f,
+		0.763810039f, -1.41604614f, 0.656512201f, 1.69032669f, -0.694743335f, -1.0f, 0.998969853f,
+		0.832257628f, -1.55278492f, 0.724804878f, 1.69032669f, -0.694743335f, -1.0f, 0.998969853f,
+		0.900705278f, -1.68952358f, 0.793097556f, 1.69032669f, -0.694743335f, -1.0f, 0.998969853f,
+	},
+	// Princeton
+	{
+		0.00350523344f, 0.000720092095f, -0.00278514135f, 1.63538003f, -0.65246433f, -1.0f, 0.998549819f,
+		0.108946979f, -0.204616919f, 0.0971186608f, 1.63538003f, -0.65246433f, -1.0f, 0.998549819f,
+		0.214388713f, -0.409953922f, 0.197022468f, 1.63538003f, -0.65246433f, -1.0f, 0.998549819f,
+		0.319830477f, -0.61529094f, 0.29692626f, 1.63538003f, -0.65246433f, -1.0f, 0.998549819f,
+		0.425272197f, -0.820627928f, 0.396830052f, 1.63538003f, -0.65246433f, -1.0f, 0.998549819f,
+		0.530713975f, -1.02596498f, 0.496733874f, 1.63538003f, -0.65246433f, -1.0f, 0.998549819f,
+		0.636155665f, -1.2313019f, 0.596637666f, 1.63538003f, -0.65246433f, -1.0f, 0.998549819f,
+		0.741597414f, -1.43663895f, 0.696541488f, 1.63538003f, -0.65246433f, -1.0f, 0.998549819f,
+		0.847039163f, -1.641976f, 0.796445251f, 1.63538003f, -0.65246433f, -1.0f, 0.998549819f,
+		0.0114150532f, -0.0129086068f, 0.00302076992f, 1.63361025f, -0.65139854f, -1.0f, 0.998553991f,
+		0.116019838f, -0.216359749f, 0.101875998f, 1.63361025f, -0.65139854f, -1.0f, 0.998553991f,
+		0.220624626f, -0.419810891f, 0.200731233f, 1.63361025f, -0.65139854f, -1.0f, 0.998553991f,
+		0.325229406f, -0.623262048f, 0.299586445f, 1.63361025f, -0.65139854f, -1.0f, 0.998553991f,
+		0.429834187f, -0.826713204f, 0.398441672f, 1.63361025f, -0.65139854f, -1.0f, 0.998553991f,
+		0.534438968f, -1.03016436f, 0.4972969f, 1.63361025f, -0.65139854f, -1.0f, 0.998553991f,
+		0.639043748f, -1.23361552f, 0.596152127f, 1.63361025f, -0.65139854f, -1.0f, 0.998553991f,
+		0.743648529f, -1.43706667f, 0.695007384f, 1.63361025f, -0.65139854f, -1.0f, 0.998553991f,
+		0.84825331f, -1.64051783f, 0.793862581f, 1.63361025f, -0.65139854f, -1.0f, 0.998553991f,
+		0.0191998594f, -0.0262804627f, 0.00870301481f, 1.63159263f, -0.650155246f, -1.0f, 0.998558164f,
+		0.122980915f, -0.227850765f, 0.10650149f, 1.63159263f, -0.650155246f, -1.0f, 0.998558164f,
+		0.226761967f, -0.429421067f, 0.204299957f, 1.63159263f, -0.650155246f, -1.0f, 0.998558164f,
+		0.330543011f, -0.63099134f, 0.302098423f, 1.63159263f, -0.650155246f, -1.0f, 0.998558164f,
+		0.434324086f, -0.832561672f, 0.39989689f, 1.63159263f, -0.650155246f, -1.0f, 0.998558164f,
+		0.53810513f, -1.034132f, 0.497695386f, 1.63159263f, -0.650155246f, -1.0f, 0.998558164f,
+		0.641886175f, -1.23570228f, 0.595493853f, 1.63159263f, -0.650155246f, -1.0f, 0.998558164f,
+		0.745667219f, -1.43727255f, 0.69329232f, 1.63159263f, -0.650155246f, -1.0f, 0.998558164f,
+		0.849448264f, -1.63884282f, 0.791090786f, 1.63159263f, -0.650155246f, -1.0f, 0.998558164f,
+		0.0268625263f, -0.0393950716f, 0.0142595805f, 1.62929082f, -0.64870894f, -1.0f, 0.998562336f,
+		0.129832774f, -0.239085644f, 0.110989533f, 1.62929082f, -0.64870894f, -1.0f, 0.998562336f,
+		0.232803017f, -0.438776225f, 0.20771949f, 1.62929082f, -0.64870894f, -1.0f, 0.998562336f,
+		0.335773259f, -0.638466775f, 0.304449439f, 1.62929082f, -0.64870894f, -1.0f, 0.998562336f,
+		0.438743502f, -0.838157356f, 0.401179403f, 1.62929082f, -0.64870894f, -1.0f, 0.998562336f,
+		0.541713774f, -1.037848f, 0.497909337f, 1.62929082f, -0.64870894f, -1.0f, 0.998562336f,
+		0.644684017f, -1.23753858f, 0.594639301f, 1.62929082f, -0.64870894f, -1.0f, 0.998562336f,
+		0.747654259f, -1.43722916f, 0.691369236f, 1.62929082f, -0.64870894f, -1.0f, 0.998562336f,
+		0.850624502f, -1.63691974f, 0.78809917f, 1.62929082f, -0.64870894f, -1.0f, 0.998562336f,
+		0.0344058275f, -0.0522506721f, 0.0196874626f, 1.62666082f, -0.647028565f, -1.0f, 0.998566449f,
+		0.136577904f, -0.250058055f, 0.115332849f, 1.62666082f, -0.647028565f, -1.0f, 0.998566449f,
+		0.238749966f, -0.447865456f, 0.21097824f, 1.62666082f, -0.647028565f, -1.0f, 0.998566449f,
+		0.340922028f, -0.645672858f, 0.306623638f, 1.62666082f, -0.647028565f, -1.0f, 0.998566449f,
+		0.443094105f, -0.843480229f, 0.402269036f, 1.62666082f, -0.647028565f, -1.0f, 0.998566449f,
+		0.545266151f, -1.04128766f, 0.497914404f, 1.62666082f, -0.647028565f, -1.0f, 0.998566449f,
+		0.647438228f, -1.23909509f, 0.593559802f, 1.62666082f, -0.647028565f, -1.0f, 0.998566449f,
+		0.749610305f, -1.4369024f, 0.68920517f, 1.62666082f, -0.647028565f, -1.0f, 0.998566449f,
+		0.851782382f, -1.63470984f, 0.784850597f, 1.62666082f, -0.647028565f, -1.0f, 0.998566449f,
+		0.0418324359f, -0.0648437813f, 0.024982404f, 1.62364805f, -0.645075917f, -1.0f, 0.998570561f,
+		0.143218681f, -0.260759085f, 0.119522013f, 1.62364805f, -0.645075917f, -1.0f, 0.998570561f,
+		0.244604915f, -0.456674367f, 0.214061618f, 1.62364805f, -0.645075917f, -1.0f, 0.998570561f,
+		0.345991164f, -0.652589679f, 0.30860123f, 1.62364805f, -0.645075917f, -1.0f, 0.998570561f,
+		0.447377384f, -0.848504961f, 0.403140843f, 1.62364805f, -0.645075917f, -1.0f, 0.998570561f,
+		0.548763633f, -1.04442024f, 0.497680426f, 1.62364805f, -0.645075917f, -1.0f, 0.998570561f,
+		0.650149882f, -1.24033546f, 0.592220068f, 1.62364805f, -0.645075917f, -1.0f, 0.998570561f,
+		0.751536131f, -1.43625081f, 0.686759651f, 1.62364805f, -0.645075917f, -1.0f, 0.998570561f,
+		0.85292238f, -1.63216615f, 0.781299233f, 1.62364805f, -0.645075917f, -1.0f, 0.998570561f,
+		0.04914492f, -0.0771687627f, 0.0301385373f, 1.62018502f, -0.642803371f, -1.0f, 0.998574674f,
+		0.149757415f, -0.271176398f, 0.123544782f, 1.62018502f, -0.642803371f, -1.0f, 0.998574674f,
+		0.250369906f, -0.465184003f, 0.216951028f, 1.62018502f, -0.642803371f, -1.0f, 0.998574674f,
+		0.350982368f, -0.659191608f, 0.310357273f, 1.62018502f, -0.642803371f, -1.0f, 0.998574674f,
+		0.451594859f, -0.853199244f, 0.403763503f, 1.62018502f, -0.642803371f, -1.0f, 0.998574674f,
+		0.552207351f, -1.04720688f, 0.497169763f, 1.62018502f, -0.642803371f, -1.0f, 0.998574674f,
+		0.652819872f, -1.24121451f, 0.590575993f, 1.62018502f, -0.642803371f, -1.0f, 0.998574674f,
+		0.753432333f, -1.43522215f, 0.683982253f, 1.62018502f, -0.642803371f, -1.0f, 0.998574674f,
+		0.854044795f, -1.62922966f, 0.777388453f, 1.62018502f, -0.642803371f, -1.0f, 0.998574674f,
+		0.0563457496f, -0.0892171636f, 0.0351478904f, 1.61618674f, -0.640151083f, -1.0f, 0.998578787f,
+		0.156196296f, -0.281293362f, 0.127385274f, 1.61618674f, -0.640151083f, -1.0f, 0.998578787f,
+		0.256046861f, -0.473369539f, 0.219622657f, 1.61618674f, -0.640151083f, -1.0f, 0.998578787f,
+		0.355897397f, -0.665445745f, 0.311860025f, 1.61618674f, -0.640151083f, -1.0f, 0.998578787f,
+		0.455747932f, -0.857521951f, 0.404097408f, 1.61618674f, -0.640151083f, -1.0f, 0.998578787f,
+		0.555598497f, -1.0495981f, 0.496334791f, 1.61618674f, -0.640151083f, -1.0f, 0.998578787f,
+		0.655449033f, -1.2416743f, 0.588572204f, 1.61618674f, -0.640151083f, -1.0f, 0.998578787f,
+		0.755299568f, -1.43375051f, 0.680809557f, 1.61618674f, -0.640151083f, -1.0f, 0.998578787f,
+		0.855150163f, -1.62582672f, 0.77304697f, 1.61618674f, -0.640151083f, -1.0f, 0.998578787f,
+		0.063437283f, -0.100976788f, 0.0399996787f, 1.61154437f, -0.637042463f, -1.0f, 0.99858284f,
+		0.162537456f, -0.291087508f, 0.131022692f, 1.61154437f, -0.637042463f, -1.0f, 0.99858284f,
+		0.261637628f, -0.481198221f, 0.22204569f, 1.61154437f, -0.637042463f, -1.0f, 0.99858284f,
+		0.360737801f, -0.671308935f, 0.313068688f, 1.61154437f, -0.637042463f, -1.0f, 0.99858284f,
+		0.459837973f, -0.861419678f, 0.404091716f, 1.61154437f, -0.637042463f, -1.0f, 0.99858284f,
+		0.558938146f, -1.05153036f, 0.495114714f, 1.61154437f, -0.637042463f, -1.0f, 0.99858284f,
+		0.658038318f, -1.24164116f, 0.586137712f, 1.61154437f, -0.637042463f, -1.0f, 0.99858284f,
+		0.757138491f, -1.43175185f, 0.67716074f, 1.61154437f, -0.637042463f, -1.0f, 0.99858284f,
+		0.856238663f, -1.62186253f, 0.768183708f, 1.61154437f, -0.637042463f, -1.0f, 0.99858284f,
+		0.00352848298f, 0.000724868325f, -0.0028036146f, 1.64823496f, -0.661368847f, -1.0f, 0.998578906f,
+		0.108967766f, -0.205975175f, 0.0984635726f, 1.64823496f, -0.661368847f, -1.0f, 0.998578906f,
+		0.214407042f, -0.412675202f, 0.199730769f, 1.64823496f, -0.661368847f, -1.0f, 0.998578906f,
+		0.319846332f, -0.619375229f, 0.300997943f, 1.64823496f, -0.661368847f, -1.0f, 0.998578906f,
+		0.425285608f, -0.826075315f, 0.402265131f, 1.64823496f, -0.661368847f, -1.0f, 0.998578906f,
+		0.530724883f, -1.03277528f, 0.50353235f, 1.64823496f, -0.661368847f, -1.0f, 0.998578906f,
+		0.636164188f, -1.23947537f, 0.604799509f, 1.64823496f, -0.661368847f, -1.0f, 0.998578906f,
+		0.741603494f, -1.44617546f, 0.706066728f, 1.64823496f, -0.661368847f, -1.0f, 0.998578906f,
+		0.847042739f, -1.65287542f, 0.807333887f, 1.64823496f, -0.661368847f, -1.0f, 0.998578906f,
+		0.0114398766f, -0.0130145848f, 0.00308660255f, 1.64753258f, -0.661051095f, -1.0f, 0.99858284f,
+		0.116042033f, -0.217929915f, 0.103406377f, 1.64753258f, -0.661051095f, -1.0f, 0.99858284f,
+		0.220644191f, -0.422845244f, 0.203726158f, 1.64753258f, -0.661051095f, -1.0f, 0.99858284f,
+		0.325246364f, -0.627760589f, 0.304045945f, 1.64753258f, -0.661051095f, -1.0f, 0.99858284f,
+		0.429848522f, -0.832675934f, 0.404365718f, 1.64753258f, -0.661051095f, -1.0f, 0.99858284f,
+		0.53445065f, -1.03759122f, 0.504685521f, 1.64753258f, -0.661051095f, -1.0f, 0.99858284f,
+		0.639052808f, -1.24250662f, 0.605005264f, 1.64753258f, -0.661051095f, -1.0f, 0.99858284f,
+		0.743654966f, -1.44742191f, 0.705325067f, 1.64753258f, -0.661051095f, -1.0f, 0.99858284f,
+		0.848257124f, -1.65233719f, 0.80564481f, 1.64753258f, -0.661051095f, -1.0f, 0.99858284f,
+		0.0192264561f, -0.0265144613f, 0.00886632502f, 1.64672172f, -0.66065371f, -1.0f, 0.998586774f,
+		0.123004697f, -0.229663014f, 0.108243421f, 1.64672172f, -0.66065371f, -1.0f, 0.998586774f,
+		0.226782933f, -0.432811558f, 0.207620516f, 1.64672172f, -0.66065371f, -1.0f, 0.998586774f,
+		0.330561161f, -0.635960102f, 0.306997627f, 1.64672172f, -0.66065371f, -1.0f, 0.998586774f,
+		0.434339404f, -0.839108646f, 0.406374723f, 1.64672172f, -0.66065371f, -1.0f, 0.998586774f,
+		0.538117647f, -1.04225719f, 0.505751789f, 1.64672172f, -0.66065371f, -1.0f, 0.998586774f,
+		0.64189589f, -1.24540579f, 0.605128884f, 1.64672172f, -0.66065371f, -1.0f, 0.998586774f,
+		0.745674133f, -1.44855428f, 0.70450598f, 1.64672172f, -0.66065371f, -1.0f, 0.998586774f,
+		0.849452376f, -1.65170288f, 0.803883076f, 1.64672172f, -0.66065371f, -1.0f, 0.998586774f,
+		0.026891131f, -0.0397778228f, 0.0145361852f, 1.64579165f, -0.660169244f, -1.0f, 0.998590648f,
+		0.129858345f, -0.241175964f, 0.112974085f, 1.64579165f, -0.660169244f, -1.0f, 0.998590648f,
+		0.232825577f, -0.442574084f, 0.211411998f, 1.64579165f, -0.660169244f, -1.0f, 0.998590648f,
+		0.33579278f, -0.643972218f, 0.309849888f, 1.64579165f, -0.660169244f, -1.0f, 0.998590648f,
+		0.438760012f, -0.845370352f, 0.408287793f, 1.64579165f, -0.660169244f, -1.0f, 0.998590648f,
+		0.541727245f, -1.04676855f, 0.506725729f, 1.64579165f, -0.660169244f, -1.0f, 0.998590648f,
+		0.644694448f, -1.24816668f, 0.605163574f, 1.64579165f, -0.660169244f, -1.0f, 0.998590648f,
+		0.74766165f, -1.44956481f, 0.70360148f, 1.64579165f, -0.660169244f, -1.0f, 0.998590648f,
+		0.850628912f, -1.65096295f, 0.802039385f, 1.64579165f, -0.660169244f, -1.0f, 0.998590648f,
+		0.0344367176f, -0.0528072417f, 0.0200964957f, 1.64472997f, -0.659588873f, -1.0f, 0.998594582f,
+		0.136605516f, -0.252469659f, 0.117597319f, 1.64472997f, -0.659588873f, -1.0f, 0.998594582f,
+		0.238774315f, -0.452132106f, 0.215098143f, 1.64472997f, -0.659588873f, -1.0f, 0.998594582f,
+		0.340943128f, -0.651794493f, 0.312598974f, 1.64472997f, -0.659588873f, -1.0f, 0.998594582f,
+		0.443111926f, -0.85145694f, 0.410099775f, 1.64472997f, -0.659588873f, -1.0f, 0.998594582f,
+		0.545280695f, -1.05111933f, 0.507600605f, 1.64472997f, -0.659588873f, -1.0f, 0.998594582f,
+		0.647449553f, -1.25078177f, 0.605101407f, 1.64472997f, -0.659588873f, -1.0f, 0.998594582f,
+		0.749618351f, -1.45044422f, 0.702602267f, 1.64472997f, -0.659588873f, -1.0f, 0.998594582f,
+		0.85178715f, -1.65010667f, 0.800103068f, 1.64472997f, -0.659588873f, -1.0f, 0.998594582f,
+		0.0418659486f, -0.0656047463f, 0.025547199f, 1.64352226f, -0.658902526f, -1.0f, 0.998598456f,
+		0.143248647f, -0.263544321f, 0.122111514f, 1.64352226f, -0.658902526f, -1.0f, 0.998598456f,
+		0.244631335f, -0.461483896f, 0.218675822f, 1.64352226f, -0.658902526f, -1.0f, 0.998598456f,
+		0.346014023f, -0.65942347f, 0.315240145f, 1.64352226f, -0.658902526f, -1.0f, 0.998598456f,
+		0.447396725f, -0.857363045f, 0.411804467f, 1.64352226f, -0.658902526f, -1.0f, 0.998598456f,
+		0.548779428f, -1.05530262f, 0.50836879f, 1.64352226f, -0.658902526f, -1.0f, 0.998598456f,
+		0.650162101f, -1.25324225f, 0.604933083f, 1.64352226f, -0.658902526f, -1.0f, 0.998598456f,
+		0.751544833f, -1.45118177f, 0.701497376f, 1.64352226f, -0.658902526f, -1.0f, 0.998598456f,
+		0.852927506f, -1.6491214f, 0.798061728f, 1.64352226f, -0.658902526f, -1.0f, 0.998598456f,
+		0.0491814613f, -0.0781717375f, 0.0308878105f, 1.64215159f, -0.65809834f, -1.0f, 0.998602331f,
+		0.149790078f, -0.27439931f, 0.12651445f, 1.64215159f, -0.65809834f, -1.0f, 0.998602331f,
+		0.250398695f, -0.470626891f, 0.222141087f, 1.64215159f, -0.65809834f, -1.0f, 0.998602331f,
+		0.351007313f, -0.666854441f, 0.317767709f, 1.64215159f, -0.65809834f, -1.0f, 0.998602331f,
+		0.451615959f, -0.863082051f, 0.413394362f, 1.64215159f, -0.65809834f, -1.0f, 0.998602331f,
+		0.552224576f, -1.0593096f, 0.509020984f, 1.64215159f, -0.65809834f, -1.0f, 0.998602331f,
+		0.652833164f, -1.25553715f, 0.604647636f, 1.64215159f, -0.65809834f, -1.0f, 0.998602331f,
+		0.753441811f, -1.4517647f, 0.700274289f, 1.64215159f, -0.65809834f, -1.0f, 0.998602331f,
+		0.854050457f, -1.64799237f, 0.795900881f, 1.64215159f, -0.65809834f, -1.0f, 0.998602331f,
+		0.0563858151f, -0.090508908f, 0.0361173451f, 1.64059818f, -0.65716213f, -1.0f, 0.998606205f,
+		0.156232119f, -0.285033047f, 0.130803138f, 1.64059818f, -0.65716213f, -1.0f, 0.998606205f,
+		0.256078422f, -0.479557216f, 0.225488946f, 1.64059818f, -0.65716213f, -1.0f, 0.998606205f,
+		0.355924755f, -0.674081385f, 0.320174754f, 1.64059818f, -0.65716213f, -1.0f, 0.998606205f,
+		0.455771059f, -0.868605494f, 0.414860547f, 1.64059818f, -0.65716213f, -1.0f, 0.998606205f,
+		0.555617332f, -1.06312966f, 0.50954634f, 1.64059818f, -0.65716213f, -1.0f, 0.998606205f,
+		0.655463696f, -1.25765383f, 0.604232132f, 1.64059818f, -0.65716213f, -1.0f, 0.998606205f,
+		0.755309999f, -1.452178f, 0.698917925f, 1.64059818f, -0.65716213f, -1.0f, 0.998606205f,
+		0.855156302f, -1.64670205f, 0.793603718f, 1.64059818f, -0.65716213f, -1.0f, 0.998606205f,
+		0.0634814799f, -0.102616079f, 0.041234199f, 1.63883829f, -0.656077385f, -1.0f, 0.998610079f,
+		0.162576973f, -0.29544282f, 0.134973705f, 1.63883829f, -0.656077385f, -1.0f, 0.998610079f,
+		0.261672467f, -0.488269567f, 0.228713214f, 1.63883829f, -0.656077385f, -1.0f, 0.998610079f,
+		0.36076799f, -0.681096315f, 0.322452724f, 1.63883829f, -0.656077385f, -1.0f, 0.998610079f,
+		0.459863484f, -0.873923063f, 0.416192234f, 1.63883829f, -0.656077385f, -1.0f, 0.998610079f,
+		0.558958948f, -1.06674981f, 0.509931743f, 1.63883829f, -0.656077385f, -1.0f, 0.998610079f,
+		0.658054471f, -1.25957656f, 0.603671253f, 1.63883829f, -0.656077385f, -1.0f, 0.998610079f,
+		0.757149994f, -1.45240331f, 0.697410762f, 1.63883829f, -0.656077385f, -1.0f, 0.998610079f,
+		0.856245458f, -1.64523005f, 0.791150272f, 1.63883829f, -0.656077385f, -1.0f, 0.998610079f,
+		0.00354793551f, 0.000728864572f, -0.00281907106f, 1.65897179f, -0.668806255f, -1.0f, 0.998622f,
+		0.108985163f, -0.207111627f, 0.0995888636f, 1.65897179f, -0.668806255f, -1.0f, 0.998622f,
+		0.21442239f, -0.414952099f, 0.201996788f, 1.65897179f, -0.668806255f, -1.0f, 0.998622f,
+		0.319859624f, -0.622792602f, 0.304404736f, 1.65897179f, -0.668806255f, -1.0f, 0.998622f,
+		0.425296843f, -0.830633104f, 0.406812668f, 1.65897179f, -0.668806255f, -1.0f, 0.998622f,
+		0.530734062f, -1.03847361f, 0.5092206f, 1.65897179f, -0.668806255f, -1.0f, 0.998622f,
+		0.636171281f, -1.24631405f, 0.611628532f, 1.65897179f, -0.668806255f, -1.0f, 0.998622f,
+		0.7416085f, -1.45415449f, 0.714036465f, 1.65897179f, -0.668806255f, -1.0f, 0.998622f,
+		0.84704572f, -1.66199505f, 0.816444397f, 1.65897179f, -0.668806255f, -1.0f, 0.998622f,
+		0.0114602176f, -0.0131014269f, 0.00314054755f, 1.65892172f, -0.668947458f, -1.0f, 0.998625576f,
+		0.11606022f, -0.219216555f, 0.104660422f, 1.65892172f, -0.668947458f, -1.0f, 0.998625576f,
+		0.220660225f, -0.425331682f, 0.206180289f, 1.65892172f, -0.668947458f, -1.0f, 0.998625576f,
+		0.325260222f, -0.631446779f, 0.307700157f, 1.65892172f, -0.668947458f, -1.0f, 0.998625576f,
+		0.429860234f, -0.837561905f, 0.40922004f, 1.65892172f, -0.668947458f, -1.0f, 0.998625576f,
+		0.534460247f, -1.04367709f, 0.510739923f, 1.65892172f, -0.668947458f, -1.0f, 0.998625576f,
+		0.639060259f, -1.24979222f, 0.612259746f, 1.65892172f, -0.668947458f, -1.0f, 0.998625576f,
+		0.743660271f, -1.45590734f, 0.713779628f, 1.65892172f, -0.668947458f, -1.0f, 0.998625576f,
+		0.848260283f, -1.66202247f, 0.815299511f, 1.65892172f, -0.668947458f, -1.0f, 0.998625576f,
+		0.0192477666f, -0.0267019589f, 0.00899718143f, 1.65882468f, -0.669052422f, -1.0f, 0.998629153f,
+		0.123023748f, -0.231115118f, 0.10963919f, 1.65882468f, -0.669052422f, -1.0f, 0.998629153f,
+		0.226799741f, -0.435528278f, 0.210281193f, 1.65882468f, -0.669052422f, -1.0f, 0.998629153f,
+		0.330575705f, -0.639941454f, 0.310923219f, 1.65882468f, -0.669052422f, -1.0f, 0.998629153f,
+		0.434351712f, -0.84435463f, 0.411565214f, 1.65882468f, -0.669052422f, -1.0f, 0.998629153f,
+		0.538127661f, -1.04876781f, 0.51220721f, 1.65882468f, -0.669052422f, -1.0f, 0.998629153f,
+		0.641903698f, -1.25318098f, 0.612849236f, 1.65882468f, -0.669052422f, -1.0f, 0.998629153f,
+		0.745679677f, -1.45759404f, 0.713491261f, 1.65882468f, -0.669052422f, -1.0f, 0.998629153f,
+		0.849455655f, -1.66200721f, 0.814133286f, 1.65882468f, -0.669052422f, -1.0f, 0.998629153f,
+		0.026913505f, -0.0400771946f, 0.014752537f, 1.65867817f, -0.669119358f, -1.0f, 0.998632729f,
+		0.129878357f, -0.242810935f, 0.114526354f, 1.65867817f, -0.669119358f, -1.0f, 0.998632729f,
+		0.232843205f, -0.44554469f, 0.214300171f, 1.65867817f, -0.669119358f, -1.0f, 0.998632729f,
+		0.335808069f, -0.648278415f, 0.31407398f, 1.65867817f, -0.669119358f, -1.0f, 0.998632729f,
+		0.438772917f, -0.85101217f, 0.413847804f, 1.65867817f, -0.669119358f, -1.0f, 0.998632729f,
+		0.541737795f, -1.05374587f, 0.513621628f, 1.65867817f, -0.669119358f, -1.0f, 0.998632729f,
+		0.644702613f, -1.25647962f, 0.613395393f, 1.65867817f, -0.669119358f, -1.0f, 0.998632729f,
+		0.747667491f, -1.45921338f, 0.713169217f, 1.65867817f, -0.669119358f, -1.0f, 0.998632729f,
+		0.85063231f, -1.66194713f, 0.812943041f, 1.65867817f, -0.669119358f, -1.0f, 0.998632729f,
+		0.0344602615f, -0.053231366f, 0.0204081926f, 1.65847909f, -0.66914624f, -1.0f, 0.998636305f,
+		0.136626571f, -0.254307389f, 0.119322926f, 1.65847909f, -0.66914624f, -1.0f, 0.998636305f,
+		0.238792881f, -0.45538342f, 0.218237653f, 1.65847909f, -0.66914624f, -1.0f, 0.998636305f,
+		0.340959191f, -0.656459451f, 0.317152381f, 1.65847909f, -0.66914624f, -1.0f, 0.998636305f,
+		0.443125486f, -0.857535481f, 0.416067123f, 1.65847909f, -0.66914624f, -1.0f, 0.998636305f,
+		0.545291781f, -1.05861151f, 0.514981866f, 1.65847909f, -0.66914624f, -1.0f, 0.998636305f,
+		0.647458136f, -1.25968754f, 0.613896608f, 1.65847909f, -0.66914624f, -1.0f, 0.998636305f,
+		0.749624431f, -1.46076357f, 0.712811351f, 1.65847909f, -0.66914624f, -1.0f, 0.998636305f,
+		0.851790726f, -1.6618396f, 0.811726034f, 1.65847909f, -0.66914624f, -1.0f, 0.998636305f,
+		0.0418907776f, -0.0661684573f, 0.0259655938f, 1.65822411f, -0.669130802f, -1.0f, 0.998639882f,
+		0.14327085f, -0.265607625f, 0.124029793f, 1.65822411f, -0.669130802f, -1.0f, 0.998639882f,
+		0.244650915f, -0.465046763f, 0.222093984f, 1.65822411f, -0.669130802f, -1.0f, 0.998639882f,
+		0.34603098f, -0.664485931f, 0.320158184f, 1.65822411f, -0.669130802f, -1.0f, 0.998639882f,
+		0.44741106f, -0.86392504f, 0.418222398f, 1.65822411f, -0.669130802f, -1.0f, 0.998639882f,
+		0.548791111f, -1.06336427f, 0.516286612f, 1.65822411f, -0.669130802f, -1.0f, 0.998639882f,
+		0.650171161f, -1.26280332f, 0.614350796f, 1.65822411f, -0.669130802f, -1.0f, 0.998639882f,
+		0.75155127f, -1.46224248f, 0.71241498f, 1.65822411f, -0.669130802f, -1.0f, 0.998639882f,
+		0.852931321f, -1.66168165f, 0.810479164f, 1.65822411f, -0.669130802f, -1.0f, 0.998639882f,
+		0.0492077135f, -0.0788922086f, 0.0314260386f, 1.65790975f, -0.669070423f, -1.0f, 0.998643458f,
+		0.149813548f, -0.276714444f, 0.128647655f, 1.65790975f, -0.669070423f, -1.0f, 0.998643458f,
+		0.250419408f, -0.474536687f, 0.225869268f, 1.65790975f, -0.669070423f, -1.0f, 0.998643458f,
+		0.351025254f, -0.67235893f, 0.323090881f, 1.65790975f, -0.669070423f, -1.0f, 0.998643458f,
+		0.451631099f, -0.870181143f, 0.420312494f, 1.65790975f, -0.669070423f, -1.0f, 0.998643458f,
+		0.552236915f, -1.06800342f, 0.517534137f, 1.65790975f, -0.669070423f, -1.0f, 0.998643458f,
+		0.65284276f, -1.26582563f, 0.61475575f, 1.65790975f, -0.669070423f, -1.0f, 0.998643458f,
+		0.753448606f, -1.46364784f, 0.711977363f, 1.65790975f, -0.669070423f, -1.0f, 0.998643458f,
+		0.854054451f, -1.66147017f, 0.809198976f, 1.65790975f, -0.669070423f, -1.0f, 0.998643458f,
+		0.0564136431f, -0.091406092f, 0.0367906876f, 1.65753162f, -0.66896224f, -1.0f, 0.998646975f,
+		0.156257004f, -0.287630498f, 0.133177057f, 1.65753162f, -0.66896224f, -1.0f, 0.998646975f,
+		0.256100386f, -0.48385489f, 0.229563415f, 1.65753162f, -0.66896224f, -1.0f, 0.998646975f,
+		0.355943739f, -0.680079281f, 0.325949788f, 1.65753162f, -0.66896224f, -1.0f, 0.998646975f,
+		0.455787092f, -0.876303673f, 0.422336161f, 1.65753162f, -0.66896224f, -1.0f, 0.998646975f,
+		0.555630445f, -1.07252812f, 0.518722534f, 1.65753162f, -0.66896224f, -1.0f, 0.998646975f,
+		0.655473828f, -1.26875246f, 0.615108907f, 1.65753162f, -0.66896224f, -1.0f, 0.998646975f,
+		0.755317211f, -1.46497691f, 0.71149528f, 1.65753162f, -0.66896224f, -1.0f, 0.998646975f,
+		0.855160534f, -1.66120136f, 0.807881594f, 1.65753162f, -0.66896224f, -1.0f, 0.998646975f,
+		0.0635110661f, -0.103713334f, 0.0420605242f, 1.65708506f, -0.668802917f, -1.0f, 0.998650551f,
+		0.162603438f, -0.298358053f, 0.137618318f, 1.65708506f, -0.668802917f, -1.0f, 0.998650551f,
+		0.261695802f, -0.493002772f, 0.233176112f, 1.65708506f, -0.668802917f, -1.0f, 0.998650551f,
+		0.360788167f, -0.687647462f, 0.328733921f, 1.65708506f, -0.668802917f, -1.0f, 0.998650551f,
+		0.459880531f, -0.882292211f, 0.4242917f, 1.65708506f, -0.668802917f, -1.0f, 0.998650551f,
+		0.558972895f, -1.07693696f, 0.519849479f, 1.65708506f, -0.668802917f, -1.0f, 0.998650551f,
+		0.658065259f, -1.27158165f, 0.615407288f, 1.65708506f, -0.668802917f, -1.0f, 0.998650551f,
+		0.757157624f, -1.46622634f, 0.710965097f, 1.65708506f, -0.668802917f, -1.0f, 0.998650551f,
+		0.856249988f, -1.66087103f, 0.806522906f, 1.65708506f, -0.668802917f, -1.0f, 0.998650551f,
+		0.00356316101f, 0.000731992361f, -0.00283116847f, 1.66734636f, -0.674607396f, -1.0f, 0.998684645f,
+		0.108998775f, -0.208001107f, 0.100469604f, 1.66734636f, -0.674607396f, -1.0f, 0.998684645f,
+		0.214434385f, -0.416734189f, 0.203770384f, 1.66734636f, -0.674607396f, -1.0f, 0.998684645f,
+		0.319869995f, -0.6254673f, 0.307071149f, 1.66734636f, -0.674607396f, -1.0f, 0.998684645f,
+		0.425305605f, -0.834200382f, 0.410371929f, 1.66734636f, -0.674607396f, -1.0f, 0.998684645f,
+		0.530741215f, -1.04293346f, 0.513672709f, 1.66734636f, -0.674607396f, -1.0f, 0.998684645f,
+		0.636176825f, -1.25166655f, 0.61697346f, 1.66734636f, -0.674607396f, -1.0f, 0.998684645f,
+		0.741612434f, -1.46039963f, 0.72027427f, 1.66734636f, -0.674607396f, -1.0f, 0.998684645f,
+		0.847048044f, -1.66913283f, 0.82357502f, 1.66734636f, -0.674607396f, -1.0f, 0.998684645f,
+		0.0114758732f, -0.013168266f, 0.00318206684f, 1.66765821f, -0.675004661f, -1.0f, 0.998687804f,
+		0.116074219f, -0.220206827f, 0.1056256f, 1.66765821f, -0.675004661f, -1.0f, 0.998687804f,
+		0.220672578f, -0.427245378f, 0.208069131f, 1.66765821f, -0.675004661f, -1.0f, 0.998687804f,
+		0.325270921f, -0.63428396f, 0.310512662f, 1.66765821f, -0.675004661f, -1.0f, 0.998687804f,
+		0.429869264f, -0.841322541f, 0.412956208f, 1.66765821f, -0.675004661f, -1.0f, 0.998687804f,
+		0.534467638f, -1.04836106f, 0.515399754f, 1.66765821f, -0.675004661f, -1.0f, 0.998687804f,
+		0.639065981f, -1.25539958f, 0.61784327f, 1.66765821f, -0.675004661f, -1.0f, 0.998687804f,
+		0.743664324f, -1.46243823f, 0.720286787f, 1.66765821f, -0.675004661f, -1.0f, 0.998687804f,
+		0.848262668f, -1.66947675f, 0.822730362f, 1.66765821f, -0.675004661f, -1.0f, 0.998687804f,
+		0.0192638822f, -0.0268437397f, 0.00909613166f, 1.66794705f, -0.675382733f, -1.0f, 0.998690963f,
+		0.123038158f, -0.232213169f, 0.110694639f, 1.66794705f, -0.675382733f, -1.0f, 0.998690963f,
+		0.226812437f, -0.437582612f, 0.212293148f, 1.66794705f, -0.675382733f, -1.0f, 0.998690963f,
+		0.330586731f, -0.642952025f, 0.313891649f, 1.66794705f, -0.675382733f, -1.0f, 0.998690963f,
+		0.434361011f, -0.848321438f, 0.41549015f, 1.66794705f, -0.675382733f, -1.0f, 0.998690963f,
+		0.53813529f, -1.05369091f, 0.517088652f, 1.66794705f, -0.675382733f, -1.0f, 0.998690963f,
+		0.64190954f, -1.25906038f, 0.618687153f, 1.66794705f, -0.675382733f, -1.0f, 0.998690963f,
+		0.745683849f, -1.46442974f, 0.720285654f, 1.66794705f, -0.675382733f, -1.0f, 0.998690963f,
+		0.849458098f, -1.66979921f, 0.821884215f, 1.66794705f, -0.675382733f, -1.0f, 0.998690963f,
+		0.0269301105f, -0.0402993932f, 0.0149131147f, 1.66821253f, -0.675741315f, -1.0f, 0.998694062f,
+		0.129893199f, -0.244024426f, 0.115678445f, 1.66821253f, -0.675741315f, -1.0f, 0.998694062f,
+		0.232856303f, -0.447749466f, 0.216443777f, 1.66821253f, -0.675741315f, -1.0f, 0.998694062f,
+		0.335819393f, -0.651474535f, 0.317209125f, 1.66821253f, -0.675741315f, -1.0f, 0.998694062f,
+		0.438782483f, -0.855199575f, 0.417974442f, 1.66821253f, -0.675741315f, -1.0f, 0.998694062f,
+		0.541745603f, -1.05892456f, 0.51873976f, 1.66821253f, -0.675741315f, -1.0f, 0.998694062f,
+		0.644708693f, -1.26264966f, 0.619505107f, 1.66821253f, -0.675741315f, -1.0f, 0.998694062f,
+		0.747671783f, -1.46637464f, 0.720270455f, 1.66821253f, -0.675741315f, -1.0f, 0.998694062f,
+		0.850634873f, -1.67009974f, 0.821035743f, 1.66821253f, -0.675741315f, -1.0f, 0.998694062f,
+		0.0344773903f, -0.0535400137f, 0.0206350219f, 1.66845405f, -0.676080167f, -1.0f, 0.998697221f,
+		0.13664189f, -0.255644739f, 0.120578684f, 1.66845405f, -0.676080167f, -1.0f, 0.998697221f,
+		0.238806382f, -0.457749486f, 0.220522344f, 1.66845405f, -0.676080167f, -1.0f, 0.998697221f,
+		0.340970874f, -0.659854233f, 0.320466012f, 1.66845405f, -0.676080167f, -1.0f, 0.998697221f,
+		0.443135381f, -0.861958921f, 0.42040965f, 1.66845405f, -0.676080167f, -1.0f, 0.998697221f,
+		0.545299888f, -1.06406367f, 0.520353317f, 1.66845405f, -0.676080167f, -1.0f, 0.998697221f,
+		0.647464395f, -1.26616836f, 0.620297015f, 1.66845405f, -0.676080167f, -1.0f, 0.998697221f,
+		0.749628901f, -1.46827316f, 0.720240653f, 1.66845405f, -0.676080167f, -1.0f, 0.998697221f,
+		0.851793349f, -1.67037785f, 0.82018429f, 1.66845405f, -0.676080167f, -1.0f, 0.998697221f,
+		0.0419084691f, -0.0665702075f, 0.0262637772f, 1.66867113f, -0.676398933f, -1.0f, 0.998700321f,
+		0.14328666f, -0.267078102f, 0.125396922f, 1.66867113f, -0.676398933f, -1.0f, 0.998700321f,
+		0.244664863f, -0.467585981f, 0.224530071f, 1.66867113f, -0.676398933f, -1.0f, 0.998700321f,
+		0.34604305f, -0.66809386f, 0.323663235f, 1.66867113f, -0.676398933f, -1.0f, 0.998700321f,
+		0.447421253f, -0.868601739f, 0.422796369f, 1.66867113f, -0.676398933f, -1.0f, 0.998700321f,
+		0.548799455f, -1.06910956f, 0.521929502f, 1.66867113f, -0.676398933f, -1.0f, 0.998700321f,
+		0.650177658f, -1.26961744f, 0.621062636f, 1.66867113f, -0.676398933f, -1.0f, 0.998700321f,
+		0.75155586f, -1.47012544f, 0.72019583f, 1.66867113f, -0.676398933f, -1.0f, 0.998700321f,
+		0.852934003f, -1.67063332f, 0.819328964f, 1.66867113f, -0.676398933f, -1.0f, 0.998700321f,
+		0.0492260084f, -0.0793944374f, 0.0318012312f, 1.66886318f, -0.676697195f, -1.0f, 0.99870342f,
+		0.149829909f, -0.2783283f, 0.130134687f, 1.66886318f, -0.676697195f, -1.0f, 0.99870342f,
+		0.250433832f, -0.477262139f, 0.228468135f, 1.66886318f, -0.676697195f, -1.0f, 0.99870342f,
+		0.351037741f, -0.676196039f, 0.326801598f, 1.66886318f, -0.676697195f, -1.0f, 0.99870342f,
+		0.451641649f, -0.875129879f, 0.425135046f, 1.66886318f, -0.676697195f, -1.0f, 0.99870342f,
+		0.552245557f, -1.07406378f, 0.523468494f, 1.66886318f, -0.676697195f, -1.0f, 0.99870342f,
+		0.652849436f, -1.27299762f, 0.621801972f, 1.66886318f, -0.676697195f, -1.0f, 0.99870342f,
+		0.753453374f, -1.47193146f, 0.720135391f, 1.66886318f, -0.676697195f, -1.0f, 0.99870342f,
+		0.854057252f, -1.6708653f, 0.818468869f, 1.66886318f, -0.676697195f, -1.0f, 0.99870342f,
+		0.0564325899f, -0.0920169652f, 0.0372491479f, 1.66902936f, -0.676974535f, -1.0f, 0.99870652f,
+		0.156273946f, -0.289399028f, 0.134793386f, 1.66902936f, -0.676974535f, -1.0f, 0.99870652f,
+		0.256115317f, -0.48678109f, 0.232337624f, 1.66902936f, -0.676974535f, -1.0f, 0.99870652f,
+		0.355956674f, -0.684163153f, 0.329881877f, 1.66902936f, -0.676974535f, -1.0f, 0.99870652f,
+		0.45579803f, -0.881545186f, 0.4274261f, 1.66902936f, -0.676974535f, -1.0f, 0.99870652f,
+		0.555639386f, -1.07892728f, 0.524970353f, 1.66902936f, -0.676974535f, -1.0f, 0.99870652f,
+		0.655480742f, -1.27630925f, 0.622514606f, 1.66902936f, -0.676974535f, -1.0f, 0.99870652f,
+		0.755322099f, -1.47369134f, 0.720058799f, 1.66902936f, -0.676974535f, -1.0f, 0.99870652f,
+		0.855163455f, -1.67107344f, 0.817603052f, 1.66902936f, -0.676974535f, -1.0f, 0.99870652f,
+		0.0635307133f, -0.104441933f, 0.0426092185f, 1.66916907f, -0.677230477f, -1.0f, 0.998709679f,
+		0.162621006f, -0.300293803f, 0.13937439f, 1.66916907f, -0.677230477f, -1.0f, 0.998709679f,
+		0.261711299f, -0.496145695f, 0.236139566f, 1.66916907f, -0.677230477f, -1.0f, 0.998709679f,
+		0.360801578f, -0.691997588f, 0.332904726f, 1.66916907f, -0.677230477f, -1.0f, 0.998709679f,
+		0.459891856f, -0.88784945f, 0.429669917f, 1.66916907f, -0.677230477f, -1.0f, 0.998709679f,
+		0.558982134f, -1.08370137f, 0.526435077f, 1.66916907f, -0.677230477f, -1.0f, 0.998709679f,
+		0.658072472f, -1.27955317f, 0.623200238f, 1.66916907f, -0.677230477f, -1.0f, 0.998709679f,
+		0.75716275f, -1.4754051f, 0.719965458f, 1.66916907f, -0.677230477f, -1.0f, 0.998709679f,
+		0.856253028f, -1.6712569f, 0.816730618f, 1.66916907f, -0.677230477f, -1.0f, 0.998709679f,
+		0.0035744668f, 0.000734314963f, -0.00284015201f, 1.67352319f, -0.678886116f, -1.0f, 0.998773217f,
+		0.109008886f, -0.208661616f, 0.101123624f, 1.67352319f, -0.678886116f, -1.0f, 0.998773217f,
+		0.214443296f, -0.418057531f, 0.205087394f, 1.67352319f, -0.678886116f, -1.0f, 0.998773217f,
+		0.319877714f, -0.627453446f, 0.309051186f, 1.67352319f, -0.678886116f, -1.0f, 0.998773217f,
+		0.425312132f, -0.836849391f, 0.413014948f, 1.67352319f, -0.678886116f, -1.0f, 0.998773217f,
+		0.530746579f, -1.04624534f, 0.516978741f, 1.67352319f, -0.678886116f, -1.0f, 0.998773217f,
+		0.636180997f, -1.25564122f, 0.620942533f, 1.67352319f, -0.678886116f, -1.0f, 0.998773217f,
+		0.741615415f, -1.46503711f, 0.724906266f, 1.67352319f, -0.678886116f, -1.0f, 0.998773217f,
+		0.847049832f, -1.67443311f, 0.828870058f, 1.67352319f, -0.678886116f, -1.0f, 0.998773217f,
+		0.0114873517f, -0.0132172704f, 0.00321250781f, 1.67402124f, -0.679416418f, -1.0f, 0.99877578f,
+		0.116084486f, -0.220932871f, 0.106333248f, 1.67402124f, -0.679416418f, -1.0f, 0.99877578f,
+		0.220681623f, -0.428648472f, 0.209454f, 1.67402124f, -0.679416418f, -1.0f, 0.99877578f,
+		0.325278759f, -0.636364043f, 0.312574744f, 1.67402124f, -0.679416418f, -1.0f, 0.99877578f,
+		0.42987588f, -0.844079673f, 0.415695488f, 1.67402124f, -0.679416418f, -1.0f, 0.99877578f,
+		0.534473002f, -1.05179524f, 0.518816233f, 1.67402124f, -0.679416418f, -1.0f, 0.99877578f,
+		0.639070153f, -1.25951087f, 0.621936977f, 1.67402124f, -0.679416418f, -1.0f, 0.99877578f,
+		0.743667305f, -1.46722651f, 0.725057721f, 1.67402124f, -0.679416418f, -1.0f, 0.99877578f,
+		0.848264396f, -1.67494202f, 0.828178465f, 1.67402124f, -0.679416418f, -1.0f, 0.99877578f,
+		0.0192755423f, -0.0269463249f, 0.00916772708f, 1.67450476f, -0.679933488f, -1.0f, 0.998778284f,
+		0.123048589f, -0.233007655f, 0.111458302f, 1.67450476f, -0.679933488f, -1.0f, 0.998778284f,
+		0.226821631f, -0.439069003f, 0.213748872f, 1.67450476f, -0.679933488f, -1.0f, 0.998778284f,
+		0.330594689f, -0.645130336f, 0.316039443f, 1.67450476f, -0.679933488f, -1.0f, 0.998778284f,
+		0.434367716f, -0.85119164f, 0.418330044f, 1.67450476f, -0.679933488f, -1.0f, 0.998778284f,
+		0.538140774f, -1.057253f, 0.520620584f, 1.67450476f, -0.679933488f, -1.0f, 0.998778284f,
+		0.641913831f, -1.26331437f, 0.622911155f, 1.67450476f, -0.679933488f, -1.0f, 0.998778284f,
+		0.745686829f, -1.46937573f, 0.725201786f, 1.67450476f, -0.679933488f, -1.0f, 0.998778284f,
+		0.849459887f, -1.67543697f, 0.827492356f, 1.67450476f, -0.679933488f, -1.0f, 0.998778284f,
+		0.0269419625f, -0.0404579714f, 0.0150277158f, 1.67497396f, -0.680437505f, -1.0f, 0.998780847f,
+		0.129903808f, -0.244890481f, 0.116500676f, 1.67497396f, -0.680437505f, -1.0f, 0.998780847f,
+		0.232865646f, -0.449322969f, 0.217973635f, 1.67497396f, -0.680437505f, -1.0f, 0.998780847f,
+		0.3358275f, -0.653755486f, 0.319446594f, 1.67497396f, -0.680437505f, -1.0f, 0.998780847f,
+		0.438789338f, -0.858187973f, 0.420919538f, 1.67497396f, -0.680437505f, -1.0f, 0.998780847f,
+		0.541751146f, -1.06262052f, 0.522392511f, 1.67497396f, -0.680437505f, -1.0f, 0.998780847f,
+		0.644712985f, -1.26705301f, 0.623865485f, 1.67497396f, -0.680437505f, -1.0f, 0.998780847f,
+		0.747674823f, -1.4714855f, 0.725338399f, 1.67497396f, -0.680437505f, -1.0f, 0.998780847f,
+		0.850636661f, -1.67591798f, 0.826811373f, 1.67497396f, -0.680437505f, -1.0f, 0.998780847f,
+		0.0344894454f, -0.0537571646f, 0.0207946114f, 1.67542875f, -0.680928588f, -1.0f, 0.99878341f,
+		0.136652663f, -0.256585658f, 0.121462196f, 1.67542875f, -0.680928588f, -1.0f, 0.99878341f,
+		0.238815889f, -0.459414154f, 0.222129777f, 1.67542875f, -0.680928588f, -1.0f, 0.99878341f,
+		0.340979099f, -0.662242651f, 0.322797358f, 1.67542875f, -0.680928588f, -1.0f, 0.99878341f,
+		0.443142325f, -0.865071177f, 0.423464954f, 1.67542875f, -0.680928588f, -1.0f, 0.99878341f,
+		0.54530555f, -1.0678997f, 0.52413255f, 1.67542875f, -0.680928588f, -1.0f, 0.99878341f,
+		0.647468805f, -1.27072811f, 0.624800086f, 1.67542875f, -0.680928588f, -1.0f, 0.99878341f,
+		0.749632001f, -1.47355664f, 0.725467682f, 1.67542875f, -0.680928588f, -1.0f, 0.99878341f,
+		0.851795197f, -1.67638516f, 0.826135278f, 1.67542875f, -0.680928588f, -1.0f, 0.99878341f,
+		0.0419207364f, -0.0668487102f, 0.0264704823f, 1.67586923f, -0.681406856f, -1.0f, 0.998785973f,
+		0.143297628f, -0.26809743f, 0.126344636f, 1.67586923f, -0.681406856f, -1.0f, 0.998785973f,
+		0.244674534f, -0.469346166f, 0.22621879f, 1.67586923f, -0.681406856f, -1.0f, 0.998785973f,
+		0.346051425f, -0.670594931f, 0.326092929f, 1.67586923f, -0.681406856f, -1.0f, 0.998785973f,
+		0.447428316f, -0.871843636f, 0.425967097f, 1.67586923f, -0.681406856f, -1.0f, 0.998785973f,
+		0.548805237f, -1.07309234f, 0.525841236f, 1.67586923f, -0.681406856f, -1.0f, 0.998785973f,
+		0.650182128f, -1.27434111f, 0.625715375f, 1.67586923f, -0.681406856f, -1.0f, 0.998785973f,
+		0.751559019f, -1.47558987f, 0.725589573f, 1.67586923f, -0.681406856f, -1.0f, 0.998785973f,
+		0.85293591f, -1.67683852f, 0.825463712f, 1.67586923f, -0.681406856f, -1.0f, 0.998785973f,
+		0.0492384993f, -0.079737246f, 0.03205733f, 1.67629552f, -0.681872368f, -1.0f, 0.998788536f,
+		0.149841085f, -0.279429883f, 0.131149694f, 1.67629552f, -0.681872368f, -1.0f, 0.998788536f,
+		0.250443667f, -0.47912249f, 0.230242074f, 1.67629552f, -0.681872368f, -1.0f, 0.998788536f,
+		0.351046264f, -0.678815126f, 0.329334438f, 1.67629552f, -0.681872368f, -1.0f, 0.998788536f,
+		0.451648831f, -0.878507733f, 0.428426802f, 1.67629552f, -0.681872368f, -1.0f, 0.998788536f,
+		0.552251399f, -1.07820034f, 0.527519166f, 1.67629552f, -0.681872368f, -1.0f, 0.998788536f,
+		0.652854025f, -1.27789307f, 0.626611531f, 1.67629552f, -0.681872368f, -1.0f, 0.998788536f,
+		0.753456593f, -1.47758567f, 0.725703955f, 1.67629552f, -0.681872368f, -1.0f, 0.998788536f,
+		0.85405916f, -1.67727828f, 0.824796319f, 1.67629552f, -0.681872368f, -1.0f, 0.998788536f,
+		0.0564453155f, -0.0924272835f, 0.0375570878f, 1.67670774f, -0.682325244f, -1.0f, 0.998791039f,
+		0.156285331f, -0.290586919f, 0.13587904f, 1.67670774f, -0.682325244f, -1.0f, 0.998791039f,
+		0.256125331f, -0.488746554f, 0.234201014f, 1.67670774f, -0.682325244f, -1.0f, 0.998791039f,
+		0.355965346f, -0.686906159f, 0.332522959f, 1.67670774f, -0.682325244f, -1.0f, 0.998791039f,
+		0.455805361f, -0.885065794f, 0.430844933f, 1.67670774f, -0.682325244f, -1.0f, 0.998791039f,
+		0.555645406f, -1.08322549f, 0.529166877f, 1.67670774f, -0.682325244f, -1.0f, 0.998791039f,
+		0.655485392f, -1.28138506f, 0.627488852f, 1.67670774f, -0.682325244f, -1.0f, 0.998791039f,
+		0.755325437f, -1.47954476f, 0.725810826f, 1.67670774f, -0.682325244f, -1.0f, 0.998791039f,
+		0.855165422f, -1.67770433f, 0.82413274f, 1.67670774f, -0.682325244f, -1.0f, 0.998791039f,
+		0.0635436848f, -0.104923174f, 0.0429716296f, 1.67710567f, -0.682765603f, -1.0f, 0.998793602f,
+		0.162632599f, -0.301572382f, 0.140534267f, 1.67710567f, -0.682765603f, -1.0f, 0.998793602f,
+		0.261721522f, -0.498221576f, 0.238096908f, 1.67710567f, -0.682765603f, -1.0f, 0.998793602f,
+		0.360810429f, -0.69487077f, 0.335659564f, 1.67710567f, -0.682765603f, -1.0f, 0.998793602f,
+		0.459899336f, -0.891519964f, 0.433222204f, 1.67710567f, -0.682765603f, -1.0f, 0.998793602f,
+		0.558988273f, -1.08816922f, 0.530784845f, 1.67710567f, -0.682765603f, -1.0f, 0.998793602f,
+		0.65807718f, -1.28481841f, 0.628347456f, 1.67710567f, -0.682765603f, -1.0f, 0.998793602f,
+		0.757166088f, -1.4814676f, 0.725910127f, 1.67710567f, -0.682765603f, -1.0f, 0.998793602f,
+		0.856254995f, -1.6781168f, 0.823472738f, 1.67710567f, -0.682765603f, -1.0f, 0.998793602f,
+		0.00358253857f, 0.000735973183f, -0.00284656556f, 1.67787695f, -0.681902111f, -1.0f, 0.998892546f,
+		0.109016106f, -0.209133178f, 0.101590551f, 1.67787695f, -0.681902111f, -1.0f, 0.998892546f,
+		0.214449659f, -0.419002324f, 0.206027672f, 1.67787695f, -0.681902111f, -1.0f, 0.998892546f,
+		0.319883227f, -0.628871441f, 0.310464799f, 1.67787695f, -0.681902111f, -1.0f, 0.998892546f,
+		0.425316781f, -0.838740587f, 0.414901912f, 1.67787695f, -0.681902111f, -1.0f, 0.998892546f,
+		0.530750334f, -1.04860973f, 0.519339025f, 1.67787695f, -0.681902111f, -1.0f, 0.998892546f,
+		0.636183918f, -1.25847888f, 0.623776138f, 1.67787695f, -0.681902111f, -1.0f, 0.998892546f,
+		0.741617501f, -1.46834803f, 0.728213251f, 1.67787695f, -0.681902111f, -1.0f, 0.998892546f,
+		0.847051024f, -1.67821717f, 0.832650423f, 1.67787695f, -0.681902111f, -1.0f, 0.998892546f,
+		0.011495471f, -0.0132519342f, 0.00323404046f, 1.67846584f, -0.682498038f, -1.0f, 0.998894393f,
+		0.116091743f, -0.22144644f, 0.106833816f, 1.67846584f, -0.682498038f, -1.0f, 0.998894393f,
+		0.220688015f, -0.429640949f, 0.210433587f, 1.67846584f, -0.682498038f, -1.0f, 0.998894393f,
+		0.325284302f, -0.637835443f, 0.314033359f, 1.67846584f, -0.682498038f, -1.0f, 0.998894393f,
+		0.429880559f, -0.846029997f, 0.417633146f, 1.67846584f, -0.682498038f, -1.0f, 0.998894393f,
+		0.534476817f, -1.05422449f, 0.521232903f, 1.67846584f, -0.682498038f, -1.0f, 0.998894393f,
+		0.639073133f, -1.26241899f, 0.62483269f, 1.67846584f, -0.682498038f, -1.0f, 0.998894393f,
+		0.743669391f, -1.47061348f, 0.728432477f, 1.67846584f, -0.682498038f, -1.0f, 0.998894393f,
+		0.848265648f, -1.67880809f, 0.832032263f, 1.67846584f, -0.682498038f, -1.0f, 0.998894393f,
+		0.0192837119f, -0.0270182043f, 0.00921789184f, 1.67904294f, -0.683082819f, -1.0f, 0.998896301f,
+		0.12305589f, -0.233564347f, 0.111993387f, 1.67904294f, -0.683082819f, -1.0f, 0.998896301f,
+		0.226828068f, -0.440110475f, 0.214768887f, 1.67904294f, -0.683082819f, -1.0f, 0.998896301f,
+		0.330600262f, -0.646656632f, 0.317544371f, 1.67904294f, -0.683082819f, -1.0f, 0.998896301f,
+		0.434372425f, -0.85320276f, 0.420319885f, 1.67904294f, -0.683082819f, -1.0f, 0.998896301f,
+		0.538144588f, -1.05974889f, 0.523095369f, 1.67904294f, -0.683082819f, -1.0f, 0.998896301f,
+		0.641916811f, -1.26629508f, 0.625870883f, 1.67904294f, -0.683082819f, -1.0f, 0.998896301f,
+		0.745688975f, -1.47284114f, 0.728646338f, 1.67904294f, -0.683082819f, -1.0f, 0.998896301f,
+		0.849461138f, -1.67938733f, 0.831421852f, 1.67904294f, -0.683082819f, -1.0f, 0.998896301f,
+		0.0269501861f, -0.0405680053f, 0.0151072359f, 1.67960858f, -0.683656573f, -1.0f, 0.998898149f,
+		0.129911155f, -0.245491415f, 0.117071204f, 1.67960858f, -0.683656573f, -1.0f, 0.998898149f,
+		0.232872128f, -0.450414807f, 0.219035178f, 1.67960858f, -0.683656573f, -1.0f, 0.998898149f,
+		0.335833102f, -0.655338228f, 0.320999146f, 1.67960858f, -0.683656573f, -1.0f, 0.998898149f,
+		0.438794076f, -0.860261619f, 0.422963113f, 1.67960858f, -0.683656573f, -1.0f, 0.998898149f,
+		0.541755021f, -1.06518507f, 0.52492708f, 1.67960858f, -0.683656573f, -1.0f, 0.998898149f,
+		0.644716024f, -1.27010846f, 0.626891077f, 1.67960858f, -0.683656573f, -1.0f, 0.998898149f,
+		0.747676969f, -1.47503185f, 0.728855014f, 1.67960858f, -0.683656573f, -1.0f, 0.998898149f,
+		0.850637972f, -1.67995524f, 0.830819011f, 1.67960858f, -0.683656573f, -1.0f, 0.998898149f,
+		0.034497723f, -0.0539063476f, 0.0209042467f, 1.68016279f, -0.684219539f, -1.0f, 0.998900056f,
+		0.136660069f, -0.25723207f, 0.12206915f, 1.68016279f, -0.684219539f, -1.0f, 0.998900056f,
+		0.238822415f, -0.460557759f, 0.223234057f, 1.68016279f, -0.684219539f, -1.0f, 0.998900056f,
+		0.340984762f, -0.663883507f, 0.324398965f, 1.68016279f, -0.684219539f, -1.0f, 0.998900056f,
+		0.443147093f, -0.867209196f, 0.425563872f, 1.68016279f, -0.684219539f, -1.0f, 0.998900056f,
+		0.545309424f, -1.07053494f, 0.526728749f, 1.68016279f, -0.684219539f, -1.0f, 0.998900056f,
+		0.647471786f, -1.27386057f, 0.627893686f, 1.68016279f, -0.684219539f, -1.0f, 0.998900056f,
+		0.749634147f, -1.47718632f, 0.729058564f, 1.68016279f, -0.684219539f, -1.0f, 0.998900056f,
+		0.851796508f, -1.68051207f, 0.830223501f, 1.68016279f, -0.684219539f, -1.0f, 0.998900056f,
+		0.0419290774f, -0.0670380741f, 0.026611032f, 1.68070602f, -0.684772015f, -1.0f, 0.998901904f,
+		0.143305093f, -0.268790543f, 0.126989037f, 1.68070602f, -0.684772015f, -1.0f, 0.998901904f,
+		0.244681105f, -0.470543027f, 0.227367043f, 1.68070602f, -0.684772015f, -1.0f, 0.998901904f,
+		0.346057117f, -0.672295511f, 0.32774505f, 1.68070602f, -0.684772015f, -1.0f, 0.998901904f,
+		0.447433144f, -0.874047995f, 0.428123057f, 1.68070602f, -0.684772015f, -1.0f, 0.998901904f,
+		0.548809171f, -1.07580054f, 0.528501034f, 1.68070602f, -0.684772015f, -1.0f, 0.998901904f,
+		0.650185168f, -1.27755296f, 0.62887907f, 1.68070602f, -0.684772015f, -1.0f, 0.998901904f,
+		0.751561165f, -1.47930551f, 0.729257047f, 1.68070602f, -0.684772015f, -1.0f, 0.998901904f,
+		0.852937222f, -1.68105793f, 0.829635084f, 1.68070602f, -0.684772015f, -1.0f, 0.998901904f,
+		0.0492469035f, -0.0799678937f, 0.0322296359f, 1.68123829f, -0.685314059f, -1.0f, 0.998903811f,
+		0.149848595f, -0.280171037f, 0.131832629f, 1.68123829f, -0.685314059f, -1.0f, 0.998903811f,
+		0.250450283f, -0.480374187f, 0.231435612f, 1.68123829f, -0.685314059f, -1.0f, 0.998903811f,
+		0.351051986f, -0.680577338f, 0.331038594f, 1.68123829f, -0.685314059f, -1.0f, 0.998903811f,
+		0.451653689f, -0.880780458f, 0.430641592f, 1.68123829f, -0.685314059f, -1.0f, 0.998903811f,
+		0.552255392f, -1.08098364f, 0.530244589f, 1.68123829f, -0.685314059f, -1.0f, 0.998903811f,
+		0.652857065f, -1.28118682f, 0.629847586f, 1.68123829f, -0.685314059f, -1.0f, 0.998903811f,
+		0.753458798f, -1.48138988f, 0.729450583f, 1.68123829f, -0.685314059f, -1.0f, 0.998903811f,
+		0.854060471f, -1.68159306f, 0.829053521f, 1.68123829f, -0.685314059f, -1.0f, 0.998903811f,
+		0.0564537868f, -0.0927003697f, 0.0377620421f, 1.68175972f, -0.685845971f, -1.0f, 0.998905659f,
+		0.1562929f, -0.291377515f, 0.136601627f, 1.68175972f, -0.685845971f, -1.0f, 0.998905659f,
+		0.256132007f, -0.490054697f, 0.235441208f, 1.68175972f, -0.685845971f, -1.0f, 0.998905659f,
+		0.355971128f, -0.688731849f, 0.334280789f, 1.68175972f, -0.685845971f, -1.0f, 0.998905659f,
+		0.455810249f, -0.887408972f, 0.43312037f, 1.68175972f, -0.685845971f, -1.0f, 0.998905659f,
+		0.5556494f, -1.08608615f, 0.531959951f, 1.68175972f, -0.685845971f, -1.0f, 0.998905659f,
+		0.655488491f, -1.28476334f, 0.630799532f, 1.68175972f, -0.685845971f, -1.0f, 0.998905659f,
+		0.755327582f, -1.48344052f, 0.729639113f, 1.68175972f, -0.685845971f, -1.0f, 0.998905659f,
+		0.855166733f, -1.68211758f, 0.828478694f, 1.68175972f, -0.685845971f, -1.0f, 0.998905659f,
+		0.0635522306f, -0.105239913f, 0.0432101637f, 1.68227065f, -0.68636781f, -1.0f, 0.998907566f,
+		0.162640244f, -0.302413911f, 0.141297683f, 1.68227065f, -0.68636781f, -1.0f, 0.998907566f,
+		0.261728257f, -0.499587893f, 0.239385203f, 1.68227065f, -0.68636781f, -1.0f, 0.998907566f,
+		0.36081627f, -0.696761906f, 0.337472707f, 1.68227065f, -0.68636781f, -1.0f, 0.998907566f,
+		0.459904283f, -0.893935859f, 0.435560226f, 1.68227065f, -0.68636781f, -1.0f, 0.998907566f,
+		0.558992267f, -1.09110987f, 0.533647776f, 1.68227065f, -0.68636781f, -1.0f, 0.998907566f,
+		0.65808028f, -1.28828382f, 0.631735265f, 1.68227065f, -0.68636781f, -1.0f, 0.998907566f,
+		0.757168293f, -1.48545778f, 0.729822814f, 1.68227065f, -0.68636781f, -1.0f, 0.998907566f,
+		0.856256306f, -1.68263185f, 0.827910304f, 1.68227065f, -0.68636781f, -1.0f, 0.998907566f,
+		0.00358814094f, 0.000737124064f, -0.00285101682f, 1.68083167f, -0.683949172f, -1.0f, 0.999042332f,
+		0.109021112f, -0.209460467f, 0.101914637f, 1.68083167f, -0.683949172f, -1.0f, 0.999042332f,
+		0.214454085f, -0.419658065f, 0.206680283f, 1.68083167f, -0.683949172f, -1.0f, 0.999042332f,
+		0.319887042f, -0.629855633f, 0.311445951f, 1.68083167f, -0.683949172f, -1.0f, 0.999042332f,
+		0.425320029f, -0.84005326f, 0.416211605f, 1.68083167f, -0.683949172f, -1.0f, 0.999042332f,
+		0.530753016f, -1.05025089f, 0.520977259f, 1.68083167f, -0.683949172f, -1.0f, 0.999042332f,
+		0.636185944f, -1.26044846f, 0.625742912f, 1.68083167f, -0.683949172f, -1.0f, 0.999042332f,
+		0.741618931f, -1.47064602f, 0.730508566f, 1.68083167f, -0.683949172f, -1.0f, 0.999042332f,
+		0.847051919f, -1.68084359f, 0.83527422f, 1.68083167f, -0.683949172f, -1.0f, 0.999042332f,
+		0.0115010701f, -0.0132758375f, 0.00324888877f, 1.68146324f, -0.684576511f, -1.0f, 0.999043524f,
+		0.11609675f, -0.221800596f, 0.107178986f, 1.68146324f, -0.684576511f, -1.0f, 0.999043524f,
+		0.220692441f, -0.430325359f, 0.211109087f, 1.68146324f, -0.684576511f, -1.0f, 0.999043524f,
+		0.325288117f, -0.638850093f, 0.315039188f, 1.68146324f, -0.684576511f, -1.0f, 0.999043524f,
+		0.429883808f, -0.847374856f, 0.418969274f, 1.68146324f, -0.684576511f, -1.0f, 0.999043524f,
+		0.534479499f, -1.05589962f, 0.522899389f, 1.68146324f, -0.684576511f, -1.0f, 0.999043524f,
+		0.63907516f, -1.26442432f, 0.626829505f, 1.68146324f, -0.684576511f, -1.0f, 0.999043524f,
+		0.743670821f, -1.47294915f, 0.730759561f, 1.68146324f, -0.684576511f, -1.0f, 0.999043524f,
+		0.848266542f, -1.68147385f, 0.834689677f, 1.68146324f, -0.684576511f, -1.0f, 0.999043524f,
+		0.0192893092f, -0.0270674434f, 0.00925225578f, 1.68208396f, -0.6851933f, -1.0f, 0.999044776f,
+		0.123060897f, -0.233945683f, 0.112359926f, 1.68208396f, -0.6851933f, -1.0f, 0.999044776f,
+		0.226832479f, -0.440823913f, 0.215467602f, 1.68208396f, -0.6851933f, -1.0f, 0.999044776f,
+		0.330604076f, -0.647702157f, 0.318575263f, 1.68208396f, -0.6851933f, -1.0f, 0.999044776f,
+		0.434375674f, -0.854580402f, 0.421682954f, 1.68208396f, -0.6851933f, -1.0f, 0.999044776f,
+		0.538147271f, -1.06145859f, 0.524790645f, 1.68208396f, -0.6851933f, -1.0f, 0.999044776f,
+		0.641918838f, -1.26833689f, 0.627898276f, 1.68208396f, -0.6851933f, -1.0f, 0.999044776f,
+		0.745690405f, -1.47521508f, 0.731005967f, 1.68208396f, -0.6851933f, -1.0f, 0.999044776f,
+		0.849462032f, -1.68209338f, 0.834113657f, 1.68208396f, -0.6851933f, -1.0f, 0.999044776f,
+		0.0269557815f, -0.0406428762f, 0.0151613429f, 1.68269408f, -0.685799778f, -1.0f, 0.999045968f,
+		0.129916161f, -0.245900303f, 0.117459409f, 1.68269408f, -0.685799778f, -1.0f, 0.999045968f,
+		0.232876539f, -0.451157719f, 0.219757482f, 1.68269408f, -0.685799778f, -1.0f, 0.999045968f,
+		0.335836917f, -0.656415164f, 0.322055548f, 1.68269408f, -0.685799778f, -1.0f, 0.999045968f,
+		0.438797295f, -0.86167258f, 0.4243536f, 1.68269408f, -0.685799778f, -1.0f, 0.999045968f,
+		0.541757703f, -1.06693006f, 0.52665168f, 1.68269408f, -0.685799778f, -1.0f, 0.999045968f,
+		0.644718051f, -1.27218747f, 0.628949761f, 1.68269408f, -0.685799778f, -1.0f, 0.999045968f,
+		0.747678459f, -1.47744489f, 0.731247842f, 1.68269408f, -0.685799778f, -1.0f, 0.999045968f,
+		0.850638807f, -1.6827023f, 0.833545864f, 1.68269408f, -0.685799778f, -1.0f, 0.999045968f,
+		0.0345033221f, -0.0540071577f, 0.0209783353f, 1.6832937f, -0.686396122f, -1.0f, 0.99904716f,
+		0.136665076f, -0.257668883f, 0.12247932f, 1.6832937f, -0.686396122f, -1.0f, 0.99904716f,
+		0.238826826f, -0.461330593f, 0.223980293f, 1.6832937f, -0.686396122f, -1.0f, 0.99904716f,
+		0.340988576f, -0.664992332f, 0.325481296f, 1.6832937f, -0.686396122f, -1.0f, 0.99904716f,
+		0.443150342f, -0.868654013f, 0.426982254f, 1.6832937f, -0.686396122f, -1.0f, 0.99904716f,
+		0.545312107f, -1.07231569f, 0.528483272f, 1.6832937f, -0.686396122f, -1.0f, 0.99904716f,
+		0.647473872f, -1.27597749f, 0.6299842f, 1.6832937f, -0.686396122f, -1.0f, 0.99904716f,
+		0.749635577f, -1.47963917f, 0.731485188f, 1.6832937f, -0.686396122f, -1.0f, 0.99904716f,
+		0.851797342f, -1.68330085f, 0.832986176f, 1.6832937f, -0.686396122f, -1.0f, 0.99904716f,
+		0.0419346727f, -0.0671651512f, 0.0267053526f, 1.68388319f, -0.686982572f, -1.0f, 0.999048352f,
+		0.1433101f, -0.269255698f, 0.127421483f, 1.68388319f, -0.686982572f, -1.0f, 0.999048352f,
+		0.244685516f, -0.471346229f, 0.228137612f, 1.68388319f, -0.686982572f, -1.0f, 0.999048352f,
+		0.346060932f, -0.673436761f, 0.328853726f, 1.68388319f, -0.686982572f, -1.0f, 0.999048352f,
+		0.447436363f, -0.875527263f, 0.42956987f, 1.68388319f, -0.686982572f, -1.0f, 0.999048352f,
+		0.548811793f, -1.07761788f, 0.530286014f, 1.68388319f, -0.686982572f, -1.0f, 0.999048352f,
+		0.650187194f, -1.27970839f, 0.631002128f, 1.68388319f, -0.686982572f, -1.0f, 0.999048352f,
+		0.751562655f, -1.48179889f, 0.731718242f, 1.68388319f, -0.686982572f, -1.0f, 0.999048352f,
+		0.852938056f, -1.68388939f, 0.832434356f, 1.68388319f, -0.686982572f, -1.0f, 0.999048352f,
+		0.0492525026f, -0.0801215842f, 0.0323444493f, 1.68446267f, -0.687559426f, -1.0f, 0.999049604f,
+		0.149853602f, -0.280664891f, 0.132287681f, 1.68446267f, -0.687559426f, -1.0f, 0.999049604f,
+		0.250454724f, -0.481208205f, 0.232230902f, 1.68446267f, -0.687559426f, -1.0f, 0.999049604f,
+		0.351055801f, -0.681751549f, 0.332174122f, 1.68446267f, -0.687559426f, -1.0f, 0.999049604f,
+		0.451656908f, -0.882294834f, 0.432117343f, 1.68446267f, -0.687559426f, -1.0f, 0.999049604f,
+		0.552258015f, -1.08283818f, 0.532060564f, 1.68446267f, -0.687559426f, -1.0f, 0.999049604f,
+		0.652859151f, -1.28338146f, 0.632003784f, 1.68446267f, -0.687559426f, -1.0f, 0.999049604f,
+		0.753460228f, -1.48392475f, 0.731947005f, 1.68446267f, -0.687559426f, -1.0f, 0.999049604f,
+		0.854061306f, -1.68446815f, 0.831890225f, 1.68446267f, -0.687559426f, -1.0f, 0.999049604f,
+		0.0564593896f, -0.0928810239f, 0.0378976204f, 1.68503237f, -0.688126743f, -1.0f, 0.999050796f,
+		0.156297907f, -0.291900545f, 0.137079611f, 1.68503237f, -0.688126743f, -1.0f, 0.999050796f,
+		0.256136447f, -0.490920037f, 0.236261621f, 1.68503237f, -0.688126743f, -1.0f, 0.999050796f,
+		0.355974972f, -0.689939559f, 0.335443616f, 1.68503237f, -0.688126743f, -1.0f, 0.999050796f,
+		0.455813497f, -0.88895905f, 0.434625626f, 1.68503237f, -0.688126743f, -1.0f, 0.999050796f,
+		0.555652022f, -1.0879786f, 0.533807635f, 1.68503237f, -0.688126743f, -1.0f, 0.999050796f,
+		0.655490518f, -1.28699803f, 0.632989585f, 1.68503237f, -0.688126743f, -1.0f, 0.999050796f,
+		0.755329072f, -1.48601758f, 0.732171595f, 1.68503237f, -0.688126743f, -1.0f, 0.999050796f,
+		0.855167568f, -1.68503714f, 0.831353605f, 1.68503237f, -0.688126743f, -1.0f, 0.999050796f,
+		0.0635578334f, -0.105447903f, 0.0433667973f, 1.68559265f, -0.688684821f, -1.0f, 0.999052048f,
+		0.162645251f, -0.302966505f, 0.141798973f, 1.68559265f, -0.688684821f, -1.0f, 0.999052048f,
+		0.261732668f, -0.500485063f, 0.240231171f, 1.68559265f, -0.688684821f, -1.0f, 0.999052048f,
+		0.360820085f, -0.698003709f, 0.33866334f, 1.68559265f, -0.688684821f, -1.0f, 0.999052048f,
+		0.459907502f, -0.895522296f, 0.437095523f, 1.68559265f, -0.688684821f, -1.0f, 0.999052048f,
+		0.558994949f, -1.09304082f, 0.535527706f, 1.68559265f, -0.688684821f, -1.0f, 0.999052048f,
+		0.658082366f, -1.29055941f, 0.633959889f, 1.68559265f, -0.688684821f, -1.0f, 0.999052048f,
+		0.757169783f, -1.488078f, 0.732392073f, 1.68559265f, -0.688684821f, -1.0f, 0.999052048f,
+		0.8562572f, -1.6855967f, 0.830824256f, 1.68559265f, -0.688684821f, -1.0f, 0.999052048f,
+		0.00359195354f, 0.000737907307f, -0.00285404641f, 1.68277359f, -0.685294569f, -1.0f, 0.999213278f,
+		0.109024517f, -0.20968321f, 0.102135189f, 1.68277359f, -0.685294569f, -1.0f, 0.999213278f,
+		0.214457095f, -0.420104325f, 0.207124412f, 1.68277359f, -0.685294569f, -1.0f, 0.999213278f,
+		0.319889665f, -0.63052547f, 0.312113643f, 1.68277359f, -0.685294569f, -1.0f, 0.999213278f,
+		0.425322235f, -0.840946555f, 0.417102873f, 1.68277359f, -0.685294569f, -1.0f, 0.999213278f,
+		0.530754805f, -1.05136764f, 0.522092104f, 1.68277359f, -0.685294569f, -1.0f, 0.999213278f,
+		0.636187375f, -1.26178885f, 0.627081335f, 1.68277359f, -0.685294569f, -1.0f, 0.999213278f,
+		0.741619945f, -1.47220993f, 0.732070565f, 1.68277359f, -0.685294569f, -1.0f, 0.999213278f,
+		0.847052515f, -1.68263102f, 0.837059796f, 1.68277359f, -0.685294569f, -1.0f, 0.999213278f,
+		0.0115048634f, -0.0132920314f, 0.00325894868f, 1.68342483f, -0.685936749f, -1.0f, 0.999213874f,
+		0.116100147f, -0.222040534f, 0.107412845f, 1.68342483f, -0.685936749f, -1.0f, 0.999213874f,
+		0.220695421f, -0.430789024f, 0.211566746f, 1.68342483f, -0.685936749f, -1.0f, 0.999213874f,
+		0.32529071f, -0.639537513f, 0.315720648f, 1.68342483f, -0.685936749f, -1.0f, 0.999213874f,
+		0.429885983f, -0.848286033f, 0.419874549f, 1.68342483f, -0.685936749f, -1.0f, 0.999213874f,
+		0.534481287f, -1.05703449f, 0.52402842f, 1.68342483f, -0.685936749f, -1.0f, 0.999213874f,
+		0.639076531f, -1.26578307f, 0.628182352f, 1.68342483f, -0.685936749f, -1.0f, 0.999213874f,
+		0.743671834f, -1.47453153f, 0.732336223f, 1.68342483f, -0.685936749f, -1.0f, 0.999213874f,
+		0.848267138f, -1.68327999f, 0.836490095f, 1.68342483f, -0.685936749f, -1.0f, 0.999213874f,
+		0.0192930829f, -0.0271006525f, 0.00927543361f, 1.68406534f, -0.686568499f, -1.0f, 0.99921453f,
+		0.123064272f, -0.234202877f, 0.112607144f, 1.68406534f, -0.686568499f, -1.0f, 0.99921453f,
+		0.226835459f, -0.441305101f, 0.215938851f, 1.68406534f, -0.686568499f, -1.0f, 0.99921453f,
+		0.330606639f, -0.64840734f, 0.319270581f, 1.68406534f, -0.686568499f, -1.0f, 0.99921453f,
+		0.434377849f, -0.85550952f, 0.422602296f, 1.68406534f, -0.686568499f, -1.0f, 0.99921453f,
+		0.538148999f, -1.06261182f, 0.525933981f, 1.68406534f, -0.686568499f, -1.0f, 0.99921453f,
+		0.641920209f, -1.269714f, 0.629265726f, 1.68406534f, -0.686568499f, -1.0f, 0.99921453f,
+		0.745691419f, -1.47681618f, 0.732597411f, 1.68406534f, -0.686568499f, -1.0f, 0.99921453f,
+		0.849462569f, -1.68391848f, 0.835929155f, 1.68406534f, -0.686568499f, -1.0f, 0.99921453f,
+		0.0269595366f, -0.0406931415f, 0.0151976692f, 1.6846956f, -0.687190175f, -1.0f, 0.999215186f,
+		0.129919514f, -0.246174827f, 0.117720038f, 1.6846956f, -0.687190175f, -1.0f, 0.999215186f,
+		0.232879505f, -0.451656491f, 0.220242411f, 1.6846956f, -0.687190175f, -1.0f, 0.999215186f,
+		0.33583948f, -0.657138169f, 0.322764784f, 1.6846956f, -0.687190175f, -1.0f, 0.999215186f,
+		0.438799471f, -0.862619877f, 0.425287157f, 1.6846956f, -0.687190175f, -1.0f, 0.999215186f,
+		0.541759431f, -1.06810153f, 0.527809501f, 1.6846956f, -0.687190175f, -1.0f, 0.999215186f,
+		0.644719422f, -1.27358317f, 0.630331874f, 1.6846956f, -0.687190175f, -1.0f, 0.999215186f,
+		0.747679412f, -1.47906494f, 0.732854247f, 1.6846956f, -0.687190175f, -1.0f, 0.999215186f,
+		0.850639403f, -1.68454659f, 0.83537662f, 1.6846956f, -0.687190175f, -1.0f, 0.999215186f,
+		0.0345070586f, -0.0540745296f, 0.0210278463f, 1.68531561f, -0.687801898f, -1.0f, 0.999215841f,
+		0.136668414f, -0.257960796f, 0.122753419f, 1.68531561f, -0.687801898f, -1.0f, 0.999215841f,
+		0.238829777f, -0.461847037f, 0.22447899f, 1.68531561f, -0.687801898f, -1.0f, 0.999215841f,
+		0.340991139f, -0.665733337f, 0.326204568f, 1.68531561f, -0.687801898f, -1.0f, 0.999215841f,
+		0.443152487f, -0.869619548f, 0.427930146f, 1.68531561f, -0.687801898f, -1.0f, 0.999215841f,
+		0.545313835f, -1.07350588f, 0.529655695f, 1.68531561f, -0.687801898f, -1.0f, 0.999215841f,
+		0.647475183f, -1.27739215f, 0.631381273f, 1.68531561f, -0.687801898f, -1.0f, 0.999215841f,
+		0.74963659f, -1.4812783f, 0.733106852f, 1.68531561f, -0.687801898f, -1.0f, 0.999215841f,
+		0.851797938f, -1.68516457f, 0.83483243f, 1.68531561f, -0.687801898f, -1.0f, 0.999215841f,
+		0.0419383943f, -0.0672496855f, 0.0267680902f, 1.68592572f, -0.688403904f, -1.0f, 0.999216557f,
+		0.143313423f, -0.269565076f, 0.127709121f, 1.68592572f, -0.688403904f, -1.0f, 0.999216557f,
+		0.244688451f, -0.471880466f, 0.228650153f, 1.68592572f, -0.688403904f, -1.0f, 0.999216557f,
+		0.346063495f, -0.674195886f, 0.329591185f, 1.68592572f, -0.688403904f, -1.0f, 0.999216557f,
+		0.447438508f, -0.876511276f, 0.430532217f, 1.68592572f, -0.688403904f, -1.0f, 0.999216557f,
+		0.548813522f, -1.07882667f, 0.531473279f, 1.68592572f, -0.688403904f, -1.0f, 0.999216557f,
+		0.650188565f, -1.281142f, 0.632414281f, 1.68592572f, -0.688403904f, -1.0f, 0.999216557f,
+		0.751563609f, -1.48345745f, 0.733355343f, 1.68592572f, -0.688403904f, -1.0f, 0.999216557f,
+		0.852938652f, -1.68577278f, 0.834296346f, 1.68592572f, -0.688403904f, -1.0f, 0.999216557f,
+		0.0492562093f, -0.0802233294f, 0.0324204601f, 1.68652618f, -0.688996494f, -1.0f, 0.999217212f,
+		0.149856925f, -0.280991852f, 0.132588923f, 1.68652618f, -0.688996494f, -1.0f, 0.999217212f,
+		0.250457644f, -0.481760353f, 0.23275739f, 1.68652618f, -0.688996494f, -1.0f, 0.999217212f,
+		0.351058334f, -0.682528853f, 0.332925856f, 1.68652618f, -0.688996494f, -1.0f, 0.999217212f,
+		0.451659054f, -0.883297384f, 0.433094323f, 1.68652618f, -0.688996494f, -1.0f, 0.999217212f,
+		0.552259743f, -1.08406591f, 0.533262789f, 1.68652618f, -0.688996494f, -1.0f, 0.999217212f,
+		0.652860463f, -1.28483438f, 0.633431256f, 1.68652618f, -0.688996494f, -1.0f, 0.999217212f,
+		0.753461182f, -1.48560286f, 0.733599722f, 1.68652618f, -0.688996494f, -1.0f, 0.999217212f,
+		0.854061902f, -1.68637145f, 0.833768189f, 1.68652618f, -0.688996494f, -1.0f, 0.999217212f,
+		0.0564630814f, -0.0930000469f, 0.0379869491f, 1.68711722f, -0.689579785f, -1.0f, 0.999217868f,
+		0.156301215f, -0.29224512f, 0.137394547f, 1.68711722f, -0.689579785f, -1.0f, 0.999217868f,
+		0.256139338f, -0.491490185f, 0.236802146f, 1.68711722f, -0.689579785f, -1.0f, 0.999217868f,
+		0.355977476f, -0.690735221f, 0.336209744f, 1.68711722f, -0.689579785f, -1.0f, 0.999217868f,
+		0.455815613f, -0.889980316f, 0.435617328f, 1.68711722f, -0.689579785f, -1.0f, 0.999217868f,
+		0.555653751f, -1.08922541f, 0.535024941f, 1.68711722f, -0.689579785f, -1.0f, 0.999217868f,
+		0.655491889f, -1.28847051f, 0.634432554f, 1.68711722f, -0.689579785f, -1.0f, 0.999217868f,
+		0.755330026f, -1.48771548f, 0.733840108f, 1.68711722f, -0.689579785f, -1.0f, 0.999217868f,
+		0.855168164f, -1.68696058f, 0.833247721f, 1.68711722f, -0.689579785f, -1.0f, 0.999217868f,
+		0.063561514f, -0.105584271f, 0.0434694923f, 1.68769896f, -0.690154076f, -1.0f, 0.999218524f,
+		0.162648544f, -0.303328812f, 0.142127663f, 1.68769896f, -0.690154076f, -1.0f, 0.999218524f,
+		0.261735559f, -0.50107336f, 0.240785822f, 1.68769896f, -0.690154076f, -1.0f, 0.999218524f,
+		0.360822588f, -0.698817909f, 0.339444011f, 1.68769896f, -0.690154076f, -1.0f, 0.999218524f,
+		0.459909618f, -0.896562397f, 0.438102156f, 1.68769896f, -0.690154076f, -1.0f, 0.999218524f,
+		0.558996677f, -1.09430695f, 0.53676033f, 1.68769896f, -0.690154076f, -1.0f, 0.999218524f,
+		0.658083677f, -1.29205143f, 0.635418475f, 1.68769896f, -0.690154076f, -1.0f, 0.999218524f,
+		0.757170737f, -1.48979604f, 0.734076679f, 1.68769896f, -0.690154076f, -1.0f, 0.999218524f,
+		0.856257737f, -1.68754053f, 0.832734823f, 1.68769896f, -0.690154076f, -1.0f, 0.999218524f,
+		0.00359451375f, 0.000738433271f, -0.00285608042f, 1.68401837f, -0.686157048f, -1.0f, 0.999387264f,
+		0.109026812f, -0.209832773f, 0.102283277f, 1.68401837f, -0.686157048f, -1.0f, 0.999387264f,
+		0.214459106f, -0.420403957f, 0.207422629f, 1.68401837f, -0.686157048f, -1.0f, 0.999387264f,
+		0.319891393f, -0.630975187f, 0.312561989f, 1.68401837f, -0.686157048f, -1.0f, 0.999387264f,
+		0.425323695f, -0.841546357f, 0.417701334f, 1.68401837f, -0.686157048f, -1.0f, 0.999387264f,
+		0.530755997f, -1.05211759f, 0.522840679f, 1.68401837f, -0.686157048f, -1.0f, 0.999387264f,
+		0.636188269f, -1.26268876f, 0.627980053f, 1.68401837f, -0.686157048f, -1.0f, 0.999387264f,
+		0.7416206f, -1.47325993f, 0.733119428f, 1.68401837f, -0.686157048f, -1.0f, 0.999387264f,
+		0.847052872f, -1.68383121f, 0.838258803f, 1.68401837f, -0.686157048f, -1.0f, 0.999387264f,
+		0.0115074022f, -0.0133028729f, 0.00326568307f, 1.68467832f, -0.686806142f, -1.0f, 0.999387562f,
+		0.116102412f, -0.222201154f, 0.107569396f, 1.68467832f, -0.686806142f, -1.0f, 0.999387562f,
+		0.220697433f, -0.431099415f, 0.211873114f, 1.68467832f, -0.686806142f, -1.0f, 0.999387562f,
+		0.325292438f, -0.639997721f, 0.316176832f, 1.68467832f, -0.686806142f, -1.0f, 0.999387562f,
+		0.429887444f, -0.848895967f, 0.420480549f, 1.68467832f, -0.686806142f, -1.0f, 0.999387562f,
+		0.534482479f, -1.05779421f, 0.524784267f, 1.68467832f, -0.686806142f, -1.0f, 0.999387562f,
+		0.639077485f, -1.26669252f, 0.629087985f, 1.68467832f, -0.686806142f, -1.0f, 0.999387562f,
+		0.74367249f, -1.47559083f, 0.733391702f, 1.68467832f, -0.686806142f, -1.0f, 0.999387562f,
+		0.848267496f, -1.68448913f, 0.83769542f, 1.68467832f, -0.686806142f, -1.0f, 0.999387562f,
+		0.019295603f, -0.0271228161f, 0.00929090194f, 1.68532777f, -0.687444866f, -1.0f, 0.99938786f,
+		0.123066522f, -0.234374523f, 0.112772137f, 1.68532777f, -0.687444866f, -1.0f, 0.99938786f,
+		0.226837441f, -0.441626251f, 0.21625337f, 1.68532777f, -0.687444866f, -1.0f, 0.99938786f,
+		0.330608368f, -0.648877978f, 0.319734603f, 1.68532777f, -0.687444866f, -1.0f, 0.99938786f,
+		0.43437928f, -0.856129646f, 0.423215836f, 1.68532777f, -0.687444866f, -1.0f, 0.99938786f,
+		0.538150191f, -1.06338143f, 0.526697099f, 1.68532777f, -0.687444866f, -1.0f, 0.99938786f,
+		0.641921163f, -1.2706331f, 0.630178332f, 1.68532777f, -0.687444866f, -1.0f, 0.99938786f,
+		0.745692074f, -1.47788477f, 0.733659565f, 1.68532777f, -0.687444866f, -1.0f, 0.99938786f,
+		0.849462986f, -1.68513656f, 0.837140799f, 1.68532777f, -0.687444866f, -1.0f, 0.99938786f,
+		0.0269620363f, -0.0407265872f, 0.0152218388f, 1.68596697f, -0.688073456f, -1.0f, 0.999388158f,
+		0.129921749f, -0.246357471f, 0.117893457f, 1.68596697f, -0.688073456f, -1.0f, 0.999388158f,
+		0.232881472f, -0.451988369f, 0.220565066f, 1.68596697f, -0.688073456f, -1.0f, 0.999388158f,
+		0.335841179f, -0.657619238f, 0.323236674f, 1.68596697f, -0.688073456f, -1.0f, 0.999388158f,
+		0.438800901f, -0.863250136f, 0.425908297f, 1.68596697f, -0.688073456f, -1.0f, 0.999388158f,
+		0.541760623f, -1.06888103f, 0.528579891f, 1.68596697f, -0.688073456f, -1.0f, 0.999388158f,
+		0.644720316f, -1.27451193f, 0.631251514f, 1.68596697f, -0.688073456f, -1.0f, 0.999388158f,
+		0.747680068f, -1.48014283f, 0.733923137f, 1.68596697f, -0.688073456f, -1.0f, 0.999388158f,
+		0.85063976f, -1.68577373f, 0.83659476f, 1.68596697f, -0.688073456f, -1.0f, 0.999388158f,
+		0.0345095396f, -0.0541192144f, 0.0210606884f, 1.68659604f, -0.688692272f, -1.0f, 0.999388456f,
+		0.136670634f, -0.258154422f, 0.122935236f, 1.68659604f, -0.688692272f, -1.0f, 0.999388456f,
+		0.238831729f, -0.462189615f, 0.224809796f, 1.68659604f, -0.688692272f, -1.0f, 0.999388456f,
+		0.340992838f, -0.666224837f, 0.326684326f, 1.68659604f, -0.688692272f, -1.0f, 0.999388456f,
+		0.443153918f, -0.87026006f, 0.428558886f, 1.68659604f, -0.688692272f, -1.0f, 0.999388456f,
+		0.545315027f, -1.07429528f, 0.530433416f, 1.68659604f, -0.688692272f, -1.0f, 0.999388456f,
+		0.647476137f, -1.27833045f, 0.632308006f, 1.68659604f, -0.688692272f, -1.0f, 0.999388456f,
+		0.749637187f, -1.48236561f, 0.734182537f, 1.68659604f, -0.688692272f, -1.0f, 0.999388456f,
+		0.851798296f, -1.68640089f, 0.836057067f, 1.68659604f, -0.688692272f, -1.0f, 0.999388456f,
+		0.0419408567f, -0.0673055798f, 0.026809575f, 1.68721533f, -0.689301372f, -1.0f, 0.999388754f,
+		0.143315628f, -0.269769669f, 0.127899334f, 1.68721533f, -0.689301372f, -1.0f, 0.999388754f,
+		0.244690388f, -0.472233742f, 0.22898908f, 1.68721533f, -0.689301372f, -1.0f, 0.999388754f,
+		0.346065164f, -0.674697816f, 0.33007884f, 1.68721533f, -0.689301372f, -1.0f, 0.999388754f,
+		0.447439939f, -0.87716192f, 0.431168586f, 1.68721533f, -0.689301372f, -1.0f, 0.999388754f,
+		0.548814714f, -1.07962596f, 0.532258332f, 1.68721533f, -0.689301372f, -1.0f, 0.999388754f,
+		0.650189459f, -1.28209007f, 0.633348107f, 1.68721533f, -0.689301372f, -1.0f, 0.999388754f,
+		0.751564264f, -1.48455417f, 0.734437823f, 1.68721533f, -0.689301372f, -1.0f, 0.999388754f,
+		0.85293901f, -1.68701828f, 0.835527599f, 1.68721533f, -0.689301372f, -1.0f, 0.999388754f,
+		0.0492586531f, -0.080290392f, 0.0324705616f, 1.68782508f, -0.689901114f, -1.0f, 0.999389052f,
+		0.149859101f, -0.281207353f, 0.132787496f, 1.68782508f, -0.689901114f, -1.0f, 0.999389052f,
+		0.250459552f, -0.482124299f, 0.233104438f, 1.68782508f, -0.689901114f, -1.0f, 0.999389052f,
+		0.351060003f, -0.683041275f, 0.333421379f, 1.68782508f, -0.689901114f, -1.0f, 0.999389052f,
+		0.451660454f, -0.88395822f, 0.433738321f, 1.68782508f, -0.689901114f, -1.0f, 0.999389052f,
+		0.552260935f, -1.08487523f, 0.534055233f, 1.68782508f, -0.689901114f, -1.0f, 0.999389052f,
+		0.652861357f, -1.28579211f, 0.634372175f, 1.68782508f, -0.689901114f, -1.0f, 0.999389052f,
+		0.753461838f, -1.48670912f, 0.734689116f, 1.68782508f, -0.689901114f, -1.0f, 0.999389052f,
+		0.854062259f, -1.687626f, 0.835006058f, 1.68782508f, -0.689901114f, -1.0f, 0.999389052f,
+		0.0564655066f, -0.0930782557f, 0.0380456448f, 1.68842542f, -0.690491676f, -1.0f, 0.99938935f,
+		0.156303376f, -0.292471528f, 0.13760148f, 1.68842542f, -0.690491676f, -1.0f, 0.99938935f,
+		0.256141245f, -0.49186483f, 0.23715733f, 1.68842542f, -0.690491676f, -1.0f, 0.99938935f,
+		0.355979145f, -0.691258073f, 0.336713165f, 1.68842542f, -0.690491676f, -1.0f, 0.99938935f,
+		0.455817014f, -0.890651405f, 0.436269015f, 1.68842542f, -0.690491676f, -1.0f, 0.99938935f,
+		0.555654883f, -1.09004462f, 0.535824835f, 1.68842542f, -0.690491676f, -1.0f, 0.99938935f,
+		0.655492783f, -1.28943789f, 0.635380685f, 1.68842542f, -0.690491676f, -1.0f, 0.99938935f,
+		0.755330622f, -1.48883128f, 0.734936535f, 1.68842542f, -0.690491676f, -1.0f, 0.99938935f,
+		0.855168521f, -1.68822455f, 0.834492385f, 1.68842542f, -0.690491676f, -1.0f, 0.99938935f,
+		0.0635639206f, -0.105673596f, 0.0435367636f, 1.68901646f, -0.691073179f, -1.0f, 0.999389648f,
+		0.162650689f, -0.303566128f, 0.142342955f, 1.68901646f, -0.691073179f, -1.0f, 0.999389648f,
+		0.261737466f, -0.501458645f, 0.241149142f, 1.68901646f, -0.691073179f, -1.0f, 0.999389648f,
+		0.360824257f, -0.699351192f, 0.33995533f, 1.68901646f, -0.691073179f, -1.0f, 0.999389648f,
+		0.459911019f, -0.897243738f, 0.438761503f, 1.68901646f, -0.691073179f, -1.0f, 0.999389648f,
+		0.55899781f, -1.09513628f, 0.537567675f, 1.68901646f, -0.691073179f, -1.0f, 0.999389648f,
+		0.658084571f, -1.29302883f, 0.636373878f, 1.68901646f, -0.691073179f, -1.0f, 0.999389648f,
+		0.757171333f, -1.49092126f, 0.73518008f, 1.68901646f, -0.691073179f, -1.0f, 0.999389648f,
+		0.856258094f, -1.68881381f, 0.833986282f, 1.68901646f, -0.691073179f, -1.0f, 0.999389648f,
+	},
+	// Twin Reverb
+	{
+		0.00336459535f, 0.00129445072f, -0.00207014475f, 1.40900481f, -0.431569129f, -1.0f, 0.998583913f,
+		0.0937851444f, -0.176113069f, 0.0849221125f, 1.40900481f, -0.431569129f, -1.0f, 0.998583913f,
+		0.184205696f, -0.353520602f, 0.171914369f, 1.40900481f, -0.431569129f, -1.0f, 0.998583913f,
+		0.274626255f, -0.530928135f, 0.258906633f, 1.40900481f, -0.431569129f, -1.0f, 0.998583913f,
+		0.365046799f, -0.708335638f, 0.345898896f, 1.40900481f, -0.431569129f, -1.0f, 0.998583913f,
+		0.455467343f, -0.885743141f, 0.43289116f, 1.40900481f, -0.431569129f, -1.0f, 0.998583913f,
+		0.545887887f, -1.06315064f, 0.519883394f, 1.40900481f, -0.431569129f, -1.0f, 0.998583913f,
+		0.636308432f, -1.24055827f, 0.606875658f, 1.40900481f, -0.431569129f, -1.0f, 0.998583913f,
+		0.726728976f, -1.41796577f, 0.693867922f, 1.40900481f, -0.431569129f, -1.0f, 0.998583913f,
+		0.0191310085f, -0.0230017211f, 0.00668854406f, 1.4083364f, -0.432271719f, -1.0f, 0.998592019f,
+		0.108121142f, -0.197360635f, 0.092062898f, 1.4083364f, -0.432271719f, -1.0f, 0.998592019f,
+		0.197111264f, -0.371719539f, 0.177437246f, 1.4083364f, -0.432271719f, -1.0f, 0.998592019f,
+		0.286101401f, -0.546078444f, 0.262811601f, 1.4083364f, -0.432271719f, -1.0f, 0.998592019f,
+		0.375091523f, -0.720437348f, 0.348185956f, 1.4083364f, -0.432271719f, -1.0f, 0.998592019f,
+		0.464081645f, -0.894796252f, 0.433560312f, 1.4083364f, -0.432271719f, -1.0f, 0.998592019f,
+		0.553071797f, -1.06915522f, 0.518934667f, 1.4083364f, -0.432271719f, -1.0f, 0.998592019f,
+		0.642061949f, -1.24351406f, 0.604309022f, 1.4083364f, -0.432271719f, -1.0f, 0.998592019f,
+		0.731052041f, -1.41787302f, 0.689683378f, 1.4083364f, -0.432271719f, -1.0f, 0.998592019f,
+		0.0344056375f, -0.046443712f, 0.0151187116f, 1.40718675f, -0.432713777f, -1.0f, 0.998600125f,
+		0.122009963f, -0.2178123f, 0.0988888815f, 1.40718675f, -0.432713777f, -1.0f, 0.998600125f,
+		0.209614292f, -0.389180899f, 0.18265906f, 1.40718675f, -0.432713777f, -1.0f, 0.998600125f,
+		0.297218621f, -0.560549498f, 0.266429216f, 1.40718675f, -0.432713777f, -1.0f, 0.998600125f,
+		0.384822935f, -0.731918037f, 0.350199401f, 1.40718675f, -0.432713777f, -1.0f, 0.998600125f,
+		0.472427279f, -0.903286636f, 0.433969557f, 1.40718675f, -0.432713777f, -1.0f, 0.998600125f,
+		0.560031593f, -1.07465518f, 0.517739713f, 1.40718675f, -0.432713777f, -1.0f, 0.998600125f,
+		0.647635937f, -1.24602377f, 0.601509929f, 1.40718675f, -0.432713777f, -1.0f, 0.998600125f,
+		0.735240281f, -1.41739237f, 0.685280085f, 1.40718675f, -0.432713777f, -1.0f, 0.998600125f,
+		0.0492109694f, -0.0690468028f, 0.0232217275f, 1.40545404f, -0.432848334f, -1.0f, 0.998608112f,
+		0.135472074f, -0.237471625f, 0.105391756f, 1.40545404f, -0.432848334f, -1.0f, 0.998608112f,
+		0.221733168f, -0.405896455f, 0.18756178f, 1.40545404f, -0.432848334f, -1.0f, 0.998608112f,
+		0.307994276f, -0.57432127f, 0.26973182f, 1.40545404f, -0.432848334f, -1.0f, 0.998608112f,
+		0.39425537f, -0.742746115f, 0.351901829f, 1.40545404f, -0.432848334f, -1.0f, 0.998608112f,
+		0.480516464f, -0.9111709f, 0.434071869f, 1.40545404f, -0.432848334f, -1.0f, 0.998608112f,
+		0.566777587f, -1.07959569f, 0.516241908f, 1.40545404f, -0.432848334f, -1.0f, 0.998608112f,
+		0.653038681f, -1.24802053f, 0.598411918f, 1.40545404f, -0.432848334f, -1.0f, 0.998608112f,
+		0.739299774f, -1.41644537f, 0.680581927f, 1.40545404f, -0.432848334f, -1.0f, 0.998608112f,
+		0.0635680705f, -0.0908167064f, 0.0309939329f, 1.40299797f, -0.432610154f, -1.0f, 0.998616099f,
+		0.148526609f, -0.256330013f, 0.111555487f, 1.40299797f, -0.432610154f, -1.0f, 0.998616099f,
+		0.233485162f, -0.42184335f, 0.19211705f, 1.40299797f, -0.432610154f, -1.0f, 0.998616099f,
+		0.318443686f, -0.587356687f, 0.272678584f, 1.40299797f, -0.432610154f, -1.0f, 0.998616099f,
+		0.403402239f, -0.752869964f, 0.353240162f, 1.40299797f, -0.432610154f, -1.0f, 0.998616099f,
+		0.488360792f, -0.9183833f, 0.433801711f, 1.40299797f, -0.432610154f, -1.0f, 0.998616099f,
+		0.573319316f, -1.08389664f, 0.514363289f, 1.40299797f, -0.432610154f, -1.0f, 0.998616099f,
+		0.658277869f, -1.24940991f, 0.594924808f, 1.40299797f, -0.432610154f, -1.0f, 0.998616099f,
+		0.743236423f, -1.41492319f, 0.675486386f, 1.40299797f, -0.432610154f, -1.0f, 0.998616099f,
+		0.0774966851f, -0.111746028f, 0.0384245738f, 1.39962077f, -0.431906462f, -1.0f, 0.998623967f,
+		0.161191538f, -0.274361849f, 0.117352881f, 1.39962077f, -0.431906462f, -1.0f, 0.998623967f,
+		0.244886398f, -0.436977655f, 0.196281195f, 1.39962077f, -0.431906462f, -1.0f, 0.998623967f,
+		0.328581244f, -0.599593461f, 0.275209486f, 1.39962077f, -0.431906462f, -1.0f, 0.998623967f,
+		0.412276119f, -0.762209296f, 0.354137808f, 1.39962077f, -0.431906462f, -1.0f, 0.998623967f,
+		0.495970964f, -0.924825072f, 0.4330661f, 1.39962077f, -0.431906462f, -1.0f, 0.998623967f,
+		0.57966584f, -1.08744097f, 0.511994421f, 1.39962077f, -0.431906462f, -1.0f, 0.998623967f,
+		0.663360655f, -1.25005674f, 0.590922713f, 1.39962077f, -0.431906462f, -1.0f, 0.998623967f,
+		0.747055531f, -1.41267252f, 0.669851005f, 1.39962077f, -0.431906462f, -1.0f, 0.998623967f,
+		0.0910152644f, -0.131808162f, 0.0454923026f, 1.39503479f, -0.430601805f, -1.0f, 0.998631835f,
+		0.17348364f, -0.291515887f, 0.122739702f, 1.39503479f, -0.430601805f, -1.0f, 0.998631835f,
+		0.255952001f, -0.451223612f, 0.199987099f, 1.39503479f, -0.430601805f, -1.0f, 0.998631835f,
+		0.338420391f, -0.610931337f, 0.277234495f, 1.39503479f, -0.430601805f, -1.0f, 0.998631835f,
+		0.420888752f, -0.770639062f, 0.354481876f, 1.39503479f, -0.430601805f, -1.0f, 0.998631835f,
+		0.503357112f, -0.930346727f, 0.431729287f, 1.39503479f, -0.430601805f, -1.0f, 0.998631835f,
+		0.585825503f, -1.09005451f, 0.508976698f, 1.39503479f, -0.430601805f, -1.0f, 0.998631835f,
+		0.668293893f, -1.24976218f, 0.586224079f, 1.39503479f, -0.430601805f, -1.0f, 0.998631835f,
+		0.750762224f, -1.40946996f, 0.66347146f, 1.39503479f, -0.430601805f, -1.0f, 0.998631835f,
+		0.104141019f, -0.150946558f, 0.0521589741f, 1.38880658f, -0.428491324f, -1.0f, 0.998639703f,
+		0.185418546f, -0.307700545f, 0.12764436f, 1.38880658f, -0.428491324f, -1.0f, 0.998639703f,
+		0.266696066f, -0.464454532f, 0.203129753f, 1.38880658f, -0.428491324f, -1.0f, 0.998639703f,
+		0.347973615f, -0.621208489f, 0.278615147f, 1.38880658f, -0.428491324f, -1.0f, 0.998639703f,
+		0.429251134f, -0.777962506f, 0.354100525f, 1.38880658f, -0.428491324f, -1.0f, 0.998639703f,
+		0.510528684f, -0.934716463f, 0.429585904f, 1.38880658f, -0.428491324f, -1.0f, 0.998639703f,
+		0.591806173f, -1.09147048f, 0.505071282f, 1.38880658f, -0.428491324f, -1.0f, 0.998639703f,
+		0.673083723f, -1.2482245f, 0.580556691f, 1.38880658f, -0.428491324f, -1.0f, 0.998639703f,
+		0.754361272f, -1.40497839f, 0.656042039f, 1.38880658f, -0.428491324f, -1.0f, 0.998639703f,
+		0.116889849f, -0.169054538f, 0.0583580956f, 1.38025224f, -0.425251037f, -1.0f, 0.998647451f,
+		0.197010726f, -0.322755963f, 0.131948709f, 1.38025224f, -0.425251037f, -1.0f, 0.998647451f,
+		0.277131617f, -0.476457417f, 0.205539331f, 1.38025224f, -0.425251037f, -1.0f, 0.998647451f,
+		0.357252479f, -0.630158842f, 0.279129952f, 1.38025224f, -0.425251037f, -1.0f, 0.998647451f,
+		0.43737337f, -0.783860266f, 0.352720588f, 1.38025224f, -0.425251037f, -1.0f, 0.998647451f,
+		0.517494261f, -0.937561691f, 0.426311195f, 1.38025224f, -0.425251037f, -1.0f, 0.998647451f,
+		0.597615123f, -1.09126318f, 0.499901831f, 1.38025224f, -0.425251037f, -1.0f, 0.998647451f,
+		0.677735984f, -1.2449646f, 0.573492467f, 1.38025224f, -0.425251037f, -1.0f, 0.998647451f,
+		0.757856905f, -1.39866602f, 0.647083044f, 1.38025224f, -0.425251037f, -1.0f, 0.998647451f,
+		0.00337699056f, 0.00129921956f, -0.00207777112f, 1.416188f, -0.434810281f, -1.0f, 0.998612165f,
+		0.0937964171f, -0.176762387f, 0.0855686888f, 1.416188f, -0.434810281f, -1.0f, 0.998612165f,
+		0.184215844f, -0.354824007f, 0.173215151f, 1.416188f, -0.434810281f, -1.0f, 0.998612165f,
+		0.274635255f, -0.532885611f, 0.260861605f, 1.416188f, -0.434810281f, -1.0f, 0.998612165f,
+		0.365054697f, -0.710947216f, 0.34850806f, 1.416188f, -0.434810281f, -1.0f, 0.998612165f,
+		0.455474108f, -0.88900882f, 0.436154515f, 1.416188f, -0.434810281f, -1.0f, 0.998612165f,
+		0.54589355f, -1.06707048f, 0.523800969f, 1.416188f, -0.434810281f, -1.0f, 0.998612165f,
+		0.636312962f, -1.24513209f, 0.611447453f, 1.416188f, -0.434810281f, -1.0f, 0.998612165f,
+		0.726732373f, -1.42319369f, 0.699093878f, 1.416188f, -0.434810281f, -1.0f, 0.998612165f,
+		0.0191446654f, -0.0231260564f, 0.00675460557f, 1.41647923f, -0.435961843f, -1.0f, 0.998619795f,
+		0.108133554f, -0.198214278f, 0.092858389f, 1.41647923f, -0.435961843f, -1.0f, 0.998619795f,
+		0.197122455f, -0.373302519f, 0.178962171f, 1.41647923f, -0.435961843f, -1.0f, 0.998619795f,
+		0.286111325f, -0.548390746f, 0.265065968f, 1.41647923f, -0.435961843f, -1.0f, 0.998619795f,
+		0.375100225f, -0.723478973f, 0.351169735f, 1.41647923f, -0.435961843f, -1.0f, 0.998619795f,
+		0.464089125f, -0.8985672f, 0.437273532f, 1.41647923f, -0.435961843f, -1.0f, 0.998619795f,
+		0.553077996f, -1.07365549f, 0.523377299f, 1.41647923f, -0.435961843f, -1.0f, 0.998619795f,
+		0.642066896f, -1.24874365f, 0.609481096f, 1.41647923f, -0.435961843f, -1.0f, 0.998619795f,
+		0.731055796f, -1.42383194f, 0.695584893f, 1.41647923f, -0.435961843f, -1.0f, 0.998619795f,
+		0.0344208181f, -0.0467293784f, 0.0152768763f, 1.41649497f, -0.43694973f, -1.0f, 0.998627424f,
+		0.122023769f, -0.218918264f, 0.0998674557f, 1.41649497f, -0.43694973f, -1.0f, 0.998627424f,
+		0.209626719f, -0.391107142f, 0.184458032f, 1.41649497f, -0.43694973f, -1.0f, 0.998627424f,
+		0.297229677f, -0.56329602f, 0.269048601f, 1.41649497f, -0.43694973f, -1.0f, 0.998627424f,
+		0.384832621f, -0.735484898f, 0.353639185f, 1.41649497f, -0.43694973f, -1.0f, 0.998627424f,
+		0.472435564f, -0.907673776f, 0.438229769f, 1.41649497f, -0.43694973f, -1.0f, 0.998627424f,
+		0.560038507f, -1.07986271f, 0.522820354f, 1.41649497f, -0.43694973f, -1.0f, 0.998627424f,
+		0.64764148f, -1.25205159f, 0.607410908f, 1.41649497f, -0.43694973f, -1.0f, 0.998627424f,
+		0.735244393f, -1.42424047f, 0.692001462f, 1.41649497f, -0.43694973f, -1.0f, 0.998627424f,
+		0.0492280163f, -0.0695369393f, 0.0234966483f, 1.41619706f, -0.437757134f, -1.0f, 0.998634994f,
+		0.135487571f, -0.238893554f, 0.106598578f, 1.41619706f, -0.437757134f, -1.0f, 0.998634994f,
+		0.22174713f, -0.408250153f, 0.189700499f, 1.41619706f, -0.437757134f, -1.0f, 0.998634994f,
+		0.308006674f, -0.577606797f, 0.272802442f, 1.41619706f, -0.437757134f, -1.0f, 0.998634994f,
+		0.394266248f, -0.746963382f, 0.355904371f, 1.41619706f, -0.437757134f, -1.0f, 0.998634994f,
+		0.480525792f, -0.916320026f, 0.439006299f, 1.41619706f, -0.437757134f, -1.0f, 0.998634994f,
+		0.566785336f, -1.08567667f, 0.522108197f, 1.41619706f, -0.437757134f, -1.0f, 0.998634994f,
+		0.653044879f, -1.25503325f, 0.605210125f, 1.41619706f, -0.437757134f, -1.0f, 0.998634994f,
+		0.739304483f, -1.42438984f, 0.688312054f, 1.41619706f, -0.437757134f, -1.0f, 0.998634994f,
+		0.0635874346f, -0.0915701762f, 0.0314192586f, 1.41553617f, -0.438361615f, -1.0f, 0.998642504f,
+		0.148544222f, -0.258154094f, 0.113051526f, 1.41553617f, -0.438361615f, -1.0f, 0.998642504f,
+		0.233501002f, -0.42473802f, 0.19468379f, 1.41553617f, -0.438361615f, -1.0f, 0.998642504f,
+		0.318457782f, -0.591321945f, 0.276316077f, 1.41553617f, -0.438361615f, -1.0f, 0.998642504f,
+		0.403414577f, -0.7579059f, 0.357948333f, 1.41553617f, -0.438361615f, -1.0f, 0.998642504f,
+		0.488371372f, -0.924489796f, 0.43958059f, 1.41553617f, -0.438361615f, -1.0f, 0.998642504f,
+		0.573328137f, -1.09107375f, 0.521212876f, 1.41553617f, -0.438361615f, -1.0f, 0.998642504f,
+		0.658284903f, -1.25765765f, 0.602845132f, 1.41553617f, -0.438361615f, -1.0f, 0.998642504f,
+		0.743241727f, -1.42424154f, 0.684477389f, 1.41553617f, -0.438361615f, -1.0f, 0.998642504f,
+		0.0775189847f, -0.112844996f, 0.0390472785f, 1.41444683f, -0.43873319f, -1.0f, 0.998650014f,
+		0.161211818f, -0.27670747f, 0.119222343f, 1.41444683f, -0.43873319f, -1.0f, 0.998650014f,
+		0.244904652f, -0.440569937f, 0.1993974f, 1.41444683f, -0.43873319f, -1.0f, 0.998650014f,
+		0.328597486f, -0.604432404f, 0.279572457f, 1.41444683f, -0.43873319f, -1.0f, 0.998650014f,
+		0.412290305f, -0.768294871f, 0.359747529f, 1.41444683f, -0.43873319f, -1.0f, 0.998650014f,
+		0.495983154f, -0.932157338f, 0.439922571f, 1.41444683f, -0.43873319f, -1.0f, 0.998650014f,
+		0.579675972f, -1.09601986f, 0.520097673f, 1.41444683f, -0.43873319f, -1.0f, 0.998650014f,
+		0.663368821f, -1.25988233f, 0.600272715f, 1.41444683f, -0.43873319f, -1.0f, 0.998650014f,
+		0.74706167f, -1.4237448f, 0.680447757f, 1.41444683f, -0.43873319f, -1.0f, 0.998650014f,
+		0.0910413638f, -0.133370474f, 0.0463797599f, 1.41284215f, -0.4388313f, -1.0f, 0.998657465f,
+		0.173507363f, -0.294553071f, 0.125102118f, 1.41284215f, -0.4388313f, -1.0f, 0.998657465f,
+		0.255973369f, -0.455735654f, 0.203824461f, 1.41284215f, -0.4388313f, -1.0f, 0.998657465f,
+		0.338439375f, -0.616918206f, 0.282546818f, 1.41284215f, -0.4388313f, -1.0f, 0.998657465f,
+		0.420905381f, -0.778100789f, 0.361269176f, 1.41284215f, -0.4388313f, -1.0f, 0.998657465f,
+		0.503371418f, -0.939283371f, 0.439991534f, 1.41284215f, -0.4388313f, -1.0f, 0.998657465f,
+		0.585837364f, -1.10046601f, 0.518713892f, 1.41284215f, -0.4388313f, -1.0f, 0.998657465f,
+		0.66830337f, -1.26164854f, 0.597436249f, 1.41284215f, -0.4388313f, -1.0f, 0.998657465f,
+		0.750769377f, -1.42283118f, 0.676158607f, 1.41284215f, -0.4388313f, -1.0f, 0.998657465f,
+		0.104172155f, -0.153146833f, 0.053411033f, 1.4106034f, -0.438600212f, -1.0f, 0.998664856f,
+		0.185446858f, -0.311679453f, 0.130675137f, 1.4106034f, -0.438600212f, -1.0f, 0.998664856f,
+		0.266721576f, -0.470212102f, 0.207939252f, 1.4106034f, -0.438600212f, -1.0f, 0.998664856f,
+		0.347996265f, -0.628744721f, 0.285203367f, 1.4106034f, -0.438600212f, -1.0f, 0.998664856f,
+		0.429270983f, -0.787277341f, 0.362467468f, 1.4106034f, -0.438600212f, -1.0f, 0.998664856f,
+		0.510545671f, -0.94580996f, 0.439731598f, 1.4106034f, -0.438600212f, -1.0f, 0.998664856f,
+		0.591820359f, -1.10434258f, 0.516995728f, 1.4106034f, -0.438600212f, -1.0f, 0.998664856f,
+		0.673095107f, -1.2628752f, 0.594259799f, 1.4106034f, -0.438600212f, -1.0f, 0.998664856f,
+		0.754369795f, -1.42140782f, 0.671523929f, 1.4106034f, -0.438600212f, -1.0f, 0.998664856f,
+		0.116927892f, -0.172162145f, 0.060128808f, 1.40756619f, -0.437962055f, -1.0f, 0.998672247f,
+		0.197045326f, -0.328060061f, 0.13591598f, 1.40756619f, -0.437962055f, -1.0f, 0.998672247f,
+		0.27716276f, -0.483958006f, 0.211703166f, 1.40756619f, -0.437962055f, -1.0f, 0.998672247f,
+		0.357280195f, -0.639855921f, 0.287490338f, 1.40756619f, -0.437962055f, -1.0f, 0.998672247f,
+		0.437397599f, -0.795753896f, 0.363277525f, 1.40756619f, -0.437962055f, -1.0f, 0.998672247f,
+		0.517515063f, -0.951651812f, 0.439064711f, 1.40756619f, -0.437962055f, -1.0f, 0.998672247f,
+		0.597632468f, -1.10754979f, 0.514851868f, 1.40756619f, -0.437962055f, -1.0f, 0.998672247f,
+		0.677749872f, -1.26344764f, 0.590639055f, 1.40756619f, -0.437962055f, -1.0f, 0.998672247f,
+		0.757867336f, -1.41934562f, 0.666426241f, 1.40756619f, -0.437962055f, -1.0f, 0.998672247f,
+		0.00338885654f, 0.00130378467f, -0.00208507199f, 1.42304981f, -0.437906384f, -1.0f, 0.998653948f,
+		0.0938072056f, -0.177383989f, 0.0861876532f, 1.42304981f, -0.437906384f, -1.0f, 0.998653948f,
+		0.184225559f, -0.35607174f, 0.174460381f, 1.42304981f, -0.437906384f, -1.0f, 0.998653948f,
+		0.274643898f, -0.534759521f, 0.262733102f, 1.42304981f, -0.437906384f, -1.0f, 0.998653948f,
+		0.365062267f, -0.713447273f, 0.351005822f, 1.42304981f, -0.437906384f, -1.0f, 0.998653948f,
+		0.455480605f, -0.892135024f, 0.439278573f, 1.42304981f, -0.437906384f, -1.0f, 0.998653948f,
+		0.545898974f, -1.07082283f, 0.527551293f, 1.42304981f, -0.437906384f, -1.0f, 0.998653948f,
+		0.636317313f, -1.24951065f, 0.615823984f, 1.42304981f, -0.437906384f, -1.0f, 0.998653948f,
+		0.726735651f, -1.42819834f, 0.704096735f, 1.42304981f, -0.437906384f, -1.0f, 0.998653948f,
+		0.0191573966f, -0.0232419763f, 0.00681619626f, 1.42405558f, -0.439395279f, -1.0f, 0.998660922f,
+		0.108145133f, -0.199010164f, 0.0936000422f, 1.42405558f, -0.439395279f, -1.0f, 0.998660922f,
+		0.197132871f, -0.37477836f, 0.180383891f, 1.42405558f, -0.439395279f, -1.0f, 0.998660922f,
+		0.286120594f, -0.550546527f, 0.267167747f, 1.42405558f, -0.439395279f, -1.0f, 0.998660922f,
+		0.375108331f, -0.726314723f, 0.353951603f, 1.42405558f, -0.439395279f, -1.0f, 0.998660922f,
+		0.464096069f, -0.90208292f, 0.44073543f, 1.42405558f, -0.439395279f, -1.0f, 0.998660922f,
+		0.553083837f, -1.07785106f, 0.527519286f, 1.42405558f, -0.439395279f, -1.0f, 0.998660922f,
+		0.642071545f, -1.25361931f, 0.614303112f, 1.42405558f, -0.439395279f, -1.0f, 0.998660922f,
+		0.731059313f, -1.42938745f, 0.701086998f, 1.42405558f, -0.439395279f, -1.0f, 0.998660922f,
+		0.034434557f, -0.0469879173f, 0.0154200224f, 1.42490339f, -0.440776259f, -1.0f, 0.998667896f,
+		0.122036263f, -0.219919205f, 0.100753099f, 1.42490339f, -0.440776259f, -1.0f, 0.998667896f,
+		0.20963797f, -0.392850488f, 0.186086178f, 1.42490339f, -0.440776259f, -1.0f, 0.998667896f,
+		0.297239661f, -0.565781772f, 0.271419257f, 1.42490339f, -0.440776259f, -1.0f, 0.998667896f,
+		0.384841383f, -0.738713026f, 0.356752336f, 1.42490339f, -0.440776259f, -1.0f, 0.998667896f,
+		0.472443074f, -0.91164434f, 0.442085415f, 1.42490339f, -0.440776259f, -1.0f, 0.998667896f,
+		0.560044765f, -1.08457565f, 0.527418494f, 1.42490339f, -0.440776259f, -1.0f, 0.998667896f,
+		0.647646487f, -1.25750685f, 0.612751544f, 1.42490339f, -0.440776259f, -1.0f, 0.998667896f,
+		0.735248208f, -1.43043816f, 0.698084652f, 1.42490339f, -0.440776259f, -1.0f, 0.998667896f,
+		0.0492429323f, -0.0699658841f, 0.023737248f, 1.42558265f, -0.442045629f, -1.0f, 0.99867487f,
+		0.135501131f, -0.240137964f, 0.107654735f, 1.42558265f, -0.442045629f, -1.0f, 0.99867487f,
+		0.221759334f, -0.41031003f, 0.191572219f, 1.42558265f, -0.442045629f, -1.0f, 0.99867487f,
+		0.308017552f, -0.580482125f, 0.275489718f, 1.42558265f, -0.442045629f, -1.0f, 0.99867487f,
+		0.394275725f, -0.750654221f, 0.359407187f, 1.42558265f, -0.442045629f, -1.0f, 0.99867487f,
+		0.480533928f, -0.920826256f, 0.443324685f, 1.42558265f, -0.442045629f, -1.0f, 0.99867487f,
+		0.56679213f, -1.09099841f, 0.527242184f, 1.42558265f, -0.442045629f, -1.0f, 0.99867487f,
+		0.653050363f, -1.26117039f, 0.611159682f, 1.42558265f, -0.442045629f, -1.0f, 0.99867487f,
+		0.739308536f, -1.43134248f, 0.695077121f, 1.42558265f, -0.442045629f, -1.0f, 0.99867487f,
+		0.0636037439f, -0.0922048017f, 0.0317774974f, 1.42607975f, -0.443198144f, -1.0f, 0.998681784f,
+		0.148559049f, -0.259690464f, 0.114311598f, 1.42607975f, -0.443198144f, -1.0f, 0.998681784f,
+		0.233514354f, -0.427176148f, 0.196845695f, 1.42607975f, -0.443198144f, -1.0f, 0.998681784f,
+		0.318469673f, -0.594661832f, 0.279379785f, 1.42607975f, -0.443198144f, -1.0f, 0.998681784f,
+		0.403424978f, -0.762147486f, 0.36191389f, 1.42607975f, -0.443198144f, -1.0f, 0.998681784f,
+		0.488380283f, -0.929633141f, 0.444447994f, 1.42607975f, -0.443198144f, -1.0f, 0.998681784f,
+		0.573335588f, -1.09711885f, 0.526982069f, 1.42607975f, -0.443198144f, -1.0f, 0.998681784f,
+		0.658290863f, -1.26460445f, 0.609516203f, 1.42607975f, -0.443198144f, -1.0f, 0.998681784f,
+		0.743246198f, -1.43209016f, 0.692050278f, 1.42607975f, -0.443198144f, -1.0f, 0.998681784f,
+		0.0775369555f, -0.113730662f, 0.039549116f, 1.42637765f, -0.444226801f, -1.0f, 0.998688638f,
+		0.16122815f, -0.278597802f, 0.12072894f, 1.42637765f, -0.444226801f, -1.0f, 0.998688638f,
+		0.24491936f, -0.443464965f, 0.201908767f, 1.42637765f, -0.444226801f, -1.0f, 0.998688638f,
+		0.328610569f, -0.608332157f, 0.283088595f, 1.42637765f, -0.444226801f, -1.0f, 0.998688638f,
+		0.412301779f, -0.77319926f, 0.364268422f, 1.42637765f, -0.444226801f, -1.0f, 0.998688638f,
+		0.495992959f, -0.938066423f, 0.44544825f, 1.42637765f, -0.444226801f, -1.0f, 0.998688638f,
+		0.579684198f, -1.10293365f, 0.526628077f, 1.42637765f, -0.444226801f, -1.0f, 0.998688638f,
+		0.663375378f, -1.26780081f, 0.607807875f, 1.42637765f, -0.444226801f, -1.0f, 0.998688638f,
+		0.747066557f, -1.43266797f, 0.688987732f, 1.42637765f, -0.444226801f, -1.0f, 0.998688638f,
+		0.0910613388f, -0.134566382f, 0.0470590815f, 1.42645466f, -0.445122242f, -1.0f, 0.998695493f,
+		0.173525527f, -0.29687795f, 0.126910478f, 1.42645466f, -0.445122242f, -1.0f, 0.998695493f,
+		0.25598973f, -0.459189504f, 0.206761867f, 1.42645466f, -0.445122242f, -1.0f, 0.998695493f,
+		0.338453919f, -0.621501029f, 0.286613256f, 1.42645466f, -0.445122242f, -1.0f, 0.998695493f,
+		0.420918107f, -0.783812582f, 0.366464645f, 1.42645466f, -0.445122242f, -1.0f, 0.998695493f,
+		0.503382325f, -0.946124136f, 0.446316034f, 1.42645466f, -0.445122242f, -1.0f, 0.998695493f,
+		0.585846484f, -1.10843575f, 0.526167452f, 1.42645466f, -0.445122242f, -1.0f, 0.998695493f,
+		0.668310702f, -1.2707473f, 0.606018841f, 1.42645466f, -0.445122242f, -1.0f, 0.998695493f,
+		0.75077486f, -1.43305886f, 0.68587023f, 1.42645466f, -0.445122242f, -1.0f, 0.998695493f,
+		0.104194582f, -0.154731587f, 0.0543128327f, 1.42628336f, -0.445872247f, -1.0f, 0.998702288f,
+		0.185467258f, -0.314545304f, 0.132858083f, 1.42628336f, -0.445872247f, -1.0f, 0.998702288f,
+		0.266739935f, -0.474359006f, 0.21140334f, 1.42628336f, -0.445872247f, -1.0f, 0.998702288f,
+		0.348012596f, -0.634172738f, 0.289948583f, 1.42628336f, -0.445872247f, -1.0f, 0.998702288f,
+		0.429285258f, -0.79398644f, 0.368493825f, 1.42628336f, -0.445872247f, -1.0f, 0.998702288f,
+		0.51055795f, -0.953800142f, 0.447039098f, 1.42628336f, -0.445872247f, -1.0f, 0.998702288f,
+		0.591830611f, -1.11361384f, 0.52558434f, 1.42628336f, -0.445872247f, -1.0f, 0.998702288f,
+		0.673103273f, -1.27342761f, 0.604129612f, 1.42628336f, -0.445872247f, -1.0f, 0.998702288f,
+		0.754375935f, -1.43324125f, 0.682674825f, 1.42628336f, -0.445872247f, -1.0f, 0.998702288f,
+		0.116953366f, -0.174242228f, 0.0613140389f, 1.4258287f, -0.446460813f, -1.0f, 0.998709083f,
+		0.197068483f, -0.331610382f, 0.138571501f, 1.4258287f, -0.446460813f, -1.0f, 0.998709083f,
+		0.277183592f, -0.488978565f, 0.215828955f, 1.4258287f, -0.446460813f, -1.0f, 0.998709083f,
+		0.357298732f, -0.646346748f, 0.29308641f, 1.4258287f, -0.446460813f, -1.0f, 0.998709083f,
+		0.437413841f, -0.803714871f, 0.370343864f, 1.4258287f, -0.446460813f, -1.0f, 0.998709083f,
+		0.517528951f, -0.961083055f, 0.447601318f, 1.4258287f, -0.446460813f, -1.0f, 0.998709083f,
+		0.597644091f, -1.11845124f, 0.524858773f, 1.4258287f, -0.446460813f, -1.0f, 0.998709083f,
+		0.677759171f, -1.27581942f, 0.602116227f, 1.4258287f, -0.446460813f, -1.0f, 0.998709083f,
+		0.75787431f, -1.4331876f, 0.679373682f, 1.4258287f, -0.446460813f, -1.0f, 0.998709083f,
+		0.00339928991f, 0.00130779867f, -0.00209149136f, 1.42905927f, -0.440617919f, -1.0f, 0.998714685f,
+		0.0938166901f, -0.177930534f, 0.0867318958f, 1.42905927f, -0.440617919f, -1.0f, 0.998714685f,
+		0.184234098f, -0.357168853f, 0.175555289f, 1.42905927f, -0.440617919f, -1.0f, 0.998714685f,
+		0.274651498f, -0.536407173f, 0.264378667f, 1.42905927f, -0.440617919f, -1.0f, 0.998714685f,
+		0.365068913f, -0.715645552f, 0.353202045f, 1.42905927f, -0.440617919f, -1.0f, 0.998714685f,
+		0.455486298f, -0.894883871f, 0.442025453f, 1.42905927f, -0.440617919f, -1.0f, 0.998714685f,
+		0.545903683f, -1.07412219f, 0.530848801f, 1.42905927f, -0.440617919f, -1.0f, 0.998714685f,
+		0.636321127f, -1.25336051f, 0.619672239f, 1.42905927f, -0.440617919f, -1.0f, 0.998714685f,
+		0.726738513f, -1.43259883f, 0.708495617f, 1.42905927f, -0.440617919f, -1.0f, 0.998714685f,
+		0.0191683248f, -0.0233414806f, 0.00686906604f, 1.43053472f, -0.442331493f, -1.0f, 0.998720765f,
+		0.108155072f, -0.199693352f, 0.0942366868f, 1.43053472f, -0.442331493f, -1.0f, 0.998720765f,
+		0.197141811f, -0.376045227f, 0.181604311f, 1.43053472f, -0.442331493f, -1.0f, 0.998720765f,
+		0.286128551f, -0.552397072f, 0.26897192f, 1.43053472f, -0.442331493f, -1.0f, 0.998720765f,
+		0.375115305f, -0.728748977f, 0.356339544f, 1.43053472f, -0.442331493f, -1.0f, 0.998720765f,
+		0.46410206f, -0.905100822f, 0.443707168f, 1.43053472f, -0.442331493f, -1.0f, 0.998720765f,
+		0.553088784f, -1.08145273f, 0.531074762f, 1.43053472f, -0.442331493f, -1.0f, 0.998720765f,
+		0.642075539f, -1.25780451f, 0.618442416f, 1.43053472f, -0.442331493f, -1.0f, 0.998720765f,
+		0.731062293f, -1.43415642f, 0.70581001f, 1.43053472f, -0.442331493f, -1.0f, 0.998720765f,
+		0.0344460458f, -0.0472040996f, 0.015539716f, 1.43190908f, -0.443964481f, -1.0f, 0.998726904f,
+		0.122046709f, -0.220756143f, 0.101493642f, 1.43190908f, -0.443964481f, -1.0f, 0.998726904f,
+		0.209647372f, -0.394308209f, 0.187447563f, 1.43190908f, -0.443964481f, -1.0f, 0.998726904f,
+		0.297248036f, -0.567860246f, 0.273401499f, 1.43190908f, -0.443964481f, -1.0f, 0.998726904f,
+		0.384848684f, -0.741412282f, 0.35935542f, 1.43190908f, -0.443964481f, -1.0f, 0.998726904f,
+		0.472449362f, -0.914964318f, 0.445309341f, 1.43190908f, -0.443964481f, -1.0f, 0.998726904f,
+		0.560050011f, -1.08851635f, 0.531263292f, 1.43190908f, -0.443964481f, -1.0f, 0.998726904f,
+		0.647650659f, -1.26206839f, 0.617217183f, 1.43190908f, -0.443964481f, -1.0f, 0.998726904f,
+		0.735251307f, -1.43562055f, 0.703171134f, 1.43190908f, -0.443964481f, -1.0f, 0.998726904f,
+		0.0492550507f, -0.0703143477f, 0.0239327103f, 1.43318152f, -0.445517838f, -1.0f, 0.998732984f,
+		0.135512158f, -0.241148904f, 0.108512744f, 1.43318152f, -0.445517838f, -1.0f, 0.998732984f,
+		0.221769258f, -0.41198346f, 0.193092778f, 1.43318152f, -0.445517838f, -1.0f, 0.998732984f,
+		0.308026344f, -0.582818031f, 0.277672827f, 1.43318152f, -0.445517838f, -1.0f, 0.998732984f,
+		0.394283473f, -0.753652573f, 0.362252861f, 1.43318152f, -0.445517838f, -1.0f, 0.998732984f,
+		0.480540574f, -0.924487114f, 0.446832895f, 1.43318152f, -0.445517838f, -1.0f, 0.998732984f,
+		0.566797674f, -1.09532166f, 0.531412959f, 1.43318152f, -0.445517838f, -1.0f, 0.998732984f,
+		0.653054774f, -1.2661562f, 0.615992963f, 1.43318152f, -0.445517838f, -1.0f, 0.998732984f,
+		0.739311874f, -1.43699074f, 0.700573027f, 1.43318152f, -0.445517838f, -1.0f, 0.998732984f,
+		0.0636165813f, -0.0927042067f, 0.032059405f, 1.43435037f, -0.446992069f, -1.0f, 0.998739004f,
+		0.148570716f, -0.260899484f, 0.115303181f, 1.43435037f, -0.446992069f, -1.0f, 0.998739004f,
+		0.233524859f, -0.429094762f, 0.198546961f, 1.43435037f, -0.446992069f, -1.0f, 0.998739004f,
+		0.318479002f, -0.597290039f, 0.281790733f, 1.43435037f, -0.446992069f, -1.0f, 0.998739004f,
+		0.403433144f, -0.765485346f, 0.365034521f, 1.43435037f, -0.446992069f, -1.0f, 0.998739004f,
+		0.488387287f, -0.933680594f, 0.448278278f, 1.43435037f, -0.446992069f, -1.0f, 0.998739004f,
+		0.573341429f, -1.1018759f, 0.531522036f, 1.43435037f, -0.446992069f, -1.0f, 0.998739004f,
+		0.658295572f, -1.27007115f, 0.614765823f, 1.43435037f, -0.446992069f, -1.0f, 0.998739004f,
+		0.743249714f, -1.4382664f, 0.69800961f, 1.43435037f, -0.446992069f, -1.0f, 0.998739004f,
+		0.0775506049f, -0.114403404f, 0.0399303101f, 1.43541312f, -0.448387235f, -1.0f, 0.998745084f,
+		0.161240563f, -0.280033708f, 0.121873349f, 1.43541312f, -0.448387235f, -1.0f, 0.998745084f,
+		0.244930536f, -0.445664018f, 0.203816384f, 1.43541312f, -0.448387235f, -1.0f, 0.998745084f,
+		0.328620493f, -0.611294329f, 0.285759419f, 1.43541312f, -0.448387235f, -1.0f, 0.998745084f,
+		0.412310451f, -0.77692467f, 0.367702454f, 1.43541312f, -0.448387235f, -1.0f, 0.998745084f,
+		0.496000439f, -0.942554951f, 0.449645519f, 1.43541312f, -0.448387235f, -1.0f, 0.998745084f,
+		0.579690397f, -1.10818529f, 0.531588554f, 1.43541312f, -0.448387235f, -1.0f, 0.998745084f,
+		0.663380384f, -1.27381563f, 0.61353159f, 1.43541312f, -0.448387235f, -1.0f, 0.998745084f,
+		0.747070312f, -1.43944585f, 0.695474625f, 1.43541312f, -0.448387235f, -1.0f, 0.998745084f,
+		0.0910759196f, -0.135439605f, 0.0475551039f, 1.43636644f, -0.449702859f, -1.0f, 0.998751104f,
+		0.173538789f, -0.298575491f, 0.128230885f, 1.43636644f, -0.449702859f, -1.0f, 0.998751104f,
+		0.256001651f, -0.461711407f, 0.20890668f, 1.43636644f, -0.449702859f, -1.0f, 0.998751104f,
+		0.338464528f, -0.624847293f, 0.289582461f, 1.43636644f, -0.449702859f, -1.0f, 0.998751104f,
+		0.420927405f, -0.787983179f, 0.370258242f, 1.43636644f, -0.449702859f, -1.0f, 0.998751104f,
+		0.503390253f, -0.951119065f, 0.450934023f, 1.43636644f, -0.449702859f, -1.0f, 0.998751104f,
+		0.585853159f, -1.11425495f, 0.531609833f, 1.43636644f, -0.449702859f, -1.0f, 0.998751104f,
+		0.668316007f, -1.27739084f, 0.612285614f, 1.43636644f, -0.449702859f, -1.0f, 0.998751104f,
+		0.750778854f, -1.44052684f, 0.692961395f, 1.43636644f, -0.449702859f, -1.0f, 0.998751104f,
+		0.104210243f, -0.1558384f, 0.05494266f, 1.43720591f, -0.450937867f, -1.0f, 0.998757124f,
+		0.185481489f, -0.316546828f, 0.13438268f, 1.43720591f, -0.450937867f, -1.0f, 0.998757124f,
+		0.26675275f, -0.477255285f, 0.213822693f, 1.43720591f, -0.450937867f, -1.0f, 0.998757124f,
+		0.348023981f, -0.637963712f, 0.29326269f, 1.43720591f, -0.450937867f, -1.0f, 0.998757124f,
+		0.429295242f, -0.79867214f, 0.372702718f, 1.43720591f, -0.450937867f, -1.0f, 0.998757124f,
+		0.510566473f, -0.959380567f, 0.452142715f, 1.43720591f, -0.450937867f, -1.0f, 0.998757124f,
+		0.591837704f, -1.12008905f, 0.531582713f, 1.43720591f, -0.450937867f, -1.0f, 0.998757124f,
+		0.673108995f, -1.28079748f, 0.61102277f, 1.43720591f, -0.450937867f, -1.0f, 0.998757124f,
+		0.754380226f, -1.44150591f, 0.690462768f, 1.43720591f, -0.450937867f, -1.0f, 0.998757124f,
+		0.116970271f, -0.175623447f, 0.0621010587f, 1.43792582f, -0.452090472f, -1.0f, 0.998763084f,
+		0.197083861f, -0.333967894f, 0.1403348f, 1.43792582f, -0.452090472f, -1.0f, 0.998763084f,
+		0.27719745f, -0.492312312f, 0.218568563f, 1.43792582f, -0.452090472f, -1.0f, 0.998763084f,
+		0.35731104f, -0.65065676f, 0.296802312f, 1.43792582f, -0.452090472f, -1.0f, 0.998763084f,
+		0.4374246f, -0.809001207f, 0.375036061f, 1.43792582f, -0.452090472f, -1.0f, 0.998763084f,
+		0.51753819f, -0.967345595f, 0.453269809f, 1.43792582f, -0.452090472f, -1.0f, 0.998763084f,
+		0.59765178f, -1.1256901f, 0.531503558f, 1.43792582f, -0.452090472f, -1.0f, 0.998763084f,
+		0.677765369f, -1.28403449f, 0.609737277f, 1.43792582f, -0.452090472f, -1.0f, 0.998763084f,
+		0.757878959f, -1.44237888f, 0.687971056f, 1.43792582f, -0.452090472f, -1.0f, 0.998763084f,
+		0.00340779964f, 0.00131107261f, -0.00209672702f, 1.43392456f, -0.442813247f, -1.0f, 0.998800337f,
+		0.0938244313f, -0.178376317f, 0.0871757939f, 1.43392456f, -0.442813247f, -1.0f, 0.998800337f,
+		0.184241056f, -0.358063698f, 0.176448315f, 1.43392456f, -0.442813247f, -1.0f, 0.998800337f,
+		0.274657696f, -0.537751079f, 0.265720814f, 1.43392456f, -0.442813247f, -1.0f, 0.998800337f,
+		0.365074337f, -0.717438459f, 0.354993343f, 1.43392456f, -0.442813247f, -1.0f, 0.998800337f,
+		0.455490947f, -0.89712584f, 0.444265872f, 1.43392456f, -0.442813247f, -1.0f, 0.998800337f,
+		0.545907557f, -1.07681322f, 0.533538401f, 1.43392456f, -0.442813247f, -1.0f, 0.998800337f,
+		0.636324227f, -1.2565006f, 0.6228109f, 1.43392456f, -0.442813247f, -1.0f, 0.998800337f,
+		0.726740837f, -1.43618798f, 0.712083399f, 1.43392456f, -0.442813247f, -1.0f, 0.998800337f,
+		0.0191770606f, -0.0234210193f, 0.0069113262f, 1.43567705f, -0.444661915f, -1.0f, 0.998805285f,
+		0.108163014f, -0.20023945f, 0.0947455764f, 1.43567705f, -0.444661915f, -1.0f, 0.998805285f,
+		0.197148964f, -0.37705788f, 0.182579815f, 1.43567705f, -0.444661915f, -1.0f, 0.998805285f,
+		0.286134928f, -0.553876281f, 0.270414054f, 1.43567705f, -0.444661915f, -1.0f, 0.998805285f,
+		0.375120878f, -0.730694711f, 0.358248323f, 1.43567705f, -0.444661915f, -1.0f, 0.998805285f,
+		0.464106828f, -0.907513142f, 0.446082562f, 1.43567705f, -0.444661915f, -1.0f, 0.998805285f,
+		0.553092778f, -1.08433151f, 0.533916831f, 1.43567705f, -0.444661915f, -1.0f, 0.998805285f,
+		0.642078698f, -1.26115f, 0.62175107f, 1.43567705f, -0.444661915f, -1.0f, 0.998805285f,
+		0.731064677f, -1.43796837f, 0.709585309f, 1.43567705f, -0.444661915f, -1.0f, 0.998805285f,
+		0.0344550312f, -0.0473732091f, 0.0156333484f, 1.4373523f, -0.446441621f, -1.0f, 0.998810291f,
+		0.122054875f, -0.221410871f, 0.102072954f, 1.4373523f, -0.446441621f, -1.0f, 0.998810291f,
+		0.209654719f, -0.395448536f, 0.188512549f, 1.4373523f, -0.446441621f, -1.0f, 0.998810291f,
+		0.297254562f, -0.569486201f, 0.274952173f, 1.4373523f, -0.446441621f, -1.0f, 0.998810291f,
+		0.384854406f, -0.743523836f, 0.361391753f, 1.4373523f, -0.446441621f, -1.0f, 0.998810291f,
+		0.47245425f, -0.917561531f, 0.447831362f, 1.4373523f, -0.446441621f, -1.0f, 0.998810291f,
+		0.560054123f, -1.09159923f, 0.534270942f, 1.4373523f, -0.446441621f, -1.0f, 0.998810291f,
+		0.647653937f, -1.2656368f, 0.620710552f, 1.4373523f, -0.446441621f, -1.0f, 0.998810291f,
+		0.735253811f, -1.4396745f, 0.707150161f, 1.4373523f, -0.446441621f, -1.0f, 0.998810291f,
+		0.0492643155f, -0.0705807209f, 0.0240821224f, 1.43895233f, -0.448154747f, -1.0f, 0.998815238f,
+		0.135520577f, -0.241921678f, 0.109168619f, 1.43895233f, -0.448154747f, -1.0f, 0.998815238f,
+		0.221776843f, -0.413262635f, 0.194255114f, 1.43895233f, -0.448154747f, -1.0f, 0.998815238f,
+		0.308033109f, -0.584603608f, 0.279341608f, 1.43895233f, -0.448154747f, -1.0f, 0.998815238f,
+		0.394289374f, -0.75594455f, 0.364428103f, 1.43895233f, -0.448154747f, -1.0f, 0.998815238f,
+		0.48054561f, -0.927285492f, 0.449514598f, 1.43895233f, -0.448154747f, -1.0f, 0.998815238f,
+		0.566801906f, -1.09862649f, 0.534601092f, 1.43895233f, -0.448154747f, -1.0f, 0.998815238f,
+		0.653058171f, -1.26996744f, 0.619687617f, 1.43895233f, -0.448154747f, -1.0f, 0.998815238f,
+		0.739314437f, -1.44130838f, 0.704774082f, 1.43895233f, -0.448154747f, -1.0f, 0.998815238f,
+		0.0636261478f, -0.0930765867f, 0.0322696157f, 1.44047892f, -0.449803442f, -1.0f, 0.998820245f,
+		0.148579419f, -0.261801004f, 0.116042569f, 1.44047892f, -0.449803442f, -1.0f, 0.998820245f,
+		0.233532697f, -0.430525392f, 0.199815527f, 1.44047892f, -0.449803442f, -1.0f, 0.998820245f,
+		0.318485975f, -0.59924984f, 0.283588469f, 1.44047892f, -0.449803442f, -1.0f, 0.998820245f,
+		0.403439254f, -0.767974198f, 0.367361426f, 1.44047892f, -0.449803442f, -1.0f, 0.998820245f,
+		0.488392502f, -0.936698616f, 0.451134384f, 1.44047892f, -0.449803442f, -1.0f, 0.998820245f,
+		0.57334578f, -1.10542309f, 0.534907341f, 1.44047892f, -0.449803442f, -1.0f, 0.998820245f,
+		0.658299029f, -1.27414739f, 0.618680298f, 1.44047892f, -0.449803442f, -1.0f, 0.998820245f,
+		0.743252337f, -1.44287181f, 0.702453256f, 1.44047892f, -0.449803442f, -1.0f, 0.998820245f,
+		0.0775605142f, -0.114891805f, 0.0402070507f, 1.44193339f, -0.451389641f, -1.0f, 0.998825192f,
+		0.161249578f, -0.281076133f, 0.122704163f, 1.44193339f, -0.451389641f, -1.0f, 0.998825192f,
+		0.244938642f, -0.447260499f, 0.205201283f, 1.44193339f, -0.451389641f, -1.0f, 0.998825192f,
+		0.328627706f, -0.613444805f, 0.287698388f, 1.44193339f, -0.451389641f, -1.0f, 0.998825192f,
+		0.412316769f, -0.779629171f, 0.370195508f, 1.44193339f, -0.451389641f, -1.0f, 0.998825192f,
+		0.496005833f, -0.945813537f, 0.452692628f, 1.44193339f, -0.451389641f, -1.0f, 0.998825192f,
+		0.579694927f, -1.11199784f, 0.535189748f, 1.44193339f, -0.451389641f, -1.0f, 0.998825192f,
+		0.663383961f, -1.27818215f, 0.617686868f, 1.44193339f, -0.451389641f, -1.0f, 0.998825192f,
+		0.747073054f, -1.44436657f, 0.700183928f, 1.44193339f, -0.451389641f, -1.0f, 0.998825192f,
+		0.0910862088f, -0.136055455f, 0.0479049385f, 1.44331706f, -0.452915102f, -1.0f, 0.99883014f,
+		0.173548147f, -0.299772739f, 0.129162148f, 1.44331706f, -0.452915102f, -1.0f, 0.99883014f,
+		0.256010085f, -0.463490039f, 0.210419357f, 1.44331706f, -0.452915102f, -1.0f, 0.99883014f,
+		0.338472009f, -0.627207339f, 0.291676551f, 1.44331706f, -0.452915102f, -1.0f, 0.99883014f,
+		0.420933962f, -0.790924609f, 0.372933775f, 1.44331706f, -0.452915102f, -1.0f, 0.99883014f,
+		0.503395915f, -0.954641879f, 0.454190969f, 1.44331706f, -0.452915102f, -1.0f, 0.99883014f,
+		0.585857809f, -1.11835921f, 0.535448194f, 1.44331706f, -0.452915102f, -1.0f, 0.99883014f,
+		0.668319762f, -1.28207648f, 0.616705418f, 1.44331706f, -0.452915102f, -1.0f, 0.99883014f,
+		0.750781715f, -1.44579375f, 0.697962582f, 1.44331706f, -0.452915102f, -1.0f, 0.99883014f,
+		0.104220949f, -0.156594887f, 0.055373136f, 1.44463062f, -0.454381347f, -1.0f, 0.998835087f,
+		0.185491219f, -0.317914844f, 0.135424703f, 1.44463062f, -0.454381347f, -1.0f, 0.998835087f,
+		0.266761512f, -0.479234815f, 0.21547626f, 1.44463062f, -0.454381347f, -1.0f, 0.998835087f,
+		0.348031789f, -0.640554786f, 0.295527816f, 1.44463062f, -0.454381347f, -1.0f, 0.998835087f,
+		0.429302067f, -0.801874697f, 0.375579387f, 1.44463062f, -0.454381347f, -1.0f, 0.998835087f,
+		0.510572314f, -0.963194668f, 0.455630958f, 1.44463062f, -0.454381347f, -1.0f, 0.998835087f,
+		0.591842592f, -1.1245147f, 0.535682499f, 1.44463062f, -0.454381347f, -1.0f, 0.998835087f,
+		0.673112869f, -1.28583455f, 0.6157341f, 1.44463062f, -0.454381347f, -1.0f, 0.998835087f,
+		0.754383147f, -1.44715452f, 0.695785642f, 1.44463062f, -0.454381347f, -1.0f, 0.998835087f,
+		0.116981447f, -0.17653574f, 0.0626208857f, 1.44587469f, -0.455789685f, -1.0f, 0.998840034f,
+		0.197094008f, -0.335525006f, 0.141499475f, 1.44587469f, -0.455789685f, -1.0f, 0.998840034f,
+		0.2772066f, -0.494514257f, 0.220378071f, 1.44587469f, -0.455789685f, -1.0f, 0.998840034f,
+		0.357319146f, -0.653503537f, 0.299256653f, 1.44587469f, -0.455789685f, -1.0f, 0.998840034f,
+		0.437431723f, -0.812492788f, 0.378135234f, 1.44587469f, -0.455789685f, -1.0f, 0.998840034f,
+		0.51754427f, -0.971482038f, 0.457013845f, 1.44587469f, -0.455789685f, -1.0f, 0.998840034f,
+		0.597656846f, -1.13047135f, 0.535892427f, 1.44587469f, -0.455789685f, -1.0f, 0.998840034f,
+		0.677769423f, -1.28946054f, 0.614771008f, 1.44587469f, -0.455789685f, -1.0f, 0.998840034f,
+		0.757881999f, -1.44844985f, 0.69364959f, 1.44587469f, -0.455789685f, -1.0f, 0.998840034f,
+		0.00341432518f, 0.00131358311f, -0.00210074196f, 1.43760574f, -0.444474339f, -1.0f, 0.998915672f,
+		0.093830362f, -0.17871815f, 0.0875161812f, 1.43760574f, -0.444474339f, -1.0f, 0.998915672f,
+		0.184246406f, -0.358749866f, 0.177133098f, 1.43760574f, -0.444474339f, -1.0f, 0.998915672f,
+		0.274662435f, -0.538781583f, 0.266750008f, 1.43760574f, -0.444474339f, -1.0f, 0.998915672f,
+		0.365078479f, -0.71881336f, 0.356366932f, 1.43760574f, -0.444474339f, -1.0f, 0.998915672f,
+		0.455494523f, -0.898845077f, 0.445983857f, 1.43760574f, -0.444474339f, -1.0f, 0.998915672f,
+		0.545910537f, -1.07887673f, 0.535600781f, 1.43760574f, -0.444474339f, -1.0f, 0.998915672f,
+		0.636326611f, -1.25890851f, 0.625217736f, 1.43760574f, -0.444474339f, -1.0f, 0.998915672f,
+		0.726742625f, -1.43894029f, 0.71483463f, 1.43760574f, -0.444474339f, -1.0f, 0.998915672f,
+		0.0191836543f, -0.0234810505f, 0.00694322214f, 1.43950796f, -0.446398109f, -1.0f, 0.998919308f,
+		0.108169012f, -0.200651601f, 0.0951296538f, 1.43950796f, -0.446398109f, -1.0f, 0.998919308f,
+		0.197154358f, -0.377822161f, 0.183316082f, 1.43950796f, -0.446398109f, -1.0f, 0.998919308f,
+		0.286139727f, -0.554992735f, 0.271502525f, 1.43950796f, -0.446398109f, -1.0f, 0.998919308f,
+		0.37512508f, -0.73216325f, 0.359688938f, 1.43950796f, -0.446398109f, -1.0f, 0.998919308f,
+		0.464110434f, -0.909333825f, 0.447875381f, 1.43950796f, -0.446398109f, -1.0f, 0.998919308f,
+		0.553095758f, -1.08650434f, 0.536061823f, 1.43950796f, -0.446398109f, -1.0f, 0.998919308f,
+		0.642081141f, -1.26367497f, 0.624248266f, 1.43950796f, -0.446398109f, -1.0f, 0.998919308f,
+		0.731066465f, -1.44084549f, 0.712434649f, 1.43950796f, -0.446398109f, -1.0f, 0.998919308f,
+		0.0344617032f, -0.0474987403f, 0.0157028511f, 1.44134188f, -0.448257297f, -1.0f, 0.998923004f,
+		0.12206094f, -0.221896857f, 0.102502964f, 1.44134188f, -0.448257297f, -1.0f, 0.998923004f,
+		0.209660187f, -0.396294981f, 0.18930307f, 1.44134188f, -0.448257297f, -1.0f, 0.998923004f,
+		0.29725942f, -0.570693076f, 0.276103199f, 1.44134188f, -0.448257297f, -1.0f, 0.998923004f,
+		0.384858668f, -0.7450912f, 0.362903297f, 1.44134188f, -0.448257297f, -1.0f, 0.998923004f,
+		0.472457916f, -0.919489324f, 0.449703425f, 1.44134188f, -0.448257297f, -1.0f, 0.998923004f,
+		0.560057163f, -1.09388745f, 0.536503553f, 1.44134188f, -0.448257297f, -1.0f, 0.998923004f,
+		0.647656381f, -1.26828563f, 0.623303652f, 1.44134188f, -0.448257297f, -1.0f, 0.998923004f,
+		0.735255599f, -1.4426837f, 0.71010375f, 1.44134188f, -0.448257297f, -1.0f, 0.998923004f,
+		0.0492710695f, -0.0707750171f, 0.0241911039f, 1.44311023f, -0.450054705f, -1.0f, 0.99892664f,
+		0.135526717f, -0.242485344f, 0.109647021f, 1.44311023f, -0.450054705f, -1.0f, 0.99892664f,
+		0.221782371f, -0.414195687f, 0.19510293f, 1.44311023f, -0.450054705f, -1.0f, 0.99892664f,
+		0.308038026f, -0.585906029f, 0.280558854f, 1.44311023f, -0.450054705f, -1.0f, 0.99892664f,
+		0.394293666f, -0.757616341f, 0.366014749f, 1.44311023f, -0.450054705f, -1.0f, 0.99892664f,
+		0.480549306f, -0.929326653f, 0.451470673f, 1.44311023f, -0.450054705f, -1.0f, 0.99892664f,
+		0.566804945f, -1.10103703f, 0.536926568f, 1.44311023f, -0.450054705f, -1.0f, 0.99892664f,
+		0.653060615f, -1.27274728f, 0.622382522f, 1.44311023f, -0.450054705f, -1.0f, 0.99892664f,
+		0.739316285f, -1.44445765f, 0.707838416f, 1.44311023f, -0.450054705f, -1.0f, 0.99892664f,
+		0.0636330023f, -0.0933432579f, 0.0324201472f, 1.44481575f, -0.451792896f, -1.0f, 0.998930335f,
+		0.148585647f, -0.262446582f, 0.116572052f, 1.44481575f, -0.451792896f, -1.0f, 0.998930335f,
+		0.2335383f, -0.431549907f, 0.200723961f, 1.44481575f, -0.451792896f, -1.0f, 0.998930335f,
+		0.318490952f, -0.600653231f, 0.28487587f, 1.44481575f, -0.451792896f, -1.0f, 0.998930335f,
+		0.403443605f, -0.769756556f, 0.369027764f, 1.44481575f, -0.451792896f, -1.0f, 0.998930335f,
+		0.488396257f, -0.93885988f, 0.453179687f, 1.44481575f, -0.451792896f, -1.0f, 0.998930335f,
+		0.57334888f, -1.1079632f, 0.537331581f, 1.44481575f, -0.451792896f, -1.0f, 0.998930335f,
+		0.658301532f, -1.27706647f, 0.621483505f, 1.44481575f, -0.451792896f, -1.0f, 0.998930335f,
+		0.743254185f, -1.44616985f, 0.705635369f, 1.44481575f, -0.451792896f, -1.0f, 0.998930335f,
+		0.0775674731f, -0.115234837f, 0.0404014178f, 1.44646049f, -0.453474253f, -1.0f, 0.998934031f,
+		0.161255911f, -0.281808317f, 0.123287693f, 1.44646049f, -0.453474253f, -1.0f, 0.998934031f,
+		0.244944349f, -0.448381782f, 0.206173971f, 1.44646049f, -0.453474253f, -1.0f, 0.998934031f,
+		0.328632772f, -0.614955246f, 0.289060235f, 1.44646049f, -0.453474253f, -1.0f, 0.998934031f,
+		0.41232121f, -0.781528711f, 0.371946514f, 1.44646049f, -0.453474253f, -1.0f, 0.998934031f,
+		0.496009648f, -0.948102176f, 0.454832792f, 1.44646049f, -0.453474253f, -1.0f, 0.998934031f,
+		0.579698086f, -1.11467564f, 0.537719071f, 1.44646049f, -0.453474253f, -1.0f, 0.998934031f,
+		0.663386524f, -1.28124917f, 0.62060535f, 1.44646049f, -0.453474253f, -1.0f, 0.998934031f,
+		0.747074962f, -1.44782257f, 0.703491628f, 1.44646049f, -0.453474253f, -1.0f, 0.998934031f,
+		0.0910932869f, -0.136479259f, 0.0481456704f, 1.4480468f, -0.455101043f, -1.0f, 0.998937726f,
+		0.173554584f, -0.300596625f, 0.129802987f, 1.4480468f, -0.455101043f, -1.0f, 0.998937726f,
+		0.256015867f, -0.464713991f, 0.211460292f, 1.4480468f, -0.455101043f, -1.0f, 0.998937726f,
+		0.338477165f, -0.628831327f, 0.293117613f, 1.4480468f, -0.455101043f, -1.0f, 0.998937726f,
+		0.420938462f, -0.792948723f, 0.374774903f, 1.4480468f, -0.455101043f, -1.0f, 0.998937726f,
+		0.50339973f, -0.957066059f, 0.456432223f, 1.4480468f, -0.455101043f, -1.0f, 0.998937726f,
+		0.585861027f, -1.1211834f, 0.538089514f, 1.4480468f, -0.455101043f, -1.0f, 0.998937726f,
+		0.668322325f, -1.28530085f, 0.619746804f, 1.4480468f, -0.455101043f, -1.0f, 0.998937726f,
+		0.750783622f, -1.44941819f, 0.701404154f, 1.4480468f, -0.455101043f, -1.0f, 0.998937726f,
+		0.104228161f, -0.157104313f, 0.0556630269f, 1.44957674f, -0.456675351f, -1.0f, 0.998941481f,
+		0.185497776f, -0.318836093f, 0.136126429f, 1.44957674f, -0.456675351f, -1.0f, 0.998941481f,
+		0.266767412f, -0.480567873f, 0.216589823f, 1.44957674f, -0.456675351f, -1.0f, 0.998941481f,
+		0.348037034f, -0.642299652f, 0.297053218f, 1.44957674f, -0.456675351f, -1.0f, 0.998941481f,
+		0.429306656f, -0.804031432f, 0.377516598f, 1.44957674f, -0.456675351f, -1.0f, 0.998941481f,
+		0.510576248f, -0.965763211f, 0.457980007f, 1.44957674f, -0.456675351f, -1.0f, 0.998941481f,
+		0.59184587f, -1.12749493f, 0.538443387f, 1.44957674f, -0.456675351f, -1.0f, 0.998941481f,
+		0.673115492f, -1.28922677f, 0.618906796f, 1.44957674f, -0.456675351f, -1.0f, 0.998941481f,
+		0.754385114f, -1.45095849f, 0.699370205f, 1.44957674f, -0.456675351f, -1.0f, 0.998941481f,
+		0.116988793f, -0.177136198f, 0.0629630238f, 1.45105195f, -0.458199114f, -1.0f, 0.998945177f,
+		0.197100699f, -0.336549878f, 0.142266035f, 1.45105195f, -0.458199114f, -1.0f, 0.998945177f,
+		0.27721259f, -0.495963544f, 0.221569046f, 1.45105195f, -0.458199114f, -1.0f, 0.998945177f,
+		0.357324511f, -0.655377209f, 0.300872058f, 1.45105195f, -0.458199114f, -1.0f, 0.998945177f,
+		0.437436402f, -0.814790845f, 0.380175084f, 1.45105195f, -0.458199114f, -1.0f, 0.998945177f,
+		0.517548323f, -0.97420454f, 0.45947808f, 1.45105195f, -0.458199114f, -1.0f, 0.998945177f,
+		0.597660244f, -1.13361824f, 0.538781106f, 1.45105195f, -0.458199114f, -1.0f, 0.998945177f,
+		0.677772105f, -1.29303193f, 0.618084133f, 1.45105195f, -0.458199114f, -1.0f, 0.998945177f,
+		0.757884026f, -1.45244551f, 0.697387099f, 1.45105195f, -0.458199114f, -1.0f, 0.998945177f,
+		0.00341909612f, 0.00131541863f, -0.00210367749f, 1.44023669f, -0.445661604f, -1.0f, 0.999060452f,
+		0.0938347057f, -0.178968072f, 0.0877650529f, 1.44023669f, -0.445661604f, -1.0f, 0.999060452f,
+		0.18425031f, -0.359251559f, 0.177633777f, 1.44023669f, -0.445661604f, -1.0f, 0.999060452f,
+		0.274665922f, -0.539535046f, 0.267502517f, 1.44023669f, -0.445661604f, -1.0f, 0.999060452f,
+		0.365081519f, -0.719818532f, 0.357371241f, 1.44023669f, -0.445661604f, -1.0f, 0.999060452f,
+		0.455497116f, -0.900102019f, 0.447239965f, 1.44023669f, -0.445661604f, -1.0f, 0.999060452f,
+		0.545912743f, -1.08038557f, 0.53710866f, 1.44023669f, -0.445661604f, -1.0f, 0.999060452f,
+		0.63632834f, -1.26066899f, 0.626977384f, 1.44023669f, -0.445661604f, -1.0f, 0.999060452f,
+		0.726743937f, -1.44095254f, 0.716846108f, 1.44023669f, -0.445661604f, -1.0f, 0.999060452f,
+		0.019188419f, -0.0235244241f, 0.00696626771f, 1.44221473f, -0.447624892f, -1.0f, 0.999062777f,
+		0.108173341f, -0.200949401f, 0.0954071581f, 1.44221473f, -0.447624892f, -1.0f, 0.999062777f,
+		0.197158262f, -0.378374368f, 0.183848053f, 1.44221473f, -0.447624892f, -1.0f, 0.999062777f,
+		0.286143184f, -0.555799365f, 0.272288948f, 1.44221473f, -0.447624892f, -1.0f, 0.999062777f,
+		0.37512809f, -0.733224332f, 0.360729843f, 1.44221473f, -0.447624892f, -1.0f, 0.999062777f,
+		0.464113027f, -0.9106493f, 0.449170738f, 1.44221473f, -0.447624892f, -1.0f, 0.999062777f,
+		0.553097963f, -1.08807433f, 0.537611604f, 1.44221473f, -0.447624892f, -1.0f, 0.999062777f,
+		0.64208287f, -1.26549923f, 0.626052499f, 1.44221473f, -0.447624892f, -1.0f, 0.999062777f,
+		0.731067777f, -1.44292426f, 0.714493394f, 1.44221473f, -0.447624892f, -1.0f, 0.999062777f,
+		0.0344664641f, -0.0475883335f, 0.0157524571f, 1.44412756f, -0.449525177f, -1.0f, 0.999065161f,
+		0.122065268f, -0.222243726f, 0.102809876f, 1.44412756f, -0.449525177f, -1.0f, 0.999065161f,
+		0.209664077f, -0.396899134f, 0.189867303f, 1.44412756f, -0.449525177f, -1.0f, 0.999065161f,
+		0.297262877f, -0.571554542f, 0.276924729f, 1.44412756f, -0.449525177f, -1.0f, 0.999065161f,
+		0.384861708f, -0.746209919f, 0.363982141f, 1.44412756f, -0.449525177f, -1.0f, 0.999065161f,
+		0.472460508f, -0.920865297f, 0.451039553f, 1.44412756f, -0.449525177f, -1.0f, 0.999065161f,
+		0.560059309f, -1.09552073f, 0.538096964f, 1.44412756f, -0.449525177f, -1.0f, 0.999065161f,
+		0.64765811f, -1.27017605f, 0.625154376f, 1.44412756f, -0.449525177f, -1.0f, 0.999065161f,
+		0.73525691f, -1.44483149f, 0.712211788f, 1.44412756f, -0.449525177f, -1.0f, 0.999065161f,
+		0.0492758341f, -0.0709119514f, 0.0242679082f, 1.44597816f, -0.451365262f, -1.0f, 0.999067545f,
+		0.135531053f, -0.242882594f, 0.109984167f, 1.44597816f, -0.451365262f, -1.0f, 0.999067545f,
+		0.221786261f, -0.414853245f, 0.195700422f, 1.44597816f, -0.451365262f, -1.0f, 0.999067545f,
+		0.308041483f, -0.586823881f, 0.281416684f, 1.44597816f, -0.451365262f, -1.0f, 0.999067545f,
+		0.394296706f, -0.758794546f, 0.367132932f, 1.44597816f, -0.451365262f, -1.0f, 0.999067545f,
+		0.480551928f, -0.930765152f, 0.452849209f, 1.44597816f, -0.451365262f, -1.0f, 0.999067545f,
+		0.566807151f, -1.10273576f, 0.538565457f, 1.44597816f, -0.451365262f, -1.0f, 0.999067545f,
+		0.653062344f, -1.27470648f, 0.624281704f, 1.44597816f, -0.451365262f, -1.0f, 0.999067545f,
+		0.739317596f, -1.44667709f, 0.709997952f, 1.44597816f, -0.451365262f, -1.0f, 0.999067545f,
+		0.0636377707f, -0.0935287476f, 0.0325248539f, 1.44776917f, -0.453147858f, -1.0f, 0.999069929f,
+		0.148589984f, -0.262895614f, 0.116940342f, 1.44776917f, -0.453147858f, -1.0f, 0.999069929f,
+		0.233542204f, -0.43226251f, 0.20135583f, 1.44776917f, -0.453147858f, -1.0f, 0.999069929f,
+		0.318494439f, -0.601629376f, 0.28577131f, 1.44776917f, -0.453147858f, -1.0f, 0.999069929f,
+		0.403446645f, -0.770996273f, 0.370186806f, 1.44776917f, -0.453147858f, -1.0f, 0.999069929f,
+		0.48839885f, -0.940363109f, 0.454602301f, 1.44776917f, -0.453147858f, -1.0f, 0.999069929f,
+		0.573351085f, -1.10973001f, 0.539017797f, 1.44776917f, -0.453147858f, -1.0f, 0.999069929f,
+		0.65830332f, -1.27909684f, 0.623433292f, 1.44776917f, -0.453147858f, -1.0f, 0.999069929f,
+		0.743255496f, -1.4484638f, 0.707848728f, 1.44776917f, -0.453147858f, -1.0f, 0.999069929f,
+		0.0775722489f, -0.115470208f, 0.0405347869f, 1.44950318f, -0.45487541f, -1.0f, 0.999072373f,
+		0.161260247f, -0.282310694f, 0.123688094f, 1.44950318f, -0.45487541f, -1.0f, 0.999072373f,
+		0.244948253f, -0.449151158f, 0.206841394f, 1.44950318f, -0.45487541f, -1.0f, 0.999072373f,
+		0.328636259f, -0.615991652f, 0.289994687f, 1.44950318f, -0.45487541f, -1.0f, 0.999072373f,
+		0.41232425f, -0.782832146f, 0.373147994f, 1.44950318f, -0.45487541f, -1.0f, 0.999072373f,
+		0.49601227f, -0.94967258f, 0.456301302f, 1.44950318f, -0.45487541f, -1.0f, 0.999072373f,
+		0.579700232f, -1.11651313f, 0.539454579f, 1.44950318f, -0.45487541f, -1.0f, 0.999072373f,
+		0.663388252f, -1.28335357f, 0.622607887f, 1.44950318f, -0.45487541f, -1.0f, 0.999072373f,
+		0.747076273f, -1.450194f, 0.705761194f, 1.44950318f, -0.45487541f, -1.0f, 0.999072373f,
+		0.0910980776f, -0.136765972f, 0.0483085401f, 1.4511826f, -0.45655033f, -1.0f, 0.999074757f,
+		0.173558936f, -0.301154017f, 0.130236536f, 1.4511826f, -0.45655033f, -1.0f, 0.999074757f,
+		0.256019801f, -0.465542048f, 0.212164536f, 1.4511826f, -0.45655033f, -1.0f, 0.999074757f,
+		0.338480651f, -0.629930079f, 0.294092536f, 1.4511826f, -0.45655033f, -1.0f, 0.999074757f,
+		0.420941502f, -0.79431814f, 0.376020521f, 1.4511826f, -0.45655033f, -1.0f, 0.999074757f,
+		0.503402352f, -0.958706141f, 0.457948536f, 1.4511826f, -0.45655033f, -1.0f, 0.999074757f,
+		0.585863233f, -1.1230942f, 0.539876521f, 1.4511826f, -0.45655033f, -1.0f, 0.999074757f,
+		0.668324113f, -1.28748226f, 0.621804535f, 1.4511826f, -0.45655033f, -1.0f, 0.999074757f,
+		0.750784934f, -1.45187032f, 0.70373255f, 1.4511826f, -0.45655033f, -1.0f, 0.999074757f,
+		0.104232967f, -0.157443956f, 0.0558563024f, 1.45280957f, -0.458174795f, -1.0f, 0.999077201f,
+		0.185502157f, -0.319450289f, 0.136594281f, 1.45280957f, -0.458174795f, -1.0f, 0.999077201f,
+		0.266771346f, -0.481456637f, 0.217332244f, 1.45280957f, -0.458174795f, -1.0f, 0.999077201f,
+		0.348040521f, -0.643462956f, 0.298070222f, 1.45280957f, -0.458174795f, -1.0f, 0.999077201f,
+		0.429309696f, -0.805469334f, 0.3788082f, 1.45280957f, -0.458174795f, -1.0f, 0.999077201f,
+		0.510578871f, -0.967475653f, 0.459546179f, 1.45280957f, -0.458174795f, -1.0f, 0.999077201f,
+		0.591848075f, -1.12948203f, 0.540284157f, 1.45280957f, -0.458174795f, -1.0f, 0.999077201f,
+		0.67311728f, -1.29148829f, 0.621022105f, 1.45280957f, -0.458174795f, -1.0f, 0.999077201f,
+		0.754386485f, -1.45349467f, 0.701760113f, 1.45280957f, -0.458174795f, -1.0f, 0.999077201f,
+		0.116993621f, -0.177530497f, 0.0631876886f, 1.45438623f, -0.459750921f, -1.0f, 0.999079645f,
+		0.197105095f, -0.337222844f, 0.142769411f, 1.45438623f, -0.459750921f, -1.0f, 0.999079645f,
+		0.277216554f, -0.496915221f, 0.222351119f, 1.45438623f, -0.459750921f, -1.0f, 0.999079645f,
+		0.357328027f, -0.656607568f, 0.301932842f, 1.45438623f, -0.459750921f, -1.0f, 0.999079645f,
+		0.437439471f, -0.816299915f, 0.381514549f, 1.45438623f, -0.459750921f, -1.0f, 0.999079645f,
+		0.517550945f, -0.975992322f, 0.461096257f, 1.45438623f, -0.459750921f, -1.0f, 0.999079645f,
+		0.597662389f, -1.13568461f, 0.540677965f, 1.45438623f, -0.459750921f, -1.0f, 0.999079645f,
+		0.677773893f, -1.29537702f, 0.620259702f, 1.45438623f, -0.459750921f, -1.0f, 0.999079645f,
+		0.757885337f, -1.45506942f, 0.69984138f, 1.45438623f, -0.459750921f, -1.0f, 0.999079645f,
+		0.00342246424f, 0.00131671445f, -0.00210574968f, 1.44203079f, -0.446471274f, -1.0f, 0.999225914f,
+		0.0938377678f, -0.179144502f, 0.0879407376f, 1.44203079f, -0.446471274f, -1.0f, 0.999225914f,
+		0.184253067f, -0.35960573f, 0.177987218f, 1.44203079f, -0.446471274f, -1.0f, 0.999225914f,
+		0.274668366f, -0.540066957f, 0.268033713f, 1.44203079f, -0.446471274f, -1.0f, 0.999225914f,
+		0.365083665f, -0.720528185f, 0.358080208f, 1.44203079f, -0.446471274f, -1.0f, 0.999225914f,
+		0.455498964f, -0.900989354f, 0.448126674f, 1.44203079f, -0.446471274f, -1.0f, 0.999225914f,
+		0.545914292f, -1.08145058f, 0.538173199f, 1.44203079f, -0.446471274f, -1.0f, 0.999225914f,
+		0.636329591f, -1.26191187f, 0.628219664f, 1.44203079f, -0.446471274f, -1.0f, 0.999225914f,
+		0.72674489f, -1.44237304f, 0.718266129f, 1.44203079f, -0.446471274f, -1.0f, 0.999225914f,
+		0.0191917531f, -0.0235547852f, 0.00698239915f, 1.44404554f, -0.448454738f, -1.0f, 0.999227166f,
+		0.108176373f, -0.201157853f, 0.0956014097f, 1.44404554f, -0.448454738f, -1.0f, 0.999227166f,
+		0.197160989f, -0.378760934f, 0.184220418f, 1.44404554f, -0.448454738f, -1.0f, 0.999227166f,
+		0.286145598f, -0.556364f, 0.272839427f, 1.44404554f, -0.448454738f, -1.0f, 0.999227166f,
+		0.375130236f, -0.733967066f, 0.361458451f, 1.44404554f, -0.448454738f, -1.0f, 0.999227166f,
+		0.464114845f, -0.911570132f, 0.450077474f, 1.44404554f, -0.448454738f, -1.0f, 0.999227166f,
+		0.553099453f, -1.0891732f, 0.538696468f, 1.44404554f, -0.448454738f, -1.0f, 0.999227166f,
+		0.642084062f, -1.2667762f, 0.627315462f, 1.44404554f, -0.448454738f, -1.0f, 0.999227166f,
+		0.73106873f, -1.44437933f, 0.715934515f, 1.44404554f, -0.448454738f, -1.0f, 0.999227166f,
+		0.0344697647f, -0.0476505049f, 0.0157868806f, 1.44599605f, -0.450375617f, -1.0f, 0.999228477f,
+		0.122068278f, -0.222484425f, 0.103022851f, 1.44599605f, -0.450375617f, -1.0f, 0.999228477f,
+		0.209666789f, -0.397318363f, 0.190258816f, 1.44599605f, -0.450375617f, -1.0f, 0.999228477f,
+		0.297265291f, -0.572152257f, 0.277494788f, 1.44599605f, -0.450375617f, -1.0f, 0.999228477f,
+		0.384863794f, -0.74698621f, 0.364730775f, 1.44599605f, -0.450375617f, -1.0f, 0.999228477f,
+		0.472462326f, -0.921820104f, 0.451966733f, 1.44599605f, -0.450375617f, -1.0f, 0.999228477f,
+		0.560060799f, -1.09665406f, 0.53920269f, 1.44599605f, -0.450375617f, -1.0f, 0.999228477f,
+		0.647659302f, -1.27148795f, 0.626438677f, 1.44599605f, -0.450375617f, -1.0f, 0.999228477f,
+		0.735257864f, -1.44632185f, 0.713674664f, 1.44599605f, -0.450375617f, -1.0f, 0.999228477f,
+		0.0492791086f, -0.0710061267f, 0.0243207347f, 1.44788527f, -0.452236861f, -1.0f, 0.999229789f,
+		0.135534033f, -0.243155807f, 0.110216051f, 1.44788527f, -0.452236861f, -1.0f, 0.999229789f,
+		0.221788943f, -0.415305495f, 0.196111366f, 1.44788527f, -0.452236861f, -1.0f, 0.999229789f,
+		0.308043867f, -0.587455153f, 0.282006681f, 1.44788527f, -0.452236861f, -1.0f, 0.999229789f,
+		0.394298792f, -0.759604871f, 0.367902011f, 1.44788527f, -0.452236861f, -1.0f, 0.999229789f,
+		0.480553716f, -0.931754529f, 0.453797311f, 1.44788527f, -0.452236861f, -1.0f, 0.999229789f,
+		0.566808641f, -1.10390425f, 0.53969264f, 1.44788527f, -0.452236861f, -1.0f, 0.999229789f,
+		0.653063536f, -1.27605391f, 0.62558794f, 1.44788527f, -0.452236861f, -1.0f, 0.999229789f,
+		0.73931849f, -1.44820356f, 0.7114833f, 1.44788527f, -0.452236861f, -1.0f, 0.999229789f,
+		0.0636410192f, -0.0936551616f, 0.0325962119f, 1.44971609f, -0.454041094f, -1.0f, 0.9992311f,
+		0.148592949f, -0.263201654f, 0.117191344f, 1.44971609f, -0.454041094f, -1.0f, 0.9992311f,
+		0.233544871f, -0.432748169f, 0.201786473f, 1.44971609f, -0.454041094f, -1.0f, 0.9992311f,
+		0.318496794f, -0.602294683f, 0.286381602f, 1.44971609f, -0.454041094f, -1.0f, 0.9992311f,
+		0.403448701f, -0.771841168f, 0.370976746f, 1.44971609f, -0.454041094f, -1.0f, 0.9992311f,
+		0.488400638f, -0.941387713f, 0.45557186f, 1.44971609f, -0.454041094f, -1.0f, 0.9992311f,
+		0.573352575f, -1.11093414f, 0.540166974f, 1.44971609f, -0.454041094f, -1.0f, 0.9992311f,
+		0.658304513f, -1.28048074f, 0.624762118f, 1.44971609f, -0.454041094f, -1.0f, 0.9992311f,
+		0.74325639f, -1.45002723f, 0.709357262f, 1.44971609f, -0.454041094f, -1.0f, 0.9992311f,
+		0.077575475f, -0.115629137f, 0.040624842f, 1.451491f, -0.455790848f, -1.0f, 0.999232471f,
+		0.161263183f, -0.282649904f, 0.123958446f, 1.451491f, -0.455790848f, -1.0f, 0.999232471f,
+		0.244950891f, -0.449670672f, 0.20729205f, 1.451491f, -0.455790848f, -1.0f, 0.999232471f,
+		0.328638613f, -0.61669147f, 0.290625662f, 1.451491f, -0.455790848f, -1.0f, 0.999232471f,
+		0.412326306f, -0.783712208f, 0.373959273f, 1.451491f, -0.455790848f, -1.0f, 0.999232471f,
+		0.496014029f, -0.950732946f, 0.457292855f, 1.451491f, -0.455790848f, -1.0f, 0.999232471f,
+		0.579701722f, -1.11775374f, 0.540626466f, 1.451491f, -0.455790848f, -1.0f, 0.999232471f,
+		0.663389444f, -1.28477454f, 0.623960078f, 1.451491f, -0.455790848f, -1.0f, 0.999232471f,
+		0.747077167f, -1.45179522f, 0.707293689f, 1.451491f, -0.455790848f, -1.0f, 0.999232471f,
+		0.0911012813f, -0.136957735f, 0.0484174676f, 1.45321238f, -0.457488507f, -1.0f, 0.999233782f,
+		0.173561841f, -0.301526785f, 0.130526498f, 1.45321238f, -0.457488507f, -1.0f, 0.999233782f,
+		0.256022424f, -0.466095865f, 0.212635532f, 1.45321238f, -0.457488507f, -1.0f, 0.999233782f,
+		0.338482976f, -0.630664945f, 0.294744581f, 1.45321238f, -0.457488507f, -1.0f, 0.999233782f,
+		0.420943558f, -0.795233965f, 0.376853615f, 1.45321238f, -0.457488507f, -1.0f, 0.999233782f,
+		0.50340414f, -0.959803045f, 0.458962649f, 1.45321238f, -0.457488507f, -1.0f, 0.999233782f,
+		0.585864723f, -1.12437212f, 0.541071653f, 1.45321238f, -0.457488507f, -1.0f, 0.999233782f,
+		0.668325245f, -1.28894114f, 0.623180687f, 1.45321238f, -0.457488507f, -1.0f, 0.999233782f,
+		0.750785828f, -1.45351028f, 0.705289721f, 1.45321238f, -0.457488507f, -1.0f, 0.999233782f,
+		0.104236148f, -0.157668903f, 0.0559843071f, 1.4548825f, -0.459136367f, -1.0f, 0.999235153f,
+		0.185505047f, -0.319857091f, 0.13690412f, 1.4548825f, -0.459136367f, -1.0f, 0.999235153f,
+		0.266773939f, -0.482045263f, 0.217823938f, 1.4548825f, -0.459136367f, -1.0f, 0.999235153f,
+		0.348042846f, -0.644233465f, 0.298743755f, 1.4548825f, -0.459136367f, -1.0f, 0.999235153f,
+		0.429311752f, -0.806421638f, 0.379663587f, 1.4548825f, -0.459136367f, -1.0f, 0.999235153f,
+		0.510580659f, -0.96860981f, 0.460583389f, 1.4548825f, -0.459136367f, -1.0f, 0.999235153f,
+		0.591849506f, -1.13079798f, 0.541503251f, 1.4548825f, -0.459136367f, -1.0f, 0.999235153f,
+		0.673118412f, -1.29298615f, 0.622423053f, 1.4548825f, -0.459136367f, -1.0f, 0.999235153f,
+		0.754387319f, -1.45517433f, 0.703342855f, 1.4548825f, -0.459136367f, -1.0f, 0.999235153f,
+		0.116996787f, -0.177789018f, 0.0633350015f, 1.45650375f, -0.460736454f, -1.0f, 0.999236524f,
+		0.197107971f, -0.337664098f, 0.143099442f, 1.45650375f, -0.460736454f, -1.0f, 0.999236524f,
+		0.277219146f, -0.497539192f, 0.222863898f, 1.45650375f, -0.460736454f, -1.0f, 0.999236524f,
+		0.357330322f, -0.657414258f, 0.302628338f, 1.45650375f, -0.460736454f, -1.0f, 0.999236524f,
+		0.437441498f, -0.817289352f, 0.382392794f, 1.45650375f, -0.460736454f, -1.0f, 0.999236524f,
+		0.517552674f, -0.977164447f, 0.46215722f, 1.45650375f, -0.460736454f, -1.0f, 0.999236524f,
+		0.597663879f, -1.13703954f, 0.541921675f, 1.45650375f, -0.460736454f, -1.0f, 0.999236524f,
+		0.677775025f, -1.2969147f, 0.621686101f, 1.45650375f, -0.460736454f, -1.0f, 0.999236524f,
+		0.757886231f, -1.45678973f, 0.701450586f, 1.45650375f, -0.460736454f, -1.0f, 0.999236524f,
+		0.00342478347f, 0.00131760666f, -0.0021071767f, 1.44321096f, -0.447003961f, -1.0f, 0.999395013f,
+		0.0938398764f, -0.179265991f, 0.0880617201f, 1.44321096f, -0.447003961f, -1.0f, 0.999395013f,
+		0.184254959f, -0.359849602f, 0.178230613f, 1.44321096f, -0.447003961f, -1.0f, 0.999395013f,
+		0.274670064f, -0.540433228f, 0.268399507f, 1.44321096f, -0.447003961f, -1.0f, 0.999395013f,
+		0.365085155f, -0.721016824f, 0.3585684f, 1.44321096f, -0.447003961f, -1.0f, 0.999395013f,
+		0.455500245f, -0.90160042f, 0.448737293f, 1.44321096f, -0.447003961f, -1.0f, 0.999395013f,
+		0.545915306f, -1.08218396f, 0.538906157f, 1.44321096f, -0.447003961f, -1.0f, 0.999395013f,
+		0.636330426f, -1.26276767f, 0.62907505f, 1.44321096f, -0.447003961f, -1.0f, 0.999395013f,
+		0.726745486f, -1.44335127f, 0.719243944f, 1.44321096f, -0.447003961f, -1.0f, 0.999395013f,
+		0.0191940367f, -0.0235755686f, 0.00699344184f, 1.44524276f, -0.448997498f, -1.0f, 0.999395609f,
+		0.108178452f, -0.201300547f, 0.0957343802f, 1.44524276f, -0.448997498f, -1.0f, 0.999395609f,
+		0.197162867f, -0.379025519f, 0.184475332f, 1.44524276f, -0.448997498f, -1.0f, 0.999395609f,
+		0.286147267f, -0.556750476f, 0.273216277f, 1.44524276f, -0.448997498f, -1.0f, 0.999395609f,
+		0.375131696f, -0.734475493f, 0.361957222f, 1.44524276f, -0.448997498f, -1.0f, 0.999395609f,
+		0.464116096f, -0.912200451f, 0.450698137f, 1.44524276f, -0.448997498f, -1.0f, 0.999395609f,
+		0.553100526f, -1.08992541f, 0.539439082f, 1.44524276f, -0.448997498f, -1.0f, 0.999395609f,
+		0.642084897f, -1.26765037f, 0.628180027f, 1.44524276f, -0.448997498f, -1.0f, 0.999395609f,
+		0.731069326f, -1.44537544f, 0.716920972f, 1.44524276f, -0.448997498f, -1.0f, 0.999395609f,
+		0.0344720148f, -0.0476928093f, 0.0158103034f, 1.44721079f, -0.450928599f, -1.0f, 0.999396265f,
+		0.12207032f, -0.222648203f, 0.103167765f, 1.44721079f, -0.450928599f, -1.0f, 0.999396265f,
+		0.209668621f, -0.397603601f, 0.190525234f, 1.44721079f, -0.450928599f, -1.0f, 0.999396265f,
+		0.29726693f, -0.572558999f, 0.277882695f, 1.44721079f, -0.450928599f, -1.0f, 0.999396265f,
+		0.384865224f, -0.747514427f, 0.365240157f, 1.44721079f, -0.450928599f, -1.0f, 0.999396265f,
+		0.472463548f, -0.922469795f, 0.452597618f, 1.44721079f, -0.450928599f, -1.0f, 0.999396265f,
+		0.560061872f, -1.09742522f, 0.53995508f, 1.44721079f, -0.450928599f, -1.0f, 0.999396265f,
+		0.647660136f, -1.27238059f, 0.627312541f, 1.44721079f, -0.450928599f, -1.0f, 0.999396265f,
+		0.73525846f, -1.44733596f, 0.714670002f, 1.44721079f, -0.450928599f, -1.0f, 0.999396265f,
+		0.0492813215f, -0.0710698143f, 0.0243564602f, 1.44911778f, -0.452800184f, -1.0f, 0.999396861f,
+		0.135536045f, -0.243340582f, 0.110372879f, 1.44911778f, -0.452800184f, -1.0f, 0.999396861f,
+		0.221790761f, -0.415611356f, 0.196389303f, 1.44911778f, -0.452800184f, -1.0f, 0.999396861f,
+		0.308045477f, -0.587882102f, 0.282405704f, 1.44911778f, -0.452800184f, -1.0f, 0.999396861f,
+		0.394300193f, -0.760152876f, 0.368422121f, 1.44911778f, -0.452800184f, -1.0f, 0.999396861f,
+		0.480554909f, -0.932423651f, 0.454438537f, 1.44911778f, -0.452800184f, -1.0f, 0.999396861f,
+		0.566809654f, -1.10469449f, 0.540454984f, 1.44911778f, -0.452800184f, -1.0f, 0.999396861f,
+		0.65306437f, -1.27696526f, 0.6264714f, 1.44911778f, -0.452800184f, -1.0f, 0.999396861f,
+		0.739319086f, -1.44923592f, 0.712487817f, 1.44911778f, -0.452800184f, -1.0f, 0.999396861f,
+		0.0636432022f, -0.093740128f, 0.0326441787f, 1.45096672f, -0.454614908f, -1.0f, 0.999397457f,
+		0.148594931f, -0.263407379f, 0.117360055f, 1.45096672f, -0.454614908f, -1.0f, 0.999397457f,
+		0.233546659f, -0.433074594f, 0.202075928f, 1.45096672f, -0.454614908f, -1.0f, 0.999397457f,
+		0.318498373f, -0.602741838f, 0.286791801f, 1.45096672f, -0.454614908f, -1.0f, 0.999397457f,
+		0.403450102f, -0.772409081f, 0.371507674f, 1.45096672f, -0.454614908f, -1.0f, 0.999397457f,
+		0.48840183f, -0.942076325f, 0.456223547f, 1.45096672f, -0.454614908f, -1.0f, 0.999397457f,
+		0.573353529f, -1.11174357f, 0.54093945f, 1.45096672f, -0.454614908f, -1.0f, 0.999397457f,
+		0.658305287f, -1.28141081f, 0.625655293f, 1.45096672f, -0.454614908f, -1.0f, 0.999397457f,
+		0.743256986f, -1.45107806f, 0.710371196f, 1.45096672f, -0.454614908f, -1.0f, 0.999397457f,
+		0.0775776282f, -0.115735292f, 0.0406849906f, 1.45275998f, -0.456375301f, -1.0f, 0.999398112f,
+		0.161265135f, -0.282876462f, 0.124139018f, 1.45275998f, -0.456375301f, -1.0f, 0.999398112f,
+		0.244952649f, -0.450017661f, 0.207593054f, 1.45275998f, -0.456375301f, -1.0f, 0.999398112f,
+		0.328640163f, -0.61715883f, 0.291047096f, 1.45275998f, -0.456375301f, -1.0f, 0.999398112f,
+		0.412327677f, -0.784300029f, 0.374501109f, 1.45275998f, -0.456375301f, -1.0f, 0.999398112f,
+		0.496015191f, -0.951441228f, 0.457955152f, 1.45275998f, -0.456375301f, -1.0f, 0.999398112f,
+		0.579702735f, -1.11858237f, 0.541409194f, 1.45275998f, -0.456375301f, -1.0f, 0.999398112f,
+		0.663390219f, -1.28572357f, 0.624863207f, 1.45275998f, -0.456375301f, -1.0f, 0.999398112f,
+		0.747077763f, -1.45286477f, 0.70831722f, 1.45275998f, -0.456375301f, -1.0f, 0.999398112f,
+		0.0911034048f, -0.137084991f, 0.0484897569f, 1.45450008f, -0.458083779f, -1.0f, 0.999398708f,
+		0.173563778f, -0.301774204f, 0.130718932f, 1.45450008f, -0.458083779f, -1.0f, 0.999398708f,
+		0.256024152f, -0.466463387f, 0.212948114f, 1.45450008f, -0.458083779f, -1.0f, 0.999398708f,
+		0.338484526f, -0.63115257f, 0.295177311f, 1.45450008f, -0.458083779f, -1.0f, 0.999398708f,
+		0.420944899f, -0.795841813f, 0.377406478f, 1.45450008f, -0.458083779f, -1.0f, 0.999398708f,
+		0.503405273f, -0.960530996f, 0.459635645f, 1.45450008f, -0.458083779f, -1.0f, 0.999398708f,
+		0.585865676f, -1.12522018f, 0.541864812f, 1.45450008f, -0.458083779f, -1.0f, 0.999398708f,
+		0.66832602f, -1.28990936f, 0.624094009f, 1.45450008f, -0.458083779f, -1.0f, 0.999398708f,
+		0.750786424f, -1.45459855f, 0.706323206f, 1.45450008f, -0.458083779f, -1.0f, 0.999398708f,
+		0.104238249f, -0.157817215f, 0.0560687073f, 1.45618939f, -0.459742576f, -1.0f, 0.999399364f,
+		0.185506955f, -0.320125282f, 0.13710843f, 1.45618939f, -0.459742576f, -1.0f, 0.999399364f,
+		0.266775668f, -0.482433379f, 0.218148142f, 1.45618939f, -0.459742576f, -1.0f, 0.999399364f,
+		0.348044366f, -0.644741416f, 0.299187869f, 1.45618939f, -0.459742576f, -1.0f, 0.999399364f,
+		0.429313064f, -0.807049513f, 0.380227596f, 1.45618939f, -0.459742576f, -1.0f, 0.999399364f,
+		0.510581791f, -0.96935761f, 0.461267292f, 1.45618939f, -0.459742576f, -1.0f, 0.999399364f,
+		0.591850519f, -1.13166571f, 0.542307019f, 1.45618939f, -0.459742576f, -1.0f, 0.999399364f,
+		0.673119187f, -1.29397368f, 0.623346746f, 1.45618939f, -0.459742576f, -1.0f, 0.999399364f,
+		0.754387915f, -1.45628178f, 0.704386473f, 1.45618939f, -0.459742576f, -1.0f, 0.999399364f,
+		0.116998859f, -0.177958354f, 0.0634314865f, 1.45782995f, -0.461353779f, -1.0f, 0.99940002f,
+		0.197109848f, -0.33795312f, 0.143315628f, 1.45782995f, -0.461353779f, -1.0f, 0.99940002f,
+		0.277220845f, -0.497947901f, 0.223199755f, 1.45782995f, -0.461353779f, -1.0f, 0.99940002f,
+		0.357331842f, -0.657942712f, 0.303083897f, 1.45782995f, -0.461353779f, -1.0f, 0.99940002f,
+		0.437442809f, -0.817937434f, 0.382968038f, 1.45782995f, -0.461353779f, -1.0f, 0.99940002f,
+		0.517553806f, -0.977932215f, 0.46285218f, 1.45782995f, -0.461353779f, -1.0f, 0.99940002f,
+		0.597664833f, -1.13792706f, 0.542736292f, 1.45782995f, -0.461353779f, -1.0f, 0.99940002f,
+		0.6777758f, -1.29792178f, 0.622620463f, 1.45782995f, -0.461353779f, -1.0f, 0.99940002f,
+		0.757886767f, -1.45791662f, 0.702504575f, 1.45782995f, -0.461353779f, -1.0f, 0.99940002f,
+	},
+	// Mesa Mark
+	{
+		0.00356174284f, 0.000731701031f, -0.00283004181f, 1.66656828f, -0.674068391f, -1.0f, 0.998676896f,
+		0.108997509f, -0.207918257f, 0.100387573f, 1.66656828f, -0.674068391f, -1.0f, 0.998676896f,
+		0.214433268f, -0.41656822f, 0.20360519f, 1.66656828f, -0.674068391f, -1.0f, 0.998676896f,
+		0.319869041f, -0.625218153f, 0.306822807f, 1.66656828f, -0.674068391f, -1.0f, 0.998676896f,
+		0.4253048f, -0.833868146f, 0.410040438f, 1.66656828f, -0.674068391f, -1.0f, 0.998676896f,
+		0.530740559f, -1.04251814f, 0.51325804f, 1.66656828f, -0.674068391f, -1.0f, 0.998676896f,
+		0.636176348f, -1.25116801f, 0.616475642f, 1.66656828f, -0.674068391f, -1.0f, 0.998676896f,
+		0.741612077f, -1.45981801f, 0.719693303f, 1.66656828f, -0.674068391f, -1.0f, 0.998676896f,
+		0.847047865f, -1.668468f, 0.822910905f, 1.66656828f, -0.674068391f, -1.0f, 0.998676896f,
+		0.0434406362f, -0.0692209229f, 0.0273967553f, 1.66776943f, -0.675806046f, -1.0f, 0.998693466f,
+		0.144656703f, -0.269302428f, 0.126265809f, 1.66776943f, -0.675806046f, -1.0f, 0.998693466f,
+		0.245872781f, -0.469383925f, 0.22513485f, 1.66776943f, -0.675806046f, -1.0f, 0.998693466f,
+		0.347088844f, -0.669465423f, 0.324003905f, 1.66776943f, -0.675806046f, -1.0f, 0.998693466f,
+		0.448304921f, -0.86954695f, 0.422872931f, 1.66776943f, -0.675806046f, -1.0f, 0.998693466f,
+		0.549521029f, -1.06962848f, 0.521741986f, 1.66776943f, -0.675806046f, -1.0f, 0.998693466f,
+		0.650737047f, -1.26970994f, 0.620611012f, 1.66776943f, -0.675806046f, -1.0f, 0.998693466f,
+		0.751953125f, -1.46979141f, 0.719480097f, 1.66776943f, -0.675806046f, -1.0f, 0.998693466f,
+		0.853169203f, -1.66987288f, 0.818349123f, 1.66776943f, -0.675806046f, -1.0f, 0.998693466f,
+		0.0802495107f, -0.133586779f, 0.0551413447f, 1.66822433f, -0.676941156f, -1.0f, 0.998709917f,
+		0.177570745f, -0.325711727f, 0.14994894f, 1.66822433f, -0.676941156f, -1.0f, 0.998709917f,
+		0.274891973f, -0.51783663f, 0.24475652f, 1.66822433f, -0.676941156f, -1.0f, 0.998709917f,
+		0.372213185f, -0.709961593f, 0.339564115f, 1.66822433f, -0.676941156f, -1.0f, 0.998709917f,
+		0.469534427f, -0.902086556f, 0.43437171f, 1.66822433f, -0.676941156f, -1.0f, 0.998709917f,
+		0.566855669f, -1.09421146f, 0.529179275f, 1.66822433f, -0.676941156f, -1.0f, 0.998709917f,
+		0.664176881f, -1.28633642f, 0.6239869f, 1.66822433f, -0.676941156f, -1.0f, 0.998709917f,
+		0.761498094f, -1.47846138f, 0.718794465f, 1.66822433f, -0.676941156f, -1.0f, 0.998709917f,
+		0.858819366f, -1.67058635f, 0.81360203f, 1.66822433f, -0.676941156f, -1.0f, 0.998709917f,
+		0.11432945f, -0.192911714f, 0.0806218907f, 1.6677736f, -0.677366972f, -1.0f, 0.998726249f,
+		0.208044589f, -0.377606302f, 0.171605542f, 1.6677736f, -0.677366972f, -1.0f, 0.998726249f,
+		0.30175972f, -0.562300861f, 0.262589186f, 1.6677736f, -0.677366972f, -1.0f, 0.998726249f,
+		0.395474881f, -0.746995449f, 0.353572845f, 1.6677736f, -0.677366972f, -1.0f, 0.998726249f,
+		0.489190012f, -0.931690037f, 0.444556504f, 1.6677736f, -0.677366972f, -1.0f, 0.998726249f,
+		0.582905173f, -1.11638463f, 0.535540164f, 1.6677736f, -0.677366972f, -1.0f, 0.998726249f,
+		0.676620305f, -1.30107927f, 0.626523852f, 1.6677736f, -0.677366972f, -1.0f, 0.998726249f,
+		0.770335436f, -1.4857738f, 0.717507482f, 1.6677736f, -0.677366972f, -1.0f, 0.998726249f,
+		0.864050567f, -1.67046845f, 0.808491111f, 1.6677736f, -0.677366972f, -1.0f, 0.998726249f,
+		0.145972624f, -0.247620836f, 0.103992499f, 1.66614306f, -0.676893413f, -1.0f, 0.998742342f,
+		0.236339524f, -0.425327778f, 0.191337213f, 1.66614306f, -0.676893413f, -1.0f, 0.998742342f,
+		0.326706409f, -0.603034735f, 0.278681934f, 1.66614306f, -0.676893413f, -1.0f, 0.998742342f,
+		0.417073309f, -0.780741692f, 0.36602664f, 1.66614306f, -0.676893413f, -1.0f, 0.998742342f,
+		0.507440209f, -0.958448589f, 0.453371346f, 1.66614306f, -0.676893413f, -1.0f, 0.998742342f,
+		0.597807109f, -1.13615561f, 0.540716052f, 1.66614306f, -0.676893413f, -1.0f, 0.998742342f,
+		0.688174009f, -1.31386244f, 0.628060758f, 1.66614306f, -0.676893413f, -1.0f, 0.998742342f,
+		0.77854085f, -1.4915694f, 0.715405464f, 1.66614306f, -0.676893413f, -1.0f, 0.998742342f,
+		0.86890775f, -1.66927636f, 0.80275017f, 1.66614306f, -0.676893413f, -1.0f, 0.998742342f,
+		0.1754307f, -0.298003554f, 0.125326857f, 1.66284847f, -0.675178707f, -1.0f, 0.998758256f,
+		0.26268056f, -0.469075501f, 0.209154233f, 1.66284847f, -0.675178707f, -1.0f, 0.998758256f,
+		0.349930406f, -0.640147448f, 0.292981625f, 1.66284847f, -0.675178707f, -1.0f, 0.998758256f,
+		0.437180251f, -0.811219394f, 0.376809001f, 1.66284847f, -0.675178707f, -1.0f, 0.998758256f,
+		0.524430096f, -0.9822914f, 0.460636377f, 1.66284847f, -0.675178707f, -1.0f, 0.998758256f,
+		0.611679971f, -1.15336335f, 0.544463754f, 1.66284847f, -0.675178707f, -1.0f, 0.998758256f,
+		0.698929846f, -1.32443535f, 0.62829113f, 1.66284847f, -0.675178707f, -1.0f, 0.998758256f,
+		0.786179662f, -1.49550724f, 0.712118506f, 1.66284847f, -0.675178707f, -1.0f, 0.998758256f,
+		0.873429537f, -1.66657925f, 0.795945883f, 1.66284847f, -0.675178707f, -1.0f, 0.998758256f,
+		0.202921242f, -0.344158381f, 0.144571841f, 1.65697956f, -0.671575189f, -1.0f, 0.998773932f,
+		0.287262261f, -0.508834243f, 0.224912837f, 1.65697956f, -0.671575189f, -1.0f, 0.998773932f,
+		0.371603251f, -0.673510075f, 0.305253834f, 1.65697956f, -0.671575189f, -1.0f, 0.998773932f,
+		0.45594427f, -0.838185906f, 0.385594845f, 1.65697956f, -0.671575189f, -1.0f, 0.998773932f,
+		0.540285289f, -1.00286174f, 0.465935826f, 1.65697956f, -0.671575189f, -1.0f, 0.998773932f,
+		0.624626279f, -1.16753757f, 0.546276808f, 1.65697956f, -0.671575189f, -1.0f, 0.998773932f,
+		0.708967268f, -1.3322134f, 0.626617849f, 1.65697956f, -0.671575189f, -1.0f, 0.998773932f,
+		0.793308318f, -1.49688923f, 0.70695883f, 1.65697956f, -0.671575189f, -1.0f, 0.998773932f,
+		0.877649307f, -1.66156507f, 0.787299812f, 1.65697956f, -0.671575189f, -1.0f, 0.998773932f,
+		0.228632733f, -0.385829121f, 0.161418363f, 1.64664197f, -0.664728999f, -1.0f, 0.998789489f,
+		0.310253143f, -0.544168234f, 0.238144636f, 1.64664197f, -0.664728999f, -1.0f, 0.998789489f,
+		0.391873568f, -0.702507377f, 0.314870924f, 1.64664197f, -0.664728999f, -1.0f, 0.998789489f,
+		0.473493963f, -0.860846519f, 0.391597182f, 1.64664197f, -0.664728999f, -1.0f, 0.998789489f,
+		0.555114388f, -1.01918566f, 0.468323439f, 1.64664197f, -0.664728999f, -1.0f, 0.998789489f,
+		0.636734784f, -1.17752481f, 0.545049727f, 1.64664197f, -0.664728999f, -1.0f, 0.998789489f,
+		0.718355179f, -1.33586395f, 0.621775985f, 1.64664197f, -0.664728999f, -1.0f, 0.998789489f,
+		0.799975574f, -1.49420309f, 0.698502243f, 1.64664197f, -0.664728999f, -1.0f, 0.998789489f,
+		0.881595969f, -1.65254223f, 0.77522856f, 1.64664197f, -0.664728999f, -1.0f, 0.998789489f,
+		0.25272724f, -0.421864837f, 0.174884006f, 1.62719417f, -0.651315808f, -1.0f, 0.998804748f,
+		0.331798136f, -0.573552012f, 0.247510225f, 1.62719417f, -0.651315808f, -1.0f, 0.998804748f,
+		0.410869062f, -0.725239217f, 0.320136458f, 1.62719417f, -0.651315808f, -1.0f, 0.998804748f,
+		0.489939958f, -0.876926422f, 0.392762661f, 1.62719417f, -0.651315808f, -1.0f, 0.998804748f,
+		0.569010854f, -1.02861357f, 0.465388894f, 1.62719417f, -0.651315808f, -1.0f, 0.998804748f,
+		0.648081779f, -1.18030083f, 0.538015127f, 1.62719417f, -0.651315808f, -1.0f, 0.998804748f,
+		0.727152646f, -1.33198798f, 0.61064136f, 1.62719417f, -0.651315808f, -1.0f, 0.998804748f,
+		0.806223571f, -1.48367512f, 0.683267593f, 1.62719417f, -0.651315808f, -1.0f, 0.998804748f,
+		0.885294497f, -1.63536239f, 0.755893767f, 1.62719417f, -0.651315808f, -1.0f, 0.998804748f,
+		0.00356611982f, 0.000732600223f, -0.0028335196f, 1.66896808f, -0.675730705f, -1.0f, 0.998702705f,
+		0.10900142f, -0.208173975f, 0.100640774f, 1.66896808f, -0.675730705f, -1.0f, 0.998702705f,
+		0.214436725f, -0.417080551f, 0.204115063f, 1.66896808f, -0.675730705f, -1.0f, 0.998702705f,
+		0.319872022f, -0.625987113f, 0.307589352f, 1.66896808f, -0.675730705f, -1.0f, 0.998702705f,
+		0.425307333f, -0.834893703f, 0.411063671f, 1.66896808f, -0.675730705f, -1.0f, 0.998702705f,
+		0.530742645f, -1.04380023f, 0.51453793f, 1.66896808f, -0.675730705f, -1.0f, 0.998702705f,
+		0.636177897f, -1.25270677f, 0.618012249f, 1.66896808f, -0.675730705f, -1.0f, 0.998702705f,
+		0.741613209f, -1.46161342f, 0.721486568f, 1.66896808f, -0.675730705f, -1.0f, 0.998702705f,
+		0.847048521f, -1.67051995f, 0.824960828f, 1.66896808f, -0.675730705f, -1.0f, 0.998702705f,
+		0.0434455276f, -0.0693368018f, 0.0274828915f, 1.6706574f, -0.677815616f, -1.0f, 0.998718381f,
+		0.144661084f, -0.269714087f, 0.1266478f, 1.6706574f, -0.677815616f, -1.0f, 0.998718381f,
+		0.24587664f, -0.470091403f, 0.225812718f, 1.6706574f, -0.677815616f, -1.0f, 0.998718381f,
+		0.347092181f, -0.670468688f, 0.324977607f, 1.6706574f, -0.677815616f, -1.0f, 0.998718381f,
+		0.448307753f, -0.870846033f, 0.42414254f, 1.6706574f, -0.677815616f, -1.0f, 0.998718381f,
+		0.549523294f, -1.07122326f, 0.523307443f, 1.6706574f, -0.677815616f, -1.0f, 0.998718381f,
+		0.650738835f, -1.2716006f, 0.622472346f, 1.6706574f, -0.677815616f, -1.0f, 0.998718381f,
+		0.751954436f, -1.47197795f, 0.721637249f, 1.6706574f, -0.677815616f, -1.0f, 0.998718381f,
+		0.853169978f, -1.67235518f, 0.820802152f, 1.6706574f, -0.677815616f, -1.0f, 0.998718381f,
+		0.0802550986f, -0.133860558f, 0.0553486682f, 1.67176366f, -0.679414213f, -1.0f, 0.998733938f,
+		0.177575737f, -0.326333404f, 0.150504217f, 1.67176366f, -0.679414213f, -1.0f, 0.998733938f,
+		0.274896383f, -0.518806219f, 0.245659754f, 1.67176366f, -0.679414213f, -1.0f, 0.998733938f,
+		0.372217f, -0.711279094f, 0.340815306f, 1.67176366f, -0.679414213f, -1.0f, 0.998733938f,
+		0.469537646f, -0.90375191f, 0.435970843f, 1.67176366f, -0.679414213f, -1.0f, 0.998733938f,
+		0.566858292f, -1.09622478f, 0.53112638f, 1.67176366f, -0.679414213f, -1.0f, 0.998733938f,
+		0.664178908f, -1.2886976f, 0.626281917f, 1.67176366f, -0.679414213f, -1.0f, 0.998733938f,
+		0.761499584f, -1.48117042f, 0.721437454f, 1.67176366f, -0.679414213f, -1.0f, 0.998733938f,
+		0.8588202f, -1.67364335f, 0.816593051f, 1.67176366f, -0.679414213f, -1.0f, 0.998733938f,
+		0.114335991f, -0.193407282f, 0.0809994265f, 1.67220974f, -0.680478513f, -1.0f, 0.998749375f,
+		0.208050445f, -0.378521055f, 0.172402322f, 1.67220974f, -0.680478513f, -1.0f, 0.998749375f,
+		0.301764876f, -0.563634872f, 0.26380524f, 1.67220974f, -0.680478513f, -1.0f, 0.998749375f,
+		0.395479321f, -0.7487486f, 0.355208129f, 1.67220974f, -0.680478513f, -1.0f, 0.998749375f,
+		0.489193797f, -0.933862388f, 0.446611017f, 1.67220974f, -0.680478513f, -1.0f, 0.998749375f,
+		0.582908213f, -1.11897624f, 0.538013935f, 1.67220974f, -0.680478513f, -1.0f, 0.998749375f,
+		0.676622689f, -1.30409002f, 0.629416823f, 1.67220974f, -0.680478513f, -1.0f, 0.998749375f,
+		0.770337105f, -1.48920381f, 0.720819712f, 1.67220974f, -0.680478513f, -1.0f, 0.998749375f,
+		0.86405158f, -1.6743176f, 0.81222266f, 1.67220974f, -0.680478513f, -1.0f, 0.998749375f,
+		0.145980537f, -0.248441756f, 0.104619779f, 1.6718626f, -0.680919349f, -1.0f, 0.998764634f,
+		0.236346588f, -0.426669151f, 0.19248496f, 1.6718626f, -0.680919349f, -1.0f, 0.998764634f,
+		0.326712638f, -0.604896545f, 0.280350149f, 1.6718626f, -0.680919349f, -1.0f, 0.998764634f,
+		0.417078704f, -0.78312391f, 0.368215322f, 1.6718626f, -0.680919349f, -1.0f, 0.998764634f,
+		0.507444739f, -0.961351275f, 0.456080526f, 1.6718626f, -0.680919349f, -1.0f, 0.998764634f,
+		0.597810805f, -1.1395787f, 0.54394573f, 1.6718626f, -0.680919349f, -1.0f, 0.998764634f,
+		0.68817687f, -1.31780601f, 0.631810904f, 1.6718626f, -0.680919349f, -1.0f, 0.998764634f,
+		0.778542936f, -1.49603343f, 0.719676077f, 1.6718626f, -0.680919349f, -1.0f, 0.998764634f,
+		0.868909001f, -1.67426085f, 0.807541251f, 1.6718626f, -0.680919349f, -1.0f, 0.998764634f,
+		0.175440639f, -0.299327761f, 0.126340508f, 1.67049861f, -0.680581212f, -1.0f, 0.998779774f,
+		0.262689441f, -0.471071035f, 0.210839227f, 1.67049861f, -0.680581212f, -1.0f, 0.998779774f,
+		0.349938244f, -0.642814338f, 0.295337945f, 1.67049861f, -0.680581212f, -1.0f, 0.998779774f,
+		0.437187046f, -0.814557612f, 0.379836649f, 1.67049861f, -0.680581212f, -1.0f, 0.998779774f,
+		0.524435878f, -0.986300886f, 0.464335382f, 1.67049861f, -0.680581212f, -1.0f, 0.998779774f,
+		0.61168468f, -1.15804422f, 0.548834085f, 1.67049861f, -0.680581212f, -1.0f, 0.998779774f,
+		0.698933482f, -1.32978749f, 0.633332789f, 1.67049861f, -0.680581212f, -1.0f, 0.998779774f,
+		0.786182284f, -1.50153077f, 0.717831552f, 1.67049861f, -0.680581212f, -1.0f, 0.998779774f,
+		0.873431087f, -1.67327404f, 0.802330256f, 1.67049861f, -0.680581212f, -1.0f, 0.998779774f,
+		0.202934414f, -0.346316069f, 0.146225423f, 1.66773272f, -0.679192245f, -1.0f, 0.998794734f,
+		0.287274033f, -0.511903226f, 0.227477685f, 1.66773272f, -0.679192245f, -1.0f, 0.998794734f,
+		0.371613652f, -0.677490294f, 0.308729947f, 1.66773272f, -0.679192245f, -1.0f, 0.998794734f,
+		0.45595327f, -0.843077421f, 0.389982224f, 1.66773272f, -0.679192245f, -1.0f, 0.998794734f,
+		0.540292859f, -1.00866461f, 0.4712345f, 1.66773272f, -0.679192245f, -1.0f, 0.998794734f,
+		0.624632478f, -1.17425168f, 0.552486777f, 1.66773272f, -0.679192245f, -1.0f, 0.998794734f,
+		0.708972096f, -1.33983886f, 0.633739054f, 1.66773272f, -0.679192245f, -1.0f, 0.998794734f,
+		0.793311715f, -1.50542593f, 0.714991271f, 1.66773272f, -0.679192245f, -1.0f, 0.998794734f,
+		0.877651334f, -1.671013f, 0.796243548f, 1.66773272f, -0.679192245f, -1.0f, 0.998794734f,
+		0.228651509f, -0.389502794f, 0.164236054f, 1.66286719f, -0.676254749f, -1.0f, 0.998809516f,
+		0.310269922f, -0.549171507f, 0.242291883f, 1.66286719f, -0.676254749f, -1.0f, 0.998809516f,
+		0.39188835f, -0.708840311f, 0.320347697f, 1.66286719f, -0.676254749f, -1.0f, 0.998809516f,
+		0.473506778f, -0.868509054f, 0.398403525f, 1.66286719f, -0.676254749f, -1.0f, 0.998809516f,
+		0.555125177f, -1.02817774f, 0.476459354f, 1.66286719f, -0.676254749f, -1.0f, 0.998809516f,
+		0.636743605f, -1.18784654f, 0.554515183f, 1.66286719f, -0.676254749f, -1.0f, 0.998809516f,
+		0.718362033f, -1.34751534f, 0.632570982f, 1.66286719f, -0.676254749f, -1.0f, 0.998809516f,
+		0.799980462f, -1.50718403f, 0.710626841f, 1.66286719f, -0.676254749f, -1.0f, 0.998809516f,
+		0.88159889f, -1.66685283f, 0.78868264f, 1.66286719f, -0.676254749f, -1.0f, 0.998809516f,
+		0.252757162f, -0.428712219f, 0.180139154f, 1.65452206f, -0.670780241f, -1.0f, 0.99882406f,
+		0.331824899f, -0.582567573f, 0.254933387f, 1.65452206f, -0.670780241f, -1.0f, 0.99882406f,
+		0.410892636f, -0.736422956f, 0.32972759f, 1.65452206f, -0.670780241f, -1.0f, 0.99882406f,
+		0.489960372f, -0.890278339f, 0.404521823f, 1.65452206f, -0.670780241f, -1.0f, 0.99882406f,
+		0.569028139f, -1.04413366f, 0.479316056f, 1.65452206f, -0.670780241f, -1.0f, 0.99882406f,
+		0.648095846f, -1.19798911f, 0.554110289f, 1.65452206f, -0.670780241f, -1.0f, 0.99882406f,
+		0.727163613f, -1.35184443f, 0.628904462f, 1.65452206f, -0.670780241f, -1.0f, 0.99882406f,
+		0.80623132f, -1.50569987f, 0.703698695f, 1.65452206f, -0.670780241f, -1.0f, 0.99882406f,
+		0.885299087f, -1.6595552f, 0.778492928f, 1.65452206f, -0.670780241f, -1.0f, 0.99882406f,
+		0.00357114733f, 0.000733633002f, -0.00283751427f, 1.67171597f, -0.67763418f, -1.0f, 0.998740911f,
+		0.109005913f, -0.208467677f, 0.1009316f, 1.67171597f, -0.67763418f, -1.0f, 0.998740911f,
+		0.214440688f, -0.417668998f, 0.204700708f, 1.67171597f, -0.67763418f, -1.0f, 0.998740911f,
+		0.319875449f, -0.626870334f, 0.308469832f, 1.67171597f, -0.67763418f, -1.0f, 0.998740911f,
+		0.425310224f, -0.83607161f, 0.412238955f, 1.67171597f, -0.67763418f, -1.0f, 0.998740911f,
+		0.53074497f, -1.04527295f, 0.516008079f, 1.67171597f, -0.67763418f, -1.0f, 0.998740911f,
+		0.636179745f, -1.25447428f, 0.619777143f, 1.67171597f, -0.67763418f, -1.0f, 0.998740911f,
+		0.741614521f, -1.46367562f, 0.723546267f, 1.67171597f, -0.67763418f, -1.0f, 0.998740911f,
+		0.847049296f, -1.67287683f, 0.82731539f, 1.67171597f, -0.67763418f, -1.0f, 0.998740911f,
+		0.0434510075f, -0.0694665834f, 0.0275793727f, 1.67388332f, -0.680060327f, -1.0f, 0.998755276f,
+		0.144665986f, -0.270175219f, 0.127075672f, 1.67388332f, -0.680060327f, -1.0f, 0.998755276f,
+		0.245880961f, -0.470883846f, 0.226571977f, 1.67388332f, -0.680060327f, -1.0f, 0.998755276f,
+		0.347095937f, -0.671592474f, 0.326068282f, 1.67388332f, -0.680060327f, -1.0f, 0.998755276f,
+		0.448310912f, -0.872301102f, 0.425564587f, 1.67388332f, -0.680060327f, -1.0f, 0.998755276f,
+		0.549525857f, -1.07300973f, 0.525060892f, 1.67388332f, -0.680060327f, -1.0f, 0.998755276f,
+		0.650740862f, -1.27371836f, 0.624557197f, 1.67388332f, -0.680060327f, -1.0f, 0.998755276f,
+		0.751955807f, -1.47442698f, 0.724053502f, 1.67388332f, -0.680060327f, -1.0f, 0.998755276f,
+		0.853170812f, -1.67513561f, 0.823549747f, 1.67388332f, -0.680060327f, -1.0f, 0.998755276f,
+		0.0802611709f, -0.134158134f, 0.0555740148f, 1.67560136f, -0.682095766f, -1.0f, 0.998769522f,
+		0.177581161f, -0.327009141f, 0.151107773f, 1.67560136f, -0.682095766f, -1.0f, 0.998769522f,
+		0.274901152f, -0.519860148f, 0.246641532f, 1.67560136f, -0.682095766f, -1.0f, 0.998769522f,
+		0.372221142f, -0.712711155f, 0.342175305f, 1.67560136f, -0.682095766f, -1.0f, 0.998769522f,
+		0.469541162f, -0.905562162f, 0.437709063f, 1.67560136f, -0.682095766f, -1.0f, 0.998769522f,
+		0.566861153f, -1.09841311f, 0.533242822f, 1.67560136f, -0.682095766f, -1.0f, 0.998769522f,
+		0.664181113f, -1.29126418f, 0.62877655f, 1.67560136f, -0.682095766f, -1.0f, 0.998769522f,
+		0.761501133f, -1.48411512f, 0.724310338f, 1.67560136f, -0.682095766f, -1.0f, 0.998769522f,
+		0.858821154f, -1.67696607f, 0.819844067f, 1.67560136f, -0.682095766f, -1.0f, 0.998769522f,
+		0.114342846f, -0.193926618f, 0.0813950747f, 1.67684865f, -0.683732271f, -1.0f, 0.998783708f,
+		0.208056569f, -0.379479706f, 0.173237339f, 1.67684865f, -0.683732271f, -1.0f, 0.998783708f,
+		0.3017703f, -0.56503284f, 0.265079618f, 1.67684865f, -0.683732271f, -1.0f, 0.998783708f,
+		0.395484f, -0.750585914f, 0.356921881f, 1.67684865f, -0.683732271f, -1.0f, 0.998783708f,
+		0.489197731f, -0.936139047f, 0.448764145f, 1.67684865f, -0.683732271f, -1.0f, 0.998783708f,
+		0.582911432f, -1.12169218f, 0.54060638f, 1.67684865f, -0.683732271f, -1.0f, 0.998783708f,
+		0.676625192f, -1.30724525f, 0.632448673f, 1.67684865f, -0.683732271f, -1.0f, 0.998783708f,
+		0.770338893f, -1.49279833f, 0.724290907f, 1.67684865f, -0.683732271f, -1.0f, 0.998783708f,
+		0.864052653f, -1.6783514f, 0.816133201f, 1.67684865f, -0.683732271f, -1.0f, 0.998783708f,
+		0.145988464f, -0.249263912f, 0.105247997f, 1.67758f, -0.684943676f, -1.0f, 0.998797834f,
+		0.23635368f, -0.42801252f, 0.193634436f, 1.67758f, -0.684943676f, -1.0f, 0.998797834f,
+		0.326718897f, -0.606761158f, 0.282020867f, 1.67758f, -0.684943676f, -1.0f, 0.998797834f,
+		0.417084098f, -0.785509706f, 0.370407313f, 1.67758f, -0.684943676f, -1.0f, 0.998797834f,
+		0.507449329f, -0.964258313f, 0.458793759f, 1.67758f, -0.684943676f, -1.0f, 0.998797834f,
+		0.59781456f, -1.14300692f, 0.547180176f, 1.67758f, -0.684943676f, -1.0f, 0.998797834f,
+		0.688179731f, -1.32175553f, 0.635566652f, 1.67758f, -0.684943676f, -1.0f, 0.998797834f,
+		0.778544962f, -1.50050414f, 0.723953068f, 1.67758f, -0.684943676f, -1.0f, 0.998797834f,
+		0.868910193f, -1.67925274f, 0.812339544f, 1.67758f, -0.684943676f, -1.0f, 0.998797834f,
+		0.175450042f, -0.30057925f, 0.127298474f, 1.67771697f, -0.68567878f, -1.0f, 0.998811781f,
+		0.262697846f, -0.472956985f, 0.212431669f, 1.67771697f, -0.68567878f, -1.0f, 0.998811781f,
+		0.349945664f, -0.645334721f, 0.297564834f, 1.67771697f, -0.68567878f, -1.0f, 0.998811781f,
+		0.437193453f, -0.817712426f, 0.382698029f, 1.67771697f, -0.68567878f, -1.0f, 0.998811781f,
+		0.524441302f, -0.990090191f, 0.467831224f, 1.67771697f, -0.68567878f, -1.0f, 0.998811781f,
+		0.611689091f, -1.16246796f, 0.552964389f, 1.67771697f, -0.68567878f, -1.0f, 0.998811781f,
+		0.69893688f, -1.33484566f, 0.638097584f, 1.67771697f, -0.68567878f, -1.0f, 0.998811781f,
+		0.786184728f, -1.50722337f, 0.723230779f, 1.67771697f, -0.68567878f, -1.0f, 0.998811781f,
+		0.873432517f, -1.67960107f, 0.808363974f, 1.67771697f, -0.68567878f, -1.0f, 0.998811781f,
+		0.202945948f, -0.348204404f, 0.147672564f, 1.6771307f, -0.685849309f, -1.0f, 0.998825669f,
+		0.287284344f, -0.514589071f, 0.229722336f, 1.6771307f, -0.685849309f, -1.0f, 0.998825669f,
+		0.371622741f, -0.680973709f, 0.311772108f, 1.6771307f, -0.685849309f, -1.0f, 0.998825669f,
+		0.455961138f, -0.847358346f, 0.393821895f, 1.6771307f, -0.685849309f, -1.0f, 0.998825669f,
+		0.540299535f, -1.01374292f, 0.475871652f, 1.6771307f, -0.685849309f, -1.0f, 0.998825669f,
+		0.624637902f, -1.18012762f, 0.55792141f, 1.6771307f, -0.685849309f, -1.0f, 0.998825669f,
+		0.708976328f, -1.3465122f, 0.639971197f, 1.6771307f, -0.685849309f, -1.0f, 0.998825669f,
+		0.793314695f, -1.5128969f, 0.722020984f, 1.6771307f, -0.685849309f, -1.0f, 0.998825669f,
+		0.877653122f, -1.67928159f, 0.804070771f, 1.6771307f, -0.685849309f, -1.0f, 0.998825669f,
+		0.228666276f, -0.392391175f, 0.166451424f, 1.67560995f, -0.685306787f, -1.0f, 0.998839378f,
+		0.310283124f, -0.553105295f, 0.245552599f, 1.67560995f, -0.685306787f, -1.0f, 0.998839378f,
+		0.391900003f, -0.713819444f, 0.324653774f, 1.67560995f, -0.685306787f, -1.0f, 0.998839378f,
+		0.473516852f, -0.874533653f, 0.40375495f, 1.67560995f, -0.685306787f, -1.0f, 0.998839378f,
+		0.5551337f, -1.0352478f, 0.482856125f, 1.67560995f, -0.685306787f, -1.0f, 0.998839378f,
+		0.636750579f, -1.19596195f, 0.5619573f, 1.67560995f, -0.685306787f, -1.0f, 0.998839378f,
+		0.718367398f, -1.3566761f, 0.641058505f, 1.67560995f, -0.685306787f, -1.0f, 0.998839378f,
+		0.799984276f, -1.51739025f, 0.72015965f, 1.67560995f, -0.685306787f, -1.0f, 0.998839378f,
+		0.881601155f, -1.6781044f, 0.799260855f, 1.67560995f, -0.685306787f, -1.0f, 0.998839378f,
+		0.252777189f, -0.433295548f, 0.183656722f, 1.6727984f, -0.683797538f, -1.0f, 0.998852909f,
+		0.33184281f, -0.588602185f, 0.25990212f, 1.6727984f, -0.683797538f, -1.0f, 0.998852909f,
+		0.410908431f, -0.743908882f, 0.336147487f, 1.6727984f, -0.683797538f, -1.0f, 0.998852909f,
+		0.489974052f, -0.899215519f, 0.412392884f, 1.6727984f, -0.683797538f, -1.0f, 0.998852909f,
+		0.569039643f, -1.05452216f, 0.488638282f, 1.6727984f, -0.683797538f, -1.0f, 0.998852909f,
+		0.648105264f, -1.20982885f, 0.564883649f, 1.6727984f, -0.683797538f, -1.0f, 0.998852909f,
+		0.727170885f, -1.36513555f, 0.641129076f, 1.6727984f, -0.683797538f, -1.0f, 0.998852909f,
+		0.806236506f, -1.52044213f, 0.717374444f, 1.6727984f, -0.683797538f, -1.0f, 0.998852909f,
+		0.885302126f, -1.67574883f, 0.793619812f, 1.6727984f, -0.683797538f, -1.0f, 0.998852909f,
+		0.0035764561f, 0.000734723639f, -0.00284173246f, 1.67460251f, -0.679633796f, -1.0f, 0.998796225f,
+		0.109010667f, -0.20877783f, 0.101238698f, 1.67460251f, -0.679633796f, -1.0f, 0.998796225f,
+		0.214444876f, -0.418290377f, 0.205319121f, 1.67460251f, -0.679633796f, -1.0f, 0.998796225f,
+		0.319879085f, -0.627802908f, 0.309399545f, 1.67460251f, -0.679633796f, -1.0f, 0.998796225f,
+		0.425313294f, -0.83731544f, 0.413479984f, 1.67460251f, -0.679633796f, -1.0f, 0.998796225f,
+		0.530747473f, -1.04682803f, 0.517560422f, 1.67460251f, -0.679633796f, -1.0f, 0.998796225f,
+		0.636181712f, -1.25634062f, 0.621640861f, 1.67460251f, -0.679633796f, -1.0f, 0.998796225f,
+		0.741615891f, -1.4658531f, 0.7257213f, 1.67460251f, -0.679633796f, -1.0f, 0.998796225f,
+		0.84705013f, -1.67536569f, 0.829801679f, 1.67460251f, -0.679633796f, -1.0f, 0.998796225f,
+		0.0434566364f, -0.0695999488f, 0.0276785102f, 1.6771822f, -0.682355881f, -1.0f, 0.998808801f,
+		0.144671023f, -0.270649016f, 0.127515331f, 1.6771822f, -0.682355881f, -1.0f, 0.998808801f,
+		0.245885402f, -0.471698076f, 0.227352142f, 1.6771822f, -0.682355881f, -1.0f, 0.998808801f,
+		0.347099781f, -0.672747135f, 0.327188969f, 1.6771822f, -0.682355881f, -1.0f, 0.998808801f,
+		0.44831416f, -0.873796225f, 0.427025765f, 1.6771822f, -0.682355881f, -1.0f, 0.998808801f,
+		0.549528539f, -1.07484531f, 0.526862562f, 1.6771822f, -0.682355881f, -1.0f, 0.998808801f,
+		0.650742888f, -1.2758944f, 0.626699388f, 1.6771822f, -0.682355881f, -1.0f, 0.998808801f,
+		0.751957297f, -1.47694349f, 0.726536214f, 1.6771822f, -0.682355881f, -1.0f, 0.998808801f,
+		0.853171647f, -1.67799246f, 0.826373041f, 1.6771822f, -0.682355881f, -1.0f, 0.998808801f,
+		0.0802672133f, -0.134454384f, 0.0557983518f, 1.67940533f, -0.684753716f, -1.0f, 0.998821378f,
+		0.17758657f, -0.327681839f, 0.151708618f, 1.67940533f, -0.684753716f, -1.0f, 0.998821378f,
+		0.27490592f, -0.520909309f, 0.247618884f, 1.67940533f, -0.684753716f, -1.0f, 0.998821378f,
+		0.372225285f, -0.71413672f, 0.343529135f, 1.67940533f, -0.684753716f, -1.0f, 0.998821378f,
+		0.469544649f, -0.90736419f, 0.439439416f, 1.67940533f, -0.684753716f, -1.0f, 0.998821378f,
+		0.566864014f, -1.10059166f, 0.535349667f, 1.67940533f, -0.684753716f, -1.0f, 0.998821378f,
+		0.664183319f, -1.29381907f, 0.631259918f, 1.67940533f, -0.684753716f, -1.0f, 0.998821378f,
+		0.761502683f, -1.48704648f, 0.727170229f, 1.67940533f, -0.684753716f, -1.0f, 0.998821378f,
+		0.858822048f, -1.68027401f, 0.82308048f, 1.67940533f, -0.684753716f, -1.0f, 0.998821378f,
+		0.114349425f, -0.194424704f, 0.0817745402f, 1.68128061f, -0.686840892f, -1.0f, 0.998833835f,
+		0.208062455f, -0.380399138f, 0.174038187f, 1.68128061f, -0.686840892f, -1.0f, 0.998833835f,
+		0.301775485f, -0.566373587f, 0.266301841f, 1.68128061f, -0.686840892f, -1.0f, 0.998833835f,
+		0.395488501f, -0.752348006f, 0.35856548f, 1.68128061f, -0.686840892f, -1.0f, 0.998833835f,
+		0.489201546f, -0.938322484f, 0.450829148f, 1.68128061f, -0.686840892f, -1.0f, 0.998833835f,
+		0.582914531f, -1.1242969f, 0.543092787f, 1.68128061f, -0.686840892f, -1.0f, 0.998833835f,
+		0.676627576f, -1.31027138f, 0.635356426f, 1.68128061f, -0.686840892f, -1.0f, 0.998833835f,
+		0.770340621f, -1.49624574f, 0.727620065f, 1.68128061f, -0.686840892f, -1.0f, 0.998833835f,
+		0.864053607f, -1.68222022f, 0.819883704f, 1.68128061f, -0.686840892f, -1.0f, 0.998833835f,
+		0.145995721f, -0.25001812f, 0.105824284f, 1.68280661f, -0.688622653f, -1.0f, 0.998846352f,
+		0.236360177f, -0.429244846f, 0.194688886f, 1.68280661f, -0.688622653f, -1.0f, 0.998846352f,
+		0.326724619f, -0.608471572f, 0.283553511f, 1.68280661f, -0.688622653f, -1.0f, 0.998846352f,
+		0.417089075f, -0.787698328f, 0.372418106f, 1.68280661f, -0.688622653f, -1.0f, 0.998846352f,
+		0.507453501f, -0.966925085f, 0.46128273f, 1.68280661f, -0.688622653f, -1.0f, 0.998846352f,
+		0.597817957f, -1.14615178f, 0.550147355f, 1.68280661f, -0.688622653f, -1.0f, 0.998846352f,
+		0.688182414f, -1.32537854f, 0.639011919f, 1.68280661f, -0.688622653f, -1.0f, 0.998846352f,
+		0.77854687f, -1.50460529f, 0.727876544f, 1.68280661f, -0.688622653f, -1.0f, 0.998846352f,
+		0.868911326f, -1.68383205f, 0.816741168f, 1.68280661f, -0.688622653f, -1.0f, 0.998846352f,
+		0.175458208f, -0.301666796f, 0.128130972f, 1.68397069f, -0.690095186f, -1.0f, 0.99885875f,
+		0.262705147f, -0.474595875f, 0.21381551f, 1.68397069f, -0.690095186f, -1.0f, 0.99885875f,
+		0.349952102f, -0.647524953f, 0.299500048f, 1.68397069f, -0.690095186f, -1.0f, 0.99885875f,
+		0.437199026f, -0.820454061f, 0.385184586f, 1.68397069f, -0.690095186f, -1.0f, 0.99885875f,
+		0.524446011f, -0.99338311f, 0.470869124f, 1.68397069f, -0.690095186f, -1.0f, 0.99885875f,
+		0.611692905f, -1.16631222f, 0.556553662f, 1.68397069f, -0.690095186f, -1.0f, 0.99885875f,
+		0.69893986f, -1.33924127f, 0.6422382f, 1.68397069f, -0.690095186f, -1.0f, 0.99885875f,
+		0.786186814f, -1.51217031f, 0.727922738f, 1.68397069f, -0.690095186f, -1.0f, 0.99885875f,
+		0.873433769f, -1.68509936f, 0.813607275f, 1.68397069f, -0.690095186f, -1.0f, 0.99885875f,
+		0.202955306f, -0.349738449f, 0.148848206f, 1.68474531f, -0.691243172f, -1.0f, 0.998871028f,
+		0.287292719f, -0.516771019f, 0.231545866f, 1.68474531f, -0.691243172f, -1.0f, 0.998871028f,
+		0.371630102f, -0.683803558f, 0.314243525f, 1.68474531f, -0.691243172f, -1.0f, 0.998871028f,
+		0.455967516f, -0.850836098f, 0.396941185f, 1.68474531f, -0.691243172f, -1.0f, 0.998871028f,
+		0.540304899f, -1.01786864f, 0.479638845f, 1.68474531f, -0.691243172f, -1.0f, 0.998871028f,
+		0.624642313f, -1.18490112f, 0.562336504f, 1.68474531f, -0.691243172f, -1.0f, 0.998871028f,
+		0.708979726f, -1.35193372f, 0.645034194f, 1.68474531f, -0.691243172f, -1.0f, 0.998871028f,
+		0.793317139f, -1.5189662f, 0.727731824f, 1.68474531f, -0.691243172f, -1.0f, 0.998871028f,
+		0.877654552f, -1.6859988f, 0.810429513f, 1.68474531f, -0.691243172f, -1.0f, 0.998871028f,
+		0.228677273f, -0.394543469f, 0.16810225f, 1.68508375f, -0.692036629f, -1.0f, 0.998883307f,
+		0.310292959f, -0.556036592f, 0.247982368f, 1.68508375f, -0.692036629f, -1.0f, 0.998883307f,
+		0.391908646f, -0.717529774f, 0.327862501f, 1.68508375f, -0.692036629f, -1.0f, 0.998883307f,
+		0.473524362f, -0.879022896f, 0.40774262f, 1.68508375f, -0.692036629f, -1.0f, 0.998883307f,
+		0.555140078f, -1.04051602f, 0.487622768f, 1.68508375f, -0.692036629f, -1.0f, 0.998883307f,
+		0.636755764f, -1.2020092f, 0.567502856f, 1.68508375f, -0.692036629f, -1.0f, 0.998883307f,
+		0.718371451f, -1.36350238f, 0.647383034f, 1.68508375f, -0.692036629f, -1.0f, 0.998883307f,
+		0.799987137f, -1.52499545f, 0.727263153f, 1.68508375f, -0.692036629f, -1.0f, 0.998883307f,
+		0.881602824f, -1.68648863f, 0.807143271f, 1.68508375f, -0.692036629f, -1.0f, 0.998883307f,
+		0.252790511f, -0.436338991f, 0.185992464f, 1.68491089f, -0.692424774f, -1.0f, 0.998895407f,
+		0.331854701f, -0.592609346f, 0.263201475f, 1.68491089f, -0.692424774f, -1.0f, 0.998895407f,
+		0.410918921f, -0.748879671f, 0.340410471f, 1.68491089f, -0.692424774f, -1.0f, 0.998895407f,
+		0.489983141f, -0.905150056f, 0.417619467f, 1.68491089f, -0.692424774f, -1.0f, 0.998895407f,
+		0.569047332f, -1.06142044f, 0.494828463f, 1.68491089f, -0.692424774f, -1.0f, 0.998895407f,
+		0.648111582f, -1.21769071f, 0.572037458f, 1.68491089f, -0.692424774f, -1.0f, 0.998895407f,
+		0.727175772f, -1.37396109f, 0.649246454f, 1.68491089f, -0.692424774f, -1.0f, 0.998895407f,
+		0.806239963f, -1.53023148f, 0.72645545f, 1.68491089f, -0.692424774f, -1.0f, 0.998895407f,
+		0.885304213f, -1.68650174f, 0.803664446f, 1.68491089f, -0.692424774f, -1.0f, 0.998895407f,
+		0.00358158653f, 0.000735777605f, -0.00284580886f, 1.67736769f, -0.68154937f, -1.0f, 0.998874128f,
+		0.109015249f, -0.209077552f, 0.101535477f, 1.67736769f, -0.68154937f, -1.0f, 0.998874128f,
+		0.214448914f, -0.418890893f, 0.205916762f, 1.67736769f, -0.68154937f, -1.0f, 0.998874128f,
+		0.319882572f, -0.62870419f, 0.310298055f, 1.67736769f, -0.68154937f, -1.0f, 0.998874128f,
+		0.425316244f, -0.838517547f, 0.414679348f, 1.67736769f, -0.68154937f, -1.0f, 0.998874128f,
+		0.530749917f, -1.0483309f, 0.519060612f, 1.67736769f, -0.68154937f, -1.0f, 0.998874128f,
+		0.63618356f, -1.25814414f, 0.623441935f, 1.67736769f, -0.68154937f, -1.0f, 0.998874128f,
+		0.741617262f, -1.4679575f, 0.727823198f, 1.67736769f, -0.68154937f, -1.0f, 0.998874128f,
+		0.847050905f, -1.67777085f, 0.832204461f, 1.67736769f, -0.68154937f, -1.0f, 0.998874128f,
+		0.04346193f, -0.0697253719f, 0.0277717467f, 1.6802597f, -0.684497416f, -1.0f, 0.99888438f,
+		0.144675747f, -0.27109462f, 0.127928808f, 1.6802597f, -0.684497416f, -1.0f, 0.99888438f,
+		0.245889574f, -0.472463876f, 0.228085876f, 1.6802597f, -0.684497416f, -1.0f, 0.99888438f,
+		0.347103387f, -0.673833132f, 0.328242958f, 1.6802597f, -0.684497416f, -1.0f, 0.99888438f,
+		0.4483172f, -0.875202417f, 0.42840001f, 1.6802597f, -0.684497416f, -1.0f, 0.99888438f,
+		0.549531043f, -1.0765717f, 0.528557062f, 1.6802597f, -0.684497416f, -1.0f, 0.99888438f,
+		0.650744855f, -1.27794087f, 0.628714144f, 1.6802597f, -0.684497416f, -1.0f, 0.99888438f,
+		0.751958668f, -1.47931015f, 0.728871226f, 1.6802597f, -0.684497416f, -1.0f, 0.99888438f,
+		0.853172481f, -1.68067944f, 0.829028308f, 1.6802597f, -0.684497416f, -1.0f, 0.99888438f,
+		0.0802727267f, -0.134724587f, 0.0560029596f, 1.68284869f, -0.687159836f, -1.0f, 0.998894691f,
+		0.177591503f, -0.32829538f, 0.152256623f, 1.68284869f, -0.687159836f, -1.0f, 0.998894691f,
+		0.274910271f, -0.521866202f, 0.248510286f, 1.68284869f, -0.687159836f, -1.0f, 0.998894691f,
+		0.37222904f, -0.715436995f, 0.344763964f, 1.68284869f, -0.687159836f, -1.0f, 0.998894691f,
+		0.469547808f, -0.909007788f, 0.441017628f, 1.68284869f, -0.687159836f, -1.0f, 0.998894691f,
+		0.566866577f, -1.10257852f, 0.537271321f, 1.68284869f, -0.687159836f, -1.0f, 0.998894691f,
+		0.664185345f, -1.29614937f, 0.633524954f, 1.68284869f, -0.687159836f, -1.0f, 0.998894691f,
+		0.761504114f, -1.48972011f, 0.729778647f, 1.68284869f, -0.687159836f, -1.0f, 0.998894691f,
+		0.858822882f, -1.68329096f, 0.826032281f, 1.68284869f, -0.687159836f, -1.0f, 0.998894691f,
+		0.114355221f, -0.194863409f, 0.0821087584f, 1.68515706f, -0.689559937f, -1.0f, 0.998905063f,
+		0.208067626f, -0.381208956f, 0.174743548f, 1.68515706f, -0.689559937f, -1.0f, 0.998905063f,
+		0.301780045f, -0.567554474f, 0.26737833f, 1.68515706f, -0.689559937f, -1.0f, 0.998905063f,
+		0.395492464f, -0.753900051f, 0.360013127f, 1.68515706f, -0.689559937f, -1.0f, 0.998905063f,
+		0.489204884f, -0.940245569f, 0.452647924f, 1.68515706f, -0.689559937f, -1.0f, 0.998905063f,
+		0.582917273f, -1.12659109f, 0.545282722f, 1.68515706f, -0.689559937f, -1.0f, 0.998905063f,
+		0.676629722f, -1.31293666f, 0.637917519f, 1.68515706f, -0.689559937f, -1.0f, 0.998905063f,
+		0.770342112f, -1.49928224f, 0.730552316f, 1.68515706f, -0.689559937f, -1.0f, 0.998905063f,
+		0.864054501f, -1.6856277f, 0.823187113f, 1.68515706f, -0.689559937f, -1.0f, 0.998905063f,
+		0.146001875f, -0.250656247f, 0.106311895f, 1.68720102f, -0.691715896f, -1.0f, 0.998915374f,
+		0.236365676f, -0.43028757f, 0.195581093f, 1.68720102f, -0.691715896f, -1.0f, 0.998915374f,
+		0.326729476f, -0.609918892f, 0.284850299f, 1.68720102f, -0.691715896f, -1.0f, 0.998915374f,
+		0.417093277f, -0.789550185f, 0.37411949f, 1.68720102f, -0.691715896f, -1.0f, 0.998915374f,
+		0.507457078f, -0.969181478f, 0.463388681f, 1.68720102f, -0.691715896f, -1.0f, 0.998915374f,
+		0.597820878f, -1.14881277f, 0.552657902f, 1.68720102f, -0.691715896f, -1.0f, 0.998915374f,
+		0.688184679f, -1.32844412f, 0.641927063f, 1.68720102f, -0.691715896f, -1.0f, 0.998915374f,
+		0.778548479f, -1.50807536f, 0.731196284f, 1.68720102f, -0.691715896f, -1.0f, 0.998915374f,
+		0.86891228f, -1.68770671f, 0.820465446f, 1.68720102f, -0.691715896f, -1.0f, 0.998915374f,
+		0.175464794f, -0.3025451f, 0.128803253f, 1.6889919f, -0.693641186f, -1.0f, 0.998925745f,
+		0.262711048f, -0.475919396f, 0.214933053f, 1.6889919f, -0.693641186f, -1.0f, 0.998925745f,
+		0.349957287f, -0.649293721f, 0.301062852f, 1.6889919f, -0.693641186f, -1.0f, 0.998925745f,
+		0.437203526f, -0.822668076f, 0.387192637f, 1.6889919f, -0.693641186f, -1.0f, 0.998925745f,
+		0.524449766f, -0.996042371f, 0.473322451f, 1.6889919f, -0.693641186f, -1.0f, 0.998925745f,
+		0.611696064f, -1.16941667f, 0.559452236f, 1.6889919f, -0.693641186f, -1.0f, 0.998925745f,
+		0.698942304f, -1.34279108f, 0.64558202f, 1.6889919f, -0.693641186f, -1.0f, 0.998925745f,
+		0.786188543f, -1.51616538f, 0.731711864f, 1.6889919f, -0.693641186f, -1.0f, 0.998925745f,
+		0.873434782f, -1.68953967f, 0.817841649f, 1.6889919f, -0.693641186f, -1.0f, 0.998925745f,
+		0.202962473f, -0.350911111f, 0.14974688f, 1.69053578f, -0.695344806f, -1.0f, 0.998936057f,
+		0.287299126f, -0.518438935f, 0.232939795f, 1.69053578f, -0.695344806f, -1.0f, 0.998936057f,
+		0.371635765f, -0.68596673f, 0.316132694f, 1.69053578f, -0.695344806f, -1.0f, 0.998936057f,
+		0.455972403f, -0.853494525f, 0.399325609f, 1.69053578f, -0.695344806f, -1.0f, 0.998936057f,
+		0.540309072f, -1.02102232f, 0.482518524f, 1.69053578f, -0.695344806f, -1.0f, 0.998936057f,
+		0.62464571f, -1.18855011f, 0.565711439f, 1.69053578f, -0.695344806f, -1.0f, 0.998936057f,
+		0.708982348f, -1.35607791f, 0.648904383f, 1.69053578f, -0.695344806f, -1.0f, 0.998936057f,
+		0.793318987f, -1.5236057f, 0.732097268f, 1.69053578f, -0.695344806f, -1.0f, 0.998936057f,
+		0.877655625f, -1.6911335f, 0.815290213f, 1.69053578f, -0.695344806f, -1.0f, 0.998936057f,
+		0.228685141f, -0.396084011f, 0.169283822f, 1.69183314f, -0.696831167f, -1.0f, 0.998946309f,
+		0.310299993f, -0.558134735f, 0.249721497f, 1.69183314f, -0.696831167f, -1.0f, 0.998946309f,
+		0.391914874f, -0.720185459f, 0.330159158f, 1.69183314f, -0.696831167f, -1.0f, 0.998946309f,
+		0.473529726f, -0.882236183f, 0.410596848f, 1.69183314f, -0.696831167f, -1.0f, 0.998946309f,
+		0.555144608f, -1.04428685f, 0.491034508f, 1.69183314f, -0.696831167f, -1.0f, 0.998946309f,
+		0.63675946f, -1.20633757f, 0.571472168f, 1.69183314f, -0.696831167f, -1.0f, 0.998946309f,
+		0.718374312f, -1.3683883f, 0.651909828f, 1.69183314f, -0.696831167f, -1.0f, 0.998946309f,
+		0.799989164f, -1.53043902f, 0.732347488f, 1.69183314f, -0.696831167f, -1.0f, 0.998946309f,
+		0.881604016f, -1.69248974f, 0.812785208f, 1.69183314f, -0.696831167f, -1.0f, 0.998946309f,
+		0.252799273f, -0.438349187f, 0.187535226f, 1.69287825f, -0.698099554f, -1.0f, 0.998956561f,
+		0.331862569f, -0.59525609f, 0.265380681f, 1.69287825f, -0.698099554f, -1.0f, 0.998956561f,
+		0.410925835f, -0.752162933f, 0.343226165f, 1.69287825f, -0.698099554f, -1.0f, 0.998956561f,
+		0.489989132f, -0.909069777f, 0.421071619f, 1.69287825f, -0.698099554f, -1.0f, 0.998956561f,
+		0.569052398f, -1.06597662f, 0.498917073f, 1.69287825f, -0.698099554f, -1.0f, 0.998956561f,
+		0.648115695f, -1.22288358f, 0.576762557f, 1.69287825f, -0.698099554f, -1.0f, 0.998956561f,
+		0.727178991f, -1.37979043f, 0.654608011f, 1.69287825f, -0.698099554f, -1.0f, 0.998956561f,
+		0.806242228f, -1.53669727f, 0.732453465f, 1.69287825f, -0.698099554f, -1.0f, 0.998956561f,
+		0.885305524f, -1.69360411f, 0.81029892f, 1.69287825f, -0.698099554f, -1.0f, 0.998956561f,
+		0.0035861372f, 0.00073671242f, -0.00284942472f, 1.67978489f, -0.683223903f, -1.0f, 0.998978794f,
+		0.109019317f, -0.209343404f, 0.101798721f, 1.67978489f, -0.683223903f, -1.0f, 0.998978794f,
+		0.214452505f, -0.419423521f, 0.206446871f, 1.67978489f, -0.683223903f, -1.0f, 0.998978794f,
+		0.319885671f, -0.629503667f, 0.311094999f, 1.67978489f, -0.683223903f, -1.0f, 0.998978794f,
+		0.425318867f, -0.839583755f, 0.415743142f, 1.67978489f, -0.683223903f, -1.0f, 0.998978794f,
+		0.530752063f, -1.0496639f, 0.520391285f, 1.67978489f, -0.683223903f, -1.0f, 0.998978794f,
+		0.636185229f, -1.25974393f, 0.625039458f, 1.67978489f, -0.683223903f, -1.0f, 0.998978794f,
+		0.741618395f, -1.46982408f, 0.729687572f, 1.67978489f, -0.683223903f, -1.0f, 0.998978794f,
+		0.84705162f, -1.67990422f, 0.834335744f, 1.67978489f, -0.683223903f, -1.0f, 0.998978794f,
+		0.0434665121f, -0.0698338896f, 0.0278524142f, 1.68288565f, -0.686324775f, -1.0f, 0.998986423f,
+		0.144679844f, -0.271480173f, 0.128286555f, 1.68288565f, -0.686324775f, -1.0f, 0.998986423f,
+		0.24589318f, -0.473126441f, 0.228720695f, 1.68288565f, -0.686324775f, -1.0f, 0.998986423f,
+		0.347106516f, -0.674772739f, 0.329154849f, 1.68288565f, -0.686324775f, -1.0f, 0.998986423f,
+		0.448319852f, -0.876419008f, 0.429588974f, 1.68288565f, -0.686324775f, -1.0f, 0.998986423f,
+		0.549533188f, -1.07806528f, 0.530023158f, 1.68288565f, -0.686324775f, -1.0f, 0.998986423f,
+		0.650746524f, -1.2797116f, 0.630457282f, 1.68288565f, -0.686324775f, -1.0f, 0.998986423f,
+		0.75195986f, -1.48135781f, 0.730891407f, 1.68288565f, -0.686324775f, -1.0f, 0.998986423f,
+		0.853173196f, -1.68300414f, 0.831325531f, 1.68288565f, -0.686324775f, -1.0f, 0.998986423f,
+		0.0802773684f, -0.134952039f, 0.0561752059f, 1.68570995f, -0.689159095f, -1.0f, 0.998994112f,
+		0.177595645f, -0.328811884f, 0.152717963f, 1.68570995f, -0.689159095f, -1.0f, 0.998994112f,
+		0.274913937f, -0.522671759f, 0.249260724f, 1.68570995f, -0.689159095f, -1.0f, 0.998994112f,
+		0.372232199f, -0.716531575f, 0.345803469f, 1.68570995f, -0.689159095f, -1.0f, 0.998994112f,
+		0.46955049f, -0.91039139f, 0.442346245f, 1.68570995f, -0.689159095f, -1.0f, 0.998994112f,
+		0.566868782f, -1.10425127f, 0.538888991f, 1.68570995f, -0.689159095f, -1.0f, 0.998994112f,
+		0.664187074f, -1.29811108f, 0.635431767f, 1.68570995f, -0.689159095f, -1.0f, 0.998994112f,
+		0.761505306f, -1.4919709f, 0.731974483f, 1.68570995f, -0.689159095f, -1.0f, 0.998994112f,
+		0.858823597f, -1.68583083f, 0.828517258f, 1.68570995f, -0.689159095f, -1.0f, 0.998994112f,
+		0.114359953f, -0.195221737f, 0.0823817551f, 1.68828464f, -0.691753745f, -1.0f, 0.99900192f,
+		0.208071858f, -0.381870389f, 0.175319687f, 1.68828464f, -0.691753745f, -1.0f, 0.99900192f,
+		0.30178377f, -0.568519056f, 0.268257648f, 1.68828464f, -0.691753745f, -1.0f, 0.99900192f,
+		0.395495683f, -0.755167723f, 0.361195564f, 1.68828464f, -0.691753745f, -1.0f, 0.99900192f,
+		0.489207596f, -0.94181639f, 0.454133511f, 1.68828464f, -0.691753745f, -1.0f, 0.99900192f,
+		0.582919538f, -1.12846506f, 0.547071457f, 1.68828464f, -0.691753745f, -1.0f, 0.99900192f,
+		0.676631451f, -1.31511366f, 0.640009403f, 1.68828464f, -0.691753745f, -1.0f, 0.99900192f,
+		0.770343363f, -1.50176239f, 0.73294735f, 1.68828464f, -0.691753745f, -1.0f, 0.99900192f,
+		0.864055276f, -1.688411f, 0.825885296f, 1.68828464f, -0.691753745f, -1.0f, 0.99900192f,
+		0.146006733f, -0.251160294f, 0.106697045f, 1.69063222f, -0.694131136f, -1.0f, 0.999009728f,
+		0.236370012f, -0.431111157f, 0.196285814f, 1.69063222f, -0.694131136f, -1.0f, 0.999009728f,
+		0.326733291f, -0.61106205f, 0.285874605f, 1.69063222f, -0.694131136f, -1.0f, 0.999009728f,
+		0.417096585f, -0.791012883f, 0.375463367f, 1.69063222f, -0.694131136f, -1.0f, 0.999009728f,
+		0.507459879f, -0.970963717f, 0.465052128f, 1.69063222f, -0.694131136f, -1.0f, 0.999009728f,
+		0.597823143f, -1.15091455f, 0.554640889f, 1.69063222f, -0.694131136f, -1.0f, 0.999009728f,
+		0.688186407f, -1.3308655f, 0.64422965f, 1.69063222f, -0.694131136f, -1.0f, 0.999009728f,
+		0.778549731f, -1.51081634f, 0.733818471f, 1.69063222f, -0.694131136f, -1.0f, 0.999009728f,
+		0.868912995f, -1.69076717f, 0.823407233f, 1.69063222f, -0.694131136f, -1.0f, 0.999009728f,
+		0.175469816f, -0.303213298f, 0.129314765f, 1.6927712f, -0.696310282f, -1.0f, 0.999017596f,
+		0.262715548f, -0.476926386f, 0.215783328f, 1.6927712f, -0.696310282f, -1.0f, 0.999017596f,
+		0.349961251f, -0.650639474f, 0.302251875f, 1.6927712f, -0.696310282f, -1.0f, 0.999017596f,
+		0.437206954f, -0.824352562f, 0.388720453f, 1.6927712f, -0.696310282f, -1.0f, 0.999017596f,
+		0.524452686f, -0.99806565f, 0.475189f, 1.6927712f, -0.696310282f, -1.0f, 0.999017596f,
+		0.611698389f, -1.17177868f, 0.561657548f, 1.6927712f, -0.696310282f, -1.0f, 0.999017596f,
+		0.698944092f, -1.34549177f, 0.648126125f, 1.6927712f, -0.696310282f, -1.0f, 0.999017596f,
+		0.786189854f, -1.51920485f, 0.734594703f, 1.6927712f, -0.696310282f, -1.0f, 0.999017596f,
+		0.873435557f, -1.69291794f, 0.82106328f, 1.6927712f, -0.696310282f, -1.0f, 0.999017596f,
+		0.202967688f, -0.351766467f, 0.150402382f, 1.69471729f, -0.698306918f, -1.0f, 0.999025464f,
+		0.287303776f, -0.519655526f, 0.233956531f, 1.69471729f, -0.698306918f, -1.0f, 0.999025464f,
+		0.371639878f, -0.687544525f, 0.317510694f, 1.69471729f, -0.698306918f, -1.0f, 0.999025464f,
+		0.45597598f, -0.855433583f, 0.401064843f, 1.69471729f, -0.698306918f, -1.0f, 0.999025464f,
+		0.540312052f, -1.02332258f, 0.484618992f, 1.69471729f, -0.698306918f, -1.0f, 0.999025464f,
+		0.624648154f, -1.1912117f, 0.56817317f, 1.69471729f, -0.698306918f, -1.0f, 0.999025464f,
+		0.708984256f, -1.3591007f, 0.651727319f, 1.69471729f, -0.698306918f, -1.0f, 0.999025464f,
+		0.793320358f, -1.52698982f, 0.735281467f, 1.69471729f, -0.698306918f, -1.0f, 0.999025464f,
+		0.87765646f, -1.69487882f, 0.818835616f, 1.69471729f, -0.698306918f, -1.0f, 0.999025464f,
+		0.228690609f, -0.397155166f, 0.170105398f, 1.69648278f, -0.700134218f, -1.0f, 0.999033391f,
+		0.31030491f, -0.559593558f, 0.250930727f, 1.69648278f, -0.700134218f, -1.0f, 0.999033391f,
+		0.391919166f, -0.722031951f, 0.331756085f, 1.69648278f, -0.700134218f, -1.0f, 0.999033391f,
+		0.473533452f, -0.884470344f, 0.412581414f, 1.69648278f, -0.700134218f, -1.0f, 0.999033391f,
+		0.555147767f, -1.04690874f, 0.493406743f, 1.69648278f, -0.700134218f, -1.0f, 0.999033391f,
+		0.636762023f, -1.20934713f, 0.574232101f, 1.69648278f, -0.700134218f, -1.0f, 0.999033391f,
+		0.718376338f, -1.37178552f, 0.65505743f, 1.69648278f, -0.700134218f, -1.0f, 0.999033391f,
+		0.799990594f, -1.53422403f, 0.735882759f, 1.69648278f, -0.700134218f, -1.0f, 0.999033391f,
+		0.88160485f, -1.69666243f, 0.816708088f, 1.69648278f, -0.700134218f, -1.0f, 0.999033391f,
+		0.252805054f, -0.439672261f, 0.188550651f, 1.69807756f, -0.701802909f, -1.0f, 0.999041319f,
+		0.331867725f, -0.596998096f, 0.266815007f, 1.69807756f, -0.701802909f, -1.0f, 0.999041319f,
+		0.410930395f, -0.7543239f, 0.345079392f, 1.69807756f, -0.701802909f, -1.0f, 0.999041319f,
+		0.489993066f, -0.911649704f, 0.423343778f, 1.69807756f, -0.701802909f, -1.0f, 0.999041319f,
+		0.569055736f, -1.06897557f, 0.501608133f, 1.69807756f, -0.701802909f, -1.0f, 0.999041319f,
+		0.648118436f, -1.22630131f, 0.579872489f, 1.69807756f, -0.701802909f, -1.0f, 0.999041319f,
+		0.727181077f, -1.38362718f, 0.658136904f, 1.69807756f, -0.701802909f, -1.0f, 0.999041319f,
+		0.806243777f, -1.54095292f, 0.73640126f, 1.69807756f, -0.701802909f, -1.0f, 0.999041319f,
+		0.885306418f, -1.69827878f, 0.814665616f, 1.69807756f, -0.701802909f, -1.0f, 0.999041319f,
+		0.00358987646f, 0.000737480645f, -0.00285239588f, 1.6817255f, -0.684568405f, -1.0f, 0.999110341f,
+		0.109022662f, -0.20956187f, 0.102015033f, 1.6817255f, -0.684568405f, -1.0f, 0.999110341f,
+		0.214455456f, -0.419861197f, 0.206882462f, 1.6817255f, -0.684568405f, -1.0f, 0.999110341f,
+		0.319888234f, -0.63016057f, 0.311749905f, 1.6817255f, -0.684568405f, -1.0f, 0.999110341f,
+		0.425321013f, -0.840459883f, 0.416617334f, 1.6817255f, -0.684568405f, -1.0f, 0.999110341f,
+		0.530753791f, -1.0507592f, 0.521484733f, 1.6817255f, -0.684568405f, -1.0f, 0.999110341f,
+		0.6361866f, -1.26105857f, 0.626352191f, 1.6817255f, -0.684568405f, -1.0f, 0.999110341f,
+		0.741619408f, -1.47135794f, 0.73121959f, 1.6817255f, -0.684568405f, -1.0f, 0.999110341f,
+		0.847052157f, -1.68165731f, 0.836087048f, 1.6817255f, -0.684568405f, -1.0f, 0.999110341f,
+		0.0434701964f, -0.0699211955f, 0.0279173199f, 1.68495154f, -0.687762499f, -1.0f, 0.999115288f,
+		0.144683138f, -0.271790355f, 0.128574401f, 1.68495154f, -0.687762499f, -1.0f, 0.999115288f,
+		0.245896086f, -0.473659515f, 0.229231477f, 1.68495154f, -0.687762499f, -1.0f, 0.999115288f,
+		0.34710902f, -0.675528705f, 0.329888552f, 1.68495154f, -0.687762499f, -1.0f, 0.999115288f,
+		0.448321968f, -0.877397835f, 0.430545628f, 1.68495154f, -0.687762499f, -1.0f, 0.999115288f,
+		0.549534917f, -1.07926702f, 0.531202674f, 1.68495154f, -0.687762499f, -1.0f, 0.999115288f,
+		0.650747895f, -1.28113616f, 0.631859779f, 1.68495154f, -0.687762499f, -1.0f, 0.999115288f,
+		0.751960814f, -1.48300529f, 0.732516825f, 1.68495154f, -0.687762499f, -1.0f, 0.999115288f,
+		0.853173733f, -1.68487453f, 0.833173931f, 1.68495154f, -0.687762499f, -1.0f, 0.999115288f,
+		0.0802810192f, -0.135130972f, 0.0563106984f, 1.68791246f, -0.690698266f, -1.0f, 0.999120414f,
+		0.177598909f, -0.329218179f, 0.153080851f, 1.68791246f, -0.690698266f, -1.0f, 0.999120414f,
+		0.274916798f, -0.523305357f, 0.249851018f, 1.68791246f, -0.690698266f, -1.0f, 0.999120414f,
+		0.372234702f, -0.717392564f, 0.346621156f, 1.68791246f, -0.690698266f, -1.0f, 0.999120414f,
+		0.469552606f, -0.911479771f, 0.443391323f, 1.68791246f, -0.690698266f, -1.0f, 0.999120414f,
+		0.566870511f, -1.10556698f, 0.54016149f, 1.68791246f, -0.690698266f, -1.0f, 0.999120414f,
+		0.664188385f, -1.29965425f, 0.636931658f, 1.68791246f, -0.690698266f, -1.0f, 0.999120414f,
+		0.761506259f, -1.49374139f, 0.733701825f, 1.68791246f, -0.690698266f, -1.0f, 0.999120414f,
+		0.858824193f, -1.68782866f, 0.830471933f, 1.68791246f, -0.690698266f, -1.0f, 0.999120414f,
+		0.114363581f, -0.195496827f, 0.082591325f, 1.6906364f, -0.693403423f, -1.0f, 0.99912554f,
+		0.208075106f, -0.382378191f, 0.175761998f, 1.6906364f, -0.693403423f, -1.0f, 0.99912554f,
+		0.301786631f, -0.569259584f, 0.26893267f, 1.6906364f, -0.693403423f, -1.0f, 0.99912554f,
+		0.395498157f, -0.756140947f, 0.362103343f, 1.6906364f, -0.693403423f, -1.0f, 0.99912554f,
+		0.489209682f, -0.943022311f, 0.455274016f, 1.6906364f, -0.693403423f, -1.0f, 0.99912554f,
+		0.582921207f, -1.12990367f, 0.548444688f, 1.6906364f, -0.693403423f, -1.0f, 0.99912554f,
+		0.676632762f, -1.31678498f, 0.641615331f, 1.6906364f, -0.693403423f, -1.0f, 0.99912554f,
+		0.770344257f, -1.5036664f, 0.734786034f, 1.6906364f, -0.693403423f, -1.0f, 0.99912554f,
+		0.864055812f, -1.6905477f, 0.827956676f, 1.6906364f, -0.693403423f, -1.0f, 0.99912554f,
+		0.146010369f, -0.251537234f, 0.10698507f, 1.69314754f, -0.695901871f, -1.0f, 0.999130785f,
+		0.236373261f, -0.431727052f, 0.196812823f, 1.69314754f, -0.695901871f, -1.0f, 0.999130785f,
+		0.326736152f, -0.6119169f, 0.286640584f, 1.69314754f, -0.695901871f, -1.0f, 0.999130785f,
+		0.417099059f, -0.792106748f, 0.376468331f, 1.69314754f, -0.695901871f, -1.0f, 0.999130785f,
+		0.507461965f, -0.972296536f, 0.466296077f, 1.69314754f, -0.695901871f, -1.0f, 0.999130785f,
+		0.597824872f, -1.15248632f, 0.556123853f, 1.69314754f, -0.695901871f, -1.0f, 0.999130785f,
+		0.688187778f, -1.33267617f, 0.645951569f, 1.69314754f, -0.695901871f, -1.0f, 0.999130785f,
+		0.778550684f, -1.51286602f, 0.735779345f, 1.69314754f, -0.695901871f, -1.0f, 0.999130785f,
+		0.868913531f, -1.69305587f, 0.825607121f, 1.69314754f, -0.695901871f, -1.0f, 0.999130785f,
+		0.175473467f, -0.303699017f, 0.129686549f, 1.69546664f, -0.698213875f, -1.0f, 0.99913609f,
+		0.262718797f, -0.477658302f, 0.216401339f, 1.69546664f, -0.698213875f, -1.0f, 0.99913609f,
+		0.349964112f, -0.651617646f, 0.303116143f, 1.69546664f, -0.698213875f, -1.0f, 0.99913609f,
+		0.437209457f, -0.825576961f, 0.389830947f, 1.69546664f, -0.698213875f, -1.0f, 0.99913609f,
+		0.524454772f, -0.999536216f, 0.476545721f, 1.69546664f, -0.698213875f, -1.0f, 0.99913609f,
+		0.611700118f, -1.17349553f, 0.563260555f, 1.69546664f, -0.698213875f, -1.0f, 0.99913609f,
+		0.698945463f, -1.34745491f, 0.649975359f, 1.69546664f, -0.698213875f, -1.0f, 0.99913609f,
+		0.786190748f, -1.52141416f, 0.736690104f, 1.69546664f, -0.698213875f, -1.0f, 0.99913609f,
+		0.873436093f, -1.69537354f, 0.823404908f, 1.69546664f, -0.698213875f, -1.0f, 0.99913609f,
+		0.202971369f, -0.352369249f, 0.150864348f, 1.69761133f, -0.70035702f, -1.0f, 0.999141395f,
+		0.287307084f, -0.520512879f, 0.234673083f, 1.69761133f, -0.70035702f, -1.0f, 0.999141395f,
+		0.371642768f, -0.688656509f, 0.318481833f, 1.69761133f, -0.70035702f, -1.0f, 0.999141395f,
+		0.455978483f, -0.856800139f, 0.402290553f, 1.69761133f, -0.70035702f, -1.0f, 0.999141395f,
+		0.540314198f, -1.02494383f, 0.486099303f, 1.69761133f, -0.70035702f, -1.0f, 0.999141395f,
+		0.624649882f, -1.19308746f, 0.569908023f, 1.69761133f, -0.70035702f, -1.0f, 0.999141395f,
+		0.708985567f, -1.36123109f, 0.653716803f, 1.69761133f, -0.70035702f, -1.0f, 0.999141395f,
+		0.793321311f, -1.52937472f, 0.737525523f, 1.69761133f, -0.70035702f, -1.0f, 0.999141395f,
+		0.877656996f, -1.69751835f, 0.821334243f, 1.69761133f, -0.70035702f, -1.0f, 0.999141395f,
+		0.228694335f, -0.397885025f, 0.170665205f, 1.69959688f, -0.702346504f, -1.0f, 0.999146819f,
+		0.310308218f, -0.560587585f, 0.251754701f, 1.69959688f, -0.702346504f, -1.0f, 0.999146819f,
+		0.391922116f, -0.723290145f, 0.332844168f, 1.69959688f, -0.702346504f, -1.0f, 0.999146819f,
+		0.473536015f, -0.885992706f, 0.413933665f, 1.69959688f, -0.702346504f, -1.0f, 0.999146819f,
+		0.555149913f, -1.04869533f, 0.495023161f, 1.69959688f, -0.702346504f, -1.0f, 0.999146819f,
+		0.636763811f, -1.21139789f, 0.576112628f, 1.69959688f, -0.702346504f, -1.0f, 0.999146819f,
+		0.71837765f, -1.37410045f, 0.657202125f, 1.69959688f, -0.702346504f, -1.0f, 0.999146819f,
+		0.799991548f, -1.53680301f, 0.738291621f, 1.69959688f, -0.702346504f, -1.0f, 0.999146819f,
+		0.881605446f, -1.69950557f, 0.819381118f, 1.69959688f, -0.702346504f, -1.0f, 0.999146819f,
+		0.252808869f, -0.440541089f, 0.189217433f, 1.70143652f, -0.704195499f, -1.0f, 0.999152243f,
+		0.331871122f, -0.598141968f, 0.267756879f, 1.70143652f, -0.704195499f, -1.0f, 0.999152243f,
+		0.410933405f, -0.755742908f, 0.34629634f, 1.70143652f, -0.704195499f, -1.0f, 0.999152243f,
+		0.489995658f, -0.913343847f, 0.424835801f, 1.70143652f, -0.704195499f, -1.0f, 0.999152243f,
+		0.569057941f, -1.07094479f, 0.503375232f, 1.70143652f, -0.704195499f, -1.0f, 0.999152243f,
+		0.648120224f, -1.22854567f, 0.581914723f, 1.70143652f, -0.704195499f, -1.0f, 0.999152243f,
+		0.727182448f, -1.38614655f, 0.660454154f, 1.70143652f, -0.704195499f, -1.0f, 0.999152243f,
+		0.806244731f, -1.54374743f, 0.738993585f, 1.70143652f, -0.704195499f, -1.0f, 0.999152243f,
+		0.885307014f, -1.70134842f, 0.817533076f, 1.70143652f, -0.704195499f, -1.0f, 0.999152243f,
+		0.003592761f, 0.000738073199f, -0.00285468786f, 1.68317282f, -0.685571194f, -1.0f, 0.999261498f,
+		0.10902524f, -0.209730372f, 0.102181897f, 1.68317282f, -0.685571194f, -1.0f, 0.999261498f,
+		0.214457721f, -0.420198828f, 0.207218468f, 1.68317282f, -0.685571194f, -1.0f, 0.999261498f,
+		0.319890201f, -0.630667269f, 0.312255055f, 1.68317282f, -0.685571194f, -1.0f, 0.999261498f,
+		0.425322682f, -0.84113574f, 0.417291641f, 1.68317282f, -0.685571194f, -1.0f, 0.999261498f,
+		0.530755162f, -1.05160415f, 0.522328198f, 1.68317282f, -0.685571194f, -1.0f, 0.999261498f,
+		0.636187673f, -1.26207268f, 0.627364814f, 1.68317282f, -0.685571194f, -1.0f, 0.999261498f,
+		0.741620123f, -1.47254109f, 0.732401371f, 1.68317282f, -0.685571194f, -1.0f, 0.999261498f,
+		0.847052634f, -1.68300951f, 0.837437987f, 1.68317282f, -0.685571194f, -1.0f, 0.999261498f,
+		0.0434729941f, -0.0699874312f, 0.0279665571f, 1.68646765f, -0.68881768f, -1.0f, 0.9992643f,
+		0.144685641f, -0.272025675f, 0.128792748f, 1.68646765f, -0.68881768f, -1.0f, 0.9992643f,
+		0.245898291f, -0.474063933f, 0.229618952f, 1.68646765f, -0.68881768f, -1.0f, 0.9992643f,
+		0.347110927f, -0.676102161f, 0.330445141f, 1.68646765f, -0.68881768f, -1.0f, 0.9992643f,
+		0.448323578f, -0.87814045f, 0.431271344f, 1.68646765f, -0.68881768f, -1.0f, 0.9992643f,
+		0.549536228f, -1.08017874f, 0.532097518f, 1.68646765f, -0.68881768f, -1.0f, 0.9992643f,
+		0.650748909f, -1.28221691f, 0.632923722f, 1.68646765f, -0.68881768f, -1.0f, 0.9992643f,
+		0.751961529f, -1.48425519f, 0.733749926f, 1.68646765f, -0.68881768f, -1.0f, 0.9992643f,
+		0.85317421f, -1.68629348f, 0.83457613f, 1.68646765f, -0.68881768f, -1.0f, 0.9992643f,
+		0.0802837387f, -0.135264337f, 0.0564116947f, 1.68950152f, -0.69180882f, -1.0f, 0.99926722f,
+		0.177601352f, -0.32952103f, 0.153351367f, 1.68950152f, -0.69180882f, -1.0f, 0.99926722f,
+		0.274918944f, -0.523777723f, 0.25029102f, 1.68950152f, -0.69180882f, -1.0f, 0.99926722f,
+		0.37223655f, -0.718034387f, 0.347230703f, 1.68950152f, -0.69180882f, -1.0f, 0.99926722f,
+		0.469554156f, -0.91229111f, 0.444170356f, 1.68950152f, -0.69180882f, -1.0f, 0.99926722f,
+		0.566871762f, -1.10654783f, 0.541110039f, 1.68950152f, -0.69180882f, -1.0f, 0.99926722f,
+		0.664189398f, -1.3008045f, 0.638049722f, 1.68950152f, -0.69180882f, -1.0f, 0.99926722f,
+		0.761506975f, -1.49506116f, 0.734989345f, 1.68950152f, -0.69180882f, -1.0f, 0.99926722f,
+		0.858824611f, -1.68931782f, 0.831929028f, 1.68950152f, -0.69180882f, -1.0f, 0.99926722f,
+		0.114366241f, -0.195698127f, 0.0827446878f, 1.69230318f, -0.694572806f, -1.0f, 0.999270141f,
+		0.20807749f, -0.382749796f, 0.176085666f, 1.69230318f, -0.694572806f, -1.0f, 0.999270141f,
+		0.301788747f, -0.56980145f, 0.269426644f, 1.69230318f, -0.694572806f, -1.0f, 0.999270141f,
+		0.395499974f, -0.756853104f, 0.362767607f, 1.69230318f, -0.694572806f, -1.0f, 0.999270141f,
+		0.489211231f, -0.943904757f, 0.45610857f, 1.69230318f, -0.694572806f, -1.0f, 0.999270141f,
+		0.582922459f, -1.13095641f, 0.549449563f, 1.69230318f, -0.694572806f, -1.0f, 0.999270141f,
+		0.676633716f, -1.31800807f, 0.642790556f, 1.69230318f, -0.694572806f, -1.0f, 0.999270141f,
+		0.770344973f, -1.50505972f, 0.736131489f, 1.69230318f, -0.694572806f, -1.0f, 0.999270141f,
+		0.86405623f, -1.69211137f, 0.829472482f, 1.69230318f, -0.694572806f, -1.0f, 0.999270141f,
+		0.146012962f, -0.251807749f, 0.107191764f, 1.69489717f, -0.697133601f, -1.0f, 0.999273121f,
+		0.236375585f, -0.43216905f, 0.197191015f, 1.69489717f, -0.697133601f, -1.0f, 0.999273121f,
+		0.326738209f, -0.612530351f, 0.287190259f, 1.69489717f, -0.697133601f, -1.0f, 0.999273121f,
+		0.417100847f, -0.792891681f, 0.377189517f, 1.69489717f, -0.697133601f, -1.0f, 0.999273121f,
+		0.507463455f, -0.973253012f, 0.467188776f, 1.69489717f, -0.697133601f, -1.0f, 0.999273121f,
+		0.597826064f, -1.15361428f, 0.557188034f, 1.69489717f, -0.697133601f, -1.0f, 0.999273121f,
+		0.688188732f, -1.33397567f, 0.647187293f, 1.69489717f, -0.697133601f, -1.0f, 0.999273121f,
+		0.77855134f, -1.51433694f, 0.737186551f, 1.69489717f, -0.697133601f, -1.0f, 0.999273121f,
+		0.868913949f, -1.69469821f, 0.82718575f, 1.69489717f, -0.697133601f, -1.0f, 0.999273121f,
+		0.17547603f, -0.304040432f, 0.129947901f, 1.69730461f, -0.699512005f, -1.0f, 0.999276161f,
+		0.262721092f, -0.478172839f, 0.216835797f, 1.69730461f, -0.699512005f, -1.0f, 0.999276161f,
+		0.349966139f, -0.652305245f, 0.303723693f, 1.69730461f, -0.699512005f, -1.0f, 0.999276161f,
+		0.437211215f, -0.826437652f, 0.390611589f, 1.69730461f, -0.699512005f, -1.0f, 0.999276161f,
+		0.524456263f, -1.00057006f, 0.477499485f, 1.69730461f, -0.699512005f, -1.0f, 0.999276161f,
+		0.61170131f, -1.17470241f, 0.564387381f, 1.69730461f, -0.699512005f, -1.0f, 0.999276161f,
+		0.698946357f, -1.34883487f, 0.651275277f, 1.69730461f, -0.699512005f, -1.0f, 0.999276161f,
+		0.786191463f, -1.52296722f, 0.738163173f, 1.69730461f, -0.699512005f, -1.0f, 0.999276161f,
+		0.873436511f, -1.69709969f, 0.825051069f, 1.69730461f, -0.699512005f, -1.0f, 0.999276161f,
+		0.202973902f, -0.352783859f, 0.15118207f, 1.6995436f, -0.701726019f, -1.0f, 0.999279261f,
+		0.287309349f, -0.521102607f, 0.235165909f, 1.6995436f, -0.701726019f, -1.0f, 0.999279261f,
+		0.371644765f, -0.689421296f, 0.319149733f, 1.6995436f, -0.701726019f, -1.0f, 0.999279261f,
+		0.455980211f, -0.857740045f, 0.403133571f, 1.6995436f, -0.701726019f, -1.0f, 0.999279261f,
+		0.540315628f, -1.02605879f, 0.48711741f, 1.6995436f, -0.701726019f, -1.0f, 0.999279261f,
+		0.624651074f, -1.19437754f, 0.571101248f, 1.6995436f, -0.701726019f, -1.0f, 0.999279261f,
+		0.708986521f, -1.36269629f, 0.655085087f, 1.6995436f, -0.701726019f, -1.0f, 0.999279261f,
+		0.793321967f, -1.53101492f, 0.739068925f, 1.6995436f, -0.701726019f, -1.0f, 0.999279261f,
+		0.877657413f, -1.69933367f, 0.823052764f, 1.6995436f, -0.701726019f, -1.0f, 0.999279261f,
+		0.228696853f, -0.398375511f, 0.171041399f, 1.70163023f, -0.703791142f, -1.0f, 0.99928236f,
+		0.310310483f, -0.561255574f, 0.252308398f, 1.70163023f, -0.703791142f, -1.0f, 0.99928236f,
+		0.391924083f, -0.724135697f, 0.333575398f, 1.70163023f, -0.703791142f, -1.0f, 0.99928236f,
+		0.473537713f, -0.88701576f, 0.414842397f, 1.70163023f, -0.703791142f, -1.0f, 0.99928236f,
+		0.555151343f, -1.04989588f, 0.496109396f, 1.70163023f, -0.703791142f, -1.0f, 0.99928236f,
+		0.636764944f, -1.21277595f, 0.577376425f, 1.70163023f, -0.703791142f, -1.0f, 0.99928236f,
+		0.718378603f, -1.37565601f, 0.658643425f, 1.70163023f, -0.703791142f, -1.0f, 0.99928236f,
+		0.799992204f, -1.53853619f, 0.739910424f, 1.70163023f, -0.703791142f, -1.0f, 0.99928236f,
+		0.881605864f, -1.70141625f, 0.821177423f, 1.70163023f, -0.703791142f, -1.0f, 0.99928236f,
+		0.252811342f, -0.44111073f, 0.189654619f, 1.70357823f, -0.70572108f, -1.0f, 0.999285579f,
+		0.331873357f, -0.598892033f, 0.268374413f, 1.70357823f, -0.70572108f, -1.0f, 0.999285579f,
+		0.410935372f, -0.756673276f, 0.347094238f, 1.70357823f, -0.70572108f, -1.0f, 0.999285579f,
+		0.489997357f, -0.914454579f, 0.425814062f, 1.70357823f, -0.70572108f, -1.0f, 0.999285579f,
+		0.569059372f, -1.07223594f, 0.504533887f, 1.70357823f, -0.70572108f, -1.0f, 0.999285579f,
+		0.648121357f, -1.23001719f, 0.583253682f, 1.70357823f, -0.70572108f, -1.0f, 0.999285579f,
+		0.727183402f, -1.38779843f, 0.661973476f, 1.70357823f, -0.70572108f, -1.0f, 0.999285579f,
+		0.806245387f, -1.54557979f, 0.740693331f, 1.70357823f, -0.70572108f, -1.0f, 0.999285579f,
+		0.885307372f, -1.70336103f, 0.819413126f, 1.70357823f, -0.70572108f, -1.0f, 0.999285579f,
+		0.00359487953f, 0.000738508417f, -0.00285637099f, 1.68419051f, -0.686276376f, -1.0f, 0.999417782f,
+		0.10902714f, -0.209854141f, 0.102304436f, 1.68419051f, -0.686276376f, -1.0f, 0.999417782f,
+		0.214459389f, -0.420446783f, 0.207465246f, 1.68419051f, -0.686276376f, -1.0f, 0.999417782f,
+		0.319891661f, -0.631039441f, 0.312626064f, 1.68419051f, -0.686276376f, -1.0f, 0.999417782f,
+		0.425323904f, -0.841632068f, 0.417786866f, 1.68419051f, -0.686276376f, -1.0f, 0.999417782f,
+		0.530756176f, -1.05222476f, 0.522947669f, 1.68419051f, -0.686276376f, -1.0f, 0.999417782f,
+		0.636188447f, -1.26281738f, 0.628108501f, 1.68419051f, -0.686276376f, -1.0f, 0.999417782f,
+		0.74162066f, -1.47341001f, 0.733269274f, 1.68419051f, -0.686276376f, -1.0f, 0.999417782f,
+		0.847052932f, -1.68400264f, 0.838430107f, 1.68419051f, -0.686276376f, -1.0f, 0.999417782f,
+		0.0434750207f, -0.0700354725f, 0.0280022696f, 1.6875205f, -0.689550519f, -1.0f, 0.999419153f,
+		0.144687459f, -0.272196352f, 0.128951132f, 1.6875205f, -0.689550519f, -1.0f, 0.999419153f,
+		0.245899886f, -0.474357247f, 0.229899988f, 1.6875205f, -0.689550519f, -1.0f, 0.999419153f,
+		0.347112328f, -0.676518142f, 0.330848843f, 1.6875205f, -0.689550519f, -1.0f, 0.999419153f,
+		0.44832477f, -0.878679037f, 0.431797713f, 1.6875205f, -0.689550519f, -1.0f, 0.999419153f,
+		0.549537182f, -1.08083987f, 0.532746553f, 1.6875205f, -0.689550519f, -1.0f, 0.999419153f,
+		0.650749624f, -1.28300083f, 0.633695424f, 1.6875205f, -0.689550519f, -1.0f, 0.999419153f,
+		0.751962066f, -1.48516166f, 0.734644294f, 1.6875205f, -0.689550519f, -1.0f, 0.999419153f,
+		0.853174508f, -1.68732262f, 0.835593164f, 1.6875205f, -0.689550519f, -1.0f, 0.999419153f,
+		0.0802856907f, -0.135359824f, 0.0564840026f, 1.6905911f, -0.692570329f, -1.0f, 0.999420524f,
+		0.177603081f, -0.329737872f, 0.153545022f, 1.6905911f, -0.692570329f, -1.0f, 0.999420524f,
+		0.274920493f, -0.52411586f, 0.25060606f, 1.6905911f, -0.692570329f, -1.0f, 0.999420524f,
+		0.372237891f, -0.718493938f, 0.347667068f, 1.6905911f, -0.692570329f, -1.0f, 0.999420524f,
+		0.469555289f, -0.912871957f, 0.444728106f, 1.6905911f, -0.692570329f, -1.0f, 0.999420524f,
+		0.566872716f, -1.10724998f, 0.541789114f, 1.6905911f, -0.692570329f, -1.0f, 0.999420524f,
+		0.664190114f, -1.30162799f, 0.638850152f, 1.6905911f, -0.692570329f, -1.0f, 0.999420524f,
+		0.761507511f, -1.49600601f, 0.735911191f, 1.6905911f, -0.692570329f, -1.0f, 0.999420524f,
+		0.858824909f, -1.69038403f, 0.832972229f, 1.6905911f, -0.692570329f, -1.0f, 0.999420524f,
+		0.114368118f, -0.195840329f, 0.0828530192f, 1.69343102f, -0.695363998f, -1.0f, 0.999421954f,
+		0.208079174f, -0.383012265f, 0.176314294f, 1.69343102f, -0.695363998f, -1.0f, 0.999421954f,
+		0.301790208f, -0.570184231f, 0.269775569f, 1.69343102f, -0.695363998f, -1.0f, 0.999421954f,
+		0.395501256f, -0.757356167f, 0.363236845f, 1.69343102f, -0.695363998f, -1.0f, 0.999421954f,
+		0.489212304f, -0.944528103f, 0.45669812f, 1.69343102f, -0.695363998f, -1.0f, 0.999421954f,
+		0.582923353f, -1.13170004f, 0.550159395f, 1.69343102f, -0.695363998f, -1.0f, 0.999421954f,
+		0.676634431f, -1.31887197f, 0.64362067f, 1.69343102f, -0.695363998f, -1.0f, 0.999421954f,
+		0.770345449f, -1.50604391f, 0.737081945f, 1.69343102f, -0.695363998f, -1.0f, 0.999421954f,
+		0.864056528f, -1.69321585f, 0.83054322f, 1.69343102f, -0.695363998f, -1.0f, 0.999421954f,
+		0.14601478f, -0.25199616f, 0.107335746f, 1.69606483f, -0.697955728f, -1.0f, 0.999423385f,
+		0.236377209f, -0.432476938f, 0.197454467f, 1.69606483f, -0.697955728f, -1.0f, 0.999423385f,
+		0.326739639f, -0.612957716f, 0.287573189f, 1.69606483f, -0.697955728f, -1.0f, 0.999423385f,
+		0.417102069f, -0.793438494f, 0.377691895f, 1.69606483f, -0.697955728f, -1.0f, 0.999423385f,
+		0.507464528f, -0.973919272f, 0.467810601f, 1.69606483f, -0.697955728f, -1.0f, 0.999423385f,
+		0.597826958f, -1.15439999f, 0.557929337f, 1.69606483f, -0.697955728f, -1.0f, 0.999423385f,
+		0.688189387f, -1.33488083f, 0.648048043f, 1.69606483f, -0.697955728f, -1.0f, 0.999423385f,
+		0.778551817f, -1.51536155f, 0.738166749f, 1.69606483f, -0.697955728f, -1.0f, 0.999423385f,
+		0.868914247f, -1.69584239f, 0.828285515f, 1.69606483f, -0.697955728f, -1.0f, 0.999423385f,
+		0.175477788f, -0.304274857f, 0.130127341f, 1.69851398f, -0.700366259f, -1.0f, 0.999424875f,
+		0.262722671f, -0.478526115f, 0.217134073f, 1.69851398f, -0.700366259f, -1.0f, 0.999424875f,
+		0.349967539f, -0.652777374f, 0.304140806f, 1.69851398f, -0.700366259f, -1.0f, 0.999424875f,
+		0.437212408f, -0.827028573f, 0.391147554f, 1.69851398f, -0.700366259f, -1.0f, 0.999424875f,
+		0.524457276f, -1.00127983f, 0.478154302f, 1.69851398f, -0.700366259f, -1.0f, 0.999424875f,
+		0.611702144f, -1.17553103f, 0.565161049f, 1.69851398f, -0.700366259f, -1.0f, 0.999424875f,
+		0.698947012f, -1.34978235f, 0.652167737f, 1.69851398f, -0.700366259f, -1.0f, 0.999424875f,
+		0.786191881f, -1.52403355f, 0.739174485f, 1.69851398f, -0.700366259f, -1.0f, 0.999424875f,
+		0.873436749f, -1.69828475f, 0.826181233f, 1.69851398f, -0.700366259f, -1.0f, 0.999424875f,
+		0.202975616f, -0.353064239f, 0.15139696f, 1.7007966f, -0.702613711f, -1.0f, 0.999426365f,
+		0.287310869f, -0.521501422f, 0.235499218f, 1.7007966f, -0.702613711f, -1.0f, 0.999426365f,
+		0.371646106f, -0.689938545f, 0.319601476f, 1.7007966f, -0.702613711f, -1.0f, 0.999426365f,
+		0.455981374f, -0.858375728f, 0.403703719f, 1.7007966f, -0.702613711f, -1.0f, 0.999426365f,
+		0.540316641f, -1.02681291f, 0.487805992f, 1.7007966f, -0.702613711f, -1.0f, 0.999426365f,
+		0.624651909f, -1.19525003f, 0.571908236f, 1.7007966f, -0.702613711f, -1.0f, 0.999426365f,
+		0.708987117f, -1.36368716f, 0.656010509f, 1.7007966f, -0.702613711f, -1.0f, 0.999426365f,
+		0.793322384f, -1.53212428f, 0.740112782f, 1.7007966f, -0.702613711f, -1.0f, 0.999426365f,
+		0.877657652f, -1.70056152f, 0.824214995f, 1.7007966f, -0.702613711f, -1.0f, 0.999426365f,
+		0.228698522f, -0.398702055f, 0.171291873f, 1.70292878f, -0.704713762f, -1.0f, 0.999427915f,
+		0.310311973f, -0.561700344f, 0.252677053f, 1.70292878f, -0.704713762f, -1.0f, 0.999427915f,
+		0.391925424f, -0.724698663f, 0.334062248f, 1.70292878f, -0.704713762f, -1.0f, 0.999427915f,
+		0.473538846f, -0.887696922f, 0.415447444f, 1.70292878f, -0.704713762f, -1.0f, 0.999427915f,
+		0.555152297f, -1.05069518f, 0.496832639f, 1.70292878f, -0.704713762f, -1.0f, 0.999427915f,
+		0.636765778f, -1.2136935f, 0.578217804f, 1.70292878f, -0.704713762f, -1.0f, 0.999427915f,
+		0.7183792f, -1.37669182f, 0.659603f, 1.70292878f, -0.704713762f, -1.0f, 0.999427915f,
+		0.799992621f, -1.53969002f, 0.740988195f, 1.70292878f, -0.704713762f, -1.0f, 0.999427915f,
+		0.881606102f, -1.70268834f, 0.82237339f, 1.70292878f, -0.704713762f, -1.0f, 0.999427915f,
+		0.252812982f, -0.441483855f, 0.189940974f, 1.70492458f, -0.706680179f, -1.0f, 0.999429464f,
+		0.331874818f, -0.599383295f, 0.26877892f, 1.70492458f, -0.706680179f, -1.0f, 0.999429464f,
+		0.410936654f, -0.757282734f, 0.347616881f, 1.70492458f, -0.706680179f, -1.0f, 0.999429464f,
+		0.48999849f, -0.915182173f, 0.426454812f, 1.70492458f, -0.706680179f, -1.0f, 0.999429464f,
+		0.569060326f, -1.07308161f, 0.505292773f, 1.70492458f, -0.706680179f, -1.0f, 0.999429464f,
+		0.648122132f, -1.23098099f, 0.584130704f, 1.70492458f, -0.706680179f, -1.0f, 0.999429464f,
+		0.727183998f, -1.38888049f, 0.662968695f, 1.70492458f, -0.706680179f, -1.0f, 0.999429464f,
+		0.806245804f, -1.54677987f, 0.741806626f, 1.70492458f, -0.706680179f, -1.0f, 0.999429464f,
+		0.88530761f, -1.70467937f, 0.820644557f, 1.70492458f, -0.706680179f, -1.0f, 0.999429464f,
+	},
+	// JCM800
+	{
+		0.0191256311f, 0.00303280493f, -0.0160928257f, 1.73837483f, -0.749617279f, -1.0f, 0.990171254f,
+		0.129623607f, -0.213863865f, 0.0903688744f, 1.73837483f, -0.749617279f, -1.0f, 0.990171254f,
+		0.240121588f, -0.430760533f, 0.196830571f, 1.73837483f, -0.749617279f, -1.0f, 0.990171254f,
+		0.350619555f, -0.647657216f, 0.303292274f, 1.73837483f, -0.749617279f, -1.0f, 0.990171254f,
+		0.461117536f, -0.864553869f, 0.409753978f, 1.73837483f, -0.749617279f, -1.0f, 0.990171254f,
+		0.571615517f, -1.08145058f, 0.516215682f, 1.73837483f, -0.749617279f, -1.0f, 0.990171254f,
+		0.682113469f, -1.29834723f, 0.622677386f, 1.73837483f, -0.749617279f, -1.0f, 0.990171254f,
+		0.79261148f, -1.51524389f, 0.72913909f, 1.73837483f, -0.749617279f, -1.0f, 0.990171254f,
+		0.903109431f, -1.73214054f, 0.835600793f, 1.73837483f, -0.749617279f, -1.0f, 0.990171254f,
+		0.102525972f, -0.148965478f, 0.0525574908f, 1.74119139f, -0.752281904f, -1.0f, 0.990416527f,
+		0.203628689f, -0.347227961f, 0.149777859f, 1.74119139f, -0.752281904f, -1.0f, 0.990416527f,
+		0.304731399f, -0.545490444f, 0.246998236f, 1.74119139f, -0.752281904f, -1.0f, 0.990416527f,
+		0.405834109f, -0.743752956f, 0.344218612f, 1.74119139f, -0.752281904f, -1.0f, 0.990416527f,
+		0.506936848f, -0.942015409f, 0.441438973f, 1.74119139f, -0.752281904f, -1.0f, 0.990416527f,
+		0.608039558f, -1.14027786f, 0.538659334f, 1.74119139f, -0.752281904f, -1.0f, 0.990416527f,
+		0.709142268f, -1.33854043f, 0.635879755f, 1.74119139f, -0.752281904f, -1.0f, 0.990416527f,
+		0.810244977f, -1.53680289f, 0.733100116f, 1.74119139f, -0.752281904f, -1.0f, 0.990416527f,
+		0.911347687f, -1.73506534f, 0.830320477f, 1.74119139f, -0.752281904f, -1.0f, 0.990416527f,
+		0.17285265f, -0.276815444f, 0.110181496f, 1.74303412f, -0.754093707f, -1.0f, 0.990664423f,
+		0.266032904f, -0.459345639f, 0.19959034f, 1.74303412f, -0.754093707f, -1.0f, 0.990664423f,
+		0.359213144f, -0.641875863f, 0.28899917f, 1.74303412f, -0.754093707f, -1.0f, 0.990664423f,
+		0.452393383f, -0.824406087f, 0.378408015f, 1.74303412f, -0.754093707f, -1.0f, 0.990664423f,
+		0.545573592f, -1.00693631f, 0.467816859f, 1.74303412f, -0.754093707f, -1.0f, 0.990664423f,
+		0.638753831f, -1.18946648f, 0.557225704f, 1.74303412f, -0.754093707f, -1.0f, 0.990664423f,
+		0.731934071f, -1.37199664f, 0.646634579f, 1.74303412f, -0.754093707f, -1.0f, 0.990664423f,
+		0.82511431f, -1.55452693f, 0.736043394f, 1.74303412f, -0.754093707f, -1.0f, 0.990664423f,
+		0.918294549f, -1.73705709f, 0.825452268f, 1.74303412f, -0.754093707f, -1.0f, 0.990664423f,
+		0.232955977f, -0.385730743f, 0.159141034f, 1.74403918f, -0.755176425f, -1.0f, 0.990912259f,
+		0.319365412f, -0.554794848f, 0.241853446f, 1.74403918f, -0.755176425f, -1.0f, 0.990912259f,
+		0.405774862f, -0.723859012f, 0.324565828f, 1.74403918f, -0.755176425f, -1.0f, 0.990912259f,
+		0.492184311f, -0.892923117f, 0.40727824f, 1.74403918f, -0.755176425f, -1.0f, 0.990912259f,
+		0.578593791f, -1.06198728f, 0.489990652f, 1.74403918f, -0.755176425f, -1.0f, 0.990912259f,
+		0.66500324f, -1.23105145f, 0.572703063f, 1.74403918f, -0.755176425f, -1.0f, 0.990912259f,
+		0.75141269f, -1.40011549f, 0.655415416f, 1.74403918f, -0.755176425f, -1.0f, 0.990912259f,
+		0.837822139f, -1.56917965f, 0.738127828f, 1.74403918f, -0.755176425f, -1.0f, 0.990912259f,
+		0.924231589f, -1.73824382f, 0.82084024f, 1.74403918f, -0.755176425f, -1.0f, 0.990912259f,
+		0.284913719f, -0.479500532f, 0.201148361f, 1.74428856f, -0.755606115f, -1.0f, 0.991157949f,
+		0.365469992f, -0.636900663f, 0.27804929f, 1.74428856f, -0.755606115f, -1.0f, 0.991157949f,
+		0.446026266f, -0.794300854f, 0.354950219f, 1.74428856f, -0.755606115f, -1.0f, 0.991157949f,
+		0.526582539f, -0.951700985f, 0.431851178f, 1.74428856f, -0.755606115f, -1.0f, 0.991157949f,
+		0.607138813f, -1.10910118f, 0.508752108f, 1.74428856f, -0.755606115f, -1.0f, 0.991157949f,
+		0.687695086f, -1.26650131f, 0.585653067f, 1.74428856f, -0.755606115f, -1.0f, 0.991157949f,
+		0.768251359f, -1.42390144f, 0.662553966f, 1.74428856f, -0.755606115f, -1.0f, 0.991157949f,
+		0.848807633f, -1.58130157f, 0.739454925f, 1.74428856f, -0.755606115f, -1.0f, 0.991157949f,
+		0.929363906f, -1.73870182f, 0.816355884f, 1.74428856f, -0.755606115f, -1.0f, 0.991157949f,
+		0.330276251f, -0.560937822f, 0.237469271f, 1.74382186f, -0.755421877f, -1.0f, 0.991399646f,
+		0.40572232f, -0.708128929f, 0.309271216f, 1.74382186f, -0.755421877f, -1.0f, 0.991399646f,
+		0.481168419f, -0.855320036f, 0.381073147f, 1.74382186f, -0.755421877f, -1.0f, 0.991399646f,
+		0.556614459f, -1.00251114f, 0.452875078f, 1.74382186f, -0.755421877f, -1.0f, 0.991399646f,
+		0.632060528f, -1.14970231f, 0.524677038f, 1.74382186f, -0.755421877f, -1.0f, 0.991399646f,
+		0.707506597f, -1.29689348f, 0.596478939f, 1.74382186f, -0.755421877f, -1.0f, 0.991399646f,
+		0.782952666f, -1.44408453f, 0.6682809f, 1.74382186f, -0.755421877f, -1.0f, 0.991399646f,
+		0.858398736f, -1.59127569f, 0.74008286f, 1.74382186f, -0.755421877f, -1.0f, 0.991399646f,
+		0.933844864f, -1.73846674f, 0.811884761f, 1.74382186f, -0.755421877f, -1.0f, 0.991399646f,
+		0.37022388f, -0.632166088f, 0.269052565f, 1.74264145f, -0.754630744f, -1.0f, 0.991636157f,
+		0.441169739f, -0.77033776f, 0.33633557f, 1.74264145f, -0.754630744f, -1.0f, 0.991636157f,
+		0.512115598f, -0.908509433f, 0.403618544f, 1.74264145f, -0.754630744f, -1.0f, 0.991636157f,
+		0.583061516f, -1.04668105f, 0.470901549f, 1.74264145f, -0.754630744f, -1.0f, 0.991636157f,
+		0.654007375f, -1.18485284f, 0.538184524f, 1.74264145f, -0.754630744f, -1.0f, 0.991636157f,
+		0.724953234f, -1.32302451f, 0.605467498f, 1.74264145f, -0.754630744f, -1.0f, 0.991636157f,
+		0.795899093f, -1.46119618f, 0.672750533f, 1.74264145f, -0.754630744f, -1.0f, 0.991636157f,
+		0.866845012f, -1.59936786f, 0.740033507f, 1.74264145f, -0.754630744f, -1.0f, 0.991636157f,
+		0.937790871f, -1.73753953f, 0.807316482f, 1.74264145f, -0.754630744f, -1.0f, 0.991636157f,
+		0.405670971f, -0.694806933f, 0.296614021f, 1.74071336f, -0.753209174f, -1.0f, 0.991866469f,
+		0.472623616f, -0.824941814f, 0.359854162f, 1.74071336f, -0.753209174f, -1.0f, 0.991866469f,
+		0.539576292f, -0.955076694f, 0.423094332f, 1.74071336f, -0.753209174f, -1.0f, 0.991866469f,
+		0.606528938f, -1.08521152f, 0.486334473f, 1.74071336f, -0.753209174f, -1.0f, 0.991866469f,
+		0.673481643f, -1.21534646f, 0.549574614f, 1.74071336f, -0.753209174f, -1.0f, 0.991866469f,
+		0.740434289f, -1.34548128f, 0.612814784f, 1.74071336f, -0.753209174f, -1.0f, 0.991866469f,
+		0.807386994f, -1.47561622f, 0.676054955f, 1.74071336f, -0.753209174f, -1.0f, 0.991866469f,
+		0.87433964f, -1.60575104f, 0.739295125f, 1.74071336f, -0.753209174f, -1.0f, 0.991866469f,
+		0.941292286f, -1.73588586f, 0.802535236f, 1.74071336f, -0.753209174f, -1.0f, 0.991866469f,
+		0.437336802f, -0.750105321f, 0.320691198f, 1.73796356f, -0.751099765f, -1.0f, 0.992089748f,
+		0.500722229f, -0.873021305f, 0.380281061f, 1.73796356f, -0.751099765f, -1.0f, 0.992089748f,
+		0.564107656f, -0.995937347f, 0.439870894f, 1.73796356f, -0.751099765f, -1.0f, 0.992089748f,
+		0.627493083f, -1.11885333f, 0.499460727f, 1.73796356f, -0.751099765f, -1.0f, 0.992089748f,
+		0.69087851f, -1.24176943f, 0.55905056f, 1.73796356f, -0.751099765f, -1.0f, 0.992089748f,
+		0.754263937f, -1.36468542f, 0.618640423f, 1.73796356f, -0.751099765f, -1.0f, 0.992089748f,
+		0.817649364f, -1.4876014f, 0.678230286f, 1.73796356f, -0.751099765f, -1.0f, 0.992089748f,
+		0.881034791f, -1.6105175f, 0.737820089f, 1.73796356f, -0.751099765f, -1.0f, 0.992089748f,
+		0.944420278f, -1.73343349f, 0.797409952f, 1.73796356f, -0.751099765f, -1.0f, 0.992089748f,
+		0.0192095451f, 0.00304611167f, -0.0161634348f, 1.74564075f, -0.755450964f, -1.0f, 0.991424143f,
+		0.129698068f, -0.214809865f, 0.0912519842f, 1.74564075f, -0.755450964f, -1.0f, 0.991424143f,
+		0.240186587f, -0.432665825f, 0.198667407f, 1.74564075f, -0.755450964f, -1.0f, 0.991424143f,
+		0.350675106f, -0.650521815f, 0.306082815f, 1.74564075f, -0.755450964f, -1.0f, 0.991424143f,
+		0.46116364f, -0.868377745f, 0.413498253f, 1.74564075f, -0.755450964f, -1.0f, 0.991424143f,
+		0.571652174f, -1.08623374f, 0.520913661f, 1.74564075f, -0.755450964f, -1.0f, 0.991424143f,
+		0.682140708f, -1.30408967f, 0.628329098f, 1.74564075f, -0.755450964f, -1.0f, 0.991424143f,
+		0.792629182f, -1.52194571f, 0.735744476f, 1.74564075f, -0.755450964f, -1.0f, 0.991424143f,
+		0.903117716f, -1.73980165f, 0.843159914f, 1.74564075f, -0.755450964f, -1.0f, 0.991424143f,
+		0.102605835f, -0.14975284f, 0.0531494804f, 1.74934208f, -0.758840621f, -1.0f, 0.991583526f,
+		0.203699559f, -0.348974496f, 0.151323006f, 1.74934208f, -0.758840621f, -1.0f, 0.991583526f,
+		0.304793268f, -0.548196197f, 0.249496534f, 1.74934208f, -0.758840621f, -1.0f, 0.991583526f,
+		0.405887008f, -0.747417808f, 0.347670048f, 1.74934208f, -0.758840621f, -1.0f, 0.991583526f,
+		0.506980717f, -0.946639478f, 0.445843577f, 1.74934208f, -0.758840621f, -1.0f, 0.991583526f,
+		0.608074427f, -1.14586115f, 0.544017136f, 1.74934208f, -0.758840621f, -1.0f, 0.991583526f,
+		0.709168136f, -1.34508276f, 0.642190635f, 1.74934208f, -0.758840621f, -1.0f, 0.991583526f,
+		0.810261905f, -1.54430449f, 0.740364134f, 1.74934208f, -0.758840621f, -1.0f, 0.991583526f,
+		0.911355615f, -1.7435261f, 0.838537693f, 1.74934208f, -0.758840621f, -1.0f, 0.991583526f,
+		0.172929987f, -0.278421074f, 0.111449555f, 1.75218058f, -0.761467755f, -1.0f, 0.991748393f,
+		0.266101509f, -0.461921185f, 0.201821819f, 1.75218058f, -0.761467755f, -1.0f, 0.991748393f,
+		0.359273046f, -0.645421267f, 0.292194068f, 1.75218058f, -0.761467755f, -1.0f, 0.991748393f,
+		0.452444553f, -0.828921378f, 0.382566333f, 1.75218058f, -0.761467755f, -1.0f, 0.991748393f,
+		0.54561609f, -1.01242149f, 0.472938597f, 1.75218058f, -0.761467755f, -1.0f, 0.991748393f,
+		0.638787627f, -1.19592154f, 0.563310862f, 1.75218058f, -0.761467755f, -1.0f, 0.991748393f,
+		0.731959164f, -1.37942159f, 0.653683126f, 1.75218058f, -0.761467755f, -1.0f, 0.991748393f,
+		0.825130701f, -1.56292176f, 0.74405539f, 1.75218058f, -0.761467755f, -1.0f, 0.991748393f,
+		0.918302178f, -1.74642181f, 0.834427655f, 1.75218058f, -0.761467755f, -1.0f, 0.991748393f,
+		0.233032003f, -0.388198763f, 0.161120608f, 1.75431561f, -0.763474882f, -1.0f, 0.991917133f,
+		0.319432884f, -0.558254004f, 0.244817212f, 1.75431561f, -0.763474882f, -1.0f, 0.991917133f,
+		0.405833781f, -0.728309274f, 0.328513831f, 1.75431561f, -0.763474882f, -1.0f, 0.991917133f,
+		0.492234647f, -0.898364544f, 0.412210435f, 1.75431561f, -0.763474882f, -1.0f, 0.991917133f,
+		0.578635514f, -1.06841981f, 0.495907038f, 1.75431561f, -0.763474882f, -1.0f, 0.991917133f,
+		0.66503644f, -1.23847508f, 0.579603612f, 1.75431561f, -0.763474882f, -1.0f, 0.991917133f,
+		0.751437306f, -1.40853035f, 0.663300276f, 1.75431561f, -0.763474882f, -1.0f, 0.991917133f,
+		0.837838173f, -1.57858562f, 0.74699688f, 1.75431561f, -0.763474882f, -1.0f, 0.991917133f,
+		0.924239099f, -1.74864089f, 0.830693483f, 1.75431561f, -0.763474882f, -1.0f, 0.991917133f,
+		0.284989536f, -0.482902437f, 0.203897625f, 1.75585866f, -0.764962375f, -1.0f, 0.992088139f,
+		0.365537286f, -0.641325891f, 0.281814396f, 1.75585866f, -0.764962375f, -1.0f, 0.992088139f,
+		0.446085006f, -0.799749315f, 0.359731138f, 1.75585866f, -0.764962375f, -1.0f, 0.992088139f,
+		0.526632726f, -0.958172739f, 0.437647909f, 1.75585866f, -0.764962375f, -1.0f, 0.992088139f,
+		0.607180476f, -1.1165961f, 0.51556468f, 1.75585866f, -0.764962375f, -1.0f, 0.992088139f,
+		0.687728226f, -1.27501953f, 0.593481421f, 1.75585866f, -0.764962375f, -1.0f, 0.992088139f,
+		0.768275976f, -1.43344295f, 0.671398163f, 1.75585866f, -0.764962375f, -1.0f, 0.992088139f,
+		0.848823667f, -1.59186637f, 0.749314964f, 1.75585866f, -0.764962375f, -1.0f, 0.992088139f,
+		0.929371417f, -1.7502898f, 0.827231705f, 1.75585866f, -0.764962375f, -1.0f, 0.992088139f,
+		0.330352902f, -0.565376163f, 0.241072014f, 1.75688803f, -0.766000807f, -1.0f, 0.992260158f,
+		0.405790359f, -0.713634491f, 0.313933104f, 1.75688803f, -0.766000807f, -1.0f, 0.992260158f,
+		0.481227785f, -0.86189276f, 0.38679418f, 1.75688803f, -0.766000807f, -1.0f, 0.992260158f,
+		0.556665242f, -1.01015103f, 0.459655255f, 1.75688803f, -0.766000807f, -1.0f, 0.992260158f,
+		0.632102668f, -1.15840936f, 0.532516301f, 1.75688803f, -0.766000807f, -1.0f, 0.992260158f,
+		0.707540095f, -1.30666769f, 0.605377376f, 1.75688803f, -0.766000807f, -1.0f, 0.992260158f,
+		0.782977521f, -1.45492589f, 0.678238451f, 1.75688803f, -0.766000807f, -1.0f, 0.992260158f,
+		0.858414948f, -1.60318422f, 0.751099527f, 1.75688803f, -0.766000807f, -1.0f, 0.992260158f,
+		0.933852434f, -1.75144255f, 0.823960602f, 1.75688803f, -0.766000807f, -1.0f, 0.992260158f,
+		0.370302379f, -0.637780547f, 0.273623198f, 1.75745666f, -0.766638875f, -1.0f, 0.992431939f,
+		0.441239417f, -0.777076662f, 0.342021853f, 1.75745666f, -0.766638875f, -1.0f, 0.992431939f,
+		0.512176454f, -0.916372716f, 0.410420537f, 1.75745666f, -0.766638875f, -1.0f, 0.992431939f,
+		0.583113492f, -1.05566883f, 0.478819191f, 1.75745666f, -0.766638875f, -1.0f, 0.992431939f,
+		0.654050469f, -1.19496489f, 0.547217906f, 1.75745666f, -0.766638875f, -1.0f, 0.992431939f,
+		0.724987507f, -1.33426094f, 0.61561656f, 1.75745666f, -0.766638875f, -1.0f, 0.992431939f,
+		0.795924544f, -1.473557f, 0.684015214f, 1.75745666f, -0.766638875f, -1.0f, 0.992431939f,
+		0.866861582f, -1.61285305f, 0.752413869f, 1.75745666f, -0.766638875f, -1.0f, 0.992431939f,
+		0.937798619f, -1.75214911f, 0.820812583f, 1.75745666f, -0.766638875f, -1.0f, 0.992431939f,
+		0.40575242f, -0.701784253f, 0.302305549f, 1.75759852f, -0.766908169f, -1.0f, 0.992602468f,
+		0.472695917f, -0.833116412f, 0.366733462f, 1.75759852f, -0.766908169f, -1.0f, 0.992602468f,
+		0.539639413f, -0.964448512f, 0.431161344f, 1.75759852f, -0.766908169f, -1.0f, 0.992602468f,
+		0.60658288f, -1.09578061f, 0.495589256f, 1.75759852f, -0.766908169f, -1.0f, 0.992602468f,
+		0.673526406f, -1.22711277f, 0.560017169f, 1.75759852f, -0.766908169f, -1.0f, 0.992602468f,
+		0.740469873f, -1.35844493f, 0.624445081f, 1.75759852f, -0.766908169f, -1.0f, 0.992602468f,
+		0.807413399f, -1.48977709f, 0.688872993f, 1.75759852f, -0.766908169f, -1.0f, 0.992602468f,
+		0.874356866f, -1.62110913f, 0.753300905f, 1.75759852f, -0.766908169f, -1.0f, 0.992602468f,
+		0.941300333f, -1.75244129f, 0.817728758f, 1.75759852f, -0.766908169f, -1.0f, 0.992602468f,
+		0.437422454f, -0.758693635f, 0.32770732f, 1.75733125f, -0.766826153f, -1.0f, 0.99277091f,
+		0.500798225f, -0.882898808f, 0.388575822f, 1.75733125f, -0.766826153f, -1.0f, 0.99277091f,
+		0.564174056f, -1.00710392f, 0.449444354f, 1.75733125f, -0.766826153f, -1.0f, 0.99277091f,
+		0.627549827f, -1.13130915f, 0.510312855f, 1.75733125f, -0.766826153f, -1.0f, 0.99277091f,
+		0.690925598f, -1.25551426f, 0.571181417f, 1.75733125f, -0.766826153f, -1.0f, 0.99277091f,
+		0.754301369f, -1.3797195f, 0.632049918f, 1.75733125f, -0.766826153f, -1.0f, 0.99277091f,
+		0.81767714f, -1.50392461f, 0.69291842f, 1.75733125f, -0.766826153f, -1.0f, 0.99277091f,
+		0.881052911f, -1.62812984f, 0.753786981f, 1.75733125f, -0.766826153f, -1.0f, 0.99277091f,
+		0.944428742f, -1.75233495f, 0.814655483f, 1.75733125f, -0.766826153f, -1.0f, 0.99277091f,
+		0.0192811396f, 0.00305746449f, -0.0162236746f, 1.75144207f, -0.760111809f, -1.0f, 0.992890894f,
+		0.129761592f, -0.215616956f, 0.0920054317f, 1.75144207f, -0.760111809f, -1.0f, 0.992890894f,
+		0.240242049f, -0.434291363f, 0.200234532f, 1.75144207f, -0.760111809f, -1.0f, 0.992890894f,
+		0.350722522f, -0.652965784f, 0.308463633f, 1.75144207f, -0.760111809f, -1.0f, 0.992890894f,
+		0.461202979f, -0.871640205f, 0.416692764f, 1.75144207f, -0.760111809f, -1.0f, 0.992890894f,
+		0.571683407f, -1.09031463f, 0.524921834f, 1.75144207f, -0.760111809f, -1.0f, 0.992890894f,
+		0.682163894f, -1.30898905f, 0.633150995f, 1.75144207f, -0.760111809f, -1.0f, 0.992890894f,
+		0.792644322f, -1.52766347f, 0.741380095f, 1.75144207f, -0.760111809f, -1.0f, 0.992890894f,
+		0.903124809f, -1.74633789f, 0.849609196f, 1.75144207f, -0.760111809f, -1.0f, 0.992890894f,
+		0.102672473f, -0.150409713f, 0.053643357f, 1.75572073f, -0.763976455f, -1.0f, 0.992978215f,
+		0.203758687f, -0.350431591f, 0.15261206f, 1.75572073f, -0.763976455f, -1.0f, 0.992978215f,
+		0.304844886f, -0.550453424f, 0.251580775f, 1.75572073f, -0.763976455f, -1.0f, 0.992978215f,
+		0.405931115f, -0.750475347f, 0.350549489f, 1.75572073f, -0.763976455f, -1.0f, 0.992978215f,
+		0.507017314f, -0.95049721f, 0.449518204f, 1.75572073f, -0.763976455f, -1.0f, 0.992978215f,
+		0.608103514f, -1.15051901f, 0.548486888f, 1.75572073f, -0.763976455f, -1.0f, 0.992978215f,
+		0.709189773f, -1.35054088f, 0.647455633f, 1.75572073f, -0.763976455f, -1.0f, 0.992978215f,
+		0.810275972f, -1.55056286f, 0.746424317f, 1.75572073f, -0.763976455f, -1.0f, 0.992978215f,
+		0.911362171f, -1.75058472f, 0.845393062f, 1.75572073f, -0.763976455f, -1.0f, 0.992978215f,
+		0.172992945f, -0.279728532f, 0.112482093f, 1.75918877f, -0.767120659f, -1.0f, 0.993070602f,
+		0.266157389f, -0.464018375f, 0.203638837f, 1.75918877f, -0.767120659f, -1.0f, 0.993070602f,
+		0.359321803f, -0.648308218f, 0.294795603f, 1.75918877f, -0.767120659f, -1.0f, 0.993070602f,
+		0.452486247f, -0.832598031f, 0.385952324f, 1.75918877f, -0.767120659f, -1.0f, 0.993070602f,
+		0.545650661f, -1.0168879f, 0.477109075f, 1.75918877f, -0.767120659f, -1.0f, 0.993070602f,
+		0.638815105f, -1.20117772f, 0.568265855f, 1.75918877f, -0.767120659f, -1.0f, 0.993070602f,
+		0.731979549f, -1.38546753f, 0.659422576f, 1.75918877f, -0.767120659f, -1.0f, 0.993070602f,
+		0.825143993f, -1.56975746f, 0.750579298f, 1.75918877f, -0.767120659f, -1.0f, 0.993070602f,
+		0.918308437f, -1.75404727f, 0.841736078f, 1.75918877f, -0.767120659f, -1.0f, 0.993070602f,
+		0.233092293f, -0.39015609f, 0.162690595f, 1.76201236f, -0.769692898f, -1.0f, 0.993167341f,
+		0.31948638f, -0.560997427f, 0.247167766f, 1.76201236f, -0.769692898f, -1.0f, 0.993167341f,
+		0.405880481f, -0.731838763f, 0.331644922f, 1.76201236f, -0.769692898f, -1.0f, 0.993167341f,
+		0.492274582f, -0.902680099f, 0.416122109f, 1.76201236f, -0.769692898f, -1.0f, 0.993167341f,
+		0.578668654f, -1.07352149f, 0.500599265f, 1.76201236f, -0.769692898f, -1.0f, 0.993167341f,
+		0.665062726f, -1.24436283f, 0.585076451f, 1.76201236f, -0.769692898f, -1.0f, 0.993167341f,
+		0.751456857f, -1.41520417f, 0.669553638f, 1.76201236f, -0.769692898f, -1.0f, 0.993167341f,
+		0.837850928f, -1.5860455f, 0.754030824f, 1.76201236f, -0.769692898f, -1.0f, 0.993167341f,
+		0.924245f, -1.75688684f, 0.83850795f, 1.76201236f, -0.769692898f, -1.0f, 0.993167341f,
+		0.285047978f, -0.485524029f, 0.206016272f, 1.76431215f, -0.771800816f, -1.0f, 0.993267715f,
+		0.365589112f, -0.644735992f, 0.284715831f, 1.76431215f, -0.771800816f, -1.0f, 0.993267715f,
+		0.446130276f, -0.803947985f, 0.36341542f, 1.76431215f, -0.771800816f, -1.0f, 0.993267715f,
+		0.52667141f, -0.963159919f, 0.442114979f, 1.76431215f, -0.771800816f, -1.0f, 0.993267715f,
+		0.607212603f, -1.12237191f, 0.520814538f, 1.76431215f, -0.771800816f, -1.0f, 0.993267715f,
+		0.687753737f, -1.28158391f, 0.599514127f, 1.76431215f, -0.771800816f, -1.0f, 0.993267715f,
+		0.768294871f, -1.4407959f, 0.678213716f, 1.76431215f, -0.771800816f, -1.0f, 0.993267715f,
+		0.848836064f, -1.60000789f, 0.756913245f, 1.76431215f, -0.771800816f, -1.0f, 0.993267715f,
+		0.929377198f, -1.75921977f, 0.835612833f, 1.76431215f, -0.771800816f, -1.0f, 0.993267715f,
+		0.330410153f, -0.568690419f, 0.243762299f, 1.76617646f, -0.773523629f, -1.0f, 0.993371069f,
+		0.405841142f, -0.717745602f, 0.317414254f, 1.76617646f, -0.773523629f, -1.0f, 0.993371069f,
+		0.481272131f, -0.866800785f, 0.391066223f, 1.76617646f, -0.773523629f, -1.0f, 0.993371069f,
+		0.556703091f, -1.01585591f, 0.464718193f, 1.76617646f, -0.773523629f, -1.0f, 0.993371069f,
+		0.63213408f, -1.16491115f, 0.538370132f, 1.76617646f, -0.773523629f, -1.0f, 0.993371069f,
+		0.707565069f, -1.31396627f, 0.612022102f, 1.76617646f, -0.773523629f, -1.0f, 0.993371069f,
+		0.782996058f, -1.46302152f, 0.685674071f, 1.76617646f, -0.773523629f, -1.0f, 0.993371069f,
+		0.858427048f, -1.61207664f, 0.759326041f, 1.76617646f, -0.773523629f, -1.0f, 0.993371069f,
+		0.933858037f, -1.76113188f, 0.83297801f, 1.76617646f, -0.773523629f, -1.0f, 0.993371069f,
+		0.370359004f, -0.641830266f, 0.276919931f, 1.76767194f, -0.774920821f, -1.0f, 0.993476748f,
+		0.441289663f, -0.781937301f, 0.346123338f, 1.76767194f, -0.774920821f, -1.0f, 0.993476748f,
+		0.512220323f, -0.922044396f, 0.415326715f, 1.76767194f, -0.774920821f, -1.0f, 0.993476748f,
+		0.583150983f, -1.06215155f, 0.484530121f, 1.76767194f, -0.774920821f, -1.0f, 0.993476748f,
+		0.654081583f, -1.20225859f, 0.553733528f, 1.76767194f, -0.774920821f, -1.0f, 0.993476748f,
+		0.725012243f, -1.34236562f, 0.622936904f, 1.76767194f, -0.774920821f, -1.0f, 0.993476748f,
+		0.795942903f, -1.48247278f, 0.692140281f, 1.76767194f, -0.774920821f, -1.0f, 0.993476748f,
+		0.866873562f, -1.62257981f, 0.761343718f, 1.76767194f, -0.774920821f, -1.0f, 0.993476748f,
+		0.937804222f, -1.76268685f, 0.830547094f, 1.76767194f, -0.774920821f, -1.0f, 0.993476748f,
+		0.405808985f, -0.706627488f, 0.306256235f, 1.76884842f, -0.776037335f, -1.0f, 0.993584156f,
+		0.472746104f, -0.838790655f, 0.371508598f, 1.76884842f, -0.776037335f, -1.0f, 0.993584156f,
+		0.539683223f, -0.970953822f, 0.436760962f, 1.76884842f, -0.776037335f, -1.0f, 0.993584156f,
+		0.606620312f, -1.10311699f, 0.502013326f, 1.76884842f, -0.776037335f, -1.0f, 0.993584156f,
+		0.67355746f, -1.23528016f, 0.567265689f, 1.76884842f, -0.776037335f, -1.0f, 0.993584156f,
+		0.740494549f, -1.36744344f, 0.632518053f, 1.76884842f, -0.776037335f, -1.0f, 0.993584156f,
+		0.807431698f, -1.49960661f, 0.697770417f, 1.76884842f, -0.776037335f, -1.0f, 0.993584156f,
+		0.874368846f, -1.63176978f, 0.76302278f, 1.76884842f, -0.776037335f, -1.0f, 0.993584156f,
+		0.941305935f, -1.76393294f, 0.828275144f, 1.76884842f, -0.776037335f, -1.0f, 0.993584156f,
+		0.437479436f, -0.764405668f, 0.332373679f, 1.76974392f, -0.776907206f, -1.0f, 0.993692577f,
+		0.50084883f, -0.889468253f, 0.394092649f, 1.76974392f, -0.776907206f, -1.0f, 0.993692577f,
+		0.564218163f, -1.01453078f, 0.45581162f, 1.76974392f, -0.776907206f, -1.0f, 0.993692577f,
+		0.627587557f, -1.13959336f, 0.51753056f, 1.76974392f, -0.776907206f, -1.0f, 0.993692577f,
+		0.690956891f, -1.26465595f, 0.579249561f, 1.76974392f, -0.776907206f, -1.0f, 0.993692577f,
+		0.754326284f, -1.38971853f, 0.640968502f, 1.76974392f, -0.776907206f, -1.0f, 0.993692577f,
+		0.817695618f, -1.51478112f, 0.702687502f, 1.76974392f, -0.776907206f, -1.0f, 0.993692577f,
+		0.881065011f, -1.6398437f, 0.764406443f, 1.76974392f, -0.776907206f, -1.0f, 0.993692577f,
+		0.944434345f, -1.76490617f, 0.826125443f, 1.76974392f, -0.776907206f, -1.0f, 0.993692577f,
+		0.0193380769f, 0.0030664932f, -0.0162715837f, 1.7556951f, -0.763531625f, -1.0f, 0.994418144f,
+		0.129812121f, -0.216258839f, 0.0926046371f, 1.7556951f, -0.763531625f, -1.0f, 0.994418144f,
+		0.240286171f, -0.435584158f, 0.201480865f, 1.7556951f, -0.763531625f, -1.0f, 0.994418144f,
+		0.350760221f, -0.654909492f, 0.310357094f, 1.7556951f, -0.763531625f, -1.0f, 0.994418144f,
+		0.461234242f, -0.874234796f, 0.419233322f, 1.7556951f, -0.763531625f, -1.0f, 0.994418144f,
+		0.571708322f, -1.0935601f, 0.52810955f, 1.7556951f, -0.763531625f, -1.0f, 0.994418144f,
+		0.682182372f, -1.3128854f, 0.636985779f, 1.7556951f, -0.763531625f, -1.0f, 0.994418144f,
+		0.792656362f, -1.53221083f, 0.745862007f, 1.7556951f, -0.763531625f, -1.0f, 0.994418144f,
+		0.903130412f, -1.75153613f, 0.854738235f, 1.7556951f, -0.763531625f, -1.0f, 0.994418144f,
+		0.1027245f, -0.150922626f, 0.0540289953f, 1.76031053f, -0.767674744f, -1.0f, 0.994458258f,
+		0.203804851f, -0.351569325f, 0.153618619f, 1.76031053f, -0.767674744f, -1.0f, 0.994458258f,
+		0.304885209f, -0.552216053f, 0.25320825f, 1.76031053f, -0.767674744f, -1.0f, 0.994458258f,
+		0.405965567f, -0.752862751f, 0.352797866f, 1.76031053f, -0.767674744f, -1.0f, 0.994458258f,
+		0.507045925f, -0.95350945f, 0.452387482f, 1.76031053f, -0.767674744f, -1.0f, 0.994458258f,
+		0.608126283f, -1.15415621f, 0.551977098f, 1.76031053f, -0.767674744f, -1.0f, 0.994458258f,
+		0.709206641f, -1.35480285f, 0.651566744f, 1.76031053f, -0.767674744f, -1.0f, 0.994458258f,
+		0.810286999f, -1.5554496f, 0.75115633f, 1.76031053f, -0.767674744f, -1.0f, 0.994458258f,
+		0.911367297f, -1.75609624f, 0.850745976f, 1.76031053f, -0.767674744f, -1.0f, 0.994458258f,
+		0.173041165f, -0.280729771f, 0.113272831f, 1.76413751f, -0.771115124f, -1.0f, 0.994501352f,
+		0.266200155f, -0.465624422f, 0.205030337f, 1.76413751f, -0.771115124f, -1.0f, 0.994501352f,
+		0.359359175f, -0.650519073f, 0.296787858f, 1.76413751f, -0.771115124f, -1.0f, 0.994501352f,
+		0.452518165f, -0.835413694f, 0.388545364f, 1.76413751f, -0.771115124f, -1.0f, 0.994501352f,
+		0.545677185f, -1.02030838f, 0.48030287f, 1.76413751f, -0.771115124f, -1.0f, 0.994501352f,
+		0.638836205f, -1.20520294f, 0.572060406f, 1.76413751f, -0.771115124f, -1.0f, 0.994501352f,
+		0.731995165f, -1.39009762f, 0.663817883f, 1.76413751f, -0.771115124f, -1.0f, 0.994501352f,
+		0.825154185f, -1.57499218f, 0.755575418f, 1.76413751f, -0.771115124f, -1.0f, 0.994501352f,
+		0.918313205f, -1.75988686f, 0.847332954f, 1.76413751f, -0.771115124f, -1.0f, 0.994501352f,
+		0.233137533f, -0.391624451f, 0.163868323f, 1.76734424f, -0.774003029f, -1.0f, 0.994547248f,
+		0.319526523f, -0.563055456f, 0.24893105f, 1.76734424f, -0.774003029f, -1.0f, 0.994547248f,
+		0.405915529f, -0.734486461f, 0.333993793f, 1.76734424f, -0.774003029f, -1.0f, 0.994547248f,
+		0.492304504f, -0.905917466f, 0.419056505f, 1.76734424f, -0.774003029f, -1.0f, 0.994547248f,
+		0.578693509f, -1.07734847f, 0.504119217f, 1.76734424f, -0.774003029f, -1.0f, 0.994547248f,
+		0.665082514f, -1.24877954f, 0.58918196f, 1.76734424f, -0.774003029f, -1.0f, 0.994547248f,
+		0.751471519f, -1.4202106f, 0.674244702f, 1.76734424f, -0.774003029f, -1.0f, 0.994547248f,
+		0.837860525f, -1.59164155f, 0.759307384f, 1.76734424f, -0.774003029f, -1.0f, 0.994547248f,
+		0.92424947f, -1.76307261f, 0.844370127f, 1.76734424f, -0.774003029f, -1.0f, 0.994547248f,
+		0.285090864f, -0.487447888f, 0.207571059f, 1.77005327f, -0.776447713f, -1.0f, 0.994595826f,
+		0.36562717f, -0.647238553f, 0.286845118f, 1.77005327f, -0.776447713f, -1.0f, 0.994595826f,
+		0.446163505f, -0.807029247f, 0.366119146f, 1.77005327f, -0.776447713f, -1.0f, 0.994595826f,
+		0.526699841f, -0.966819882f, 0.445393205f, 1.77005327f, -0.776447713f, -1.0f, 0.994595826f,
+		0.607236147f, -1.12661052f, 0.524667263f, 1.77005327f, -0.776447713f, -1.0f, 0.994595826f,
+		0.687772453f, -1.28640115f, 0.603941262f, 1.77005327f, -0.776447713f, -1.0f, 0.994595826f,
+		0.768308759f, -1.44619191f, 0.68321532f, 1.77005327f, -0.776447713f, -1.0f, 0.994595826f,
+		0.848845124f, -1.60598254f, 0.762489378f, 1.77005327f, -0.776447713f, -1.0f, 0.994595826f,
+		0.92938143f, -1.76577318f, 0.841763377f, 1.77005327f, -0.776447713f, -1.0f, 0.994595826f,
+		0.330451161f, -0.57106626f, 0.245690852f, 1.77235568f, -0.778530657f, -1.0f, 0.994646847f,
+		0.405877531f, -0.720692694f, 0.319909781f, 1.77235568f, -0.778530657f, -1.0f, 0.994646847f,
+		0.4813039f, -0.870319188f, 0.39412871f, 1.77235568f, -0.778530657f, -1.0f, 0.994646847f,
+		0.55673027f, -1.01994562f, 0.468347609f, 1.77235568f, -0.778530657f, -1.0f, 0.994646847f,
+		0.63215667f, -1.169572f, 0.542566538f, 1.77235568f, -0.778530657f, -1.0f, 0.994646847f,
+		0.70758301f, -1.31919849f, 0.616785467f, 1.77235568f, -0.778530657f, -1.0f, 0.994646847f,
+		0.78300935f, -1.46882498f, 0.691004395f, 1.77235568f, -0.778530657f, -1.0f, 0.994646847f,
+		0.85843575f, -1.61845136f, 0.765223324f, 1.77235568f, -0.778530657f, -1.0f, 0.994646847f,
+		0.93386209f, -1.76807785f, 0.839442253f, 1.77235568f, -0.778530657f, -1.0f, 0.994646847f,
+		0.370398611f, -0.644661486f, 0.279224753f, 1.77432072f, -0.78031373f, -1.0f, 0.994700134f,
+		0.4413248f, -0.785335541f, 0.348990738f, 1.77432072f, -0.78031373f, -1.0f, 0.994700134f,
+		0.51225096f, -0.926009595f, 0.418756753f, 1.77432072f, -0.78031373f, -1.0f, 0.994700134f,
+		0.583177149f, -1.06668365f, 0.488522738f, 1.77432072f, -0.78031373f, -1.0f, 0.994700134f,
+		0.654103339f, -1.20735776f, 0.558288753f, 1.77432072f, -0.78031373f, -1.0f, 0.994700134f,
+		0.725029528f, -1.34803188f, 0.628054738f, 1.77432072f, -0.78031373f, -1.0f, 0.994700134f,
+		0.795955718f, -1.48870587f, 0.697820723f, 1.77432072f, -0.78031373f, -1.0f, 0.994700134f,
+		0.866881907f, -1.62937999f, 0.767586708f, 1.77432072f, -0.78031373f, -1.0f, 0.994700134f,
+		0.937808096f, -1.7700541f, 0.837352753f, 1.77432072f, -0.78031373f, -1.0f, 0.994700134f,
+		0.40584746f, -0.709923685f, 0.30894503f, 1.77600181f, -0.781844556f, -1.0f, 0.994755387f,
+		0.472780257f, -0.8426525f, 0.374758512f, 1.77600181f, -0.781844556f, -1.0f, 0.994755387f,
+		0.539713025f, -0.975381255f, 0.440571994f, 1.77600181f, -0.781844556f, -1.0f, 0.994755387f,
+		0.606645823f, -1.10811007f, 0.506385446f, 1.77600181f, -0.781844556f, -1.0f, 0.994755387f,
+		0.67357862f, -1.24083889f, 0.572198927f, 1.77600181f, -0.781844556f, -1.0f, 0.994755387f,
+		0.740511358f, -1.3735677f, 0.638012409f, 1.77600181f, -0.781844556f, -1.0f, 0.994755387f,
+		0.807444155f, -1.5062964f, 0.703825891f, 1.77600181f, -0.781844556f, -1.0f, 0.994755387f,
+		0.874376953f, -1.63902521f, 0.769639373f, 1.77600181f, -0.781844556f, -1.0f, 0.994755387f,
+		0.94130975f, -1.77175403f, 0.835452855f, 1.77600181f, -0.781844556f, -1.0f, 0.994755387f,
+		0.437517136f, -0.768182576f, 0.335459113f, 1.77744079f, -0.783160508f, -1.0f, 0.994812429f,
+		0.500882268f, -0.89381206f, 0.397740394f, 1.77744079f, -0.783160508f, -1.0f, 0.994812429f,
+		0.56424737f, -1.01944149f, 0.460021704f, 1.77744079f, -0.783160508f, -1.0f, 0.994812429f,
+		0.627612472f, -1.14507103f, 0.522302985f, 1.77744079f, -0.783160508f, -1.0f, 0.994812429f,
+		0.690977573f, -1.27070045f, 0.584584236f, 1.77744079f, -0.783160508f, -1.0f, 0.994812429f,
+		0.754342735f, -1.39633f, 0.646865547f, 1.77744079f, -0.783160508f, -1.0f, 0.994812429f,
+		0.817707837f, -1.52195942f, 0.709146857f, 1.77744079f, -0.783160508f, -1.0f, 0.994812429f,
+		0.881072938f, -1.64758897f, 0.771428108f, 1.77744079f, -0.783160508f, -1.0f, 0.994812429f,
+		0.94443804f, -1.77321839f, 0.833709419f, 1.77744079f, -0.783160508f, -1.0f, 0.994812429f,
+		0.0193808824f, 0.00307328091f, -0.0163076017f, 1.75862873f, -0.765892863f, -1.0f, 0.99582988f,
+		0.129850104f, -0.216741383f, 0.0930551067f, 1.75862873f, -0.765892863f, -1.0f, 0.99582988f,
+		0.240319327f, -0.436556041f, 0.202417821f, 1.75862873f, -0.765892863f, -1.0f, 0.99582988f,
+		0.350788534f, -0.656370699f, 0.311780542f, 1.75862873f, -0.765892863f, -1.0f, 0.99582988f,
+		0.461257786f, -0.876185358f, 0.421143234f, 1.75862873f, -0.765892863f, -1.0f, 0.99582988f,
+		0.571726978f, -1.09600008f, 0.530505955f, 1.75862873f, -0.765892863f, -1.0f, 0.99582988f,
+		0.6821962f, -1.31581473f, 0.639868677f, 1.75862873f, -0.765892863f, -1.0f, 0.99582988f,
+		0.792665422f, -1.53562939f, 0.749231398f, 1.75862873f, -0.765892863f, -1.0f, 0.99582988f,
+		0.903134644f, -1.75544405f, 0.85859406f, 1.75862873f, -0.765892863f, -1.0f, 0.99582988f,
+		0.102763064f, -0.151302814f, 0.054314848f, 1.76342225f, -0.770184338f, -1.0f, 0.995845675f,
+		0.203839079f, -0.352412671f, 0.15436472f, 1.76342225f, -0.770184338f, -1.0f, 0.995845675f,
+		0.304915071f, -0.553522527f, 0.254414588f, 1.76342225f, -0.770184338f, -1.0f, 0.995845675f,
+		0.405991077f, -0.754632413f, 0.354464442f, 1.76342225f, -0.770184338f, -1.0f, 0.995845675f,
+		0.507067084f, -0.95574224f, 0.454514325f, 1.76342225f, -0.770184338f, -1.0f, 0.995845675f,
+		0.608143091f, -1.15685213f, 0.554564178f, 1.76342225f, -0.770184338f, -1.0f, 0.995845675f,
+		0.709219098f, -1.35796201f, 0.654614031f, 1.76342225f, -0.770184338f, -1.0f, 0.995845675f,
+		0.810295105f, -1.55907178f, 0.754663944f, 1.76342225f, -0.770184338f, -1.0f, 0.995845675f,
+		0.911371112f, -1.76018167f, 0.854713798f, 1.76342225f, -0.770184338f, -1.0f, 0.995845675f,
+		0.173076391f, -0.28146109f, 0.113850392f, 1.76743567f, -0.773779571f, -1.0f, 0.995862782f,
+		0.266231418f, -0.466797471f, 0.206046715f, 1.76743567f, -0.773779571f, -1.0f, 0.995862782f,
+		0.359386444f, -0.652133882f, 0.298243016f, 1.76743567f, -0.773779571f, -1.0f, 0.995862782f,
+		0.4525415f, -0.837470233f, 0.390439361f, 1.76743567f, -0.773779571f, -1.0f, 0.995862782f,
+		0.545696497f, -1.02280664f, 0.482635677f, 1.76743567f, -0.773779571f, -1.0f, 0.995862782f,
+		0.638851583f, -1.208143f, 0.574831963f, 1.76743567f, -0.773779571f, -1.0f, 0.995862782f,
+		0.732006609f, -1.39347947f, 0.667028308f, 1.76743567f, -0.773779571f, -1.0f, 0.995862782f,
+		0.825161636f, -1.57881582f, 0.759224653f, 1.76743567f, -0.773779571f, -1.0f, 0.995862782f,
+		0.918316662f, -1.76415217f, 0.851420939f, 1.76743567f, -0.773779571f, -1.0f, 0.995862782f,
+		0.233170062f, -0.392680585f, 0.164715469f, 1.77083802f, -0.776829481f, -1.0f, 0.9958812f,
+		0.319555402f, -0.564535737f, 0.250199378f, 1.77083802f, -0.776829481f, -1.0f, 0.9958812f,
+		0.405940711f, -0.736390948f, 0.335683286f, 1.77083802f, -0.776829481f, -1.0f, 0.9958812f,
+		0.492326051f, -0.9082461f, 0.421167165f, 1.77083802f, -0.776829481f, -1.0f, 0.9958812f,
+		0.57871139f, -1.08010125f, 0.506651103f, 1.77083802f, -0.776829481f, -1.0f, 0.9958812f,
+		0.6650967f, -1.25195646f, 0.592135012f, 1.77083802f, -0.776829481f, -1.0f, 0.9958812f,
+		0.751482069f, -1.42381155f, 0.677618921f, 1.77083802f, -0.776829481f, -1.0f, 0.9958812f,
+		0.837867379f, -1.59566677f, 0.76310277f, 1.77083802f, -0.776829481f, -1.0f, 0.9958812f,
+		0.924252689f, -1.76752186f, 0.848586679f, 1.77083802f, -0.776829481f, -1.0f, 0.9958812f,
+		0.285121202f, -0.488809705f, 0.208671615f, 1.77375209f, -0.7794438f, -1.0f, 0.995900869f,
+		0.365654111f, -0.649010003f, 0.288352281f, 1.77375209f, -0.7794438f, -1.0f, 0.995900869f,
+		0.446187019f, -0.809210241f, 0.368032962f, 1.77375209f, -0.7794438f, -1.0f, 0.995900869f,
+		0.526719928f, -0.969410539f, 0.447713643f, 1.77375209f, -0.7794438f, -1.0f, 0.995900869f,
+		0.607252836f, -1.12961078f, 0.527394354f, 1.77375209f, -0.7794438f, -1.0f, 0.995900869f,
+		0.687785745f, -1.28981113f, 0.607075036f, 1.77375209f, -0.7794438f, -1.0f, 0.995900869f,
+		0.768318594f, -1.45001137f, 0.686755717f, 1.77375209f, -0.7794438f, -1.0f, 0.995900869f,
+		0.848851502f, -1.61021161f, 0.766436398f, 1.77375209f, -0.7794438f, -1.0f, 0.995900869f,
+		0.92938441f, -1.77041197f, 0.846117079f, 1.77375209f, -0.7794438f, -1.0f, 0.995900869f,
+		0.330479741f, -0.572720051f, 0.247033268f, 1.77626991f, -0.781704545f, -1.0f, 0.995921791f,
+		0.405902892f, -0.722744107f, 0.321646839f, 1.77626991f, -0.781704545f, -1.0f, 0.995921791f,
+		0.481326044f, -0.872768223f, 0.396260411f, 1.77626991f, -0.781704545f, -1.0f, 0.995921791f,
+		0.556749165f, -1.02279234f, 0.470873982f, 1.77626991f, -0.781704545f, -1.0f, 0.995921791f,
+		0.632172346f, -1.1728164f, 0.545487523f, 1.77626991f, -0.781704545f, -1.0f, 0.995921791f,
+		0.707595468f, -1.32284045f, 0.620101094f, 1.77626991f, -0.781704545f, -1.0f, 0.995921791f,
+		0.783018649f, -1.47286451f, 0.694714665f, 1.77626991f, -0.781704545f, -1.0f, 0.995921791f,
+		0.85844177f, -1.62288857f, 0.769328237f, 1.77626991f, -0.781704545f, -1.0f, 0.995921791f,
+		0.933864951f, -1.77291274f, 0.843941808f, 1.77626991f, -0.781704545f, -1.0f, 0.995921791f,
+		0.370425671f, -0.646597922f, 0.280801147f, 1.7784611f, -0.783674121f, -1.0f, 0.995943964f,
+		0.441348821f, -0.787659764f, 0.35095194f, 1.7784611f, -0.783674121f, -1.0f, 0.995943964f,
+		0.512271941f, -0.928721666f, 0.421102732f, 1.7784611f, -0.783674121f, -1.0f, 0.995943964f,
+		0.58319509f, -1.06978357f, 0.491253525f, 1.7784611f, -0.783674121f, -1.0f, 0.995943964f,
+		0.65411824f, -1.21084535f, 0.561404347f, 1.7784611f, -0.783674121f, -1.0f, 0.995943964f,
+		0.725041389f, -1.35190725f, 0.63155514f, 1.7784611f, -0.783674121f, -1.0f, 0.995943964f,
+		0.795964479f, -1.49296916f, 0.701705933f, 1.7784611f, -0.783674121f, -1.0f, 0.995943964f,
+		0.866887629f, -1.63403106f, 0.771856725f, 1.7784611f, -0.783674121f, -1.0f, 0.995943964f,
+		0.937810779f, -1.77509296f, 0.842007518f, 1.7784611f, -0.783674121f, -1.0f, 0.995943964f,
+		0.405873299f, -0.712137043f, 0.310750514f, 1.78037989f, -0.785400808f, -1.0f, 0.995967269f,
+		0.472803175f, -0.845245659f, 0.376940787f, 1.78037989f, -0.785400808f, -1.0f, 0.995967269f,
+		0.539733052f, -0.978354275f, 0.443131059f, 1.78037989f, -0.785400808f, -1.0f, 0.995967269f,
+		0.606662929f, -1.11146283f, 0.509321332f, 1.78037989f, -0.785400808f, -1.0f, 0.995967269f,
+		0.673592806f, -1.24457145f, 0.575511575f, 1.78037989f, -0.785400808f, -1.0f, 0.995967269f,
+		0.740522683f, -1.37768006f, 0.641701877f, 1.78037989f, -0.785400808f, -1.0f, 0.995967269f,
+		0.807452559f, -1.51078868f, 0.70789212f, 1.78037989f, -0.785400808f, -1.0f, 0.995967269f,
+		0.874382436f, -1.64389718f, 0.774082363f, 1.78037989f, -0.785400808f, -1.0f, 0.995967269f,
+		0.941312313f, -1.77700579f, 0.840272665f, 1.78037989f, -0.785400808f, -1.0f, 0.995967269f,
+		0.437541932f, -0.770670176f, 0.337491333f, 1.78206861f, -0.786922455f, -1.0f, 0.995991707f,
+		0.500904262f, -0.896673024f, 0.400142998f, 1.78206861f, -0.786922455f, -1.0f, 0.995991707f,
+		0.564266562f, -1.02267587f, 0.462794632f, 1.78206861f, -0.786922455f, -1.0f, 0.995991707f,
+		0.627628922f, -1.14867878f, 0.525446296f, 1.78206861f, -0.786922455f, -1.0f, 0.995991707f,
+		0.690991223f, -1.27468169f, 0.58809793f, 1.78206861f, -0.786922455f, -1.0f, 0.995991707f,
+		0.754353523f, -1.4006846f, 0.650749624f, 1.78206861f, -0.786922455f, -1.0f, 0.995991707f,
+		0.817715883f, -1.5266875f, 0.713401258f, 1.78206861f, -0.786922455f, -1.0f, 0.995991707f,
+		0.881078184f, -1.65269041f, 0.776052952f, 1.78206861f, -0.786922455f, -1.0f, 0.995991707f,
+		0.944440544f, -1.7786932f, 0.838704586f, 1.78206861f, -0.786922455f, -1.0f, 0.995991707f,
+		0.0194117185f, 0.00307817082f, -0.0163335484f, 1.76058173f, -0.767466247f, -1.0f, 0.99700743f,
+		0.129877463f, -0.217089012f, 0.0933796391f, 1.76058173f, -0.767466247f, -1.0f, 0.99700743f,
+		0.240343213f, -0.437256217f, 0.203092828f, 1.76058173f, -0.767466247f, -1.0f, 0.99700743f,
+		0.350808978f, -0.657423377f, 0.31280601f, 1.76058173f, -0.767466247f, -1.0f, 0.99700743f,
+		0.461274713f, -0.877590597f, 0.422519207f, 1.76058173f, -0.767466247f, -1.0f, 0.99700743f,
+		0.571740448f, -1.09775782f, 0.532232404f, 1.76058173f, -0.767466247f, -1.0f, 0.99700743f,
+		0.682206213f, -1.31792498f, 0.641945601f, 1.76058173f, -0.767466247f, -1.0f, 0.99700743f,
+		0.792671978f, -1.53809214f, 0.751658797f, 1.76058173f, -0.767466247f, -1.0f, 0.99700743f,
+		0.903137684f, -1.7582593f, 0.861371934f, 1.76058173f, -0.767466247f, -1.0f, 0.99700743f,
+		0.102790564f, -0.151573896f, 0.0545186587f, 1.76546276f, -0.771831512f, -1.0f, 0.997012973f,
+		0.203863472f, -0.353013963f, 0.154896677f, 1.76546276f, -0.771831512f, -1.0f, 0.997012973f,
+		0.304936379f, -0.554454088f, 0.255274713f, 1.76546276f, -0.771831512f, -1.0f, 0.997012973f,
+		0.406009287f, -0.755894125f, 0.35565272f, 1.76546276f, -0.771831512f, -1.0f, 0.997012973f,
+		0.507082224f, -0.95733422f, 0.456030756f, 1.76546276f, -0.771831512f, -1.0f, 0.997012973f,
+		0.608155131f, -1.15877438f, 0.556408763f, 1.76546276f, -0.771831512f, -1.0f, 0.997012973f,
+		0.709228039f, -1.36021435f, 0.656786799f, 1.76546276f, -0.771831512f, -1.0f, 0.997012973f,
+		0.810300946f, -1.56165445f, 0.757164836f, 1.76546276f, -0.771831512f, -1.0f, 0.997012973f,
+		0.911373854f, -1.76309454f, 0.857542813f, 1.76546276f, -0.771831512f, -1.0f, 0.997012973f,
+		0.173101231f, -0.281976998f, 0.114257827f, 1.76956654f, -0.775502503f, -1.0f, 0.997018993f,
+		0.266253471f, -0.467625022f, 0.2067637f, 1.76956654f, -0.775502503f, -1.0f, 0.997018993f,
+		0.359405696f, -0.653273046f, 0.299269587f, 1.76956654f, -0.775502503f, -1.0f, 0.997018993f,
+		0.452557951f, -0.83892107f, 0.391775459f, 1.76956654f, -0.775502503f, -1.0f, 0.997018993f,
+		0.545710206f, -1.02456903f, 0.484281331f, 1.76956654f, -0.775502503f, -1.0f, 0.997018993f,
+		0.638862431f, -1.21021712f, 0.576787174f, 1.76956654f, -0.775502503f, -1.0f, 0.997018993f,
+		0.732014656f, -1.39586508f, 0.669293046f, 1.76956654f, -0.775502503f, -1.0f, 0.997018993f,
+		0.825166881f, -1.58151317f, 0.761798918f, 1.76956654f, -0.775502503f, -1.0f, 0.997018993f,
+		0.918319106f, -1.76716113f, 0.85430479f, 1.76956654f, -0.775502503f, -1.0f, 0.997018993f,
+		0.233192772f, -0.393417507f, 0.165306538f, 1.77306211f, -0.778630257f, -1.0f, 0.99702549f,
+		0.319575548f, -0.565568626f, 0.251084328f, 1.77306211f, -0.778630257f, -1.0f, 0.99702549f,
+		0.405958325f, -0.737719715f, 0.336862087f, 1.77306211f, -0.778630257f, -1.0f, 0.99702549f,
+		0.492341071f, -0.909870863f, 0.422639877f, 1.77306211f, -0.778630257f, -1.0f, 0.99702549f,
+		0.578723848f, -1.08202195f, 0.508417666f, 1.77306211f, -0.778630257f, -1.0f, 0.99702549f,
+		0.665106654f, -1.25417304f, 0.594195426f, 1.77306211f, -0.778630257f, -1.0f, 0.99702549f,
+		0.751489401f, -1.42632413f, 0.679973245f, 1.77306211f, -0.778630257f, -1.0f, 0.99702549f,
+		0.837872148f, -1.59847522f, 0.765751004f, 1.77306211f, -0.778630257f, -1.0f, 0.99702549f,
+		0.924254954f, -1.77062643f, 0.851528764f, 1.77306211f, -0.778630257f, -1.0f, 0.99702549f,
+		0.285142154f, -0.489749193f, 0.209430873f, 1.77607274f, -0.781324923f, -1.0f, 0.997032464f,
+		0.365672678f, -0.650232077f, 0.289392084f, 1.77607274f, -0.781324923f, -1.0f, 0.997032464f,
+		0.446203232f, -0.81071496f, 0.369353294f, 1.77607274f, -0.781324923f, -1.0f, 0.997032464f,
+		0.526733756f, -0.971197844f, 0.449314535f, 1.77607274f, -0.781324923f, -1.0f, 0.997032464f,
+		0.60726434f, -1.13168073f, 0.529275715f, 1.77607274f, -0.781324923f, -1.0f, 0.997032464f,
+		0.687794864f, -1.29216361f, 0.609236956f, 1.77607274f, -0.781324923f, -1.0f, 0.997032464f,
+		0.768325388f, -1.45264649f, 0.689198196f, 1.77607274f, -0.781324923f, -1.0f, 0.997032464f,
+		0.848855972f, -1.61312926f, 0.769159377f, 1.77607274f, -0.781324923f, -1.0f, 0.997032464f,
+		0.929386497f, -1.77361214f, 0.849120617f, 1.77607274f, -0.781324923f, -1.0f, 0.997032464f,
+		0.330499202f, -0.573847771f, 0.247948661f, 1.77869034f, -0.783668637f, -1.0f, 0.997039914f,
+		0.405920148f, -0.724142969f, 0.322831333f, 1.77869034f, -0.783668637f, -1.0f, 0.997039914f,
+		0.481341124f, -0.874438226f, 0.397714019f, 1.77869034f, -0.783668637f, -1.0f, 0.997039914f,
+		0.556762099f, -1.02473342f, 0.472596675f, 1.77869034f, -0.783668637f, -1.0f, 0.997039914f,
+		0.632183015f, -1.17502868f, 0.547479331f, 1.77869034f, -0.783668637f, -1.0f, 0.997039914f,
+		0.707603991f, -1.32532394f, 0.622362018f, 1.77869034f, -0.783668637f, -1.0f, 0.997039914f,
+		0.783024967f, -1.47561908f, 0.697244704f, 1.77869034f, -0.783668637f, -1.0f, 0.997039914f,
+		0.858445883f, -1.62591434f, 0.77212739f, 1.77869034f, -0.783668637f, -1.0f, 0.997039914f,
+		0.933866858f, -1.77620959f, 0.847010076f, 1.77869034f, -0.783668637f, -1.0f, 0.997039914f,
+		0.37044391f, -0.647902548f, 0.281863242f, 1.78098488f, -0.785723925f, -1.0f, 0.997047842f,
+		0.441365004f, -0.789225698f, 0.352273285f, 1.78098488f, -0.785723925f, -1.0f, 0.997047842f,
+		0.512286067f, -0.930548906f, 0.422683328f, 1.78098488f, -0.785723925f, -1.0f, 0.997047842f,
+		0.58320719f, -1.071872f, 0.493093401f, 1.78098488f, -0.785723925f, -1.0f, 0.997047842f,
+		0.654128253f, -1.2131952f, 0.563503444f, 1.78098488f, -0.785723925f, -1.0f, 0.997047842f,
+		0.725049317f, -1.35451829f, 0.633913517f, 1.78098488f, -0.785723925f, -1.0f, 0.997047842f,
+		0.79597044f, -1.4958415f, 0.70432353f, 1.78098488f, -0.785723925f, -1.0f, 0.997047842f,
+		0.866891503f, -1.63716471f, 0.774733603f, 1.78098488f, -0.785723925f, -1.0f, 0.997047842f,
+		0.937812567f, -1.7784878f, 0.845143616f, 1.78098488f, -0.785723925f, -1.0f, 0.997047842f,
+		0.405890495f, -0.713609934f, 0.311951965f, 1.7830106f, -0.787539184f, -1.0f, 0.997056246f,
+		0.472818434f, -0.846971273f, 0.378392965f, 1.7830106f, -0.787539184f, -1.0f, 0.997056246f,
+		0.539746344f, -0.980332553f, 0.444833934f, 1.7830106f, -0.787539184f, -1.0f, 0.997056246f,
+		0.606674314f, -1.11369395f, 0.511274934f, 1.7830106f, -0.787539184f, -1.0f, 0.997056246f,
+		0.673602223f, -1.24705529f, 0.577715933f, 1.7830106f, -0.787539184f, -1.0f, 0.997056246f,
+		0.740530193f, -1.38041651f, 0.644156933f, 1.7830106f, -0.787539184f, -1.0f, 0.997056246f,
+		0.807458103f, -1.51377785f, 0.710597932f, 1.7830106f, -0.787539184f, -1.0f, 0.997056246f,
+		0.874386072f, -1.64713919f, 0.777038932f, 1.7830106f, -0.787539184f, -1.0f, 0.997056246f,
+		0.941313982f, -1.78050053f, 0.843479931f, 1.7830106f, -0.787539184f, -1.0f, 0.997056246f,
+		0.437558234f, -0.772304416f, 0.338826418f, 1.7848103f, -0.789152563f, -1.0f, 0.997065127f,
+		0.500918746f, -0.898552656f, 0.401721388f, 1.7848103f, -0.789152563f, -1.0f, 0.997065127f,
+		0.564279199f, -1.02480078f, 0.464616388f, 1.7848103f, -0.789152563f, -1.0f, 0.997065127f,
+		0.627639711f, -1.15104902f, 0.527511358f, 1.7848103f, -0.789152563f, -1.0f, 0.997065127f,
+		0.691000164f, -1.27729726f, 0.590406358f, 1.7848103f, -0.789152563f, -1.0f, 0.997065127f,
+		0.754360676f, -1.40354538f, 0.653301299f, 1.7848103f, -0.789152563f, -1.0f, 0.997065127f,
+		0.817721128f, -1.52979362f, 0.716196299f, 1.7848103f, -0.789152563f, -1.0f, 0.997065127f,
+		0.881081641f, -1.65604174f, 0.779091239f, 1.7848103f, -0.789152563f, -1.0f, 0.997065127f,
+		0.944442153f, -1.78228998f, 0.841986239f, 1.7848103f, -0.789152563f, -1.0f, 0.997065127f,
+		0.01943326f, 0.00308158668f, -0.0163516738f, 1.76186037f, -0.768497169f, -1.0f, 0.997915626f,
+		0.129896581f, -0.217331856f, 0.0936063305f, 1.76186037f, -0.768497169f, -1.0f, 0.997915626f,
+		0.240359902f, -0.437745303f, 0.203564331f, 1.76186037f, -0.768497169f, -1.0f, 0.997915626f,
+		0.350823224f, -0.65815872f, 0.313522339f, 1.76186037f, -0.768497169f, -1.0f, 0.997915626f,
+		0.461286545f, -0.878572166f, 0.423480362f, 1.76186037f, -0.768497169f, -1.0f, 0.997915626f,
+		0.571749866f, -1.09898555f, 0.533438325f, 1.76186037f, -0.768497169f, -1.0f, 0.997915626f,
+		0.682213187f, -1.319399f, 0.643396378f, 1.76186037f, -0.768497169f, -1.0f, 0.997915626f,
+		0.792676508f, -1.53981245f, 0.753354371f, 1.76186037f, -0.768497169f, -1.0f, 0.997915626f,
+		0.90313983f, -1.76022589f, 0.863312364f, 1.76186037f, -0.768497169f, -1.0f, 0.997915626f,
+		0.10280963f, -0.15176186f, 0.0546599887f, 1.76678276f, -0.77289784f, -1.0f, 0.997917414f,
+		0.203880399f, -0.353430927f, 0.155265555f, 1.76678276f, -0.77289784f, -1.0f, 0.997917414f,
+		0.304951161f, -0.555100024f, 0.255871147f, 1.76678276f, -0.77289784f, -1.0f, 0.997917414f,
+		0.406021923f, -0.756769061f, 0.356476694f, 1.76678276f, -0.77289784f, -1.0f, 0.997917414f,
+		0.507092655f, -0.958438158f, 0.457082272f, 1.76678276f, -0.77289784f, -1.0f, 0.997917414f,
+		0.608163416f, -1.16010725f, 0.557687879f, 1.76678276f, -0.77289784f, -1.0f, 0.997917414f,
+		0.709234178f, -1.36177635f, 0.658293426f, 1.76678276f, -0.77289784f, -1.0f, 0.997917414f,
+		0.810304999f, -1.56344533f, 0.758898973f, 1.76678276f, -0.77289784f, -1.0f, 0.997917414f,
+		0.911375761f, -1.76511443f, 0.85950458f, 1.76678276f, -0.77289784f, -1.0f, 0.997917414f,
+		0.173118338f, -0.282332093f, 0.114538252f, 1.77092862f, -0.776604593f, -1.0f, 0.997919321f,
+		0.266268641f, -0.468194574f, 0.207257181f, 1.77092862f, -0.776604593f, -1.0f, 0.997919321f,
+		0.359418958f, -0.654057086f, 0.29997611f, 1.77092862f, -0.776604593f, -1.0f, 0.997919321f,
+		0.452569276f, -0.839919567f, 0.39269501f, 1.77092862f, -0.776604593f, -1.0f, 0.997919321f,
+		0.545719564f, -1.02578211f, 0.485413939f, 1.77092862f, -0.776604593f, -1.0f, 0.997919321f,
+		0.638869882f, -1.21164453f, 0.578132868f, 1.77092862f, -0.776604593f, -1.0f, 0.997919321f,
+		0.732020199f, -1.39750707f, 0.670851827f, 1.77092862f, -0.776604593f, -1.0f, 0.997919321f,
+		0.825170517f, -1.58336961f, 0.763570726f, 1.77092862f, -0.776604593f, -1.0f, 0.997919321f,
+		0.918320835f, -1.76923203f, 0.856289625f, 1.77092862f, -0.776604593f, -1.0f, 0.997919321f,
+		0.233208269f, -0.393920839f, 0.165710256f, 1.77446687f, -0.779768527f, -1.0f, 0.997921467f,
+		0.319589287f, -0.566274107f, 0.251688778f, 1.77446687f, -0.779768527f, -1.0f, 0.997921467f,
+		0.405970335f, -0.738627315f, 0.337667257f, 1.77446687f, -0.779768527f, -1.0f, 0.997921467f,
+		0.492351353f, -0.910980582f, 0.423645765f, 1.77446687f, -0.779768527f, -1.0f, 0.997921467f,
+		0.578732371f, -1.08333385f, 0.509624302f, 1.77446687f, -0.779768527f, -1.0f, 0.997921467f,
+		0.665113389f, -1.25568712f, 0.595602751f, 1.77446687f, -0.779768527f, -1.0f, 0.997921467f,
+		0.751494408f, -1.42804027f, 0.681581259f, 1.77446687f, -0.779768527f, -1.0f, 0.997921467f,
+		0.837875426f, -1.60039353f, 0.767559767f, 1.77446687f, -0.779768527f, -1.0f, 0.997921467f,
+		0.924256504f, -1.7727468f, 0.853538275f, 1.77446687f, -0.779768527f, -1.0f, 0.997921467f,
+		0.285156339f, -0.49038592f, 0.20994544f, 1.77752113f, -0.782499909f, -1.0f, 0.997923732f,
+		0.365685284f, -0.651060343f, 0.29009679f, 1.77752113f, -0.782499909f, -1.0f, 0.997923732f,
+		0.446214229f, -0.811734736f, 0.370248139f, 1.77752113f, -0.782499909f, -1.0f, 0.997923732f,
+		0.526743174f, -0.972409129f, 0.450399488f, 1.77752113f, -0.782499909f, -1.0f, 0.997923732f,
+		0.607272089f, -1.13308346f, 0.530550838f, 1.77752113f, -0.782499909f, -1.0f, 0.997923732f,
+		0.687801063f, -1.29375792f, 0.610702157f, 1.77752113f, -0.782499909f, -1.0f, 0.997923732f,
+		0.768330038f, -1.45443225f, 0.690853536f, 1.77752113f, -0.782499909f, -1.0f, 0.997923732f,
+		0.848858953f, -1.6151067f, 0.771004856f, 1.77752113f, -0.782499909f, -1.0f, 0.997923732f,
+		0.929387927f, -1.77578104f, 0.851156175f, 1.77752113f, -0.782499909f, -1.0f, 0.997923732f,
+		0.330512285f, -0.574606001f, 0.248564139f, 1.7801832f, -0.784880996f, -1.0f, 0.997926116f,
+		0.405931771f, -0.72508353f, 0.32362774f, 1.7801832f, -0.784880996f, -1.0f, 0.997926116f,
+		0.481351256f, -0.875561059f, 0.398691356f, 1.7801832f, -0.784880996f, -1.0f, 0.997926116f,
+		0.556770742f, -1.02603865f, 0.473754972f, 1.7801832f, -0.784880996f, -1.0f, 0.997926116f,
+		0.632190228f, -1.17651618f, 0.548818588f, 1.7801832f, -0.784880996f, -1.0f, 0.997926116f,
+		0.707609713f, -1.3269937f, 0.623882174f, 1.7801832f, -0.784880996f, -1.0f, 0.997926116f,
+		0.783029199f, -1.47747123f, 0.69894582f, 1.7801832f, -0.784880996f, -1.0f, 0.997926116f,
+		0.858448684f, -1.62794876f, 0.774009407f, 1.7801832f, -0.784880996f, -1.0f, 0.997926116f,
+		0.93386817f, -1.77842629f, 0.849073052f, 1.7801832f, -0.784880996f, -1.0f, 0.997926116f,
+		0.37045607f, -0.648772717f, 0.282571584f, 1.78252339f, -0.78697437f, -1.0f, 0.997928679f,
+		0.441375792f, -0.79027009f, 0.35315454f, 1.78252339f, -0.78697437f, -1.0f, 0.997928679f,
+		0.512295485f, -0.931767523f, 0.423737496f, 1.78252339f, -0.78697437f, -1.0f, 0.997928679f,
+		0.583215237f, -1.07326496f, 0.494320452f, 1.78252339f, -0.78697437f, -1.0f, 0.997928679f,
+		0.654134929f, -1.21476233f, 0.564903438f, 1.78252339f, -0.78697437f, -1.0f, 0.997928679f,
+		0.725054622f, -1.3562597f, 0.635486364f, 1.78252339f, -0.78697437f, -1.0f, 0.997928679f,
+		0.795974374f, -1.4977572f, 0.70606935f, 1.78252339f, -0.78697437f, -1.0f, 0.997928679f,
+		0.866894066f, -1.63925457f, 0.776652277f, 1.78252339f, -0.78697437f, -1.0f, 0.997928679f,
+		0.937813818f, -1.78075194f, 0.847235203f, 1.78252339f, -0.78697437f, -1.0f, 0.997928679f,
+		0.405901879f, -0.714584112f, 0.312746644f, 1.78459585f, -0.788828552f, -1.0f, 0.997931421f,
+		0.472828537f, -0.848112643f, 0.379353464f, 1.78459585f, -0.788828552f, -1.0f, 0.997931421f,
+		0.539755166f, -0.981641114f, 0.445960283f, 1.78459585f, -0.788828552f, -1.0f, 0.997931421f,
+		0.606681824f, -1.11516964f, 0.512567103f, 1.78459585f, -0.788828552f, -1.0f, 0.997931421f,
+		0.673608482f, -1.24869812f, 0.579173982f, 1.78459585f, -0.788828552f, -1.0f, 0.997931421f,
+		0.74053514f, -1.38222659f, 0.645780802f, 1.78459585f, -0.788828552f, -1.0f, 0.997931421f,
+		0.807461798f, -1.51575506f, 0.712387621f, 1.78459585f, -0.788828552f, -1.0f, 0.997931421f,
+		0.874388456f, -1.64928353f, 0.778994441f, 1.78459585f, -0.788828552f, -1.0f, 0.997931421f,
+		0.941315114f, -1.78281212f, 0.845601261f, 1.78459585f, -0.788828552f, -1.0f, 0.997931421f,
+		0.437568933f, -0.773376286f, 0.33970207f, 1.78644323f, -0.790481806f, -1.0f, 0.997934341f,
+		0.500928223f, -0.899785399f, 0.402756631f, 1.78644323f, -0.790481806f, -1.0f, 0.997934341f,
+		0.564287484f, -1.02619445f, 0.465811163f, 1.78644323f, -0.790481806f, -1.0f, 0.997934341f,
+		0.627646804f, -1.15260351f, 0.528865755f, 1.78644323f, -0.790481806f, -1.0f, 0.997934341f,
+		0.691006064f, -1.27901268f, 0.591920316f, 1.78644323f, -0.790481806f, -1.0f, 0.997934341f,
+		0.754365325f, -1.40542173f, 0.654974878f, 1.78644323f, -0.790481806f, -1.0f, 0.997934341f,
+		0.817724645f, -1.53183079f, 0.718029439f, 1.78644323f, -0.790481806f, -1.0f, 0.997934341f,
+		0.881083906f, -1.65823984f, 0.781084001f, 1.78644323f, -0.790481806f, -1.0f, 0.997934341f,
+		0.944443166f, -1.78464901f, 0.844138563f, 1.78644323f, -0.790481806f, -1.0f, 0.997934341f,
+		0.0194479842f, 0.0030839215f, -0.0163640622f, 1.76269245f, -0.769168437f, -1.0f, 0.99857831f,
+		0.129909649f, -0.217497841f, 0.0937612876f, 1.76269245f, -0.769168437f, -1.0f, 0.99857831f,
+		0.240371317f, -0.438079596f, 0.203886643f, 1.76269245f, -0.769168437f, -1.0f, 0.99857831f,
+		0.350832969f, -0.658661366f, 0.314011991f, 1.76269245f, -0.769168437f, -1.0f, 0.99857831f,
+		0.461294621f, -0.879243135f, 0.424137354f, 1.76269245f, -0.769168437f, -1.0f, 0.99857831f,
+		0.571756303f, -1.09982491f, 0.534262717f, 1.76269245f, -0.769168437f, -1.0f, 0.99857831f,
+		0.682217956f, -1.32040668f, 0.64438802f, 1.76269245f, -0.769168437f, -1.0f, 0.99857831f,
+		0.792679608f, -1.54098845f, 0.754513383f, 1.76269245f, -0.769168437f, -1.0f, 0.99857831f,
+		0.90314126f, -1.76157022f, 0.864638746f, 1.76269245f, -0.769168437f, -1.0f, 0.99857831f,
+		0.102822602f, -0.151889697f, 0.0547561049f, 1.76763415f, -0.773586094f, -1.0f, 0.998578846f,
+		0.203891903f, -0.353714526f, 0.155516431f, 1.76763415f, -0.773586094f, -1.0f, 0.998578846f,
+		0.304961205f, -0.55553931f, 0.256276757f, 1.76763415f, -0.773586094f, -1.0f, 0.998578846f,
+		0.406030506f, -0.757364154f, 0.357037097f, 1.76763415f, -0.773586094f, -1.0f, 0.998578846f,
+		0.507099807f, -0.959188938f, 0.457797438f, 1.76763415f, -0.773586094f, -1.0f, 0.998578846f,
+		0.608169079f, -1.16101372f, 0.558557749f, 1.76763415f, -0.773586094f, -1.0f, 0.998578846f,
+		0.70923841f, -1.36283851f, 0.659318089f, 1.76763415f, -0.773586094f, -1.0f, 0.998578846f,
+		0.810307741f, -1.56466341f, 0.76007843f, 1.76763415f, -0.773586094f, -1.0f, 0.998578846f,
+		0.911377013f, -1.76648819f, 0.860838771f, 1.76763415f, -0.773586094f, -1.0f, 0.998578846f,
+		0.173129901f, -0.282572329f, 0.114727989f, 1.77179921f, -0.777309537f, -1.0f, 0.998579443f,
+		0.266278923f, -0.468579948f, 0.207591072f, 1.77179921f, -0.777309537f, -1.0f, 0.998579443f,
+		0.359427929f, -0.654587567f, 0.30045414f, 1.77179921f, -0.777309537f, -1.0f, 0.998579443f,
+		0.452576935f, -0.840595186f, 0.393317223f, 1.77179921f, -0.777309537f, -1.0f, 0.998579443f,
+		0.545725942f, -1.02660286f, 0.486180305f, 1.77179921f, -0.777309537f, -1.0f, 0.998579443f,
+		0.638874948f, -1.21261048f, 0.579043388f, 1.77179921f, -0.777309537f, -1.0f, 0.998579443f,
+		0.732023954f, -1.3986181f, 0.671906471f, 1.77179921f, -0.777309537f, -1.0f, 0.998579443f,
+		0.825172961f, -1.58462572f, 0.764769554f, 1.77179921f, -0.777309537f, -1.0f, 0.998579443f,
+		0.918321967f, -1.77063334f, 0.857632637f, 1.77179921f, -0.777309537f, -1.0f, 0.998579443f,
+		0.233218715f, -0.394259661f, 0.165982023f, 1.77535689f, -0.7804901f, -1.0f, 0.998580098f,
+		0.319598556f, -0.566748977f, 0.25209564f, 1.77535689f, -0.7804901f, -1.0f, 0.998580098f,
+		0.405978411f, -0.739238262f, 0.338209242f, 1.77535689f, -0.7804901f, -1.0f, 0.998580098f,
+		0.492358267f, -0.911727607f, 0.424322844f, 1.77535689f, -0.7804901f, -1.0f, 0.998580098f,
+		0.578738093f, -1.08421683f, 0.510436475f, 1.77535689f, -0.7804901f, -1.0f, 0.998580098f,
+		0.665117979f, -1.25670624f, 0.596550107f, 1.77535689f, -0.7804901f, -1.0f, 0.998580098f,
+		0.751497805f, -1.42919552f, 0.682663679f, 1.77535689f, -0.7804901f, -1.0f, 0.998580098f,
+		0.837877691f, -1.60168481f, 0.768777311f, 1.77535689f, -0.7804901f, -1.0f, 0.998580098f,
+		0.924257517f, -1.77417409f, 0.854890943f, 1.77535689f, -0.7804901f, -1.0f, 0.998580098f,
+		0.285165846f, -0.490812272f, 0.21029f, 1.77843058f, -0.783238173f, -1.0f, 0.998580813f,
+		0.365693718f, -0.651614904f, 0.29056865f, 1.77843058f, -0.783238173f, -1.0f, 0.998580813f,
+		0.44622159f, -0.812417507f, 0.370847285f, 1.77843058f, -0.783238173f, -1.0f, 0.998580813f,
+		0.526749432f, -0.97322017f, 0.45112595f, 1.77843058f, -0.783238173f, -1.0f, 0.998580813f,
+		0.607277334f, -1.13402283f, 0.531404614f, 1.77843058f, -0.783238173f, -1.0f, 0.998580813f,
+		0.687805235f, -1.29482543f, 0.611683249f, 1.77843058f, -0.783238173f, -1.0f, 0.998580813f,
+		0.768333077f, -1.45562804f, 0.691961884f, 1.77843058f, -0.783238173f, -1.0f, 0.998580813f,
+		0.848860979f, -1.61643076f, 0.77224052f, 1.77843058f, -0.783238173f, -1.0f, 0.998580813f,
+		0.929388821f, -1.77723336f, 0.852519214f, 1.77843058f, -0.783238173f, -1.0f, 0.998580813f,
+		0.330521017f, -0.575110972f, 0.248974055f, 1.78111243f, -0.785635948f, -1.0f, 0.998581529f,
+		0.405939519f, -0.725709915f, 0.324158192f, 1.78111243f, -0.785635948f, -1.0f, 0.998581529f,
+		0.481358021f, -0.876308918f, 0.399342299f, 1.78111243f, -0.785635948f, -1.0f, 0.998581529f,
+		0.556776524f, -1.0269078f, 0.474526405f, 1.78111243f, -0.785635948f, -1.0f, 0.998581529f,
+		0.632194996f, -1.1775068f, 0.549710512f, 1.78111243f, -0.785635948f, -1.0f, 0.998581529f,
+		0.707613528f, -1.32810581f, 0.624894679f, 1.78111243f, -0.785635948f, -1.0f, 0.998581529f,
+		0.783032f, -1.47870469f, 0.700078785f, 1.78111243f, -0.785635948f, -1.0f, 0.998581529f,
+		0.858450532f, -1.62930369f, 0.775262892f, 1.78111243f, -0.785635948f, -1.0f, 0.998581529f,
+		0.933869004f, -1.7799027f, 0.850446999f, 1.78111243f, -0.785635948f, -1.0f, 0.998581529f,
+		0.370464146f, -0.649349093f, 0.283040822f, 1.78347242f, -0.787746191f, -1.0f, 0.998582304f,
+		0.441382945f, -0.790961921f, 0.353738308f, 1.78347242f, -0.787746191f, -1.0f, 0.998582304f,
+		0.512301743f, -0.932574749f, 0.424435794f, 1.78347242f, -0.787746191f, -1.0f, 0.998582304f,
+		0.583220541f, -1.07418764f, 0.495133281f, 1.78347242f, -0.787746191f, -1.0f, 0.998582304f,
+		0.65413934f, -1.2158004f, 0.565830767f, 1.78347242f, -0.787746191f, -1.0f, 0.998582304f,
+		0.725058198f, -1.35741329f, 0.636528254f, 1.78347242f, -0.787746191f, -1.0f, 0.998582304f,
+		0.795976996f, -1.49902618f, 0.70722574f, 1.78347242f, -0.787746191f, -1.0f, 0.998582304f,
+		0.866895795f, -1.64063895f, 0.777923226f, 1.78347242f, -0.787746191f, -1.0f, 0.998582304f,
+		0.937814593f, -1.78225183f, 0.848620772f, 1.78347242f, -0.787746191f, -1.0f, 0.998582304f,
+		0.405909359f, -0.715225935f, 0.313270152f, 1.78556502f, -0.78961736f, -1.0f, 0.998583138f,
+		0.472835183f, -0.848864555f, 0.379986256f, 1.78556502f, -0.78961736f, -1.0f, 0.998583138f,
+		0.539761007f, -0.982503176f, 0.446702331f, 1.78556502f, -0.78961736f, -1.0f, 0.998583138f,
+		0.606686771f, -1.1161418f, 0.513418436f, 1.78556502f, -0.78961736f, -1.0f, 0.998583138f,
+		0.673612595f, -1.24978042f, 0.580134511f, 1.78556502f, -0.78961736f, -1.0f, 0.998583138f,
+		0.740538418f, -1.38341904f, 0.646850586f, 1.78556502f, -0.78961736f, -1.0f, 0.998583138f,
+		0.807464242f, -1.51705766f, 0.713566661f, 1.78556502f, -0.78961736f, -1.0f, 0.998583138f,
+		0.874390066f, -1.65069628f, 0.780282736f, 1.78556502f, -0.78961736f, -1.0f, 0.998583138f,
+		0.94131583f, -1.7843349f, 0.846998811f, 1.78556502f, -0.78961736f, -1.0f, 0.998583138f,
+		0.437575936f, -0.774078488f, 0.340275705f, 1.78743279f, -0.79128772f, -1.0f, 0.998584032f,
+		0.500934422f, -0.900592983f, 0.403434813f, 1.78743279f, -0.79128772f, -1.0f, 0.998584032f,
+		0.564292908f, -1.02710748f, 0.466593951f, 1.78743279f, -0.79128772f, -1.0f, 0.998584032f,
+		0.627651393f, -1.15362191f, 0.529753029f, 1.78743279f, -0.79128772f, -1.0f, 0.998584032f,
+		0.691009879f, -1.28013647f, 0.592912138f, 1.78743279f, -0.79128772f, -1.0f, 0.998584032f,
+		0.754368424f, -1.4066509f, 0.656071246f, 1.78743279f, -0.79128772f, -1.0f, 0.998584032f,
+		0.81772691f, -1.53316545f, 0.719230354f, 1.78743279f, -0.79128772f, -1.0f, 0.998584032f,
+		0.881085396f, -1.65967989f, 0.782389462f, 1.78743279f, -0.79128772f, -1.0f, 0.998584032f,
+		0.944443882f, -1.78619444f, 0.84554857f, 1.78743279f, -0.79128772f, -1.0f, 0.998584032f,
+		0.0194579009f, 0.00308549381f, -0.0163724069f, 1.7632333f, -0.7696051f, -1.0f, 0.999044061f,
+		0.129918441f, -0.217609629f, 0.0938656479f, 1.7632333f, -0.7696051f, -1.0f, 0.999044061f,
+		0.240378991f, -0.438304752f, 0.204103708f, 1.7632333f, -0.7696051f, -1.0f, 0.999044061f,
+		0.350839525f, -0.65899992f, 0.314341754f, 1.7632333f, -0.7696051f, -1.0f, 0.999044061f,
+		0.461300075f, -0.879694998f, 0.424579829f, 1.7632333f, -0.7696051f, -1.0f, 0.999044061f,
+		0.571760654f, -1.1003902f, 0.534817874f, 1.7632333f, -0.7696051f, -1.0f, 0.999044061f,
+		0.682221174f, -1.32108533f, 0.64505595f, 1.7632333f, -0.7696051f, -1.0f, 0.999044061f,
+		0.792681694f, -1.54178035f, 0.755293965f, 1.7632333f, -0.7696051f, -1.0f, 0.999044061f,
+		0.903142273f, -1.76247549f, 0.865532041f, 1.7632333f, -0.7696051f, -1.0f, 0.999044061f,
+		0.102831304f, -0.151975498f, 0.0548206158f, 1.76818419f, -0.774030864f, -1.0f, 0.99904424f,
+		0.203899622f, -0.353904843f, 0.155684814f, 1.76818419f, -0.774030864f, -1.0f, 0.99904424f,
+		0.30496794f, -0.555834174f, 0.256549031f, 1.76818419f, -0.774030864f, -1.0f, 0.99904424f,
+		0.406036258f, -0.757763505f, 0.357413232f, 1.76818419f, -0.774030864f, -1.0f, 0.99904424f,
+		0.507104576f, -0.959692836f, 0.458277434f, 1.76818419f, -0.774030864f, -1.0f, 0.99904424f,
+		0.608172894f, -1.16162217f, 0.559141636f, 1.76818419f, -0.774030864f, -1.0f, 0.99904424f,
+		0.709241211f, -1.3635515f, 0.660005808f, 1.76818419f, -0.774030864f, -1.0f, 0.99904424f,
+		0.810309529f, -1.56548083f, 0.760870039f, 1.76818419f, -0.774030864f, -1.0f, 0.99904424f,
+		0.911377847f, -1.76741016f, 0.861734211f, 1.76818419f, -0.774030864f, -1.0f, 0.99904424f,
+		0.173137635f, -0.282733023f, 0.114854895f, 1.77235818f, -0.777762234f, -1.0f, 0.999044418f,
+		0.266285777f, -0.468837708f, 0.207814395f, 1.77235818f, -0.777762234f, -1.0f, 0.999044418f,
+		0.359433919f, -0.654942393f, 0.300773889f, 1.77235818f, -0.777762234f, -1.0f, 0.999044418f,
+		0.452582031f, -0.841047108f, 0.393733412f, 1.77235818f, -0.777762234f, -1.0f, 0.999044418f,
+		0.545730174f, -1.02715182f, 0.486692905f, 1.77235818f, -0.777762234f, -1.0f, 0.999044418f,
+		0.638878286f, -1.21325648f, 0.579652429f, 1.77235818f, -0.777762234f, -1.0f, 0.999044418f,
+		0.732026458f, -1.39936113f, 0.672611892f, 1.77235818f, -0.777762234f, -1.0f, 0.999044418f,
+		0.82517457f, -1.58546591f, 0.765571415f, 1.77235818f, -0.777762234f, -1.0f, 0.999044418f,
+		0.918322742f, -1.77157056f, 0.858530879f, 1.77235818f, -0.777762234f, -1.0f, 0.999044418f,
+		0.233225659f, -0.394485474f, 0.166163146f, 1.77592468f, -0.780950606f, -1.0f, 0.999044597f,
+		0.319604725f, -0.567065477f, 0.252366811f, 1.77592468f, -0.780950606f, -1.0f, 0.999044597f,
+		0.405983806f, -0.739645481f, 0.338570476f, 1.77592468f, -0.780950606f, -1.0f, 0.999044597f,
+		0.492362857f, -0.912225485f, 0.42477414f, 1.77592468f, -0.780950606f, -1.0f, 0.999044597f,
+		0.578741908f, -1.08480549f, 0.510977805f, 1.77592468f, -0.780950606f, -1.0f, 0.999044597f,
+		0.665121019f, -1.25738549f, 0.597181499f, 1.77592468f, -0.780950606f, -1.0f, 0.999044597f,
+		0.75150007f, -1.4299655f, 0.683385134f, 1.77592468f, -0.780950606f, -1.0f, 0.999044597f,
+		0.837879121f, -1.6025455f, 0.769588828f, 1.77592468f, -0.780950606f, -1.0f, 0.999044597f,
+		0.924258173f, -1.7751255f, 0.855792463f, 1.77592468f, -0.780950606f, -1.0f, 0.999044597f,
+		0.285172135f, -0.491095424f, 0.210518837f, 1.77900708f, -0.783706307f, -1.0f, 0.999044776f,
+		0.365699321f, -0.651983261f, 0.290882051f, 1.77900708f, -0.783706307f, -1.0f, 0.999044776f,
+		0.446226478f, -0.812871039f, 0.371245235f, 1.77900708f, -0.783706307f, -1.0f, 0.999044776f,
+		0.526753664f, -0.973758876f, 0.451608449f, 1.77900708f, -0.783706307f, -1.0f, 0.999044776f,
+		0.607280791f, -1.13464665f, 0.531971633f, 1.77900708f, -0.783706307f, -1.0f, 0.999044776f,
+		0.687807977f, -1.29553449f, 0.612334847f, 1.77900708f, -0.783706307f, -1.0f, 0.999044776f,
+		0.768335104f, -1.45642233f, 0.692698061f, 1.77900708f, -0.783706307f, -1.0f, 0.999044776f,
+		0.84886229f, -1.61731005f, 0.773061275f, 1.77900708f, -0.783706307f, -1.0f, 0.999044776f,
+		0.929389477f, -1.77819788f, 0.853424489f, 1.77900708f, -0.783706307f, -1.0f, 0.999044776f,
+		0.330526799f, -0.575445175f, 0.249245346f, 1.78169763f, -0.786111653f, -1.0f, 0.999045014f,
+		0.405944645f, -0.726124525f, 0.324509233f, 1.78169763f, -0.786111653f, -1.0f, 0.999045014f,
+		0.481362492f, -0.876803815f, 0.399773091f, 1.78169763f, -0.786111653f, -1.0f, 0.999045014f,
+		0.556780338f, -1.02748311f, 0.475036979f, 1.78169763f, -0.786111653f, -1.0f, 0.999045014f,
+		0.632198215f, -1.17816246f, 0.550300837f, 1.78169763f, -0.786111653f, -1.0f, 0.999045014f,
+		0.707616031f, -1.32884181f, 0.625564694f, 1.78169763f, -0.786111653f, -1.0f, 0.999045014f,
+		0.783033907f, -1.47952116f, 0.700828612f, 1.78169763f, -0.786111653f, -1.0f, 0.999045014f,
+		0.858451724f, -1.63020039f, 0.77609247f, 1.78169763f, -0.786111653f, -1.0f, 0.999045014f,
+		0.9338696f, -1.78087974f, 0.851356328f, 1.78169763f, -0.786111653f, -1.0f, 0.999045014f,
+		0.370469451f, -0.649729192f, 0.283350229f, 1.78406632f, -0.788229406f, -1.0f, 0.999045253f,
+		0.441387653f, -0.791418135f, 0.354123265f, 1.78406632f, -0.788229406f, -1.0f, 0.999045253f,
+		0.512305856f, -0.933107078f, 0.4248963f, 1.78406632f, -0.788229406f, -1.0f, 0.999045253f,
+		0.583224058f, -1.07479608f, 0.495669305f, 1.78406632f, -0.788229406f, -1.0f, 0.999045253f,
+		0.654142261f, -1.21648502f, 0.566442311f, 1.78406632f, -0.788229406f, -1.0f, 0.999045253f,
+		0.725060463f, -1.35817397f, 0.637215376f, 1.78406632f, -0.788229406f, -1.0f, 0.999045253f,
+		0.795978725f, -1.49986291f, 0.707988381f, 1.78406632f, -0.788229406f, -1.0f, 0.999045253f,
+		0.866896927f, -1.64155197f, 0.778761387f, 1.78406632f, -0.788229406f, -1.0f, 0.999045253f,
+		0.93781513f, -1.78324091f, 0.849534392f, 1.78406632f, -0.788229406f, -1.0f, 0.999045253f,
+		0.405914277f, -0.715647638f, 0.31361416f, 1.78616762f, -0.790108085f, -1.0f, 0.999045491f,
+		0.472839534f, -0.849358618f, 0.380402029f, 1.78616762f, -0.790108085f, -1.0f, 0.999045491f,
+		0.539764822f, -0.983069599f, 0.447189897f, 1.78616762f, -0.790108085f, -1.0f, 0.999045491f,
+		0.606690049f, -1.11678052f, 0.513977766f, 1.78616762f, -0.790108085f, -1.0f, 0.999045491f,
+		0.673615336f, -1.2504915f, 0.580765605f, 1.78616762f, -0.790108085f, -1.0f, 0.999045491f,
+		0.740540564f, -1.38420248f, 0.647553504f, 1.78616762f, -0.790108085f, -1.0f, 0.999045491f,
+		0.807465851f, -1.51791346f, 0.714341402f, 1.78616762f, -0.790108085f, -1.0f, 0.999045491f,
+		0.874391079f, -1.65162456f, 0.781129241f, 1.78616762f, -0.790108085f, -1.0f, 0.999045491f,
+		0.941316366f, -1.78533554f, 0.84791714f, 1.78616762f, -0.790108085f, -1.0f, 0.999045491f,
+		0.437580526f, -0.774538219f, 0.340651274f, 1.78804421f, -0.791785955f, -1.0f, 0.999045789f,
+		0.500938475f, -0.901121736f, 0.403878838f, 1.78804421f, -0.791785955f, -1.0f, 0.999045789f,
+		0.564296484f, -1.02770519f, 0.467106372f, 1.78804421f, -0.791785955f, -1.0f, 0.999045789f,
+		0.627654433f, -1.15428865f, 0.530333936f, 1.78804421f, -0.791785955f, -1.0f, 0.999045789f,
+		0.691012442f, -1.28087223f, 0.593561471f, 1.78804421f, -0.791785955f, -1.0f, 0.999045789f,
+		0.754370391f, -1.40745568f, 0.656789064f, 1.78804421f, -0.791785955f, -1.0f, 0.999045789f,
+		0.8177284f, -1.53403914f, 0.720016599f, 1.78804421f, -0.791785955f, -1.0f, 0.999045789f,
+		0.881086349f, -1.66062272f, 0.783244133f, 1.78804421f, -0.791785955f, -1.0f, 0.999045789f,
+		0.944444299f, -1.78720617f, 0.846471727f, 1.78804421f, -0.791785955f, -1.0f, 0.999045789f,
+	},
+	// JCM2000
+	{
+		0.0126077384f, 0.00151757058f, -0.0110901678f, 1.78144383f, -0.789031804f, -1.0f, 0.993096828f,
+		0.125771582f, -0.220848873f, 0.0981485322f, 1.78144383f, -0.789031804f, -1.0f, 0.993096828f,
+		0.238935426f, -0.443215311f, 0.207387239f, 1.78144383f, -0.789031804f, -1.0f, 0.993096828f,
+		0.35209927f, -0.665581763f, 0.316625923f, 1.78144383f, -0.789031804f, -1.0f, 0.993096828f,
+		0.465263128f, -0.887948155f, 0.425864637f, 1.78144383f, -0.789031804f, -1.0f, 0.993096828f,
+		0.578426957f, -1.11031461f, 0.535103321f, 1.78144383f, -0.789031804f, -1.0f, 0.993096828f,
+		0.691590786f, -1.33268106f, 0.644342065f, 1.78144383f, -0.789031804f, -1.0f, 0.993096828f,
+		0.804754674f, -1.55504751f, 0.753580749f, 1.78144383f, -0.789031804f, -1.0f, 0.993096828f,
+		0.917918503f, -1.77741396f, 0.862819433f, 1.78144383f, -0.789031804f, -1.0f, 0.993096828f,
+		0.0741764233f, -0.112247311f, 0.0412320197f, 1.78249741f, -0.790192366f, -1.0f, 0.993262887f,
+		0.180283964f, -0.320541888f, 0.14345482f, 1.78249741f, -0.790192366f, -1.0f, 0.993262887f,
+		0.286391497f, -0.528836489f, 0.245677605f, 1.78249741f, -0.790192366f, -1.0f, 0.993262887f,
+		0.39249903f, -0.737131059f, 0.347900391f, 1.78249741f, -0.790192366f, -1.0f, 0.993262887f,
+		0.498606563f, -0.945425689f, 0.450123191f, 1.78249741f, -0.790192366f, -1.0f, 0.993262887f,
+		0.604714096f, -1.15372026f, 0.552345991f, 1.78249741f, -0.790192366f, -1.0f, 0.993262887f,
+		0.710821629f, -1.36201489f, 0.654568791f, 1.78249741f, -0.790192366f, -1.0f, 0.993262887f,
+		0.816929162f, -1.5703094f, 0.756791592f, 1.78249741f, -0.790192366f, -1.0f, 0.993262887f,
+		0.923036695f, -1.77860403f, 0.859014392f, 1.78249741f, -0.790192366f, -1.0f, 0.993262887f,
+		0.128515854f, -0.212404311f, 0.087195687f, 1.78296173f, -0.790821135f, -1.0f, 0.993426085f,
+		0.228395611f, -0.408256501f, 0.183203742f, 1.78296173f, -0.790821135f, -1.0f, 0.993426085f,
+		0.328275353f, -0.604108691f, 0.279211819f, 1.78296173f, -0.790821135f, -1.0f, 0.993426085f,
+		0.428155124f, -0.799960911f, 0.375219852f, 1.78296173f, -0.790821135f, -1.0f, 0.993426085f,
+		0.528034866f, -0.995813072f, 0.471227914f, 1.78296173f, -0.790821135f, -1.0f, 0.993426085f,
+		0.627914608f, -1.19166529f, 0.567236006f, 1.78296173f, -0.790821135f, -1.0f, 0.993426085f,
+		0.727794409f, -1.38751745f, 0.663244009f, 1.78296173f, -0.790821135f, -1.0f, 0.993426085f,
+		0.82767415f, -1.58336973f, 0.759252071f, 1.78296173f, -0.790821135f, -1.0f, 0.993426085f,
+		0.927553892f, -1.77922189f, 0.855260134f, 1.78296173f, -0.790821135f, -1.0f, 0.993426085f,
+		0.176828414f, -0.301172465f, 0.127820343f, 1.78285623f, -0.790939867f, -1.0f, 0.993585706f,
+		0.271171123f, -0.485936671f, 0.218277574f, 1.78285623f, -0.790939867f, -1.0f, 0.993585706f,
+		0.365513831f, -0.670700908f, 0.308734804f, 1.78285623f, -0.790939867f, -1.0f, 0.993585706f,
+		0.45985654f, -0.855465055f, 0.399192035f, 1.78285623f, -0.790939867f, -1.0f, 0.993585706f,
+		0.554199219f, -1.04022932f, 0.489649296f, 1.78285623f, -0.790939867f, -1.0f, 0.993585706f,
+		0.648541987f, -1.22499347f, 0.580106497f, 1.78285623f, -0.790939867f, -1.0f, 0.993585706f,
+		0.742884696f, -1.40975773f, 0.670563757f, 1.78285623f, -0.790939867f, -1.0f, 0.993585706f,
+		0.837227404f, -1.59452188f, 0.761021018f, 1.78285623f, -0.790939867f, -1.0f, 0.993585706f,
+		0.931570113f, -1.77928615f, 0.851478219f, 1.78285623f, -0.790939867f, -1.0f, 0.993585706f,
+		0.220063746f, -0.38029331f, 0.163901597f, 1.78217638f, -0.790548921f, -1.0f, 0.993741453f,
+		0.309451312f, -0.555105627f, 0.249362513f, 1.78217638f, -0.790548921f, -1.0f, 0.993741453f,
+		0.398838878f, -0.729918003f, 0.33482343f, 1.78217638f, -0.790548921f, -1.0f, 0.993741453f,
+		0.488226414f, -0.90473032f, 0.420284331f, 1.78217638f, -0.790548921f, -1.0f, 0.993741453f,
+		0.577614009f, -1.07954264f, 0.505745232f, 1.78217638f, -0.790548921f, -1.0f, 0.993741453f,
+		0.667001545f, -1.25435507f, 0.591206133f, 1.78217638f, -0.790548921f, -1.0f, 0.993741453f,
+		0.756389081f, -1.42916739f, 0.676667035f, 1.78217638f, -0.790548921f, -1.0f, 0.993741453f,
+		0.845776677f, -1.60397971f, 0.762127995f, 1.78217638f, -0.790548921f, -1.0f, 0.993741453f,
+		0.935164213f, -1.77879202f, 0.847588897f, 1.78217638f, -0.790548921f, -1.0f, 0.993741453f,
+		0.258981884f, -0.451146096f, 0.196063817f, 1.78089249f, -0.789626479f, -1.0f, 0.993892848f,
+		0.343909085f, -0.616966724f, 0.27699402f, 1.78089249f, -0.789626479f, -1.0f, 0.993892848f,
+		0.428836286f, -0.782787383f, 0.357924223f, 1.78089249f, -0.789626479f, -1.0f, 0.993892848f,
+		0.513763487f, -0.948607981f, 0.438854456f, 1.78089249f, -0.789626479f, -1.0f, 0.993892848f,
+		0.598690689f, -1.11442864f, 0.519784629f, 1.78089249f, -0.789626479f, -1.0f, 0.993892848f,
+		0.68361789f, -1.28024924f, 0.600714862f, 1.78089249f, -0.789626479f, -1.0f, 0.993892848f,
+		0.768545091f, -1.44606996f, 0.681645095f, 1.78089249f, -0.789626479f, -1.0f, 0.993892848f,
+		0.853472292f, -1.61189055f, 0.762575269f, 1.78089249f, -0.789626479f, -1.0f, 0.993892848f,
+		0.938399494f, -1.77771115f, 0.843505502f, 1.78089249f, -0.789626479f, -1.0f, 0.993892848f,
+		0.294198275f, -0.514828801f, 0.224796236f, 1.77894652f, -0.788125753f, -1.0f, 0.994039834f,
+		0.375089347f, -0.672473609f, 0.301587671f, 1.77894652f, -0.788125753f, -1.0f, 0.994039834f,
+		0.45598045f, -0.830118418f, 0.378379136f, 1.77894652f, -0.788125753f, -1.0f, 0.994039834f,
+		0.536871552f, -0.987763286f, 0.455170572f, 1.77894652f, -0.788125753f, -1.0f, 0.994039834f,
+		0.617762625f, -1.14540803f, 0.531962037f, 1.77894652f, -0.788125753f, -1.0f, 0.994039834f,
+		0.698653698f, -1.3030529f, 0.608753443f, 1.77894652f, -0.788125753f, -1.0f, 0.994039834f,
+		0.77954483f, -1.46069777f, 0.685544908f, 1.77894652f, -0.788125753f, -1.0f, 0.994039834f,
+		0.860435903f, -1.61834252f, 0.762336373f, 1.77894652f, -0.788125753f, -1.0f, 0.994039834f,
+		0.941326976f, -1.77598739f, 0.839127779f, 1.77894652f, -0.788125753f, -1.0f, 0.994039834f,
+		0.326216519f, -0.572214186f, 0.250477105f, 1.77624476f, -0.785969436f, -1.0f, 0.994182229f,
+		0.403438032f, -0.722378671f, 0.323459089f, 1.77624476f, -0.785969436f, -1.0f, 0.994182229f,
+		0.480659544f, -0.872543216f, 0.396441102f, 1.77624476f, -0.785969436f, -1.0f, 0.994182229f,
+		0.557881057f, -1.0227077f, 0.469423085f, 1.77624476f, -0.785969436f, -1.0f, 0.994182229f,
+		0.63510257f, -1.1728723f, 0.542405128f, 1.77624476f, -0.785969436f, -1.0f, 0.994182229f,
+		0.712324083f, -1.32303679f, 0.615387082f, 1.77624476f, -0.785969436f, -1.0f, 0.994182229f,
+		0.789545596f, -1.47320127f, 0.688369095f, 1.77624476f, -0.785969436f, -1.0f, 0.994182229f,
+		0.866767168f, -1.62336576f, 0.761351109f, 1.77624476f, -0.785969436f, -1.0f, 0.994182229f,
+		0.943988681f, -1.77353036f, 0.834333122f, 1.77624476f, -0.785969436f, -1.0f, 0.994182229f,
+		0.355452657f, -0.623987496f, 0.273388147f, 1.77264535f, -0.783038974f, -1.0f, 0.994319975f,
+		0.429323465f, -0.767264545f, 0.342835069f, 1.77264535f, -0.783038974f, -1.0f, 0.994319975f,
+		0.503194273f, -0.910541534f, 0.41228196f, 1.77264535f, -0.783038974f, -1.0f, 0.994319975f,
+		0.577065051f, -1.05381858f, 0.481728882f, 1.77264535f, -0.783038974f, -1.0f, 0.994319975f,
+		0.650935829f, -1.19709551f, 0.551175773f, 1.77264535f, -0.783038974f, -1.0f, 0.994319975f,
+		0.724806666f, -1.34037256f, 0.620622694f, 1.77264535f, -0.783038974f, -1.0f, 0.994319975f,
+		0.798677444f, -1.48364961f, 0.690069616f, 1.77264535f, -0.783038974f, -1.0f, 0.994319975f,
+		0.872548223f, -1.62692654f, 0.759516537f, 1.77264535f, -0.783038974f, -1.0f, 0.994319975f,
+		0.94641906f, -1.77020359f, 0.828963399f, 1.77264535f, -0.783038974f, -1.0f, 0.994319975f,
+		0.0126583483f, 0.00152366236f, -0.0111346859f, 1.78869319f, -0.795075476f, -1.0f, 0.993674874f,
+		0.12581639f, -0.221739605f, 0.0989983603f, 1.78869319f, -0.795075476f, -1.0f, 0.993674874f,
+		0.238974437f, -0.445002854f, 0.209131405f, 1.78869319f, -0.795075476f, -1.0f, 0.993674874f,
+		0.352132469f, -0.668266118f, 0.319264472f, 1.78869319f, -0.795075476f, -1.0f, 0.993674874f,
+		0.465290517f, -0.891529381f, 0.429397494f, 1.78869319f, -0.795075476f, -1.0f, 0.993674874f,
+		0.578448594f, -1.1147927f, 0.539530575f, 1.78869319f, -0.795075476f, -1.0f, 0.993674874f,
+		0.691606641f, -1.33805597f, 0.649663627f, 1.78869319f, -0.795075476f, -1.0f, 0.993674874f,
+		0.804764628f, -1.56131923f, 0.759796679f, 1.78869319f, -0.795075476f, -1.0f, 0.993674874f,
+		0.917922676f, -1.7845825f, 0.869929731f, 1.78869319f, -0.795075476f, -1.0f, 0.993674874f,
+		0.074226737f, -0.112782441f, 0.041653391f, 1.79057753f, -0.796942472f, -1.0f, 0.993801892f,
+		0.180328503f, -0.32200256f, 0.144798949f, 1.79057753f, -0.796942472f, -1.0f, 0.993801892f,
+		0.286430269f, -0.531222701f, 0.247944504f, 1.79057753f, -0.796942472f, -1.0f, 0.993801892f,
+		0.392532021f, -0.740442812f, 0.351090044f, 1.79057753f, -0.796942472f, -1.0f, 0.993801892f,
+		0.498633802f, -0.949662924f, 0.454235613f, 1.79057753f, -0.796942472f, -1.0f, 0.993801892f,
+		0.604735553f, -1.15888309f, 0.557381153f, 1.79057753f, -0.796942472f, -1.0f, 0.993801892f,
+		0.710837305f, -1.36810315f, 0.660526693f, 1.79057753f, -0.796942472f, -1.0f, 0.993801892f,
+		0.816939116f, -1.57732332f, 0.763672292f, 1.79057753f, -0.796942472f, -1.0f, 0.993801892f,
+		0.923040867f, -1.78654337f, 0.866817832f, 1.79057753f, -0.796942472f, -1.0f, 0.993801892f,
+		0.128566474f, -0.213525012f, 0.0881206542f, 1.79199553f, -0.798381507f, -1.0f, 0.993928492f,
+		0.228440419f, -0.410340726f, 0.185089141f, 1.79199553f, -0.798381507f, -1.0f, 0.993928492f,
+		0.328314364f, -0.607156456f, 0.282057643f, 1.79199553f, -0.798381507f, -1.0f, 0.993928492f,
+		0.428188324f, -0.803972185f, 0.379026145f, 1.79199553f, -0.798381507f, -1.0f, 0.993928492f,
+		0.528062284f, -1.00078785f, 0.475994617f, 1.79199553f, -0.798381507f, -1.0f, 0.993928492f,
+		0.627936244f, -1.19760358f, 0.572963119f, 1.79199553f, -0.798381507f, -1.0f, 0.993928492f,
+		0.727810204f, -1.39441931f, 0.669931591f, 1.79199553f, -0.798381507f, -1.0f, 0.993928492f,
+		0.827684164f, -1.59123504f, 0.766900122f, 1.79199553f, -0.798381507f, -1.0f, 0.993928492f,
+		0.927558064f, -1.78805077f, 0.863868594f, 1.79199553f, -0.798381507f, -1.0f, 0.993928492f,
+		0.176879913f, -0.302941412f, 0.129302368f, 1.79299498f, -0.799438715f, -1.0f, 0.994054079f,
+		0.27121672f, -0.488717586f, 0.220768124f, 1.79299498f, -0.799438715f, -1.0f, 0.994054079f,
+		0.365553528f, -0.67449373f, 0.312233895f, 1.79299498f, -0.799438715f, -1.0f, 0.994054079f,
+		0.459890336f, -0.860269904f, 0.403699666f, 1.79299498f, -0.799438715f, -1.0f, 0.994054079f,
+		0.554227173f, -1.04604602f, 0.495165437f, 1.79299498f, -0.799438715f, -1.0f, 0.994054079f,
+		0.648563921f, -1.23182225f, 0.586631179f, 1.79299498f, -0.799438715f, -1.0f, 0.994054079f,
+		0.742900729f, -1.41759837f, 0.67809695f, 1.79299498f, -0.799438715f, -1.0f, 0.994054079f,
+		0.837237537f, -1.6033746f, 0.769562721f, 1.79299498f, -0.799438715f, -1.0f, 0.994054079f,
+		0.931574345f, -1.78915071f, 0.861028492f, 1.79299498f, -0.799438715f, -1.0f, 0.994054079f,
+		0.220116779f, -0.382795423f, 0.166013286f, 1.79360855f, -0.800145745f, -1.0f, 0.994178236f,
+		0.30949825f, -0.558680296f, 0.252542913f, 1.79360855f, -0.800145745f, -1.0f, 0.994178236f,
+		0.398879737f, -0.734565198f, 0.339072526f, 1.79360855f, -0.800145745f, -1.0f, 0.994178236f,
+		0.488261223f, -0.910450041f, 0.425602168f, 1.79360855f, -0.800145745f, -1.0f, 0.994178236f,
+		0.577642679f, -1.08633494f, 0.51213181f, 1.79360855f, -0.800145745f, -1.0f, 0.994178236f,
+		0.667024195f, -1.26221979f, 0.598661423f, 1.79360855f, -0.800145745f, -1.0f, 0.994178236f,
+		0.756405652f, -1.43810463f, 0.685191035f, 1.79360855f, -0.800145745f, -1.0f, 0.994178236f,
+		0.845787168f, -1.61398947f, 0.771720648f, 1.79360855f, -0.800145745f, -1.0f, 0.994178236f,
+		0.935168624f, -1.78987443f, 0.85825026f, 1.79360855f, -0.800145745f, -1.0f, 0.994178236f,
+		0.259037137f, -0.454494566f, 0.198901996f, 1.79385567f, -0.800522387f, -1.0f, 0.994300485f,
+		0.34395799f, -0.621462762f, 0.28097555f, 1.79385567f, -0.800522387f, -1.0f, 0.994300485f,
+		0.428878874f, -0.788431048f, 0.36304912f, 1.79385567f, -0.800522387f, -1.0f, 0.994300485f,
+		0.513799727f, -0.955399275f, 0.445122659f, 1.79385567f, -0.800522387f, -1.0f, 0.994300485f,
+		0.59872061f, -1.1223675f, 0.527196229f, 1.79385567f, -0.800522387f, -1.0f, 0.994300485f,
+		0.683641493f, -1.28933573f, 0.609269798f, 1.79385567f, -0.800522387f, -1.0f, 0.994300485f,
+		0.768562317f, -1.45630395f, 0.691343367f, 1.79385567f, -0.800522387f, -1.0f, 0.994300485f,
+		0.8534832f, -1.62327218f, 0.773416877f, 1.79385567f, -0.800522387f, -1.0f, 0.994300485f,
+		0.938404083f, -1.79024041f, 0.855490446f, 1.79385567f, -0.800522387f, -1.0f, 0.994300485f,
+		0.294256508f, -0.519173741f, 0.228489473f, 1.79374409f, -0.800577939f, -1.0f, 0.994420469f,
+		0.375140935f, -0.678059042f, 0.306516647f, 1.79374409f, -0.800577939f, -1.0f, 0.994420469f,
+		0.456025332f, -0.836944282f, 0.384543806f, 1.79374409f, -0.800577939f, -1.0f, 0.994420469f,
+		0.536909759f, -0.995829582f, 0.462570935f, 1.79374409f, -0.800577939f, -1.0f, 0.994420469f,
+		0.617794156f, -1.15471494f, 0.540598094f, 1.79374409f, -0.800577939f, -1.0f, 0.994420469f,
+		0.698678613f, -1.31360018f, 0.618625283f, 1.79374409f, -0.800577939f, -1.0f, 0.994420469f,
+		0.77956301f, -1.47248542f, 0.696652412f, 1.79374409f, -0.800577939f, -1.0f, 0.994420469f,
+		0.860447407f, -1.63137078f, 0.774679601f, 1.79374409f, -0.800577939f, -1.0f, 0.994420469f,
+		0.941331863f, -1.79025602f, 0.85270673f, 1.79374409f, -0.800577939f, -1.0f, 0.994420469f,
+		0.326278716f, -0.577755749f, 0.255196899f, 1.79327023f, -0.800311565f, -1.0f, 0.99453795f,
+		0.403493106f, -0.729276001f, 0.329529285f, 1.79327023f, -0.800311565f, -1.0f, 0.99453795f,
+		0.480707496f, -0.880796313f, 0.403861672f, 1.79327023f, -0.800311565f, -1.0f, 0.99453795f,
+		0.557921886f, -1.03231657f, 0.478194058f, 1.79327023f, -0.800311565f, -1.0f, 0.99453795f,
+		0.635136247f, -1.18383682f, 0.552526414f, 1.79327023f, -0.800311565f, -1.0f, 0.99453795f,
+		0.712350667f, -1.33535707f, 0.62685883f, 1.79327023f, -0.800311565f, -1.0f, 0.99453795f,
+		0.789565027f, -1.48687732f, 0.701191187f, 1.79327023f, -0.800311565f, -1.0f, 0.99453795f,
+		0.866779447f, -1.63839757f, 0.775523603f, 1.79327023f, -0.800311565f, -1.0f, 0.99453795f,
+		0.943993807f, -1.78991783f, 0.849855959f, 1.79327023f, -0.800311565f, -1.0f, 0.99453795f,
+		0.35552001f, -0.630995691f, 0.279365897f, 1.79241931f, -0.79971242f, -1.0f, 0.994652748f,
+		0.429383099f, -0.775772631f, 0.35030663f, 1.79241931f, -0.79971242f, -1.0f, 0.994652748f,
+		0.503246188f, -0.920549572f, 0.421247363f, 1.79241931f, -0.79971242f, -1.0f, 0.994652748f,
+		0.577109218f, -1.06532645f, 0.492188096f, 1.79241931f, -0.79971242f, -1.0f, 0.994652748f,
+		0.650972307f, -1.21010339f, 0.563128829f, 1.79241931f, -0.79971242f, -1.0f, 0.994652748f,
+		0.724835396f, -1.35488033f, 0.634069562f, 1.79241931f, -0.79971242f, -1.0f, 0.994652748f,
+		0.798698485f, -1.49965727f, 0.705010295f, 1.79241931f, -0.79971242f, -1.0f, 0.994652748f,
+		0.872561574f, -1.64443421f, 0.775951087f, 1.79241931f, -0.79971242f, -1.0f, 0.994652748f,
+		0.946424663f, -1.78921115f, 0.84689182f, 1.79241931f, -0.79971242f, -1.0f, 0.994652748f,
+		0.0127025144f, 0.00152897858f, -0.0111735361f, 1.79475892f, -0.800134063f, -1.0f, 0.994440138f,
+		0.125855491f, -0.222516939f, 0.0997399986f, 1.79475892f, -0.800134063f, -1.0f, 0.994440138f,
+		0.239008471f, -0.446562856f, 0.210653543f, 1.79475892f, -0.800134063f, -1.0f, 0.994440138f,
+		0.352161467f, -0.670608759f, 0.321567059f, 1.79475892f, -0.800134063f, -1.0f, 0.994440138f,
+		0.465314448f, -0.894654691f, 0.432480603f, 1.79475892f, -0.800134063f, -1.0f, 0.994440138f,
+		0.578467429f, -1.11870062f, 0.543394148f, 1.79475892f, -0.800134063f, -1.0f, 0.994440138f,
+		0.691620409f, -1.3427465f, 0.654307663f, 1.79475892f, -0.800134063f, -1.0f, 0.994440138f,
+		0.80477339f, -1.56679249f, 0.765221238f, 1.79475892f, -0.800134063f, -1.0f, 0.994440138f,
+		0.917926371f, -1.79083836f, 0.876134753f, 1.79475892f, -0.800134063f, -1.0f, 0.994440138f,
+		0.0742696151f, -0.113238566f, 0.0420125537f, 1.79720128f, -0.802477539f, -1.0f, 0.994524777f,
+		0.180366471f, -0.323247582f, 0.14594464f, 1.79720128f, -0.802477539f, -1.0f, 0.994524777f,
+		0.28646332f, -0.53325659f, 0.249876723f, 1.79720128f, -0.802477539f, -1.0f, 0.994524777f,
+		0.392560154f, -0.743265629f, 0.35380879f, 1.79720128f, -0.802477539f, -1.0f, 0.994524777f,
+		0.498657018f, -0.953274608f, 0.457740873f, 1.79720128f, -0.802477539f, -1.0f, 0.994524777f,
+		0.604753852f, -1.16328359f, 0.561672986f, 1.79720128f, -0.802477539f, -1.0f, 0.994524777f,
+		0.710850716f, -1.37329268f, 0.665605009f, 1.79720128f, -0.802477539f, -1.0f, 0.994524777f,
+		0.816947579f, -1.58330166f, 0.769537091f, 1.79720128f, -0.802477539f, -1.0f, 0.994524777f,
+		0.923044443f, -1.79331064f, 0.873469174f, 1.79720128f, -0.802477539f, -1.0f, 0.994524777f,
+		0.12860851f, -0.214456022f, 0.088889055f, 1.79923534f, -0.804442167f, -1.0f, 0.994610667f,
+		0.228477657f, -0.412072182f, 0.186655417f, 1.79923534f, -0.804442167f, -1.0f, 0.994610667f,
+		0.328346789f, -0.609688342f, 0.284421802f, 1.79923534f, -0.804442167f, -1.0f, 0.994610667f,
+		0.428215921f, -0.807304502f, 0.382188171f, 1.79923534f, -0.804442167f, -1.0f, 0.994610667f,
+		0.528085053f, -1.0049206f, 0.479954511f, 1.79923534f, -0.804442167f, -1.0f, 0.994610667f,
+		0.627954185f, -1.20253682f, 0.577720881f, 1.79923534f, -0.804442167f, -1.0f, 0.994610667f,
+		0.727823317f, -1.40015292f, 0.67548728f, 1.79923534f, -0.804442167f, -1.0f, 0.994610667f,
+		0.827692449f, -1.59776914f, 0.77325362f, 1.79923534f, -0.804442167f, -1.0f, 0.994610667f,
+		0.927561581f, -1.79538524f, 0.871020019f, 1.79923534f, -0.804442167f, -1.0f, 0.994610667f,
+		0.176921517f, -0.304370195f, 0.130499378f, 1.80091894f, -0.806082428f, -1.0f, 0.994697452f,
+		0.271253556f, -0.490963697f, 0.222779721f, 1.80091894f, -0.806082428f, -1.0f, 0.994697452f,
+		0.365585595f, -0.67755717f, 0.315060049f, 1.80091894f, -0.806082428f, -1.0f, 0.994697452f,
+		0.459917635f, -0.864150703f, 0.407340407f, 1.80091894f, -0.806082428f, -1.0f, 0.994697452f,
+		0.554249704f, -1.05074418f, 0.499620736f, 1.80091894f, -0.806082428f, -1.0f, 0.994697452f,
+		0.648581743f, -1.23733771f, 0.591901064f, 1.80091894f, -0.806082428f, -1.0f, 0.994697452f,
+		0.742913723f, -1.42393124f, 0.684181452f, 1.80091894f, -0.806082428f, -1.0f, 0.994697452f,
+		0.837245762f, -1.61052477f, 0.77646178f, 1.80091894f, -0.806082428f, -1.0f, 0.994697452f,
+		0.931577802f, -1.79711819f, 0.868742108f, 1.80091894f, -0.806082428f, -1.0f, 0.994697452f,
+		0.220158309f, -0.384754747f, 0.167666882f, 1.80229652f, -0.807440162f, -1.0f, 0.994784594f,
+		0.309535027f, -0.561479509f, 0.255033374f, 1.80229652f, -0.807440162f, -1.0f, 0.994784594f,
+		0.398911744f, -0.738204241f, 0.342399865f, 1.80229652f, -0.807440162f, -1.0f, 0.994784594f,
+		0.488288462f, -0.914928913f, 0.429766357f, 1.80229652f, -0.807440162f, -1.0f, 0.994784594f,
+		0.57766521f, -1.0916537f, 0.517132878f, 1.80229652f, -0.807440162f, -1.0f, 0.994784594f,
+		0.667041898f, -1.26837838f, 0.60449934f, 1.80229652f, -0.807440162f, -1.0f, 0.994784594f,
+		0.756418645f, -1.44510317f, 0.691865861f, 1.80229652f, -0.807440162f, -1.0f, 0.994784594f,
+		0.845795333f, -1.62182784f, 0.779232383f, 1.80229652f, -0.807440162f, -1.0f, 0.994784594f,
+		0.935172081f, -1.79855263f, 0.866598845f, 1.80229652f, -0.807440162f, -1.0f, 0.994784594f,
+		0.25907892f, -0.457028359f, 0.201049656f, 1.80340195f, -0.808547616f, -1.0f, 0.994871855f,
+		0.343995005f, -0.624864936f, 0.283988386f, 1.80340195f, -0.808547616f, -1.0f, 0.994871855f,
+		0.42891109f, -0.792701602f, 0.366927117f, 1.80340195f, -0.808547616f, -1.0f, 0.994871855f,
+		0.513827145f, -0.960538208f, 0.449865848f, 1.80340195f, -0.808547616f, -1.0f, 0.994871855f,
+		0.59874326f, -1.12837481f, 0.532804549f, 1.80340195f, -0.808547616f, -1.0f, 0.994871855f,
+		0.683659315f, -1.29621148f, 0.615743279f, 1.80340195f, -0.808547616f, -1.0f, 0.994871855f,
+		0.76857537f, -1.46404803f, 0.69868201f, 1.80340195f, -0.808547616f, -1.0f, 0.994871855f,
+		0.853491485f, -1.63188469f, 0.781620741f, 1.80340195f, -0.808547616f, -1.0f, 0.994871855f,
+		0.93840754f, -1.79972124f, 0.864559531f, 1.80340195f, -0.808547616f, -1.0f, 0.994871855f,
+		0.294298947f, -0.522338629f, 0.231179655f, 1.80426145f, -0.809429586f, -1.0f, 0.994958878f,
+		0.375178486f, -0.682127476f, 0.310106933f, 1.80426145f, -0.809429586f, -1.0f, 0.994958878f,
+		0.456058055f, -0.841916323f, 0.389034182f, 1.80426145f, -0.809429586f, -1.0f, 0.994958878f,
+		0.536937594f, -1.00170517f, 0.467961431f, 1.80426145f, -0.809429586f, -1.0f, 0.994958878f,
+		0.617817163f, -1.16149402f, 0.546888709f, 1.80426145f, -0.809429586f, -1.0f, 0.994958878f,
+		0.698696733f, -1.32128286f, 0.625815928f, 1.80426145f, -0.809429586f, -1.0f, 0.994958878f,
+		0.779576242f, -1.48107171f, 0.704743207f, 1.80426145f, -0.809429586f, -1.0f, 0.994958878f,
+		0.860455811f, -1.64086056f, 0.783670485f, 1.80426145f, -0.809429586f, -1.0f, 0.994958878f,
+		0.94133538f, -1.8006494f, 0.862597764f, 1.80426145f, -0.809429586f, -1.0f, 0.994958878f,
+		0.326322138f, -0.581623614f, 0.258491158f, 1.80489433f, -0.810104728f, -1.0f, 0.995045364f,
+		0.403531551f, -0.73409009f, 0.333766073f, 1.80489433f, -0.810104728f, -1.0f, 0.995045364f,
+		0.480740964f, -0.886556625f, 0.409040958f, 1.80489433f, -0.810104728f, -1.0f, 0.995045364f,
+		0.557950377f, -1.03902316f, 0.484315842f, 1.80489433f, -0.810104728f, -1.0f, 0.995045364f,
+		0.635159791f, -1.1914897f, 0.559590757f, 1.80489433f, -0.810104728f, -1.0f, 0.995045364f,
+		0.712369204f, -1.34395611f, 0.634865642f, 1.80489433f, -0.810104728f, -1.0f, 0.995045364f,
+		0.789578617f, -1.49642265f, 0.710140526f, 1.80489433f, -0.810104728f, -1.0f, 0.995045364f,
+		0.86678803f, -1.64888918f, 0.785415411f, 1.80489433f, -0.810104728f, -1.0f, 0.995045364f,
+		0.943997443f, -1.80135572f, 0.860690355f, 1.80489433f, -0.810104728f, -1.0f, 0.995045364f,
+		0.355564803f, -0.635656953f, 0.283341736f, 1.80531418f, -0.810586512f, -1.0f, 0.995131075f,
+		0.429422736f, -0.781431496f, 0.355276048f, 1.80531418f, -0.810586512f, -1.0f, 0.995131075f,
+		0.503280699f, -0.927206039f, 0.427210361f, 1.80531418f, -0.810586512f, -1.0f, 0.995131075f,
+		0.577138662f, -1.07298064f, 0.499144644f, 1.80531418f, -0.810586512f, -1.0f, 0.995131075f,
+		0.650996566f, -1.21875513f, 0.571078956f, 1.80531418f, -0.810586512f, -1.0f, 0.995131075f,
+		0.724854529f, -1.36452973f, 0.643013239f, 1.80531418f, -0.810586512f, -1.0f, 0.995131075f,
+		0.798712492f, -1.51030421f, 0.714947581f, 1.80531418f, -0.810586512f, -1.0f, 0.995131075f,
+		0.872570395f, -1.65607882f, 0.786881864f, 1.80531418f, -0.810586512f, -1.0f, 0.995131075f,
+		0.946428359f, -1.80185342f, 0.858816206f, 1.80531418f, -0.810586512f, -1.0f, 0.995131075f,
+		0.0127383098f, 0.00153328723f, -0.0112050222f, 1.79937387f, -0.80398494f, -1.0f, 0.995361388f,
+		0.125887185f, -0.22314693f, 0.100341067f, 1.79937387f, -0.80398494f, -1.0f, 0.995361388f,
+		0.239036068f, -0.44782716f, 0.211887151f, 1.79937387f, -0.80398494f, -1.0f, 0.995361388f,
+		0.352184951f, -0.672507346f, 0.32343322f, 1.79937387f, -0.80398494f, -1.0f, 0.995361388f,
+		0.465333819f, -0.897187591f, 0.43497932f, 1.79937387f, -0.80398494f, -1.0f, 0.995361388f,
+		0.578482687f, -1.12186778f, 0.546525419f, 1.79937387f, -0.80398494f, -1.0f, 0.995361388f,
+		0.691631615f, -1.34654808f, 0.658071518f, 1.79937387f, -0.80398494f, -1.0f, 0.995361388f,
+		0.804780483f, -1.57122827f, 0.769617558f, 1.79937387f, -0.80398494f, -1.0f, 0.995361388f,
+		0.917929351f, -1.79590845f, 0.881163657f, 1.79937387f, -0.80398494f, -1.0f, 0.995361388f,
+		0.0743036941f, -0.113601029f, 0.0422979705f, 1.80215549f, -0.806619465f, -1.0f, 0.995408714f,
+		0.180396631f, -0.324236959f, 0.146855071f, 1.80215549f, -0.806619465f, -1.0f, 0.995408714f,
+		0.286489576f, -0.53487289f, 0.251412183f, 1.80215549f, -0.806619465f, -1.0f, 0.995408714f,
+		0.392582536f, -0.74550879f, 0.35596928f, 1.80215549f, -0.806619465f, -1.0f, 0.995408714f,
+		0.498675466f, -0.95614475f, 0.460526407f, 1.80215549f, -0.806619465f, -1.0f, 0.995408714f,
+		0.604768395f, -1.16678059f, 0.565083504f, 1.80215549f, -0.806619465f, -1.0f, 0.995408714f,
+		0.710861385f, -1.37741661f, 0.669640601f, 1.80215549f, -0.806619465f, -1.0f, 0.995408714f,
+		0.816954315f, -1.58805251f, 0.774197698f, 1.80215549f, -0.806619465f, -1.0f, 0.995408714f,
+		0.923047245f, -1.79868841f, 0.878754854f, 1.80215549f, -0.806619465f, -1.0f, 0.995408714f,
+		0.128641233f, -0.215180516f, 0.0894870088f, 1.80455315f, -0.808895707f, -1.0f, 0.995457649f,
+		0.228506625f, -0.413419545f, 0.187874258f, 1.80455315f, -0.808895707f, -1.0f, 0.995457649f,
+		0.328372002f, -0.611658573f, 0.286261499f, 1.80455315f, -0.808895707f, -1.0f, 0.995457649f,
+		0.428237379f, -0.809897602f, 0.38464874f, 1.80455315f, -0.808895707f, -1.0f, 0.995457649f,
+		0.528102756f, -1.00813663f, 0.483036011f, 1.80455315f, -0.808895707f, -1.0f, 0.995457649f,
+		0.627968132f, -1.20637572f, 0.581423223f, 1.80455315f, -0.808895707f, -1.0f, 0.995457649f,
+		0.727833569f, -1.40461469f, 0.679810524f, 1.80455315f, -0.808895707f, -1.0f, 0.995457649f,
+		0.827698946f, -1.60285378f, 0.778197765f, 1.80455315f, -0.808895707f, -1.0f, 0.995457649f,
+		0.927564323f, -1.80109274f, 0.876585007f, 1.80455315f, -0.808895707f, -1.0f, 0.995457649f,
+		0.176953182f, -0.305457354f, 0.131410196f, 1.80662739f, -0.810870409f, -1.0f, 0.995507956f,
+		0.2712816f, -0.492672771f, 0.224310368f, 1.80662739f, -0.810870409f, -1.0f, 0.995507956f,
+		0.365610003f, -0.679888248f, 0.317210555f, 1.80662739f, -0.810870409f, -1.0f, 0.995507956f,
+		0.459938407f, -0.867103636f, 0.410110712f, 1.80662739f, -0.810870409f, -1.0f, 0.995507956f,
+		0.55426681f, -1.05431914f, 0.503010869f, 1.80662739f, -0.810870409f, -1.0f, 0.995507956f,
+		0.648595214f, -1.24153459f, 0.595911026f, 1.80662739f, -0.810870409f, -1.0f, 0.995507956f,
+		0.742923617f, -1.42875004f, 0.688811243f, 1.80662739f, -0.810870409f, -1.0f, 0.995507956f,
+		0.837252021f, -1.61596537f, 0.7817114f, 1.80662739f, -0.810870409f, -1.0f, 0.995507956f,
+		0.931580484f, -1.80318081f, 0.874611557f, 1.80662739f, -0.810870409f, -1.0f, 0.995507956f,
+		0.220189154f, -0.386210263f, 0.168895245f, 1.8084259f, -0.812588155f, -1.0f, 0.995559454f,
+		0.309562355f, -0.563558877f, 0.256883413f, 1.8084259f, -0.812588155f, -1.0f, 0.995559454f,
+		0.398935527f, -0.74090749f, 0.344871581f, 1.8084259f, -0.812588155f, -1.0f, 0.995559454f,
+		0.488308728f, -0.918256104f, 0.432859749f, 1.8084259f, -0.812588155f, -1.0f, 0.995559454f,
+		0.577681899f, -1.09560466f, 0.520847917f, 1.8084259f, -0.812588155f, -1.0f, 0.995559454f,
+		0.66705507f, -1.27295327f, 0.608836114f, 1.8084259f, -0.812588155f, -1.0f, 0.995559454f,
+		0.756428301f, -1.450302f, 0.696824253f, 1.8084259f, -0.812588155f, -1.0f, 0.995559454f,
+		0.845801473f, -1.62765062f, 0.78481245f, 1.8084259f, -0.812588155f, -1.0f, 0.995559454f,
+		0.935174644f, -1.80499923f, 0.872800589f, 1.8084259f, -0.812588155f, -1.0f, 0.995559454f,
+		0.259109199f, -0.458862603f, 0.202604368f, 1.80998623f, -0.81408447f, -1.0f, 0.995611966f,
+		0.344021797f, -0.627327859f, 0.28616941f, 1.80998623f, -0.81408447f, -1.0f, 0.995611966f,
+		0.428934425f, -0.795793116f, 0.369734466f, 1.80998623f, -0.81408447f, -1.0f, 0.995611966f,
+		0.513846993f, -0.964258373f, 0.453299522f, 1.80998623f, -0.81408447f, -1.0f, 0.995611966f,
+		0.598759651f, -1.13272357f, 0.536864579f, 1.80998623f, -0.81408447f, -1.0f, 0.995611966f,
+		0.683672249f, -1.30118895f, 0.620429575f, 1.80998623f, -0.81408447f, -1.0f, 0.995611966f,
+		0.768584847f, -1.4696542f, 0.703994632f, 1.80998623f, -0.81408447f, -1.0f, 0.995611966f,
+		0.853497446f, -1.63811946f, 0.787559688f, 1.80998623f, -0.81408447f, -1.0f, 0.995611966f,
+		0.938410044f, -1.80658472f, 0.871124744f, 1.80998623f, -0.81408447f, -1.0f, 0.995611966f,
+		0.294328809f, -0.524566829f, 0.233073682f, 1.8113389f, -0.815387785f, -1.0f, 0.995665252f,
+		0.375204951f, -0.684991837f, 0.312634647f, 1.8113389f, -0.815387785f, -1.0f, 0.995665252f,
+		0.456081063f, -0.845416844f, 0.392195642f, 1.8113389f, -0.815387785f, -1.0f, 0.995665252f,
+		0.536957204f, -1.00584185f, 0.471756607f, 1.8113389f, -0.815387785f, -1.0f, 0.995665252f,
+		0.617833316f, -1.16626692f, 0.551317573f, 1.8113389f, -0.815387785f, -1.0f, 0.995665252f,
+		0.698709488f, -1.32669187f, 0.630878568f, 1.8113389f, -0.815387785f, -1.0f, 0.995665252f,
+		0.7795856f, -1.48711693f, 0.710439503f, 1.8113389f, -0.815387785f, -1.0f, 0.995665252f,
+		0.860461712f, -1.64754188f, 0.790000498f, 1.8113389f, -0.815387785f, -1.0f, 0.995665252f,
+		0.941337824f, -1.80796695f, 0.869561493f, 1.8113389f, -0.815387785f, -1.0f, 0.995665252f,
+		0.326351792f, -0.584266007f, 0.260741711f, 1.81250834f, -0.816521049f, -1.0f, 0.995719135f,
+		0.403557807f, -0.737378955f, 0.336660534f, 1.81250834f, -0.816521049f, -1.0f, 0.995719135f,
+		0.480763823f, -0.890491962f, 0.412579328f, 1.81250834f, -0.816521049f, -1.0f, 0.995719135f,
+		0.557969809f, -1.04360497f, 0.488498122f, 1.81250834f, -0.816521049f, -1.0f, 0.995719135f,
+		0.635175824f, -1.19671786f, 0.564416885f, 1.81250834f, -0.816521049f, -1.0f, 0.995719135f,
+		0.71238184f, -1.34983087f, 0.640335679f, 1.81250834f, -0.816521049f, -1.0f, 0.995719135f,
+		0.789587855f, -1.50294387f, 0.716254532f, 1.81250834f, -0.816521049f, -1.0f, 0.995719135f,
+		0.866793871f, -1.65605676f, 0.792173326f, 1.81250834f, -0.816521049f, -1.0f, 0.995719135f,
+		0.943999887f, -1.80916977f, 0.86809212f, 1.81250834f, -0.816521049f, -1.0f, 0.995719135f,
+		0.355594426f, -0.63873899f, 0.285970658f, 1.81351435f, -0.817503095f, -1.0f, 0.995773494f,
+		0.429448962f, -0.785173237f, 0.358561933f, 1.81351435f, -0.817503095f, -1.0f, 0.995773494f,
+		0.503303528f, -0.931607425f, 0.431153178f, 1.81351435f, -0.817503095f, -1.0f, 0.995773494f,
+		0.577158093f, -1.07804155f, 0.503744483f, 1.81351435f, -0.817503095f, -1.0f, 0.995773494f,
+		0.651012599f, -1.22447586f, 0.576335728f, 1.81351435f, -0.817503095f, -1.0f, 0.995773494f,
+		0.724867165f, -1.37091005f, 0.648926973f, 1.81351435f, -0.817503095f, -1.0f, 0.995773494f,
+		0.798721731f, -1.51734424f, 0.721518278f, 1.81351435f, -0.817503095f, -1.0f, 0.995773494f,
+		0.872576296f, -1.66377842f, 0.794109523f, 1.81351435f, -0.817503095f, -1.0f, 0.995773494f,
+		0.946430862f, -1.81021261f, 0.866700828f, 1.81351435f, -0.817503095f, -1.0f, 0.995773494f,
+		0.0127656199f, 0.00153657445f, -0.0112290457f, 1.802616f, -0.806692421f, -1.0f, 0.996343076f,
+		0.12591137f, -0.223627597f, 0.100799657f, 1.802616f, -0.806692421f, -1.0f, 0.996343076f,
+		0.239057124f, -0.448791772f, 0.212828353f, 1.802616f, -0.806692421f, -1.0f, 0.996343076f,
+		0.352202863f, -0.673955977f, 0.324857056f, 1.802616f, -0.806692421f, -1.0f, 0.996343076f,
+		0.465348631f, -0.899120152f, 0.436885744f, 1.802616f, -0.806692421f, -1.0f, 0.996343076f,
+		0.57849437f, -1.12428427f, 0.548914433f, 1.802616f, -0.806692421f, -1.0f, 0.996343076f,
+		0.691640139f, -1.34944844f, 0.660943151f, 1.802616f, -0.806692421f, -1.0f, 0.996343076f,
+		0.804785848f, -1.57461262f, 0.772971869f, 1.802616f, -0.806692421f, -1.0f, 0.996343076f,
+		0.917931616f, -1.79977679f, 0.885000587f, 1.802616f, -0.806692421f, -1.0f, 0.996343076f,
+		0.0743292943f, -0.113873355f, 0.0425124057f, 1.80558538f, -0.809489071f, -1.0f, 0.99636507f,
+		0.180419311f, -0.324980289f, 0.147539109f, 1.80558538f, -0.809489071f, -1.0f, 0.99636507f,
+		0.286509305f, -0.536087215f, 0.252565801f, 1.80558538f, -0.809489071f, -1.0f, 0.99636507f,
+		0.392599314f, -0.747194171f, 0.357592493f, 1.80558538f, -0.809489071f, -1.0f, 0.99636507f,
+		0.498689324f, -0.958301067f, 0.462619215f, 1.80558538f, -0.809489071f, -1.0f, 0.99636507f,
+		0.604779363f, -1.16940796f, 0.567645907f, 1.80558538f, -0.809489071f, -1.0f, 0.99636507f,
+		0.710869372f, -1.38051498f, 0.672672629f, 1.80558538f, -0.809489071f, -1.0f, 0.99636507f,
+		0.816959381f, -1.59162188f, 0.777699292f, 1.80558538f, -0.809489071f, -1.0f, 0.99636507f,
+		0.92304939f, -1.80272877f, 0.882726014f, 1.80558538f, -0.809489071f, -1.0f, 0.99636507f,
+		0.128665417f, -0.215716124f, 0.089929074f, 1.80818033f, -0.811935365f, -1.0f, 0.996388078f,
+		0.228528038f, -0.414415658f, 0.188775346f, 1.80818033f, -0.811935365f, -1.0f, 0.996388078f,
+		0.328390658f, -0.613115191f, 0.287621617f, 1.80818033f, -0.811935365f, -1.0f, 0.996388078f,
+		0.428253263f, -0.811814725f, 0.386467874f, 1.80818033f, -0.811935365f, -1.0f, 0.996388078f,
+		0.528115869f, -1.01051426f, 0.485314161f, 1.80818033f, -0.811935365f, -1.0f, 0.996388078f,
+		0.627978504f, -1.20921373f, 0.584160447f, 1.80818033f, -0.811935365f, -1.0f, 0.996388078f,
+		0.727841079f, -1.40791333f, 0.683006704f, 1.80818033f, -0.811935365f, -1.0f, 0.996388078f,
+		0.827703714f, -1.6066128f, 0.781852961f, 1.80818033f, -0.811935365f, -1.0f, 0.996388078f,
+		0.92756629f, -1.8053124f, 0.880699217f, 1.80818033f, -0.811935365f, -1.0f, 0.996388078f,
+		0.176976189f, -0.306247622f, 0.1320723f, 1.81046212f, -0.814088643f, -1.0f, 0.996412098f,
+		0.271301955f, -0.49391517f, 0.225423038f, 1.81046212f, -0.814088643f, -1.0f, 0.996412098f,
+		0.365627736f, -0.681582689f, 0.318773776f, 1.81046212f, -0.814088643f, -1.0f, 0.996412098f,
+		0.459953517f, -0.869250238f, 0.412124485f, 1.81046212f, -0.814088643f, -1.0f, 0.996412098f,
+		0.554279268f, -1.05691779f, 0.505475223f, 1.81046212f, -0.814088643f, -1.0f, 0.996412098f,
+		0.648605049f, -1.24458528f, 0.598825932f, 1.81046212f, -0.814088643f, -1.0f, 0.996412098f,
+		0.74293083f, -1.43225288f, 0.6921767f, 1.81046212f, -0.814088643f, -1.0f, 0.996412098f,
+		0.83725661f, -1.61992037f, 0.785527408f, 1.81046212f, -0.814088643f, -1.0f, 0.996412098f,
+		0.931582391f, -1.80758786f, 0.878878176f, 1.81046212f, -0.814088643f, -1.0f, 0.996412098f,
+		0.220211193f, -0.387249678f, 0.169772461f, 1.8124789f, -0.815994084f, -1.0f, 0.996437013f,
+		0.309581846f, -0.565043807f, 0.258204609f, 1.8124789f, -0.815994084f, -1.0f, 0.996437013f,
+		0.398952514f, -0.742837965f, 0.346636713f, 1.8124789f, -0.815994084f, -1.0f, 0.996437013f,
+		0.488323182f, -0.920632124f, 0.435068846f, 1.8124789f, -0.815994084f, -1.0f, 0.996437013f,
+		0.57769382f, -1.09842634f, 0.523500979f, 1.8124789f, -0.815994084f, -1.0f, 0.996437013f,
+		0.667064488f, -1.27622044f, 0.611933112f, 1.8124789f, -0.815994084f, -1.0f, 0.996437013f,
+		0.756435156f, -1.45401466f, 0.700365245f, 1.8124789f, -0.815994084f, -1.0f, 0.996437013f,
+		0.845805824f, -1.63180876f, 0.788797379f, 1.8124789f, -0.815994084f, -1.0f, 0.996437013f,
+		0.935176492f, -1.80960298f, 0.877229512f, 1.8124789f, -0.815994084f, -1.0f, 0.996437013f,
+		0.259130418f, -0.460148305f, 0.203694135f, 1.8142693f, -0.817687929f, -1.0f, 0.996462822f,
+		0.344040573f, -0.629054189f, 0.287698179f, 1.8142693f, -0.817687929f, -1.0f, 0.996462822f,
+		0.428950757f, -0.797960103f, 0.371702254f, 1.8142693f, -0.817687929f, -1.0f, 0.996462822f,
+		0.513860941f, -0.966865957f, 0.455706298f, 1.8142693f, -0.817687929f, -1.0f, 0.996462822f,
+		0.598771095f, -1.13577187f, 0.539710343f, 1.8142693f, -0.817687929f, -1.0f, 0.996462822f,
+		0.683681309f, -1.30467772f, 0.623714387f, 1.8142693f, -0.817687929f, -1.0f, 0.996462822f,
+		0.768591464f, -1.4735837f, 0.707718432f, 1.8142693f, -0.817687929f, -1.0f, 0.996462822f,
+		0.853501618f, -1.64248955f, 0.791722536f, 1.8142693f, -0.817687929f, -1.0f, 0.996462822f,
+		0.938411832f, -1.81139541f, 0.875726581f, 1.8142693f, -0.817687929f, -1.0f, 0.996462822f,
+		0.294349343f, -0.526098311f, 0.234375462f, 1.81586456f, -0.819199383f, -1.0f, 0.996489465f,
+		0.37522313f, -0.686960578f, 0.314371973f, 1.81586456f, -0.819199383f, -1.0f, 0.996489465f,
+		0.456096888f, -0.847822785f, 0.394368529f, 1.81586456f, -0.819199383f, -1.0f, 0.996489465f,
+		0.536970675f, -1.00868499f, 0.474365056f, 1.81586456f, -0.819199383f, -1.0f, 0.996489465f,
+		0.617844462f, -1.16954732f, 0.554361582f, 1.81586456f, -0.819199383f, -1.0f, 0.996489465f,
+		0.69871825f, -1.33040953f, 0.634358108f, 1.81586456f, -0.819199383f, -1.0f, 0.996489465f,
+		0.779591978f, -1.49127173f, 0.714354634f, 1.81586456f, -0.819199383f, -1.0f, 0.996489465f,
+		0.860465765f, -1.65213394f, 0.794351161f, 1.81586456f, -0.819199383f, -1.0f, 0.996489465f,
+		0.941339552f, -1.81299627f, 0.874347687f, 1.81586456f, -0.819199383f, -1.0f, 0.996489465f,
+		0.326371759f, -0.586044908f, 0.262256831f, 1.81729019f, -0.820552349f, -1.0f, 0.996516883f,
+		0.40357548f, -0.739593089f, 0.338609129f, 1.81729019f, -0.820552349f, -1.0f, 0.996516883f,
+		0.480779201f, -0.89314127f, 0.414961398f, 1.81729019f, -0.820552349f, -1.0f, 0.996516883f,
+		0.557982922f, -1.04668951f, 0.491313696f, 1.81729019f, -0.820552349f, -1.0f, 0.996516883f,
+		0.635186672f, -1.20023763f, 0.567665994f, 1.81729019f, -0.820552349f, -1.0f, 0.996516883f,
+		0.712390363f, -1.35378587f, 0.644018292f, 1.81729019f, -0.820552349f, -1.0f, 0.996516883f,
+		0.789594114f, -1.50733399f, 0.720370531f, 1.81729019f, -0.820552349f, -1.0f, 0.996516883f,
+		0.866797864f, -1.66088212f, 0.796722829f, 1.81729019f, -0.820552349f, -1.0f, 0.996516883f,
+		0.944001555f, -1.81443036f, 0.873075128f, 1.81729019f, -0.820552349f, -1.0f, 0.996516883f,
+		0.355613917f, -0.640769064f, 0.287702203f, 1.81856716f, -0.821766555f, -1.0f, 0.996544957f,
+		0.429466248f, -0.787637711f, 0.360726178f, 1.81856716f, -0.821766555f, -1.0f, 0.996544957f,
+		0.503318548f, -0.934506416f, 0.433750153f, 1.81856716f, -0.821766555f, -1.0f, 0.996544957f,
+		0.577170849f, -1.08137512f, 0.506774127f, 1.81856716f, -0.821766555f, -1.0f, 0.996544957f,
+		0.651023209f, -1.22824371f, 0.579798102f, 1.81856716f, -0.821766555f, -1.0f, 0.996544957f,
+		0.72487551f, -1.37511241f, 0.652822077f, 1.81856716f, -0.821766555f, -1.0f, 0.996544957f,
+		0.79872781f, -1.52198112f, 0.725846052f, 1.81856716f, -0.821766555f, -1.0f, 0.996544957f,
+		0.872580111f, -1.66884983f, 0.798870087f, 1.81856716f, -0.821766555f, -1.0f, 0.996544957f,
+		0.946432471f, -1.81571841f, 0.871894062f, 1.81856716f, -0.821766555f, -1.0f, 0.996544957f,
+		0.012785512f, 0.00153896888f, -0.0112465434f, 1.80477202f, -0.808494389f, -1.0f, 0.997263789f,
+		0.125928983f, -0.223977715f, 0.101133689f, 1.80477202f, -0.808494389f, -1.0f, 0.997263789f,
+		0.239072457f, -0.449494392f, 0.213513911f, 1.80477202f, -0.808494389f, -1.0f, 0.997263789f,
+		0.352215916f, -0.675011039f, 0.325894147f, 1.80477202f, -0.808494389f, -1.0f, 0.997263789f,
+		0.46535939f, -0.900527716f, 0.438274384f, 1.80477202f, -0.808494389f, -1.0f, 0.997263789f,
+		0.578502834f, -1.12604439f, 0.55065459f, 1.80477202f, -0.808494389f, -1.0f, 0.997263789f,
+		0.691646338f, -1.35156107f, 0.663034856f, 1.80477202f, -0.808494389f, -1.0f, 0.997263789f,
+		0.804789782f, -1.57707775f, 0.775415063f, 1.80477202f, -0.808494389f, -1.0f, 0.997263789f,
+		0.917933285f, -1.80259442f, 0.887795269f, 1.80477202f, -0.808494389f, -1.0f, 0.997263789f,
+		0.0743477345f, -0.114069462f, 0.0426668227f, 1.80783653f, -0.811374128f, -1.0f, 0.997272432f,
+		0.180435628f, -0.325515568f, 0.148031682f, 1.80783653f, -0.811374128f, -1.0f, 0.997272432f,
+		0.286523521f, -0.536961675f, 0.253396541f, 1.80783653f, -0.811374128f, -1.0f, 0.997272432f,
+		0.392611414f, -0.748407781f, 0.3587614f, 1.80783653f, -0.811374128f, -1.0f, 0.997272432f,
+		0.498699307f, -0.959853888f, 0.464126229f, 1.80783653f, -0.811374128f, -1.0f, 0.997272432f,
+		0.60478723f, -1.17129993f, 0.569491088f, 1.80783653f, -0.811374128f, -1.0f, 0.997272432f,
+		0.710875094f, -1.3827461f, 0.674855947f, 1.80783653f, -0.811374128f, -1.0f, 0.997272432f,
+		0.816963017f, -1.59419215f, 0.780220807f, 1.80783653f, -0.811374128f, -1.0f, 0.997272432f,
+		0.92305094f, -1.80563831f, 0.885585666f, 1.80783653f, -0.811374128f, -1.0f, 0.997272432f,
+		0.128682628f, -0.216097295f, 0.0902436674f, 1.8105303f, -0.813906252f, -1.0f, 0.997281551f,
+		0.228543282f, -0.415124536f, 0.189416602f, 1.8105303f, -0.813906252f, -1.0f, 0.997281551f,
+		0.32840392f, -0.614151776f, 0.288589537f, 1.8105303f, -0.813906252f, -1.0f, 0.997281551f,
+		0.428264558f, -0.813179016f, 0.387762457f, 1.8105303f, -0.813906252f, -1.0f, 0.997281551f,
+		0.528125167f, -1.01220632f, 0.486935407f, 1.8105303f, -0.813906252f, -1.0f, 0.997281551f,
+		0.627985835f, -1.2112335f, 0.586108327f, 1.8105303f, -0.813906252f, -1.0f, 0.997281551f,
+		0.727846444f, -1.4102608f, 0.685281277f, 1.8105303f, -0.813906252f, -1.0f, 0.997281551f,
+		0.827707112f, -1.60928798f, 0.784454167f, 1.8105303f, -0.813906252f, -1.0f, 0.997281551f,
+		0.92756772f, -1.80831528f, 0.883627117f, 1.8105303f, -0.813906252f, -1.0f, 0.997281551f,
+		0.176992372f, -0.306803197f, 0.132537767f, 1.81291449f, -0.816148281f, -1.0f, 0.997291148f,
+		0.27131629f, -0.494788557f, 0.226205245f, 1.81291449f, -0.816148281f, -1.0f, 0.997291148f,
+		0.365640193f, -0.682773948f, 0.319872737f, 1.81291449f, -0.816148281f, -1.0f, 0.997291148f,
+		0.459964126f, -0.870759308f, 0.413540214f, 1.81291449f, -0.816148281f, -1.0f, 0.997291148f,
+		0.55428803f, -1.05874467f, 0.507207692f, 1.81291449f, -0.816148281f, -1.0f, 0.997291148f,
+		0.648611963f, -1.24672997f, 0.600875199f, 1.81291449f, -0.816148281f, -1.0f, 0.997291148f,
+		0.742935896f, -1.43471539f, 0.694542646f, 1.81291449f, -0.816148281f, -1.0f, 0.997291148f,
+		0.837259829f, -1.62270069f, 0.788210154f, 1.81291449f, -0.816148281f, -1.0f, 0.997291148f,
+		0.931583703f, -1.81068611f, 0.881877661f, 1.81291449f, -0.816148281f, -1.0f, 0.997291148f,
+		0.220226482f, -0.387971222f, 0.170381427f, 1.81503749f, -0.818145692f, -1.0f, 0.997301221f,
+		0.309595376f, -0.566074669f, 0.259121746f, 1.81503749f, -0.818145692f, -1.0f, 0.997301221f,
+		0.398964286f, -0.744178116f, 0.347862095f, 1.81503749f, -0.818145692f, -1.0f, 0.997301221f,
+		0.488333195f, -0.922281563f, 0.436602414f, 1.81503749f, -0.818145692f, -1.0f, 0.997301221f,
+		0.577702105f, -1.10038507f, 0.525342703f, 1.81503749f, -0.818145692f, -1.0f, 0.997301221f,
+		0.667071044f, -1.27848852f, 0.614083052f, 1.81503749f, -0.818145692f, -1.0f, 0.997301221f,
+		0.756439924f, -1.45659196f, 0.7028234f, 1.81503749f, -0.818145692f, -1.0f, 0.997301221f,
+		0.845808864f, -1.63469541f, 0.79156369f, 1.81503749f, -0.818145692f, -1.0f, 0.997301221f,
+		0.935177743f, -1.81279886f, 0.880304039f, 1.81503749f, -0.818145692f, -1.0f, 0.997301221f,
+		0.259144932f, -0.461029261f, 0.204440832f, 1.81693816f, -0.819934785f, -1.0f, 0.997311771f,
+		0.344053447f, -0.630237043f, 0.288745701f, 1.81693816f, -0.819934785f, -1.0f, 0.997311771f,
+		0.428961962f, -0.799444854f, 0.373050541f, 1.81693816f, -0.819934785f, -1.0f, 0.997311771f,
+		0.513870478f, -0.968652725f, 0.45735541f, 1.81693816f, -0.819934785f, -1.0f, 0.997311771f,
+		0.598778963f, -1.13786054f, 0.541660249f, 1.81693816f, -0.819934785f, -1.0f, 0.997311771f,
+		0.683687508f, -1.30706835f, 0.625965118f, 1.81693816f, -0.819934785f, -1.0f, 0.997311771f,
+		0.768595994f, -1.47627616f, 0.710269988f, 1.81693816f, -0.819934785f, -1.0f, 0.997311771f,
+		0.853504539f, -1.64548397f, 0.794574857f, 1.81693816f, -0.819934785f, -1.0f, 0.997311771f,
+		0.938413024f, -1.81469178f, 0.878879726f, 1.81693816f, -0.819934785f, -1.0f, 0.997311771f,
+		0.29436323f, -0.527133584f, 0.235255435f, 1.81864786f, -0.821544945f, -1.0f, 0.997322738f,
+		0.375235409f, -0.68829143f, 0.315546393f, 1.81864786f, -0.821544945f, -1.0f, 0.997322738f,
+		0.456107587f, -0.849449217f, 0.395837367f, 1.81864786f, -0.821544945f, -1.0f, 0.997322738f,
+		0.536979795f, -1.010607f, 0.47612834f, 1.81864786f, -0.821544945f, -1.0f, 0.997322738f,
+		0.617851973f, -1.17176485f, 0.556419313f, 1.81864786f, -0.821544945f, -1.0f, 0.997322738f,
+		0.698724151f, -1.33292258f, 0.636710286f, 1.81864786f, -0.821544945f, -1.0f, 0.997322738f,
+		0.779596329f, -1.49408042f, 0.7170012f, 1.81864786f, -0.821544945f, -1.0f, 0.997322738f,
+		0.860468507f, -1.65523827f, 0.797292173f, 1.81864786f, -0.821544945f, -1.0f, 0.997322738f,
+		0.941340685f, -1.816396f, 0.877583146f, 1.81864786f, -0.821544945f, -1.0f, 0.997322738f,
+		0.326385051f, -0.587230742f, 0.263266802f, 1.82019222f, -0.823000312f, -1.0f, 0.997334123f,
+		0.403587252f, -0.741069019f, 0.339908034f, 1.82019222f, -0.823000312f, -1.0f, 0.997334123f,
+		0.480789453f, -0.894907296f, 0.416549265f, 1.82019222f, -0.823000312f, -1.0f, 0.997334123f,
+		0.557991683f, -1.04874551f, 0.493190527f, 1.82019222f, -0.823000312f, -1.0f, 0.997334123f,
+		0.635193884f, -1.20258379f, 0.569831789f, 1.82019222f, -0.823000312f, -1.0f, 0.997334123f,
+		0.712396085f, -1.35642219f, 0.646472991f, 1.82019222f, -0.823000312f, -1.0f, 0.997334123f,
+		0.789598286f, -1.51026046f, 0.723114252f, 1.82019222f, -0.823000312f, -1.0f, 0.997334123f,
+		0.866800487f, -1.66409874f, 0.799755454f, 1.82019222f, -0.823000312f, -1.0f, 0.997334123f,
+		0.944002688f, -1.81793702f, 0.876396716f, 1.82019222f, -0.823000312f, -1.0f, 0.997334123f,
+		0.355626732f, -0.642102718f, 0.288839757f, 1.82159245f, -0.824320674f, -1.0f, 0.997345984f,
+		0.429477602f, -0.789256811f, 0.362148017f, 1.82159245f, -0.824320674f, -1.0f, 0.997345984f,
+		0.503328443f, -0.936410964f, 0.435456276f, 1.82159245f, -0.824320674f, -1.0f, 0.997345984f,
+		0.577179313f, -1.083565f, 0.508764565f, 1.82159245f, -0.824320674f, -1.0f, 0.997345984f,
+		0.651030123f, -1.23071921f, 0.582072794f, 1.82159245f, -0.824320674f, -1.0f, 0.997345984f,
+		0.724880993f, -1.3778733f, 0.655381083f, 1.82159245f, -0.824320674f, -1.0f, 0.997345984f,
+		0.798731804f, -1.52502739f, 0.728689313f, 1.82159245f, -0.824320674f, -1.0f, 0.997345984f,
+		0.872582674f, -1.67218149f, 0.801997602f, 1.82159245f, -0.824320674f, -1.0f, 0.997345984f,
+		0.946433544f, -1.81933558f, 0.875305831f, 1.82159245f, -0.824320674f, -1.0f, 0.997345984f,
+		0.0127995173f, 0.00154065457f, -0.011258862f, 1.8061651f, -0.809659839f, -1.0f, 0.998036683f,
+		0.125941381f, -0.224224195f, 0.101368852f, 1.8061651f, -0.809659839f, -1.0f, 0.998036683f,
+		0.239083245f, -0.449989051f, 0.213996574f, 1.8061651f, -0.809659839f, -1.0f, 0.998036683f,
+		0.352225125f, -0.675753891f, 0.326624274f, 1.8061651f, -0.809659839f, -1.0f, 0.998036683f,
+		0.465366989f, -0.901518762f, 0.439251989f, 1.8061651f, -0.809659839f, -1.0f, 0.998036683f,
+		0.578508854f, -1.12728357f, 0.551879704f, 1.8061651f, -0.809659839f, -1.0f, 0.998036683f,
+		0.691650689f, -1.35304844f, 0.664507449f, 1.8061651f, -0.809659839f, -1.0f, 0.998036683f,
+		0.804792583f, -1.57881331f, 0.777135134f, 1.8061651f, -0.809659839f, -1.0f, 0.998036683f,
+		0.917934418f, -1.80457819f, 0.889762878f, 1.8061651f, -0.809659839f, -1.0f, 0.998036683f,
+		0.0743606091f, -0.114206403f, 0.0427746512f, 1.80927491f, -0.812579572f, -1.0f, 0.998039722f,
+		0.180447027f, -0.325889349f, 0.148375645f, 1.80927491f, -0.812579572f, -1.0f, 0.998039722f,
+		0.286533445f, -0.537572265f, 0.253976643f, 1.80927491f, -0.812579572f, -1.0f, 0.998039722f,
+		0.392619878f, -0.74925524f, 0.359577626f, 1.80927491f, -0.812579572f, -1.0f, 0.998039722f,
+		0.498706281f, -0.960938156f, 0.465178609f, 1.80927491f, -0.812579572f, -1.0f, 0.998039722f,
+		0.604792714f, -1.17262113f, 0.570779622f, 1.80927491f, -0.812579572f, -1.0f, 0.998039722f,
+		0.710879147f, -1.38430405f, 0.676380575f, 1.80927491f, -0.812579572f, -1.0f, 0.998039722f,
+		0.81696558f, -1.59598708f, 0.781981587f, 1.80927491f, -0.812579572f, -1.0f, 0.998039722f,
+		0.923051953f, -1.80767f, 0.887582541f, 1.80927491f, -0.812579572f, -1.0f, 0.998039722f,
+		0.128694549f, -0.216361254f, 0.0904615298f, 1.81201506f, -0.815152466f, -1.0f, 0.998042881f,
+		0.228553832f, -0.415615439f, 0.189860672f, 1.81201506f, -0.815152466f, -1.0f, 0.998042881f,
+		0.328413099f, -0.614869595f, 0.289259821f, 1.81201506f, -0.815152466f, -1.0f, 0.998042881f,
+		0.428272367f, -0.814123809f, 0.388658941f, 1.81201506f, -0.815152466f, -1.0f, 0.998042881f,
+		0.528131664f, -1.01337802f, 0.48805809f, 1.81201506f, -0.815152466f, -1.0f, 0.998042881f,
+		0.627990901f, -1.21263218f, 0.58745724f, 1.81201506f, -0.815152466f, -1.0f, 0.998042881f,
+		0.727850199f, -1.41188633f, 0.686856389f, 1.81201506f, -0.815152466f, -1.0f, 0.998042881f,
+		0.827709496f, -1.61114049f, 0.786255538f, 1.81201506f, -0.815152466f, -1.0f, 0.998042881f,
+		0.927568734f, -1.81039476f, 0.885654688f, 1.81201506f, -0.815152466f, -1.0f, 0.998042881f,
+		0.177003473f, -0.307184666f, 0.132857352f, 1.81444669f, -0.817436278f, -1.0f, 0.998046279f,
+		0.271326125f, -0.495388269f, 0.226742327f, 1.81444669f, -0.817436278f, -1.0f, 0.998046279f,
+		0.365648776f, -0.683591843f, 0.320627302f, 1.81444669f, -0.817436278f, -1.0f, 0.998046279f,
+		0.459971428f, -0.871795416f, 0.414512247f, 1.81444669f, -0.817436278f, -1.0f, 0.998046279f,
+		0.55429405f, -1.05999899f, 0.508397222f, 1.81444669f, -0.817436278f, -1.0f, 0.998046279f,
+		0.648616731f, -1.24820256f, 0.602282166f, 1.81444669f, -0.817436278f, -1.0f, 0.998046279f,
+		0.742939353f, -1.43640614f, 0.696167171f, 1.81444669f, -0.817436278f, -1.0f, 0.998046279f,
+		0.837261975f, -1.62460983f, 0.790052116f, 1.81444669f, -0.817436278f, -1.0f, 0.998046279f,
+		0.931584656f, -1.8128134f, 0.88393712f, 1.81444669f, -0.817436278f, -1.0f, 0.998046279f,
+		0.220236897f, -0.388462365f, 0.170795918f, 1.81661856f, -0.819476306f, -1.0f, 0.998049796f,
+		0.309604615f, -0.566776335f, 0.259746015f, 1.81661856f, -0.819476306f, -1.0f, 0.998049796f,
+		0.398972332f, -0.745090306f, 0.348696113f, 1.81661856f, -0.819476306f, -1.0f, 0.998049796f,
+		0.48834005f, -0.923404276f, 0.43764618f, 1.81661856f, -0.819476306f, -1.0f, 0.998049796f,
+		0.577707767f, -1.10171819f, 0.526596308f, 1.81661856f, -0.819476306f, -1.0f, 0.998049796f,
+		0.667075455f, -1.28003216f, 0.615546346f, 1.81661856f, -0.819476306f, -1.0f, 0.998049796f,
+		0.756443202f, -1.45834613f, 0.704496443f, 1.81661856f, -0.819476306f, -1.0f, 0.998049796f,
+		0.84581089f, -1.6366601f, 0.793446541f, 1.81661856f, -0.819476306f, -1.0f, 0.998049796f,
+		0.935178638f, -1.81497407f, 0.882396638f, 1.81661856f, -0.819476306f, -1.0f, 0.998049796f,
+		0.259154737f, -0.46162352f, 0.204944536f, 1.8185693f, -0.82130909f, -1.0f, 0.998053551f,
+		0.34406212f, -0.63103497f, 0.289452314f, 1.8185693f, -0.82130909f, -1.0f, 0.998053551f,
+		0.428969532f, -0.80044651f, 0.373960078f, 1.8185693f, -0.82130909f, -1.0f, 0.998053551f,
+		0.513876915f, -0.969857991f, 0.458467871f, 1.8185693f, -0.82130909f, -1.0f, 0.998053551f,
+		0.598784268f, -1.13926947f, 0.542975605f, 1.8185693f, -0.82130909f, -1.0f, 0.998053551f,
+		0.68369168f, -1.30868089f, 0.627483428f, 1.8185693f, -0.82130909f, -1.0f, 0.998053551f,
+		0.768599093f, -1.47809243f, 0.711991191f, 1.8185693f, -0.82130909f, -1.0f, 0.998053551f,
+		0.853506446f, -1.64750385f, 0.796498954f, 1.8185693f, -0.82130909f, -1.0f, 0.998053551f,
+		0.938413858f, -1.81691539f, 0.881006718f, 1.8185693f, -0.82130909f, -1.0f, 0.998053551f,
+		0.294372499f, -0.527825594f, 0.235843644f, 1.8203305f, -0.822964013f, -1.0f, 0.998057425f,
+		0.375243634f, -0.68918097f, 0.316331416f, 1.8203305f, -0.822964013f, -1.0f, 0.998057425f,
+		0.456114739f, -0.850536346f, 0.396819174f, 1.8203305f, -0.822964013f, -1.0f, 0.998057425f,
+		0.536985874f, -1.01189172f, 0.477306962f, 1.8203305f, -0.822964013f, -1.0f, 0.998057425f,
+		0.617856979f, -1.1732471f, 0.55779475f, 1.8203305f, -0.822964013f, -1.0f, 0.998057425f,
+		0.698728085f, -1.33460248f, 0.638282478f, 1.8203305f, -0.822964013f, -1.0f, 0.998057425f,
+		0.779599249f, -1.49595785f, 0.718770266f, 1.8203305f, -0.822964013f, -1.0f, 0.998057425f,
+		0.860470355f, -1.65731311f, 0.799258053f, 1.8203305f, -0.822964013f, -1.0f, 0.998057425f,
+		0.94134146f, -1.81866848f, 0.879745781f, 1.8203305f, -0.822964013f, -1.0f, 0.998057425f,
+		0.326393872f, -0.588015974f, 0.263935566f, 1.82192767f, -0.824465215f, -1.0f, 0.998061538f,
+		0.40359506f, -0.742046356f, 0.340768158f, 1.82192767f, -0.824465215f, -1.0f, 0.998061538f,
+		0.480796248f, -0.896076739f, 0.417600751f, 1.82192767f, -0.824465215f, -1.0f, 0.998061538f,
+		0.557997465f, -1.05010712f, 0.494433343f, 1.82192767f, -0.824465215f, -1.0f, 0.998061538f,
+		0.635198653f, -1.20413744f, 0.571265936f, 1.82192767f, -0.824465215f, -1.0f, 0.998061538f,
+		0.71239984f, -1.35816789f, 0.648098528f, 1.82192767f, -0.824465215f, -1.0f, 0.998061538f,
+		0.789601028f, -1.51219821f, 0.724931061f, 1.82192767f, -0.824465215f, -1.0f, 0.998061538f,
+		0.866802216f, -1.66622865f, 0.801763654f, 1.82192767f, -0.824465215f, -1.0f, 0.998061538f,
+		0.944003403f, -1.82025898f, 0.878596246f, 1.82192767f, -0.824465215f, -1.0f, 0.998061538f,
+		0.355635166f, -0.642977417f, 0.289585859f, 1.82338226f, -0.825832725f, -1.0f, 0.99806577f,
+		0.429485023f, -0.790318727f, 0.363080561f, 1.82338226f, -0.825832725f, -1.0f, 0.99806577f,
+		0.503334939f, -0.937660038f, 0.436575264f, 1.82338226f, -0.825832725f, -1.0f, 0.99806577f,
+		0.577184796f, -1.08500135f, 0.510069966f, 1.82338226f, -0.825832725f, -1.0f, 0.99806577f,
+		0.651034713f, -1.23234272f, 0.583564699f, 1.82338226f, -0.825832725f, -1.0f, 0.99806577f,
+		0.72488457f, -1.37968397f, 0.657059371f, 1.82338226f, -0.825832725f, -1.0f, 0.99806577f,
+		0.798734426f, -1.52702534f, 0.730554104f, 1.82338226f, -0.825832725f, -1.0f, 0.99806577f,
+		0.872584343f, -1.67436671f, 0.804048777f, 1.82338226f, -0.825832725f, -1.0f, 0.99806577f,
+		0.9464342f, -1.82170796f, 0.877543509f, 1.82338226f, -0.825832725f, -1.0f, 0.99806577f,
+		0.0128091425f, 0.00154181325f, -0.0112673296f, 1.80705678f, -0.810406446f, -1.0f, 0.998633683f,
+		0.125949904f, -0.224393606f, 0.101530485f, 1.80705678f, -0.810406446f, -1.0f, 0.998633683f,
+		0.239090666f, -0.450329036f, 0.214328289f, 1.80705678f, -0.810406446f, -1.0f, 0.998633683f,
+		0.352231413f, -0.676264465f, 0.327126116f, 1.80705678f, -0.810406446f, -1.0f, 0.998633683f,
+		0.465372175f, -0.902199864f, 0.439923912f, 1.80705678f, -0.810406446f, -1.0f, 0.998633683f,
+		0.578512967f, -1.12813532f, 0.552721739f, 1.80705678f, -0.810406446f, -1.0f, 0.998633683f,
+		0.691653728f, -1.35407066f, 0.665519536f, 1.80705678f, -0.810406446f, -1.0f, 0.998633683f,
+		0.80479449f, -1.58000612f, 0.778317332f, 1.80705678f, -0.810406446f, -1.0f, 0.998633683f,
+		0.917935252f, -1.80594158f, 0.891115189f, 1.80705678f, -0.810406446f, -1.0f, 0.998633683f,
+		0.0743694082f, -0.114299983f, 0.0428483449f, 1.81018734f, -0.813344777f, -1.0f, 0.998634636f,
+		0.18045482f, -0.326144785f, 0.148610711f, 1.81018734f, -0.813344777f, -1.0f, 0.998634636f,
+		0.28654024f, -0.537989616f, 0.254373074f, 1.81018734f, -0.813344777f, -1.0f, 0.998634636f,
+		0.39262566f, -0.749834418f, 0.360135436f, 1.81018734f, -0.813344777f, -1.0f, 0.998634636f,
+		0.49871105f, -0.96167922f, 0.465897799f, 1.81018734f, -0.813344777f, -1.0f, 0.998634636f,
+		0.604796469f, -1.17352402f, 0.571660161f, 1.81018734f, -0.813344777f, -1.0f, 0.998634636f,
+		0.710881889f, -1.38536882f, 0.677422523f, 1.81018734f, -0.813344777f, -1.0f, 0.998634636f,
+		0.816967309f, -1.59721363f, 0.783184886f, 1.81018734f, -0.813344777f, -1.0f, 0.998634636f,
+		0.923052728f, -1.80905843f, 0.888947248f, 1.81018734f, -0.813344777f, -1.0f, 0.998634636f,
+		0.128702655f, -0.216540605f, 0.0906095579f, 1.81294835f, -0.815936565f, -1.0f, 0.998635709f,
+		0.228560999f, -0.415948987f, 0.190162405f, 1.81294835f, -0.815936565f, -1.0f, 0.998635709f,
+		0.328419358f, -0.615357399f, 0.28971526f, 1.81294835f, -0.815936565f, -1.0f, 0.998635709f,
+		0.428277701f, -0.814765751f, 0.3892681f, 1.81294835f, -0.815936565f, -1.0f, 0.998635709f,
+		0.528136015f, -1.0141741f, 0.48882094f, 1.81294835f, -0.815936565f, -1.0f, 0.998635709f,
+		0.627994359f, -1.21358252f, 0.58837378f, 1.81294835f, -0.815936565f, -1.0f, 0.998635709f,
+		0.727852702f, -1.41299093f, 0.68792665f, 1.81294835f, -0.815936565f, -1.0f, 0.998635709f,
+		0.827711046f, -1.61239934f, 0.78747952f, 1.81294835f, -0.815936565f, -1.0f, 0.998635709f,
+		0.927569389f, -1.81180763f, 0.88703233f, 1.81294835f, -0.815936565f, -1.0f, 0.998635709f,
+		0.177010983f, -0.307442367f, 0.133073241f, 1.81540143f, -0.818239272f, -1.0f, 0.998636782f,
+		0.271332771f, -0.495793343f, 0.227105126f, 1.81540143f, -0.818239272f, -1.0f, 0.998636782f,
+		0.365654558f, -0.684144378f, 0.321137011f, 1.81540143f, -0.818239272f, -1.0f, 0.998636782f,
+		0.459976345f, -0.872495353f, 0.415168881f, 1.81540143f, -0.818239272f, -1.0f, 0.998636782f,
+		0.554298103f, -1.06084633f, 0.509200752f, 1.81540143f, -0.818239272f, -1.0f, 0.998636782f,
+		0.64861989f, -1.24919736f, 0.603232622f, 1.81540143f, -0.818239272f, -1.0f, 0.998636782f,
+		0.742941678f, -1.4375484f, 0.697264552f, 1.81540143f, -0.818239272f, -1.0f, 0.998636782f,
+		0.837263465f, -1.62589931f, 0.791296422f, 1.81540143f, -0.818239272f, -1.0f, 0.998636782f,
+		0.931585252f, -1.81425035f, 0.885328293f, 1.81540143f, -0.818239272f, -1.0f, 0.998636782f,
+		0.220243886f, -0.388792157f, 0.171074241f, 1.81759489f, -0.820298553f, -1.0f, 0.998637915f,
+		0.309610784f, -0.56724745f, 0.260165215f, 1.81759489f, -0.820298553f, -1.0f, 0.998637915f,
+		0.398977697f, -0.745702803f, 0.349256158f, 1.81759489f, -0.820298553f, -1.0f, 0.998637915f,
+		0.48834461f, -0.924158156f, 0.438347101f, 1.81759489f, -0.820298553f, -1.0f, 0.998637915f,
+		0.577711523f, -1.10261345f, 0.527438045f, 1.81759489f, -0.820298553f, -1.0f, 0.998637915f,
+		0.667078435f, -1.2810688f, 0.616528988f, 1.81759489f, -0.820298553f, -1.0f, 0.998637915f,
+		0.756445348f, -1.45952415f, 0.705619991f, 1.81759489f, -0.820298553f, -1.0f, 0.998637915f,
+		0.845812261f, -1.63797951f, 0.794710934f, 1.81759489f, -0.820298553f, -1.0f, 0.998637915f,
+		0.935179174f, -1.81643474f, 0.883801877f, 1.81759489f, -0.820298553f, -1.0f, 0.998637915f,
+		0.259161294f, -0.462020189f, 0.205280751f, 1.81956768f, -0.822150767f, -1.0f, 0.998639107f,
+		0.344067931f, -0.631567597f, 0.289923966f, 1.81956768f, -0.822150767f, -1.0f, 0.998639107f,
+		0.428974569f, -0.801115036f, 0.374567181f, 1.81956768f, -0.822150767f, -1.0f, 0.998639107f,
+		0.513881207f, -0.970662475f, 0.459210396f, 1.81956768f, -0.822150767f, -1.0f, 0.998639107f,
+		0.598787844f, -1.14020991f, 0.543853641f, 1.81956768f, -0.822150767f, -1.0f, 0.998639107f,
+		0.683694482f, -1.30975735f, 0.628496826f, 1.81956768f, -0.822150767f, -1.0f, 0.998639107f,
+		0.76860112f, -1.47930479f, 0.71314007f, 1.81956768f, -0.822150767f, -1.0f, 0.998639107f,
+		0.853507757f, -1.64885223f, 0.797783256f, 1.81956768f, -0.822150767f, -1.0f, 0.998639107f,
+		0.938414395f, -1.81839967f, 0.8824265f, 1.81956768f, -0.822150767f, -1.0f, 0.998639107f,
+		0.294378638f, -0.528284669f, 0.23623386f, 1.82135117f, -0.823825479f, -1.0f, 0.998640358f,
+		0.375249058f, -0.689771116f, 0.316852212f, 1.82135117f, -0.823825479f, -1.0f, 0.998640358f,
+		0.456119478f, -0.851257563f, 0.397470534f, 1.82135117f, -0.823825479f, -1.0f, 0.998640358f,
+		0.536989927f, -1.01274395f, 0.478088856f, 1.82135117f, -0.823825479f, -1.0f, 0.998640358f,
+		0.617860317f, -1.17423046f, 0.558707178f, 1.82135117f, -0.823825479f, -1.0f, 0.998640358f,
+		0.698730767f, -1.33571684f, 0.6393255f, 1.82135117f, -0.823825479f, -1.0f, 0.998640358f,
+		0.779601157f, -1.49720323f, 0.719943881f, 1.82135117f, -0.823825479f, -1.0f, 0.998640358f,
+		0.860471547f, -1.65868974f, 0.800562203f, 1.82135117f, -0.823825479f, -1.0f, 0.998640358f,
+		0.941341996f, -1.82017612f, 0.881180525f, 1.82135117f, -0.823825479f, -1.0f, 0.998640358f,
+		0.326399684f, -0.58853364f, 0.264376491f, 1.82297122f, -0.825346708f, -1.0f, 0.99864167f,
+		0.403600216f, -0.742690682f, 0.341335237f, 1.82297122f, -0.825346708f, -1.0f, 0.99864167f,
+		0.480800748f, -0.896847725f, 0.418293983f, 1.82297122f, -0.825346708f, -1.0f, 0.99864167f,
+		0.55800128f, -1.05100477f, 0.495252699f, 1.82297122f, -0.825346708f, -1.0f, 0.99864167f,
+		0.635201812f, -1.20516181f, 0.572211444f, 1.82297122f, -0.825346708f, -1.0f, 0.99864167f,
+		0.712402284f, -1.35931885f, 0.64917016f, 1.82297122f, -0.825346708f, -1.0f, 0.99864167f,
+		0.789602816f, -1.51347589f, 0.726128936f, 1.82297122f, -0.825346708f, -1.0f, 0.99864167f,
+		0.866803348f, -1.66763294f, 0.803087652f, 1.82297122f, -0.825346708f, -1.0f, 0.99864167f,
+		0.94400388f, -1.82178998f, 0.880046368f, 1.82297122f, -0.825346708f, -1.0f, 0.99864167f,
+		0.35564065f, -0.643550456f, 0.290074646f, 1.82444906f, -0.826734543f, -1.0f, 0.998643041f,
+		0.429489911f, -0.791014433f, 0.363691509f, 1.82444906f, -0.826734543f, -1.0f, 0.998643041f,
+		0.503339171f, -0.93847841f, 0.437308371f, 1.82444906f, -0.826734543f, -1.0f, 0.998643041f,
+		0.577188432f, -1.08594239f, 0.510925233f, 1.82444906f, -0.826734543f, -1.0f, 0.998643041f,
+		0.651037693f, -1.23340631f, 0.584542096f, 1.82444906f, -0.826734543f, -1.0f, 0.998643041f,
+		0.724886894f, -1.38087034f, 0.658158898f, 1.82444906f, -0.826734543f, -1.0f, 0.998643041f,
+		0.798736155f, -1.52833426f, 0.731775761f, 1.82444906f, -0.826734543f, -1.0f, 0.998643041f,
+		0.872585416f, -1.6757983f, 0.805392623f, 1.82444906f, -0.826734543f, -1.0f, 0.998643041f,
+		0.946434677f, -1.82326221f, 0.879009485f, 1.82444906f, -0.826734543f, -1.0f, 0.998643041f,
+		0.0128156487f, 0.00154259638f, -0.0112730525f, 1.8076278f, -0.810884833f, -1.0f, 0.999068975f,
+		0.125955671f, -0.224508122f, 0.10163974f, 1.8076278f, -0.810884833f, -1.0f, 0.999068975f,
+		0.239095688f, -0.450558841f, 0.214552537f, 1.8076278f, -0.810884833f, -1.0f, 0.999068975f,
+		0.352235705f, -0.676609576f, 0.327465326f, 1.8076278f, -0.810884833f, -1.0f, 0.999068975f,
+		0.465375721f, -0.90266031f, 0.440378129f, 1.8076278f, -0.810884833f, -1.0f, 0.999068975f,
+		0.578515708f, -1.12871099f, 0.553290904f, 1.8076278f, -0.810884833f, -1.0f, 0.999068975f,
+		0.691655755f, -1.35476172f, 0.666203737f, 1.8076278f, -0.810884833f, -1.0f, 0.999068975f,
+		0.804795742f, -1.58081245f, 0.779116511f, 1.8076278f, -0.810884833f, -1.0f, 0.999068975f,
+		0.917935789f, -1.80686319f, 0.892029285f, 1.8076278f, -0.810884833f, -1.0f, 0.999068975f,
+		0.0743753314f, -0.114363007f, 0.0428979658f, 1.81076765f, -0.813831866f, -1.0f, 0.999069273f,
+		0.180460066f, -0.326316804f, 0.148768991f, 1.81076765f, -0.813831866f, -1.0f, 0.999069273f,
+		0.2865448f, -0.538270593f, 0.254640043f, 1.81076765f, -0.813831866f, -1.0f, 0.999069273f,
+		0.392629534f, -0.750224411f, 0.360511065f, 1.81076765f, -0.813831866f, -1.0f, 0.999069273f,
+		0.498714268f, -0.96217823f, 0.466382086f, 1.81076765f, -0.813831866f, -1.0f, 0.999069273f,
+		0.604798973f, -1.17413199f, 0.572253108f, 1.81076765f, -0.813831866f, -1.0f, 0.999069273f,
+		0.710883737f, -1.38608575f, 0.67812413f, 1.81076765f, -0.813831866f, -1.0f, 0.999069273f,
+		0.816968501f, -1.59803963f, 0.783995211f, 1.81076765f, -0.813831866f, -1.0f, 0.999069273f,
+		0.923053205f, -1.80999339f, 0.889866233f, 1.81076765f, -0.813831866f, -1.0f, 0.999069273f,
+		0.128708094f, -0.216660917f, 0.0907088444f, 1.81353807f, -0.816432238f, -1.0f, 0.999069631f,
+		0.228565812f, -0.416172713f, 0.190364793f, 1.81353807f, -0.816432238f, -1.0f, 0.999069631f,
+		0.32842353f, -0.615684509f, 0.290020734f, 1.81353807f, -0.816432238f, -1.0f, 0.999069631f,
+		0.428281248f, -0.815196335f, 0.38967669f, 1.81353807f, -0.816432238f, -1.0f, 0.999069631f,
+		0.528138995f, -1.01470816f, 0.489332646f, 1.81353807f, -0.816432238f, -1.0f, 0.999069631f,
+		0.627996683f, -1.21421993f, 0.588988602f, 1.81353807f, -0.816432238f, -1.0f, 0.999069631f,
+		0.727854431f, -1.41373181f, 0.688644528f, 1.81353807f, -0.816432238f, -1.0f, 0.999069631f,
+		0.827712119f, -1.61324358f, 0.788300455f, 1.81353807f, -0.816432238f, -1.0f, 0.999069631f,
+		0.927569866f, -1.81275547f, 0.88795644f, 1.81353807f, -0.816432238f, -1.0f, 0.999069631f,
+		0.17701599f, -0.307614505f, 0.133217484f, 1.81600058f, -0.818743587f, -1.0f, 0.999069929f,
+		0.271337211f, -0.496064007f, 0.227347523f, 1.81600058f, -0.818743587f, -1.0f, 0.999069929f,
+		0.365658402f, -0.684513509f, 0.321477562f, 1.81600058f, -0.818743587f, -1.0f, 0.999069929f,
+		0.459979624f, -0.872963011f, 0.415607601f, 1.81600058f, -0.818743587f, -1.0f, 0.999069929f,
+		0.554300845f, -1.06141245f, 0.509737611f, 1.81600058f, -0.818743587f, -1.0f, 0.999069929f,
+		0.648622036f, -1.24986196f, 0.60386765f, 1.81600058f, -0.818743587f, -1.0f, 0.999069929f,
+		0.742943287f, -1.43831146f, 0.697997689f, 1.81600058f, -0.818743587f, -1.0f, 0.999069929f,
+		0.837264478f, -1.62676096f, 0.792127728f, 1.81600058f, -0.818743587f, -1.0f, 0.999069929f,
+		0.93158567f, -1.81521046f, 0.886257768f, 1.81600058f, -0.818743587f, -1.0f, 0.999069929f,
+		0.220248535f, -0.389011621f, 0.171259463f, 1.81820357f, -0.82081151f, -1.0f, 0.999070287f,
+		0.309614927f, -0.56756103f, 0.260444164f, 1.81820357f, -0.82081151f, -1.0f, 0.999070287f,
+		0.398981303f, -0.746110439f, 0.349628836f, 1.81820357f, -0.82081151f, -1.0f, 0.999070287f,
+		0.488347679f, -0.924659848f, 0.438813537f, 1.81820357f, -0.82081151f, -1.0f, 0.999070287f,
+		0.577714086f, -1.10320926f, 0.527998209f, 1.81820357f, -0.82081151f, -1.0f, 0.999070287f,
+		0.667080462f, -1.28175867f, 0.61718291f, 1.81820357f, -0.82081151f, -1.0f, 0.999070287f,
+		0.756446838f, -1.46030807f, 0.706367612f, 1.81820357f, -0.82081151f, -1.0f, 0.999070287f,
+		0.845813215f, -1.63885748f, 0.795552313f, 1.81820357f, -0.82081151f, -1.0f, 0.999070287f,
+		0.935179591f, -1.81740677f, 0.884737015f, 1.81820357f, -0.82081151f, -1.0f, 0.999070287f,
+		0.259165615f, -0.462283075f, 0.205503583f, 1.8201859f, -0.822672367f, -1.0f, 0.999070644f,
+		0.344071776f, -0.631920636f, 0.290236562f, 1.8201859f, -0.822672367f, -1.0f, 0.999070644f,
+		0.428977907f, -0.801558137f, 0.374969542f, 1.8201859f, -0.822672367f, -1.0f, 0.999070644f,
+		0.513884068f, -0.971195698f, 0.459702551f, 1.8201859f, -0.822672367f, -1.0f, 0.999070644f,
+		0.598790169f, -1.14083326f, 0.544435501f, 1.8201859f, -0.822672367f, -1.0f, 0.999070644f,
+		0.68369633f, -1.3104707f, 0.62916851f, 1.8201859f, -0.822672367f, -1.0f, 0.999070644f,
+		0.76860249f, -1.48010826f, 0.71390146f, 1.8201859f, -0.822672367f, -1.0f, 0.999070644f,
+		0.853508592f, -1.64974582f, 0.79863447f, 1.8201859f, -0.822672367f, -1.0f, 0.999070644f,
+		0.938414752f, -1.81938338f, 0.883367479f, 1.8201859f, -0.822672367f, -1.0f, 0.999070644f,
+		0.294382721f, -0.528587699f, 0.236491442f, 1.82197917f, -0.824355662f, -1.0f, 0.999071062f,
+		0.375252664f, -0.690160632f, 0.317195952f, 1.82197917f, -0.824355662f, -1.0f, 0.999071062f,
+		0.456122607f, -0.851733625f, 0.397900492f, 1.82197917f, -0.824355662f, -1.0f, 0.999071062f,
+		0.53699255f, -1.0133065f, 0.478605002f, 1.82197917f, -0.824355662f, -1.0f, 0.999071062f,
+		0.617862523f, -1.17487955f, 0.559309483f, 1.82197917f, -0.824355662f, -1.0f, 0.999071062f,
+		0.698732495f, -1.33645248f, 0.640014052f, 1.82197917f, -0.824355662f, -1.0f, 0.999071062f,
+		0.779602408f, -1.49802542f, 0.720718563f, 1.82197917f, -0.824355662f, -1.0f, 0.999071062f,
+		0.860472381f, -1.65959835f, 0.801423073f, 1.82197917f, -0.824355662f, -1.0f, 0.999071062f,
+		0.941342354f, -1.82117128f, 0.882127583f, 1.82197917f, -0.824355662f, -1.0f, 0.999071062f,
+		0.326403499f, -0.588873982f, 0.264666349f, 1.82360888f, -0.825885713f, -1.0f, 0.999071419f,
+		0.403603584f, -0.743114293f, 0.341708034f, 1.82360888f, -0.825885713f, -1.0f, 0.999071419f,
+		0.480803668f, -0.897354543f, 0.41874969f, 1.82360888f, -0.825885713f, -1.0f, 0.999071419f,
+		0.558003783f, -1.05159485f, 0.495791376f, 1.82360888f, -0.825885713f, -1.0f, 0.999071419f,
+		0.635203838f, -1.2058351f, 0.572833002f, 1.82360888f, -0.825885713f, -1.0f, 0.999071419f,
+		0.712403953f, -1.36007547f, 0.649874687f, 1.82360888f, -0.825885713f, -1.0f, 0.999071419f,
+		0.789604008f, -1.51431572f, 0.726916373f, 1.82360888f, -0.825885713f, -1.0f, 0.999071419f,
+		0.866804123f, -1.66855609f, 0.803958058f, 1.82360888f, -0.825885713f, -1.0f, 0.999071419f,
+		0.944004178f, -1.82279634f, 0.880999684f, 1.82360888f, -0.825885713f, -1.0f, 0.999071419f,
+		0.355644256f, -0.643925607f, 0.290394634f, 1.82509661f, -0.82728231f, -1.0f, 0.999071836f,
+		0.429493099f, -0.791469872f, 0.364091456f, 1.82509661f, -0.82728231f, -1.0f, 0.999071836f,
+		0.503341913f, -0.939014137f, 0.437788278f, 1.82509661f, -0.82728231f, -1.0f, 0.999071836f,
+		0.577190757f, -1.08655846f, 0.5114851f, 1.82509661f, -0.82728231f, -1.0f, 0.999071836f,
+		0.6510396f, -1.23410273f, 0.585181952f, 1.82509661f, -0.82728231f, -1.0f, 0.999071836f,
+		0.724888444f, -1.38164699f, 0.658878744f, 1.82509661f, -0.82728231f, -1.0f, 0.999071836f,
+		0.798737288f, -1.52919126f, 0.732575595f, 1.82509661f, -0.82728231f, -1.0f, 0.999071836f,
+		0.872586131f, -1.67673552f, 0.806272388f, 1.82509661f, -0.82728231f, -1.0f, 0.999071836f,
+		0.946434975f, -1.82427979f, 0.879969239f, 1.82509661f, -0.82728231f, -1.0f, 0.999071836f,
+	},
+	// JTM45
+	{
+		0.0184838586f, 0.00438163755f, -0.0141022205f, 1.65148532f, -0.667368114f, -1.0f, 0.990379572f,
+		0.123535134f, -0.202020496f, 0.0873055086f, 1.65148532f, -0.667368114f, -1.0f, 0.990379572f,
+		0.22858642f, -0.408422619f, 0.188713238f, 1.65148532f, -0.667368114f, -1.0f, 0.990379572f,
+		0.333637685f, -0.614824772f, 0.290120959f, 1.65148532f, -0.667368114f, -1.0f, 0.990379572f,
+		0.438688964f, -0.821226895f, 0.391528696f, 1.65148532f, -0.667368114f, -1.0f, 0.990379572f,
+		0.543740273f, -1.02762902f, 0.492936403f, 1.65148532f, -0.667368114f, -1.0f, 0.990379572f,
+		0.648791552f, -1.23403108f, 0.594344139f, 1.65148532f, -0.667368114f, -1.0f, 0.990379572f,
+		0.753842831f, -1.44043326f, 0.695751846f, 1.65148532f, -0.667368114f, -1.0f, 0.990379572f,
+		0.85889411f, -1.64683533f, 0.797159612f, 1.65148532f, -0.667368114f, -1.0f, 0.990379572f,
+		0.110608108f, -0.155843109f, 0.0540599041f, 1.655195f, -0.670808792f, -1.0f, 0.990640044f,
+		0.205799356f, -0.342686355f, 0.145766288f, 1.655195f, -0.670808792f, -1.0f, 0.990640044f,
+		0.300990611f, -0.529529572f, 0.237472668f, 1.655195f, -0.670808792f, -1.0f, 0.990640044f,
+		0.396181881f, -0.716372848f, 0.329179049f, 1.655195f, -0.670808792f, -1.0f, 0.990640044f,
+		0.491373122f, -0.903216064f, 0.420885444f, 1.655195f, -0.670808792f, -1.0f, 0.990640044f,
+		0.586564422f, -1.09005928f, 0.512591839f, 1.655195f, -0.670808792f, -1.0f, 0.990640044f,
+		0.681755662f, -1.27690256f, 0.604298234f, 1.655195f, -0.670808792f, -1.0f, 0.990640044f,
+		0.776946902f, -1.46374583f, 0.69600457f, 1.655195f, -0.670808792f, -1.0f, 0.990640044f,
+		0.872138143f, -1.65058899f, 0.787710965f, 1.655195f, -0.670808792f, -1.0f, 0.990640044f,
+		0.186920092f, -0.288201272f, 0.110252194f, 1.65766692f, -0.673219204f, -1.0f, 0.990904391f,
+		0.273943692f, -0.458822727f, 0.193902671f, 1.65766692f, -0.673219204f, -1.0f, 0.990904391f,
+		0.360967308f, -0.629444182f, 0.277553141f, 1.65766692f, -0.673219204f, -1.0f, 0.990904391f,
+		0.447990924f, -0.800065577f, 0.361203641f, 1.65766692f, -0.673219204f, -1.0f, 0.990904391f,
+		0.53501457f, -0.970687032f, 0.44485411f, 1.65766692f, -0.673219204f, -1.0f, 0.990904391f,
+		0.622038186f, -1.14130843f, 0.52850461f, 1.65766692f, -0.673219204f, -1.0f, 0.990904391f,
+		0.709061801f, -1.31192994f, 0.61215508f, 1.65766692f, -0.673219204f, -1.0f, 0.990904391f,
+		0.796085417f, -1.48255134f, 0.69580555f, 1.65766692f, -0.673219204f, -1.0f, 0.990904391f,
+		0.883109033f, -1.65317285f, 0.779456019f, 1.65766692f, -0.673219204f, -1.0f, 0.990904391f,
+		0.251168638f, -0.39923653f, 0.157265842f, 1.65910161f, -0.674775779f, -1.0f, 0.991169095f,
+		0.331315756f, -0.556178629f, 0.234112352f, 1.65910161f, -0.674775779f, -1.0f, 0.991169095f,
+		0.411462873f, -0.713120699f, 0.310958862f, 1.65910161f, -0.674775779f, -1.0f, 0.991169095f,
+		0.491609991f, -0.870062828f, 0.387805372f, 1.65910161f, -0.674775779f, -1.0f, 0.991169095f,
+		0.571757138f, -1.02700496f, 0.464651853f, 1.65910161f, -0.674775779f, -1.0f, 0.991169095f,
+		0.651904225f, -1.18394697f, 0.541498363f, 1.65910161f, -0.674775779f, -1.0f, 0.991169095f,
+		0.732051373f, -1.3408891f, 0.618344843f, 1.65910161f, -0.674775779f, -1.0f, 0.991169095f,
+		0.81219846f, -1.49783123f, 0.695191383f, 1.65910161f, -0.674775779f, -1.0f, 0.991169095f,
+		0.892345607f, -1.65477335f, 0.772037864f, 1.65910161f, -0.674775779f, -1.0f, 0.991169095f,
+		0.306004256f, -0.493559718f, 0.197062731f, 1.6596179f, -0.675586224f, -1.0f, 0.991431355f,
+		0.380282342f, -0.63880229f, 0.268078119f, 1.6596179f, -0.675586224f, -1.0f, 0.991431355f,
+		0.454560429f, -0.784044802f, 0.339093536f, 1.6596179f, -0.675586224f, -1.0f, 0.991431355f,
+		0.528838515f, -0.929287374f, 0.410108924f, 1.6596179f, -0.675586224f, -1.0f, 0.991431355f,
+		0.603116572f, -1.07452989f, 0.481124341f, 1.6596179f, -0.675586224f, -1.0f, 0.991431355f,
+		0.677394688f, -1.21977246f, 0.552139759f, 1.6596179f, -0.675586224f, -1.0f, 0.991431355f,
+		0.751672745f, -1.36501503f, 0.623155117f, 1.6596179f, -0.675586224f, -1.0f, 0.991431355f,
+		0.825950861f, -1.5102576f, 0.694170535f, 1.6596179f, -0.675586224f, -1.0f, 0.991431355f,
+		0.900228918f, -1.65550017f, 0.765185952f, 1.6596179f, -0.675586224f, -1.0f, 0.991431355f,
+		0.353353798f, -0.574503243f, 0.231054544f, 1.65927243f, -0.675707221f, -1.0f, 0.991688967f,
+		0.422564089f, -0.709615886f, 0.297007769f, 1.65927243f, -0.675707221f, -1.0f, 0.991688967f,
+		0.49177435f, -0.844728589f, 0.362961024f, 1.65927243f, -0.675707221f, -1.0f, 0.991688967f,
+		0.560984671f, -0.979841232f, 0.428914249f, 1.65927243f, -0.675707221f, -1.0f, 0.991688967f,
+		0.630194902f, -1.11495388f, 0.494867474f, 1.65927243f, -0.675707221f, -1.0f, 0.991688967f,
+		0.699405193f, -1.25006664f, 0.560820699f, 1.65927243f, -0.675707221f, -1.0f, 0.991688967f,
+		0.768615484f, -1.38517928f, 0.626773953f, 1.65927243f, -0.675707221f, -1.0f, 0.991688967f,
+		0.837825775f, -1.52029192f, 0.692727208f, 1.65927243f, -0.675707221f, -1.0f, 0.991688967f,
+		0.907036066f, -1.65540457f, 0.758680403f, 1.65927243f, -0.675707221f, -1.0f, 0.991688967f,
+		0.394651711f, -0.64452219f, 0.260273308f, 1.6580689f, -0.675152898f, -1.0f, 0.9919402f,
+		0.4594419f, -0.770767927f, 0.321780115f, 1.6580689f, -0.675152898f, -1.0f, 0.9919402f,
+		0.52423209f, -0.897013724f, 0.383286923f, 1.6580689f, -0.675152898f, -1.0f, 0.9919402f,
+		0.589022279f, -1.0232594f, 0.444793761f, 1.6580689f, -0.675152898f, -1.0f, 0.9919402f,
+		0.653812468f, -1.14950514f, 0.506300569f, 1.6580689f, -0.675152898f, -1.0f, 0.9919402f,
+		0.718602657f, -1.27575088f, 0.567807376f, 1.6580689f, -0.675152898f, -1.0f, 0.9919402f,
+		0.783392787f, -1.40199673f, 0.629314184f, 1.6580689f, -0.675152898f, -1.0f, 0.9919402f,
+		0.848182976f, -1.52824247f, 0.690820992f, 1.6580689f, -0.675152898f, -1.0f, 0.9919402f,
+		0.912973166f, -1.65448821f, 0.752327859f, 1.6580689f, -0.675152898f, -1.0f, 0.9919402f,
+		0.430987746f, -0.705447972f, 0.285477906f, 1.65595841f, -0.673896194f, -1.0f, 0.992183864f,
+		0.491888911f, -0.823854864f, 0.343035817f, 1.65595841f, -0.673896194f, -1.0f, 0.992183864f,
+		0.552790046f, -0.942261755f, 0.400593758f, 1.65595841f, -0.673896194f, -1.0f, 0.992183864f,
+		0.613691211f, -1.06066859f, 0.458151668f, 1.65595841f, -0.673896194f, -1.0f, 0.992183864f,
+		0.674592376f, -1.17907548f, 0.515709639f, 1.65595841f, -0.673896194f, -1.0f, 0.992183864f,
+		0.735493541f, -1.29748237f, 0.573267519f, 1.65595841f, -0.673896194f, -1.0f, 0.992183864f,
+		0.796394646f, -1.41588926f, 0.63082546f, 1.65595841f, -0.673896194f, -1.0f, 0.992183864f,
+		0.857295811f, -1.53429615f, 0.6883834f, 1.65595841f, -0.673896194f, -1.0f, 0.992183864f,
+		0.918196976f, -1.65270305f, 0.745941341f, 1.65595841f, -0.673896194f, -1.0f, 0.992183864f,
+		0.463204622f, -0.758649886f, 0.307220638f, 1.65283287f, -0.671864748f, -1.0f, 0.992419183f,
+		0.520657599f, -0.870061815f, 0.361233294f, 1.65283287f, -0.671864748f, -1.0f, 0.992419183f,
+		0.578110635f, -0.981473744f, 0.41524595f, 1.65283287f, -0.671864748f, -1.0f, 0.992419183f,
+		0.635563612f, -1.09288573f, 0.469258577f, 1.65283287f, -0.671864748f, -1.0f, 0.992419183f,
+		0.693016589f, -1.20429766f, 0.523271203f, 1.65283287f, -0.671864748f, -1.0f, 0.992419183f,
+		0.750469625f, -1.31570959f, 0.577283859f, 1.65283287f, -0.671864748f, -1.0f, 0.992419183f,
+		0.807922602f, -1.42712152f, 0.631296515f, 1.65283287f, -0.671864748f, -1.0f, 0.992419183f,
+		0.865375578f, -1.53853345f, 0.685309172f, 1.65283287f, -0.671864748f, -1.0f, 0.992419183f,
+		0.922828555f, -1.64994538f, 0.739321768f, 1.65283287f, -0.671864748f, -1.0f, 0.992419183f,
+		0.0185578428f, 0.00439917576f, -0.014158668f, 1.65806627f, -0.67205739f, -1.0f, 0.991583467f,
+		0.123601206f, -0.202835754f, 0.0880767405f, 1.65806627f, -0.67205739f, -1.0f, 0.991583467f,
+		0.228644565f, -0.410070688f, 0.190312147f, 1.65806627f, -0.67205739f, -1.0f, 0.991583467f,
+		0.333687931f, -0.617305636f, 0.292547554f, 1.65806627f, -0.67205739f, -1.0f, 0.991583467f,
+		0.438731283f, -0.824540555f, 0.39478296f, 1.65806627f, -0.67205739f, -1.0f, 0.991583467f,
+		0.543774664f, -1.03177547f, 0.497018397f, 1.65806627f, -0.67205739f, -1.0f, 0.991583467f,
+		0.648818016f, -1.23901045f, 0.599253774f, 1.65806627f, -0.67205739f, -1.0f, 0.991583467f,
+		0.753861368f, -1.44624543f, 0.70148921f, 1.65806627f, -0.67205739f, -1.0f, 0.991583467f,
+		0.858904719f, -1.65348029f, 0.803724587f, 1.65806627f, -0.67205739f, -1.0f, 0.991583467f,
+		0.110678077f, -0.156639293f, 0.0546079017f, 1.66266131f, -0.676148534f, -1.0f, 0.991754234f,
+		0.205861852f, -0.344313532f, 0.147139773f, 1.66266131f, -0.676148534f, -1.0f, 0.991754234f,
+		0.301045626f, -0.531987786f, 0.239671648f, 1.66266131f, -0.676148534f, -1.0f, 0.991754234f,
+		0.396229386f, -0.719662011f, 0.332203507f, 1.66266131f, -0.676148534f, -1.0f, 0.991754234f,
+		0.491413146f, -0.907336235f, 0.424735397f, 1.66266131f, -0.676148534f, -1.0f, 0.991754234f,
+		0.586596906f, -1.09501052f, 0.517267287f, 1.66266131f, -0.676148534f, -1.0f, 0.991754234f,
+		0.681780696f, -1.2826848f, 0.609799147f, 1.66266131f, -0.676148534f, -1.0f, 0.991754234f,
+		0.776964426f, -1.47035897f, 0.702331007f, 1.66266131f, -0.676148534f, -1.0f, 0.991754234f,
+		0.872148216f, -1.65803325f, 0.794862866f, 1.66266131f, -0.676148534f, -1.0f, 0.991754234f,
+		0.186987638f, -0.289829403f, 0.111417226f, 1.66614008f, -0.679297388f, -1.0f, 0.991931915f,
+		0.274004012f, -0.461291373f, 0.195902318f, 1.66614008f, -0.679297388f, -1.0f, 0.991931915f,
+		0.361020416f, -0.632753313f, 0.280387402f, 1.66614008f, -0.679297388f, -1.0f, 0.991931915f,
+		0.44803679f, -0.804215312f, 0.364872485f, 1.66614008f, -0.679297388f, -1.0f, 0.991931915f,
+		0.535053194f, -0.975677252f, 0.449357569f, 1.66614008f, -0.679297388f, -1.0f, 0.991931915f,
+		0.622069597f, -1.14713919f, 0.533842683f, 1.66614008f, -0.679297388f, -1.0f, 0.991931915f,
+		0.709085941f, -1.31860113f, 0.618327737f, 1.66614008f, -0.679297388f, -1.0f, 0.991931915f,
+		0.796102345f, -1.49006307f, 0.70281285f, 1.66614008f, -0.679297388f, -1.0f, 0.991931915f,
+		0.883118749f, -1.66152513f, 0.787297964f, 1.66614008f, -0.679297388f, -1.0f, 0.991931915f,
+		0.251235068f, -0.401747048f, 0.159084499f, 1.6687305f, -0.681700468f, -1.0f, 0.992114246f,
+		0.331375062f, -0.559550107f, 0.23678565f, 1.6687305f, -0.681700468f, -1.0f, 0.992114246f,
+		0.411515087f, -0.717353225f, 0.314486802f, 1.6687305f, -0.681700468f, -1.0f, 0.992114246f,
+		0.491655082f, -0.875156343f, 0.392187953f, 1.6687305f, -0.681700468f, -1.0f, 0.992114246f,
+		0.571795106f, -1.03295946f, 0.469889104f, 1.6687305f, -0.681700468f, -1.0f, 0.992114246f,
+		0.651935101f, -1.19076252f, 0.547590256f, 1.6687305f, -0.681700468f, -1.0f, 0.992114246f,
+		0.732075095f, -1.34856558f, 0.625291407f, 1.6687305f, -0.681700468f, -1.0f, 0.992114246f,
+		0.812215149f, -1.50636864f, 0.702992558f, 1.6687305f, -0.681700468f, -1.0f, 0.992114246f,
+		0.892355144f, -1.66417181f, 0.78069371f, 1.6687305f, -0.681700468f, -1.0f, 0.992114246f,
+		0.306070656f, -0.497036725f, 0.199596599f, 1.67058766f, -0.683492243f, -1.0f, 0.992299318f,
+		0.380341649f, -0.643172085f, 0.271497965f, 1.67058766f, -0.683492243f, -1.0f, 0.992299318f,
+		0.454612613f, -0.789307475f, 0.343399316f, 1.67058766f, -0.683492243f, -1.0f, 0.992299318f,
+		0.528883576f, -0.935442805f, 0.415300697f, 1.67058766f, -0.683492243f, -1.0f, 0.992299318f,
+		0.6031546f, -1.08157814f, 0.487202048f, 1.67058766f, -0.683492243f, -1.0f, 0.992299318f,
+		0.677425563f, -1.22771347f, 0.559103429f, 1.67058766f, -0.683492243f, -1.0f, 0.992299318f,
+		0.751696527f, -1.37384892f, 0.63100481f, 1.67058766f, -0.683492243f, -1.0f, 0.992299318f,
+		0.825967491f, -1.51998425f, 0.702906191f, 1.67058766f, -0.683492243f, -1.0f, 0.992299318f,
+		0.900238514f, -1.66611958f, 0.774807513f, 1.67058766f, -0.683492243f, -1.0f, 0.992299318f,
+		0.353421271f, -0.579069555f, 0.23439388f, 1.67181683f, -0.684764981f, -1.0f, 0.992485344f,
+		0.42262435f, -0.715119243f, 0.301276743f, 1.67181683f, -0.684764981f, -1.0f, 0.992485344f,
+		0.491827399f, -0.85116899f, 0.368159622f, 1.67181683f, -0.684764981f, -1.0f, 0.992485344f,
+		0.561030447f, -0.987218738f, 0.4350425f, 1.67181683f, -0.684764981f, -1.0f, 0.992485344f,
+		0.630233526f, -1.12326849f, 0.501925409f, 1.67181683f, -0.684764981f, -1.0f, 0.992485344f,
+		0.699436605f, -1.25931811f, 0.568808258f, 1.67181683f, -0.684764981f, -1.0f, 0.992485344f,
+		0.768639624f, -1.39536786f, 0.635691166f, 1.67181683f, -0.684764981f, -1.0f, 0.992485344f,
+		0.837842703f, -1.53141761f, 0.702574015f, 1.67181683f, -0.684764981f, -1.0f, 0.992485344f,
+		0.907045782f, -1.66746736f, 0.769456923f, 1.67181683f, -0.684764981f, -1.0f, 0.992485344f,
+		0.394721359f, -0.650348425f, 0.264543712f, 1.67248726f, -0.685580671f, -1.0f, 0.992670655f,
+		0.459504098f, -0.777589858f, 0.327038109f, 1.67248726f, -0.685580671f, -1.0f, 0.992670655f,
+		0.524286807f, -0.90483129f, 0.389532506f, 1.67248726f, -0.685580671f, -1.0f, 0.992670655f,
+		0.589069545f, -1.03207266f, 0.452026904f, 1.67248726f, -0.685580671f, -1.0f, 0.992670655f,
+		0.653852284f, -1.15931404f, 0.514521301f, 1.67248726f, -0.685580671f, -1.0f, 0.992670655f,
+		0.718635023f, -1.28655553f, 0.577015698f, 1.67248726f, -0.685580671f, -1.0f, 0.992670655f,
+		0.783417761f, -1.4137969f, 0.639510095f, 1.67248726f, -0.685580671f, -1.0f, 0.992670655f,
+		0.84820044f, -1.54103827f, 0.702004492f, 1.67248726f, -0.685580671f, -1.0f, 0.992670655f,
+		0.912983179f, -1.66827965f, 0.764498889f, 1.67248726f, -0.685580671f, -1.0f, 0.992670655f,
+		0.431060761f, -0.712767184f, 0.290851176f, 1.67264068f, -0.685978413f, -1.0f, 0.992854118f,
+		0.491954118f, -0.832245648f, 0.349471807f, 1.67264068f, -0.685978413f, -1.0f, 0.992854118f,
+		0.552847445f, -0.951724172f, 0.408092469f, 1.67264068f, -0.685978413f, -1.0f, 0.992854118f,
+		0.613740802f, -1.07120264f, 0.466713101f, 1.67264068f, -0.685978413f, -1.0f, 0.992854118f,
+		0.674634099f, -1.19068122f, 0.525333762f, 1.67264068f, -0.685978413f, -1.0f, 0.992854118f,
+		0.735527456f, -1.31015968f, 0.583954394f, 1.67264068f, -0.685978413f, -1.0f, 0.992854118f,
+		0.796420813f, -1.42963815f, 0.642575026f, 1.67264068f, -0.685978413f, -1.0f, 0.992854118f,
+		0.85731411f, -1.54911673f, 0.701195657f, 1.67264068f, -0.685978413f, -1.0f, 0.992854118f,
+		0.918207467f, -1.66859519f, 0.759816289f, 1.67264068f, -0.685978413f, -1.0f, 0.992854118f,
+		0.463282436f, -0.767780483f, 0.313931584f, 1.67229557f, -0.685978413f, -1.0f, 0.993034661f,
+		0.520727098f, -0.880361736f, 0.36910364f, 1.67229557f, -0.685978413f, -1.0f, 0.993034661f,
+		0.57817173f, -0.992942989f, 0.424275696f, 1.67229557f, -0.685978413f, -1.0f, 0.993034661f,
+		0.635616422f, -1.10552418f, 0.479447752f, 1.67229557f, -0.685978413f, -1.0f, 0.993034661f,
+		0.693061113f, -1.21810544f, 0.534619808f, 1.67229557f, -0.685978413f, -1.0f, 0.993034661f,
+		0.750505745f, -1.33068669f, 0.589791834f, 1.67229557f, -0.685978413f, -1.0f, 0.993034661f,
+		0.807950437f, -1.44326794f, 0.64496392f, 1.67229557f, -0.685978413f, -1.0f, 0.993034661f,
+		0.865395069f, -1.55584919f, 0.700135946f, 1.67229557f, -0.685978413f, -1.0f, 0.993034661f,
+		0.922839761f, -1.66843045f, 0.755308032f, 1.67229557f, -0.685978413f, -1.0f, 0.993034661f,
+		0.0186224096f, 0.00441448158f, -0.0142079275f, 1.66344738f, -0.675893903f, -1.0f, 0.992995977f,
+		0.123658858f, -0.203547224f, 0.0887497813f, 1.66344738f, -0.675893903f, -1.0f, 0.992995977f,
+		0.228695303f, -0.411508918f, 0.191707492f, 1.66344738f, -0.675893903f, -1.0f, 0.992995977f,
+		0.333731771f, -0.619470656f, 0.294665188f, 1.66344738f, -0.675893903f, -1.0f, 0.992995977f,
+		0.438768208f, -0.827432334f, 0.397622913f, 1.66344738f, -0.675893903f, -1.0f, 0.992995977f,
+		0.543804646f, -1.03539407f, 0.500580609f, 1.66344738f, -0.675893903f, -1.0f, 0.992995977f,
+		0.648841083f, -1.24335575f, 0.603538334f, 1.66344738f, -0.675893903f, -1.0f, 0.992995977f,
+		0.75387758f, -1.45131743f, 0.706496f, 1.66344738f, -0.675893903f, -1.0f, 0.992995977f,
+		0.858914018f, -1.65927911f, 0.809453726f, 1.66344738f, -0.675893903f, -1.0f, 0.992995977f,
+		0.110737719f, -0.157317907f, 0.0550749861f, 1.66863835f, -0.680425167f, -1.0f, 0.993090808f,
+		0.205915108f, -0.345700443f, 0.148310468f, 1.66863835f, -0.680425167f, -1.0f, 0.993090808f,
+		0.301092476f, -0.534083009f, 0.241545945f, 1.66863835f, -0.680425167f, -1.0f, 0.993090808f,
+		0.396269858f, -0.722465575f, 0.334781408f, 1.66863835f, -0.680425167f, -1.0f, 0.993090808f,
+		0.49144727f, -0.910848081f, 0.428016901f, 1.66863835f, -0.680425167f, -1.0f, 0.993090808f,
+		0.586624622f, -1.09923065f, 0.521252394f, 1.66863835f, -0.680425167f, -1.0f, 0.993090808f,
+		0.681802034f, -1.28761315f, 0.614487827f, 1.66863835f, -0.680425167f, -1.0f, 0.993090808f,
+		0.776979387f, -1.47599578f, 0.70772332f, 1.66863835f, -0.680425167f, -1.0f, 0.993090808f,
+		0.872156799f, -1.66437829f, 0.800958812f, 1.66863835f, -0.680425167f, -1.0f, 0.993090808f,
+		0.187043741f, -0.291181922f, 0.112385042f, 1.67277253f, -0.684057057f, -1.0f, 0.993191838f,
+		0.27405414f, -0.46334213f, 0.197563455f, 1.67277253f, -0.684057057f, -1.0f, 0.993191838f,
+		0.361064523f, -0.635502338f, 0.282741874f, 1.67277253f, -0.684057057f, -1.0f, 0.993191838f,
+		0.448074877f, -0.807662547f, 0.367920309f, 1.67277253f, -0.684057057f, -1.0f, 0.993191838f,
+		0.535085261f, -0.979822755f, 0.453098714f, 1.67277253f, -0.684057057f, -1.0f, 0.993191838f,
+		0.622095644f, -1.1519829f, 0.538277149f, 1.67277253f, -0.684057057f, -1.0f, 0.993191838f,
+		0.709106028f, -1.32414317f, 0.623455584f, 1.67277253f, -0.684057057f, -1.0f, 0.993191838f,
+		0.796116412f, -1.49630332f, 0.708633959f, 1.67277253f, -0.684057057f, -1.0f, 0.993191838f,
+		0.883126795f, -1.66846359f, 0.793812394f, 1.67277253f, -0.684057057f, -1.0f, 0.993191838f,
+		0.251288682f, -0.403774738f, 0.160553381f, 1.67608702f, -0.686992824f, -1.0f, 0.993298173f,
+		0.331422955f, -0.562273204f, 0.238944814f, 1.67608702f, -0.686992824f, -1.0f, 0.993298173f,
+		0.411557227f, -0.72077173f, 0.317336231f, 1.67608702f, -0.686992824f, -1.0f, 0.993298173f,
+		0.4916915f, -0.879270196f, 0.395727664f, 1.67608702f, -0.686992824f, -1.0f, 0.993298173f,
+		0.571825802f, -1.03776872f, 0.474119097f, 1.67608702f, -0.686992824f, -1.0f, 0.993298173f,
+		0.651960075f, -1.19626725f, 0.55251056f, 1.67608702f, -0.686992824f, -1.0f, 0.993298173f,
+		0.732094347f, -1.35476565f, 0.630901992f, 1.67608702f, -0.686992824f, -1.0f, 0.993298173f,
+		0.81222856f, -1.51326418f, 0.709293425f, 1.67608702f, -0.686992824f, -1.0f, 0.993298173f,
+		0.892362833f, -1.6717627f, 0.787684858f, 1.67608702f, -0.686992824f, -1.0f, 0.993298173f,
+		0.306122661f, -0.499759436f, 0.201580748f, 1.67874777f, -0.689375043f, -1.0f, 0.993408799f,
+		0.380388081f, -0.646593928f, 0.274175882f, 1.67874777f, -0.689375043f, -1.0f, 0.993408799f,
+		0.454653502f, -0.793428361f, 0.346771002f, 1.67874777f, -0.689375043f, -1.0f, 0.993408799f,
+		0.528918922f, -0.940262854f, 0.419366121f, 1.67874777f, -0.689375043f, -1.0f, 0.993408799f,
+		0.603184342f, -1.08709729f, 0.491961241f, 1.67874777f, -0.689375043f, -1.0f, 0.993408799f,
+		0.677449703f, -1.23393178f, 0.56455636f, 1.67874777f, -0.689375043f, -1.0f, 0.993408799f,
+		0.751715124f, -1.38076627f, 0.63715148f, 1.67874777f, -0.689375043f, -1.0f, 0.993408799f,
+		0.825980544f, -1.52760065f, 0.709746599f, 1.67874777f, -0.689375043f, -1.0f, 0.993408799f,
+		0.900245965f, -1.67443514f, 0.782341719f, 1.67874777f, -0.689375043f, -1.0f, 0.993408799f,
+		0.353472352f, -0.582524836f, 0.236920714f, 1.68087411f, -0.691306412f, -1.0f, 0.993522882f,
+		0.422669947f, -0.71928364f, 0.304507047f, 1.68087411f, -0.691306412f, -1.0f, 0.993522882f,
+		0.491867542f, -0.856042385f, 0.372093379f, 1.68087411f, -0.691306412f, -1.0f, 0.993522882f,
+		0.561065137f, -0.992801189f, 0.439679712f, 1.68087411f, -0.691306412f, -1.0f, 0.993522882f,
+		0.630262733f, -1.12955999f, 0.507266045f, 1.68087411f, -0.691306412f, -1.0f, 0.993522882f,
+		0.699460328f, -1.26631868f, 0.574852347f, 1.68087411f, -0.691306412f, -1.0f, 0.993522882f,
+		0.768657923f, -1.40307748f, 0.64243871f, 1.68087411f, -0.691306412f, -1.0f, 0.993522882f,
+		0.837855518f, -1.53983629f, 0.710025012f, 1.68087411f, -0.691306412f, -1.0f, 0.993522882f,
+		0.907053113f, -1.67659497f, 0.777611375f, 1.68087411f, -0.691306412f, -1.0f, 0.993522882f,
+		0.394772083f, -0.654592276f, 0.26765427f, 1.68255293f, -0.692861915f, -1.0f, 0.993639469f,
+		0.459549397f, -0.782558918f, 0.330868036f, 1.68255293f, -0.692861915f, -1.0f, 0.993639469f,
+		0.524326682f, -0.91052556f, 0.394081771f, 1.68255293f, -0.692861915f, -1.0f, 0.993639469f,
+		0.589103997f, -1.0384922f, 0.457295507f, 1.68255293f, -0.692861915f, -1.0f, 0.993639469f,
+		0.653881311f, -1.16645885f, 0.520509243f, 1.68255293f, -0.692861915f, -1.0f, 0.993639469f,
+		0.718658566f, -1.29442549f, 0.583723009f, 1.68255293f, -0.692861915f, -1.0f, 0.993639469f,
+		0.783435881f, -1.42239213f, 0.646936774f, 1.68255293f, -0.692861915f, -1.0f, 0.993639469f,
+		0.848213196f, -1.55035877f, 0.71015048f, 1.68255293f, -0.692861915f, -1.0f, 0.993639469f,
+		0.91299051f, -1.67832541f, 0.773364246f, 1.68255293f, -0.692861915f, -1.0f, 0.993639469f,
+		0.431111723f, -0.717875659f, 0.29460147f, 1.68384838f, -0.694097042f, -1.0f, 0.993757725f,
+		0.491999626f, -0.838102102f, 0.353963822f, 1.68384838f, -0.694097042f, -1.0f, 0.993757725f,
+		0.552887499f, -0.958328545f, 0.413326204f, 1.68384838f, -0.694097042f, -1.0f, 0.993757725f,
+		0.613775373f, -1.07855499f, 0.472688556f, 1.68384838f, -0.694097042f, -1.0f, 0.993757725f,
+		0.674663246f, -1.19878137f, 0.532050908f, 1.68384838f, -0.694097042f, -1.0f, 0.993757725f,
+		0.735551119f, -1.31900787f, 0.591413319f, 1.68384838f, -0.694097042f, -1.0f, 0.993757725f,
+		0.796439052f, -1.43923426f, 0.650775671f, 1.68384838f, -0.694097042f, -1.0f, 0.993757725f,
+		0.857326925f, -1.55946064f, 0.710138023f, 1.68384838f, -0.694097042f, -1.0f, 0.993757725f,
+		0.918214798f, -1.67968714f, 0.769500434f, 1.68384838f, -0.694097042f, -1.0f, 0.993757725f,
+		0.463334173f, -0.773853302f, 0.318395048f, 1.6848073f, -0.695052981f, -1.0f, 0.993876874f,
+		0.520773292f, -0.887212276f, 0.374338239f, 1.6848073f, -0.695052981f, -1.0f, 0.993876874f,
+		0.57821244f, -1.00057125f, 0.43028143f, 1.6848073f, -0.695052981f, -1.0f, 0.993876874f,
+		0.635651529f, -1.11393011f, 0.486224592f, 1.6848073f, -0.695052981f, -1.0f, 0.993876874f,
+		0.693090677f, -1.22728908f, 0.542167783f, 1.6848073f, -0.695052981f, -1.0f, 0.993876874f,
+		0.750529826f, -1.34064806f, 0.598110974f, 1.6848073f, -0.695052981f, -1.0f, 0.993876874f,
+		0.807968915f, -1.45400703f, 0.654054165f, 1.6848073f, -0.695052981f, -1.0f, 0.993876874f,
+		0.865408063f, -1.567366f, 0.709997296f, 1.6848073f, -0.695052981f, -1.0f, 0.993876874f,
+		0.922847211f, -1.68072498f, 0.765940487f, 1.6848073f, -0.695052981f, -1.0f, 0.993876874f,
+		0.018674735f, 0.0044268854f, -0.0142478505f, 1.66747415f, -0.678766906f, -1.0f, 0.994475007f,
+		0.123705588f, -0.204123825f, 0.0892952308f, 1.66747415f, -0.678766906f, -1.0f, 0.994475007f,
+		0.22873643f, -0.412674516f, 0.192838311f, 1.66747415f, -0.678766906f, -1.0f, 0.994475007f,
+		0.333767295f, -0.621225238f, 0.296381414f, 1.66747415f, -0.678766906f, -1.0f, 0.994475007f,
+		0.43879813f, -0.829775929f, 0.399924487f, 1.66747415f, -0.678766906f, -1.0f, 0.994475007f,
+		0.543828964f, -1.03832662f, 0.50346756f, 1.66747415f, -0.678766906f, -1.0f, 0.994475007f,
+		0.648859859f, -1.24687731f, 0.607010663f, 1.66747415f, -0.678766906f, -1.0f, 0.994475007f,
+		0.753890693f, -1.45542812f, 0.710553706f, 1.66747415f, -0.678766906f, -1.0f, 0.994475007f,
+		0.858921528f, -1.66397882f, 0.814096808f, 1.66747415f, -0.678766906f, -1.0f, 0.994475007f,
+		0.110785112f, -0.157857165f, 0.0554461591f, 1.67302167f, -0.68356353f, -1.0f, 0.994519293f,
+		0.205957428f, -0.346802562f, 0.149240762f, 1.67302167f, -0.68356353f, -1.0f, 0.994519293f,
+		0.301129729f, -0.535748005f, 0.243035346f, 1.67302167f, -0.68356353f, -1.0f, 0.994519293f,
+		0.396302044f, -0.724693358f, 0.33682996f, 1.67302167f, -0.68356353f, -1.0f, 0.994519293f,
+		0.49147436f, -0.913638771f, 0.430624545f, 1.67302167f, -0.68356353f, -1.0f, 0.994519293f,
+		0.586646676f, -1.10258424f, 0.524419129f, 1.67302167f, -0.68356353f, -1.0f, 0.994519293f,
+		0.681818962f, -1.29152954f, 0.618213773f, 1.67302167f, -0.68356353f, -1.0f, 0.994519293f,
+		0.776991308f, -1.48047495f, 0.712008357f, 1.67302167f, -0.68356353f, -1.0f, 0.994519293f,
+		0.872163594f, -1.66942036f, 0.805802941f, 1.67302167f, -0.68356353f, -1.0f, 0.994519293f,
+		0.187087417f, -0.292234421f, 0.113138162f, 1.67753875f, -0.687479377f, -1.0f, 0.994567275f,
+		0.274093121f, -0.464937955f, 0.1988561f, 1.67753875f, -0.687479377f, -1.0f, 0.994567275f,
+		0.361098826f, -0.63764149f, 0.284574032f, 1.67753875f, -0.687479377f, -1.0f, 0.994567275f,
+		0.448104531f, -0.810345054f, 0.370291978f, 1.67753875f, -0.687479377f, -1.0f, 0.994567275f,
+		0.535110235f, -0.983048618f, 0.456009924f, 1.67753875f, -0.687479377f, -1.0f, 0.994567275f,
+		0.62211597f, -1.15575218f, 0.541727841f, 1.67753875f, -0.687479377f, -1.0f, 0.994567275f,
+		0.709121644f, -1.32845569f, 0.627445817f, 1.67753875f, -0.687479377f, -1.0f, 0.994567275f,
+		0.796127379f, -1.50115919f, 0.713163733f, 1.67753875f, -0.687479377f, -1.0f, 0.994567275f,
+		0.883133054f, -1.67386281f, 0.79888171f, 1.67753875f, -0.687479377f, -1.0f, 0.994567275f,
+		0.251329511f, -0.405317605f, 0.161671057f, 1.68126488f, -0.690719724f, -1.0f, 0.994618714f,
+		0.331459403f, -0.564345241f, 0.240587726f, 1.68126488f, -0.690719724f, -1.0f, 0.994618714f,
+		0.411589324f, -0.723372877f, 0.31950441f, 1.68126488f, -0.690719724f, -1.0f, 0.994618714f,
+		0.491719216f, -0.882400513f, 0.398421079f, 1.68126488f, -0.690719724f, -1.0f, 0.994618714f,
+		0.571849108f, -1.04142809f, 0.477337748f, 1.68126488f, -0.690719724f, -1.0f, 0.994618714f,
+		0.651979029f, -1.20045578f, 0.556254387f, 1.68126488f, -0.690719724f, -1.0f, 0.994618714f,
+		0.732108951f, -1.35948336f, 0.635171056f, 1.68126488f, -0.690719724f, -1.0f, 0.994618714f,
+		0.812238812f, -1.51851106f, 0.714087784f, 1.68126488f, -0.690719724f, -1.0f, 0.994618714f,
+		0.892368734f, -1.67753863f, 0.793004453f, 1.68126488f, -0.690719724f, -1.0f, 0.994618714f,
+		0.306161314f, -0.501782f, 0.203054667f, 1.68436897f, -0.693429351f, -1.0f, 0.994673431f,
+		0.380422592f, -0.649135768f, 0.276165128f, 1.68436897f, -0.693429351f, -1.0f, 0.994673431f,
+		0.45468387f, -0.796489537f, 0.349275619f, 1.68436897f, -0.693429351f, -1.0f, 0.994673431f,
+		0.528945148f, -0.943843365f, 0.42238611f, 1.68436897f, -0.693429351f, -1.0f, 0.994673431f,
+		0.603206396f, -1.09119713f, 0.495496571f, 1.68436897f, -0.693429351f, -1.0f, 0.994673431f,
+		0.677467704f, -1.2385509f, 0.568607032f, 1.68436897f, -0.693429351f, -1.0f, 0.994673431f,
+		0.751728952f, -1.38590467f, 0.641717553f, 1.68436897f, -0.693429351f, -1.0f, 0.994673431f,
+		0.82599026f, -1.53325856f, 0.714828014f, 1.68436897f, -0.693429351f, -1.0f, 0.994673431f,
+		0.900251508f, -1.68061233f, 0.787938476f, 1.68436897f, -0.693429351f, -1.0f, 0.994673431f,
+		0.353509307f, -0.585026205f, 0.238749921f, 1.68697369f, -0.69571346f, -1.0f, 0.994731069f,
+		0.422702968f, -0.722298265f, 0.306845486f, 1.68697369f, -0.69571346f, -1.0f, 0.994731069f,
+		0.4918966f, -0.859570324f, 0.374941051f, 1.68697369f, -0.69571346f, -1.0f, 0.994731069f,
+		0.561090231f, -0.996842384f, 0.443036616f, 1.68697369f, -0.69571346f, -1.0f, 0.994731069f,
+		0.630283892f, -1.13411438f, 0.511132181f, 1.68697369f, -0.69571346f, -1.0f, 0.994731069f,
+		0.699477494f, -1.2713865f, 0.579227746f, 1.68697369f, -0.69571346f, -1.0f, 0.994731069f,
+		0.768671155f, -1.4086585f, 0.64732331f, 1.68697369f, -0.69571346f, -1.0f, 0.994731069f,
+		0.837864757f, -1.54593062f, 0.715418875f, 1.68697369f, -0.69571346f, -1.0f, 0.994731069f,
+		0.907058418f, -1.68320262f, 0.78351444f, 1.68697369f, -0.69571346f, -1.0f, 0.994731069f,
+		0.394807816f, -0.657580078f, 0.269844234f, 1.68916976f, -0.697650075f, -1.0f, 0.994791329f,
+		0.459581286f, -0.786057353f, 0.33356443f, 1.68916976f, -0.697650075f, -1.0f, 0.994791329f,
+		0.524354756f, -0.914534569f, 0.397284627f, 1.68916976f, -0.697650075f, -1.0f, 0.994791329f,
+		0.589128256f, -1.04301178f, 0.461004823f, 1.68916976f, -0.697650075f, -1.0f, 0.994791329f,
+		0.653901696f, -1.171489f, 0.52472502f, 1.68916976f, -0.697650075f, -1.0f, 0.994791329f,
+		0.718675196f, -1.29996622f, 0.588445246f, 1.68916976f, -0.697650075f, -1.0f, 0.994791329f,
+		0.783448696f, -1.42844355f, 0.652165413f, 1.68916976f, -0.697650075f, -1.0f, 0.994791329f,
+		0.848222136f, -1.55692077f, 0.715885639f, 1.68916976f, -0.697650075f, -1.0f, 0.994791329f,
+		0.912995636f, -1.68539798f, 0.779605865f, 1.68916976f, -0.697650075f, -1.0f, 0.994791329f,
+		0.431146562f, -0.721365571f, 0.297163546f, 1.69102621f, -0.699298203f, -1.0f, 0.994853914f,
+		0.49203071f, -0.842103004f, 0.357032627f, 1.69102621f, -0.699298203f, -1.0f, 0.994853914f,
+		0.552914858f, -0.962840378f, 0.416901737f, 1.69102621f, -0.699298203f, -1.0f, 0.994853914f,
+		0.613799036f, -1.08357775f, 0.476770818f, 1.69102621f, -0.699298203f, -1.0f, 0.994853914f,
+		0.674683154f, -1.20431519f, 0.536639929f, 1.69102621f, -0.699298203f, -1.0f, 0.994853914f,
+		0.735567331f, -1.32505262f, 0.59650898f, 1.69102621f, -0.699298203f, -1.0f, 0.994853914f,
+		0.796451509f, -1.44579005f, 0.65637809f, 1.69102621f, -0.699298203f, -1.0f, 0.994853914f,
+		0.857335627f, -1.56652737f, 0.716247201f, 1.69102621f, -0.699298203f, -1.0f, 0.994853914f,
+		0.918219805f, -1.6872648f, 0.776116252f, 1.69102621f, -0.699298203f, -1.0f, 0.994853914f,
+		0.463368386f, -0.777868688f, 0.321346372f, 1.6925956f, -0.700703204f, -1.0f, 0.994918466f,
+		0.520803869f, -0.891741872f, 0.377799422f, 1.6925956f, -0.700703204f, -1.0f, 0.994918466f,
+		0.578239322f, -1.00561512f, 0.434252471f, 1.6925956f, -0.700703204f, -1.0f, 0.994918466f,
+		0.635674775f, -1.11948824f, 0.49070555f, 1.6925956f, -0.700703204f, -1.0f, 0.994918466f,
+		0.693110228f, -1.23336148f, 0.547158599f, 1.6925956f, -0.700703204f, -1.0f, 0.994918466f,
+		0.75054574f, -1.34723461f, 0.603611648f, 1.6925956f, -0.700703204f, -1.0f, 0.994918466f,
+		0.807981193f, -1.46110785f, 0.660064697f, 1.6925956f, -0.700703204f, -1.0f, 0.994918466f,
+		0.865416646f, -1.57498109f, 0.716517806f, 1.6925956f, -0.700703204f, -1.0f, 0.994918466f,
+		0.922852099f, -1.68885422f, 0.772970855f, 1.6925956f, -0.700703204f, -1.0f, 0.994918466f,
+		0.0187146589f, 0.00443634903f, -0.0142783094f, 1.67029679f, -0.680782437f, -1.0f, 0.995853066f,
+		0.123741232f, -0.204563737f, 0.0897113904f, 1.67029679f, -0.680782437f, -1.0f, 0.995853066f,
+		0.228767812f, -0.413563848f, 0.193701088f, 1.67029679f, -0.680782437f, -1.0f, 0.995853066f,
+		0.333794385f, -0.622563899f, 0.297690809f, 1.67029679f, -0.680782437f, -1.0f, 0.995853066f,
+		0.438820958f, -0.831564009f, 0.401680499f, 1.67029679f, -0.680782437f, -1.0f, 0.995853066f,
+		0.543847561f, -1.04056406f, 0.50567019f, 1.67029679f, -0.680782437f, -1.0f, 0.995853066f,
+		0.648874104f, -1.24956417f, 0.60965991f, 1.67029679f, -0.680782437f, -1.0f, 0.995853066f,
+		0.753900707f, -1.45856428f, 0.713649631f, 1.67029679f, -0.680782437f, -1.0f, 0.995853066f,
+		0.85892725f, -1.66756439f, 0.817639291f, 1.67029679f, -0.680782437f, -1.0f, 0.995853066f,
+		0.110820718f, -0.158262327f, 0.0557250232f, 1.6760366f, -0.685723841f, -1.0f, 0.995870769f,
+		0.205989212f, -0.34763062f, 0.149939686f, 1.6760366f, -0.685723841f, -1.0f, 0.995870769f,
+		0.301157713f, -0.536998868f, 0.244154364f, 1.6760366f, -0.685723841f, -1.0f, 0.995870769f,
+		0.396326214f, -0.726367176f, 0.338369042f, 1.6760366f, -0.685723841f, -1.0f, 0.995870769f,
+		0.491494715f, -0.915735483f, 0.43258369f, 1.6760366f, -0.685723841f, -1.0f, 0.995870769f,
+		0.586663246f, -1.10510373f, 0.526798368f, 1.6760366f, -0.685723841f, -1.0f, 0.995870769f,
+		0.681831717f, -1.29447198f, 0.621013045f, 1.6760366f, -0.685723841f, -1.0f, 0.995870769f,
+		0.777000248f, -1.48384035f, 0.715227723f, 1.6760366f, -0.685723841f, -1.0f, 0.995870769f,
+		0.87216872f, -1.67320859f, 0.809442401f, 1.6760366f, -0.685723841f, -1.0f, 0.995870769f,
+		0.187119693f, -0.2930125f, 0.113694936f, 1.68075633f, -0.689791381f, -1.0f, 0.995890141f,
+		0.27412194f, -0.46611774f, 0.199811742f, 1.68075633f, -0.689791381f, -1.0f, 0.995890141f,
+		0.361124188f, -0.63922298f, 0.285928547f, 1.68075633f, -0.689791381f, -1.0f, 0.995890141f,
+		0.448126465f, -0.812328219f, 0.372045368f, 1.68075633f, -0.689791381f, -1.0f, 0.995890141f,
+		0.535128713f, -0.985433459f, 0.458162189f, 1.68075633f, -0.689791381f, -1.0f, 0.995890141f,
+		0.62213093f, -1.1585387f, 0.544278979f, 1.68075633f, -0.689791381f, -1.0f, 0.995890141f,
+		0.709133208f, -1.33164394f, 0.63039577f, 1.68075633f, -0.689791381f, -1.0f, 0.995890141f,
+		0.796135485f, -1.50474918f, 0.71651262f, 1.68075633f, -0.689791381f, -1.0f, 0.995890141f,
+		0.883137703f, -1.67785442f, 0.802629411f, 1.68075633f, -0.689791381f, -1.0f, 0.995890141f,
+		0.251359195f, -0.406439155f, 0.162483513f, 1.68469632f, -0.693191171f, -1.0f, 0.995911181f,
+		0.331485897f, -0.56585145f, 0.24178198f, 1.68469632f, -0.693191171f, -1.0f, 0.995911181f,
+		0.41161263f, -0.725263715f, 0.321080446f, 1.68469632f, -0.693191171f, -1.0f, 0.995911181f,
+		0.491739362f, -0.88467598f, 0.400378942f, 1.68469632f, -0.693191171f, -1.0f, 0.995911181f,
+		0.571866095f, -1.04408824f, 0.479677409f, 1.68469632f, -0.693191171f, -1.0f, 0.995911181f,
+		0.651992798f, -1.20350051f, 0.558975875f, 1.68469632f, -0.693191171f, -1.0f, 0.995911181f,
+		0.73211956f, -1.36291277f, 0.638274372f, 1.68469632f, -0.693191171f, -1.0f, 0.995911181f,
+		0.812246263f, -1.52232504f, 0.717572808f, 1.68469632f, -0.693191171f, -1.0f, 0.995911181f,
+		0.892372966f, -1.6817373f, 0.796871305f, 1.68469632f, -0.693191171f, -1.0f, 0.995911181f,
+		0.306188881f, -0.50322634f, 0.204107225f, 1.68802607f, -0.696068585f, -1.0f, 0.995933771f,
+		0.380447209f, -0.650950968f, 0.277585745f, 1.68802607f, -0.696068585f, -1.0f, 0.995933771f,
+		0.454705536f, -0.798675656f, 0.351064235f, 1.68802607f, -0.696068585f, -1.0f, 0.995933771f,
+		0.528963864f, -0.946400285f, 0.424542755f, 1.68802607f, -0.696068585f, -1.0f, 0.995933771f,
+		0.603222191f, -1.09412491f, 0.498021245f, 1.68802607f, -0.696068585f, -1.0f, 0.995933771f,
+		0.677480519f, -1.24184966f, 0.571499765f, 1.68802607f, -0.696068585f, -1.0f, 0.995933771f,
+		0.751738846f, -1.38957429f, 0.644978285f, 1.68802607f, -0.696068585f, -1.0f, 0.995933771f,
+		0.825997174f, -1.53729892f, 0.718456805f, 1.68802607f, -0.696068585f, -1.0f, 0.995933771f,
+		0.900255501f, -1.68502355f, 0.791935265f, 1.68802607f, -0.696068585f, -1.0f, 0.995933771f,
+		0.353535235f, -0.586779416f, 0.240032077f, 1.69086897f, -0.698529541f, -1.0f, 0.995957911f,
+		0.422726095f, -0.724411309f, 0.308484584f, 1.69086897f, -0.698529541f, -1.0f, 0.995957911f,
+		0.491916955f, -0.862043142f, 0.376937091f, 1.69086897f, -0.698529541f, -1.0f, 0.995957911f,
+		0.561107814f, -0.999674976f, 0.445389599f, 1.69086897f, -0.698529541f, -1.0f, 0.995957911f,
+		0.630298674f, -1.13730681f, 0.513842106f, 1.69086897f, -0.698529541f, -1.0f, 0.995957911f,
+		0.699489534f, -1.2749387f, 0.582294583f, 1.69086897f, -0.698529541f, -1.0f, 0.995957911f,
+		0.768680394f, -1.41257048f, 0.65074712f, 1.69086897f, -0.698529541f, -1.0f, 0.995957911f,
+		0.837871253f, -1.55020237f, 0.719199598f, 1.69086897f, -0.698529541f, -1.0f, 0.995957911f,
+		0.907062173f, -1.68783414f, 0.787652135f, 1.69086897f, -0.698529541f, -1.0f, 0.995957911f,
+		0.394832373f, -0.659633636f, 0.2713494f, 1.69331694f, -0.700652659f, -1.0f, 0.995983541f,
+		0.45960322f, -0.788461804f, 0.335417688f, 1.69331694f, -0.700652659f, -1.0f, 0.995983541f,
+		0.524374068f, -0.917289972f, 0.399485976f, 1.69331694f, -0.700652659f, -1.0f, 0.995983541f,
+		0.589144886f, -1.04611814f, 0.463554263f, 1.69331694f, -0.700652659f, -1.0f, 0.995983541f,
+		0.653915763f, -1.17494631f, 0.527622521f, 1.69331694f, -0.700652659f, -1.0f, 0.995983541f,
+		0.718686581f, -1.30377448f, 0.591690838f, 1.69331694f, -0.700652659f, -1.0f, 0.995983541f,
+		0.783457458f, -1.43260264f, 0.655759096f, 1.69331694f, -0.700652659f, -1.0f, 0.995983541f,
+		0.848228335f, -1.56143081f, 0.719827414f, 1.69331694f, -0.700652659f, -1.0f, 0.995983541f,
+		0.912999153f, -1.69025898f, 0.783895671f, 1.69331694f, -0.700652659f, -1.0f, 0.995983541f,
+		0.431169987f, -0.723715067f, 0.298888385f, 1.69543958f, -0.702497721f, -1.0f, 0.996010661f,
+		0.492051631f, -0.844796479f, 0.359098613f, 1.69543958f, -0.702497721f, -1.0f, 0.996010661f,
+		0.552933276f, -0.965877891f, 0.419308841f, 1.69543958f, -0.702497721f, -1.0f, 0.996010661f,
+		0.61381495f, -1.08695924f, 0.479519039f, 1.69543958f, -0.702497721f, -1.0f, 0.996010661f,
+		0.674696565f, -1.2080406f, 0.539729297f, 1.69543958f, -0.702497721f, -1.0f, 0.996010661f,
+		0.735578239f, -1.32912207f, 0.599939525f, 1.69543958f, -0.702497721f, -1.0f, 0.996010661f,
+		0.796459854f, -1.45020342f, 0.660149753f, 1.69543958f, -0.702497721f, -1.0f, 0.996010661f,
+		0.857341528f, -1.57128477f, 0.720359981f, 1.69543958f, -0.702497721f, -1.0f, 0.996010661f,
+		0.918223143f, -1.69236624f, 0.780570209f, 1.69543958f, -0.702497721f, -1.0f, 0.996010661f,
+		0.463390917f, -0.780513465f, 0.323290229f, 1.69729078f, -0.70411092f, -1.0f, 0.996039093f,
+		0.520823956f, -0.894725323f, 0.38007912f, 1.69729078f, -0.70411092f, -1.0f, 0.996039093f,
+		0.578257024f, -1.00893724f, 0.436868012f, 1.69729078f, -0.70411092f, -1.0f, 0.996039093f,
+		0.635690093f, -1.12314916f, 0.493656904f, 1.69729078f, -0.70411092f, -1.0f, 0.996039093f,
+		0.693123102f, -1.23736095f, 0.550445795f, 1.69729078f, -0.70411092f, -1.0f, 0.996039093f,
+		0.750556171f, -1.35157287f, 0.607234716f, 1.69729078f, -0.70411092f, -1.0f, 0.996039093f,
+		0.80798924f, -1.46578479f, 0.664023578f, 1.69729078f, -0.70411092f, -1.0f, 0.996039093f,
+		0.865422308f, -1.57999671f, 0.7208125f, 1.69729078f, -0.70411092f, -1.0f, 0.996039093f,
+		0.922855377f, -1.69420862f, 0.777601361f, 1.69729078f, -0.70411092f, -1.0f, 0.996039093f,
+		0.0187437367f, 0.00444324221f, -0.0143004945f, 1.67219758f, -0.682140827f, -1.0f, 0.997012019f,
+		0.123767205f, -0.204884171f, 0.0900145099f, 1.67219758f, -0.682140827f, -1.0f, 0.997012019f,
+		0.228790671f, -0.414211571f, 0.194329515f, 1.67219758f, -0.682140827f, -1.0f, 0.997012019f,
+		0.333814114f, -0.623538971f, 0.298644513f, 1.67219758f, -0.682140827f, -1.0f, 0.997012019f,
+		0.438837588f, -0.83286643f, 0.402959526f, 1.67219758f, -0.682140827f, -1.0f, 0.997012019f,
+		0.543861032f, -1.04219377f, 0.507274508f, 1.67219758f, -0.682140827f, -1.0f, 0.997012019f,
+		0.648884535f, -1.25152123f, 0.611589551f, 1.67219758f, -0.682140827f, -1.0f, 0.997012019f,
+		0.753907979f, -1.46084869f, 0.715904534f, 1.67219758f, -0.682140827f, -1.0f, 0.997012019f,
+		0.858931422f, -1.67017603f, 0.820219576f, 1.67219758f, -0.682140827f, -1.0f, 0.997012019f,
+		0.110846356f, -0.158554077f, 0.0559258312f, 1.67803335f, -0.687155664f, -1.0f, 0.997018278f,
+		0.206012115f, -0.348226875f, 0.150442988f, 1.67803335f, -0.687155664f, -1.0f, 0.997018278f,
+		0.301177859f, -0.537899673f, 0.244960159f, 1.67803335f, -0.687155664f, -1.0f, 0.997018278f,
+		0.396343619f, -0.727572441f, 0.33947733f, 1.67803335f, -0.687155664f, -1.0f, 0.997018278f,
+		0.491509378f, -0.917245269f, 0.433994472f, 1.67803335f, -0.687155664f, -1.0f, 0.997018278f,
+		0.586675167f, -1.1069181f, 0.528511643f, 1.67803335f, -0.687155664f, -1.0f, 0.997018278f,
+		0.681840897f, -1.29659081f, 0.623028815f, 1.67803335f, -0.687155664f, -1.0f, 0.997018278f,
+		0.777006686f, -1.48626363f, 0.717545986f, 1.67803335f, -0.687155664f, -1.0f, 0.997018278f,
+		0.872172415f, -1.67593646f, 0.812063098f, 1.67803335f, -0.687155664f, -1.0f, 0.997018278f,
+		0.18714267f, -0.293566227f, 0.114091165f, 1.68285251f, -0.691298723f, -1.0f, 0.997025192f,
+		0.274142474f, -0.466957331f, 0.200491831f, 1.68285251f, -0.691298723f, -1.0f, 0.997025192f,
+		0.361142248f, -0.640348434f, 0.286892474f, 1.68285251f, -0.691298723f, -1.0f, 0.997025192f,
+		0.448142052f, -0.813739538f, 0.373293161f, 1.68285251f, -0.691298723f, -1.0f, 0.997025192f,
+		0.535141826f, -0.987130642f, 0.459693819f, 1.68285251f, -0.691298723f, -1.0f, 0.997025192f,
+		0.622141659f, -1.16052175f, 0.546094477f, 1.68285251f, -0.691298723f, -1.0f, 0.997025192f,
+		0.709141433f, -1.33391285f, 0.632495105f, 1.68285251f, -0.691298723f, -1.0f, 0.997025192f,
+		0.796141207f, -1.50730395f, 0.718895793f, 1.68285251f, -0.691298723f, -1.0f, 0.997025192f,
+		0.883141041f, -1.68069506f, 0.805296421f, 1.68285251f, -0.691298723f, -1.0f, 0.997025192f,
+		0.251380056f, -0.407227606f, 0.163054675f, 1.68689561f, -0.694776297f, -1.0f, 0.997032702f,
+		0.331504524f, -0.566910267f, 0.242621556f, 1.68689561f, -0.694776297f, -1.0f, 0.997032702f,
+		0.411629021f, -0.726592958f, 0.322188437f, 1.68689561f, -0.694776297f, -1.0f, 0.997032702f,
+		0.491753519f, -0.886275649f, 0.401755333f, 1.68689561f, -0.694776297f, -1.0f, 0.997032702f,
+		0.571878016f, -1.04595828f, 0.481322199f, 1.68689561f, -0.694776297f, -1.0f, 0.997032702f,
+		0.652002513f, -1.20564091f, 0.560889125f, 1.68689561f, -0.694776297f, -1.0f, 0.997032702f,
+		0.732127011f, -1.36532366f, 0.640455961f, 1.68689561f, -0.694776297f, -1.0f, 0.997032702f,
+		0.812251508f, -1.52500629f, 0.720022857f, 1.68689561f, -0.694776297f, -1.0f, 0.997032702f,
+		0.892376006f, -1.68468893f, 0.799589753f, 1.68689561f, -0.694776297f, -1.0f, 0.997032702f,
+		0.306208044f, -0.504229009f, 0.204837903f, 1.69033253f, -0.697734296f, -1.0f, 0.997040868f,
+		0.380464315f, -0.65221113f, 0.278571904f, 1.69033253f, -0.697734296f, -1.0f, 0.997040868f,
+		0.454720587f, -0.80019325f, 0.352305889f, 1.69033253f, -0.697734296f, -1.0f, 0.997040868f,
+		0.528976858f, -0.948175311f, 0.426039875f, 1.69033253f, -0.697734296f, -1.0f, 0.997040868f,
+		0.603233159f, -1.09615743f, 0.49977389f, 1.69033253f, -0.697734296f, -1.0f, 0.997040868f,
+		0.6774894f, -1.24413955f, 0.573507845f, 1.69033253f, -0.697734296f, -1.0f, 0.997040868f,
+		0.751745701f, -1.39212167f, 0.647241831f, 1.69033253f, -0.697734296f, -1.0f, 0.997040868f,
+		0.826001942f, -1.54010379f, 0.720975876f, 1.69033253f, -0.697734296f, -1.0f, 0.997040868f,
+		0.900258243f, -1.68808591f, 0.794709861f, 1.69033253f, -0.697734296f, -1.0f, 0.997040868f,
+		0.353552967f, -0.587980747f, 0.24091059f, 1.69328701f, -0.700278699f, -1.0f, 0.99704963f,
+		0.42274195f, -0.725859106f, 0.309607655f, 1.69328701f, -0.700278699f, -1.0f, 0.99704963f,
+		0.491930902f, -0.863737464f, 0.37830475f, 1.69328701f, -0.700278699f, -1.0f, 0.99704963f,
+		0.561119854f, -1.00161588f, 0.447001815f, 1.69328701f, -0.700278699f, -1.0f, 0.99704963f,
+		0.630308867f, -1.13949418f, 0.51569891f, 1.69328701f, -0.700278699f, -1.0f, 0.99704963f,
+		0.699497819f, -1.2773726f, 0.584395945f, 1.69328701f, -0.700278699f, -1.0f, 0.99704963f,
+		0.768686771f, -1.4152509f, 0.65309304f, 1.69328701f, -0.700278699f, -1.0f, 0.99704963f,
+		0.837875724f, -1.55312932f, 0.721790135f, 1.69328701f, -0.700278699f, -1.0f, 0.99704963f,
+		0.907064676f, -1.69100761f, 0.79048717f, 1.69328701f, -0.700278699f, -1.0f, 0.99704963f,
+		0.394848943f, -0.661021829f, 0.272366881f, 1.69585097f, -0.702488422f, -1.0f, 0.997058928f,
+		0.459618032f, -0.790087223f, 0.336670458f, 1.69585097f, -0.702488422f, -1.0f, 0.997058928f,
+		0.524387121f, -0.919152617f, 0.400974065f, 1.69585097f, -0.702488422f, -1.0f, 0.997058928f,
+		0.589156151f, -1.04821801f, 0.465277642f, 1.69585097f, -0.702488422f, -1.0f, 0.997058928f,
+		0.65392524f, -1.17728341f, 0.529581249f, 1.69585097f, -0.702488422f, -1.0f, 0.997058928f,
+		0.718694329f, -1.3063488f, 0.593884826f, 1.69585097f, -0.702488422f, -1.0f, 0.997058928f,
+		0.783463418f, -1.4354142f, 0.658188403f, 1.69585097f, -0.702488422f, -1.0f, 0.997058928f,
+		0.848232448f, -1.56447959f, 0.72249198f, 1.69585097f, -0.702488422f, -1.0f, 0.997058928f,
+		0.913001537f, -1.69354498f, 0.786795557f, 1.69585097f, -0.702488422f, -1.0f, 0.997058928f,
+		0.431185603f, -0.725281179f, 0.300038129f, 1.69809437f, -0.704423368f, -1.0f, 0.997068882f,
+		0.492065579f, -0.84659189f, 0.360475749f, 1.69809437f, -0.704423368f, -1.0f, 0.997068882f,
+		0.552945554f, -0.967902601f, 0.420913368f, 1.69809437f, -0.704423368f, -1.0f, 0.997068882f,
+		0.61382556f, -1.08921325f, 0.481350988f, 1.69809437f, -0.704423368f, -1.0f, 0.997068882f,
+		0.674705505f, -1.21052396f, 0.541788578f, 1.69809437f, -0.704423368f, -1.0f, 0.997068882f,
+		0.735585511f, -1.33183467f, 0.602226198f, 1.69809437f, -0.704423368f, -1.0f, 0.997068882f,
+		0.796465456f, -1.45314538f, 0.662663817f, 1.69809437f, -0.704423368f, -1.0f, 0.997068882f,
+		0.857345462f, -1.57445598f, 0.723101437f, 1.69809437f, -0.704423368f, -1.0f, 0.997068882f,
+		0.918225408f, -1.69576669f, 0.783539057f, 1.69809437f, -0.704423368f, -1.0f, 0.997068882f,
+		0.463405699f, -0.782250941f, 0.324567288f, 1.7000711f, -0.706130028f, -1.0f, 0.997079432f,
+		0.520837188f, -0.896685362f, 0.381576806f, 1.7000711f, -0.706130028f, -1.0f, 0.997079432f,
+		0.578268647f, -1.01111972f, 0.438586324f, 1.7000711f, -0.706130028f, -1.0f, 0.997079432f,
+		0.635700107f, -1.1255542f, 0.495595872f, 1.7000711f, -0.706130028f, -1.0f, 0.997079432f,
+		0.693131626f, -1.23998857f, 0.552605391f, 1.7000711f, -0.706130028f, -1.0f, 0.997079432f,
+		0.750563085f, -1.35442305f, 0.609614909f, 1.7000711f, -0.706130028f, -1.0f, 0.997079432f,
+		0.807994545f, -1.46885741f, 0.666624427f, 1.7000711f, -0.706130028f, -1.0f, 0.997079432f,
+		0.865426004f, -1.58329177f, 0.723633945f, 1.7000711f, -0.706130028f, -1.0f, 0.997079432f,
+		0.922857463f, -1.69772625f, 0.780643463f, 1.7000711f, -0.706130028f, -1.0f, 0.997079432f,
+		0.018764209f, 0.00444809534f, -0.0143161137f, 1.67345154f, -0.683037579f, -1.0f, 0.997912169f,
+		0.123785481f, -0.20510976f, 0.0902279168f, 1.67345154f, -0.683037579f, -1.0f, 0.997912169f,
+		0.228806749f, -0.414667606f, 0.194771945f, 1.67345154f, -0.683037579f, -1.0f, 0.997912169f,
+		0.333828032f, -0.624225438f, 0.299315989f, 1.67345154f, -0.683037579f, -1.0f, 0.997912169f,
+		0.4388493f, -0.833783329f, 0.403860003f, 1.67345154f, -0.683037579f, -1.0f, 0.997912169f,
+		0.543870568f, -1.04334116f, 0.508404016f, 1.67345154f, -0.683037579f, -1.0f, 0.997912169f,
+		0.648891866f, -1.25289905f, 0.61294806f, 1.67345154f, -0.683037579f, -1.0f, 0.997912169f,
+		0.753913105f, -1.46245682f, 0.717492104f, 1.67345154f, -0.683037579f, -1.0f, 0.997912169f,
+		0.858934402f, -1.67201471f, 0.822036147f, 1.67345154f, -0.683037579f, -1.0f, 0.997912169f,
+		0.110864259f, -0.158757806f, 0.0560660549f, 1.67933297f, -0.688088238f, -1.0f, 0.997914255f,
+		0.206028104f, -0.348643243f, 0.150794446f, 1.67933297f, -0.688088238f, -1.0f, 0.997914255f,
+		0.301191956f, -0.538528681f, 0.245522842f, 1.67933297f, -0.688088238f, -1.0f, 0.997914255f,
+		0.396355778f, -0.728414118f, 0.340251237f, 1.67933297f, -0.688088238f, -1.0f, 0.997914255f,
+		0.49151963f, -0.918299556f, 0.434979618f, 1.67933297f, -0.688088238f, -1.0f, 0.997914255f,
+		0.586683452f, -1.10818493f, 0.529708028f, 1.67933297f, -0.688088238f, -1.0f, 0.997914255f,
+		0.681847334f, -1.29807043f, 0.624436378f, 1.67933297f, -0.688088238f, -1.0f, 0.997914255f,
+		0.777011156f, -1.48795581f, 0.719164789f, 1.67933297f, -0.688088238f, -1.0f, 0.997914255f,
+		0.872174978f, -1.67784131f, 0.813893199f, 1.67933297f, -0.688088238f, -1.0f, 0.997914255f,
+		0.18715857f, -0.293949693f, 0.114365548f, 1.68419874f, -0.692267418f, -1.0f, 0.99791652f,
+		0.27415666f, -0.467538744f, 0.200962767f, 1.68419874f, -0.692267418f, -1.0f, 0.99791652f,
+		0.361154765f, -0.641127825f, 0.287559986f, 1.68419874f, -0.692267418f, -1.0f, 0.99791652f,
+		0.44815284f, -0.814716876f, 0.37415722f, 1.68419874f, -0.692267418f, -1.0f, 0.99791652f,
+		0.535150945f, -0.988305926f, 0.460754454f, 1.68419874f, -0.692267418f, -1.0f, 0.99791652f,
+		0.62214905f, -1.16189492f, 0.547351658f, 1.68419874f, -0.692267418f, -1.0f, 0.99791652f,
+		0.709147096f, -1.33548403f, 0.633948922f, 1.68419874f, -0.692267418f, -1.0f, 0.99791652f,
+		0.796145201f, -1.50907314f, 0.720546126f, 1.68419874f, -0.692267418f, -1.0f, 0.99791652f,
+		0.883143306f, -1.68266213f, 0.807143331f, 1.68419874f, -0.692267418f, -1.0f, 0.99791652f,
+		0.251394361f, -0.407768965f, 0.163446844f, 1.68828952f, -0.695781648f, -1.0f, 0.997918963f,
+		0.331517339f, -0.567637265f, 0.243198007f, 1.68828952f, -0.695781648f, -1.0f, 0.997918963f,
+		0.411640286f, -0.727505624f, 0.322949201f, 1.68828952f, -0.695781648f, -1.0f, 0.997918963f,
+		0.491763234f, -0.887373924f, 0.402700365f, 1.68828952f, -0.695781648f, -1.0f, 0.997918963f,
+		0.571886182f, -1.04724228f, 0.482451528f, 1.68828952f, -0.695781648f, -1.0f, 0.997918963f,
+		0.652009189f, -1.20711064f, 0.562202692f, 1.68828952f, -0.695781648f, -1.0f, 0.997918963f,
+		0.732132137f, -1.366979f, 0.641953886f, 1.68828952f, -0.695781648f, -1.0f, 0.997918963f,
+		0.812255085f, -1.52684724f, 0.721705079f, 1.68828952f, -0.695781648f, -1.0f, 0.997918963f,
+		0.892378032f, -1.6867156f, 0.801456213f, 1.68828952f, -0.695781648f, -1.0f, 0.997918963f,
+		0.306221068f, -0.504911423f, 0.20533523f, 1.6917752f, -0.698776782f, -1.0f, 0.997921646f,
+		0.380475968f, -0.653068781f, 0.279243112f, 1.6917752f, -0.698776782f, -1.0f, 0.997921646f,
+		0.454730839f, -0.801226139f, 0.353150994f, 1.6917752f, -0.698776782f, -1.0f, 0.997921646f,
+		0.528985739f, -0.949383497f, 0.427058876f, 1.6917752f, -0.698776782f, -1.0f, 0.997921646f,
+		0.603240609f, -1.09754086f, 0.500966787f, 1.6917752f, -0.698776782f, -1.0f, 0.997921646f,
+		0.67749548f, -1.24569821f, 0.57487464f, 1.6917752f, -0.698776782f, -1.0f, 0.997921646f,
+		0.75175035f, -1.39385545f, 0.648782551f, 1.6917752f, -0.698776782f, -1.0f, 0.997921646f,
+		0.82600522f, -1.54201281f, 0.722690403f, 1.6917752f, -0.698776782f, -1.0f, 0.997921646f,
+		0.900260091f, -1.69017017f, 0.796598256f, 1.6917752f, -0.698776782f, -1.0f, 0.997921646f,
+		0.353564948f, -0.588791132f, 0.241503209f, 1.69477963f, -0.701359153f, -1.0f, 0.997924507f,
+		0.422752649f, -0.726835787f, 0.31036526f, 1.69477963f, -0.701359153f, -1.0f, 0.997924507f,
+		0.49194032f, -0.864880443f, 0.37922731f, 1.69477963f, -0.701359153f, -1.0f, 0.997924507f,
+		0.56112802f, -1.00292516f, 0.448089391f, 1.69477963f, -0.701359153f, -1.0f, 0.997924507f,
+		0.630315661f, -1.14096975f, 0.516951442f, 1.69477963f, -0.701359153f, -1.0f, 0.997924507f,
+		0.699503362f, -1.27901447f, 0.585813463f, 1.69477963f, -0.701359153f, -1.0f, 0.997924507f,
+		0.768691063f, -1.41705906f, 0.654675543f, 1.69477963f, -0.701359153f, -1.0f, 0.997924507f,
+		0.837878764f, -1.55510378f, 0.723537624f, 1.69477963f, -0.701359153f, -1.0f, 0.997924507f,
+		0.907066405f, -1.69314837f, 0.792399645f, 1.69477963f, -0.701359153f, -1.0f, 0.997924507f,
+		0.394860059f, -0.661949694f, 0.27304697f, 1.69739497f, -0.703607619f, -1.0f, 0.997927547f,
+		0.459627926f, -0.791173637f, 0.337507844f, 1.69739497f, -0.703607619f, -1.0f, 0.997927547f,
+		0.524395823f, -0.920397639f, 0.401968718f, 1.69739497f, -0.703607619f, -1.0f, 0.997927547f,
+		0.589163721f, -1.04962158f, 0.466429591f, 1.69739497f, -0.703607619f, -1.0f, 0.997927547f,
+		0.653931618f, -1.17884552f, 0.530890465f, 1.69739497f, -0.703607619f, -1.0f, 0.997927547f,
+		0.718699455f, -1.30806947f, 0.595351338f, 1.69739497f, -0.703607619f, -1.0f, 0.997927547f,
+		0.783467352f, -1.43729341f, 0.659812212f, 1.69739497f, -0.703607619f, -1.0f, 0.997927547f,
+		0.84823525f, -1.56651747f, 0.724273086f, 1.69739497f, -0.703607619f, -1.0f, 0.997927547f,
+		0.913003147f, -1.69574142f, 0.788733959f, 1.69739497f, -0.703607619f, -1.0f, 0.997927547f,
+		0.431195974f, -0.7263183f, 0.300799459f, 1.69969106f, -0.705582321f, -1.0f, 0.997930825f,
+		0.492074817f, -0.847780824f, 0.36138767f, 1.69969106f, -0.705582321f, -1.0f, 0.997930825f,
+		0.55295372f, -0.969243348f, 0.421975851f, 1.69969106f, -0.705582321f, -1.0f, 0.997930825f,
+		0.613832593f, -1.09070587f, 0.482564062f, 1.69969106f, -0.705582321f, -1.0f, 0.997930825f,
+		0.674711406f, -1.21216834f, 0.543152273f, 1.69969106f, -0.705582321f, -1.0f, 0.997930825f,
+		0.735590279f, -1.33363092f, 0.603740454f, 1.69969106f, -0.705582321f, -1.0f, 0.997930825f,
+		0.796469152f, -1.45509338f, 0.664328635f, 1.69969106f, -0.705582321f, -1.0f, 0.997930825f,
+		0.857348025f, -1.57655597f, 0.724916816f, 1.69969106f, -0.705582321f, -1.0f, 0.997930825f,
+		0.918226898f, -1.69801855f, 0.785505056f, 1.69969106f, -0.705582321f, -1.0f, 0.997930825f,
+		0.463415414f, -0.783390522f, 0.325404882f, 1.70172215f, -0.707329631f, -1.0f, 0.997934341f,
+		0.52084583f, -0.897970855f, 0.382559091f, 1.70172215f, -0.707329631f, -1.0f, 0.997934341f,
+		0.578276277f, -1.01255119f, 0.439713329f, 1.70172215f, -0.707329631f, -1.0f, 0.997934341f,
+		0.635706723f, -1.12713158f, 0.496867537f, 1.70172215f, -0.707329631f, -1.0f, 0.997934341f,
+		0.693137169f, -1.24171185f, 0.554021776f, 1.70172215f, -0.707329631f, -1.0f, 0.997934341f,
+		0.750567555f, -1.35629225f, 0.611176014f, 1.70172215f, -0.707329631f, -1.0f, 0.997934341f,
+		0.807998002f, -1.47087264f, 0.668330252f, 1.70172215f, -0.707329631f, -1.0f, 0.997934341f,
+		0.865428448f, -1.58545291f, 0.725484431f, 1.70172215f, -0.707329631f, -1.0f, 0.997934341f,
+		0.922858894f, -1.70003331f, 0.782638669f, 1.70172215f, -0.707329631f, -1.0f, 0.997934341f,
+		0.0187782794f, 0.00445143087f, -0.014326849f, 1.67427146f, -0.683624387f, -1.0f, 0.998572648f,
+		0.12379805f, -0.205264807f, 0.090374589f, 1.67427146f, -0.683624387f, -1.0f, 0.998572648f,
+		0.228817821f, -0.414981037f, 0.195076019f, 1.67427146f, -0.683624387f, -1.0f, 0.998572648f,
+		0.333837569f, -0.624697268f, 0.299777448f, 1.67427146f, -0.683624387f, -1.0f, 0.998572648f,
+		0.438857347f, -0.834413528f, 0.404478878f, 1.67427146f, -0.683624387f, -1.0f, 0.998572648f,
+		0.543877125f, -1.04412973f, 0.509180307f, 1.67427146f, -0.683624387f, -1.0f, 0.998572648f,
+		0.648896873f, -1.25384593f, 0.613881767f, 1.67427146f, -0.683624387f, -1.0f, 0.998572648f,
+		0.753916621f, -1.46356225f, 0.718583226f, 1.67427146f, -0.683624387f, -1.0f, 0.998572648f,
+		0.858936429f, -1.67327845f, 0.823284626f, 1.67427146f, -0.683624387f, -1.0f, 0.998572648f,
+		0.110876493f, -0.158897027f, 0.0561618842f, 1.68017447f, -0.688692391f, -1.0f, 0.998573303f,
+		0.206039026f, -0.348927796f, 0.151034638f, 1.68017447f, -0.688692391f, -1.0f, 0.998573303f,
+		0.301201552f, -0.538958549f, 0.245907381f, 1.68017447f, -0.688692391f, -1.0f, 0.998573303f,
+		0.396364093f, -0.728989303f, 0.340780139f, 1.68017447f, -0.688692391f, -1.0f, 0.998573303f,
+		0.491526634f, -0.919020057f, 0.435652882f, 1.68017447f, -0.688692391f, -1.0f, 0.998573303f,
+		0.586689174f, -1.10905075f, 0.530525625f, 1.68017447f, -0.688692391f, -1.0f, 0.998573303f,
+		0.681851685f, -1.29908156f, 0.625398338f, 1.68017447f, -0.688692391f, -1.0f, 0.998573303f,
+		0.777014196f, -1.48911226f, 0.720271111f, 1.68017447f, -0.688692391f, -1.0f, 0.998573303f,
+		0.872176766f, -1.67914307f, 0.815143883f, 1.68017447f, -0.688692391f, -1.0f, 0.998573303f,
+		0.187169388f, -0.294210225f, 0.114551984f, 1.68506169f, -0.692888677f, -1.0f, 0.998574018f,
+		0.274166316f, -0.467933804f, 0.201282769f, 1.68506169f, -0.692888677f, -1.0f, 0.998574018f,
+		0.361163259f, -0.641657352f, 0.288013548f, 1.68506169f, -0.692888677f, -1.0f, 0.998574018f,
+		0.448160201f, -0.815380931f, 0.374744356f, 1.68506169f, -0.692888677f, -1.0f, 0.998574018f,
+		0.535157144f, -0.989104509f, 0.461475134f, 1.68506169f, -0.692888677f, -1.0f, 0.998574018f,
+		0.622154057f, -1.16282809f, 0.548205912f, 1.68506169f, -0.692888677f, -1.0f, 0.998574018f,
+		0.70915097f, -1.33655167f, 0.63493669f, 1.68506169f, -0.692888677f, -1.0f, 0.998574018f,
+		0.796147943f, -1.51027513f, 0.721667469f, 1.68506169f, -0.692888677f, -1.0f, 0.998574018f,
+		0.883144855f, -1.6839987f, 0.808398247f, 1.68506169f, -0.692888677f, -1.0f, 0.998574018f,
+		0.251404047f, -0.408134639f, 0.163711756f, 1.68917394f, -0.696419895f, -1.0f, 0.998574734f,
+		0.331525952f, -0.568128407f, 0.243587419f, 1.68917394f, -0.696419895f, -1.0f, 0.998574734f,
+		0.411647886f, -0.728122175f, 0.323463082f, 1.68917394f, -0.696419895f, -1.0f, 0.998574734f,
+		0.49176982f, -0.888115883f, 0.40333876f, 1.68917394f, -0.696419895f, -1.0f, 0.998574734f,
+		0.571891725f, -1.04810965f, 0.483214408f, 1.68917394f, -0.696419895f, -1.0f, 0.998574734f,
+		0.652013659f, -1.20810342f, 0.563090086f, 1.68917394f, -0.696419895f, -1.0f, 0.998574734f,
+		0.732135594f, -1.36809719f, 0.642965734f, 1.68917394f, -0.696419895f, -1.0f, 0.998574734f,
+		0.812257528f, -1.52809083f, 0.722841442f, 1.68917394f, -0.696419895f, -1.0f, 0.998574734f,
+		0.892379463f, -1.6880846f, 0.80271709f, 1.68917394f, -0.696419895f, -1.0f, 0.998574734f,
+		0.30622983f, -0.505369723f, 0.205669194f, 1.69268143f, -0.699432075f, -1.0f, 0.998575568f,
+		0.380483776f, -0.653644741f, 0.279693842f, 1.69268143f, -0.699432075f, -1.0f, 0.998575568f,
+		0.454737723f, -0.801919758f, 0.353718489f, 1.69268143f, -0.699432075f, -1.0f, 0.998575568f,
+		0.52899164f, -0.950194776f, 0.427743137f, 1.69268143f, -0.699432075f, -1.0f, 0.998575568f,
+		0.603245616f, -1.09846973f, 0.501767814f, 1.69268143f, -0.699432075f, -1.0f, 0.998575568f,
+		0.677499533f, -1.24674475f, 0.575792432f, 1.69268143f, -0.699432075f, -1.0f, 0.998575568f,
+		0.751753509f, -1.39501977f, 0.649817109f, 1.69268143f, -0.699432075f, -1.0f, 0.998575568f,
+		0.826007426f, -1.54329479f, 0.723841727f, 1.69268143f, -0.699432075f, -1.0f, 0.998575568f,
+		0.900261343f, -1.69156981f, 0.797866404f, 1.69268143f, -0.699432075f, -1.0f, 0.998575568f,
+		0.353572965f, -0.589332044f, 0.241898775f, 1.69570804f, -0.702031434f, -1.0f, 0.998576462f,
+		0.422759771f, -0.727487683f, 0.310870945f, 1.69570804f, -0.702031434f, -1.0f, 0.998576462f,
+		0.491946608f, -0.865643322f, 0.379843116f, 1.69570804f, -0.702031434f, -1.0f, 0.998576462f,
+		0.561133444f, -1.00379896f, 0.448815316f, 1.69570804f, -0.702031434f, -1.0f, 0.998576462f,
+		0.630320251f, -1.14195466f, 0.517787457f, 1.69570804f, -0.702031434f, -1.0f, 0.998576462f,
+		0.699507117f, -1.28011036f, 0.586759686f, 1.69570804f, -0.702031434f, -1.0f, 0.998576462f,
+		0.768693924f, -1.41826594f, 0.655731857f, 1.69570804f, -0.702031434f, -1.0f, 0.998576462f,
+		0.837880731f, -1.55642164f, 0.724704027f, 1.69570804f, -0.702031434f, -1.0f, 0.998576462f,
+		0.907067597f, -1.69457722f, 0.793676198f, 1.69570804f, -0.702031434f, -1.0f, 0.998576462f,
+		0.39486742f, -0.662565231f, 0.273498148f, 1.69834566f, -0.704297125f, -1.0f, 0.998577416f,
+		0.459634513f, -0.791894376f, 0.338063359f, 1.69834566f, -0.704297125f, -1.0f, 0.998577416f,
+		0.524401605f, -0.921223581f, 0.402628571f, 1.69834566f, -0.704297125f, -1.0f, 0.998577416f,
+		0.589168727f, -1.05055273f, 0.467193782f, 1.69834566f, -0.704297125f, -1.0f, 0.998577416f,
+		0.65393579f, -1.17988193f, 0.531759024f, 1.69834566f, -0.704297125f, -1.0f, 0.998577416f,
+		0.718702912f, -1.30921102f, 0.596324205f, 1.69834566f, -0.704297125f, -1.0f, 0.998577416f,
+		0.783469975f, -1.43854022f, 0.660889447f, 1.69834566f, -0.704297125f, -1.0f, 0.998577416f,
+		0.848237097f, -1.56786931f, 0.725454628f, 1.69834566f, -0.704297125f, -1.0f, 0.998577416f,
+		0.91300422f, -1.69719851f, 0.79001987f, 1.69834566f, -0.704297125f, -1.0f, 0.998577416f,
+		0.431202769f, -0.727002025f, 0.30130142f, 1.70066452f, -0.706289232f, -1.0f, 0.998578429f,
+		0.492080927f, -0.848564625f, 0.361988872f, 1.70066452f, -0.706289232f, -1.0f, 0.998578429f,
+		0.552959085f, -0.970127285f, 0.422676355f, 1.70066452f, -0.706289232f, -1.0f, 0.998578429f,
+		0.613837183f, -1.09168994f, 0.483363837f, 1.70066452f, -0.706289232f, -1.0f, 0.998578429f,
+		0.67471534f, -1.21325254f, 0.54405129f, 1.70066452f, -0.706289232f, -1.0f, 0.998578429f,
+		0.735593498f, -1.33481514f, 0.604738772f, 1.70066452f, -0.706289232f, -1.0f, 0.998578429f,
+		0.796471596f, -1.45637786f, 0.665426254f, 1.70066452f, -0.706289232f, -1.0f, 0.998578429f,
+		0.857349753f, -1.57794046f, 0.726113737f, 1.70066452f, -0.706289232f, -1.0f, 0.998578429f,
+		0.918227911f, -1.69950306f, 0.786801159f, 1.70066452f, -0.706289232f, -1.0f, 0.998578429f,
+		0.463421792f, -0.78413707f, 0.325953603f, 1.70271873f, -0.708054125f, -1.0f, 0.998579502f,
+		0.520851552f, -0.898813069f, 0.383202612f, 1.70271873f, -0.708054125f, -1.0f, 0.998579502f,
+		0.578281283f, -1.01348901f, 0.440451652f, 1.70271873f, -0.708054125f, -1.0f, 0.998579502f,
+		0.635711014f, -1.12816501f, 0.497700691f, 1.70271873f, -0.708054125f, -1.0f, 0.998579502f,
+		0.693140805f, -1.24284089f, 0.554949701f, 1.70271873f, -0.708054125f, -1.0f, 0.998579502f,
+		0.750570536f, -1.35751688f, 0.61219871f, 1.70271873f, -0.708054125f, -1.0f, 0.998579502f,
+		0.808000267f, -1.47219288f, 0.66944778f, 1.70271873f, -0.708054125f, -1.0f, 0.998579502f,
+		0.865430057f, -1.58686876f, 0.726696789f, 1.70271873f, -0.708054125f, -1.0f, 0.998579502f,
+		0.922859788f, -1.70154476f, 0.783945799f, 1.70271873f, -0.708054125f, -1.0f, 0.998579502f,
+		0.018787792f, 0.0044536856f, -0.0143341059f, 1.67480624f, -0.684007227f, -1.0f, 0.999038696f,
+		0.123806536f, -0.205369607f, 0.0904737338f, 1.67480624f, -0.684007227f, -1.0f, 0.999038696f,
+		0.228825286f, -0.415192902f, 0.195281565f, 1.67480624f, -0.684007227f, -1.0f, 0.999038696f,
+		0.333844036f, -0.625016212f, 0.300089419f, 1.67480624f, -0.684007227f, -1.0f, 0.999038696f,
+		0.438862801f, -0.834839463f, 0.404897243f, 1.67480624f, -0.684007227f, -1.0f, 0.999038696f,
+		0.543881536f, -1.04466283f, 0.509705067f, 1.67480624f, -0.684007227f, -1.0f, 0.999038696f,
+		0.64890027f, -1.25448608f, 0.61451292f, 1.67480624f, -0.684007227f, -1.0f, 0.999038696f,
+		0.753919005f, -1.46430933f, 0.719320774f, 1.67480624f, -0.684007227f, -1.0f, 0.999038696f,
+		0.8589378f, -1.6741327f, 0.824128628f, 1.67480624f, -0.684007227f, -1.0f, 0.999038696f,
+		0.110884733f, -0.158990785f, 0.0562264137f, 1.68071926f, -0.689083755f, -1.0f, 0.999038875f,
+		0.206046388f, -0.349119395f, 0.151196361f, 1.68071926f, -0.689083755f, -1.0f, 0.999038875f,
+		0.301208049f, -0.53924799f, 0.246166319f, 1.68071926f, -0.689083755f, -1.0f, 0.999038875f,
+		0.396369696f, -0.729376614f, 0.341136277f, 1.68071926f, -0.689083755f, -1.0f, 0.999038875f,
+		0.491531342f, -0.919505239f, 0.436106235f, 1.68071926f, -0.689083755f, -1.0f, 0.999038875f,
+		0.586692989f, -1.1096338f, 0.531076193f, 1.68071926f, -0.689083755f, -1.0f, 0.999038875f,
+		0.681854606f, -1.29976249f, 0.626046121f, 1.68071926f, -0.689083755f, -1.0f, 0.999038875f,
+		0.777016282f, -1.48989105f, 0.721016049f, 1.68071926f, -0.689083755f, -1.0f, 0.999038875f,
+		0.872177958f, -1.68001962f, 0.815986037f, 1.68071926f, -0.689083755f, -1.0f, 0.999038875f,
+		0.18717663f, -0.294384986f, 0.114677042f, 1.68561637f, -0.693288207f, -1.0f, 0.999039114f,
+		0.274172783f, -0.468198776f, 0.201497406f, 1.68561637f, -0.693288207f, -1.0f, 0.999039114f,
+		0.361168951f, -0.642012537f, 0.28831777f, 1.68561637f, -0.693288207f, -1.0f, 0.999039114f,
+		0.448165119f, -0.815826356f, 0.375138164f, 1.68561637f, -0.693288207f, -1.0f, 0.999039114f,
+		0.535161257f, -0.989640117f, 0.461958528f, 1.68561637f, -0.693288207f, -1.0f, 0.999039114f,
+		0.622157454f, -1.16345394f, 0.548778892f, 1.68561637f, -0.693288207f, -1.0f, 0.999039114f,
+		0.709153593f, -1.33726776f, 0.635599256f, 1.68561637f, -0.693288207f, -1.0f, 0.999039114f,
+		0.796149731f, -1.51108146f, 0.72241962f, 1.68561637f, -0.693288207f, -1.0f, 0.999039114f,
+		0.883145928f, -1.68489528f, 0.809240043f, 1.68561637f, -0.693288207f, -1.0f, 0.999039114f,
+		0.251410514f, -0.408378989f, 0.163888738f, 1.68973839f, -0.696827412f, -1.0f, 0.999039352f,
+		0.331531733f, -0.568456531f, 0.243847579f, 1.68973839f, -0.696827412f, -1.0f, 0.999039352f,
+		0.411652982f, -0.728534043f, 0.323806435f, 1.68973839f, -0.696827412f, -1.0f, 0.999039352f,
+		0.491774201f, -0.888611615f, 0.403765261f, 1.68973839f, -0.696827412f, -1.0f, 0.999039352f,
+		0.571895421f, -1.04868913f, 0.483724117f, 1.68973839f, -0.696827412f, -1.0f, 0.999039352f,
+		0.652016699f, -1.2087667f, 0.563682973f, 1.68973839f, -0.696827412f, -1.0f, 0.999039352f,
+		0.732137918f, -1.36884415f, 0.64364177f, 1.68973839f, -0.696827412f, -1.0f, 0.999039352f,
+		0.812259138f, -1.52892172f, 0.723600626f, 1.68973839f, -0.696827412f, -1.0f, 0.999039352f,
+		0.892380357f, -1.6889993f, 0.803559482f, 1.68973839f, -0.696827412f, -1.0f, 0.999039352f,
+		0.306235671f, -0.50567466f, 0.20589143f, 1.69325566f, -0.6998474f, -1.0f, 0.99903959f,
+		0.380488962f, -0.654027998f, 0.279993802f, 1.69325566f, -0.6998474f, -1.0f, 0.99903959f,
+		0.454742283f, -0.802381277f, 0.354096144f, 1.69325566f, -0.6998474f, -1.0f, 0.99903959f,
+		0.528995633f, -0.950734615f, 0.428198516f, 1.69325566f, -0.6998474f, -1.0f, 0.99903959f,
+		0.603248954f, -1.09908795f, 0.502300858f, 1.69325566f, -0.6998474f, -1.0f, 0.99903959f,
+		0.677502275f, -1.24744129f, 0.576403201f, 1.69325566f, -0.6998474f, -1.0f, 0.99903959f,
+		0.751755595f, -1.39579463f, 0.650505543f, 1.69325566f, -0.6998474f, -1.0f, 0.99903959f,
+		0.826008916f, -1.54414785f, 0.724607944f, 1.69325566f, -0.6998474f, -1.0f, 0.99903959f,
+		0.900262237f, -1.69250119f, 0.798710287f, 1.69325566f, -0.6998474f, -1.0f, 0.99903959f,
+		0.35357824f, -0.589690566f, 0.242160946f, 1.69629204f, -0.702454567f, -1.0f, 0.999039829f,
+		0.42276451f, -0.727919757f, 0.311206102f, 1.69629204f, -0.702454567f, -1.0f, 0.999039829f,
+		0.49195078f, -0.866149008f, 0.380251259f, 1.69629204f, -0.702454567f, -1.0f, 0.999039829f,
+		0.561137021f, -1.0043782f, 0.449296445f, 1.69629204f, -0.702454567f, -1.0f, 0.999039829f,
+		0.630323291f, -1.14260745f, 0.518341601f, 1.69629204f, -0.702454567f, -1.0f, 0.999039829f,
+		0.699509561f, -1.2808367f, 0.587386787f, 1.69629204f, -0.702454567f, -1.0f, 0.999039829f,
+		0.768695831f, -1.41906583f, 0.656431913f, 1.69629204f, -0.702454567f, -1.0f, 0.999039829f,
+		0.837882102f, -1.55729508f, 0.725477099f, 1.69629204f, -0.702454567f, -1.0f, 0.999039829f,
+		0.907068312f, -1.69552433f, 0.794522226f, 1.69629204f, -0.702454567f, -1.0f, 0.999039829f,
+		0.394872278f, -0.662971556f, 0.273795992f, 1.69893944f, -0.704728007f, -1.0f, 0.999040127f,
+		0.459638834f, -0.7923702f, 0.338430077f, 1.69893944f, -0.704728007f, -1.0f, 0.999040127f,
+		0.52440542f, -0.921768785f, 0.403064162f, 1.69893944f, -0.704728007f, -1.0f, 0.999040127f,
+		0.589172006f, -1.05116737f, 0.467698246f, 1.69893944f, -0.704728007f, -1.0f, 0.999040127f,
+		0.653938591f, -1.18056595f, 0.532332301f, 1.69893944f, -0.704728007f, -1.0f, 0.999040127f,
+		0.718705177f, -1.30996454f, 0.596966386f, 1.69893944f, -0.704728007f, -1.0f, 0.999040127f,
+		0.783471763f, -1.43936312f, 0.661600471f, 1.69893944f, -0.704728007f, -1.0f, 0.999040127f,
+		0.848238289f, -1.56876171f, 0.726234615f, 1.69893944f, -0.704728007f, -1.0f, 0.999040127f,
+		0.913004875f, -1.69816029f, 0.7908687f, 1.69893944f, -0.704728007f, -1.0f, 0.999040127f,
+		0.431207269f, -0.727451503f, 0.301631391f, 1.7012682f, -0.706727743f, -1.0f, 0.999040425f,
+		0.49208492f, -0.849079907f, 0.362384111f, 1.7012682f, -0.706727743f, -1.0f, 0.999040425f,
+		0.552962601f, -0.97070837f, 0.42313686f, 1.7012682f, -0.706727743f, -1.0f, 0.999040425f,
+		0.613840222f, -1.09233677f, 0.48388958f, 1.7012682f, -0.706727743f, -1.0f, 0.999040425f,
+		0.674717903f, -1.2139653f, 0.544642329f, 1.7012682f, -0.706727743f, -1.0f, 0.999040425f,
+		0.735595584f, -1.3355937f, 0.605395079f, 1.7012682f, -0.706727743f, -1.0f, 0.999040425f,
+		0.796473205f, -1.4572221f, 0.666147768f, 1.7012682f, -0.706727743f, -1.0f, 0.999040425f,
+		0.857350886f, -1.57885063f, 0.726900518f, 1.7012682f, -0.706727743f, -1.0f, 0.999040425f,
+		0.918228507f, -1.70047903f, 0.787653267f, 1.7012682f, -0.706727743f, -1.0f, 0.999040425f,
+		0.463425934f, -0.784625828f, 0.32631284f, 1.7033323f, -0.708500385f, -1.0f, 0.999040723f,
+		0.520855248f, -0.899364412f, 0.383623928f, 1.7033323f, -0.708500385f, -1.0f, 0.999040723f,
+		0.578284562f, -1.01410294f, 0.440935016f, 1.7033323f, -0.708500385f, -1.0f, 0.999040723f,
+		0.635713875f, -1.12884152f, 0.498246104f, 1.7033323f, -0.708500385f, -1.0f, 0.999040723f,
+		0.693143189f, -1.2435801f, 0.555557191f, 1.7033323f, -0.708500385f, -1.0f, 0.999040723f,
+		0.750572503f, -1.35831857f, 0.612868249f, 1.7033323f, -0.708500385f, -1.0f, 0.999040723f,
+		0.808001757f, -1.47305715f, 0.670179367f, 1.7033323f, -0.708500385f, -1.0f, 0.999040723f,
+		0.86543107f, -1.58779573f, 0.727490485f, 1.7033323f, -0.708500385f, -1.0f, 0.999040723f,
+		0.922860384f, -1.7025342f, 0.784801543f, 1.7033323f, -0.708500385f, -1.0f, 0.999040723f,
+	},
+	// Marshall 2199
+	{
+		0.00582344411f, 0.00130234053f, -0.00452110358f, 1.65704167f, -0.66724968f, -1.0f, 0.99632895f,
+		0.111019894f, -0.206078053f, 0.0976757482f, 1.65704167f, -0.66724968f, -1.0f, 0.99632895f,
+		0.216216341f, -0.413458437f, 0.199872613f, 1.65704167f, -0.66724968f, -1.0f, 0.99632895f,
+		0.321412772f, -0.620838821f, 0.302069455f, 1.65704167f, -0.66724968f, -1.0f, 0.99632895f,
+		0.426609218f, -0.828219175f, 0.404266328f, 1.65704167f, -0.66724968f, -1.0f, 0.99632895f,
+		0.531805694f, -1.03559959f, 0.50646317f, 1.65704167f, -0.66724968f, -1.0f, 0.99632895f,
+		0.63700211f, -1.24298f, 0.608660042f, 1.65704167f, -0.66724968f, -1.0f, 0.99632895f,
+		0.742198586f, -1.45036042f, 0.710856855f, 1.65704167f, -0.66724968f, -1.0f, 0.99632895f,
+		0.847395003f, -1.65774071f, 0.813053727f, 1.65704167f, -0.66724968f, -1.0f, 0.99632895f,
+		0.0674049035f, -0.104674339f, 0.040212445f, 1.65769327f, -0.66857779f, -1.0f, 0.996441662f,
+		0.166085258f, -0.298921496f, 0.135792598f, 1.65769327f, -0.66857779f, -1.0f, 0.996441662f,
+		0.26476559f, -0.493168652f, 0.231372759f, 1.65769327f, -0.66857779f, -1.0f, 0.996441662f,
+		0.363445967f, -0.687415779f, 0.326952904f, 1.65769327f, -0.66857779f, -1.0f, 0.996441662f,
+		0.462126315f, -0.881662965f, 0.422533065f, 1.65769327f, -0.66857779f, -1.0f, 0.996441662f,
+		0.560806632f, -1.07591009f, 0.518113196f, 1.65769327f, -0.66857779f, -1.0f, 0.996441662f,
+		0.659487009f, -1.27015722f, 0.613693357f, 1.65769327f, -0.66857779f, -1.0f, 0.996441662f,
+		0.758167326f, -1.46440446f, 0.709273517f, 1.65769327f, -0.66857779f, -1.0f, 0.996441662f,
+		0.856847703f, -1.65865159f, 0.804853678f, 1.65769327f, -0.66857779f, -1.0f, 0.996441662f,
+		0.121800408f, -0.197872758f, 0.0794208646f, 1.65726805f, -0.669036865f, -1.0f, 0.996549785f,
+		0.214725032f, -0.380457819f, 0.169095293f, 1.65726805f, -0.669036865f, -1.0f, 0.996549785f,
+		0.307649642f, -0.563042879f, 0.258769721f, 1.65726805f, -0.669036865f, -1.0f, 0.996549785f,
+		0.400574267f, -0.74562788f, 0.348444134f, 1.65726805f, -0.669036865f, -1.0f, 0.996549785f,
+		0.493498892f, -0.928212941f, 0.438118547f, 1.65726805f, -0.669036865f, -1.0f, 0.996549785f,
+		0.586423516f, -1.110798f, 0.52779299f, 1.65726805f, -0.669036865f, -1.0f, 0.996549785f,
+		0.679348111f, -1.293383f, 0.617467403f, 1.65726805f, -0.669036865f, -1.0f, 0.996549785f,
+		0.772272766f, -1.47596812f, 0.707141817f, 1.65726805f, -0.669036865f, -1.0f, 0.996549785f,
+		0.865197361f, -1.65855312f, 0.79681623f, 1.65726805f, -0.669036865f, -1.0f, 0.996549785f,
+		0.17019774f, -0.280255884f, 0.113906883f, 1.65558565f, -0.668514967f, -1.0f, 0.996653259f,
+		0.258001298f, -0.452384561f, 0.198246881f, 1.65558565f, -0.668514967f, -1.0f, 0.996653259f,
+		0.34580487f, -0.624513209f, 0.282586873f, 1.65558565f, -0.668514967f, -1.0f, 0.996653259f,
+		0.433608443f, -0.796641827f, 0.366926879f, 1.65558565f, -0.668514967f, -1.0f, 0.996653259f,
+		0.521412015f, -0.968770504f, 0.451266885f, 1.65558565f, -0.668514967f, -1.0f, 0.996653259f,
+		0.609215558f, -1.14089918f, 0.535606861f, 1.65558565f, -0.668514967f, -1.0f, 0.996653259f,
+		0.69701916f, -1.31302786f, 0.619946837f, 1.65558565f, -0.668514967f, -1.0f, 0.996653259f,
+		0.784822702f, -1.48515642f, 0.704286873f, 1.65558565f, -0.668514967f, -1.0f, 0.996653259f,
+		0.872626305f, -1.65728509f, 0.78862685f, 1.65558565f, -0.668514967f, -1.0f, 0.996653259f,
+		0.213536233f, -0.35329318f, 0.144243866f, 1.65230334f, -0.666780949f, -1.0f, 0.996752203f,
+		0.296754032f, -0.515948892f, 0.22369799f, 1.65230334f, -0.666780949f, -1.0f, 0.996752203f,
+		0.379971832f, -0.678604662f, 0.303152114f, 1.65230334f, -0.666780949f, -1.0f, 0.996752203f,
+		0.463189662f, -0.841260374f, 0.382606208f, 1.65230334f, -0.666780949f, -1.0f, 0.996752203f,
+		0.546407461f, -1.00391603f, 0.462060332f, 1.65230334f, -0.666780949f, -1.0f, 0.996752203f,
+		0.629625261f, -1.16657186f, 0.541514456f, 1.65230334f, -0.666780949f, -1.0f, 0.996752203f,
+		0.71284306f, -1.32922757f, 0.62096858f, 1.65230334f, -0.666780949f, -1.0f, 0.996752203f,
+		0.79606092f, -1.49188328f, 0.700422704f, 1.65230334f, -0.666780949f, -1.0f, 0.996752203f,
+		0.879278719f, -1.65453899f, 0.779876828f, 1.65230334f, -0.666780949f, -1.0f, 0.996752203f,
+		0.252568185f, -0.418015093f, 0.170782492f, 1.64679372f, -0.663398027f, -1.0f, 0.996846676f,
+		0.33165592f, -0.57198149f, 0.245679215f, 1.64679372f, -0.663398027f, -1.0f, 0.996846676f,
+		0.410743654f, -0.725947917f, 0.320575953f, 1.64679372f, -0.663398027f, -1.0f, 0.996846676f,
+		0.489831388f, -0.879914284f, 0.395472676f, 1.64679372f, -0.663398027f, -1.0f, 0.996846676f,
+		0.568919122f, -1.03388071f, 0.470369399f, 1.64679372f, -0.663398027f, -1.0f, 0.996846676f,
+		0.648006856f, -1.18784714f, 0.545266092f, 1.64679372f, -0.663398027f, -1.0f, 0.996846676f,
+		0.727094591f, -1.34181356f, 0.620162845f, 1.64679372f, -0.663398027f, -1.0f, 0.996846676f,
+		0.806182325f, -1.49577999f, 0.695059538f, 1.64679372f, -0.663398027f, -1.0f, 0.996846676f,
+		0.885270059f, -1.64974642f, 0.769956291f, 1.64679372f, -0.663398027f, -1.0f, 0.996846676f,
+		0.287902743f, -0.474971443f, 0.193595961f, 1.63786376f, -0.65752399f, -1.0f, 0.996936798f,
+		0.363251626f, -0.620827973f, 0.264124334f, 1.63786376f, -0.65752399f, -1.0f, 0.996936798f,
+		0.43860051f, -0.766684473f, 0.334652722f, 1.63786376f, -0.65752399f, -1.0f, 0.996936798f,
+		0.513949394f, -0.912541032f, 0.40518111f, 1.63786376f, -0.65752399f, -1.0f, 0.996936798f,
+		0.589298308f, -1.05839753f, 0.475709498f, 1.63786376f, -0.65752399f, -1.0f, 0.996936798f,
+		0.664647222f, -1.20425403f, 0.546237886f, 1.63786376f, -0.65752399f, -1.0f, 0.996936798f,
+		0.739996076f, -1.35011053f, 0.616766274f, 1.63786376f, -0.65752399f, -1.0f, 0.996936798f,
+		0.815344989f, -1.49596715f, 0.687294662f, 1.63786376f, -0.65752399f, -1.0f, 0.996936798f,
+		0.890693843f, -1.64182365f, 0.75782305f, 1.63786376f, -0.65752399f, -1.0f, 0.996936798f,
+		0.320036918f, -0.523983538f, 0.212278992f, 1.62302792f, -0.647393525f, -1.0f, 0.997022808f,
+		0.391985625f, -0.662049353f, 0.278421164f, 1.62302792f, -0.647393525f, -1.0f, 0.997022808f,
+		0.463934302f, -0.800115228f, 0.344563335f, 1.62302792f, -0.647393525f, -1.0f, 0.997022808f,
+		0.535883009f, -0.938181102f, 0.410705507f, 1.62302792f, -0.647393525f, -1.0f, 0.997022808f,
+		0.607831657f, -1.07624698f, 0.476847678f, 1.62302792f, -0.647393525f, -1.0f, 0.997022808f,
+		0.679780364f, -1.21431279f, 0.54298985f, 1.62302792f, -0.647393525f, -1.0f, 0.997022808f,
+		0.751729071f, -1.35237861f, 0.609132051f, 1.62302792f, -0.647393525f, -1.0f, 0.997022808f,
+		0.823677778f, -1.49044454f, 0.675274193f, 1.62302792f, -0.647393525f, -1.0f, 0.997022808f,
+		0.895626426f, -1.62851036f, 0.741416395f, 1.62302792f, -0.647393525f, -1.0f, 0.997022808f,
+		0.349376738f, -0.563235223f, 0.225263119f, 1.59623337f, -0.628695965f, -1.0f, 0.997104824f,
+		0.418220907f, -0.693368137f, 0.286584258f, 1.59623337f, -0.628695965f, -1.0f, 0.997104824f,
+		0.487065077f, -0.82350105f, 0.347905427f, 1.59623337f, -0.628695965f, -1.0f, 0.997104824f,
+		0.555909216f, -0.953633964f, 0.409226567f, 1.59623337f, -0.628695965f, -1.0f, 0.997104824f,
+		0.624753416f, -1.08376694f, 0.470547706f, 1.59623337f, -0.628695965f, -1.0f, 0.997104824f,
+		0.693597555f, -1.21389985f, 0.531868875f, 1.59623337f, -0.628695965f, -1.0f, 0.997104824f,
+		0.762441754f, -1.34403276f, 0.593190014f, 1.59623337f, -0.628695965f, -1.0f, 0.997104824f,
+		0.831285894f, -1.47416568f, 0.654511154f, 1.59623337f, -0.628695965f, -1.0f, 0.997104824f,
+		0.900130093f, -1.60429859f, 0.715832293f, 1.59623337f, -0.628695965f, -1.0f, 0.997104824f,
+		0.00583313918f, 0.00130450877f, -0.00452863052f, 1.66023362f, -0.669460535f, -1.0f, 0.996407866f,
+		0.11102856f, -0.206421897f, 0.0980137736f, 1.66023362f, -0.669460535f, -1.0f, 0.996407866f,
+		0.216223985f, -0.414148301f, 0.200556174f, 1.66023362f, -0.669460535f, -1.0f, 0.996407866f,
+		0.321419418f, -0.62187469f, 0.303098589f, 1.66023362f, -0.669460535f, -1.0f, 0.996407866f,
+		0.426614821f, -0.829601109f, 0.40564099f, 1.66023362f, -0.669460535f, -1.0f, 0.996407866f,
+		0.531810224f, -1.03732753f, 0.50818336f, 1.66023362f, -0.669460535f, -1.0f, 0.996407866f,
+		0.637005687f, -1.24505389f, 0.61072582f, 1.66023362f, -0.669460535f, -1.0f, 0.996407866f,
+		0.74220109f, -1.45278025f, 0.71326822f, 1.66023362f, -0.669460535f, -1.0f, 0.996407866f,
+		0.847396493f, -1.66050673f, 0.815810621f, 1.66023362f, -0.669460535f, -1.0f, 0.996407866f,
+		0.0674154237f, -0.104915947f, 0.0403850935f, 1.6615473f, -0.671258986f, -1.0f, 0.996513724f,
+		0.166094661f, -0.299552619f, 0.136354208f, 1.6615473f, -0.671258986f, -1.0f, 0.996513724f,
+		0.264773905f, -0.494189322f, 0.232323319f, 1.6615473f, -0.671258986f, -1.0f, 0.996513724f,
+		0.36345315f, -0.688825965f, 0.328292429f, 1.6615473f, -0.671258986f, -1.0f, 0.996513724f,
+		0.462132365f, -0.883462667f, 0.42426154f, 1.6615473f, -0.671258986f, -1.0f, 0.996513724f,
+		0.560811639f, -1.07809937f, 0.520230651f, 1.6615473f, -0.671258986f, -1.0f, 0.996513724f,
+		0.659490824f, -1.27273607f, 0.616199791f, 1.6615473f, -0.671258986f, -1.0f, 0.996513724f,
+		0.758170068f, -1.46737278f, 0.712168872f, 1.6615473f, -0.671258986f, -1.0f, 0.996513724f,
+		0.856849313f, -1.66200936f, 0.808138013f, 1.6615473f, -0.671258986f, -1.0f, 0.996513724f,
+		0.12181212f, -0.198431745f, 0.0798280165f, 1.66200185f, -0.672342896f, -1.0f, 0.996615708f,
+		0.214735493f, -0.381465137f, 0.169950098f, 1.66200185f, -0.672342896f, -1.0f, 0.996615708f,
+		0.307658881f, -0.564498544f, 0.260072172f, 1.66200185f, -0.672342896f, -1.0f, 0.996615708f,
+		0.400582254f, -0.747531891f, 0.350194246f, 1.66200185f, -0.672342896f, -1.0f, 0.996615708f,
+		0.493505627f, -0.930565298f, 0.440316319f, 1.66200185f, -0.672342896f, -1.0f, 0.996615708f,
+		0.586429f, -1.1135987f, 0.530438364f, 1.66200185f, -0.672342896f, -1.0f, 0.996615708f,
+		0.679352403f, -1.29663205f, 0.620560467f, 1.66200185f, -0.672342896f, -1.0f, 0.996615708f,
+		0.772275746f, -1.47966552f, 0.710682511f, 1.66200185f, -0.672342896f, -1.0f, 0.996615708f,
+		0.865199149f, -1.66269886f, 0.800804615f, 1.66200185f, -0.672342896f, -1.0f, 0.996615708f,
+		0.170211151f, -0.281247944f, 0.114633977f, 1.66152632f, -0.672678113f, -1.0f, 0.996713758f,
+		0.258013308f, -0.453906178f, 0.199502692f, 1.66152632f, -0.672678113f, -1.0f, 0.996713758f,
+		0.34581545f, -0.626564443f, 0.284371406f, 1.66152632f, -0.672678113f, -1.0f, 0.996713758f,
+		0.433617592f, -0.799222648f, 0.369240135f, 1.66152632f, -0.672678113f, -1.0f, 0.996713758f,
+		0.521419764f, -0.971880913f, 0.454108864f, 1.66152632f, -0.672678113f, -1.0f, 0.996713758f,
+		0.609221876f, -1.14453912f, 0.538977563f, 1.66152632f, -0.672678113f, -1.0f, 0.996713758f,
+		0.697024047f, -1.31719732f, 0.623846292f, 1.66152632f, -0.672678113f, -1.0f, 0.996713758f,
+		0.784826219f, -1.48985565f, 0.708715022f, 1.66152632f, -0.672678113f, -1.0f, 0.996713758f,
+		0.872628331f, -1.66251385f, 0.793583751f, 1.66152632f, -0.672678113f, -1.0f, 0.996713758f,
+		0.213552117f, -0.354906589f, 0.145429969f, 1.65996587f, -0.672167122f, -1.0f, 0.996807754f,
+		0.296768248f, -0.518207729f, 0.225528419f, 1.65996587f, -0.672167122f, -1.0f, 0.996807754f,
+		0.379984379f, -0.681508899f, 0.305626869f, 1.65996587f, -0.672167122f, -1.0f, 0.996807754f,
+		0.46320051f, -0.844810009f, 0.385725319f, 1.65996587f, -0.672167122f, -1.0f, 0.996807754f,
+		0.54641664f, -1.00811112f, 0.46582377f, 1.65996587f, -0.672167122f, -1.0f, 0.996807754f,
+		0.629632771f, -1.17141235f, 0.54592222f, 1.65996587f, -0.672167122f, -1.0f, 0.996807754f,
+		0.712848902f, -1.33471346f, 0.62602067f, 1.65996587f, -0.672167122f, -1.0f, 0.996807754f,
+		0.796065032f, -1.49801457f, 0.70611912f, 1.65996587f, -0.672167122f, -1.0f, 0.996807754f,
+		0.879281163f, -1.6613158f, 0.78621757f, 1.65996587f, -0.672167122f, -1.0f, 0.996807754f,
+		0.252587795f, -0.420572639f, 0.172666132f, 1.65703797f, -0.670618773f, -1.0f, 0.996897817f,
+		0.331673473f, -0.575357139f, 0.248379529f, 1.65703797f, -0.670618773f, -1.0f, 0.996897817f,
+		0.410759121f, -0.730141699f, 0.324092925f, 1.65703797f, -0.670618773f, -1.0f, 0.996897817f,
+		0.489844769f, -0.8849262f, 0.399806321f, 1.65703797f, -0.670618773f, -1.0f, 0.996897817f,
+		0.568930447f, -1.03971076f, 0.475519687f, 1.65703797f, -0.670618773f, -1.0f, 0.996897817f,
+		0.648016095f, -1.19449532f, 0.551233113f, 1.65703797f, -0.670618773f, -1.0f, 0.996897817f,
+		0.727101743f, -1.34927976f, 0.626946509f, 1.65703797f, -0.670618773f, -1.0f, 0.996897817f,
+		0.806187391f, -1.50406432f, 0.702659905f, 1.65703797f, -0.670618773f, -1.0f, 0.996897817f,
+		0.885273099f, -1.65884888f, 0.778373301f, 1.65703797f, -0.670618773f, -1.0f, 0.996897817f,
+		0.287928283f, -0.479069203f, 0.196617559f, 1.65224218f, -0.667683899f, -1.0f, 0.996984005f,
+		0.363274455f, -0.62601769f, 0.268235922f, 1.65224218f, -0.667683899f, -1.0f, 0.996984005f,
+		0.438620657f, -0.772966206f, 0.3398543f, 1.65224218f, -0.667683899f, -1.0f, 0.996984005f,
+		0.513966858f, -0.919914722f, 0.411472678f, 1.65224218f, -0.667683899f, -1.0f, 0.996984005f,
+		0.58931303f, -1.0668633f, 0.483091056f, 1.65224218f, -0.667683899f, -1.0f, 0.996984005f,
+		0.664659202f, -1.21381176f, 0.554709435f, 1.65224218f, -0.667683899f, -1.0f, 0.996984005f,
+		0.740005434f, -1.36076033f, 0.626327813f, 1.65224218f, -0.667683899f, -1.0f, 0.996984005f,
+		0.815351605f, -1.50770879f, 0.697946191f, 1.65224218f, -0.667683899f, -1.0f, 0.996984005f,
+		0.890697777f, -1.65465736f, 0.769564569f, 1.65224218f, -0.667683899f, -1.0f, 0.996984005f,
+		0.32007277f, -0.530843854f, 0.217341915f, 1.64466155f, -0.662714303f, -1.0f, 0.997066438f,
+		0.392017663f, -0.670476317f, 0.28504777f, 1.64466155f, -0.662714303f, -1.0f, 0.997066438f,
+		0.463962555f, -0.81010884f, 0.352753639f, 1.64466155f, -0.662714303f, -1.0f, 0.997066438f,
+		0.535907447f, -0.949741364f, 0.420459509f, 1.64466155f, -0.662714303f, -1.0f, 0.997066438f,
+		0.60785234f, -1.08937383f, 0.488165379f, 1.64466155f, -0.662714303f, -1.0f, 0.997066438f,
+		0.679797232f, -1.22900641f, 0.555871248f, 1.64466155f, -0.662714303f, -1.0f, 0.997066438f,
+		0.751742125f, -1.36863887f, 0.623577118f, 1.64466155f, -0.662714303f, -1.0f, 0.997066438f,
+		0.823687017f, -1.50827134f, 0.691282988f, 1.64466155f, -0.662714303f, -1.0f, 0.997066438f,
+		0.895631909f, -1.64790392f, 0.758988857f, 1.64466155f, -0.662714303f, -1.0f, 0.997066438f,
+		0.349432915f, -0.575793743f, 0.23453708f, 1.63248038f, -0.654418349f, -1.0f, 0.997145236f,
+		0.418271154f, -0.708435655f, 0.298362374f, 1.63248038f, -0.654418349f, -1.0f, 0.997145236f,
+		0.487109363f, -0.841077566f, 0.362187654f, 1.63248038f, -0.654418349f, -1.0f, 0.997145236f,
+		0.555947602f, -0.973719478f, 0.426012933f, 1.63248038f, -0.654418349f, -1.0f, 0.997145236f,
+		0.624785781f, -1.10636139f, 0.489838213f, 1.63248038f, -0.654418349f, -1.0f, 0.997145236f,
+		0.69362402f, -1.2390033f, 0.553663492f, 1.63248038f, -0.654418349f, -1.0f, 0.997145236f,
+		0.762462258f, -1.37164521f, 0.617488801f, 1.63248038f, -0.654418349f, -1.0f, 0.997145236f,
+		0.831300497f, -1.50428724f, 0.681314111f, 1.63248038f, -0.654418349f, -1.0f, 0.997145236f,
+		0.900138676f, -1.63692915f, 0.74513936f, 1.63248038f, -0.654418349f, -1.0f, 0.997145236f,
+		0.00584428571f, 0.00130700145f, -0.00453728437f, 1.66387606f, -0.67198354f, -1.0f, 0.996525824f,
+		0.111038528f, -0.20681721f, 0.0984023884f, 1.66387606f, -0.67198354f, -1.0f, 0.996525824f,
+		0.216232777f, -0.4149414f, 0.201342061f, 1.66387606f, -0.67198354f, -1.0f, 0.996525824f,
+		0.321427017f, -0.62306565f, 0.304281741f, 1.66387606f, -0.67198354f, -1.0f, 0.996525824f,
+		0.426621258f, -0.831189811f, 0.407221407f, 1.66387606f, -0.67198354f, -1.0f, 0.996525824f,
+		0.531815469f, -1.03931403f, 0.510161102f, 1.66387606f, -0.67198354f, -1.0f, 0.996525824f,
+		0.63700974f, -1.24743819f, 0.613100767f, 1.66387606f, -0.67198354f, -1.0f, 0.996525824f,
+		0.742203951f, -1.45556247f, 0.716040432f, 1.66387606f, -0.67198354f, -1.0f, 0.996525824f,
+		0.847398221f, -1.66368663f, 0.818980098f, 1.66387606f, -0.67198354f, -1.0f, 0.996525824f,
+		0.067427218f, -0.105186872f, 0.0405786857f, 1.66584158f, -0.674246609f, -1.0f, 0.996621847f,
+		0.166105211f, -0.300260335f, 0.136983946f, 1.66584158f, -0.674246609f, -1.0f, 0.996621847f,
+		0.264783204f, -0.495333821f, 0.233389214f, 1.66584158f, -0.674246609f, -1.0f, 0.996621847f,
+		0.363461196f, -0.690407276f, 0.329794496f, 1.66584158f, -0.674246609f, -1.0f, 0.996621847f,
+		0.462139189f, -0.885480762f, 0.426199734f, 1.66584158f, -0.674246609f, -1.0f, 0.996621847f,
+		0.560817182f, -1.08055425f, 0.522605002f, 1.66584158f, -0.674246609f, -1.0f, 0.996621847f,
+		0.659495175f, -1.27562773f, 0.61901027f, 1.66584158f, -0.674246609f, -1.0f, 0.996621847f,
+		0.758173168f, -1.4707011f, 0.715415537f, 1.66584158f, -0.674246609f, -1.0f, 0.996621847f,
+		0.856851161f, -1.66577458f, 0.811820805f, 1.66584158f, -0.674246609f, -1.0f, 0.996621847f,
+		0.121824861f, -0.199040145f, 0.0802711621f, 1.66712666f, -0.675922096f, -1.0f, 0.99671495f,
+		0.214746892f, -0.382561505f, 0.170880467f, 1.66712666f, -0.675922096f, -1.0f, 0.99671495f,
+		0.307668924f, -0.566082895f, 0.261489749f, 1.66712666f, -0.675922096f, -1.0f, 0.99671495f,
+		0.400590956f, -0.749604285f, 0.352099061f, 1.66712666f, -0.675922096f, -1.0f, 0.99671495f,
+		0.493512988f, -0.933125615f, 0.442708373f, 1.66712666f, -0.675922096f, -1.0f, 0.99671495f,
+		0.58643502f, -1.11664701f, 0.533317685f, 1.66712666f, -0.675922096f, -1.0f, 0.99671495f,
+		0.679357052f, -1.3001684f, 0.623926938f, 1.66712666f, -0.675922096f, -1.0f, 0.99671495f,
+		0.772279084f, -1.48368979f, 0.71453625f, 1.66712666f, -0.675922096f, -1.0f, 0.99671495f,
+		0.865201116f, -1.66721117f, 0.805145562f, 1.66712666f, -0.675922096f, -1.0f, 0.99671495f,
+		0.170225233f, -0.282289296f, 0.115397207f, 1.6677345f, -0.677028775f, -1.0f, 0.996805012f,
+		0.258025885f, -0.455503464f, 0.200820923f, 1.6677345f, -0.677028775f, -1.0f, 0.996805012f,
+		0.345826566f, -0.628717601f, 0.286244661f, 1.6677345f, -0.677028775f, -1.0f, 0.996805012f,
+		0.433627218f, -0.801931739f, 0.371668369f, 1.6677345f, -0.677028775f, -1.0f, 0.996805012f,
+		0.52142787f, -0.975145876f, 0.457092106f, 1.6677345f, -0.677028775f, -1.0f, 0.996805012f,
+		0.609228551f, -1.14836001f, 0.542515814f, 1.6677345f, -0.677028775f, -1.0f, 0.996805012f,
+		0.697029173f, -1.32157421f, 0.627939582f, 1.6677345f, -0.677028775f, -1.0f, 0.996805012f,
+		0.784829855f, -1.49478829f, 0.71336329f, 1.6677345f, -0.677028775f, -1.0f, 0.996805012f,
+		0.872630537f, -1.66800249f, 0.798786998f, 1.6677345f, -0.677028775f, -1.0f, 0.996805012f,
+		0.213568062f, -0.356525719f, 0.146620303f, 1.66762733f, -0.6775527f, -1.0f, 0.996891797f,
+		0.296782494f, -0.520474613f, 0.227365375f, 1.66762733f, -0.6775527f, -1.0f, 0.996891797f,
+		0.379996955f, -0.684423506f, 0.308110446f, 1.66762733f, -0.6775527f, -1.0f, 0.996891797f,
+		0.463211387f, -0.84837234f, 0.388855517f, 1.66762733f, -0.6775527f, -1.0f, 0.996891797f,
+		0.546425819f, -1.01232123f, 0.469600588f, 1.66762733f, -0.6775527f, -1.0f, 0.996891797f,
+		0.629640281f, -1.17627013f, 0.550345659f, 1.66762733f, -0.6775527f, -1.0f, 0.996891797f,
+		0.712854683f, -1.34021902f, 0.63109076f, 1.66762733f, -0.6775527f, -1.0f, 0.996891797f,
+		0.796069145f, -1.50416791f, 0.711835802f, 1.66762733f, -0.6775527f, -1.0f, 0.996891797f,
+		0.879283607f, -1.66811681f, 0.792580903f, 1.66762733f, -0.6775527f, -1.0f, 0.996891797f,
+		0.252606392f, -0.422996193f, 0.174451083f, 1.66671634f, -0.677440763f, -1.0f, 0.996975362f,
+		0.331690073f, -0.578556001f, 0.250938356f, 1.66671634f, -0.677440763f, -1.0f, 0.996975362f,
+		0.410773784f, -0.734115779f, 0.327425629f, 1.66671634f, -0.677440763f, -1.0f, 0.996975362f,
+		0.489857465f, -0.889675558f, 0.403912932f, 1.66671634f, -0.677440763f, -1.0f, 0.996975362f,
+		0.568941176f, -1.0452354f, 0.480400205f, 1.66671634f, -0.677440763f, -1.0f, 0.996975362f,
+		0.648024857f, -1.20079517f, 0.556887448f, 1.66671634f, -0.677440763f, -1.0f, 0.996975362f,
+		0.727108538f, -1.35635495f, 0.633374751f, 1.66671634f, -0.677440763f, -1.0f, 0.996975362f,
+		0.806192219f, -1.51191473f, 0.709862053f, 1.66671634f, -0.677440763f, -1.0f, 0.996975362f,
+		0.8852759f, -1.66747451f, 0.786349297f, 1.66671634f, -0.677440763f, -1.0f, 0.996975362f,
+		0.287950724f, -0.4826684f, 0.19927153f, 1.66484094f, -0.67658633f, -1.0f, 0.997055709f,
+		0.363294542f, -0.630576015f, 0.271847278f, 1.66484094f, -0.67658633f, -1.0f, 0.997055709f,
+		0.438638359f, -0.778483689f, 0.344423026f, 1.66484094f, -0.67658633f, -1.0f, 0.997055709f,
+		0.513982177f, -0.926391304f, 0.416998774f, 1.66484094f, -0.67658633f, -1.0f, 0.997055709f,
+		0.589325964f, -1.07429898f, 0.489574522f, 1.66484094f, -0.67658633f, -1.0f, 0.997055709f,
+		0.664669812f, -1.22220659f, 0.56215024f, 1.66484094f, -0.67658633f, -1.0f, 0.997055709f,
+		0.740013599f, -1.37011421f, 0.634725988f, 1.66484094f, -0.67658633f, -1.0f, 0.997055709f,
+		0.815357447f, -1.51802194f, 0.707301736f, 1.66484094f, -0.67658633f, -1.0f, 0.997055709f,
+		0.890701234f, -1.66592956f, 0.779877484f, 1.66484094f, -0.67658633f, -1.0f, 0.997055709f,
+		0.320101082f, -0.536265731f, 0.221343294f, 1.66172731f, -0.674800217f, -1.0f, 0.997132897f,
+		0.392042994f, -0.677136421f, 0.290284991f, 1.66172731f, -0.674800217f, -1.0f, 0.997132897f,
+		0.463984877f, -0.818007112f, 0.359226704f, 1.66172731f, -0.674800217f, -1.0f, 0.997132897f,
+		0.535926759f, -0.958877802f, 0.428168416f, 1.66172731f, -0.674800217f, -1.0f, 0.997132897f,
+		0.607868671f, -1.09974849f, 0.497110099f, 1.66172731f, -0.674800217f, -1.0f, 0.997132897f,
+		0.679810584f, -1.24061918f, 0.566051781f, 1.66172731f, -0.674800217f, -1.0f, 0.997132897f,
+		0.751752496f, -1.38148987f, 0.634993494f, 1.66172731f, -0.674800217f, -1.0f, 0.997132897f,
+		0.823694408f, -1.52236056f, 0.703935206f, 1.66172731f, -0.674800217f, -1.0f, 0.997132897f,
+		0.895636261f, -1.66323125f, 0.772876918f, 1.66172731f, -0.674800217f, -1.0f, 0.997132897f,
+		0.349470824f, -0.58426863f, 0.240795448f, 1.65690684f, -0.671752334f, -1.0f, 0.997206926f,
+		0.418305039f, -0.718603671f, 0.306310624f, 1.65690684f, -0.671752334f, -1.0f, 0.997206926f,
+		0.487139255f, -0.852938771f, 0.371825784f, 1.65690684f, -0.671752334f, -1.0f, 0.997206926f,
+		0.55597347f, -0.987273872f, 0.437340945f, 1.65690684f, -0.671752334f, -1.0f, 0.997206926f,
+		0.624807656f, -1.12160897f, 0.502856076f, 1.65690684f, -0.671752334f, -1.0f, 0.997206926f,
+		0.693641901f, -1.25594401f, 0.568371236f, 1.65690684f, -0.671752334f, -1.0f, 0.997206926f,
+		0.762476087f, -1.39027905f, 0.633886456f, 1.65690684f, -0.671752334f, -1.0f, 0.997206926f,
+		0.831310272f, -1.52461421f, 0.699401617f, 1.65690684f, -0.671752334f, -1.0f, 0.997206926f,
+		0.900144517f, -1.65894926f, 0.764916778f, 1.65690684f, -0.671752334f, -1.0f, 0.997206926f,
+		0.00585606787f, 0.0013096364f, -0.00454643136f, 1.66767776f, -0.674616814f, -1.0f, 0.996699214f,
+		0.111049064f, -0.207235068f, 0.0988131687f, 1.66767776f, -0.674616814f, -1.0f, 0.996699214f,
+		0.21624206f, -0.415779769f, 0.202172771f, 1.66767776f, -0.674616814f, -1.0f, 0.996699214f,
+		0.321435064f, -0.624324501f, 0.305532366f, 1.66767776f, -0.674616814f, -1.0f, 0.996699214f,
+		0.426628053f, -0.832869172f, 0.408891976f, 1.66767776f, -0.674616814f, -1.0f, 0.996699214f,
+		0.531821072f, -1.0414139f, 0.512251556f, 1.66767776f, -0.674616814f, -1.0f, 0.996699214f,
+		0.637014031f, -1.24995863f, 0.615611196f, 1.66767776f, -0.674616814f, -1.0f, 0.996699214f,
+		0.74220705f, -1.45850325f, 0.718970776f, 1.66767776f, -0.674616814f, -1.0f, 0.996699214f,
+		0.84740001f, -1.66704798f, 0.822330415f, 1.66767776f, -0.674616814f, -1.0f, 0.996699214f,
+		0.067439355f, -0.105465584f, 0.0407778472f, 1.67021084f, -0.677286446f, -1.0f, 0.996781647f,
+		0.166116059f, -0.300988406f, 0.137631804f, 1.67021084f, -0.677286446f, -1.0f, 0.996781647f,
+		0.26479277f, -0.496511221f, 0.23448576f, 1.67021084f, -0.677286446f, -1.0f, 0.996781647f,
+		0.363469481f, -0.692034006f, 0.331339717f, 1.67021084f, -0.677286446f, -1.0f, 0.996781647f,
+		0.462146163f, -0.887556851f, 0.428193688f, 1.67021084f, -0.677286446f, -1.0f, 0.996781647f,
+		0.560822904f, -1.0830797f, 0.52504766f, 1.67021084f, -0.677286446f, -1.0f, 0.996781647f,
+		0.659499586f, -1.27860248f, 0.621901572f, 1.67021084f, -0.677286446f, -1.0f, 0.996781647f,
+		0.758176267f, -1.47412527f, 0.718755543f, 1.67021084f, -0.677286446f, -1.0f, 0.996781647f,
+		0.856853008f, -1.66964805f, 0.815609515f, 1.67021084f, -0.677286446f, -1.0f, 0.996781647f,
+		0.121837571f, -0.199646637f, 0.0807129219f, 1.67218697f, -0.679456353f, -1.0f, 0.996862352f,
+		0.214758262f, -0.383654475f, 0.171807915f, 1.67218697f, -0.679456353f, -1.0f, 0.996862352f,
+		0.307678938f, -0.567662299f, 0.262902915f, 1.67218697f, -0.679456353f, -1.0f, 0.996862352f,
+		0.400599629f, -0.751670122f, 0.353997916f, 1.67218697f, -0.679456353f, -1.0f, 0.996862352f,
+		0.493520319f, -0.935677946f, 0.445092916f, 1.67218697f, -0.679456353f, -1.0f, 0.996862352f,
+		0.58644098f, -1.11968577f, 0.536187947f, 1.67218697f, -0.679456353f, -1.0f, 0.996862352f,
+		0.679361701f, -1.30369365f, 0.627282917f, 1.67218697f, -0.679456353f, -1.0f, 0.996862352f,
+		0.772282362f, -1.48770142f, 0.718377948f, 1.67218697f, -0.679456353f, -1.0f, 0.996862352f,
+		0.865203083f, -1.6717093f, 0.809472919f, 1.67218697f, -0.679456353f, -1.0f, 0.996862352f,
+		0.170238763f, -0.283289701f, 0.116130404f, 1.67365003f, -0.681174397f, -1.0f, 0.99694109f,
+		0.258037984f, -0.457037866f, 0.202087298f, 1.67365003f, -0.681174397f, -1.0f, 0.99694109f,
+		0.345837206f, -0.630786061f, 0.288044184f, 1.67365003f, -0.681174397f, -1.0f, 0.99694109f,
+		0.433636457f, -0.804534256f, 0.374001086f, 1.67365003f, -0.681174397f, -1.0f, 0.99694109f,
+		0.521435678f, -0.978282452f, 0.459957987f, 1.67365003f, -0.681174397f, -1.0f, 0.99694109f,
+		0.609234929f, -1.15203059f, 0.545914888f, 1.67365003f, -0.681174397f, -1.0f, 0.99694109f,
+		0.697034121f, -1.32577884f, 0.63187176f, 1.67365003f, -0.681174397f, -1.0f, 0.99694109f,
+		0.784833372f, -1.49952698f, 0.717828691f, 1.67365003f, -0.681174397f, -1.0f, 0.99694109f,
+		0.872632563f, -1.67327523f, 0.803785563f, 1.67365003f, -0.681174397f, -1.0f, 0.99694109f,
+		0.213582709f, -0.358013958f, 0.147714406f, 1.67462087f, -0.682468772f, -1.0f, 0.997017682f,
+		0.296795607f, -0.522558212f, 0.229053825f, 1.67462087f, -0.682468772f, -1.0f, 0.997017682f,
+		0.380008489f, -0.687102437f, 0.310393244f, 1.67462087f, -0.682468772f, -1.0f, 0.997017682f,
+		0.463221371f, -0.851646721f, 0.391732693f, 1.67462087f, -0.682468772f, -1.0f, 0.997017682f,
+		0.546434283f, -1.01619101f, 0.473072112f, 1.67462087f, -0.682468772f, -1.0f, 0.997017682f,
+		0.629647136f, -1.18073523f, 0.55441153f, 1.67462087f, -0.682468772f, -1.0f, 0.997017682f,
+		0.712860048f, -1.34527946f, 0.635750949f, 1.67462087f, -0.682468772f, -1.0f, 0.997017682f,
+		0.79607296f, -1.50982368f, 0.717090368f, 1.67462087f, -0.682468772f, -1.0f, 0.997017682f,
+		0.879285812f, -1.6743679f, 0.798429787f, 1.67462087f, -0.682468772f, -1.0f, 0.997017682f,
+		0.252622575f, -0.425107419f, 0.176006004f, 1.67509854f, -0.683349133f, -1.0f, 0.997091889f,
+		0.331704557f, -0.581342578f, 0.253167421f, 1.67509854f, -0.683349133f, -1.0f, 0.997091889f,
+		0.410786539f, -0.737577677f, 0.330328852f, 1.67509854f, -0.683349133f, -1.0f, 0.997091889f,
+		0.489868522f, -0.893812835f, 0.407490283f, 1.67509854f, -0.683349133f, -1.0f, 0.997091889f,
+		0.568950474f, -1.05004799f, 0.484651715f, 1.67509854f, -0.683349133f, -1.0f, 0.997091889f,
+		0.648032486f, -1.20628309f, 0.561813116f, 1.67509854f, -0.683349133f, -1.0f, 0.997091889f,
+		0.727114439f, -1.36251819f, 0.638974547f, 1.67509854f, -0.683349133f, -1.0f, 0.997091889f,
+		0.806196451f, -1.51875341f, 0.716135979f, 1.67509854f, -0.683349133f, -1.0f, 0.997091889f,
+		0.885278404f, -1.67498851f, 0.79329741f, 1.67509854f, -0.683349133f, -1.0f, 0.997091889f,
+		0.287968993f, -0.485601306f, 0.20143421f, 1.67505789f, -0.683805883f, -1.0f, 0.997163773f,
+		0.363310874f, -0.634290516f, 0.274790108f, 1.67505789f, -0.683805883f, -1.0f, 0.997163773f,
+		0.438652754f, -0.782979786f, 0.348145992f, 1.67505789f, -0.683805883f, -1.0f, 0.997163773f,
+		0.513994634f, -0.931668997f, 0.421501905f, 1.67505789f, -0.683805883f, -1.0f, 0.997163773f,
+		0.589336514f, -1.08035827f, 0.494857788f, 1.67505789f, -0.683805883f, -1.0f, 0.997163773f,
+		0.664678395f, -1.22904742f, 0.568213701f, 1.67505789f, -0.683805883f, -1.0f, 0.997163773f,
+		0.740020275f, -1.37773669f, 0.641569614f, 1.67505789f, -0.683805883f, -1.0f, 0.997163773f,
+		0.815362155f, -1.52642596f, 0.714925468f, 1.67505789f, -0.683805883f, -1.0f, 0.997163773f,
+		0.890704036f, -1.67511511f, 0.788281381f, 1.67505789f, -0.683805883f, -1.0f, 0.997163773f,
+		0.320122272f, -0.540322125f, 0.224336907f, 1.67444432f, -0.683806419f, -1.0f, 0.997233212f,
+		0.392061919f, -0.682119191f, 0.294203192f, 1.67444432f, -0.683806419f, -1.0f, 0.997233212f,
+		0.464001596f, -0.823916197f, 0.364069492f, 1.67444432f, -0.683806419f, -1.0f, 0.997233212f,
+		0.535941243f, -0.965713203f, 0.433935761f, 1.67444432f, -0.683806419f, -1.0f, 0.997233212f,
+		0.60788089f, -1.10751021f, 0.503802061f, 1.67444432f, -0.683806419f, -1.0f, 0.997233212f,
+		0.679820538f, -1.24930727f, 0.573668361f, 1.67444432f, -0.683806419f, -1.0f, 0.997233212f,
+		0.751760244f, -1.39110422f, 0.64353466f, 1.67444432f, -0.683806419f, -1.0f, 0.997233212f,
+		0.823699892f, -1.53290129f, 0.7134009f, 1.67444432f, -0.683806419f, -1.0f, 0.997233212f,
+		0.895639539f, -1.67469823f, 0.7832672f, 1.67444432f, -0.683806419f, -1.0f, 0.997233212f,
+		0.349496156f, -0.589926898f, 0.244973883f, 1.67316294f, -0.683288574f, -1.0f, 0.997300267f,
+		0.418327689f, -0.725392461f, 0.311617315f, 1.67316294f, -0.683288574f, -1.0f, 0.997300267f,
+		0.487159193f, -0.860857964f, 0.378260732f, 1.67316294f, -0.683288574f, -1.0f, 0.997300267f,
+		0.555990756f, -0.996323526f, 0.444904149f, 1.67316294f, -0.683288574f, -1.0f, 0.997300267f,
+		0.624822259f, -1.13178909f, 0.511547565f, 1.67316294f, -0.683288574f, -1.0f, 0.997300267f,
+		0.693653822f, -1.26725459f, 0.578190982f, 1.67316294f, -0.683288574f, -1.0f, 0.997300267f,
+		0.762485325f, -1.40272009f, 0.644834399f, 1.67316294f, -0.683288574f, -1.0f, 0.997300267f,
+		0.831316888f, -1.5381856f, 0.711477816f, 1.67316294f, -0.683288574f, -1.0f, 0.997300267f,
+		0.900148392f, -1.6736511f, 0.778121233f, 1.67316294f, -0.683288574f, -1.0f, 0.997300267f,
+		0.00586746586f, 0.00131218543f, -0.00455528079f, 1.67127609f, -0.677109599f, -1.0f, 0.996946156f,
+		0.111059256f, -0.207639307f, 0.0992105678f, 1.67127609f, -0.677109599f, -1.0f, 0.996946156f,
+		0.216251045f, -0.41659081f, 0.202976421f, 1.67127609f, -0.677109599f, -1.0f, 0.996946156f,
+		0.321442842f, -0.625542283f, 0.306742281f, 1.67127609f, -0.677109599f, -1.0f, 0.996946156f,
+		0.42663461f, -0.834493816f, 0.410508126f, 1.67127609f, -0.677109599f, -1.0f, 0.996946156f,
+		0.531826437f, -1.04344535f, 0.514273942f, 1.67127609f, -0.677109599f, -1.0f, 0.996946156f,
+		0.637018204f, -1.25239682f, 0.618039787f, 1.67127609f, -0.677109599f, -1.0f, 0.996946156f,
+		0.742209971f, -1.4613483f, 0.721805692f, 1.67127609f, -0.677109599f, -1.0f, 0.996946156f,
+		0.847401798f, -1.67029977f, 0.825571537f, 1.67127609f, -0.677109599f, -1.0f, 0.996946156f,
+		0.0674507841f, -0.105728023f, 0.0409653783f, 1.67424583f, -0.680093884f, -1.0f, 0.997011244f,
+		0.166126281f, -0.301673949f, 0.138241827f, 1.67424583f, -0.680093884f, -1.0f, 0.997011244f,
+		0.26480177f, -0.497619838f, 0.235518262f, 1.67424583f, -0.680093884f, -1.0f, 0.997011244f,
+		0.36347726f, -0.693565786f, 0.332794696f, 1.67424583f, -0.680093884f, -1.0f, 0.997011244f,
+		0.462152779f, -0.889511704f, 0.430071145f, 1.67424583f, -0.680093884f, -1.0f, 0.997011244f,
+		0.560828269f, -1.08545756f, 0.527347624f, 1.67424583f, -0.680093884f, -1.0f, 0.997011244f,
+		0.659503758f, -1.28140354f, 0.624624014f, 1.67424583f, -0.680093884f, -1.0f, 0.997011244f,
+		0.758179247f, -1.4773494f, 0.721900463f, 1.67424583f, -0.680093884f, -1.0f, 0.997011244f,
+		0.856854737f, -1.67329538f, 0.819176912f, 1.67424583f, -0.680093884f, -1.0f, 0.997011244f,
+		0.121849172f, -0.200200543f, 0.0811163709f, 1.67672968f, -0.682629228f, -1.0f, 0.997075796f,
+		0.214768633f, -0.384652644f, 0.172654957f, 1.67672968f, -0.682629228f, -1.0f, 0.997075796f,
+		0.307688087f, -0.569104731f, 0.264193535f, 1.67672968f, -0.682629228f, -1.0f, 0.997075796f,
+		0.400607556f, -0.753556848f, 0.355732113f, 1.67672968f, -0.682629228f, -1.0f, 0.997075796f,
+		0.493526995f, -0.938008904f, 0.447270721f, 1.67672968f, -0.682629228f, -1.0f, 0.997075796f,
+		0.586446464f, -1.12246108f, 0.538809299f, 1.67672968f, -0.682629228f, -1.0f, 0.997075796f,
+		0.679365933f, -1.30691314f, 0.630347908f, 1.67672968f, -0.682629228f, -1.0f, 0.997075796f,
+		0.772285402f, -1.49136519f, 0.721886456f, 1.67672968f, -0.682629228f, -1.0f, 0.997075796f,
+		0.865204811f, -1.67581737f, 0.813425064f, 1.67672968f, -0.682629228f, -1.0f, 0.997075796f,
+		0.170250684f, -0.284172148f, 0.116777167f, 1.67878962f, -0.684776485f, -1.0f, 0.997139573f,
+		0.258048654f, -0.458391398f, 0.203204364f, 1.67878962f, -0.684776485f, -1.0f, 0.997139573f,
+		0.345846623f, -0.632610679f, 0.289631575f, 1.67878962f, -0.684776485f, -1.0f, 0.997139573f,
+		0.433644593f, -0.806829929f, 0.376058787f, 1.67878962f, -0.684776485f, -1.0f, 0.997139573f,
+		0.521442533f, -0.98104918f, 0.462485969f, 1.67878962f, -0.684776485f, -1.0f, 0.997139573f,
+		0.609240532f, -1.15526843f, 0.548913181f, 1.67878962f, -0.684776485f, -1.0f, 0.997139573f,
+		0.697038472f, -1.3294878f, 0.635340393f, 1.67878962f, -0.684776485f, -1.0f, 0.997139573f,
+		0.784836471f, -1.50370705f, 0.721767604f, 1.67878962f, -0.684776485f, -1.0f, 0.997139573f,
+		0.872634411f, -1.6779263f, 0.808194816f, 1.67878962f, -0.684776485f, -1.0f, 0.997139573f,
+		0.213595137f, -0.359275401f, 0.148641765f, 1.68047059f, -0.686581016f, -1.0f, 0.997202277f,
+		0.296806723f, -0.524324298f, 0.230484962f, 1.68047059f, -0.686581016f, -1.0f, 0.997202277f,
+		0.380018294f, -0.689373136f, 0.31232816f, 1.68047059f, -0.686581016f, -1.0f, 0.997202277f,
+		0.463229865f, -0.854422033f, 0.394171387f, 1.68047059f, -0.686581016f, -1.0f, 0.997202277f,
+		0.546441436f, -1.01947093f, 0.476014584f, 1.68047059f, -0.686581016f, -1.0f, 0.997202277f,
+		0.629653037f, -1.18451977f, 0.557857752f, 1.68047059f, -0.686581016f, -1.0f, 0.997202277f,
+		0.712864578f, -1.34956872f, 0.639701009f, 1.68047059f, -0.686581016f, -1.0f, 0.997202277f,
+		0.796076179f, -1.51461756f, 0.721544206f, 1.68047059f, -0.686581016f, -1.0f, 0.997202277f,
+		0.87928772f, -1.67966652f, 0.803387403f, 1.68047059f, -0.686581016f, -1.0f, 0.997202277f,
+		0.252635688f, -0.426815897f, 0.177264273f, 1.68180394f, -0.688075781f, -1.0f, 0.997263849f,
+		0.331716269f, -0.583597541f, 0.254971236f, 1.68180394f, -0.688075781f, -1.0f, 0.997263849f,
+		0.410796881f, -0.740379155f, 0.332678199f, 1.68180394f, -0.688075781f, -1.0f, 0.997263849f,
+		0.489877462f, -0.897160828f, 0.410385162f, 1.68180394f, -0.688075781f, -1.0f, 0.997263849f,
+		0.568958044f, -1.05394244f, 0.488092124f, 1.68180394f, -0.688075781f, -1.0f, 0.997263849f,
+		0.648038626f, -1.21072412f, 0.565799117f, 1.68180394f, -0.688075781f, -1.0f, 0.997263849f,
+		0.727119267f, -1.36750579f, 0.64350605f, 1.68180394f, -0.688075781f, -1.0f, 0.997263849f,
+		0.806199849f, -1.52428734f, 0.721213043f, 1.68180394f, -0.688075781f, -1.0f, 0.997263849f,
+		0.88528043f, -1.68106902f, 0.798919976f, 1.68180394f, -0.688075781f, -1.0f, 0.997263849f,
+		0.28798303f, -0.487848729f, 0.203091398f, 1.68280947f, -0.689283311f, -1.0f, 0.99732399f,
+		0.36332342f, -0.637136877f, 0.277045101f, 1.68280947f, -0.689283311f, -1.0f, 0.99732399f,
+		0.43866381f, -0.786424994f, 0.350998789f, 1.68280947f, -0.689283311f, -1.0f, 0.99732399f,
+		0.51400423f, -0.935713112f, 0.424952507f, 1.68280947f, -0.689283311f, -1.0f, 0.99732399f,
+		0.589344621f, -1.08500123f, 0.498906195f, 1.68280947f, -0.689283311f, -1.0f, 0.99732399f,
+		0.664685011f, -1.23428941f, 0.572859883f, 1.68280947f, -0.689283311f, -1.0f, 0.99732399f,
+		0.740025401f, -1.38357747f, 0.646813571f, 1.68280947f, -0.689283311f, -1.0f, 0.99732399f,
+		0.815365791f, -1.53286564f, 0.720767319f, 1.68280947f, -0.689283311f, -1.0f, 0.99732399f,
+		0.890706182f, -1.6821537f, 0.794721007f, 1.68280947f, -0.689283311f, -1.0f, 0.99732399f,
+		0.320137471f, -0.54323405f, 0.226485908f, 1.68349588f, -0.690216959f, -1.0f, 0.9973827f,
+		0.392075539f, -0.685696065f, 0.297015905f, 1.68349588f, -0.690216959f, -1.0f, 0.9973827f,
+		0.464013577f, -0.828158081f, 0.367545933f, 1.68349588f, -0.690216959f, -1.0f, 0.9973827f,
+		0.535951614f, -0.970620036f, 0.43807593f, 1.68349588f, -0.690216959f, -1.0f, 0.9973827f,
+		0.607889652f, -1.11308205f, 0.508605957f, 1.68349588f, -0.690216959f, -1.0f, 0.9973827f,
+		0.67982775f, -1.25554407f, 0.579135954f, 1.68349588f, -0.690216959f, -1.0f, 0.9973827f,
+		0.751765788f, -1.39800608f, 0.649665952f, 1.68349588f, -0.690216959f, -1.0f, 0.9973827f,
+		0.823703825f, -1.5404681f, 0.720195949f, 1.68349588f, -0.690216959f, -1.0f, 0.9973827f,
+		0.895641863f, -1.68292999f, 0.790726006f, 1.68349588f, -0.690216959f, -1.0f, 0.9973827f,
+		0.349512935f, -0.593677819f, 0.247743756f, 1.68386149f, -0.690880835f, -1.0f, 0.997439921f,
+		0.41834268f, -0.729892731f, 0.315135092f, 1.68386149f, -0.690880835f, -1.0f, 0.997439921f,
+		0.487172425f, -0.866107583f, 0.382526428f, 1.68386149f, -0.690880835f, -1.0f, 0.997439921f,
+		0.5560022f, -1.00232255f, 0.449917763f, 1.68386149f, -0.690880835f, -1.0f, 0.997439921f,
+		0.624831975f, -1.13853741f, 0.517309129f, 1.68386149f, -0.690880835f, -1.0f, 0.997439921f,
+		0.69366169f, -1.27475226f, 0.584700465f, 1.68386149f, -0.690880835f, -1.0f, 0.997439921f,
+		0.762491465f, -1.41096723f, 0.652091801f, 1.68386149f, -0.690880835f, -1.0f, 0.997439921f,
+		0.831321239f, -1.54718208f, 0.719483137f, 1.68386149f, -0.690880835f, -1.0f, 0.997439921f,
+		0.900150955f, -1.68339705f, 0.786874473f, 1.68386149f, -0.690880835f, -1.0f, 0.997439921f,
+		0.00587758608f, 0.00131444866f, -0.00456313742f, 1.67435682f, -0.679244041f, -1.0f, 0.997279644f,
+		0.111068301f, -0.207998216f, 0.0995633975f, 1.67435682f, -0.679244041f, -1.0f, 0.997279644f,
+		0.216259018f, -0.417310894f, 0.203689933f, 1.67435682f, -0.679244041f, -1.0f, 0.997279644f,
+		0.321449727f, -0.626623571f, 0.307816476f, 1.67435682f, -0.679244041f, -1.0f, 0.997279644f,
+		0.426640451f, -0.835936248f, 0.411942989f, 1.67435682f, -0.679244041f, -1.0f, 0.997279644f,
+		0.531831205f, -1.04524887f, 0.516069531f, 1.67435682f, -0.679244041f, -1.0f, 0.997279644f,
+		0.637021899f, -1.25456154f, 0.620196044f, 1.67435682f, -0.679244041f, -1.0f, 0.997279644f,
+		0.742212594f, -1.46387422f, 0.724322617f, 1.67435682f, -0.679244041f, -1.0f, 0.997279644f,
+		0.847403347f, -1.6731869f, 0.82844913f, 1.67435682f, -0.679244041f, -1.0f, 0.997279644f,
+		0.067460686f, -0.105955318f, 0.0411277972f, 1.67762554f, -0.682445705f, -1.0f, 0.997325003f,
+		0.166135132f, -0.302267671f, 0.138770148f, 1.67762554f, -0.682445705f, -1.0f, 0.997325003f,
+		0.264809579f, -0.498580039f, 0.23641251f, 1.67762554f, -0.682445705f, -1.0f, 0.997325003f,
+		0.363484025f, -0.694892406f, 0.334054857f, 1.67762554f, -0.682445705f, -1.0f, 0.997325003f,
+		0.462158471f, -0.891204774f, 0.43169722f, 1.67762554f, -0.682445705f, -1.0f, 0.997325003f,
+		0.560832918f, -1.08751714f, 0.529339552f, 1.67762554f, -0.682445705f, -1.0f, 0.997325003f,
+		0.659507394f, -1.28382945f, 0.626981914f, 1.67762554f, -0.682445705f, -1.0f, 0.997325003f,
+		0.75818181f, -1.48014188f, 0.724624276f, 1.67762554f, -0.682445705f, -1.0f, 0.997325003f,
+		0.856856287f, -1.67645419f, 0.822266638f, 1.67762554f, -0.682445705f, -1.0f, 0.997325003f,
+		0.121858954f, -0.200667381f, 0.0814564079f, 1.68044329f, -0.685223281f, -1.0f, 0.99737072f,
+		0.21477738f, -0.385493934f, 0.173368856f, 1.68044329f, -0.685223281f, -1.0f, 0.99737072f,
+		0.307695806f, -0.570320487f, 0.26528129f, 1.68044329f, -0.685223281f, -1.0f, 0.99737072f,
+		0.400614232f, -0.75514698f, 0.357193738f, 1.68044329f, -0.685223281f, -1.0f, 0.99737072f,
+		0.493532658f, -0.939973533f, 0.449106187f, 1.68044329f, -0.685223281f, -1.0f, 0.99737072f,
+		0.586451054f, -1.12480009f, 0.541018665f, 1.68044329f, -0.685223281f, -1.0f, 0.99737072f,
+		0.679369509f, -1.30962658f, 0.632931113f, 1.68044329f, -0.685223281f, -1.0f, 0.99737072f,
+		0.772287905f, -1.49445319f, 0.724843562f, 1.68044329f, -0.685223281f, -1.0f, 0.99737072f,
+		0.865206361f, -1.67927969f, 0.81675601f, 1.68044329f, -0.685223281f, -1.0f, 0.99737072f,
+		0.170260444f, -0.284893841f, 0.117306128f, 1.68287838f, -0.687642276f, -1.0f, 0.997416675f,
+		0.258057386f, -0.459498405f, 0.204117984f, 1.68287838f, -0.687642276f, -1.0f, 0.997416675f,
+		0.345854312f, -0.634102941f, 0.290929824f, 1.68287838f, -0.687642276f, -1.0f, 0.997416675f,
+		0.433651239f, -0.808707476f, 0.377741694f, 1.68287838f, -0.687642276f, -1.0f, 0.997416675f,
+		0.521448195f, -0.983312011f, 0.464553535f, 1.68287838f, -0.687642276f, -1.0f, 0.997416675f,
+		0.609245121f, -1.15791655f, 0.551365376f, 1.68287838f, -0.687642276f, -1.0f, 0.997416675f,
+		0.697042048f, -1.33252108f, 0.638177216f, 1.68287838f, -0.687642276f, -1.0f, 0.997416675f,
+		0.784838974f, -1.50712562f, 0.724989116f, 1.68287838f, -0.687642276f, -1.0f, 0.997416675f,
+		0.872635901f, -1.68173015f, 0.811800957f, 1.68287838f, -0.687642276f, -1.0f, 0.997416675f,
+		0.213604957f, -0.360273212f, 0.149375319f, 1.68498349f, -0.689753771f, -1.0f, 0.99746263f,
+		0.296815485f, -0.525721252f, 0.231617019f, 1.68498349f, -0.689753771f, -1.0f, 0.99746263f,
+		0.380026042f, -0.691169322f, 0.313858718f, 1.68498349f, -0.689753771f, -1.0f, 0.99746263f,
+		0.46323657f, -0.856617391f, 0.396100402f, 1.68498349f, -0.689753771f, -1.0f, 0.99746263f,
+		0.546447098f, -1.0220654f, 0.478342116f, 1.68498349f, -0.689753771f, -1.0f, 0.99746263f,
+		0.629657626f, -1.18751347f, 0.56058377f, 1.68498349f, -0.689753771f, -1.0f, 0.99746263f,
+		0.712868154f, -1.35296154f, 0.642825484f, 1.68498349f, -0.689753771f, -1.0f, 0.99746263f,
+		0.796078742f, -1.51840961f, 0.725067198f, 1.68498349f, -0.689753771f, -1.0f, 0.99746263f,
+		0.879289269f, -1.68385768f, 0.807308912f, 1.68498349f, -0.689753771f, -1.0f, 0.99746263f,
+		0.252645671f, -0.428117841f, 0.178223148f, 1.68680036f, -0.691597939f, -1.0f, 0.997508407f,
+		0.33172521f, -0.585315943f, 0.256345838f, 1.68680036f, -0.691597939f, -1.0f, 0.997508407f,
+		0.410804749f, -0.742514074f, 0.334468544f, 1.68680036f, -0.691597939f, -1.0f, 0.997508407f,
+		0.489884287f, -0.899712145f, 0.412591249f, 1.68680036f, -0.691597939f, -1.0f, 0.997508407f,
+		0.568963826f, -1.05691028f, 0.490713954f, 1.68680036f, -0.691597939f, -1.0f, 0.997508407f,
+		0.648043334f, -1.21410835f, 0.568836629f, 1.68680036f, -0.691597939f, -1.0f, 0.997508407f,
+		0.727122903f, -1.37130654f, 0.646959364f, 1.68680036f, -0.691597939f, -1.0f, 0.997508407f,
+		0.806202412f, -1.52850461f, 0.72508204f, 1.68680036f, -0.691597939f, -1.0f, 0.997508407f,
+		0.88528198f, -1.68570268f, 0.803204715f, 1.68680036f, -0.691597939f, -1.0f, 0.997508407f,
+		0.287993252f, -0.489491016f, 0.204302371f, 1.68836105f, -0.693206549f, -1.0f, 0.997553766f,
+		0.36333257f, -0.639216781f, 0.278692901f, 1.68836105f, -0.693206549f, -1.0f, 0.997553766f,
+		0.438671887f, -0.788942516f, 0.353083462f, 1.68836105f, -0.693206549f, -1.0f, 0.997553766f,
+		0.514011204f, -0.938668311f, 0.427473992f, 1.68836105f, -0.693206549f, -1.0f, 0.997553766f,
+		0.589350522f, -1.08839405f, 0.501864552f, 1.68836105f, -0.693206549f, -1.0f, 0.997553766f,
+		0.664689839f, -1.23811984f, 0.576255083f, 1.68836105f, -0.693206549f, -1.0f, 0.997553766f,
+		0.740029156f, -1.38784564f, 0.650645614f, 1.68836105f, -0.693206549f, -1.0f, 0.997553766f,
+		0.815368474f, -1.53757131f, 0.725036144f, 1.68836105f, -0.693206549f, -1.0f, 0.997553766f,
+		0.890707791f, -1.68729711f, 0.799426675f, 1.68836105f, -0.693206549f, -1.0f, 0.997553766f,
+		0.320148081f, -0.545262992f, 0.227983236f, 1.68969095f, -0.694604516f, -1.0f, 0.997598648f,
+		0.392085016f, -0.688188314f, 0.298975706f, 1.68969095f, -0.694604516f, -1.0f, 0.997598648f,
+		0.464021921f, -0.831113636f, 0.369968176f, 1.68969095f, -0.694604516f, -1.0f, 0.997598648f,
+		0.535958886f, -0.974038959f, 0.440960646f, 1.68969095f, -0.694604516f, -1.0f, 0.997598648f,
+		0.607895792f, -1.11696434f, 0.511953115f, 1.68969095f, -0.694604516f, -1.0f, 0.997598648f,
+		0.679832697f, -1.2598896f, 0.582945585f, 1.68969095f, -0.694604516f, -1.0f, 0.997598648f,
+		0.751769662f, -1.40281498f, 0.653938055f, 1.68969095f, -0.694604516f, -1.0f, 0.997598648f,
+		0.823706567f, -1.54574025f, 0.724930525f, 1.68969095f, -0.694604516f, -1.0f, 0.997598648f,
+		0.895643473f, -1.68866563f, 0.795922935f, 1.68969095f, -0.694604516f, -1.0f, 0.997598648f,
+		0.349523991f, -0.596152484f, 0.249571219f, 1.69080889f, -0.695811331f, -1.0f, 0.997642934f,
+		0.418352574f, -0.732861757f, 0.317456007f, 1.69080889f, -0.695811331f, -1.0f, 0.997642934f,
+		0.487181157f, -0.86957109f, 0.38534078f, 1.69080889f, -0.695811331f, -1.0f, 0.997642934f,
+		0.556009769f, -1.00628042f, 0.453225553f, 1.69080889f, -0.695811331f, -1.0f, 0.997642934f,
+		0.624838352f, -1.14298975f, 0.521110356f, 1.69080889f, -0.695811331f, -1.0f, 0.997642934f,
+		0.693666935f, -1.27969897f, 0.588995159f, 1.69080889f, -0.695811331f, -1.0f, 0.997642934f,
+		0.762495518f, -1.4164083f, 0.656879902f, 1.69080889f, -0.695811331f, -1.0f, 0.997642934f,
+		0.8313241f, -1.55311763f, 0.724764705f, 1.69080889f, -0.695811331f, -1.0f, 0.997642934f,
+		0.900152683f, -1.68982697f, 0.792649508f, 1.69080889f, -0.695811331f, -1.0f, 0.997642934f,
+		0.00588590838f, 0.00131630991f, -0.00456959847f, 1.67675114f, -0.680903196f, -1.0f, 0.997693181f,
+		0.111075744f, -0.208293393f, 0.0998535603f, 1.67675114f, -0.680903196f, -1.0f, 0.997693181f,
+		0.216265589f, -0.417903095f, 0.204276726f, 1.67675114f, -0.680903196f, -1.0f, 0.997693181f,
+		0.321455419f, -0.627512753f, 0.308699876f, 1.67675114f, -0.680903196f, -1.0f, 0.997693181f,
+		0.426645249f, -0.8371225f, 0.413123041f, 1.67675114f, -0.680903196f, -1.0f, 0.997693181f,
+		0.531835079f, -1.04673219f, 0.517546237f, 1.67675114f, -0.680903196f, -1.0f, 0.997693181f,
+		0.637024939f, -1.25634193f, 0.621969342f, 1.67675114f, -0.680903196f, -1.0f, 0.997693181f,
+		0.742214799f, -1.46595156f, 0.726392508f, 1.67675114f, -0.680903196f, -1.0f, 0.997693181f,
+		0.847404599f, -1.67556131f, 0.830815673f, 1.67675114f, -0.680903196f, -1.0f, 0.997693181f,
+		0.0674686506f, -0.106138356f, 0.0412585922f, 1.68020499f, -0.684240937f, -1.0f, 0.997720003f,
+		0.166142255f, -0.302745819f, 0.139195621f, 1.68020499f, -0.684240937f, -1.0f, 0.997720003f,
+		0.264815867f, -0.49935329f, 0.237132654f, 1.68020499f, -0.684240937f, -1.0f, 0.997720003f,
+		0.363489479f, -0.69596076f, 0.335069686f, 1.68020499f, -0.684240937f, -1.0f, 0.997720003f,
+		0.462163061f, -0.892568231f, 0.433006704f, 1.68020499f, -0.684240937f, -1.0f, 0.997720003f,
+		0.560836673f, -1.0891757f, 0.530943751f, 1.68020499f, -0.684240937f, -1.0f, 0.997720003f,
+		0.659510255f, -1.28578317f, 0.628880739f, 1.68020499f, -0.684240937f, -1.0f, 0.997720003f,
+		0.758183897f, -1.48239064f, 0.726817787f, 1.68020499f, -0.684240937f, -1.0f, 0.997720003f,
+		0.856857479f, -1.67899799f, 0.824754834f, 1.68020499f, -0.684240937f, -1.0f, 0.997720003f,
+		0.121866651f, -0.201034948f, 0.0817241371f, 1.68322265f, -0.687165082f, -1.0f, 0.99774754f,
+		0.214784265f, -0.386156321f, 0.173930943f, 1.68322265f, -0.687165082f, -1.0f, 0.99774754f,
+		0.307701856f, -0.571277678f, 0.266137749f, 1.68322265f, -0.687165082f, -1.0f, 0.99774754f,
+		0.400619477f, -0.756399035f, 0.358344555f, 1.68322265f, -0.687165082f, -1.0f, 0.99774754f,
+		0.493537098f, -0.941520393f, 0.450551361f, 1.68322265f, -0.687165082f, -1.0f, 0.99774754f,
+		0.58645469f, -1.12664175f, 0.542758167f, 1.68322265f, -0.687165082f, -1.0f, 0.99774754f,
+		0.679372311f, -1.31176305f, 0.634965003f, 1.68322265f, -0.687165082f, -1.0f, 0.99774754f,
+		0.772289932f, -1.49688447f, 0.727171779f, 1.68322265f, -0.687165082f, -1.0f, 0.99774754f,
+		0.865207493f, -1.68200576f, 0.819378614f, 1.68322265f, -0.687165082f, -1.0f, 0.99774754f,
+		0.17026794f, -0.285448492f, 0.117712624f, 1.68587446f, -0.689742565f, -1.0f, 0.997775674f,
+		0.258064091f, -0.460349113f, 0.204820082f, 1.68587446f, -0.689742565f, -1.0f, 0.997775674f,
+		0.345860213f, -0.635249734f, 0.291927516f, 1.68587446f, -0.689742565f, -1.0f, 0.997775674f,
+		0.433656365f, -0.810150385f, 0.379034966f, 1.68587446f, -0.689742565f, -1.0f, 0.997775674f,
+		0.521452487f, -0.985050976f, 0.466142416f, 1.68587446f, -0.689742565f, -1.0f, 0.997775674f,
+		0.609248638f, -1.15995157f, 0.553249896f, 1.68587446f, -0.689742565f, -1.0f, 0.997775674f,
+		0.69704479f, -1.33485222f, 0.640357316f, 1.68587446f, -0.689742565f, -1.0f, 0.997775674f,
+		0.784840941f, -1.50975287f, 0.727464795f, 1.68587446f, -0.689742565f, -1.0f, 0.997775674f,
+		0.872637093f, -1.68465352f, 0.814572215f, 1.68587446f, -0.689742565f, -1.0f, 0.997775674f,
+		0.213612318f, -0.361020207f, 0.149924502f, 1.68821526f, -0.692026019f, -1.0f, 0.997804403f,
+		0.296822071f, -0.526767075f, 0.232464522f, 1.68821526f, -0.692026019f, -1.0f, 0.997804403f,
+		0.380031824f, -0.692514002f, 0.315004528f, 1.68821526f, -0.692026019f, -1.0f, 0.997804403f,
+		0.463241577f, -0.85826087f, 0.397544563f, 1.68821526f, -0.692026019f, -1.0f, 0.997804403f,
+		0.54645133f, -1.0240078f, 0.480084598f, 1.68821526f, -0.692026019f, -1.0f, 0.997804403f,
+		0.629661083f, -1.18975472f, 0.562624633f, 1.68821526f, -0.692026019f, -1.0f, 0.997804403f,
+		0.712870836f, -1.35550153f, 0.645164609f, 1.68821526f, -0.692026019f, -1.0f, 0.997804403f,
+		0.796080649f, -1.52124846f, 0.727704644f, 1.68821526f, -0.692026019f, -1.0f, 0.997804403f,
+		0.879290402f, -1.68699539f, 0.810244679f, 1.68821526f, -0.692026019f, -1.0f, 0.997804403f,
+		0.252652943f, -0.429065287f, 0.178920954f, 1.69028926f, -0.694057703f, -1.0f, 0.997833431f,
+		0.331731707f, -0.586566508f, 0.257346183f, 1.69028926f, -0.694057703f, -1.0f, 0.997833431f,
+		0.410810471f, -0.744067669f, 0.335771441f, 1.69028926f, -0.694057703f, -1.0f, 0.997833431f,
+		0.489889234f, -0.90156889f, 0.41419667f, 1.69028926f, -0.694057703f, -1.0f, 0.997833431f,
+		0.568967998f, -1.05907011f, 0.492621899f, 1.69028926f, -0.694057703f, -1.0f, 0.997833431f,
+		0.648046792f, -1.21657121f, 0.571047127f, 1.69028926f, -0.694057703f, -1.0f, 0.997833431f,
+		0.727125525f, -1.37407243f, 0.649472415f, 1.69028926f, -0.694057703f, -1.0f, 0.997833431f,
+		0.806204319f, -1.53157365f, 0.727897644f, 1.69028926f, -0.694057703f, -1.0f, 0.997833431f,
+		0.885283053f, -1.68907475f, 0.806322873f, 1.69028926f, -0.694057703f, -1.0f, 0.997833431f,
+		0.288000494f, -0.490649909f, 0.205156922f, 1.69213176f, -0.695871472f, -1.0f, 0.997862816f,
+		0.363339037f, -0.640684485f, 0.279855728f, 1.69213176f, -0.695871472f, -1.0f, 0.997862816f,
+		0.438677579f, -0.790719092f, 0.354554534f, 1.69213176f, -0.695871472f, -1.0f, 0.997862816f,
+		0.514016151f, -0.940753698f, 0.42925334f, 1.69213176f, -0.695871472f, -1.0f, 0.997862816f,
+		0.589354694f, -1.09078825f, 0.503952146f, 1.69213176f, -0.695871472f, -1.0f, 0.997862816f,
+		0.664693236f, -1.24082291f, 0.578650951f, 1.69213176f, -0.695871472f, -1.0f, 0.997862816f,
+		0.740031779f, -1.39085746f, 0.653349757f, 1.69213176f, -0.695871472f, -1.0f, 0.997862816f,
+		0.815370321f, -1.54089212f, 0.728048563f, 1.69213176f, -0.695871472f, -1.0f, 0.997862816f,
+		0.890708864f, -1.69092667f, 0.802747309f, 1.69213176f, -0.695871472f, -1.0f, 0.997862816f,
+		0.320155293f, -0.546647429f, 0.229004964f, 1.69377184f, -0.697495103f, -1.0f, 0.99789232f,
+		0.392091483f, -0.689888895f, 0.300312996f, 1.69377184f, -0.697495103f, -1.0f, 0.99789232f,
+		0.464027643f, -0.833130419f, 0.371621013f, 1.69377184f, -0.697495103f, -1.0f, 0.99789232f,
+		0.535963774f, -0.976371884f, 0.442929059f, 1.69377184f, -0.697495103f, -1.0f, 0.99789232f,
+		0.607899964f, -1.11961341f, 0.514237046f, 1.69377184f, -0.697495103f, -1.0f, 0.99789232f,
+		0.679836094f, -1.26285481f, 0.585545123f, 1.69377184f, -0.697495103f, -1.0f, 0.99789232f,
+		0.751772285f, -1.40609634f, 0.656853139f, 1.69377184f, -0.697495103f, -1.0f, 0.99789232f,
+		0.823708415f, -1.54933786f, 0.728161156f, 1.69377184f, -0.697495103f, -1.0f, 0.99789232f,
+		0.895644605f, -1.69257927f, 0.799469173f, 1.69377184f, -0.697495103f, -1.0f, 0.99789232f,
+		0.349531263f, -0.597780049f, 0.250773132f, 1.69523275f, -0.698951125f, -1.0f, 0.997921944f,
+		0.418359101f, -0.734814525f, 0.318982452f, 1.69523275f, -0.698951125f, -1.0f, 0.997921944f,
+		0.487186909f, -0.871849f, 0.387191772f, 1.69523275f, -0.698951125f, -1.0f, 0.997921944f,
+		0.556014717f, -1.00888348f, 0.455401093f, 1.69523275f, -0.698951125f, -1.0f, 0.997921944f,
+		0.624842525f, -1.14591801f, 0.523610413f, 1.69523275f, -0.698951125f, -1.0f, 0.997921944f,
+		0.693670332f, -1.28295243f, 0.591819704f, 1.69523275f, -0.698951125f, -1.0f, 0.997921944f,
+		0.76249814f, -1.41998684f, 0.660029054f, 1.69523275f, -0.698951125f, -1.0f, 0.997921944f,
+		0.831325948f, -1.55702138f, 0.728238344f, 1.69523275f, -0.698951125f, -1.0f, 0.997921944f,
+		0.900153756f, -1.6940558f, 0.796447694f, 1.69523275f, -0.698951125f, -1.0f, 0.997921944f,
+		0.00589233264f, 0.00131774659f, -0.00457458617f, 1.67846119f, -0.682088614f, -1.0f, 0.998150468f,
+		0.111081488f, -0.208521232f, 0.10007754f, 1.67846119f, -0.682088614f, -1.0f, 0.998150468f,
+		0.216270655f, -0.418360204f, 0.204729661f, 1.67846119f, -0.682088614f, -1.0f, 0.998150468f,
+		0.3214598f, -0.62819916f, 0.309381783f, 1.67846119f, -0.682088614f, -1.0f, 0.998150468f,
+		0.426648974f, -0.838038146f, 0.41403392f, 1.67846119f, -0.682088614f, -1.0f, 0.998150468f,
+		0.531838119f, -1.04787707f, 0.518686056f, 1.67846119f, -0.682088614f, -1.0f, 0.998150468f,
+		0.637027264f, -1.25771606f, 0.623338163f, 1.67846119f, -0.682088614f, -1.0f, 0.998150468f,
+		0.742216408f, -1.46755505f, 0.727990329f, 1.67846119f, -0.682088614f, -1.0f, 0.998150468f,
+		0.847405612f, -1.67739403f, 0.832642436f, 1.67846119f, -0.682088614f, -1.0f, 0.998150468f,
+		0.067474708f, -0.106277309f, 0.041357886f, 1.68201935f, -0.685504079f, -1.0f, 0.998163581f,
+		0.166147664f, -0.303108811f, 0.139518619f, 1.68201935f, -0.685504079f, -1.0f, 0.998163581f,
+		0.264820635f, -0.499940276f, 0.237679347f, 1.68201935f, -0.685504079f, -1.0f, 0.998163581f,
+		0.363493592f, -0.696771801f, 0.335840076f, 1.68201935f, -0.685504079f, -1.0f, 0.998163581f,
+		0.462166548f, -0.893603265f, 0.43400079f, 1.68201935f, -0.685504079f, -1.0f, 0.998163581f,
+		0.560839534f, -1.09043479f, 0.532161534f, 1.68201935f, -0.685504079f, -1.0f, 0.998163581f,
+		0.65951252f, -1.28726625f, 0.630322278f, 1.68201935f, -0.685504079f, -1.0f, 0.998163581f,
+		0.758185446f, -1.48409772f, 0.728482962f, 1.68201935f, -0.685504079f, -1.0f, 0.998163581f,
+		0.856858432f, -1.68092918f, 0.826643705f, 1.68201935f, -0.685504079f, -1.0f, 0.998163581f,
+		0.121872395f, -0.201309144f, 0.0819238499f, 1.68514729f, -0.68851006f, -1.0f, 0.99817729f,
+		0.214789391f, -0.386650443f, 0.174350247f, 1.68514729f, -0.68851006f, -1.0f, 0.99817729f,
+		0.307706386f, -0.571991742f, 0.266776651f, 1.68514729f, -0.68851006f, -1.0f, 0.99817729f,
+		0.400623411f, -0.757332981f, 0.359203041f, 1.68514729f, -0.68851006f, -1.0f, 0.99817729f,
+		0.493540406f, -0.942674279f, 0.45162943f, 1.68514729f, -0.68851006f, -1.0f, 0.99817729f,
+		0.586457372f, -1.12801552f, 0.54405582f, 1.68514729f, -0.68851006f, -1.0f, 0.99817729f,
+		0.679374397f, -1.31335688f, 0.636482239f, 1.68514729f, -0.68851006f, -1.0f, 0.99817729f,
+		0.772291422f, -1.49869812f, 0.728908598f, 1.68514729f, -0.68851006f, -1.0f, 0.99817729f,
+		0.865208387f, -1.68403935f, 0.821335018f, 1.68514729f, -0.68851006f, -1.0f, 0.99817729f,
+		0.170273438f, -0.285854667f, 0.11801032f, 1.68791556f, -0.691173732f, -1.0f, 0.998191595f,
+		0.258069009f, -0.4609721f, 0.205334246f, 1.68791556f, -0.691173732f, -1.0f, 0.998191595f,
+		0.345864564f, -0.636089563f, 0.29265818f, 1.68791556f, -0.691173732f, -1.0f, 0.998191595f,
+		0.43366012f, -0.811206996f, 0.379982084f, 1.68791556f, -0.691173732f, -1.0f, 0.998191595f,
+		0.521455646f, -0.986324489f, 0.467306018f, 1.68791556f, -0.691173732f, -1.0f, 0.998191595f,
+		0.609251261f, -1.16144192f, 0.554629922f, 1.68791556f, -0.691173732f, -1.0f, 0.998191595f,
+		0.697046816f, -1.33655941f, 0.641953886f, 1.68791556f, -0.691173732f, -1.0f, 0.998191595f,
+		0.784842372f, -1.51167679f, 0.72927779f, 1.68791556f, -0.691173732f, -1.0f, 0.998191595f,
+		0.872637928f, -1.68679428f, 0.816601694f, 1.68791556f, -0.691173732f, -1.0f, 0.998191595f,
+		0.213617608f, -0.361556709f, 0.150318921f, 1.69037986f, -0.693548322f, -1.0f, 0.998206317f,
+		0.29682681f, -0.527518213f, 0.233073205f, 1.69037986f, -0.693548322f, -1.0f, 0.998206317f,
+		0.380035996f, -0.693479776f, 0.315827489f, 1.69037986f, -0.693548322f, -1.0f, 0.998206317f,
+		0.463245183f, -0.85944128f, 0.398581773f, 1.69037986f, -0.693548322f, -1.0f, 0.998206317f,
+		0.54645437f, -1.02540278f, 0.481336057f, 1.69037986f, -0.693548322f, -1.0f, 0.998206317f,
+		0.629663587f, -1.19136429f, 0.564090312f, 1.69037986f, -0.693548322f, -1.0f, 0.998206317f,
+		0.712872803f, -1.35732591f, 0.646844625f, 1.69037986f, -0.693548322f, -1.0f, 0.998206317f,
+		0.79608202f, -1.52328742f, 0.72959888f, 1.69037986f, -0.693548322f, -1.0f, 0.998206317f,
+		0.879291177f, -1.68924892f, 0.812353194f, 1.69037986f, -0.693548322f, -1.0f, 0.998206317f,
+		0.252658069f, -0.429731905f, 0.179411918f, 1.69258463f, -0.695676267f, -1.0f, 0.998221517f,
+		0.331736267f, -0.587446332f, 0.258050025f, 1.69258463f, -0.695676267f, -1.0f, 0.998221517f,
+		0.410814494f, -0.745160758f, 0.336688131f, 1.69258463f, -0.695676267f, -1.0f, 0.998221517f,
+		0.489892721f, -0.902875185f, 0.415326208f, 1.69258463f, -0.695676267f, -1.0f, 0.998221517f,
+		0.568970978f, -1.06058967f, 0.493964314f, 1.69258463f, -0.695676267f, -1.0f, 0.998221517f,
+		0.648049176f, -1.21830404f, 0.572602391f, 1.69258463f, -0.695676267f, -1.0f, 0.998221517f,
+		0.727127433f, -1.37601852f, 0.651240528f, 1.69258463f, -0.695676267f, -1.0f, 0.998221517f,
+		0.80620563f, -1.53373289f, 0.729878604f, 1.69258463f, -0.695676267f, -1.0f, 0.998221517f,
+		0.885283828f, -1.69144738f, 0.808516741f, 1.69258463f, -0.695676267f, -1.0f, 0.998221517f,
+		0.288005471f, -0.491447717f, 0.205745205f, 1.69456601f, -0.697592199f, -1.0f, 0.998237133f,
+		0.363343477f, -0.641694903f, 0.280656219f, 1.69456601f, -0.697592199f, -1.0f, 0.998237133f,
+		0.438681513f, -0.79194212f, 0.355567247f, 1.69456601f, -0.697592199f, -1.0f, 0.998237133f,
+		0.514019549f, -0.942189276f, 0.430478245f, 1.69456601f, -0.697592199f, -1.0f, 0.998237133f,
+		0.589357555f, -1.09243655f, 0.505389273f, 1.69456601f, -0.697592199f, -1.0f, 0.998237133f,
+		0.664695561f, -1.24268365f, 0.580300272f, 1.69456601f, -0.697592199f, -1.0f, 0.998237133f,
+		0.740033567f, -1.39293087f, 0.65521127f, 1.69456601f, -0.697592199f, -1.0f, 0.998237133f,
+		0.815371633f, -1.54317808f, 0.730122328f, 1.69456601f, -0.697592199f, -1.0f, 0.998237133f,
+		0.890709639f, -1.6934253f, 0.805033326f, 1.69456601f, -0.697592199f, -1.0f, 0.998237133f,
+		0.32016018f, -0.547578692f, 0.22969225f, 1.69635367f, -0.699324131f, -1.0f, 0.998253107f,
+		0.392095804f, -0.691032887f, 0.301212549f, 1.69635367f, -0.699324131f, -1.0f, 0.998253107f,
+		0.464031458f, -0.834487021f, 0.372732848f, 1.69635367f, -0.699324131f, -1.0f, 0.998253107f,
+		0.535967112f, -0.977941155f, 0.444253147f, 1.69635367f, -0.699324131f, -1.0f, 0.998253107f,
+		0.607902765f, -1.12139535f, 0.515773416f, 1.69635367f, -0.699324131f, -1.0f, 0.998253107f,
+		0.679838419f, -1.26484954f, 0.587293744f, 1.69635367f, -0.699324131f, -1.0f, 0.998253107f,
+		0.751774073f, -1.40830362f, 0.658814013f, 1.69635367f, -0.699324131f, -1.0f, 0.998253107f,
+		0.823709726f, -1.55175781f, 0.730334342f, 1.69635367f, -0.699324131f, -1.0f, 0.998253107f,
+		0.89564538f, -1.69521201f, 0.80185461f, 1.69635367f, -0.699324131f, -1.0f, 0.998253107f,
+		0.349536061f, -0.598848283f, 0.25156197f, 1.69797206f, -0.700895548f, -1.0f, 0.998269439f,
+		0.418363363f, -0.736096203f, 0.319984317f, 1.69797206f, -0.700895548f, -1.0f, 0.998269439f,
+		0.487190664f, -0.873344123f, 0.388406634f, 1.69797206f, -0.700895548f, -1.0f, 0.998269439f,
+		0.556017995f, -1.01059198f, 0.456828952f, 1.69797206f, -0.700895548f, -1.0f, 0.998269439f,
+		0.624845266f, -1.1478399f, 0.525251269f, 1.69797206f, -0.700895548f, -1.0f, 0.998269439f,
+		0.693672597f, -1.28508782f, 0.593673646f, 1.69797206f, -0.700895548f, -1.0f, 0.998269439f,
+		0.762499928f, -1.42233562f, 0.662095964f, 1.69797206f, -0.700895548f, -1.0f, 0.998269439f,
+		0.8313272f, -1.55958354f, 0.730518281f, 1.69797206f, -0.700895548f, -1.0f, 0.998269439f,
+		0.900154531f, -1.69683146f, 0.798940599f, 1.69797206f, -0.700895548f, -1.0f, 0.998269439f,
+		0.00589705305f, 0.00131880224f, -0.00457825093f, 1.6796087f, -0.682884455f, -1.0f, 0.998595357f,
+		0.111085713f, -0.208688632f, 0.100242116f, 1.6796087f, -0.682884455f, -1.0f, 0.998595357f,
+		0.216274366f, -0.418696076f, 0.205062479f, 1.6796087f, -0.682884455f, -1.0f, 0.998595357f,
+		0.321463019f, -0.628703535f, 0.309882849f, 1.6796087f, -0.682884455f, -1.0f, 0.998595357f,
+		0.426651686f, -0.838710964f, 0.41470322f, 1.6796087f, -0.682884455f, -1.0f, 0.998595357f,
+		0.531840324f, -1.04871833f, 0.519523561f, 1.6796087f, -0.682884455f, -1.0f, 0.998595357f,
+		0.637028992f, -1.25872588f, 0.624343932f, 1.6796087f, -0.682884455f, -1.0f, 0.998595357f,
+		0.74221766f, -1.46873331f, 0.729164302f, 1.6796087f, -0.682884455f, -1.0f, 0.998595357f,
+		0.847406328f, -1.67874074f, 0.833984673f, 1.6796087f, -0.682884455f, -1.0f, 0.998595357f,
+		0.0674790964f, -0.106378146f, 0.0414299369f, 1.68322062f, -0.686340749f, -1.0f, 0.998600781f,
+		0.166151598f, -0.303372204f, 0.139752999f, 1.68322062f, -0.686340749f, -1.0f, 0.998600781f,
+		0.264824092f, -0.500366271f, 0.238076061f, 1.68322062f, -0.686340749f, -1.0f, 0.998600781f,
+		0.363496602f, -0.697360277f, 0.336399108f, 1.68322062f, -0.686340749f, -1.0f, 0.998600781f,
+		0.462169081f, -0.894354343f, 0.434722155f, 1.68322062f, -0.686340749f, -1.0f, 0.998600781f,
+		0.56084162f, -1.09134841f, 0.533045232f, 1.68322062f, -0.686340749f, -1.0f, 0.998600781f,
+		0.65951407f, -1.28834248f, 0.631368279f, 1.68322062f, -0.686340749f, -1.0f, 0.998600781f,
+		0.758186579f, -1.48533654f, 0.729691327f, 1.68322062f, -0.686340749f, -1.0f, 0.998600781f,
+		0.856859088f, -1.68233061f, 0.828014374f, 1.68322062f, -0.686340749f, -1.0f, 0.998600781f,
+		0.121876508f, -0.201505557f, 0.0820669159f, 1.68640459f, -0.68938899f, -1.0f, 0.998606503f,
+		0.214793071f, -0.387004375f, 0.174650609f, 1.68640459f, -0.68938899f, -1.0f, 0.998606503f,
+		0.307709634f, -0.572503209f, 0.267234296f, 1.68640459f, -0.68938899f, -1.0f, 0.998606503f,
+		0.400626212f, -0.758002043f, 0.359817982f, 1.68640459f, -0.68938899f, -1.0f, 0.998606503f,
+		0.493542761f, -0.943500817f, 0.452401668f, 1.68640459f, -0.68938899f, -1.0f, 0.998606503f,
+		0.586459339f, -1.12899971f, 0.544985354f, 1.68640459f, -0.68938899f, -1.0f, 0.998606503f,
+		0.679375887f, -1.31449854f, 0.63756907f, 1.68640459f, -0.68938899f, -1.0f, 0.998606503f,
+		0.772292495f, -1.49999726f, 0.730152726f, 1.68640459f, -0.68938899f, -1.0f, 0.998606503f,
+		0.865209043f, -1.68549609f, 0.822736442f, 1.68640459f, -0.68938899f, -1.0f, 0.998606503f,
+		0.170277312f, -0.286141723f, 0.118220717f, 1.68923128f, -0.692096531f, -1.0f, 0.998612523f,
+		0.258072466f, -0.46141243f, 0.205697641f, 1.68923128f, -0.692096531f, -1.0f, 0.998612523f,
+		0.345867604f, -0.636683166f, 0.293174565f, 1.68923128f, -0.692096531f, -1.0f, 0.998612523f,
+		0.433662772f, -0.811953843f, 0.380651504f, 1.68923128f, -0.692096531f, -1.0f, 0.998612523f,
+		0.521457911f, -0.987224519f, 0.468128413f, 1.68923128f, -0.692096531f, -1.0f, 0.998612523f,
+		0.609253049f, -1.16249526f, 0.555605352f, 1.68923128f, -0.692096531f, -1.0f, 0.998612523f,
+		0.697048187f, -1.33776593f, 0.643082261f, 1.68923128f, -0.692096531f, -1.0f, 0.998612523f,
+		0.784843385f, -1.51303661f, 0.73055917f, 1.68923128f, -0.692096531f, -1.0f, 0.998612523f,
+		0.872638524f, -1.6883074f, 0.818036139f, 1.68923128f, -0.692096531f, -1.0f, 0.998612523f,
+		0.213621289f, -0.361930668f, 0.150593832f, 1.69175625f, -0.694516599f, -1.0f, 0.998618782f,
+		0.296830088f, -0.52804178f, 0.233497456f, 1.69175625f, -0.694516599f, -1.0f, 0.998618782f,
+		0.380038887f, -0.694152892f, 0.316401064f, 1.69175625f, -0.694516599f, -1.0f, 0.998618782f,
+		0.463247716f, -0.860264003f, 0.399304718f, 1.69175625f, -0.694516599f, -1.0f, 0.998618782f,
+		0.546456516f, -1.02637517f, 0.482208341f, 1.69175625f, -0.694516599f, -1.0f, 0.998618782f,
+		0.629665315f, -1.19248629f, 0.565111935f, 1.69175625f, -0.694516599f, -1.0f, 0.998618782f,
+		0.712874115f, -1.3585974f, 0.648015559f, 1.69175625f, -0.694516599f, -1.0f, 0.998618782f,
+		0.796082973f, -1.52470851f, 0.730919182f, 1.69175625f, -0.694516599f, -1.0f, 0.998618782f,
+		0.879291773f, -1.69081962f, 0.813822806f, 1.69175625f, -0.694516599f, -1.0f, 0.998618782f,
+		0.252661556f, -0.430189878f, 0.179749206f, 1.69402432f, -0.696691811f, -1.0f, 0.998625338f,
+		0.331739426f, -0.588050783f, 0.258533537f, 1.69402432f, -0.696691811f, -1.0f, 0.998625338f,
+		0.410817266f, -0.745911717f, 0.337317884f, 1.69402432f, -0.696691811f, -1.0f, 0.998625338f,
+		0.489895135f, -0.903772652f, 0.416102201f, 1.69402432f, -0.696691811f, -1.0f, 0.998625338f,
+		0.568973005f, -1.06163359f, 0.494886547f, 1.69402432f, -0.696691811f, -1.0f, 0.998625338f,
+		0.648050845f, -1.21949446f, 0.573670864f, 1.69402432f, -0.696691811f, -1.0f, 0.998625338f,
+		0.727128685f, -1.37735546f, 0.652455211f, 1.69402432f, -0.696691811f, -1.0f, 0.998625338f,
+		0.806206524f, -1.53521633f, 0.731239557f, 1.69402432f, -0.696691811f, -1.0f, 0.998625338f,
+		0.885284424f, -1.69307721f, 0.810023844f, 1.69402432f, -0.696691811f, -1.0f, 0.998625338f,
+		0.288008839f, -0.491987616f, 0.20614332f, 1.69607174f, -0.698656738f, -1.0f, 0.998632133f,
+		0.363346487f, -0.642378688f, 0.281197935f, 1.69607174f, -0.698656738f, -1.0f, 0.998632133f,
+		0.438684165f, -0.79276973f, 0.356252551f, 1.69607174f, -0.698656738f, -1.0f, 0.998632133f,
+		0.514021814f, -0.943160832f, 0.431307197f, 1.69607174f, -0.698656738f, -1.0f, 0.998632133f,
+		0.589359522f, -1.09355187f, 0.506361842f, 1.69607174f, -0.698656738f, -1.0f, 0.998632133f,
+		0.66469717f, -1.24394298f, 0.581416428f, 1.69607174f, -0.698656738f, -1.0f, 0.998632133f,
+		0.740034819f, -1.39433408f, 0.656471074f, 1.69607174f, -0.698656738f, -1.0f, 0.998632133f,
+		0.815372467f, -1.54472506f, 0.731525719f, 1.69607174f, -0.698656738f, -1.0f, 0.998632133f,
+		0.890710175f, -1.69511616f, 0.806580305f, 1.69607174f, -0.698656738f, -1.0f, 0.998632133f,
+		0.320163399f, -0.548199177f, 0.230150148f, 1.69792819f, -0.700439811f, -1.0f, 0.998639166f,
+		0.392098725f, -0.691794991f, 0.301811844f, 1.69792819f, -0.700439811f, -1.0f, 0.998639166f,
+		0.464034021f, -0.835390866f, 0.373473585f, 1.69792819f, -0.700439811f, -1.0f, 0.998639166f,
+		0.535969317f, -0.978986681f, 0.445135295f, 1.69792819f, -0.700439811f, -1.0f, 0.998639166f,
+		0.607904613f, -1.12258255f, 0.516797006f, 1.69792819f, -0.700439811f, -1.0f, 0.998639166f,
+		0.679839909f, -1.26617837f, 0.588458717f, 1.69792819f, -0.700439811f, -1.0f, 0.998639166f,
+		0.751775265f, -1.40977418f, 0.660120428f, 1.69792819f, -0.700439811f, -1.0f, 0.998639166f,
+		0.823710561f, -1.55337012f, 0.731782138f, 1.69792819f, -0.700439811f, -1.0f, 0.998639166f,
+		0.895645857f, -1.69696593f, 0.803443849f, 1.69792819f, -0.700439811f, -1.0f, 0.998639166f,
+		0.349539191f, -0.599548519f, 0.25207904f, 1.69961822f, -0.702064335f, -1.0f, 0.998646438f,
+		0.418366164f, -0.736936271f, 0.320640981f, 1.69961822f, -0.702064335f, -1.0f, 0.998646438f,
+		0.487193137f, -0.874324083f, 0.389202923f, 1.69961822f, -0.702064335f, -1.0f, 0.998646438f,
+		0.556020141f, -1.01171184f, 0.457764864f, 1.69961822f, -0.702064335f, -1.0f, 0.998646438f,
+		0.624847114f, -1.14909959f, 0.526326835f, 1.69961822f, -0.702064335f, -1.0f, 0.998646438f,
+		0.693674088f, -1.28648734f, 0.594888747f, 1.69961822f, -0.702064335f, -1.0f, 0.998646438f,
+		0.762501061f, -1.42387521f, 0.663450718f, 1.69961822f, -0.702064335f, -1.0f, 0.998646438f,
+		0.831328034f, -1.56126297f, 0.73201263f, 1.69961822f, -0.702064335f, -1.0f, 0.998646438f,
+		0.900155008f, -1.69865072f, 0.800574601f, 1.69961822f, -0.702064335f, -1.0f, 0.998646438f,
+	},
+	// AC30
+	{
+		0.00582010718f, 0.00185291388f, -0.00396719342f, 1.57730997f, -0.596451104f, -1.0f, 0.995411456f,
+		0.107129201f, -0.19603996f, 0.0926408023f, 1.57730997f, -0.596451104f, -1.0f, 0.995411456f,
+		0.208438292f, -0.393932819f, 0.189248785f, 1.57730997f, -0.596451104f, -1.0f, 0.995411456f,
+		0.309747398f, -0.591825664f, 0.285856783f, 1.57730997f, -0.596451104f, -1.0f, 0.995411456f,
+		0.411056489f, -0.789718568f, 0.382464767f, 1.57730997f, -0.596451104f, -1.0f, 0.995411456f,
+		0.51236558f, -0.987611413f, 0.479072779f, 1.57730997f, -0.596451104f, -1.0f, 0.995411456f,
+		0.613674641f, -1.18550432f, 0.575680792f, 1.57730997f, -0.596451104f, -1.0f, 0.995411456f,
+		0.714983761f, -1.38339722f, 0.672288775f, 1.57730997f, -0.596451104f, -1.0f, 0.995411456f,
+		0.816292882f, -1.58129001f, 0.768896759f, 1.57730997f, -0.596451104f, -1.0f, 0.995411456f,
+		0.0190053172f, -0.0195306223f, 0.00439608749f, 1.57645071f, -0.596033752f, -1.0f, 0.995446324f,
+		0.118970811f, -0.214663908f, 0.0995884687f, 1.57645071f, -0.596033752f, -1.0f, 0.995446324f,
+		0.218936294f, -0.409797192f, 0.194780841f, 1.57645071f, -0.596033752f, -1.0f, 0.995446324f,
+		0.318901807f, -0.60493046f, 0.289973229f, 1.57645071f, -0.596033752f, -1.0f, 0.995446324f,
+		0.41886729f, -0.800063729f, 0.385165602f, 1.57645071f, -0.596033752f, -1.0f, 0.995446324f,
+		0.518832803f, -0.995197058f, 0.480357975f, 1.57645071f, -0.596033752f, -1.0f, 0.995446324f,
+		0.618798256f, -1.19033027f, 0.575550377f, 1.57645071f, -0.596033752f, -1.0f, 0.995446324f,
+		0.718763769f, -1.3854636f, 0.67074275f, 1.57645071f, -0.596033752f, -1.0f, 0.995446324f,
+		0.818729222f, -1.58059692f, 0.765935123f, 1.57645071f, -0.596033752f, -1.0f, 0.995446324f,
+		0.0318450965f, -0.0403171033f, 0.0125160366f, 1.57549858f, -0.595553577f, -1.0f, 0.995480776f,
+		0.130502179f, -0.232755139f, 0.106321976f, 1.57549858f, -0.595553577f, -1.0f, 0.995480776f,
+		0.229159281f, -0.425193191f, 0.200127915f, 1.57549858f, -0.595553577f, -1.0f, 0.995480776f,
+		0.327816367f, -0.617631197f, 0.293933868f, 1.57549858f, -0.595553577f, -1.0f, 0.995480776f,
+		0.426473469f, -0.810069263f, 0.387739807f, 1.57549858f, -0.595553577f, -1.0f, 0.995480776f,
+		0.52513057f, -1.00250733f, 0.481545746f, 1.57549858f, -0.595553577f, -1.0f, 0.995480776f,
+		0.623787642f, -1.19494534f, 0.575351655f, 1.57549858f, -0.595553577f, -1.0f, 0.995480776f,
+		0.722444713f, -1.38738334f, 0.669157624f, 1.57549858f, -0.595553577f, -1.0f, 0.995480776f,
+		0.821101844f, -1.57982147f, 0.762963533f, 1.57549858f, -0.595553577f, -1.0f, 0.995480776f,
+		0.0443528146f, -0.0605262965f, 0.0203998704f, 1.57444668f, -0.595006287f, -1.0f, 0.99551487f,
+		0.141735345f, -0.25033021f, 0.112846695f, 1.57444668f, -0.595006287f, -1.0f, 0.99551487f,
+		0.239117861f, -0.440134138f, 0.205293521f, 1.57444668f, -0.595006287f, -1.0f, 0.99551487f,
+		0.336500406f, -0.629938066f, 0.29774034f, 1.57444668f, -0.595006287f, -1.0f, 0.99551487f,
+		0.433882922f, -0.819742024f, 0.390187174f, 1.57444668f, -0.595006287f, -1.0f, 0.99551487f,
+		0.531265438f, -1.00954592f, 0.482634008f, 1.57444668f, -0.595006287f, -1.0f, 0.99551487f,
+		0.628647983f, -1.19934988f, 0.575080812f, 1.57444668f, -0.595006287f, -1.0f, 0.99551487f,
+		0.726030529f, -1.38915372f, 0.667527616f, 1.57444668f, -0.595006287f, -1.0f, 0.99551487f,
+		0.823413014f, -1.57895768f, 0.75997448f, 1.57444668f, -0.595006287f, -1.0f, 0.99551487f,
+		0.0565411635f, -0.0801765323f, 0.028054161f, 1.57328713f, -0.594386995f, -1.0f, 0.995548546f,
+		0.152681664f, -0.267404318f, 0.11916735f, 1.57328713f, -0.594386995f, -1.0f, 0.995548546f,
+		0.248822182f, -0.454632133f, 0.210280538f, 1.57328713f, -0.594386995f, -1.0f, 0.995548546f,
+		0.344962686f, -0.641859949f, 0.301393718f, 1.57328713f, -0.594386995f, -1.0f, 0.995548546f,
+		0.44110319f, -0.829087734f, 0.392506897f, 1.57328713f, -0.594386995f, -1.0f, 0.995548546f,
+		0.537243724f, -1.01631546f, 0.483620107f, 1.57328713f, -0.594386995f, -1.0f, 0.995548546f,
+		0.633384228f, -1.20354331f, 0.574733257f, 1.57328713f, -0.594386995f, -1.0f, 0.995548546f,
+		0.729524732f, -1.39077115f, 0.665846467f, 1.57328713f, -0.594386995f, -1.0f, 0.995548546f,
+		0.825665236f, -1.57799888f, 0.756959677f, 1.57328713f, -0.594386995f, -1.0f, 0.995548546f,
+		0.0684221908f, -0.0992847309f, 0.0354848281f, 1.57201123f, -0.593690097f, -1.0f, 0.995581865f,
+		0.163351998f, -0.283991307f, 0.125287995f, 1.57201123f, -0.593690097f, -1.0f, 0.995581865f,
+		0.258281797f, -0.468697876f, 0.215091169f, 1.57201123f, -0.593690097f, -1.0f, 0.995581865f,
+		0.353211612f, -0.653404415f, 0.304894358f, 1.57201123f, -0.593690097f, -1.0f, 0.995581865f,
+		0.448141396f, -0.838110983f, 0.394697517f, 1.57201123f, -0.593690097f, -1.0f, 0.995581865f,
+		0.54307121f, -1.02281761f, 0.484500676f, 1.57201123f, -0.593690097f, -1.0f, 0.995581865f,
+		0.638001025f, -1.20752418f, 0.574303865f, 1.57201123f, -0.593690097f, -1.0f, 0.995581865f,
+		0.732930839f, -1.39223075f, 0.664107025f, 1.57201123f, -0.593690097f, -1.0f, 0.995581865f,
+		0.827860653f, -1.57693732f, 0.753910184f, 1.57201123f, -0.593690097f, -1.0f, 0.995581865f,
+		0.0800073445f, -0.117866412f, 0.0426971242f, 1.5706085f, -0.592909276f, -1.0f, 0.995614827f,
+		0.173756599f, -0.300103605f, 0.131212026f, 1.5706085f, -0.592909276f, -1.0f, 0.995614827f,
+		0.267505854f, -0.482340783f, 0.21972692f, 1.5706085f, -0.592909276f, -1.0f, 0.995614827f,
+		0.361255109f, -0.664577961f, 0.308241814f, 1.5706085f, -0.592909276f, -1.0f, 0.995614827f,
+		0.455004364f, -0.846815169f, 0.396756709f, 1.5706085f, -0.592909276f, -1.0f, 0.995614827f,
+		0.548753619f, -1.02905238f, 0.485271603f, 1.5706085f, -0.592909276f, -1.0f, 0.995614827f,
+		0.642502844f, -1.21128953f, 0.573786497f, 1.5706085f, -0.592909276f, -1.0f, 0.995614827f,
+		0.736252129f, -1.39352667f, 0.662301421f, 1.5706085f, -0.592909276f, -1.0f, 0.995614827f,
+		0.830001354f, -1.57576394f, 0.750816286f, 1.5706085f, -0.592909276f, -1.0f, 0.995614827f,
+		0.0913074985f, -0.135935679f, 0.0496956296f, 1.56906748f, -0.592037141f, -1.0f, 0.99564743f,
+		0.183905244f, -0.315752298f, 0.136942059f, 1.56906748f, -0.592037141f, -1.0f, 0.99564743f,
+		0.276502997f, -0.495568901f, 0.224188492f, 1.56906748f, -0.592037141f, -1.0f, 0.99564743f,
+		0.36910072f, -0.675385475f, 0.311434925f, 1.56906748f, -0.592037141f, -1.0f, 0.99564743f,
+		0.461698472f, -0.855202079f, 0.398681372f, 1.56906748f, -0.592037141f, -1.0f, 0.99564743f,
+		0.554296196f, -1.03501868f, 0.48592779f, 1.56906748f, -0.592037141f, -1.0f, 0.99564743f,
+		0.646893978f, -1.21483529f, 0.573174238f, 1.56906748f, -0.592037141f, -1.0f, 0.99564743f,
+		0.739491701f, -1.39465189f, 0.660420656f, 1.56906748f, -0.592037141f, -1.0f, 0.99564743f,
+		0.832089424f, -1.57446849f, 0.747667074f, 1.56906748f, -0.592037141f, -1.0f, 0.99564743f,
+		0.102333009f, -0.153505176f, 0.0564841852f, 1.56737435f, -0.591065049f, -1.0f, 0.995679617f,
+		0.193807229f, -0.330946952f, 0.142479971f, 1.56737435f, -0.591065049f, -1.0f, 0.995679617f,
+		0.28528145f, -0.508388758f, 0.228475749f, 1.56737435f, -0.591065049f, -1.0f, 0.995679617f,
+		0.376755655f, -0.685830534f, 0.314471543f, 1.56737435f, -0.591065049f, -1.0f, 0.995679617f,
+		0.46822989f, -0.863272309f, 0.400467306f, 1.56737435f, -0.591065049f, -1.0f, 0.995679617f,
+		0.559704125f, -1.04071403f, 0.4864631f, 1.56737435f, -0.591065049f, -1.0f, 0.995679617f,
+		0.6511783f, -1.21815586f, 0.572458863f, 1.56737435f, -0.591065049f, -1.0f, 0.995679617f,
+		0.742652535f, -1.39559758f, 0.658454657f, 1.56737435f, -0.591065049f, -1.0f, 0.995679617f,
+		0.83412677f, -1.57303941f, 0.74445045f, 1.56737435f, -0.591065049f, -1.0f, 0.995679617f,
+		0.00585933775f, 0.00186540338f, -0.00399393402f, 1.59022081f, -0.604587555f, -1.0f, 0.995627224f,
+		0.107164435f, -0.197364897f, 0.0939485878f, 1.59022081f, -0.604587555f, -1.0f, 0.995627224f,
+		0.208469525f, -0.39659518f, 0.191891104f, 1.59022081f, -0.604587555f, -1.0f, 0.995627224f,
+		0.309774637f, -0.595825493f, 0.289833635f, 1.59022081f, -0.604587555f, -1.0f, 0.995627224f,
+		0.411079705f, -0.795055747f, 0.387776166f, 1.59022081f, -0.604587555f, -1.0f, 0.995627224f,
+		0.512384832f, -0.99428606f, 0.485718668f, 1.59022081f, -0.604587555f, -1.0f, 0.995627224f,
+		0.613689899f, -1.19351637f, 0.583661199f, 1.59022081f, -0.604587555f, -1.0f, 0.995627224f,
+		0.714995027f, -1.39274669f, 0.68160373f, 1.59022081f, -0.604587555f, -1.0f, 0.995627224f,
+		0.816300094f, -1.591977f, 0.779546261f, 1.59022081f, -0.604587555f, -1.0f, 0.995627224f,
+		0.0190456789f, -0.0197012071f, 0.00448924908f, 1.59002519f, -0.604593456f, -1.0f, 0.995657504f,
+		0.119007058f, -0.216220364f, 0.101064473f, 1.59002519f, -0.604593456f, -1.0f, 0.995657504f,
+		0.218968436f, -0.412739515f, 0.197639704f, 1.59002519f, -0.604593456f, -1.0f, 0.995657504f,
+		0.318929821f, -0.609258711f, 0.294214934f, 1.59002519f, -0.604593456f, -1.0f, 0.995657504f,
+		0.418891191f, -0.805777848f, 0.390790164f, 1.59002519f, -0.604593456f, -1.0f, 0.995657504f,
+		0.518852592f, -1.00229704f, 0.487365365f, 1.59002519f, -0.604593456f, -1.0f, 0.995657504f,
+		0.618813932f, -1.19881618f, 0.583940625f, 1.59002519f, -0.604593456f, -1.0f, 0.995657504f,
+		0.718775332f, -1.39533532f, 0.680515826f, 1.59002519f, -0.604593456f, -1.0f, 0.995657504f,
+		0.818736732f, -1.59185445f, 0.777091026f, 1.59002519f, -0.604593456f, -1.0f, 0.995657504f,
+		0.0318866856f, -0.0406845696f, 0.0127381366f, 1.58978772f, -0.604569137f, -1.0f, 0.995687485f,
+		0.130539536f, -0.234560758f, 0.107979052f, 1.58978772f, -0.604569137f, -1.0f, 0.995687485f,
+		0.229192391f, -0.428436935f, 0.203219965f, 1.58978772f, -0.604569137f, -1.0f, 0.995687485f,
+		0.327845246f, -0.622313142f, 0.298460871f, 1.58978772f, -0.604569137f, -1.0f, 0.995687485f,
+		0.426498085f, -0.816189349f, 0.393701792f, 1.58978772f, -0.604569137f, -1.0f, 0.995687485f,
+		0.525150955f, -1.01006556f, 0.488942713f, 1.58978772f, -0.604569137f, -1.0f, 0.995687485f,
+		0.623803794f, -1.2039417f, 0.584183633f, 1.58978772f, -0.604569137f, -1.0f, 0.995687485f,
+		0.722456634f, -1.39781785f, 0.679424524f, 1.58978772f, -0.604569137f, -1.0f, 0.995687485f,
+		0.821109474f, -1.59169412f, 0.774665415f, 1.58978772f, -0.604569137f, -1.0f, 0.995687485f,
+		0.0443957373f, -0.0611061193f, 0.0207610391f, 1.58950722f, -0.604513884f, -1.0f, 0.995717287f,
+		0.141773894f, -0.25240469f, 0.11469917f, 1.58950722f, -0.604513884f, -1.0f, 0.995717287f,
+		0.239152044f, -0.443703234f, 0.208637297f, 1.58950722f, -0.604513884f, -1.0f, 0.995717287f,
+		0.336530209f, -0.635001779f, 0.302575409f, 1.58950722f, -0.604513884f, -1.0f, 0.995717287f,
+		0.433908343f, -0.826300323f, 0.396513551f, 1.58950722f, -0.604513884f, -1.0f, 0.995717287f,
+		0.531286478f, -1.01759887f, 0.490451664f, 1.58950722f, -0.604513884f, -1.0f, 0.995717287f,
+		0.628664672f, -1.20889747f, 0.584389806f, 1.58950722f, -0.604513884f, -1.0f, 0.995717287f,
+		0.726042807f, -1.40019608f, 0.678327918f, 1.58950722f, -0.604513884f, -1.0f, 0.995717287f,
+		0.823420942f, -1.59149456f, 0.77226603f, 1.58950722f, -0.604513884f, -1.0f, 0.995717287f,
+		0.0565855429f, -0.08098609f, 0.0285657775f, 1.58918238f, -0.60442692f, -1.0f, 0.995746732f,
+		0.152721524f, -0.269769669f, 0.12123125f, 1.58918238f, -0.60442692f, -1.0f, 0.995746732f,
+		0.248857513f, -0.458553255f, 0.213896722f, 1.58918238f, -0.60442692f, -1.0f, 0.995746732f,
+		0.344993502f, -0.647336841f, 0.306562185f, 1.58918238f, -0.60442692f, -1.0f, 0.995746732f,
+		0.441129476f, -0.836120367f, 0.399227649f, 1.58918238f, -0.60442692f, -1.0f, 0.995746732f,
+		0.53726548f, -1.02490401f, 0.491893113f, 1.58918238f, -0.60442692f, -1.0f, 0.995746732f,
+		0.633401453f, -1.21368754f, 0.584558606f, 1.58918238f, -0.60442692f, -1.0f, 0.995746732f,
+		0.729537427f, -1.40247107f, 0.67722404f, 1.58918238f, -0.60442692f, -1.0f, 0.995746732f,
+		0.825673401f, -1.59125471f, 0.769889534f, 1.58918238f, -0.60442692f, -1.0f, 0.995746732f,
+		0.0684681535f, -0.1003436f, 0.0361597054f, 1.58881116f, -0.604307234f, -1.0f, 0.995775998f,
+		0.163393274f, -0.286672264f, 0.127581298f, 1.58881116f, -0.604307234f, -1.0f, 0.995775998f,
+		0.258318394f, -0.473000944f, 0.219002888f, 1.58881116f, -0.604307234f, -1.0f, 0.995775998f,
+		0.35324353f, -0.659329593f, 0.310424477f, 1.58881116f, -0.604307234f, -1.0f, 0.995775998f,
+		0.448168635f, -0.845658243f, 0.401846081f, 1.58881116f, -0.604307234f, -1.0f, 0.995775998f,
+		0.543093741f, -1.03198695f, 0.493267685f, 1.58881116f, -0.604307234f, -1.0f, 0.995775998f,
+		0.638018906f, -1.2183156f, 0.58468926f, 1.58881116f, -0.604307234f, -1.0f, 0.995775998f,
+		0.732944012f, -1.40464425f, 0.676110864f, 1.58881116f, -0.604307234f, -1.0f, 0.995775998f,
+		0.827869117f, -1.5909729f, 0.767532468f, 1.58881116f, -0.604307234f, -1.0f, 0.995775998f,
+		0.0800550357f, -0.119196668f, 0.0435497239f, 1.5883919f, -0.604153752f, -1.0f, 0.995804906f,
+		0.173799425f, -0.303128034f, 0.133754924f, 1.5883919f, -0.604153752f, -1.0f, 0.995804906f,
+		0.267543823f, -0.487059414f, 0.223960131f, 1.5883919f, -0.604153752f, -1.0f, 0.995804906f,
+		0.36128822f, -0.670990765f, 0.314165324f, 1.5883919f, -0.604153752f, -1.0f, 0.995804906f,
+		0.455032617f, -0.854922116f, 0.404370546f, 1.5883919f, -0.604153752f, -1.0f, 0.995804906f,
+		0.548776984f, -1.03885353f, 0.494575739f, 1.5883919f, -0.604153752f, -1.0f, 0.995804906f,
+		0.642521381f, -1.22278488f, 0.584780931f, 1.5883919f, -0.604153752f, -1.0f, 0.995804906f,
+		0.736265779f, -1.40671623f, 0.674986184f, 1.5883919f, -0.604153752f, -1.0f, 0.995804906f,
+		0.830010176f, -1.59064758f, 0.765191376f, 1.5883919f, -0.604153752f, -1.0f, 0.995804906f,
+		0.0913570896f, -0.13756232f, 0.0507423133f, 1.58792222f, -0.603965104f, -1.0f, 0.995833635f,
+		0.183949769f, -0.31915164f, 0.139757365f, 1.58792222f, -0.603965104f, -1.0f, 0.995833635f,
+		0.276542455f, -0.500740945f, 0.228772402f, 1.58792222f, -0.603965104f, -1.0f, 0.995833635f,
+		0.369135141f, -0.682330251f, 0.317787468f, 1.58792222f, -0.603965104f, -1.0f, 0.995833635f,
+		0.461727828f, -0.863919556f, 0.406802505f, 1.58792222f, -0.603965104f, -1.0f, 0.995833635f,
+		0.554320514f, -1.04550886f, 0.495817542f, 1.58792222f, -0.603965104f, -1.0f, 0.995833635f,
+		0.64691323f, -1.22709811f, 0.584832609f, 1.58792222f, -0.603965104f, -1.0f, 0.995833635f,
+		0.739505887f, -1.40868747f, 0.673847616f, 1.58792222f, -0.603965104f, -1.0f, 0.995833635f,
+		0.832098603f, -1.59027672f, 0.762862682f, 1.58792222f, -0.603965104f, -1.0f, 0.995833635f,
+		0.102384664f, -0.155456588f, 0.0577435382f, 1.58739996f, -0.603739858f, -1.0f, 0.995862067f,
+		0.193853617f, -0.334756792f, 0.145593449f, 1.58739996f, -0.603739858f, -1.0f, 0.995862067f,
+		0.285322577f, -0.51405704f, 0.23344335f, 1.58739996f, -0.603739858f, -1.0f, 0.995862067f,
+		0.376791537f, -0.693357229f, 0.321293265f, 1.58739996f, -0.603739858f, -1.0f, 0.995862067f,
+		0.468260497f, -0.872657478f, 0.40914315f, 1.58739996f, -0.603739858f, -1.0f, 0.995862067f,
+		0.559729457f, -1.05195773f, 0.496993065f, 1.58739996f, -0.603739858f, -1.0f, 0.995862067f,
+		0.651198387f, -1.23125792f, 0.58484298f, 1.58739996f, -0.603739858f, -1.0f, 0.995862067f,
+		0.742667377f, -1.4105581f, 0.672692895f, 1.58739996f, -0.603739858f, -1.0f, 0.995862067f,
+		0.834136307f, -1.58985829f, 0.76054281f, 1.58739996f, -0.603739858f, -1.0f, 0.995862067f,
+		0.00588923693f, 0.00187492231f, -0.00401431462f, 1.59991086f, -0.610694349f, -1.0f, 0.995941699f,
+		0.107191287f, -0.198374689f, 0.094945319f, 1.59991086f, -0.610694349f, -1.0f, 0.995941699f,
+		0.208493337f, -0.398624301f, 0.193904951f, 1.59991086f, -0.610694349f, -1.0f, 0.995941699f,
+		0.30979538f, -0.598873913f, 0.292864591f, 1.59991086f, -0.610694349f, -1.0f, 0.995941699f,
+		0.411097437f, -0.799123526f, 0.391824216f, 1.59991086f, -0.610694349f, -1.0f, 0.995941699f,
+		0.512399495f, -0.999373138f, 0.49078384f, 1.59991086f, -0.610694349f, -1.0f, 0.995941699f,
+		0.613701522f, -1.19962275f, 0.589743495f, 1.59991086f, -0.610694349f, -1.0f, 0.995941699f,
+		0.71500355f, -1.39987242f, 0.68870312f, 1.59991086f, -0.610694349f, -1.0f, 0.995941699f,
+		0.816305637f, -1.60012197f, 0.787662745f, 1.59991086f, -0.610694349f, -1.0f, 0.995941699f,
+		0.019075999f, -0.0198293552f, 0.00455923472f, 1.60007286f, -0.610929489f, -1.0f, 0.995965838f,
+		0.11903429f, -0.217389628f, 0.102173299f, 1.60007286f, -0.610929489f, -1.0f, 0.995965838f,
+		0.218992576f, -0.414949894f, 0.199787363f, 1.60007286f, -0.610929489f, -1.0f, 0.995965838f,
+		0.318950862f, -0.612510204f, 0.297401428f, 1.60007286f, -0.610929489f, -1.0f, 0.995965838f,
+		0.418909162f, -0.810070455f, 0.395015478f, 1.60007286f, -0.610929489f, -1.0f, 0.995965838f,
+		0.518867433f, -1.00763071f, 0.492629558f, 1.60007286f, -0.610929489f, -1.0f, 0.995965838f,
+		0.618825734f, -1.20519102f, 0.590243578f, 1.60007286f, -0.610929489f, -1.0f, 0.995965838f,
+		0.718784034f, -1.40275133f, 0.687857687f, 1.60007286f, -0.610929489f, -1.0f, 0.995965838f,
+		0.818742335f, -1.60031152f, 0.785471737f, 1.60007286f, -0.610929489f, -1.0f, 0.995965838f,
+		0.0319174603f, -0.0409564935f, 0.0129024899f, 1.60021222f, -0.61114651f, -1.0f, 0.995989919f,
+		0.130567178f, -0.2358969f, 0.109205276f, 1.60021222f, -0.61114651f, -1.0f, 0.995989919f,
+		0.229216889f, -0.430837333f, 0.205508068f, 1.60021222f, -0.61114651f, -1.0f, 0.995989919f,
+		0.327866614f, -0.625777721f, 0.301810861f, 1.60021222f, -0.61114651f, -1.0f, 0.995989919f,
+		0.426516324f, -0.820718169f, 0.398113638f, 1.60021222f, -0.61114651f, -1.0f, 0.995989919f,
+		0.525166035f, -1.01565862f, 0.494416445f, 1.60021222f, -0.61114651f, -1.0f, 0.995989919f,
+		0.623815775f, -1.21059895f, 0.590719223f, 1.60021222f, -0.61114651f, -1.0f, 0.995989919f,
+		0.722465456f, -1.40553939f, 0.68702203f, 1.60021222f, -0.61114651f, -1.0f, 0.995989919f,
+		0.821115196f, -1.60047984f, 0.783324778f, 1.60021222f, -0.61114651f, -1.0f, 0.995989919f,
+		0.0444270074f, -0.0615284815f, 0.0210241284f, 1.6003288f, -0.611345589f, -1.0f, 0.99601388f,
+		0.141801968f, -0.253915787f, 0.116048574f, 1.6003288f, -0.611345589f, -1.0f, 0.99601388f,
+		0.239176944f, -0.44630307f, 0.211073011f, 1.6003288f, -0.611345589f, -1.0f, 0.99601388f,
+		0.336551905f, -0.638690412f, 0.306097448f, 1.6003288f, -0.611345589f, -1.0f, 0.99601388f,
+		0.43392688f, -0.831077695f, 0.401121914f, 1.6003288f, -0.611345589f, -1.0f, 0.99601388f,
+		0.531301856f, -1.02346504f, 0.496146351f, 1.6003288f, -0.611345589f, -1.0f, 0.99601388f,
+		0.628676832f, -1.21585226f, 0.591170788f, 1.6003288f, -0.611345589f, -1.0f, 0.99601388f,
+		0.726051748f, -1.4082396f, 0.686195254f, 1.6003288f, -0.611345589f, -1.0f, 0.99601388f,
+		0.823426723f, -1.60062695f, 0.781219661f, 1.6003288f, -0.611345589f, -1.0f, 0.99601388f,
+		0.0566173419f, -0.0815661624f, 0.0289323665f, 1.60042274f, -0.611526966f, -1.0f, 0.996037662f,
+		0.15275009f, -0.271464497f, 0.122710094f, 1.60042274f, -0.611526966f, -1.0f, 0.996037662f,
+		0.24888283f, -0.461362839f, 0.21648781f, 1.60042274f, -0.611526966f, -1.0f, 0.996037662f,
+		0.345015585f, -0.651261151f, 0.310265541f, 1.60042274f, -0.611526966f, -1.0f, 0.996037662f,
+		0.441148311f, -0.841159523f, 0.404043257f, 1.60042274f, -0.611526966f, -1.0f, 0.996037662f,
+		0.537281036f, -1.03105783f, 0.497820973f, 1.60042274f, -0.611526966f, -1.0f, 0.996037662f,
+		0.633413792f, -1.22095621f, 0.59159869f, 1.60042274f, -0.611526966f, -1.0f, 0.996037662f,
+		0.729546547f, -1.41085446f, 0.685376406f, 1.60042274f, -0.611526966f, -1.0f, 0.996037662f,
+		0.825679302f, -1.60075283f, 0.779154181f, 1.60042274f, -0.611526966f, -1.0f, 0.996037662f,
+		0.0685005262f, -0.101089321f, 0.0366349965f, 1.60049403f, -0.6116907f, -1.0f, 0.996061325f,
+		0.163422346f, -0.288560361f, 0.129196391f, 1.60049403f, -0.6116907f, -1.0f, 0.996061325f,
+		0.258344173f, -0.476031423f, 0.22175777f, 1.60049403f, -0.6116907f, -1.0f, 0.996061325f,
+		0.353266001f, -0.663502455f, 0.314319164f, 1.60049403f, -0.6116907f, -1.0f, 0.996061325f,
+		0.448187828f, -0.850973547f, 0.406880558f, 1.60049403f, -0.6116907f, -1.0f, 0.996061325f,
+		0.543109655f, -1.03844452f, 0.499441922f, 1.60049403f, -0.6116907f, -1.0f, 0.996061325f,
+		0.638031483f, -1.22591567f, 0.592003345f, 1.60049403f, -0.6116907f, -1.0f, 0.996061325f,
+		0.73295331f, -1.4133867f, 0.68456471f, 1.60049403f, -0.6116907f, -1.0f, 0.996061325f,
+		0.827875078f, -1.60085773f, 0.777126074f, 1.60049403f, -0.6116907f, -1.0f, 0.996061325f,
+		0.0800880268f, -0.120116711f, 0.0441394001f, 1.60054278f, -0.61183691f, -1.0f, 0.996084869f,
+		0.173829049f, -0.305219799f, 0.135513663f, 1.60054278f, -0.61183691f, -1.0f, 0.996084869f,
+		0.267570078f, -0.490322888f, 0.226887912f, 1.60054278f, -0.61183691f, -1.0f, 0.996084869f,
+		0.361311108f, -0.675426006f, 0.31826216f, 1.60054278f, -0.61183691f, -1.0f, 0.996084869f,
+		0.455052137f, -0.860529065f, 0.409636438f, 1.60054278f, -0.61183691f, -1.0f, 0.996084869f,
+		0.548793197f, -1.04563224f, 0.501010656f, 1.60054278f, -0.61183691f, -1.0f, 0.996084869f,
+		0.642534196f, -1.2307353f, 0.592384934f, 1.60054278f, -0.61183691f, -1.0f, 0.996084869f,
+		0.736275256f, -1.41583836f, 0.683759212f, 1.60054278f, -0.61183691f, -1.0f, 0.996084869f,
+		0.830016255f, -1.60094142f, 0.775133431f, 1.60054278f, -0.61183691f, -1.0f, 0.996084869f,
+		0.0913907364f, -0.138666138f, 0.0514525808f, 1.60056865f, -0.611965597f, -1.0f, 0.996108234f,
+		0.183979988f, -0.321458369f, 0.141667783f, 1.60056865f, -0.611965597f, -1.0f, 0.996108234f,
+		0.276569247f, -0.504250586f, 0.231882989f, 1.60056865f, -0.611965597f, -1.0f, 0.996108234f,
+		0.369158506f, -0.687042832f, 0.322098196f, 1.60056865f, -0.611965597f, -1.0f, 0.996108234f,
+		0.461747766f, -0.869835079f, 0.412313402f, 1.60056865f, -0.611965597f, -1.0f, 0.996108234f,
+		0.554337025f, -1.05262733f, 0.502528608f, 1.60056865f, -0.611965597f, -1.0f, 0.996108234f,
+		0.646926284f, -1.23541951f, 0.592743814f, 1.60056865f, -0.611965597f, -1.0f, 0.996108234f,
+		0.739515543f, -1.41821182f, 0.68295902f, 1.60056865f, -0.611965597f, -1.0f, 0.996108234f,
+		0.832104802f, -1.601004f, 0.773174226f, 1.60056865f, -0.611965597f, -1.0f, 0.996108234f,
+		0.102419026f, -0.156754538f, 0.0585811883f, 1.60057163f, -0.612076819f, -1.0f, 0.99613148f,
+		0.193884477f, -0.337290883f, 0.147664353f, 1.60057163f, -0.612076819f, -1.0f, 0.99613148f,
+		0.285349935f, -0.517827213f, 0.236747503f, 1.60057163f, -0.612076819f, -1.0f, 0.99613148f,
+		0.376815379f, -0.698363543f, 0.325830668f, 1.60057163f, -0.612076819f, -1.0f, 0.99613148f,
+		0.468280852f, -0.878899932f, 0.414913833f, 1.60057163f, -0.612076819f, -1.0f, 0.99613148f,
+		0.559746265f, -1.0594362f, 0.503996968f, 1.60057163f, -0.612076819f, -1.0f, 0.99613148f,
+		0.651211739f, -1.23997259f, 0.593080163f, 1.60057163f, -0.612076819f, -1.0f, 0.99613148f,
+		0.742677212f, -1.42050898f, 0.682163298f, 1.60057163f, -0.612076819f, -1.0f, 0.99613148f,
+		0.834142625f, -1.60104525f, 0.771246493f, 1.60057163f, -0.612076819f, -1.0f, 0.99613148f,
+		0.00591099774f, 0.00188185018f, -0.00402914733f, 1.60675585f, -0.615008414f, -1.0f, 0.996377945f,
+		0.10721083f, -0.199109614f, 0.0956707299f, 1.60675585f, -0.615008414f, -1.0f, 0.996377945f,
+		0.208510667f, -0.400101095f, 0.195370615f, 1.60675585f, -0.615008414f, -1.0f, 0.996377945f,
+		0.309810489f, -0.601092577f, 0.295070499f, 1.60675585f, -0.615008414f, -1.0f, 0.996377945f,
+		0.411110312f, -0.802084029f, 0.394770384f, 1.60675585f, -0.615008414f, -1.0f, 0.996377945f,
+		0.512410164f, -1.00307548f, 0.494470268f, 1.60675585f, -0.615008414f, -1.0f, 0.996377945f,
+		0.613709986f, -1.20406699f, 0.594170153f, 1.60675585f, -0.615008414f, -1.0f, 0.996377945f,
+		0.715009809f, -1.40505838f, 0.693870008f, 1.60675585f, -0.615008414f, -1.0f, 0.996377945f,
+		0.816309631f, -1.6060499f, 0.793569922f, 1.60675585f, -0.615008414f, -1.0f, 0.996377945f,
+		0.0190978311f, -0.0199216269f, 0.00460962718f, 1.60710073f, -0.615361392f, -1.0f, 0.996394932f,
+		0.119053893f, -0.218231544f, 0.102971695f, 1.60710073f, -0.615361392f, -1.0f, 0.996394932f,
+		0.219009966f, -0.416541457f, 0.201333761f, 1.60710073f, -0.615361392f, -1.0f, 0.996394932f,
+		0.318966031f, -0.614851356f, 0.29969582f, 1.60710073f, -0.615361392f, -1.0f, 0.996394932f,
+		0.418922096f, -0.813161314f, 0.398057878f, 1.60710073f, -0.615361392f, -1.0f, 0.996394932f,
+		0.518878162f, -1.01147127f, 0.496419966f, 1.60710073f, -0.615361392f, -1.0f, 0.996394932f,
+		0.618834198f, -1.20978117f, 0.594781995f, 1.60710073f, -0.615361392f, -1.0f, 0.996394932f,
+		0.718790293f, -1.40809107f, 0.693144083f, 1.60710073f, -0.615361392f, -1.0f, 0.996394932f,
+		0.818746328f, -1.60640097f, 0.791506171f, 1.60710073f, -0.615361392f, -1.0f, 0.996394932f,
+		0.0319393761f, -0.0411501378f, 0.013019531f, 1.60742915f, -0.615700305f, -1.0f, 0.99641192f,
+		0.130586863f, -0.236848429f, 0.110078514f, 1.60742915f, -0.615700305f, -1.0f, 0.99641192f,
+		0.229234338f, -0.432546705f, 0.207137495f, 1.60742915f, -0.615700305f, -1.0f, 0.99641192f,
+		0.327881813f, -0.628244996f, 0.304196477f, 1.60742915f, -0.615700305f, -1.0f, 0.99641192f,
+		0.426529318f, -0.823943257f, 0.401255459f, 1.60742915f, -0.615700305f, -1.0f, 0.99641192f,
+		0.525176764f, -1.01964152f, 0.49831447f, 1.60742915f, -0.615700305f, -1.0f, 0.99641192f,
+		0.623824298f, -1.2153399f, 0.595373452f, 1.60742915f, -0.615700305f, -1.0f, 0.99641192f,
+		0.722471774f, -1.41103816f, 0.692432404f, 1.60742915f, -0.615700305f, -1.0f, 0.99641192f,
+		0.821119249f, -1.60673642f, 0.789491415f, 1.60742915f, -0.615700305f, -1.0f, 0.99641192f,
+		0.0444490202f, -0.0618258528f, 0.0212093592f, 1.60774171f, -0.616025627f, -1.0f, 0.996428847f,
+		0.141821742f, -0.2549797f, 0.116998643f, 1.60774171f, -0.616025627f, -1.0f, 0.996428847f,
+		0.239194468f, -0.448133558f, 0.212787926f, 1.60774171f, -0.616025627f, -1.0f, 0.996428847f,
+		0.336567193f, -0.641287386f, 0.30857721f, 1.60774171f, -0.616025627f, -1.0f, 0.996428847f,
+		0.433939904f, -0.834441245f, 0.404366493f, 1.60774171f, -0.616025627f, -1.0f, 0.996428847f,
+		0.531312644f, -1.02759516f, 0.500155807f, 1.60774171f, -0.616025627f, -1.0f, 0.996428847f,
+		0.628685355f, -1.2207489f, 0.59594506f, 1.60774171f, -0.616025627f, -1.0f, 0.996428847f,
+		0.726058066f, -1.41390276f, 0.691734374f, 1.60774171f, -0.616025627f, -1.0f, 0.996428847f,
+		0.823430777f, -1.60705662f, 0.787523627f, 1.60774171f, -0.616025627f, -1.0f, 0.996428847f,
+		0.0566394702f, -0.0819698051f, 0.0291874558f, 1.60803854f, -0.616337776f, -1.0f, 0.996445835f,
+		0.152769953f, -0.272643834f, 0.123739131f, 1.60803854f, -0.616337776f, -1.0f, 0.996445835f,
+		0.248900443f, -0.463317871f, 0.218290806f, 1.60803854f, -0.616337776f, -1.0f, 0.996445835f,
+		0.345030934f, -0.653991938f, 0.312842488f, 1.60803854f, -0.616337776f, -1.0f, 0.996445835f,
+		0.441161424f, -0.844665945f, 0.407394171f, 1.60803854f, -0.616337776f, -1.0f, 0.996445835f,
+		0.537291944f, -1.03533995f, 0.501945853f, 1.60803854f, -0.616337776f, -1.0f, 0.996445835f,
+		0.633422434f, -1.22601402f, 0.596497536f, 1.60803854f, -0.616337776f, -1.0f, 0.996445835f,
+		0.729552925f, -1.41668808f, 0.691049218f, 1.60803854f, -0.616337776f, -1.0f, 0.996445835f,
+		0.825683415f, -1.60736203f, 0.785600901f, 1.60803854f, -0.616337776f, -1.0f, 0.996445835f,
+		0.0685227811f, -0.101601966f, 0.036961738f, 1.60832036f, -0.616636992f, -1.0f, 0.996462762f,
+		0.163442329f, -0.289858341f, 0.130306676f, 1.60832036f, -0.616636992f, -1.0f, 0.996462762f,
+		0.258361876f, -0.478114754f, 0.223651618f, 1.60832036f, -0.616636992f, -1.0f, 0.996462762f,
+		0.353281438f, -0.666371107f, 0.316996574f, 1.60832036f, -0.616636992f, -1.0f, 0.996462762f,
+		0.448201001f, -0.85462749f, 0.410341501f, 1.60832036f, -0.616636992f, -1.0f, 0.996462762f,
+		0.543120563f, -1.04288387f, 0.503686428f, 1.60832036f, -0.616636992f, -1.0f, 0.996462762f,
+		0.638040125f, -1.23114026f, 0.597031415f, 1.60832036f, -0.616636992f, -1.0f, 0.996462762f,
+		0.732959688f, -1.41939664f, 0.690376341f, 1.60832036f, -0.616636992f, -1.0f, 0.996462762f,
+		0.82787919f, -1.60765302f, 0.783721268f, 1.60832036f, -0.616636992f, -1.0f, 0.996462762f,
+		0.0801104233f, -0.120741315f, 0.0445397273f, 1.60858715f, -0.61692369f, -1.0f, 0.99647963f,
+		0.173849165f, -0.30663988f, 0.136707649f, 1.60858715f, -0.61692369f, -1.0f, 0.99647963f,
+		0.26758793f, -0.492538452f, 0.228875563f, 1.60858715f, -0.61692369f, -1.0f, 0.99647963f,
+		0.361326665f, -0.678437054f, 0.321043491f, 1.60858715f, -0.61692369f, -1.0f, 0.99647963f,
+		0.455065429f, -0.864335597f, 0.413211405f, 1.60858715f, -0.61692369f, -1.0f, 0.99647963f,
+		0.548804164f, -1.0502342f, 0.505379319f, 1.60858715f, -0.61692369f, -1.0f, 0.99647963f,
+		0.642542899f, -1.23613274f, 0.597547233f, 1.60858715f, -0.61692369f, -1.0f, 0.99647963f,
+		0.736281633f, -1.42203128f, 0.689715147f, 1.60858715f, -0.61692369f, -1.0f, 0.99647963f,
+		0.830020428f, -1.60792994f, 0.781883061f, 1.60858715f, -0.61692369f, -1.0f, 0.99647963f,
+		0.0914132819f, -0.139405876f, 0.0519285724f, 1.60883951f, -0.617198229f, -1.0f, 0.996496558f,
+		0.184000254f, -0.323004276f, 0.142948076f, 1.60883951f, -0.617198229f, -1.0f, 0.996496558f,
+		0.276587218f, -0.506602645f, 0.233967572f, 1.60883951f, -0.617198229f, -1.0f, 0.996496558f,
+		0.369174182f, -0.690201044f, 0.324987084f, 1.60883951f, -0.617198229f, -1.0f, 0.996496558f,
+		0.461761147f, -0.873799443f, 0.416006565f, 1.60883951f, -0.617198229f, -1.0f, 0.996496558f,
+		0.554348111f, -1.05739784f, 0.507026076f, 1.60883951f, -0.617198229f, -1.0f, 0.996496558f,
+		0.646935046f, -1.24099624f, 0.598045588f, 1.60883951f, -0.617198229f, -1.0f, 0.996496558f,
+		0.73952204f, -1.42459452f, 0.689065039f, 1.60883951f, -0.617198229f, -1.0f, 0.996496558f,
+		0.832108974f, -1.60819292f, 0.78008455f, 1.60883951f, -0.617198229f, -1.0f, 0.996496558f,
+		0.102441743f, -0.157612801f, 0.0591350757f, 1.60907757f, -0.617460847f, -1.0f, 0.996513367f,
+		0.193904877f, -0.338966519f, 0.14903371f, 1.60907757f, -0.617460847f, -1.0f, 0.996513367f,
+		0.285368025f, -0.520320237f, 0.238932341f, 1.60907757f, -0.617460847f, -1.0f, 0.996513367f,
+		0.376831174f, -0.701673925f, 0.328830987f, 1.60907757f, -0.617460847f, -1.0f, 0.996513367f,
+		0.468294293f, -0.883027673f, 0.418729603f, 1.60907757f, -0.617460847f, -1.0f, 0.996513367f,
+		0.559757411f, -1.06438136f, 0.508628249f, 1.60907757f, -0.617460847f, -1.0f, 0.996513367f,
+		0.65122056f, -1.24573505f, 0.598526895f, 1.60907757f, -0.617460847f, -1.0f, 0.996513367f,
+		0.742683709f, -1.42708874f, 0.688425481f, 1.60907757f, -0.617460847f, -1.0f, 0.996513367f,
+		0.834146857f, -1.60844254f, 0.778324127f, 1.60907757f, -0.617460847f, -1.0f, 0.996513367f,
+		0.00592630915f, 0.00188672473f, -0.00403958419f, 1.61132395f, -0.617887795f, -1.0f, 0.996932983f,
+		0.107224584f, -0.199626729f, 0.0961811543f, 1.61132395f, -0.617887795f, -1.0f, 0.996932983f,
+		0.208522856f, -0.401140183f, 0.196401894f, 1.61132395f, -0.617887795f, -1.0f, 0.996932983f,
+		0.309821129f, -0.602653623f, 0.296622634f, 1.61132395f, -0.617887795f, -1.0f, 0.996932983f,
+		0.411119401f, -0.804167092f, 0.396843374f, 1.61132395f, -0.617887795f, -1.0f, 0.996932983f,
+		0.512417674f, -1.00568056f, 0.497064114f, 1.61132395f, -0.617887795f, -1.0f, 0.996932983f,
+		0.613715947f, -1.20719397f, 0.597284853f, 1.61132395f, -0.617887795f, -1.0f, 0.996932983f,
+		0.715014219f, -1.4087075f, 0.697505593f, 1.61132395f, -0.617887795f, -1.0f, 0.996932983f,
+		0.816312492f, -1.61022091f, 0.797726333f, 1.61132395f, -0.617887795f, -1.0f, 0.996932983f,
+		0.019113075f, -0.0199860577f, 0.00464481441f, 1.61175942f, -0.618299603f, -1.0f, 0.996942997f,
+		0.119067587f, -0.218819425f, 0.103529178f, 1.61175942f, -0.618299603f, -1.0f, 0.996942997f,
+		0.219022095f, -0.417652786f, 0.202413544f, 1.61175942f, -0.618299603f, -1.0f, 0.996942997f,
+		0.318976611f, -0.616486132f, 0.301297903f, 1.61175942f, -0.618299603f, -1.0f, 0.996942997f,
+		0.418931127f, -0.815319538f, 0.400182277f, 1.61175942f, -0.618299603f, -1.0f, 0.996942997f,
+		0.518885612f, -1.01415288f, 0.499066651f, 1.61175942f, -0.618299603f, -1.0f, 0.996942997f,
+		0.618840158f, -1.21298623f, 0.597950995f, 1.61175942f, -0.618299603f, -1.0f, 0.996942997f,
+		0.718794644f, -1.41181958f, 0.696835399f, 1.61175942f, -0.618299603f, -1.0f, 0.996942997f,
+		0.818749189f, -1.61065292f, 0.795719743f, 1.61175942f, -0.618299603f, -1.0f, 0.996942997f,
+		0.0319545604f, -0.0412843004f, 0.0131006204f, 1.61218059f, -0.618698657f, -1.0f, 0.996953011f,
+		0.130600497f, -0.237507656f, 0.110683516f, 1.61218059f, -0.618698657f, -1.0f, 0.996953011f,
+		0.229246438f, -0.433731019f, 0.208266422f, 1.61218059f, -0.618698657f, -1.0f, 0.996953011f,
+		0.327892363f, -0.629954398f, 0.305849314f, 1.61218059f, -0.618698657f, -1.0f, 0.996953011f,
+		0.426538289f, -0.826177716f, 0.40343222f, 1.61218059f, -0.618698657f, -1.0f, 0.996953011f,
+		0.525184214f, -1.02240109f, 0.501015127f, 1.61218059f, -0.618698657f, -1.0f, 0.996953011f,
+		0.623830199f, -1.21862447f, 0.598598003f, 1.61218059f, -0.618698657f, -1.0f, 0.996953011f,
+		0.722476125f, -1.41484785f, 0.69618088f, 1.61218059f, -0.618698657f, -1.0f, 0.996953011f,
+		0.82112205f, -1.61107111f, 0.793763816f, 1.61218059f, -0.618698657f, -1.0f, 0.996953011f,
+		0.0444641523f, -0.0620302409f, 0.0213366728f, 1.61258781f, -0.619085431f, -1.0f, 0.996963084f,
+		0.141835332f, -0.255710959f, 0.117651649f, 1.61258781f, -0.619085431f, -1.0f, 0.996963084f,
+		0.239206508f, -0.449391663f, 0.213966623f, 1.61258781f, -0.619085431f, -1.0f, 0.996963084f,
+		0.336577684f, -0.643072367f, 0.310281605f, 1.61258781f, -0.619085431f, -1.0f, 0.996963084f,
+		0.433948874f, -0.83675313f, 0.406596571f, 1.61258781f, -0.619085431f, -1.0f, 0.996963084f,
+		0.531320035f, -1.03043377f, 0.502911568f, 1.61258781f, -0.619085431f, -1.0f, 0.996963084f,
+		0.628691256f, -1.22411454f, 0.599226534f, 1.61258781f, -0.619085431f, -1.0f, 0.996963084f,
+		0.726062417f, -1.4177953f, 0.695541501f, 1.61258781f, -0.619085431f, -1.0f, 0.996963084f,
+		0.823433578f, -1.61147594f, 0.791856468f, 1.61258781f, -0.619085431f, -1.0f, 0.996963084f,
+		0.0566545539f, -0.0822449848f, 0.0293613598f, 1.61298156f, -0.619460404f, -1.0f, 0.996973217f,
+		0.152783513f, -0.273447841f, 0.124440677f, 1.61298156f, -0.619460404f, -1.0f, 0.996973217f,
+		0.248912454f, -0.464650691f, 0.219519988f, 1.61298156f, -0.619460404f, -1.0f, 0.996973217f,
+		0.345041424f, -0.65585357f, 0.314599305f, 1.61298156f, -0.619460404f, -1.0f, 0.996973217f,
+		0.441170365f, -0.847056448f, 0.409678608f, 1.61298156f, -0.619460404f, -1.0f, 0.996973217f,
+		0.537299335f, -1.03825927f, 0.504757941f, 1.61298156f, -0.619460404f, -1.0f, 0.996973217f,
+		0.633428276f, -1.22946215f, 0.599837244f, 1.61298156f, -0.619460404f, -1.0f, 0.996973217f,
+		0.729557216f, -1.42066503f, 0.694916546f, 1.61298156f, -0.619460404f, -1.0f, 0.996973217f,
+		0.825686157f, -1.6118679f, 0.789995909f, 1.61298156f, -0.619460404f, -1.0f, 0.996973217f,
+		0.0685378239f, -0.101948567f, 0.0371826403f, 1.61336231f, -0.619823873f, -1.0f, 0.996983349f,
+		0.163455844f, -0.2907359f, 0.131057337f, 1.61336231f, -0.619823873f, -1.0f, 0.996983349f,
+		0.258373857f, -0.479523242f, 0.22493203f, 1.61336231f, -0.619823873f, -1.0f, 0.996983349f,
+		0.353291899f, -0.668310583f, 0.318806738f, 1.61336231f, -0.619823873f, -1.0f, 0.996983349f,
+		0.448209912f, -0.857097924f, 0.412681431f, 1.61336231f, -0.619823873f, -1.0f, 0.996983349f,
+		0.543127954f, -1.04588532f, 0.506556094f, 1.61336231f, -0.619823873f, -1.0f, 0.996983349f,
+		0.638045967f, -1.23467267f, 0.600430787f, 1.61336231f, -0.619823873f, -1.0f, 0.996983349f,
+		0.732963979f, -1.42346001f, 0.69430548f, 1.61336231f, -0.619823873f, -1.0f, 0.996983349f,
+		0.827881992f, -1.61224735f, 0.788180232f, 1.61336231f, -0.619823873f, -1.0f, 0.996983349f,
+		0.0801254287f, -0.121160023f, 0.0448080897f, 1.61373055f, -0.620176375f, -1.0f, 0.996993542f,
+		0.173862651f, -0.307591856f, 0.13750805f, 1.61373055f, -0.620176375f, -1.0f, 0.996993542f,
+		0.267599881f, -0.494023681f, 0.230207995f, 1.61373055f, -0.620176375f, -1.0f, 0.996993542f,
+		0.361337095f, -0.680455506f, 0.322907954f, 1.61373055f, -0.620176375f, -1.0f, 0.996993542f,
+		0.45507431f, -0.866887331f, 0.415607899f, 1.61373055f, -0.620176375f, -1.0f, 0.996993542f,
+		0.548811555f, -1.05331922f, 0.508307874f, 1.61373055f, -0.620176375f, -1.0f, 0.996993542f,
+		0.64254874f, -1.23975098f, 0.601007819f, 1.61373055f, -0.620176375f, -1.0f, 0.996993542f,
+		0.736285985f, -1.42618287f, 0.693707764f, 1.61373055f, -0.620176375f, -1.0f, 0.996993542f,
+		0.83002317f, -1.61261463f, 0.786407709f, 1.61373055f, -0.620176375f, -1.0f, 0.996993542f,
+		0.0914282724f, -0.139897466f, 0.0522448942f, 1.61408663f, -0.620518148f, -1.0f, 0.997003794f,
+		0.184013709f, -0.324031591f, 0.143798888f, 1.61408663f, -0.620518148f, -1.0f, 0.997003794f,
+		0.276599139f, -0.508165717f, 0.235352874f, 1.61408663f, -0.620518148f, -1.0f, 0.997003794f,
+		0.369184583f, -0.692299783f, 0.32690686f, 1.61408663f, -0.620518148f, -1.0f, 0.997003794f,
+		0.461769998f, -0.876433909f, 0.418460876f, 1.61408663f, -0.620518148f, -1.0f, 0.997003794f,
+		0.554355443f, -1.06056809f, 0.510014832f, 1.61408663f, -0.620518148f, -1.0f, 0.997003794f,
+		0.646940887f, -1.2447021f, 0.601568878f, 1.61408663f, -0.620518148f, -1.0f, 0.997003794f,
+		0.739526331f, -1.42883623f, 0.693122864f, 1.61408663f, -0.620518148f, -1.0f, 0.997003794f,
+		0.832111776f, -1.61297035f, 0.78467685f, 1.61408663f, -0.620518148f, -1.0f, 0.997003794f,
+		0.102456711f, -0.158178106f, 0.0594999008f, 1.61443102f, -0.620849609f, -1.0f, 0.997014046f,
+		0.193918318f, -0.340070188f, 0.149935663f, 1.61443102f, -0.620849609f, -1.0f, 0.997014046f,
+		0.285379946f, -0.521962285f, 0.240371421f, 1.61443102f, -0.620849609f, -1.0f, 0.997014046f,
+		0.376841545f, -0.703854382f, 0.330807179f, 1.61443102f, -0.620849609f, -1.0f, 0.997014046f,
+		0.468303174f, -0.885746479f, 0.421242923f, 1.61443102f, -0.620849609f, -1.0f, 0.997014046f,
+		0.559764802f, -1.06763852f, 0.511678696f, 1.61443102f, -0.620849609f, -1.0f, 0.997014046f,
+		0.651226401f, -1.24953067f, 0.602114439f, 1.61443102f, -0.620849609f, -1.0f, 0.997014046f,
+		0.742688f, -1.43142271f, 0.692550182f, 1.61443102f, -0.620849609f, -1.0f, 0.997014046f,
+		0.834149599f, -1.61331487f, 0.782985985f, 1.61443102f, -0.620849609f, -1.0f, 0.997014046f,
+		0.00593682844f, 0.00189007365f, -0.00404675445f, 1.61422074f, -0.619714022f, -1.0f, 0.997555912f,
+		0.107234031f, -0.199982002f, 0.0965318233f, 1.61422074f, -0.619714022f, -1.0f, 0.997555912f,
+		0.208531231f, -0.401854068f, 0.1971104f, 1.61422074f, -0.619714022f, -1.0f, 0.997555912f,
+		0.30982843f, -0.603726149f, 0.297688991f, 1.61422074f, -0.619714022f, -1.0f, 0.997555912f,
+		0.41112563f, -0.805598199f, 0.398267567f, 1.61422074f, -0.619714022f, -1.0f, 0.997555912f,
+		0.5124228f, -1.00747025f, 0.498846143f, 1.61422074f, -0.619714022f, -1.0f, 0.997555912f,
+		0.61372f, -1.20934236f, 0.59942472f, 1.61422074f, -0.619714022f, -1.0f, 0.997555912f,
+		0.7150172f, -1.41121447f, 0.700003266f, 1.61422074f, -0.619714022f, -1.0f, 0.997555912f,
+		0.816314399f, -1.61308658f, 0.800581872f, 1.61422074f, -0.619714022f, -1.0f, 0.997555912f,
+		0.0191234928f, -0.0200300869f, 0.0046688607f, 1.61469996f, -0.62015444f, -1.0f, 0.99756068f,
+		0.119076945f, -0.21922116f, 0.103910156f, 1.61469996f, -0.62015444f, -1.0f, 0.99756068f,
+		0.219030395f, -0.418412238f, 0.20315145f, 1.61469996f, -0.62015444f, -1.0f, 0.99756068f,
+		0.318983853f, -0.617603302f, 0.302392751f, 1.61469996f, -0.62015444f, -1.0f, 0.99756068f,
+		0.418937296f, -0.816794395f, 0.401634037f, 1.61469996f, -0.62015444f, -1.0f, 0.99756068f,
+		0.518890738f, -1.01598549f, 0.500875354f, 1.61469996f, -0.62015444f, -1.0f, 0.99756068f,
+		0.618844211f, -1.21517658f, 0.600116611f, 1.61469996f, -0.62015444f, -1.0f, 0.99756068f,
+		0.718797624f, -1.41436768f, 0.699357927f, 1.61469996f, -0.62015444f, -1.0f, 0.99756068f,
+		0.818751097f, -1.61355865f, 0.798599243f, 1.61469996f, -0.62015444f, -1.0f, 0.99756068f,
+		0.0319648832f, -0.0413754918f, 0.0131557379f, 1.61516535f, -0.620582521f, -1.0f, 0.997565508f,
+		0.130609766f, -0.237955734f, 0.111094743f, 1.61516535f, -0.620582521f, -1.0f, 0.997565508f,
+		0.229254648f, -0.43453598f, 0.209033743f, 1.61516535f, -0.620582521f, -1.0f, 0.997565508f,
+		0.327899545f, -0.631116271f, 0.306972742f, 1.61516535f, -0.620582521f, -1.0f, 0.997565508f,
+		0.426544428f, -0.827696502f, 0.404911757f, 1.61516535f, -0.620582521f, -1.0f, 0.997565508f,
+		0.525189281f, -1.02427673f, 0.502850771f, 1.61516535f, -0.620582521f, -1.0f, 0.997565508f,
+		0.623834193f, -1.22085702f, 0.600789726f, 1.61516535f, -0.620582521f, -1.0f, 0.997565508f,
+		0.722479045f, -1.4174372f, 0.69872874f, 1.61516535f, -0.620582521f, -1.0f, 0.997565508f,
+		0.821123958f, -1.61401749f, 0.796667755f, 1.61516535f, -0.620582521f, -1.0f, 0.997565508f,
+		0.044474382f, -0.0621684082f, 0.0214227363f, 1.61561751f, -0.620998681f, -1.0f, 0.997570395f,
+		0.141844526f, -0.256205291f, 0.118093081f, 1.61561751f, -0.620998681f, -1.0f, 0.997570395f,
+		0.239214659f, -0.450242162f, 0.214763418f, 1.61561751f, -0.620998681f, -1.0f, 0.997570395f,
+		0.336584806f, -0.644279063f, 0.311433762f, 1.61561751f, -0.620998681f, -1.0f, 0.997570395f,
+		0.433954924f, -0.838315904f, 0.408104092f, 1.61561751f, -0.620998681f, -1.0f, 0.997570395f,
+		0.531325102f, -1.03235281f, 0.504774451f, 1.61561751f, -0.620998681f, -1.0f, 0.997570395f,
+		0.62869519f, -1.22638965f, 0.601444781f, 1.61561751f, -0.620998681f, -1.0f, 0.997570395f,
+		0.726065338f, -1.42042649f, 0.69811511f, 1.61561751f, -0.620998681f, -1.0f, 0.997570395f,
+		0.823435485f, -1.61446345f, 0.7947855f, 1.61561751f, -0.620998681f, -1.0f, 0.997570395f,
+		0.0566646941f, -0.0824299753f, 0.0294782687f, 1.61605692f, -0.621403515f, -1.0f, 0.997575283f,
+		0.152792618f, -0.273988336f, 0.124912292f, 1.61605692f, -0.621403515f, -1.0f, 0.997575283f,
+		0.24892053f, -0.465546727f, 0.220346317f, 1.61605692f, -0.621403515f, -1.0f, 0.997575283f,
+		0.345048457f, -0.657105088f, 0.315780342f, 1.61605692f, -0.621403515f, -1.0f, 0.997575283f,
+		0.441176385f, -0.848663449f, 0.411214381f, 1.61605692f, -0.621403515f, -1.0f, 0.997575283f,
+		0.537304282f, -1.04022181f, 0.506648421f, 1.61605692f, -0.621403515f, -1.0f, 0.997575283f,
+		0.633432209f, -1.23178017f, 0.602082431f, 1.61605692f, -0.621403515f, -1.0f, 0.997575283f,
+		0.729560137f, -1.42333853f, 0.697516441f, 1.61605692f, -0.621403515f, -1.0f, 0.997575283f,
+		0.825688064f, -1.61489689f, 0.792950451f, 1.61605692f, -0.621403515f, -1.0f, 0.997575283f,
+		0.0685478821f, -0.102180257f, 0.0373303145f, 1.61648393f, -0.621797264f, -1.0f, 0.99758023f,
+		0.163464874f, -0.291322529f, 0.131559148f, 1.61648393f, -0.621797264f, -1.0f, 0.99758023f,
+		0.258381873f, -0.480464816f, 0.225787967f, 1.61648393f, -0.621797264f, -1.0f, 0.99758023f,
+		0.353298873f, -0.669607103f, 0.320016801f, 1.61648393f, -0.621797264f, -1.0f, 0.99758023f,
+		0.448215872f, -0.85874939f, 0.414245635f, 1.61648393f, -0.621797264f, -1.0f, 0.99758023f,
+		0.543132842f, -1.04789162f, 0.508474469f, 1.61648393f, -0.621797264f, -1.0f, 0.99758023f,
+		0.638049841f, -1.23703396f, 0.602703273f, 1.61648393f, -0.621797264f, -1.0f, 0.99758023f,
+		0.73296684f, -1.42617619f, 0.696932137f, 1.61648393f, -0.621797264f, -1.0f, 0.99758023f,
+		0.82788384f, -1.61531854f, 0.791160941f, 1.61648393f, -0.621797264f, -1.0f, 0.99758023f,
+		0.0801354125f, -0.121438332f, 0.0449864641f, 1.61689913f, -0.622180462f, -1.0f, 0.997585237f,
+		0.173871607f, -0.308224618f, 0.138040066f, 1.61689913f, -0.622180462f, -1.0f, 0.997585237f,
+		0.267607808f, -0.495010883f, 0.23109366f, 1.61689913f, -0.622180462f, -1.0f, 0.997585237f,
+		0.36134401f, -0.681797147f, 0.324147254f, 1.61689913f, -0.622180462f, -1.0f, 0.997585237f,
+		0.455080211f, -0.868583441f, 0.417200834f, 1.61689913f, -0.622180462f, -1.0f, 0.997585237f,
+		0.548816442f, -1.05536973f, 0.510254443f, 1.61689913f, -0.622180462f, -1.0f, 0.997585237f,
+		0.642552614f, -1.24215603f, 0.603308022f, 1.61689913f, -0.622180462f, -1.0f, 0.997585237f,
+		0.736288846f, -1.42894232f, 0.696361601f, 1.61689913f, -0.622180462f, -1.0f, 0.997585237f,
+		0.830025017f, -1.61572862f, 0.78941524f, 1.61689913f, -0.622180462f, -1.0f, 0.997585237f,
+		0.0914381742f, -0.140222341f, 0.0524539314f, 1.61730289f, -0.622553408f, -1.0f, 0.997590303f,
+		0.184022605f, -0.324710488f, 0.144361153f, 1.61730289f, -0.622553408f, -1.0f, 0.997590303f,
+		0.276607037f, -0.509198666f, 0.236268356f, 1.61730289f, -0.622553408f, -1.0f, 0.997590303f,
+		0.369191438f, -0.693686783f, 0.328175575f, 1.61730289f, -0.622553408f, -1.0f, 0.997590303f,
+		0.461775869f, -0.878174961f, 0.420082778f, 1.61730289f, -0.622553408f, -1.0f, 0.997590303f,
+		0.55436033f, -1.06266308f, 0.511990011f, 1.61730289f, -0.622553408f, -1.0f, 0.997590303f,
+		0.646944702f, -1.24715126f, 0.603897214f, 1.61730289f, -0.622553408f, -1.0f, 0.997590303f,
+		0.739529133f, -1.43163943f, 0.695804417f, 1.61730289f, -0.622553408f, -1.0f, 0.997590303f,
+		0.832113564f, -1.61612749f, 0.78771162f, 1.61730289f, -0.622553408f, -1.0f, 0.997590303f,
+		0.102466546f, -0.158549502f, 0.0597395822f, 1.61769569f, -0.62291652f, -1.0f, 0.99759537f,
+		0.193927154f, -0.340795308f, 0.150528222f, 1.61769569f, -0.62291652f, -1.0f, 0.99759537f,
+		0.285387754f, -0.52304107f, 0.241316855f, 1.61769569f, -0.62291652f, -1.0f, 0.99759537f,
+		0.37684837f, -0.70528686f, 0.332105488f, 1.61769569f, -0.62291652f, -1.0f, 0.99759537f,
+		0.468308985f, -0.887532651f, 0.42289412f, 1.61769569f, -0.62291652f, -1.0f, 0.99759537f,
+		0.559769571f, -1.06977844f, 0.513682783f, 1.61769569f, -0.62291652f, -1.0f, 0.99759537f,
+		0.651230216f, -1.25202417f, 0.604471385f, 1.61769569f, -0.62291652f, -1.0f, 0.99759537f,
+		0.742690802f, -1.43427002f, 0.695260048f, 1.61769569f, -0.62291652f, -1.0f, 0.99759537f,
+		0.834151447f, -1.61651576f, 0.78604871f, 1.61769569f, -0.62291652f, -1.0f, 0.99759537f,
+		0.00594393723f, 0.00189233688f, -0.00405160012f, 1.61599374f, -0.620831966f, -1.0f, 0.998161674f,
+		0.107240409f, -0.20022209f, 0.0967688039f, 1.61599374f, -0.620831966f, -1.0f, 0.998161674f,
+		0.208536893f, -0.402336508f, 0.197589204f, 1.61599374f, -0.620831966f, -1.0f, 0.998161674f,
+		0.309833348f, -0.604450941f, 0.298409611f, 1.61599374f, -0.620831966f, -1.0f, 0.998161674f,
+		0.411129832f, -0.806565344f, 0.399230003f, 1.61599374f, -0.620831966f, -1.0f, 0.998161674f,
+		0.512426317f, -1.00867975f, 0.500050426f, 1.61599374f, -0.620831966f, -1.0f, 0.998161674f,
+		0.613722801f, -1.21079421f, 0.600870848f, 1.61599374f, -0.620831966f, -1.0f, 0.998161674f,
+		0.715019286f, -1.41290867f, 0.70169121f, 1.61599374f, -0.620831966f, -1.0f, 0.998161674f,
+		0.816315711f, -1.61502302f, 0.802511632f, 1.61599374f, -0.620831966f, -1.0f, 0.998161674f,
+		0.0191305075f, -0.0200597346f, 0.0046850522f, 1.61649311f, -0.621285737f, -1.0f, 0.998163581f,
+		0.119083241f, -0.219491675f, 0.104166687f, 1.61649311f, -0.621285737f, -1.0f, 0.998163581f,
+		0.219035983f, -0.418923616f, 0.203648329f, 1.61649311f, -0.621285737f, -1.0f, 0.998163581f,
+		0.318988711f, -0.618355572f, 0.303129971f, 1.61649311f, -0.621285737f, -1.0f, 0.998163581f,
+		0.418941438f, -0.817787528f, 0.402611583f, 1.61649311f, -0.621285737f, -1.0f, 0.998163581f,
+		0.518894196f, -1.01721942f, 0.502093256f, 1.61649311f, -0.621285737f, -1.0f, 0.998163581f,
+		0.618846893f, -1.21665144f, 0.601574898f, 1.61649311f, -0.621285737f, -1.0f, 0.998163581f,
+		0.718799651f, -1.41608334f, 0.70105648f, 1.61649311f, -0.621285737f, -1.0f, 0.998163581f,
+		0.818752408f, -1.61551523f, 0.800538123f, 1.61649311f, -0.621285737f, -1.0f, 0.998163581f,
+		0.0319718048f, -0.0414366722f, 0.0131927151f, 1.61697888f, -0.621727347f, -1.0f, 0.998165488f,
+		0.130615979f, -0.238256365f, 0.111370631f, 1.61697888f, -0.621727347f, -1.0f, 0.998165488f,
+		0.229260162f, -0.435076058f, 0.209548548f, 1.61697888f, -0.621727347f, -1.0f, 0.998165488f,
+		0.327904344f, -0.631895721f, 0.307726473f, 1.61697888f, -0.621727347f, -1.0f, 0.998165488f,
+		0.426548511f, -0.828715444f, 0.405904382f, 1.61697888f, -0.621727347f, -1.0f, 0.998165488f,
+		0.525192678f, -1.02553511f, 0.504082263f, 1.61697888f, -0.621727347f, -1.0f, 0.998165488f,
+		0.623836875f, -1.22235477f, 0.602260172f, 1.61697888f, -0.621727347f, -1.0f, 0.998165488f,
+		0.722481072f, -1.41917455f, 0.700438142f, 1.61697888f, -0.621727347f, -1.0f, 0.998165488f,
+		0.821125209f, -1.61599422f, 0.798616052f, 1.61697888f, -0.621727347f, -1.0f, 0.998165488f,
+		0.0444812179f, -0.0622607619f, 0.0214802641f, 1.61745167f, -0.622157156f, -1.0f, 0.998167455f,
+		0.141850665f, -0.256535709f, 0.118388146f, 1.61745167f, -0.622157156f, -1.0f, 0.998167455f,
+		0.239220098f, -0.450810641f, 0.21529603f, 1.61745167f, -0.622157156f, -1.0f, 0.998167455f,
+		0.336589545f, -0.645085573f, 0.312203914f, 1.61745167f, -0.622157156f, -1.0f, 0.998167455f,
+		0.433958977f, -0.839360535f, 0.409111798f, 1.61745167f, -0.622157156f, -1.0f, 0.998167455f,
+		0.53132844f, -1.0336355f, 0.506019652f, 1.61745167f, -0.622157156f, -1.0f, 0.998167455f,
+		0.628697872f, -1.2279104f, 0.602927566f, 1.61745167f, -0.622157156f, -1.0f, 0.998167455f,
+		0.726067305f, -1.42218542f, 0.69983542f, 1.61745167f, -0.622157156f, -1.0f, 0.998167455f,
+		0.823436737f, -1.61646032f, 0.796743274f, 1.61745167f, -0.622157156f, -1.0f, 0.998167455f,
+		0.0566714481f, -0.0825531706f, 0.0295561235f, 1.61791182f, -0.6225757f, -1.0f, 0.998169422f,
+		0.152798682f, -0.274348289f, 0.125226364f, 1.61791182f, -0.6225757f, -1.0f, 0.998169422f,
+		0.248925909f, -0.466143399f, 0.220896617f, 1.61791182f, -0.6225757f, -1.0f, 0.998169422f,
+		0.345053136f, -0.65793854f, 0.316566855f, 1.61791182f, -0.6225757f, -1.0f, 0.998169422f,
+		0.441180378f, -0.849733651f, 0.412237108f, 1.61791182f, -0.6225757f, -1.0f, 0.998169422f,
+		0.53730762f, -1.04152882f, 0.507907331f, 1.61791182f, -0.6225757f, -1.0f, 0.998169422f,
+		0.633434832f, -1.23332393f, 0.603577554f, 1.61791182f, -0.6225757f, -1.0f, 0.998169422f,
+		0.729562044f, -1.42511904f, 0.699247837f, 1.61791182f, -0.6225757f, -1.0f, 0.998169422f,
+		0.825689316f, -1.61691415f, 0.79491806f, 1.61791182f, -0.6225757f, -1.0f, 0.998169422f,
+		0.0685545579f, -0.102333978f, 0.0374282897f, 1.61835992f, -0.622983396f, -1.0f, 0.998171389f,
+		0.163470879f, -0.291711748f, 0.13189207f, 1.61835992f, -0.622983396f, -1.0f, 0.998171389f,
+		0.258387178f, -0.481089503f, 0.226355851f, 1.61835992f, -0.622983396f, -1.0f, 0.998171389f,
+		0.353303492f, -0.670467257f, 0.320819616f, 1.61835992f, -0.622983396f, -1.0f, 0.998171389f,
+		0.448219836f, -0.859845042f, 0.415283412f, 1.61835992f, -0.622983396f, -1.0f, 0.998171389f,
+		0.54313612f, -1.04922283f, 0.509747207f, 1.61835992f, -0.622983396f, -1.0f, 0.998171389f,
+		0.638052464f, -1.23860061f, 0.604210973f, 1.61835992f, -0.622983396f, -1.0f, 0.998171389f,
+		0.732968748f, -1.4279784f, 0.698674738f, 1.61835992f, -0.622983396f, -1.0f, 0.998171389f,
+		0.827885091f, -1.61735606f, 0.793138504f, 1.61835992f, -0.622983396f, -1.0f, 0.998171389f,
+		0.0801420063f, -0.121622279f, 0.0451043621f, 1.61879635f, -0.623380661f, -1.0f, 0.998173416f,
+		0.173877537f, -0.308642834f, 0.138391688f, 1.61879635f, -0.623380661f, -1.0f, 0.998173416f,
+		0.267613053f, -0.495663375f, 0.231679022f, 1.61879635f, -0.623380661f, -1.0f, 0.998173416f,
+		0.361348599f, -0.682683945f, 0.324966341f, 1.61879635f, -0.623380661f, -1.0f, 0.998173416f,
+		0.455084115f, -0.869704485f, 0.41825366f, 1.61879635f, -0.623380661f, -1.0f, 0.998173416f,
+		0.548819661f, -1.05672503f, 0.511541009f, 1.61879635f, -0.623380661f, -1.0f, 0.998173416f,
+		0.642555177f, -1.24374557f, 0.604828298f, 1.61879635f, -0.623380661f, -1.0f, 0.998173416f,
+		0.736290693f, -1.43076611f, 0.698115647f, 1.61879635f, -0.623380661f, -1.0f, 0.998173416f,
+		0.830026269f, -1.61778665f, 0.791402996f, 1.61879635f, -0.623380661f, -1.0f, 0.998173416f,
+		0.0914446935f, -0.140436232f, 0.052591566f, 1.61922157f, -0.623767793f, -1.0f, 0.998175442f,
+		0.184028462f, -0.325157493f, 0.144731343f, 1.61922157f, -0.623767793f, -1.0f, 0.998175442f,
+		0.276612222f, -0.509878755f, 0.236871123f, 1.61922157f, -0.623767793f, -1.0f, 0.998175442f,
+		0.369195968f, -0.694599986f, 0.329010904f, 1.61922157f, -0.623767793f, -1.0f, 0.998175442f,
+		0.461779743f, -0.879321218f, 0.421150684f, 1.61922157f, -0.623767793f, -1.0f, 0.998175442f,
+		0.554363489f, -1.06404245f, 0.513290465f, 1.61922157f, -0.623767793f, -1.0f, 0.998175442f,
+		0.646947265f, -1.2487638f, 0.605430245f, 1.61922157f, -0.623767793f, -1.0f, 0.998175442f,
+		0.73953104f, -1.43348503f, 0.697570026f, 1.61922157f, -0.623767793f, -1.0f, 0.998175442f,
+		0.832114816f, -1.61820626f, 0.789709806f, 1.61922157f, -0.623767793f, -1.0f, 0.998175442f,
+		0.102472991f, -0.158793092f, 0.059896782f, 1.61963606f, -0.62414521f, -1.0f, 0.998177469f,
+		0.19393295f, -0.341270864f, 0.15091686f, 1.61963606f, -0.62414521f, -1.0f, 0.998177469f,
+		0.28539291f, -0.523748636f, 0.241936937f, 1.61963606f, -0.62414521f, -1.0f, 0.998177469f,
+		0.37685284f, -0.706226408f, 0.332957029f, 1.61963606f, -0.62414521f, -1.0f, 0.998177469f,
+		0.4683128f, -0.888704181f, 0.423977107f, 1.61963606f, -0.62414521f, -1.0f, 0.998177469f,
+		0.559772789f, -1.07118189f, 0.514997184f, 1.61963606f, -0.62414521f, -1.0f, 0.998177469f,
+		0.651232719f, -1.25365973f, 0.606017292f, 1.61963606f, -0.62414521f, -1.0f, 0.998177469f,
+		0.742692649f, -1.43613744f, 0.697037339f, 1.61963606f, -0.62414521f, -1.0f, 0.998177469f,
+		0.834152639f, -1.61861527f, 0.788057446f, 1.61963606f, -0.62414521f, -1.0f, 0.998177469f,
+		0.0059486879f, 0.00189384934f, -0.00405483879f, 1.61706543f, -0.621507883f, -1.0f, 0.998679578f,
+		0.107244678f, -0.200382546f, 0.0969271809f, 1.61706543f, -0.621507883f, -1.0f, 0.998679578f,
+		0.208540663f, -0.402658939f, 0.197909191f, 1.61706543f, -0.621507883f, -1.0f, 0.998679578f,
+		0.309836656f, -0.604935288f, 0.298891217f, 1.61706543f, -0.621507883f, -1.0f, 0.998679578f,
+		0.411132663f, -0.807211697f, 0.399873227f, 1.61706543f, -0.621507883f, -1.0f, 0.998679578f,
+		0.512428641f, -1.00948811f, 0.500855267f, 1.61706543f, -0.621507883f, -1.0f, 0.998679578f,
+		0.613724649f, -1.21176445f, 0.601837277f, 1.61706543f, -0.621507883f, -1.0f, 0.998679578f,
+		0.715020597f, -1.41404092f, 0.702819288f, 1.61706543f, -0.621507883f, -1.0f, 0.998679578f,
+		0.816316605f, -1.61631727f, 0.803801298f, 1.61706543f, -0.621507883f, -1.0f, 0.998679578f,
+		0.0191351846f, -0.020079501f, 0.0046958467f, 1.61757374f, -0.621967733f, -1.0f, 0.998680234f,
+		0.119087443f, -0.219672024f, 0.104337715f, 1.61757374f, -0.621967733f, -1.0f, 0.998680234f,
+		0.219039693f, -0.419264555f, 0.203979582f, 1.61757374f, -0.621967733f, -1.0f, 0.998680234f,
+		0.318991959f, -0.618857086f, 0.303621441f, 1.61757374f, -0.621967733f, -1.0f, 0.998680234f,
+		0.41894421f, -0.818449616f, 0.403263301f, 1.61757374f, -0.621967733f, -1.0f, 0.998680234f,
+		0.518896461f, -1.01804209f, 0.50290519f, 1.61757374f, -0.621967733f, -1.0f, 0.998680234f,
+		0.618848741f, -1.21763468f, 0.60254705f, 1.61757374f, -0.621967733f, -1.0f, 0.998680234f,
+		0.718800962f, -1.41722715f, 0.702188909f, 1.61757374f, -0.621967733f, -1.0f, 0.998680234f,
+		0.818753242f, -1.61681974f, 0.801830769f, 1.61757374f, -0.621967733f, -1.0f, 0.998680234f,
+		0.0319764093f, -0.0414773598f, 0.0132173076f, 1.61806846f, -0.622415364f, -1.0f, 0.99868089f,
+		0.130620122f, -0.238456294f, 0.111554109f, 1.61806846f, -0.622415364f, -1.0f, 0.99868089f,
+		0.229263827f, -0.435435206f, 0.209890917f, 1.61806846f, -0.622415364f, -1.0f, 0.99868089f,
+		0.327907532f, -0.632414162f, 0.308227718f, 1.61806846f, -0.622415364f, -1.0f, 0.99868089f,
+		0.426551253f, -0.829393089f, 0.406564504f, 1.61806846f, -0.622415364f, -1.0f, 0.99868089f,
+		0.525194943f, -1.02637196f, 0.50490129f, 1.61806846f, -0.622415364f, -1.0f, 0.99868089f,
+		0.623838663f, -1.22335088f, 0.603238106f, 1.61806846f, -0.622415364f, -1.0f, 0.99868089f,
+		0.722482383f, -1.42032981f, 0.701574922f, 1.61806846f, -0.622415364f, -1.0f, 0.99868089f,
+		0.821126103f, -1.61730874f, 0.799911737f, 1.61806846f, -0.622415364f, -1.0f, 0.99868089f,
+		0.0444857553f, -0.0623220317f, 0.0215184297f, 1.6185503f, -0.622851312f, -1.0f, 0.998681605f,
+		0.141854733f, -0.256754905f, 0.118583895f, 1.6185503f, -0.622851312f, -1.0f, 0.998681605f,
+		0.239223719f, -0.451187789f, 0.215649366f, 1.6185503f, -0.622851312f, -1.0f, 0.998681605f,
+		0.336592704f, -0.645620704f, 0.312714815f, 1.6185503f, -0.622851312f, -1.0f, 0.998681605f,
+		0.43396166f, -0.840053558f, 0.409780294f, 1.6185503f, -0.622851312f, -1.0f, 0.998681605f,
+		0.531330645f, -1.03448641f, 0.506845772f, 1.6185503f, -0.622851312f, -1.0f, 0.998681605f,
+		0.62869966f, -1.22891927f, 0.603911221f, 1.6185503f, -0.622851312f, -1.0f, 0.998681605f,
+		0.726068616f, -1.42335224f, 0.70097667f, 1.6185503f, -0.622851312f, -1.0f, 0.998681605f,
+		0.823437572f, -1.6177851f, 0.798042178f, 1.6185503f, -0.622851312f, -1.0f, 0.998681605f,
+		0.0566759184f, -0.0826346949f, 0.0296076462f, 1.61901963f, -0.623275995f, -1.0f, 0.998682261f,
+		0.152802691f, -0.274586499f, 0.125434205f, 1.61901963f, -0.623275995f, -1.0f, 0.998682261f,
+		0.248929471f, -0.46653828f, 0.221260771f, 1.61901963f, -0.623275995f, -1.0f, 0.998682261f,
+		0.345056236f, -0.658490062f, 0.317087352f, 1.61901963f, -0.623275995f, -1.0f, 0.998682261f,
+		0.441183031f, -0.850441873f, 0.412913918f, 1.61901963f, -0.623275995f, -1.0f, 0.998682261f,
+		0.537309766f, -1.04239368f, 0.508740485f, 1.61901963f, -0.623275995f, -1.0f, 0.998682261f,
+		0.633436561f, -1.23434544f, 0.604567051f, 1.61901963f, -0.623275995f, -1.0f, 0.998682261f,
+		0.729563355f, -1.42629731f, 0.700393617f, 1.61901963f, -0.623275995f, -1.0f, 0.998682261f,
+		0.82569015f, -1.61824906f, 0.796220183f, 1.61901963f, -0.623275995f, -1.0f, 0.998682261f,
+		0.0685589612f, -0.102435455f, 0.0374929644f, 1.61947691f, -0.62368983f, -1.0f, 0.998682976f,
+		0.163474828f, -0.291968673f, 0.132111847f, 1.61947691f, -0.62368983f, -1.0f, 0.998682976f,
+		0.258390695f, -0.481501877f, 0.226730719f, 1.61947691f, -0.62368983f, -1.0f, 0.998682976f,
+		0.353306562f, -0.671035111f, 0.321349591f, 1.61947691f, -0.62368983f, -1.0f, 0.998682976f,
+		0.448222429f, -0.860568285f, 0.415968478f, 1.61947691f, -0.62368983f, -1.0f, 0.998682976f,
+		0.543138325f, -1.05010152f, 0.510587335f, 1.61947691f, -0.62368983f, -1.0f, 0.998682976f,
+		0.638054192f, -1.23963475f, 0.605206251f, 1.61947691f, -0.62368983f, -1.0f, 0.998682976f,
+		0.732970059f, -1.42916799f, 0.699825108f, 1.61947691f, -0.62368983f, -1.0f, 0.998682976f,
+		0.827885926f, -1.61870122f, 0.794443965f, 1.61947691f, -0.62368983f, -1.0f, 0.998682976f,
+		0.08014635f, -0.121743403f, 0.0451819934f, 1.61992264f, -0.624093294f, -1.0f, 0.998683691f,
+		0.173881441f, -0.308918208f, 0.138623223f, 1.61992264f, -0.624093294f, -1.0f, 0.998683691f,
+		0.26761651f, -0.496093005f, 0.232064456f, 1.61992264f, -0.624093294f, -1.0f, 0.998683691f,
+		0.361351609f, -0.683267832f, 0.325505704f, 1.61992264f, -0.624093294f, -1.0f, 0.998683691f,
+		0.455086708f, -0.870442629f, 0.418946922f, 1.61992264f, -0.624093294f, -1.0f, 0.998683691f,
+		0.548821807f, -1.05761743f, 0.51238817f, 1.61992264f, -0.624093294f, -1.0f, 0.998683691f,
+		0.642556846f, -1.24479222f, 0.605829418f, 1.61992264f, -0.624093294f, -1.0f, 0.998683691f,
+		0.736291945f, -1.43196702f, 0.699270606f, 1.61992264f, -0.624093294f, -1.0f, 0.998683691f,
+		0.830027044f, -1.61914182f, 0.792711854f, 1.61992264f, -0.624093294f, -1.0f, 0.998683691f,
+		0.0914489776f, -0.14057672f, 0.0526819676f, 1.62035716f, -0.624486685f, -1.0f, 0.998684347f,
+		0.184032306f, -0.325451076f, 0.1449745f, 1.62035716f, -0.624486685f, -1.0f, 0.998684347f,
+		0.27661562f, -0.510325432f, 0.237267017f, 1.62035716f, -0.624486685f, -1.0f, 0.998684347f,
+		0.369198948f, -0.695199788f, 0.329559565f, 1.62035716f, -0.624486685f, -1.0f, 0.998684347f,
+		0.461782277f, -0.880074143f, 0.421852082f, 1.62035716f, -0.624486685f, -1.0f, 0.998684347f,
+		0.554365575f, -1.06494844f, 0.514144599f, 1.62035716f, -0.624486685f, -1.0f, 0.998684347f,
+		0.646948934f, -1.24982285f, 0.606437147f, 1.62035716f, -0.624486685f, -1.0f, 0.998684347f,
+		0.739532232f, -1.43469727f, 0.698729694f, 1.62035716f, -0.624486685f, -1.0f, 0.998684347f,
+		0.832115591f, -1.61957157f, 0.791022182f, 1.62035716f, -0.624486685f, -1.0f, 0.998684347f,
+		0.102477215f, -0.158952683f, 0.0599997714f, 1.62078094f, -0.62487042f, -1.0f, 0.998685062f,
+		0.193936735f, -0.341582417f, 0.151171476f, 1.62078094f, -0.62487042f, -1.0f, 0.998685062f,
+		0.285396248f, -0.524212182f, 0.242343187f, 1.62078094f, -0.62487042f, -1.0f, 0.998685062f,
+		0.376855791f, -0.706841946f, 0.333514899f, 1.62078094f, -0.62487042f, -1.0f, 0.998685062f,
+		0.468315303f, -0.88947165f, 0.424686611f, 1.62078094f, -0.62487042f, -1.0f, 0.998685062f,
+		0.559774816f, -1.07210147f, 0.515858293f, 1.62078094f, -0.62487042f, -1.0f, 0.998685062f,
+		0.651234329f, -1.25473118f, 0.607030034f, 1.62078094f, -0.62487042f, -1.0f, 0.998685062f,
+		0.742693901f, -1.43736088f, 0.698201716f, 1.62078094f, -0.62487042f, -1.0f, 0.998685062f,
+		0.834153414f, -1.61999071f, 0.789373457f, 1.62078094f, -0.62487042f, -1.0f, 0.998685062f,
+		0.0059518395f, 0.00189485261f, -0.00405698642f, 1.61771739f, -0.621919215f, -1.0f, 0.999082029f,
+		0.107247509f, -0.20048897f, 0.0970322266f, 1.61771739f, -0.621919215f, -1.0f, 0.999082029f,
+		0.208543181f, -0.402872801f, 0.198121443f, 1.61771739f, -0.621919215f, -1.0f, 0.999082029f,
+		0.309838861f, -0.605256617f, 0.299210668f, 1.61771739f, -0.621919215f, -1.0f, 0.999082029f,
+		0.411134511f, -0.807640433f, 0.400299877f, 1.61771739f, -0.621919215f, -1.0f, 0.999082029f,
+		0.512430191f, -1.01002431f, 0.501389086f, 1.61771739f, -0.621919215f, -1.0f, 0.999082029f,
+		0.613725841f, -1.21240807f, 0.602478325f, 1.61771739f, -0.621919215f, -1.0f, 0.999082029f,
+		0.715021551f, -1.41479194f, 0.703567505f, 1.61771739f, -0.621919215f, -1.0f, 0.999082029f,
+		0.816317201f, -1.6171757f, 0.804656744f, 1.61771739f, -0.621919215f, -1.0f, 0.999082029f,
+		0.0191382803f, -0.0200925898f, 0.00470299507f, 1.61822951f, -0.622381687f, -1.0f, 0.999082267f,
+		0.119090222f, -0.219791457f, 0.104450971f, 1.61822951f, -0.622381687f, -1.0f, 0.999082267f,
+		0.219042167f, -0.419490337f, 0.204198942f, 1.61822951f, -0.622381687f, -1.0f, 0.999082267f,
+		0.318994105f, -0.619189203f, 0.303946912f, 1.61822951f, -0.622381687f, -1.0f, 0.999082267f,
+		0.418946058f, -0.818888068f, 0.403694898f, 1.61822951f, -0.622381687f, -1.0f, 0.999082267f,
+		0.51889801f, -1.01858687f, 0.503442883f, 1.61822951f, -0.622381687f, -1.0f, 0.999082267f,
+		0.618849933f, -1.2182858f, 0.603190839f, 1.61822951f, -0.622381687f, -1.0f, 0.999082267f,
+		0.718801856f, -1.41798472f, 0.702938855f, 1.61822951f, -0.622381687f, -1.0f, 0.999082267f,
+		0.818753839f, -1.61768353f, 0.80268681f, 1.61822951f, -0.622381687f, -1.0f, 0.999082267f,
+		0.0319794565f, -0.0415042602f, 0.0132335667f, 1.61872816f, -0.622832f, -1.0f, 0.999082446f,
+		0.130622849f, -0.238588467f, 0.111675419f, 1.61872816f, -0.622832f, -1.0f, 0.999082446f,
+		0.229266256f, -0.4356727f, 0.21011728f, 1.61872816f, -0.622832f, -1.0f, 0.999082446f,
+		0.327909648f, -0.632756889f, 0.30855912f, 1.61872816f, -0.622832f, -1.0f, 0.999082446f,
+		0.426553041f, -0.829841137f, 0.407000989f, 1.61872816f, -0.622832f, -1.0f, 0.999082446f,
+		0.525196433f, -1.02692533f, 0.505442858f, 1.61872816f, -0.622832f, -1.0f, 0.999082446f,
+		0.623839855f, -1.22400951f, 0.603884697f, 1.61872816f, -0.622832f, -1.0f, 0.999082446f,
+		0.722483218f, -1.4210937f, 0.702326536f, 1.61872816f, -0.622832f, -1.0f, 0.999082446f,
+		0.82112664f, -1.61817801f, 0.800768375f, 1.61872816f, -0.622832f, -1.0f, 0.999082446f,
+		0.0444887504f, -0.0623624772f, 0.021543622f, 1.61921382f, -0.623270571f, -1.0f, 0.999082685f,
+		0.14185743f, -0.256899625f, 0.118713111f, 1.61921382f, -0.623270571f, -1.0f, 0.999082685f,
+		0.239226103f, -0.451436758f, 0.215882599f, 1.61921382f, -0.623270571f, -1.0f, 0.999082685f,
+		0.33659476f, -0.645973861f, 0.313052088f, 1.61921382f, -0.623270571f, -1.0f, 0.999082685f,
+		0.433963448f, -0.840511024f, 0.410221577f, 1.61921382f, -0.623270571f, -1.0f, 0.999082685f,
+		0.531332135f, -1.03504813f, 0.507391036f, 1.61921382f, -0.623270571f, -1.0f, 0.999082685f,
+		0.628700793f, -1.22958529f, 0.604560554f, 1.61921382f, -0.623270571f, -1.0f, 0.999082685f,
+		0.72606945f, -1.42412245f, 0.701730013f, 1.61921382f, -0.623270571f, -1.0f, 0.999082685f,
+		0.823438168f, -1.61865962f, 0.798899531f, 1.61921382f, -0.623270571f, -1.0f, 0.999082685f,
+		0.0566788614f, -0.082688421f, 0.0296416003f, 1.61968708f, -0.623697996f, -1.0f, 0.999082863f,
+		0.152805343f, -0.274743468f, 0.125571191f, 1.61968708f, -0.623697996f, -1.0f, 0.999082863f,
+		0.24893181f, -0.466798514f, 0.221500769f, 1.61968708f, -0.623697996f, -1.0f, 0.999082863f,
+		0.345058292f, -0.658853531f, 0.317430347f, 1.61968708f, -0.623697996f, -1.0f, 0.999082863f,
+		0.441184759f, -0.850908577f, 0.41335994f, 1.61968708f, -0.623697996f, -1.0f, 0.999082863f,
+		0.537311256f, -1.04296362f, 0.509289503f, 1.61968708f, -0.623697996f, -1.0f, 0.999082863f,
+		0.633437693f, -1.23501873f, 0.605219126f, 1.61968708f, -0.623697996f, -1.0f, 0.999082863f,
+		0.72956419f, -1.42707372f, 0.701148689f, 1.61968708f, -0.623697996f, -1.0f, 0.999082863f,
+		0.825690687f, -1.61912882f, 0.797078252f, 1.61968708f, -0.623697996f, -1.0f, 0.999082863f,
+		0.0685618594f, -0.102502212f, 0.0375355147f, 1.62014818f, -0.624114513f, -1.0f, 0.999083102f,
+		0.163477436f, -0.292137712f, 0.132256433f, 1.62014818f, -0.624114513f, -1.0f, 0.999083102f,
+		0.25839299f, -0.481773198f, 0.226977348f, 1.62014818f, -0.624114513f, -1.0f, 0.999083102f,
+		0.353308588f, -0.671408653f, 0.321698278f, 1.62014818f, -0.624114513f, -1.0f, 0.999083102f,
+		0.448224157f, -0.861044168f, 0.416419208f, 1.62014818f, -0.624114513f, -1.0f, 0.999083102f,
+		0.543139696f, -1.05067968f, 0.511140108f, 1.62014818f, -0.624114513f, -1.0f, 0.999083102f,
+		0.638055265f, -1.2403152f, 0.605861008f, 1.62014818f, -0.624114513f, -1.0f, 0.999083102f,
+		0.732970893f, -1.42995059f, 0.700581968f, 1.62014818f, -0.624114513f, -1.0f, 0.999083102f,
+		0.827886462f, -1.61958611f, 0.795302868f, 1.62014818f, -0.624114513f, -1.0f, 0.999083102f,
+		0.0801492035f, -0.121822961f, 0.0452329852f, 1.62059784f, -0.624520659f, -1.0f, 0.99908334f,
+		0.173884004f, -0.309099108f, 0.138775304f, 1.62059784f, -0.624520659f, -1.0f, 0.99908334f,
+		0.267618805f, -0.496375233f, 0.232317641f, 1.62059784f, -0.624520659f, -1.0f, 0.99908334f,
+		0.361353606f, -0.683651388f, 0.325859964f, 1.62059784f, -0.624520659f, -1.0f, 0.99908334f,
+		0.455088377f, -0.870927513f, 0.419402301f, 1.62059784f, -0.624520659f, -1.0f, 0.99908334f,
+		0.548823178f, -1.05820358f, 0.512944639f, 1.62059784f, -0.624520659f, -1.0f, 0.99908334f,
+		0.642557979f, -1.2454797f, 0.606486917f, 1.62059784f, -0.624520659f, -1.0f, 0.99908334f,
+		0.736292779f, -1.43275583f, 0.700029254f, 1.62059784f, -0.624520659f, -1.0f, 0.99908334f,
+		0.83002758f, -1.62003207f, 0.793571591f, 1.62059784f, -0.624520659f, -1.0f, 0.99908334f,
+		0.0914517865f, -0.140668839f, 0.0527412482f, 1.62103641f, -0.624916792f, -1.0f, 0.999083579f,
+		0.184034824f, -0.325643599f, 0.145133942f, 1.62103641f, -0.624916792f, -1.0f, 0.999083579f,
+		0.276617855f, -0.510618329f, 0.23752664f, 1.62103641f, -0.624916792f, -1.0f, 0.999083579f,
+		0.369200915f, -0.695593119f, 0.329919338f, 1.62103641f, -0.624916792f, -1.0f, 0.999083579f,
+		0.461783946f, -0.880567849f, 0.422312021f, 1.62103641f, -0.624916792f, -1.0f, 0.999083579f,
+		0.554367006f, -1.06554258f, 0.514704704f, 1.62103641f, -0.624916792f, -1.0f, 0.999083579f,
+		0.646950006f, -1.25051737f, 0.607097447f, 1.62103641f, -0.624916792f, -1.0f, 0.999083579f,
+		0.739533067f, -1.43549216f, 0.69949013f, 1.62103641f, -0.624916792f, -1.0f, 0.999083579f,
+		0.832116067f, -1.62046683f, 0.791882813f, 1.62103641f, -0.624916792f, -1.0f, 0.999083579f,
+		0.102479979f, -0.159057155f, 0.0600671954f, 1.62146413f, -0.625303209f, -1.0f, 0.999083757f,
+		0.193939224f, -0.341786385f, 0.151338175f, 1.62146413f, -0.625303209f, -1.0f, 0.999083757f,
+		0.285398453f, -0.524515629f, 0.242609143f, 1.62146413f, -0.625303209f, -1.0f, 0.999083757f,
+		0.376857698f, -0.707244873f, 0.333880126f, 1.62146413f, -0.625303209f, -1.0f, 0.999083757f,
+		0.468316942f, -0.889974117f, 0.42515108f, 1.62146413f, -0.625303209f, -1.0f, 0.999083757f,
+		0.559776187f, -1.07270336f, 0.516422093f, 1.62146413f, -0.625303209f, -1.0f, 0.999083757f,
+		0.651235461f, -1.25543261f, 0.607693017f, 1.62146413f, -0.625303209f, -1.0f, 0.999083757f,
+		0.742694676f, -1.43816185f, 0.698964f, 1.62146413f, -0.625303209f, -1.0f, 0.999083757f,
+		0.834153891f, -1.62089109f, 0.790234983f, 1.62146413f, -0.625303209f, -1.0f, 0.999083757f,
+	},
+	// Soldano SLO
+	{
+		0.0156565048f, 0.00209615193f, -0.0135603538f, 1.76401412f, -0.773316503f, -1.0f, 0.991451025f,
+		0.127875477f, -0.218016237f, 0.0943845809f, 1.76401412f, -0.773316503f, -1.0f, 0.991451025f,
+		0.240094468f, -0.43812862f, 0.202329516f, 1.76401412f, -0.773316503f, -1.0f, 0.991451025f,
+		0.352313429f, -0.658240974f, 0.310274452f, 1.76401412f, -0.773316503f, -1.0f, 0.991451025f,
+		0.464532405f, -0.878353357f, 0.418219388f, 1.76401412f, -0.773316503f, -1.0f, 0.991451025f,
+		0.576751411f, -1.0984658f, 0.526164293f, 1.76401412f, -0.773316503f, -1.0f, 0.991451025f,
+		0.688970387f, -1.31857812f, 0.634109259f, 1.76401412f, -0.773316503f, -1.0f, 0.991451025f,
+		0.801189363f, -1.53869057f, 0.742054164f, 1.76401412f, -0.773316503f, -1.0f, 0.991451025f,
+		0.913408339f, -1.75880289f, 0.84999913f, 1.76401412f, -0.773316503f, -1.0f, 0.991451025f,
+		0.0858435631f, -0.126887769f, 0.045368284f, 1.76550686f, -0.774863601f, -1.0f, 0.991669238f,
+		0.190060943f, -0.331082761f, 0.145396397f, 1.76550686f, -0.774863601f, -1.0f, 0.991669238f,
+		0.294278324f, -0.535277724f, 0.245424524f, 1.76550686f, -0.774863601f, -1.0f, 0.991669238f,
+		0.398495704f, -0.739472747f, 0.345452636f, 1.76550686f, -0.774863601f, -1.0f, 0.991669238f,
+		0.502713084f, -0.94366771f, 0.445480764f, 1.76550686f, -0.774863601f, -1.0f, 0.991669238f,
+		0.606930494f, -1.14786267f, 0.545508862f, 1.76550686f, -0.774863601f, -1.0f, 0.991669238f,
+		0.711147845f, -1.3520577f, 0.645536959f, 1.76550686f, -0.774863601f, -1.0f, 0.991669238f,
+		0.815365255f, -1.55625272f, 0.745565116f, 1.76550686f, -0.774863601f, -1.0f, 0.991669238f,
+		0.919582605f, -1.76044774f, 0.845593214f, 1.76550686f, -0.774863601f, -1.0f, 0.991669238f,
+		0.146685258f, -0.238387346f, 0.0961875841f, 1.76625001f, -0.775742412f, -1.0f, 0.991885185f,
+		0.24396646f, -0.428759933f, 0.189328894f, 1.76625001f, -0.775742412f, -1.0f, 0.991885185f,
+		0.341247648f, -0.619132519f, 0.282470226f, 1.76625001f, -0.775742412f, -1.0f, 0.991885185f,
+		0.438528836f, -0.809505105f, 0.375611544f, 1.76625001f, -0.775742412f, -1.0f, 0.991885185f,
+		0.535810053f, -0.999877751f, 0.468752831f, 1.76625001f, -0.775742412f, -1.0f, 0.991885185f,
+		0.633091211f, -1.19025028f, 0.561894178f, 1.76625001f, -0.775742412f, -1.0f, 0.991885185f,
+		0.730372429f, -1.38062286f, 0.655035496f, 1.76625001f, -0.775742412f, -1.0f, 0.991885185f,
+		0.827653587f, -1.57099545f, 0.748176813f, 1.76625001f, -0.775742412f, -1.0f, 0.991885185f,
+		0.924934804f, -1.76136816f, 0.84131813f, 1.76625001f, -0.775742412f, -1.0f, 0.991885185f,
+		0.199931189f, -0.335621506f, 0.140369609f, 1.76629353f, -0.776002347f, -1.0f, 0.992097497f,
+		0.291142136f, -0.513870239f, 0.227457091f, 1.76629353f, -0.776002347f, -1.0f, 0.992097497f,
+		0.382353097f, -0.692118943f, 0.314544559f, 1.76629353f, -0.776002347f, -1.0f, 0.992097497f,
+		0.473564029f, -0.870367646f, 0.401632041f, 1.76629353f, -0.776002347f, -1.0f, 0.992097497f,
+		0.56477499f, -1.04861629f, 0.488719493f, 1.76629353f, -0.776002347f, -1.0f, 0.992097497f,
+		0.655985951f, -1.22686505f, 0.575806975f, 1.76629353f, -0.776002347f, -1.0f, 0.992097497f,
+		0.747196913f, -1.4051137f, 0.662894428f, 1.76629353f, -0.776002347f, -1.0f, 0.992097497f,
+		0.838407815f, -1.58336246f, 0.74998188f, 1.76629353f, -0.776002347f, -1.0f, 0.992097497f,
+		0.929618776f, -1.7616111f, 0.837069392f, 1.76629353f, -0.776002347f, -1.0f, 0.992097497f,
+		0.246919766f, -0.421039104f, 0.179028958f, 1.76565289f, -0.775662065f, -1.0f, 0.99230516f,
+		0.332773834f, -0.588558078f, 0.260743737f, 1.76565289f, -0.775662065f, -1.0f, 0.99230516f,
+		0.418627888f, -0.756076992f, 0.342458516f, 1.76565289f, -0.775662065f, -1.0f, 0.99230516f,
+		0.504481971f, -0.923595905f, 0.424173266f, 1.76565289f, -0.775662065f, -1.0f, 0.99230516f,
+		0.590336025f, -1.09111488f, 0.505888045f, 1.76565289f, -0.775662065f, -1.0f, 0.99230516f,
+		0.676190138f, -1.25863385f, 0.587602854f, 1.76565289f, -0.775662065f, -1.0f, 0.99230516f,
+		0.762044191f, -1.42615271f, 0.669317603f, 1.76565289f, -0.775662065f, -1.0f, 0.99230516f,
+		0.847898245f, -1.59367168f, 0.751032352f, 1.76565289f, -0.775662065f, -1.0f, 0.99230516f,
+		0.933752298f, -1.76119065f, 0.832747161f, 1.76565289f, -0.775662065f, -1.0f, 0.99230516f,
+		0.288692296f, -0.49652794f, 0.21301797f, 1.76431072f, -0.774711251f, -1.0f, 0.992507517f,
+		0.369784117f, -0.654473066f, 0.289921731f, 1.76431072f, -0.774711251f, -1.0f, 0.992507517f,
+		0.450875968f, -0.812418163f, 0.366825491f, 1.76431072f, -0.774711251f, -1.0f, 0.992507517f,
+		0.531967819f, -0.970363259f, 0.443729252f, 1.76431072f, -0.774711251f, -1.0f, 0.992507517f,
+		0.61305964f, -1.12830842f, 0.520633042f, 1.76431072f, -0.774711251f, -1.0f, 0.992507517f,
+		0.694151461f, -1.28625345f, 0.597536802f, 1.76431072f, -0.774711251f, -1.0f, 0.992507517f,
+		0.775243342f, -1.44419861f, 0.674440563f, 1.76431072f, -0.774711251f, -1.0f, 0.992507517f,
+		0.856335163f, -1.60214365f, 0.751344323f, 1.76431072f, -0.774711251f, -1.0f, 0.992507517f,
+		0.937426984f, -1.7600888f, 0.828248084f, 1.76431072f, -0.774711251f, -1.0f, 0.992507517f,
+		0.326071024f, -0.563555777f, 0.24299033f, 1.76221418f, -0.773109317f, -1.0f, 0.992703915f,
+		0.40290156f, -0.712893128f, 0.315548658f, 1.76221418f, -0.773109317f, -1.0f, 0.992703915f,
+		0.479732066f, -0.86223042f, 0.388107002f, 1.76221418f, -0.773109317f, -1.0f, 0.992703915f,
+		0.556562603f, -1.01156783f, 0.460665315f, 1.76221418f, -0.773109317f, -1.0f, 0.992703915f,
+		0.633393109f, -1.16090512f, 0.533223629f, 1.76221418f, -0.773109317f, -1.0f, 0.992703915f,
+		0.710223615f, -1.31024241f, 0.605781972f, 1.76221418f, -0.773109317f, -1.0f, 0.992703915f,
+		0.787054121f, -1.45957983f, 0.678340316f, 1.76221418f, -0.773109317f, -1.0f, 0.992703915f,
+		0.863884628f, -1.60891712f, 0.7508986f, 1.76221418f, -0.773109317f, -1.0f, 0.992703915f,
+		0.940715194f, -1.75825441f, 0.823456943f, 1.76221418f, -0.773109317f, -1.0f, 0.992703915f,
+		0.359713882f, -0.62326628f, 0.269442976f, 1.75926948f, -0.770780206f, -1.0f, 0.992894173f,
+		0.432708979f, -0.764807522f, 0.33804217f, 1.75926948f, -0.770780206f, -1.0f, 0.992894173f,
+		0.505704105f, -0.906348825f, 0.406641334f, 1.75926948f, -0.770780206f, -1.0f, 0.992894173f,
+		0.578699172f, -1.04789007f, 0.475240529f, 1.75926948f, -0.770780206f, -1.0f, 0.992894173f,
+		0.651694298f, -1.18943143f, 0.543839693f, 1.75926948f, -0.770780206f, -1.0f, 0.992894173f,
+		0.724689364f, -1.33097267f, 0.612438917f, 1.75926948f, -0.770780206f, -1.0f, 0.992894173f,
+		0.797684491f, -1.47251403f, 0.681038082f, 1.75926948f, -0.770780206f, -1.0f, 0.992894173f,
+		0.870679617f, -1.61405528f, 0.749637246f, 1.75926948f, -0.770780206f, -1.0f, 0.992894173f,
+		0.943674684f, -1.75559652f, 0.81823647f, 1.75926948f, -0.770780206f, -1.0f, 0.992894173f,
+		0.390153348f, -0.67654264f, 0.292742074f, 1.7553283f, -0.767601967f, -1.0f, 0.993077934f,
+		0.459678233f, -0.81097132f, 0.357700914f, 1.7553283f, -0.767601967f, -1.0f, 0.993077934f,
+		0.529203117f, -0.9454f, 0.422659785f, 1.7553283f, -0.767601967f, -1.0f, 0.993077934f,
+		0.598728001f, -1.07982862f, 0.487618625f, 1.7553283f, -0.767601967f, -1.0f, 0.993077934f,
+		0.668252885f, -1.21425736f, 0.552577436f, 1.7553283f, -0.767601967f, -1.0f, 0.993077934f,
+		0.73777777f, -1.34868598f, 0.617536306f, 1.7553283f, -0.767601967f, -1.0f, 0.993077934f,
+		0.807302654f, -1.48311472f, 0.682495177f, 1.7553283f, -0.767601967f, -1.0f, 0.993077934f,
+		0.876827538f, -1.61754334f, 0.747453988f, 1.7553283f, -0.767601967f, -1.0f, 0.993077934f,
+		0.946352422f, -1.75197208f, 0.812412858f, 1.7553283f, -0.767601967f, -1.0f, 0.993077934f,
+		0.0157254264f, 0.00210537924f, -0.0136200478f, 1.77173805f, -0.779682219f, -1.0f, 0.992282093f,
+		0.127936542f, -0.218981981f, 0.0952959135f, 1.77173805f, -0.779682219f, -1.0f, 0.992282093f,
+		0.240147665f, -0.440069348f, 0.204211876f, 1.77173805f, -0.779682219f, -1.0f, 0.992282093f,
+		0.352358788f, -0.661156714f, 0.313127846f, 1.77173805f, -0.779682219f, -1.0f, 0.992282093f,
+		0.464569926f, -0.882244051f, 0.4220438f, 1.77173805f, -0.779682219f, -1.0f, 0.992282093f,
+		0.576781034f, -1.10333145f, 0.530959785f, 1.77173805f, -0.779682219f, -1.0f, 0.992282093f,
+		0.688992143f, -1.32441878f, 0.63987577f, 1.77173805f, -0.779682219f, -1.0f, 0.992282093f,
+		0.801203251f, -1.54550612f, 0.748791695f, 1.77173805f, -0.779682219f, -1.0f, 0.992282093f,
+		0.913414419f, -1.76659346f, 0.857707679f, 1.77173805f, -0.779682219f, -1.0f, 0.992282093f,
+		0.08591111f, -0.127556205f, 0.0458842292f, 1.7741574f, -0.782007933f, -1.0f, 0.992440999f,
+		0.190120786f, -0.332747817f, 0.146904603f, 1.7741574f, -0.782007933f, -1.0f, 0.992440999f,
+		0.294330478f, -0.537939429f, 0.247924969f, 1.7741574f, -0.782007933f, -1.0f, 0.992440999f,
+		0.398540169f, -0.743130982f, 0.348945349f, 1.7741574f, -0.782007933f, -1.0f, 0.992440999f,
+		0.50274986f, -0.948322594f, 0.449965715f, 1.7741574f, -0.782007933f, -1.0f, 0.992440999f,
+		0.606959522f, -1.15351415f, 0.550986111f, 1.7741574f, -0.782007933f, -1.0f, 0.992440999f,
+		0.711169183f, -1.35870576f, 0.652006447f, 1.7741574f, -0.782007933f, -1.0f, 0.992440999f,
+		0.815378904f, -1.56389737f, 0.753026843f, 1.7741574f, -0.782007933f, -1.0f, 0.992440999f,
+		0.919588566f, -1.76908898f, 0.854047179f, 1.7741574f, -0.782007933f, -1.0f, 0.992440999f,
+		0.146752387f, -0.239777118f, 0.0973154902f, 1.77596021f, -0.783776581f, -1.0f, 0.992601037f,
+		0.244025931f, -0.43117854f, 0.191480845f, 1.77596021f, -0.783776581f, -1.0f, 0.992601037f,
+		0.341299474f, -0.622579992f, 0.2856462f, 1.77596021f, -0.783776581f, -1.0f, 0.992601037f,
+		0.438573003f, -0.813981414f, 0.379811585f, 1.77596021f, -0.783776581f, -1.0f, 0.992601037f,
+		0.535846531f, -1.00538278f, 0.47397694f, 1.77596021f, -0.783776581f, -1.0f, 0.992601037f,
+		0.63312006f, -1.19678426f, 0.568142295f, 1.77596021f, -0.783776581f, -1.0f, 0.992601037f,
+		0.730393648f, -1.38818562f, 0.66230768f, 1.77596021f, -0.783776581f, -1.0f, 0.992601037f,
+		0.827667177f, -1.5795871f, 0.756473005f, 1.77596021f, -0.783776581f, -1.0f, 0.992601037f,
+		0.924940705f, -1.77098846f, 0.85063839f, 1.77596021f, -0.783776581f, -1.0f, 0.992601037f,
+		0.199998796f, -0.337799698f, 0.142165676f, 1.77722752f, -0.785063505f, -1.0f, 0.992761254f,
+		0.291202039f, -0.517120898f, 0.230320409f, 1.77722752f, -0.785063505f, -1.0f, 0.992761254f,
+		0.382405281f, -0.696442127f, 0.318475157f, 1.77722752f, -0.785063505f, -1.0f, 0.992761254f,
+		0.473608524f, -0.875763357f, 0.40662989f, 1.77722752f, -0.785063505f, -1.0f, 0.992761254f,
+		0.564811766f, -1.05508459f, 0.494784623f, 1.77722752f, -0.785063505f, -1.0f, 0.992761254f,
+		0.656014979f, -1.23440576f, 0.582939327f, 1.77722752f, -0.785063505f, -1.0f, 0.992761254f,
+		0.747218251f, -1.41372705f, 0.67109406f, 1.77722752f, -0.785063505f, -1.0f, 0.992761254f,
+		0.838421464f, -1.59304821f, 0.759248793f, 1.77722752f, -0.785063505f, -1.0f, 0.992761254f,
+		0.929624736f, -1.77236938f, 0.847403526f, 1.77722752f, -0.785063505f, -1.0f, 0.992761254f,
+		0.246988744f, -0.424100161f, 0.181572616f, 1.77801514f, -0.785921097f, -1.0f, 0.992920578f,
+		0.332834959f, -0.592748225f, 0.264410764f, 1.77801514f, -0.785921097f, -1.0f, 0.992920578f,
+		0.418681145f, -0.761396289f, 0.347248882f, 1.77801514f, -0.785921097f, -1.0f, 0.992920578f,
+		0.50452739f, -0.930044353f, 0.43008703f, 1.77801514f, -0.785921097f, -1.0f, 0.992920578f,
+		0.590373576f, -1.09869242f, 0.512925148f, 1.77801514f, -0.785921097f, -1.0f, 0.992920578f,
+		0.676219761f, -1.26734054f, 0.595763326f, 1.77801514f, -0.785921097f, -1.0f, 0.992920578f,
+		0.762066007f, -1.43598855f, 0.678601444f, 1.77801514f, -0.785921097f, -1.0f, 0.992920578f,
+		0.847912192f, -1.60463667f, 0.761439562f, 1.77801514f, -0.785921097f, -1.0f, 0.992920578f,
+		0.933758378f, -1.77328479f, 0.84427768f, 1.77801514f, -0.785921097f, -1.0f, 0.992920578f,
+		0.288763583f, -0.500600159f, 0.216417357f, 1.7783587f, -0.786383867f, -1.0f, 0.993078172f,
+		0.369847298f, -0.65974617f, 0.294515669f, 1.7783587f, -0.786383867f, -1.0f, 0.993078172f,
+		0.450931013f, -0.818892181f, 0.372613966f, 1.7783587f, -0.786383867f, -1.0f, 0.993078172f,
+		0.532014728f, -0.978038192f, 0.450712264f, 1.7783587f, -0.786383867f, -1.0f, 0.993078172f,
+		0.613098443f, -1.13718426f, 0.528810561f, 1.7783587f, -0.786383867f, -1.0f, 0.993078172f,
+		0.694182158f, -1.29633021f, 0.606908858f, 1.7783587f, -0.786383867f, -1.0f, 0.993078172f,
+		0.775265872f, -1.45547628f, 0.685007155f, 1.7783587f, -0.786383867f, -1.0f, 0.993078172f,
+		0.856349587f, -1.61462224f, 0.763105452f, 1.7783587f, -0.786383867f, -1.0f, 0.993078172f,
+		0.937433302f, -1.77376831f, 0.841203749f, 1.7783587f, -0.786383867f, -1.0f, 0.993078172f,
+		0.326145679f, -0.568811357f, 0.247390628f, 1.77827752f, -0.786471307f, -1.0f, 0.993233502f,
+		0.402967691f, -0.719439685f, 0.321232885f, 1.77827752f, -0.786471307f, -1.0f, 0.993233502f,
+		0.479789704f, -0.870068014f, 0.395075142f, 1.77827752f, -0.786471307f, -1.0f, 0.993233502f,
+		0.556611717f, -1.02069628f, 0.46891737f, 1.77827752f, -0.786471307f, -1.0f, 0.993233502f,
+		0.6334337f, -1.17132461f, 0.542759657f, 1.77827752f, -0.786471307f, -1.0f, 0.993233502f,
+		0.710255742f, -1.32195294f, 0.616601884f, 1.77827752f, -0.786471307f, -1.0f, 0.993233502f,
+		0.787077725f, -1.47258127f, 0.690444112f, 1.77827752f, -0.786471307f, -1.0f, 0.993233502f,
+		0.863899708f, -1.6232096f, 0.764286399f, 1.77827752f, -0.786471307f, -1.0f, 0.993233502f,
+		0.94072175f, -1.77383792f, 0.838128626f, 1.77827752f, -0.786471307f, -1.0f, 0.993233502f,
+		0.359793097f, -0.62993598f, 0.275038987f, 1.77777576f, -0.786189735f, -1.0f, 0.993385911f,
+		0.432779163f, -0.77288115f, 0.345034152f, 1.77777576f, -0.786189735f, -1.0f, 0.993385911f,
+		0.505765259f, -0.915826321f, 0.415029317f, 1.77777576f, -0.786189735f, -1.0f, 0.993385911f,
+		0.578751326f, -1.05877149f, 0.485024482f, 1.77777576f, -0.786189735f, -1.0f, 0.993385911f,
+		0.651737392f, -1.20171666f, 0.555019617f, 1.77777576f, -0.786189735f, -1.0f, 0.993385911f,
+		0.724723458f, -1.34466183f, 0.625014782f, 1.77777576f, -0.786189735f, -1.0f, 0.993385911f,
+		0.797709525f, -1.487607f, 0.695009947f, 1.77777576f, -0.786189735f, -1.0f, 0.993385911f,
+		0.870695591f, -1.63055217f, 0.765005112f, 1.77777576f, -0.786189735f, -1.0f, 0.993385911f,
+		0.943681657f, -1.77349734f, 0.835000277f, 1.77777576f, -0.786189735f, -1.0f, 0.993385911f,
+		0.390238643f, -0.68493861f, 0.299797386f, 1.77684295f, -0.785532713f, -1.0f, 0.993535101f,
+		0.459753811f, -0.820913255f, 0.366293311f, 1.77684295f, -0.785532713f, -1.0f, 0.993535101f,
+		0.52926898f, -0.95688796f, 0.432789207f, 1.77684295f, -0.785532713f, -1.0f, 0.993535101f,
+		0.598784149f, -1.09286261f, 0.499285102f, 1.77684295f, -0.785532713f, -1.0f, 0.993535101f,
+		0.668299317f, -1.22883725f, 0.565780997f, 1.77684295f, -0.785532713f, -1.0f, 0.993535101f,
+		0.737814426f, -1.3648119f, 0.632276893f, 1.77684295f, -0.785532713f, -1.0f, 0.993535101f,
+		0.807329595f, -1.50078654f, 0.698772848f, 1.77684295f, -0.785532713f, -1.0f, 0.993535101f,
+		0.876844764f, -1.63676131f, 0.765268743f, 1.77684295f, -0.785532713f, -1.0f, 0.993535101f,
+		0.946359932f, -1.77273595f, 0.831764638f, 1.77684295f, -0.785532713f, -1.0f, 0.993535101f,
+		0.0157856178f, 0.00211343798f, -0.0136721805f, 1.77814996f, -0.784969151f, -1.0f, 0.993341506f,
+		0.127989873f, -0.219825387f, 0.0960918069f, 1.77814996f, -0.784969151f, -1.0f, 0.993341506f,
+		0.240194142f, -0.441764206f, 0.205855787f, 1.77814996f, -0.784969151f, -1.0f, 0.993341506f,
+		0.352398396f, -0.663703024f, 0.315619767f, 1.77814996f, -0.784969151f, -1.0f, 0.993341506f,
+		0.464602649f, -0.885641873f, 0.425383776f, 1.77814996f, -0.784969151f, -1.0f, 0.993341506f,
+		0.576806903f, -1.10758066f, 0.535147727f, 1.77814996f, -0.784969151f, -1.0f, 0.993341506f,
+		0.689011157f, -1.32951951f, 0.644911766f, 1.77814996f, -0.784969151f, -1.0f, 0.993341506f,
+		0.80121541f, -1.55145836f, 0.754675746f, 1.77814996f, -0.784969151f, -1.0f, 0.993341506f,
+		0.913419664f, -1.77339721f, 0.864439726f, 1.77814996f, -0.784969151f, -1.0f, 0.993341506f,
+		0.0859687328f, -0.128126413f, 0.0463243499f, 1.78119493f, -0.787822545f, -1.0f, 0.993440926f,
+		0.190171838f, -0.334168166f, 0.148191154f, 1.78119493f, -0.787822545f, -1.0f, 0.993440926f,
+		0.294374943f, -0.540209889f, 0.250057936f, 1.78119493f, -0.787822545f, -1.0f, 0.993440926f,
+		0.398578078f, -0.746251643f, 0.351924747f, 1.78119493f, -0.787822545f, -1.0f, 0.993440926f,
+		0.502781153f, -0.952293396f, 0.453791559f, 1.78119493f, -0.787822545f, -1.0f, 0.993440926f,
+		0.606984317f, -1.15833509f, 0.55565834f, 1.78119493f, -0.787822545f, -1.0f, 0.993440926f,
+		0.711187422f, -1.3643769f, 0.657525122f, 1.78119493f, -0.787822545f, -1.0f, 0.993440926f,
+		0.815390527f, -1.5704186f, 0.759391963f, 1.78119493f, -0.787822545f, -1.0f, 0.993440926f,
+		0.919593632f, -1.77646041f, 0.861258745f, 1.78119493f, -0.787822545f, -1.0f, 0.993440926f,
+		0.146808207f, -0.240932658f, 0.0982532948f, 1.78368688f, -0.790171862f, -1.0f, 0.993543208f,
+		0.244075388f, -0.433189511f, 0.193270102f, 1.78368688f, -0.790171862f, -1.0f, 0.993543208f,
+		0.341342568f, -0.625446379f, 0.288286924f, 1.78368688f, -0.790171862f, -1.0f, 0.993543208f,
+		0.438609749f, -0.817703247f, 0.383303732f, 1.78368688f, -0.790171862f, -1.0f, 0.993543208f,
+		0.53587693f, -1.00996006f, 0.478320539f, 1.78368688f, -0.790171862f, -1.0f, 0.993543208f,
+		0.633144081f, -1.20221698f, 0.573337376f, 1.78368688f, -0.790171862f, -1.0f, 0.993543208f,
+		0.730411291f, -1.39447379f, 0.668354154f, 1.78368688f, -0.790171862f, -1.0f, 0.993543208f,
+		0.827678442f, -1.5867306f, 0.763370991f, 1.78368688f, -0.790171862f, -1.0f, 0.993543208f,
+		0.924945593f, -1.77898753f, 0.858387768f, 1.78368688f, -0.790171862f, -1.0f, 0.993543208f,
+		0.200053468f, -0.339560658f, 0.143617719f, 1.78571737f, -0.792101204f, -1.0f, 0.993647695f,
+		0.291250467f, -0.519748926f, 0.232635289f, 1.78571737f, -0.792101204f, -1.0f, 0.993647695f,
+		0.382447481f, -0.699937224f, 0.321652859f, 1.78571737f, -0.792101204f, -1.0f, 0.993647695f,
+		0.473644495f, -0.880125523f, 0.410670429f, 1.78571737f, -0.792101204f, -1.0f, 0.993647695f,
+		0.564841509f, -1.06031382f, 0.499687999f, 1.78571737f, -0.792101204f, -1.0f, 0.993647695f,
+		0.656038523f, -1.24050212f, 0.58870554f, 1.78571737f, -0.792101204f, -1.0f, 0.993647695f,
+		0.747235537f, -1.42069042f, 0.67772311f, 1.78571737f, -0.792101204f, -1.0f, 0.993647695f,
+		0.83843255f, -1.60087872f, 0.76674068f, 1.78571737f, -0.792101204f, -1.0f, 0.993647695f,
+		0.929629564f, -1.78106701f, 0.85575825f, 1.78571737f, -0.792101204f, -1.0f, 0.993647695f,
+		0.24704282f, -0.426499635f, 0.183566555f, 1.78735483f, -0.793673933f, -1.0f, 0.993753672f,
+		0.332882881f, -0.596032858f, 0.267285287f, 1.78735483f, -0.793673933f, -1.0f, 0.993753672f,
+		0.418722898f, -0.765566051f, 0.351004004f, 1.78735483f, -0.793673933f, -1.0f, 0.993753672f,
+		0.504562974f, -0.935099244f, 0.434722722f, 1.78735483f, -0.793673933f, -1.0f, 0.993753672f,
+		0.590402961f, -1.10463238f, 0.518441439f, 1.78735483f, -0.793673933f, -1.0f, 0.993753672f,
+		0.676243007f, -1.27416563f, 0.602160215f, 1.78735483f, -0.793673933f, -1.0f, 0.993753672f,
+		0.762083054f, -1.44369876f, 0.685878932f, 1.78735483f, -0.793673933f, -1.0f, 0.993753672f,
+		0.8479231f, -1.61323202f, 0.76959765f, 1.78735483f, -0.793673933f, -1.0f, 0.993753672f,
+		0.933763146f, -1.78276515f, 0.853316367f, 1.78735483f, -0.793673933f, -1.0f, 0.993753672f,
+		0.288817614f, -0.503685236f, 0.21899268f, 1.78865111f, -0.79493773f, -1.0f, 0.993860722f,
+		0.36989516f, -0.663740993f, 0.297995925f, 1.78865111f, -0.79493773f, -1.0f, 0.993860722f,
+		0.450972706f, -0.823796809f, 0.376999199f, 1.78865111f, -0.79493773f, -1.0f, 0.993860722f,
+		0.532050252f, -0.983852625f, 0.456002444f, 1.78865111f, -0.79493773f, -1.0f, 0.993860722f,
+		0.613127828f, -1.14390838f, 0.535005689f, 1.78865111f, -0.79493773f, -1.0f, 0.993860722f,
+		0.694205344f, -1.30396426f, 0.614008963f, 1.78865111f, -0.79493773f, -1.0f, 0.993860722f,
+		0.775282919f, -1.46402001f, 0.693012238f, 1.78865111f, -0.79493773f, -1.0f, 0.993860722f,
+		0.856360495f, -1.62407589f, 0.772015512f, 1.78865111f, -0.79493773f, -1.0f, 0.993860722f,
+		0.937438011f, -1.78413165f, 0.851018786f, 1.78865111f, -0.79493773f, -1.0f, 0.993860722f,
+		0.326200128f, -0.572644532f, 0.25060001f, 1.78964496f, -0.795928895f, -1.0f, 0.993968129f,
+		0.403015941f, -0.724214435f, 0.325378716f, 1.78964496f, -0.795928895f, -1.0f, 0.993968129f,
+		0.479831725f, -0.875784338f, 0.400157392f, 1.78964496f, -0.795928895f, -1.0f, 0.993968129f,
+		0.556647539f, -1.02735424f, 0.474936068f, 1.78964496f, -0.795928895f, -1.0f, 0.993968129f,
+		0.633463323f, -1.1789242f, 0.549714744f, 1.78964496f, -0.795928895f, -1.0f, 0.993968129f,
+		0.710279107f, -1.33049417f, 0.62449342f, 1.78964496f, -0.795928895f, -1.0f, 0.993968129f,
+		0.787094951f, -1.48206401f, 0.699272156f, 1.78964496f, -0.795928895f, -1.0f, 0.993968129f,
+		0.863910735f, -1.63363397f, 0.774050832f, 1.78964496f, -0.795928895f, -1.0f, 0.993968129f,
+		0.940726519f, -1.78520393f, 0.848829508f, 1.78964496f, -0.795928895f, -1.0f, 0.993968129f,
+		0.359848469f, -0.634598017f, 0.278950542f, 1.79036546f, -0.79667449f, -1.0f, 0.994075477f,
+		0.432828218f, -0.778524458f, 0.349921465f, 1.79036546f, -0.79667449f, -1.0f, 0.994075477f,
+		0.505807996f, -0.92245096f, 0.420892417f, 1.79036546f, -0.79667449f, -1.0f, 0.994075477f,
+		0.578787744f, -1.0663774f, 0.49186334f, 1.79036546f, -0.79667449f, -1.0f, 0.994075477f,
+		0.651767492f, -1.2103039f, 0.562834263f, 1.79036546f, -0.79667449f, -1.0f, 0.994075477f,
+		0.724747241f, -1.3542304f, 0.633805215f, 1.79036546f, -0.79667449f, -1.0f, 0.994075477f,
+		0.797727048f, -1.49815679f, 0.704776108f, 1.79036546f, -0.79667449f, -1.0f, 0.994075477f,
+		0.870706797f, -1.64208329f, 0.775747061f, 1.79036546f, -0.79667449f, -1.0f, 0.994075477f,
+		0.943686545f, -1.78600979f, 0.846717954f, 1.79036546f, -0.79667449f, -1.0f, 0.994075477f,
+		0.390295476f, -0.690532207f, 0.304497778f, 1.79083371f, -0.797194481f, -1.0f, 0.994182408f,
+		0.459804147f, -0.827536821f, 0.372017711f, 1.79083371f, -0.797194481f, -1.0f, 0.994182408f,
+		0.529312849f, -0.964541435f, 0.439537615f, 1.79083371f, -0.797194481f, -1.0f, 0.994182408f,
+		0.598821521f, -1.10154605f, 0.507057548f, 1.79083371f, -0.797194481f, -1.0f, 0.994182408f,
+		0.668330193f, -1.23855066f, 0.574577451f, 1.79083371f, -0.797194481f, -1.0f, 0.994182408f,
+		0.737838864f, -1.3755554f, 0.642097414f, 1.79083371f, -0.797194481f, -1.0f, 0.994182408f,
+		0.807347596f, -1.51256001f, 0.709617317f, 1.79083371f, -0.797194481f, -1.0f, 0.994182408f,
+		0.876856267f, -1.64956462f, 0.77713728f, 1.79083371f, -0.797194481f, -1.0f, 0.994182408f,
+		0.946364939f, -1.78656924f, 0.844657183f, 1.79083371f, -0.797194481f, -1.0f, 0.994182408f,
+		0.0158344302f, 0.00211997307f, -0.0137144569f, 1.7829932f, -0.788965404f, -1.0f, 0.994557083f,
+		0.128033131f, -0.22050935f, 0.0967372358f, 1.7829932f, -0.788965404f, -1.0f, 0.994557083f,
+		0.240231812f, -0.443138659f, 0.207188919f, 1.7829932f, -0.788965404f, -1.0f, 0.994557083f,
+		0.352430522f, -0.665767968f, 0.317640603f, 1.7829932f, -0.788965404f, -1.0f, 0.994557083f,
+		0.464629203f, -0.888397336f, 0.428092301f, 1.7829932f, -0.788965404f, -1.0f, 0.994557083f,
+		0.576827884f, -1.11102664f, 0.538543999f, 1.7829932f, -0.788965404f, -1.0f, 0.994557083f,
+		0.689026594f, -1.33365595f, 0.648995697f, 1.7829932f, -0.788965404f, -1.0f, 0.994557083f,
+		0.801225305f, -1.55628526f, 0.759447396f, 1.7829932f, -0.788965404f, -1.0f, 0.994557083f,
+		0.913424015f, -1.77891457f, 0.869899035f, 1.7829932f, -0.788965404f, -1.0f, 0.994557083f,
+		0.0860145465f, -0.128579825f, 0.0466743261f, 1.78641808f, -0.792140722f, -1.0f, 0.994609058f,
+		0.190212443f, -0.335297585f, 0.149214193f, 1.78641808f, -0.792140722f, -1.0f, 0.994609058f,
+		0.294410318f, -0.542015374f, 0.251754075f, 1.78641808f, -0.792140722f, -1.0f, 0.994609058f,
+		0.398608208f, -0.748733103f, 0.354293942f, 1.78641808f, -0.792140722f, -1.0f, 0.994609058f,
+		0.502806127f, -0.955450892f, 0.45683381f, 1.78641808f, -0.792140722f, -1.0f, 0.994609058f,
+		0.607003987f, -1.16216862f, 0.559373677f, 1.78641808f, -0.792140722f, -1.0f, 0.994609058f,
+		0.711201906f, -1.36888647f, 0.661913514f, 1.78641808f, -0.792140722f, -1.0f, 0.994609058f,
+		0.815399766f, -1.5756042f, 0.764453411f, 1.78641808f, -0.792140722f, -1.0f, 0.994609058f,
+		0.919597685f, -1.78232193f, 0.866993248f, 1.78641808f, -0.792140722f, -1.0f, 0.994609058f,
+		0.146851674f, -0.241832495f, 0.0989835784f, 1.78931713f, -0.794834435f, -1.0f, 0.994663537f,
+		0.244113892f, -0.434755504f, 0.19466342f, 1.78931713f, -0.794834435f, -1.0f, 0.994663537f,
+		0.341376126f, -0.627678454f, 0.290343285f, 1.78931713f, -0.794834435f, -1.0f, 0.994663537f,
+		0.43863833f, -0.820601463f, 0.386023134f, 1.78931713f, -0.794834435f, -1.0f, 0.994663537f,
+		0.535900533f, -1.01352441f, 0.481702954f, 1.78931713f, -0.794834435f, -1.0f, 0.994663537f,
+		0.633162796f, -1.20644748f, 0.577382803f, 1.78931713f, -0.794834435f, -1.0f, 0.994663537f,
+		0.730425f, -1.39937043f, 0.673062682f, 1.78931713f, -0.794834435f, -1.0f, 0.994663537f,
+		0.827687204f, -1.59229338f, 0.768742502f, 1.78931713f, -0.794834435f, -1.0f, 0.994663537f,
+		0.924949408f, -1.78521645f, 0.864422381f, 1.78931713f, -0.794834435f, -1.0f, 0.994663537f,
+		0.200095087f, -0.340901583f, 0.14472343f, 1.79178476f, -0.797133207f, -1.0f, 0.99472028f,
+		0.291287363f, -0.521750152f, 0.234398037f, 1.79178476f, -0.797133207f, -1.0f, 0.99472028f,
+		0.382479608f, -0.702598751f, 0.324072629f, 1.79178476f, -0.797133207f, -1.0f, 0.99472028f,
+		0.473671883f, -0.883447289f, 0.413747251f, 1.79178476f, -0.797133207f, -1.0f, 0.99472028f,
+		0.564864159f, -1.06429589f, 0.503421843f, 1.79178476f, -0.797133207f, -1.0f, 0.99472028f,
+		0.656056404f, -1.24514449f, 0.593096435f, 1.79178476f, -0.797133207f, -1.0f, 0.99472028f,
+		0.74724865f, -1.42599297f, 0.682771027f, 1.79178476f, -0.797133207f, -1.0f, 0.99472028f,
+		0.838440955f, -1.60684156f, 0.772445679f, 1.79178476f, -0.797133207f, -1.0f, 0.99472028f,
+		0.9296332f, -1.78769016f, 0.862120271f, 1.79178476f, -0.797133207f, -1.0f, 0.99472028f,
+		0.247083038f, -0.428283542f, 0.185048953f, 1.79389262f, -0.799103141f, -1.0f, 0.994778991f,
+		0.332918495f, -0.598474801f, 0.269422352f, 1.79389262f, -0.799103141f, -1.0f, 0.994778991f,
+		0.418753952f, -0.768666029f, 0.353795737f, 1.79389262f, -0.799103141f, -1.0f, 0.994778991f,
+		0.504589379f, -0.938857257f, 0.438169152f, 1.79389262f, -0.799103141f, -1.0f, 0.994778991f,
+		0.590424836f, -1.10904849f, 0.522542536f, 1.79389262f, -0.799103141f, -1.0f, 0.994778991f,
+		0.676260293f, -1.27923965f, 0.606915951f, 1.79389262f, -0.799103141f, -1.0f, 0.994778991f,
+		0.762095749f, -1.44943094f, 0.691289365f, 1.79389262f, -0.799103141f, -1.0f, 0.994778991f,
+		0.847931206f, -1.61962211f, 0.77566278f, 1.79389262f, -0.799103141f, -1.0f, 0.994778991f,
+		0.933766663f, -1.7898134f, 0.860036135f, 1.79389262f, -0.799103141f, -1.0f, 0.994778991f,
+		0.288856745f, -0.50592047f, 0.220858604f, 1.7956965f, -0.800795376f, -1.0f, 0.994839489f,
+		0.36992982f, -0.666635454f, 0.300517559f, 1.7956965f, -0.800795376f, -1.0f, 0.994839489f,
+		0.451002926f, -0.827350438f, 0.380176485f, 1.7956965f, -0.800795376f, -1.0f, 0.994839489f,
+		0.532076001f, -0.988065422f, 0.45983544f, 1.7956965f, -0.800795376f, -1.0f, 0.994839489f,
+		0.613149107f, -1.14878047f, 0.539494395f, 1.7956965f, -0.800795376f, -1.0f, 0.994839489f,
+		0.694222212f, -1.30949545f, 0.619153321f, 1.7956965f, -0.800795376f, -1.0f, 0.994839489f,
+		0.775295317f, -1.47021043f, 0.698812306f, 1.7956965f, -0.800795376f, -1.0f, 0.994839489f,
+		0.856368363f, -1.63092542f, 0.778471231f, 1.7956965f, -0.800795376f, -1.0f, 0.994839489f,
+		0.937441468f, -1.7916404f, 0.858130157f, 1.7956965f, -0.800795376f, -1.0f, 0.994839489f,
+		0.326238483f, -0.575345755f, 0.252861679f, 1.79724002f, -0.802250028f, -1.0f, 0.994901419f,
+		0.403049916f, -0.727579236f, 0.328300297f, 1.79724002f, -0.802250028f, -1.0f, 0.994901419f,
+		0.479861349f, -0.879812717f, 0.403738886f, 1.79724002f, -0.802250028f, -1.0f, 0.994901419f,
+		0.556672752f, -1.0320462f, 0.479177505f, 1.79724002f, -0.802250028f, -1.0f, 0.994901419f,
+		0.633484185f, -1.18427968f, 0.554616094f, 1.79724002f, -0.802250028f, -1.0f, 0.994901419f,
+		0.710295618f, -1.33651316f, 0.630054712f, 1.79724002f, -0.802250028f, -1.0f, 0.994901419f,
+		0.78710705f, -1.48874664f, 0.705493331f, 1.79724002f, -0.802250028f, -1.0f, 0.994901419f,
+		0.863918483f, -1.64098012f, 0.78093189f, 1.79724002f, -0.802250028f, -1.0f, 0.994901419f,
+		0.940729916f, -1.79321361f, 0.856370509f, 1.79724002f, -0.802250028f, -1.0f, 0.994901419f,
+		0.359886348f, -0.63778621f, 0.281625539f, 1.79855764f, -0.803498983f, -1.0f, 0.9949646f,
+		0.432861775f, -0.7823838f, 0.353263766f, 1.79855764f, -0.803498983f, -1.0f, 0.9949646f,
+		0.505837202f, -0.92698133f, 0.424901992f, 1.79855764f, -0.803498983f, -1.0f, 0.9949646f,
+		0.578812659f, -1.07157886f, 0.496540219f, 1.79855764f, -0.803498983f, -1.0f, 0.9949646f,
+		0.651788116f, -1.21617639f, 0.568178415f, 1.79855764f, -0.803498983f, -1.0f, 0.9949646f,
+		0.724763572f, -1.36077392f, 0.639816642f, 1.79855764f, -0.803498983f, -1.0f, 0.9949646f,
+		0.797738969f, -1.50537145f, 0.711454868f, 1.79855764f, -0.803498983f, -1.0f, 0.9949646f,
+		0.870714426f, -1.6499691f, 0.783093095f, 1.79855764f, -0.803498983f, -1.0f, 0.9949646f,
+		0.943689883f, -1.79456663f, 0.854731321f, 1.79855764f, -0.803498983f, -1.0f, 0.9949646f,
+		0.390333086f, -0.694234848f, 0.3076092f, 1.79967701f, -0.804567516f, -1.0f, 0.995028794f,
+		0.459837496f, -0.831921279f, 0.375806957f, 1.79967701f, -0.804567516f, -1.0f, 0.995028794f,
+		0.529341877f, -0.969607711f, 0.444004744f, 1.79967701f, -0.804567516f, -1.0f, 0.995028794f,
+		0.598846257f, -1.10729408f, 0.512202501f, 1.79967701f, -0.804567516f, -1.0f, 0.995028794f,
+		0.668350697f, -1.24498045f, 0.580400288f, 1.79967701f, -0.804567516f, -1.0f, 0.995028794f,
+		0.737855077f, -1.38266695f, 0.648598075f, 1.79967701f, -0.804567516f, -1.0f, 0.995028794f,
+		0.807359457f, -1.52035332f, 0.716795862f, 1.79967701f, -0.804567516f, -1.0f, 0.995028794f,
+		0.876863837f, -1.65803981f, 0.784993589f, 1.79967701f, -0.804567516f, -1.0f, 0.995028794f,
+		0.946368217f, -1.79572618f, 0.853191376f, 1.79967701f, -0.804567516f, -1.0f, 0.995028794f,
+		0.0158716906f, 0.00212496147f, -0.0137467282f, 1.78638601f, -0.791767299f, -1.0f, 0.99578923f,
+		0.128066137f, -0.221031442f, 0.0972299129f, 1.78638601f, -0.791767299f, -1.0f, 0.99578923f,
+		0.240260586f, -0.44418785f, 0.208206549f, 1.78638601f, -0.791767299f, -1.0f, 0.99578923f,
+		0.35245502f, -0.667344272f, 0.319183171f, 1.78638601f, -0.791767299f, -1.0f, 0.99578923f,
+		0.464649469f, -0.890500665f, 0.430159807f, 1.78638601f, -0.791767299f, -1.0f, 0.99578923f,
+		0.576843917f, -1.113657f, 0.541136444f, 1.78638601f, -0.791767299f, -1.0f, 0.99578923f,
+		0.689038396f, -1.33681345f, 0.65211308f, 1.78638601f, -0.791767299f, -1.0f, 0.99578923f,
+		0.801232815f, -1.5599699f, 0.763089716f, 1.78638601f, -0.791767299f, -1.0f, 0.99578923f,
+		0.913427234f, -1.78312624f, 0.874066353f, 1.78638601f, -0.791767299f, -1.0f, 0.99578923f,
+		0.0860489905f, -0.128920659f, 0.0469374023f, 1.79001951f, -0.795120537f, -1.0f, 0.995811939f,
+		0.190242946f, -0.336146593f, 0.149983212f, 1.79001951f, -0.795120537f, -1.0f, 0.995811939f,
+		0.294436902f, -0.543372512f, 0.253029019f, 1.79001951f, -0.795120537f, -1.0f, 0.995811939f,
+		0.398630887f, -0.750598431f, 0.35607484f, 1.79001951f, -0.795120537f, -1.0f, 0.995811939f,
+		0.502824843f, -0.957824409f, 0.459120661f, 1.79001951f, -0.795120537f, -1.0f, 0.995811939f,
+		0.607018828f, -1.16505027f, 0.562166452f, 1.79001951f, -0.795120537f, -1.0f, 0.995811939f,
+		0.711212754f, -1.37227631f, 0.665212274f, 1.79001951f, -0.795120537f, -1.0f, 0.995811939f,
+		0.81540674f, -1.57950222f, 0.768258095f, 1.79001951f, -0.795120537f, -1.0f, 0.995811939f,
+		0.919600666f, -1.78672814f, 0.871303916f, 1.79001951f, -0.795120537f, -1.0f, 0.995811939f,
+		0.14688383f, -0.242498115f, 0.0995237678f, 1.79313803f, -0.798000932f, -1.0f, 0.995836079f,
+		0.244142383f, -0.435913831f, 0.195694059f, 1.79313803f, -0.798000932f, -1.0f, 0.995836079f,
+		0.341400951f, -0.629329562f, 0.291864365f, 1.79313803f, -0.798000932f, -1.0f, 0.995836079f,
+		0.438659489f, -0.822745323f, 0.388034642f, 1.79313803f, -0.798000932f, -1.0f, 0.995836079f,
+		0.535918057f, -1.01616096f, 0.484204948f, 1.79313803f, -0.798000932f, -1.0f, 0.995836079f,
+		0.633176625f, -1.20957673f, 0.580375254f, 1.79313803f, -0.798000932f, -1.0f, 0.995836079f,
+		0.730435133f, -1.40299249f, 0.67654556f, 1.79313803f, -0.798000932f, -1.0f, 0.995836079f,
+		0.827693701f, -1.59640825f, 0.772715807f, 1.79313803f, -0.798000932f, -1.0f, 0.995836079f,
+		0.924952269f, -1.78982389f, 0.868886113f, 1.79313803f, -0.798000932f, -1.0f, 0.995836079f,
+		0.200125366f, -0.341876894f, 0.145527631f, 1.79583645f, -0.800495863f, -1.0f, 0.99586153f,
+		0.291314185f, -0.523205698f, 0.235680118f, 1.79583645f, -0.800495863f, -1.0f, 0.99586153f,
+		0.382503003f, -0.704534531f, 0.325832605f, 1.79583645f, -0.800495863f, -1.0f, 0.99586153f,
+		0.473691791f, -0.885863304f, 0.415985078f, 1.79583645f, -0.800495863f, -1.0f, 0.99586153f,
+		0.56488061f, -1.06719208f, 0.50613755f, 1.79583645f, -0.800495863f, -1.0f, 0.99586153f,
+		0.656069458f, -1.24852085f, 0.596290052f, 1.79583645f, -0.800495863f, -1.0f, 0.99586153f,
+		0.747258246f, -1.42984974f, 0.686442554f, 1.79583645f, -0.800495863f, -1.0f, 0.99586153f,
+		0.838447034f, -1.61117852f, 0.776594996f, 1.79583645f, -0.800495863f, -1.0f, 0.99586153f,
+		0.929635882f, -1.79250729f, 0.866747499f, 1.79583645f, -0.800495863f, -1.0f, 0.99586153f,
+		0.247111768f, -0.429558247f, 0.186108202f, 1.79818749f, -0.802672029f, -1.0f, 0.995888293f,
+		0.332943946f, -0.600219667f, 0.270949394f, 1.79818749f, -0.802672029f, -1.0f, 0.995888293f,
+		0.418776125f, -0.770881116f, 0.355790615f, 1.79818749f, -0.802672029f, -1.0f, 0.995888293f,
+		0.504608333f, -0.941542566f, 0.440631807f, 1.79818749f, -0.802672029f, -1.0f, 0.995888293f,
+		0.590440512f, -1.11220396f, 0.525472999f, 1.79818749f, -0.802672029f, -1.0f, 0.995888293f,
+		0.67627269f, -1.28286541f, 0.61031419f, 1.79818749f, -0.802672029f, -1.0f, 0.995888293f,
+		0.762104869f, -1.45352685f, 0.695155382f, 1.79818749f, -0.802672029f, -1.0f, 0.995888293f,
+		0.847937047f, -1.6241883f, 0.779996634f, 1.79818749f, -0.802672029f, -1.0f, 0.995888293f,
+		0.933769226f, -1.79484975f, 0.864837825f, 1.79818749f, -0.802672029f, -1.0f, 0.995888293f,
+		0.288884193f, -0.507488191f, 0.222167313f, 1.80024767f, -0.804581404f, -1.0f, 0.995916307f,
+		0.369954139f, -0.668665528f, 0.302286148f, 1.80024767f, -0.804581404f, -1.0f, 0.995916307f,
+		0.451024115f, -0.829842865f, 0.382404983f, 1.80024767f, -0.804581404f, -1.0f, 0.995916307f,
+		0.532094061f, -0.991020203f, 0.462523788f, 1.80024767f, -0.804581404f, -1.0f, 0.995916307f,
+		0.613164008f, -1.15219748f, 0.542642593f, 1.80024767f, -0.804581404f, -1.0f, 0.995916307f,
+		0.694234014f, -1.31337488f, 0.622761428f, 1.80024767f, -0.804581404f, -1.0f, 0.995916307f,
+		0.77530396f, -1.47455215f, 0.702880263f, 1.80024767f, -0.804581404f, -1.0f, 0.995916307f,
+		0.856373906f, -1.63572943f, 0.782999098f, 1.80024767f, -0.804581404f, -1.0f, 0.995916307f,
+		0.937443912f, -1.79690683f, 0.863117933f, 1.80024767f, -0.804581404f, -1.0f, 0.995916307f,
+		0.326264888f, -0.577203572f, 0.254417181f, 1.80206156f, -0.806264937f, -1.0f, 0.995945454f,
+		0.403073311f, -0.729893446f, 0.330309629f, 1.80206156f, -0.806264937f, -1.0f, 0.995945454f,
+		0.479881734f, -0.882583261f, 0.406202108f, 1.80206156f, -0.806264937f, -1.0f, 0.995945454f,
+		0.556690156f, -1.03527308f, 0.482094556f, 1.80206156f, -0.806264937f, -1.0f, 0.995945454f,
+		0.633498549f, -1.18796289f, 0.557987034f, 1.80206156f, -0.806264937f, -1.0f, 0.995945454f,
+		0.710307002f, -1.34065282f, 0.633879483f, 1.80206156f, -0.806264937f, -1.0f, 0.995945454f,
+		0.787115395f, -1.49334264f, 0.709771931f, 1.80206156f, -0.806264937f, -1.0f, 0.995945454f,
+		0.863923788f, -1.64603245f, 0.78566438f, 1.80206156f, -0.806264937f, -1.0f, 0.995945454f,
+		0.940732241f, -1.79872227f, 0.861556888f, 1.80206156f, -0.806264937f, -1.0f, 0.995945454f,
+		0.359911859f, -0.639934063f, 0.283427626f, 1.80366457f, -0.807755351f, -1.0f, 0.995975673f,
+		0.432884395f, -0.784983754f, 0.355515391f, 1.80366457f, -0.807755351f, -1.0f, 0.995975673f,
+		0.505856931f, -0.930033386f, 0.427603185f, 1.80366457f, -0.807755351f, -1.0f, 0.995975673f,
+		0.578829467f, -1.07508302f, 0.49969095f, 1.80366457f, -0.807755351f, -1.0f, 0.995975673f,
+		0.651802003f, -1.22013271f, 0.571778715f, 1.80366457f, -0.807755351f, -1.0f, 0.995975673f,
+		0.724774539f, -1.36518228f, 0.643866479f, 1.80366457f, -0.807755351f, -1.0f, 0.995975673f,
+		0.797747076f, -1.51023197f, 0.715954244f, 1.80366457f, -0.807755351f, -1.0f, 0.995975673f,
+		0.870719612f, -1.65528154f, 0.788042068f, 1.80366457f, -0.807755351f, -1.0f, 0.995975673f,
+		0.943692088f, -1.80033123f, 0.860129833f, 1.80366457f, -0.807755351f, -1.0f, 0.995975673f,
+		0.390357882f, -0.69667542f, 0.309660047f, 1.80508566f, -0.809079051f, -1.0f, 0.996006906f,
+		0.459859461f, -0.834811211f, 0.378304601f, 1.80508566f, -0.809079051f, -1.0f, 0.996006906f,
+		0.52936101f, -0.972947001f, 0.446949184f, 1.80508566f, -0.809079051f, -1.0f, 0.996006906f,
+		0.598862588f, -1.11108279f, 0.515593767f, 1.80508566f, -0.809079051f, -1.0f, 0.996006906f,
+		0.668364167f, -1.24921858f, 0.584238291f, 1.80508566f, -0.809079051f, -1.0f, 0.996006906f,
+		0.737865746f, -1.38735437f, 0.652882874f, 1.80508566f, -0.809079051f, -1.0f, 0.996006906f,
+		0.807367265f, -1.52549016f, 0.721527457f, 1.80508566f, -0.809079051f, -1.0f, 0.996006906f,
+		0.876868844f, -1.66362607f, 0.790171981f, 1.80508566f, -0.809079051f, -1.0f, 0.996006906f,
+		0.946370423f, -1.80176187f, 0.858816564f, 1.80508566f, -0.809079051f, -1.0f, 0.996006906f,
+		0.0158988386f, 0.00212859642f, -0.0137702422f, 1.78864896f, -0.793637931f, -1.0f, 0.996896267f,
+		0.128090188f, -0.221411854f, 0.0975888968f, 1.78864896f, -0.793637931f, -1.0f, 0.996896267f,
+		0.240281537f, -0.444952309f, 0.208948031f, 1.78864896f, -0.793637931f, -1.0f, 0.996896267f,
+		0.352472901f, -0.668492794f, 0.320307165f, 1.78864896f, -0.793637931f, -1.0f, 0.996896267f,
+		0.464664251f, -0.892033219f, 0.431666315f, 1.78864896f, -0.793637931f, -1.0f, 0.996896267f,
+		0.5768556f, -1.11557364f, 0.543025434f, 1.78864896f, -0.793637931f, -1.0f, 0.996896267f,
+		0.689046919f, -1.33911419f, 0.654384613f, 1.78864896f, -0.793637931f, -1.0f, 0.996896267f,
+		0.801238298f, -1.56265461f, 0.765743732f, 1.78864896f, -0.793637931f, -1.0f, 0.996896267f,
+		0.913429677f, -1.78619504f, 0.877102852f, 1.78864896f, -0.793637931f, -1.0f, 0.996896267f,
+		0.0860738009f, -0.129166186f, 0.0471269153f, 1.7923876f, -0.797081649f, -1.0f, 0.99690479f,
+		0.19026494f, -0.336758196f, 0.150537193f, 1.7923876f, -0.797081649f, -1.0f, 0.99690479f,
+		0.294456065f, -0.544350207f, 0.253947467f, 1.7923876f, -0.797081649f, -1.0f, 0.99690479f,
+		0.398647189f, -0.751942158f, 0.35735774f, 1.7923876f, -0.797081649f, -1.0f, 0.99690479f,
+		0.502838314f, -0.959534168f, 0.460768044f, 1.7923876f, -0.797081649f, -1.0f, 0.99690479f,
+		0.607029498f, -1.16712618f, 0.564178288f, 1.7923876f, -0.797081649f, -1.0f, 0.99690479f,
+		0.711220622f, -1.37471819f, 0.667588592f, 1.7923876f, -0.797081649f, -1.0f, 0.99690479f,
+		0.815411747f, -1.5823102f, 0.770998895f, 1.7923876f, -0.797081649f, -1.0f, 0.99690479f,
+		0.919602871f, -1.78990221f, 0.874409139f, 1.7923876f, -0.797081649f, -1.0f, 0.99690479f,
+		0.146906719f, -0.242971972f, 0.099908337f, 1.79561508f, -0.800055563f, -1.0f, 0.99691397f,
+		0.244162664f, -0.436738491f, 0.196427792f, 1.79561508f, -0.800055563f, -1.0f, 0.99691397f,
+		0.341418594f, -0.630505025f, 0.292947263f, 1.79561508f, -0.800055563f, -1.0f, 0.99691397f,
+		0.438674539f, -0.82427156f, 0.389466703f, 1.79561508f, -0.800055563f, -1.0f, 0.99691397f,
+		0.535930514f, -1.01803803f, 0.485986173f, 1.79561508f, -0.800055563f, -1.0f, 0.99691397f,
+		0.63318646f, -1.21180463f, 0.582505643f, 1.79561508f, -0.800055563f, -1.0f, 0.99691397f,
+		0.730442405f, -1.4055711f, 0.679025054f, 1.79561508f, -0.800055563f, -1.0f, 0.99691397f,
+		0.82769835f, -1.59933758f, 0.775544524f, 1.79561508f, -0.800055563f, -1.0f, 0.99691397f,
+		0.924954295f, -1.79310417f, 0.872063994f, 1.79561508f, -0.800055563f, -1.0f, 0.99691397f,
+		0.20014666f, -0.342562824f, 0.146093234f, 1.79842651f, -0.802647173f, -1.0f, 0.996923685f,
+		0.29133305f, -0.524229348f, 0.236581802f, 1.79842651f, -0.802647173f, -1.0f, 0.996923685f,
+		0.382519424f, -0.705895901f, 0.327070385f, 1.79842651f, -0.802647173f, -1.0f, 0.996923685f,
+		0.473705828f, -0.887562454f, 0.417558968f, 1.79842651f, -0.802647173f, -1.0f, 0.996923685f,
+		0.564892173f, -1.06922901f, 0.508047521f, 1.79842651f, -0.802647173f, -1.0f, 0.996923685f,
+		0.656078577f, -1.2508955f, 0.598536074f, 1.79842651f, -0.802647173f, -1.0f, 0.996923685f,
+		0.747264981f, -1.43256211f, 0.689024687f, 1.79842651f, -0.802647173f, -1.0f, 0.996923685f,
+		0.838451326f, -1.61422861f, 0.77951324f, 1.79842651f, -0.802647173f, -1.0f, 0.996923685f,
+		0.92963773f, -1.79589522f, 0.870001793f, 1.79842651f, -0.802647173f, -1.0f, 0.996923685f,
+		0.247131705f, -0.430443525f, 0.186843842f, 1.80089498f, -0.804923594f, -1.0f, 0.996933997f,
+		0.332961619f, -0.601431489f, 0.272009909f, 1.80089498f, -0.804923594f, -1.0f, 0.996933997f,
+		0.418791533f, -0.772419512f, 0.357176006f, 1.80089498f, -0.804923594f, -1.0f, 0.996933997f,
+		0.504621446f, -0.943407476f, 0.442342073f, 1.80089498f, -0.804923594f, -1.0f, 0.996933997f,
+		0.59045136f, -1.1143955f, 0.52750814f, 1.80089498f, -0.804923594f, -1.0f, 0.996933997f,
+		0.676281273f, -1.28538346f, 0.612674236f, 1.80089498f, -0.804923594f, -1.0f, 0.996933997f,
+		0.762111127f, -1.45637143f, 0.697840333f, 1.80089498f, -0.804923594f, -1.0f, 0.996933997f,
+		0.847941041f, -1.62735939f, 0.78300643f, 1.80089498f, -0.804923594f, -1.0f, 0.996933997f,
+		0.933770955f, -1.79834735f, 0.868172467f, 1.80089498f, -0.804923594f, -1.0f, 0.996933997f,
+		0.288902998f, -0.508562922f, 0.223064423f, 1.80307698f, -0.8069368f, -1.0f, 0.996944904f,
+		0.369970828f, -0.670057118f, 0.303498507f, 1.80307698f, -0.8069368f, -1.0f, 0.996944904f,
+		0.451038629f, -0.831551373f, 0.383932561f, 1.80307698f, -0.8069368f, -1.0f, 0.996944904f,
+		0.532106459f, -0.993045628f, 0.464366615f, 1.80307698f, -0.8069368f, -1.0f, 0.996944904f,
+		0.61317426f, -1.15453982f, 0.544800699f, 1.80307698f, -0.8069368f, -1.0f, 0.996944904f,
+		0.69424206f, -1.31603408f, 0.625234783f, 1.80307698f, -0.8069368f, -1.0f, 0.996944904f,
+		0.77530992f, -1.47752833f, 0.705668807f, 1.80307698f, -0.8069368f, -1.0f, 0.996944904f,
+		0.856377721f, -1.63902259f, 0.786102891f, 1.80307698f, -0.8069368f, -1.0f, 0.996944904f,
+		0.937445521f, -1.80051684f, 0.866536975f, 1.80307698f, -0.8069368f, -1.0f, 0.996944904f,
+		0.32628274f, -0.578460038f, 0.255469143f, 1.80501747f, -0.808728039f, -1.0f, 0.996956348f,
+		0.403089106f, -0.731458485f, 0.331668526f, 1.80501747f, -0.808728039f, -1.0f, 0.996956348f,
+		0.479895502f, -0.884456933f, 0.407867938f, 1.80501747f, -0.808728039f, -1.0f, 0.996956348f,
+		0.556701899f, -1.03745544f, 0.484067351f, 1.80501747f, -0.808728039f, -1.0f, 0.996956348f,
+		0.633508265f, -1.19045389f, 0.560266733f, 1.80501747f, -0.808728039f, -1.0f, 0.996956348f,
+		0.710314631f, -1.34345233f, 0.636466146f, 1.80501747f, -0.808728039f, -1.0f, 0.996956348f,
+		0.787121058f, -1.49645078f, 0.712665558f, 1.80501747f, -0.808728039f, -1.0f, 0.996956348f,
+		0.863927424f, -1.64944935f, 0.78886497f, 1.80501747f, -0.808728039f, -1.0f, 0.996956348f,
+		0.94073379f, -1.8024478f, 0.865064383f, 1.80501747f, -0.808728039f, -1.0f, 0.996956348f,
+		0.359928876f, -0.641366482f, 0.284629434f, 1.80675197f, -0.810330212f, -1.0f, 0.996968269f,
+		0.432899475f, -0.786717594f, 0.35701701f, 1.80675197f, -0.810330212f, -1.0f, 0.996968269f,
+		0.505870044f, -0.932068765f, 0.429404587f, 1.80675197f, -0.810330212f, -1.0f, 0.996968269f,
+		0.578840673f, -1.07741988f, 0.501792133f, 1.80675197f, -0.810330212f, -1.0f, 0.996968269f,
+		0.651811242f, -1.22277105f, 0.574179709f, 1.80675197f, -0.810330212f, -1.0f, 0.996968269f,
+		0.724781811f, -1.36812222f, 0.646567285f, 1.80675197f, -0.810330212f, -1.0f, 0.996968269f,
+		0.79775244f, -1.51347327f, 0.718954861f, 1.80675197f, -0.810330212f, -1.0f, 0.996968269f,
+		0.870723009f, -1.65882444f, 0.791342437f, 1.80675197f, -0.810330212f, -1.0f, 0.996968269f,
+		0.943693638f, -1.80417562f, 0.863730013f, 1.80675197f, -0.810330212f, -1.0f, 0.996968269f,
+		0.390374184f, -0.69827956f, 0.311008036f, 1.80830967f, -0.811769903f, -1.0f, 0.996980786f,
+		0.459873885f, -0.836710751f, 0.379946262f, 1.80830967f, -0.811769903f, -1.0f, 0.996980786f,
+		0.529373586f, -0.975141883f, 0.448884487f, 1.80830967f, -0.811769903f, -1.0f, 0.996980786f,
+		0.598873317f, -1.11357307f, 0.517822742f, 1.80830967f, -0.811769903f, -1.0f, 0.996980786f,
+		0.668373048f, -1.25200427f, 0.586760998f, 1.80830967f, -0.811769903f, -1.0f, 0.996980786f,
+		0.73787272f, -1.39043546f, 0.655699193f, 1.80830967f, -0.811769903f, -1.0f, 0.996980786f,
+		0.807372451f, -1.52886665f, 0.724637449f, 1.80830967f, -0.811769903f, -1.0f, 0.996980786f,
+		0.876872122f, -1.66729784f, 0.793575704f, 1.80830967f, -0.811769903f, -1.0f, 0.996980786f,
+		0.946371853f, -1.80572891f, 0.8625139f, 1.80830967f, -0.811769903f, -1.0f, 0.996980786f,
+		0.0159179568f, 0.00213115592f, -0.0137868011f, 1.79012156f, -0.794856429f, -1.0f, 0.997796714f,
+		0.128107131f, -0.221679762f, 0.0978417024f, 1.79012156f, -0.794856429f, -1.0f, 0.997796714f,
+		0.240296304f, -0.445490658f, 0.209470198f, 1.79012156f, -0.794856429f, -1.0f, 0.997796714f,
+		0.352485478f, -0.669301569f, 0.321098685f, 1.79012156f, -0.794856429f, -1.0f, 0.997796714f,
+		0.464674652f, -0.893112481f, 0.432727188f, 1.79012156f, -0.794856429f, -1.0f, 0.997796714f,
+		0.576863825f, -1.11692345f, 0.54435569f, 1.79012156f, -0.794856429f, -1.0f, 0.997796714f,
+		0.689052999f, -1.34073436f, 0.655984223f, 1.79012156f, -0.794856429f, -1.0f, 0.997796714f,
+		0.801242173f, -1.56454527f, 0.767612696f, 1.79012156f, -0.794856429f, -1.0f, 0.997796714f,
+		0.913431346f, -1.78835618f, 0.879241228f, 1.79012156f, -0.794856429f, -1.0f, 0.997796714f,
+		0.086091131f, -0.129337683f, 0.0472592898f, 1.79391015f, -0.798343718f, -1.0f, 0.997799635f,
+		0.190280288f, -0.337185383f, 0.150924146f, 1.79391015f, -0.798343718f, -1.0f, 0.997799635f,
+		0.294469446f, -0.545033038f, 0.254588991f, 1.79391015f, -0.798343718f, -1.0f, 0.997799635f,
+		0.398658603f, -0.752880752f, 0.358253866f, 1.79391015f, -0.798343718f, -1.0f, 0.997799635f,
+		0.502847791f, -0.960728467f, 0.461918712f, 1.79391015f, -0.798343718f, -1.0f, 0.997799635f,
+		0.607036948f, -1.16857612f, 0.565583587f, 1.79391015f, -0.798343718f, -1.0f, 0.997799635f,
+		0.711226106f, -1.37642384f, 0.669248402f, 1.79391015f, -0.798343718f, -1.0f, 0.997799635f,
+		0.815415263f, -1.58427155f, 0.772913277f, 1.79391015f, -0.798343718f, -1.0f, 0.997799635f,
+		0.919604421f, -1.79211926f, 0.876578152f, 1.79391015f, -0.798343718f, -1.0f, 0.997799635f,
+		0.146922573f, -0.2433002f, 0.100174725f, 1.79718864f, -0.801361978f, -1.0f, 0.997802734f,
+		0.244176716f, -0.437309712f, 0.196936041f, 1.79718864f, -0.801361978f, -1.0f, 0.997802734f,
+		0.341430843f, -0.631319225f, 0.293697357f, 1.79718864f, -0.801361978f, -1.0f, 0.997802734f,
+		0.43868497f, -0.825328708f, 0.390458673f, 1.79718864f, -0.801361978f, -1.0f, 0.997802734f,
+		0.535939097f, -1.01933825f, 0.487219989f, 1.79718864f, -0.801361978f, -1.0f, 0.997802734f,
+		0.633193254f, -1.21334779f, 0.583981276f, 1.79718864f, -0.801361978f, -1.0f, 0.997802734f,
+		0.730447412f, -1.40735722f, 0.680742621f, 1.79718864f, -0.801361978f, -1.0f, 0.997802734f,
+		0.827701509f, -1.60136676f, 0.777503908f, 1.79718864f, -0.801361978f, -1.0f, 0.997802734f,
+		0.924955666f, -1.7953763f, 0.874265254f, 1.79718864f, -0.801361978f, -1.0f, 0.997802734f,
+		0.200161278f, -0.34303391f, 0.146481678f, 1.80005252f, -0.803998888f, -1.0f, 0.997806072f,
+		0.291346014f, -0.524932444f, 0.23720108f, 1.80005252f, -0.803998888f, -1.0f, 0.997806072f,
+		0.382530719f, -0.706830919f, 0.327920496f, 1.80005252f, -0.803998888f, -1.0f, 0.997806072f,
+		0.473715425f, -0.888729453f, 0.418639868f, 1.80005252f, -0.803998888f, -1.0f, 0.997806072f,
+		0.56490016f, -1.07062793f, 0.5093593f, 1.80005252f, -0.803998888f, -1.0f, 0.997806072f,
+		0.656084895f, -1.2525264f, 0.600078702f, 1.80005252f, -0.803998888f, -1.0f, 0.997806072f,
+		0.747269571f, -1.434425f, 0.690798104f, 1.80005252f, -0.803998888f, -1.0f, 0.997806072f,
+		0.838454306f, -1.61632347f, 0.781517506f, 1.80005252f, -0.803998888f, -1.0f, 0.997806072f,
+		0.929639041f, -1.79822195f, 0.872236907f, 1.80005252f, -0.803998888f, -1.0f, 0.997806072f,
+		0.247145295f, -0.431046218f, 0.18734467f, 1.80257463f, -0.806321561f, -1.0f, 0.997809589f,
+		0.332973659f, -0.602256536f, 0.27273196f, 1.80257463f, -0.806321561f, -1.0f, 0.997809589f,
+		0.418802023f, -0.773466825f, 0.35811922f, 1.80257463f, -0.806321561f, -1.0f, 0.997809589f,
+		0.504630387f, -0.944677174f, 0.443506479f, 1.80257463f, -0.806321561f, -1.0f, 0.997809589f,
+		0.590458751f, -1.11588752f, 0.528893769f, 1.80257463f, -0.806321561f, -1.0f, 0.997809589f,
+		0.676287115f, -1.28709781f, 0.614280999f, 1.80257463f, -0.806321561f, -1.0f, 0.997809589f,
+		0.762115419f, -1.4583081f, 0.699668288f, 1.80257463f, -0.806321561f, -1.0f, 0.997809589f,
+		0.847943783f, -1.62951839f, 0.785055578f, 1.80257463f, -0.806321561f, -1.0f, 0.997809589f,
+		0.933772147f, -1.80072868f, 0.870442808f, 1.80257463f, -0.806321561f, -1.0f, 0.997809589f,
+		0.288915694f, -0.509288073f, 0.223669767f, 1.80481184f, -0.808382154f, -1.0f, 0.997813284f,
+		0.369982064f, -0.67099613f, 0.30431655f, 1.80481184f, -0.808382154f, -1.0f, 0.997813284f,
+		0.451048434f, -0.832704246f, 0.384963334f, 1.80481184f, -0.808382154f, -1.0f, 0.997813284f,
+		0.532114804f, -0.994412303f, 0.465610117f, 1.80481184f, -0.808382154f, -1.0f, 0.997813284f,
+		0.613181174f, -1.15612042f, 0.5462569f, 1.80481184f, -0.808382154f, -1.0f, 0.997813284f,
+		0.694247544f, -1.31782854f, 0.626903653f, 1.80481184f, -0.808382154f, -1.0f, 0.997813284f,
+		0.775313914f, -1.47953665f, 0.707550466f, 1.80481184f, -0.808382154f, -1.0f, 0.997813284f,
+		0.856380284f, -1.64124465f, 0.788197219f, 1.80481184f, -0.808382154f, -1.0f, 0.997813284f,
+		0.937446654f, -1.80295277f, 0.868844032f, 1.80481184f, -0.808382154f, -1.0f, 0.997813284f,
+		0.326294661f, -0.579300106f, 0.256172508f, 1.80680883f, -0.81022191f, -1.0f, 0.997817218f,
+		0.403099686f, -0.732504904f, 0.332577139f, 1.80680883f, -0.81022191f, -1.0f, 0.997817218f,
+		0.479904711f, -0.885709763f, 0.40898177f, 1.80680883f, -0.81022191f, -1.0f, 0.997817218f,
+		0.556709707f, -1.03891456f, 0.485386401f, 1.80680883f, -0.81022191f, -1.0f, 0.997817218f,
+		0.633514762f, -1.19211936f, 0.561791062f, 1.80680883f, -0.81022191f, -1.0f, 0.997817218f,
+		0.710319757f, -1.34532428f, 0.638195693f, 1.80680883f, -0.81022191f, -1.0f, 0.997817218f,
+		0.787124813f, -1.49852908f, 0.714600325f, 1.80680883f, -0.81022191f, -1.0f, 0.997817218f,
+		0.863929808f, -1.65173388f, 0.791004956f, 1.80680883f, -0.81022191f, -1.0f, 0.997817218f,
+		0.940734863f, -1.80493867f, 0.867409587f, 1.80680883f, -0.81022191f, -1.0f, 0.997817218f,
+		0.359940141f, -0.642315269f, 0.285425484f, 1.8086015f, -0.811873794f, -1.0f, 0.997821391f,
+		0.432909459f, -0.787866116f, 0.358011663f, 1.8086015f, -0.811873794f, -1.0f, 0.997821391f,
+		0.505878747f, -0.933416963f, 0.430597812f, 1.8086015f, -0.811873794f, -1.0f, 0.997821391f,
+		0.578848064f, -1.07896781f, 0.503183961f, 1.8086015f, -0.811873794f, -1.0f, 0.997821391f,
+		0.651817381f, -1.22451866f, 0.57577014f, 1.8086015f, -0.811873794f, -1.0f, 0.997821391f,
+		0.724786699f, -1.3700695f, 0.648356318f, 1.8086015f, -0.811873794f, -1.0f, 0.997821391f,
+		0.797756016f, -1.51562035f, 0.720942438f, 1.8086015f, -0.811873794f, -1.0f, 0.997821391f,
+		0.870725274f, -1.6611712f, 0.793528616f, 1.8086015f, -0.811873794f, -1.0f, 0.997821391f,
+		0.943694592f, -1.80672204f, 0.866114795f, 1.8086015f, -0.811873794f, -1.0f, 0.997821391f,
+		0.390384883f, -0.699331999f, 0.31189239f, 1.81021893f, -0.813364565f, -1.0f, 0.997825742f,
+		0.459883362f, -0.837956965f, 0.381023318f, 1.81021893f, -0.813364565f, -1.0f, 0.997825742f,
+		0.529381871f, -0.976581931f, 0.450154215f, 1.81021893f, -0.813364565f, -1.0f, 0.997825742f,
+		0.598880351f, -1.11520684f, 0.519285142f, 1.81021893f, -0.813364565f, -1.0f, 0.997825742f,
+		0.66837883f, -1.25383186f, 0.58841604f, 1.81021893f, -0.813364565f, -1.0f, 0.997825742f,
+		0.737877309f, -1.39245677f, 0.657546937f, 1.81021893f, -0.813364565f, -1.0f, 0.997825742f,
+		0.807375789f, -1.5310818f, 0.726677835f, 1.81021893f, -0.813364565f, -1.0f, 0.997825742f,
+		0.876874328f, -1.6697067f, 0.795808733f, 1.81021893f, -0.813364565f, -1.0f, 0.997825742f,
+		0.946372807f, -1.80833173f, 0.86493963f, 1.81021893f, -0.813364565f, -1.0f, 0.997825742f,
+		0.0159310997f, 0.00213291566f, -0.0137981847f, 1.79107189f, -0.795643389f, -1.0f, 0.998477697f,
+		0.128118768f, -0.221863911f, 0.0980154797f, 1.79107189f, -0.795643389f, -1.0f, 0.998477697f,
+		0.240306452f, -0.445860744f, 0.209829152f, 1.79107189f, -0.795643389f, -1.0f, 0.998477697f,
+		0.352494121f, -0.669857562f, 0.321642816f, 1.79107189f, -0.795643389f, -1.0f, 0.998477697f,
+		0.464681804f, -0.89385438f, 0.433456481f, 1.79107189f, -0.795643389f, -1.0f, 0.998477697f,
+		0.576869488f, -1.11785126f, 0.545270145f, 1.79107189f, -0.795643389f, -1.0f, 0.998477697f,
+		0.689057171f, -1.34184802f, 0.657083809f, 1.79107189f, -0.795643389f, -1.0f, 0.998477697f,
+		0.801244795f, -1.56584489f, 0.768897474f, 1.79107189f, -0.795643389f, -1.0f, 0.998477697f,
+		0.913432479f, -1.78984177f, 0.880711138f, 1.79107189f, -0.795643389f, -1.0f, 0.998477697f,
+		0.0861029774f, -0.129454911f, 0.0473497696f, 1.79488349f, -0.799151182f, -1.0f, 0.998478651f,
+		0.190290779f, -0.337477356f, 0.151188627f, 1.79488349f, -0.799151182f, -1.0f, 0.998478651f,
+		0.294478595f, -0.545499861f, 0.255027503f, 1.79488349f, -0.799151182f, -1.0f, 0.998478651f,
+		0.398666412f, -0.753522277f, 0.358866364f, 1.79488349f, -0.799151182f, -1.0f, 0.998478651f,
+		0.502854228f, -0.961544752f, 0.462705225f, 1.79488349f, -0.799151182f, -1.0f, 0.998478651f,
+		0.607042015f, -1.16956723f, 0.566544116f, 1.79488349f, -0.799151182f, -1.0f, 0.998478651f,
+		0.711229801f, -1.3775897f, 0.670382977f, 1.79488349f, -0.799151182f, -1.0f, 0.998478651f,
+		0.815417647f, -1.58561218f, 0.774221838f, 1.79488349f, -0.799151182f, -1.0f, 0.998478651f,
+		0.919605434f, -1.79363465f, 0.878060699f, 1.79488349f, -0.799151182f, -1.0f, 0.998478651f,
+		0.146933347f, -0.24352327f, 0.100355767f, 1.79818523f, -0.802189946f, -1.0f, 0.998479605f,
+		0.244186252f, -0.437697917f, 0.19728145f, 1.79818523f, -0.802189946f, -1.0f, 0.998479605f,
+		0.341439158f, -0.631872594f, 0.294207126f, 1.79818523f, -0.802189946f, -1.0f, 0.998479605f,
+		0.438692063f, -0.826047242f, 0.391132802f, 1.79818523f, -0.802189946f, -1.0f, 0.998479605f,
+		0.535944998f, -1.02022183f, 0.488058478f, 1.79818523f, -0.802189946f, -1.0f, 0.998479605f,
+		0.633197904f, -1.21439648f, 0.584984183f, 1.79818523f, -0.802189946f, -1.0f, 0.998479605f,
+		0.730450809f, -1.40857112f, 0.681909859f, 1.79818523f, -0.802189946f, -1.0f, 0.998479605f,
+		0.827703714f, -1.60274577f, 0.778835535f, 1.79818523f, -0.802189946f, -1.0f, 0.998479605f,
+		0.92495662f, -1.79692042f, 0.875761211f, 1.79818523f, -0.802189946f, -1.0f, 0.998479605f,
+		0.200171158f, -0.343352228f, 0.146744147f, 1.80107272f, -0.804847538f, -1.0f, 0.998480678f,
+		0.291354746f, -0.525407434f, 0.237619489f, 1.80107272f, -0.804847538f, -1.0f, 0.998480678f,
+		0.382538348f, -0.707462668f, 0.328494847f, 1.80107272f, -0.804847538f, -1.0f, 0.998480678f,
+		0.473721951f, -0.889517903f, 0.419370204f, 1.80107272f, -0.804847538f, -1.0f, 0.998480678f,
+		0.564905524f, -1.07157314f, 0.510245562f, 1.80107272f, -0.804847538f, -1.0f, 0.998480678f,
+		0.656089127f, -1.25362837f, 0.601120949f, 1.80107272f, -0.804847538f, -1.0f, 0.998480678f,
+		0.74727273f, -1.43568361f, 0.691996276f, 1.80107272f, -0.804847538f, -1.0f, 0.998480678f,
+		0.838456333f, -1.61773884f, 0.782871604f, 1.80107272f, -0.804847538f, -1.0f, 0.998480678f,
+		0.929639876f, -1.79979408f, 0.873746991f, 1.80107272f, -0.804847538f, -1.0f, 0.998480678f,
+		0.247154415f, -0.431451052f, 0.187681064f, 1.80361867f, -0.807191074f, -1.0f, 0.99848181f,
+		0.332981735f, -0.602810681f, 0.273216903f, 1.80361867f, -0.807191074f, -1.0f, 0.99848181f,
+		0.418809056f, -0.77417028f, 0.358752728f, 1.80361867f, -0.807191074f, -1.0f, 0.99848181f,
+		0.504636347f, -0.945529938f, 0.444288552f, 1.80361867f, -0.807191074f, -1.0f, 0.99848181f,
+		0.590463698f, -1.1168896f, 0.529824376f, 1.80361867f, -0.807191074f, -1.0f, 0.99848181f,
+		0.676290989f, -1.28824925f, 0.6153602f, 1.80361867f, -0.807191074f, -1.0f, 0.99848181f,
+		0.76211834f, -1.45960879f, 0.700896025f, 1.80361867f, -0.807191074f, -1.0f, 0.99848181f,
+		0.847945631f, -1.63096845f, 0.786431849f, 1.80361867f, -0.807191074f, -1.0f, 0.99848181f,
+		0.933772981f, -1.80232811f, 0.871967733f, 1.80361867f, -0.807191074f, -1.0f, 0.99848181f,
+		0.288924158f, -0.509772182f, 0.224073902f, 1.80588007f, -0.809272766f, -1.0f, 0.998482943f,
+		0.369989574f, -0.671623051f, 0.304862678f, 1.80588007f, -0.809272766f, -1.0f, 0.998482943f,
+		0.45105499f, -0.833473921f, 0.385651499f, 1.80588007f, -0.809272766f, -1.0f, 0.998482943f,
+		0.532120407f, -0.995324731f, 0.46644029f, 1.80588007f, -0.809272766f, -1.0f, 0.998482943f,
+		0.613185763f, -1.15717566f, 0.547229052f, 1.80588007f, -0.809272766f, -1.0f, 0.998482943f,
+		0.69425118f, -1.31902647f, 0.628017843f, 1.80588007f, -0.809272766f, -1.0f, 0.998482943f,
+		0.775316596f, -1.4808774f, 0.708806634f, 1.80588007f, -0.809272766f, -1.0f, 0.998482943f,
+		0.856382012f, -1.64272821f, 0.789595425f, 1.80588007f, -0.809272766f, -1.0f, 0.998482943f,
+		0.937447429f, -1.80457902f, 0.870384276f, 1.80588007f, -0.809272766f, -1.0f, 0.998482943f,
+		0.326302588f, -0.579857528f, 0.256639212f, 1.80790174f, -0.811133921f, -1.0f, 0.998484194f,
+		0.403106689f, -0.733199298f, 0.33318004f, 1.80790174f, -0.811133921f, -1.0f, 0.998484194f,
+		0.479910821f, -0.886541009f, 0.409720838f, 1.80790174f, -0.811133921f, -1.0f, 0.998484194f,
+		0.556714952f, -1.03988278f, 0.486261636f, 1.80790174f, -0.811133921f, -1.0f, 0.998484194f,
+		0.633519053f, -1.19322455f, 0.562802434f, 1.80790174f, -0.811133921f, -1.0f, 0.998484194f,
+		0.710323155f, -1.34656632f, 0.639343262f, 1.80790174f, -0.811133921f, -1.0f, 0.998484194f,
+		0.787127316f, -1.49990809f, 0.715884089f, 1.80790174f, -0.811133921f, -1.0f, 0.998484194f,
+		0.863931417f, -1.65324986f, 0.792424917f, 1.80790174f, -0.811133921f, -1.0f, 0.998484194f,
+		0.940735519f, -1.80659163f, 0.868965685f, 1.80790174f, -0.811133921f, -1.0f, 0.998484194f,
+		0.359947562f, -0.642940938f, 0.285950452f, 1.80971944f, -0.81280756f, -1.0f, 0.998485506f,
+		0.432916045f, -0.788623512f, 0.358667552f, 1.80971944f, -0.81280756f, -1.0f, 0.998485506f,
+		0.505884469f, -0.934306026f, 0.431384683f, 1.80971944f, -0.81280756f, -1.0f, 0.998485506f,
+		0.578852952f, -1.0799886f, 0.504101813f, 1.80971944f, -0.81280756f, -1.0f, 0.998485506f,
+		0.651821434f, -1.22567117f, 0.576818883f, 1.80971944f, -0.81280756f, -1.0f, 0.998485506f,
+		0.724789858f, -1.37135363f, 0.649536014f, 1.80971944f, -0.81280756f, -1.0f, 0.998485506f,
+		0.797758341f, -1.5170362f, 0.722253144f, 1.80971944f, -0.81280756f, -1.0f, 0.998485506f,
+		0.870726824f, -1.66271877f, 0.794970214f, 1.80971944f, -0.81280756f, -1.0f, 0.998485506f,
+		0.943695247f, -1.80840135f, 0.867687345f, 1.80971944f, -0.81280756f, -1.0f, 0.998485506f,
+		0.390391886f, -0.700021625f, 0.312471926f, 1.81136239f, -0.814320326f, -1.0f, 0.998486936f,
+		0.459889591f, -0.838773549f, 0.381729066f, 1.81136239f, -0.814320326f, -1.0f, 0.998486936f,
+		0.529387295f, -0.977525532f, 0.450986236f, 1.81136239f, -0.814320326f, -1.0f, 0.998486936f,
+		0.59888494f, -1.11627746f, 0.520243406f, 1.81136239f, -0.814320326f, -1.0f, 0.998486936f,
+		0.668382645f, -1.25502944f, 0.589500546f, 1.81136239f, -0.814320326f, -1.0f, 0.998486936f,
+		0.737880349f, -1.3937813f, 0.658757687f, 1.81136239f, -0.814320326f, -1.0f, 0.998486936f,
+		0.807378054f, -1.53253329f, 0.728014827f, 1.81136239f, -0.814320326f, -1.0f, 0.998486936f,
+		0.876875699f, -1.67128527f, 0.797272027f, 1.81136239f, -0.814320326f, -1.0f, 0.998486936f,
+		0.946373403f, -1.81003714f, 0.866529167f, 1.81136239f, -0.814320326f, -1.0f, 0.998486936f,
+		0.0159399863f, 0.00213410519f, -0.0138058802f, 1.79168487f, -0.79615134f, -1.0f, 0.998967648f,
+		0.128126651f, -0.22198841f, 0.0981329679f, 1.79168487f, -0.79615134f, -1.0f, 0.998967648f,
+		0.240313306f, -0.446110934f, 0.210071817f, 1.79168487f, -0.79615134f, -1.0f, 0.998967648f,
+		0.352499962f, -0.670233488f, 0.322010666f, 1.79168487f, -0.79615134f, -1.0f, 0.998967648f,
+		0.464686632f, -0.894355953f, 0.4339495f, 1.79168487f, -0.79615134f, -1.0f, 0.998967648f,
+		0.576873302f, -1.11847854f, 0.545888364f, 1.79168487f, -0.79615134f, -1.0f, 0.998967648f,
+		0.689059973f, -1.34260106f, 0.657827199f, 1.79168487f, -0.79615134f, -1.0f, 0.998967648f,
+		0.801246583f, -1.56672359f, 0.769766033f, 1.79168487f, -0.79615134f, -1.0f, 0.998967648f,
+		0.913433254f, -1.79084611f, 0.881704926f, 1.79168487f, -0.79615134f, -1.0f, 0.998967648f,
+		0.0861109495f, -0.129533842f, 0.0474107042f, 1.79550707f, -0.799668729f, -1.0f, 0.998967886f,
+		0.190297857f, -0.337674022f, 0.151366755f, 1.79550707f, -0.799668729f, -1.0f, 0.998967886f,
+		0.294484735f, -0.545814216f, 0.255322814f, 1.79550707f, -0.799668729f, -1.0f, 0.998967886f,
+		0.398671657f, -0.753954351f, 0.359278858f, 1.79550707f, -0.799668729f, -1.0f, 0.998967886f,
+		0.50285852f, -0.962094545f, 0.463234931f, 1.79550707f, -0.799668729f, -1.0f, 0.998967886f,
+		0.607045472f, -1.17023468f, 0.567190945f, 1.79550707f, -0.799668729f, -1.0f, 0.998967886f,
+		0.711232364f, -1.37837481f, 0.671147048f, 1.79550707f, -0.799668729f, -1.0f, 0.998967886f,
+		0.815419257f, -1.58651507f, 0.775103092f, 1.79550707f, -0.799668729f, -1.0f, 0.998967886f,
+		0.919606149f, -1.7946552f, 0.879059136f, 1.79550707f, -0.799668729f, -1.0f, 0.998967886f,
+		0.146940574f, -0.243672922f, 0.100477211f, 1.7988193f, -0.80271703f, -1.0f, 0.998968184f,
+		0.24419266f, -0.43795836f, 0.197513163f, 1.7988193f, -0.80271703f, -1.0f, 0.998968184f,
+		0.341444761f, -0.632243752f, 0.294549108f, 1.7988193f, -0.80271703f, -1.0f, 0.998968184f,
+		0.438696831f, -0.826529205f, 0.391585052f, 1.7988193f, -0.80271703f, -1.0f, 0.998968184f,
+		0.535948932f, -1.02081466f, 0.488620996f, 1.7988193f, -0.80271703f, -1.0f, 0.998968184f,
+		0.633201003f, -1.21510005f, 0.585656941f, 1.7988193f, -0.80271703f, -1.0f, 0.998968184f,
+		0.730453074f, -1.40938544f, 0.682692885f, 1.7988193f, -0.80271703f, -1.0f, 0.998968184f,
+		0.827705145f, -1.60367095f, 0.77972883f, 1.7988193f, -0.80271703f, -1.0f, 0.998968184f,
+		0.924957275f, -1.79795635f, 0.876764774f, 1.7988193f, -0.80271703f, -1.0f, 0.998968184f,
+		0.200177759f, -0.343564898f, 0.146919519f, 1.80171728f, -0.805384099f, -1.0f, 0.998968542f,
+		0.291360617f, -0.525724828f, 0.23789908f, 1.80171728f, -0.805384099f, -1.0f, 0.998968542f,
+		0.382543445f, -0.707884789f, 0.328878641f, 1.80171728f, -0.805384099f, -1.0f, 0.998968542f,
+		0.473726273f, -0.890044749f, 0.419858217f, 1.80171728f, -0.805384099f, -1.0f, 0.998968542f,
+		0.564909101f, -1.07220471f, 0.510837793f, 1.80171728f, -0.805384099f, -1.0f, 0.998968542f,
+		0.656091988f, -1.25436461f, 0.601817369f, 1.80171728f, -0.805384099f, -1.0f, 0.998968542f,
+		0.747274816f, -1.43652463f, 0.692796886f, 1.80171728f, -0.805384099f, -1.0f, 0.998968542f,
+		0.838457644f, -1.61868453f, 0.783776462f, 1.80171728f, -0.805384099f, -1.0f, 0.998968542f,
+		0.929640472f, -1.80084455f, 0.874756038f, 1.80171728f, -0.805384099f, -1.0f, 0.998968542f,
+		0.247160494f, -0.431720465f, 0.187904939f, 1.80427384f, -0.807737052f, -1.0f, 0.99896884f,
+		0.33298713f, -0.603179455f, 0.273539662f, 1.80427384f, -0.807737052f, -1.0f, 0.99896884f,
+		0.418813735f, -0.774638474f, 0.359174341f, 1.80427384f, -0.807737052f, -1.0f, 0.99896884f,
+		0.504640341f, -0.946097493f, 0.444809049f, 1.80427384f, -0.807737052f, -1.0f, 0.99896884f,
+		0.590466976f, -1.11755657f, 0.530443788f, 1.80427384f, -0.807737052f, -1.0f, 0.99896884f,
+		0.676293612f, -1.28901553f, 0.616078436f, 1.80427384f, -0.807737052f, -1.0f, 0.99896884f,
+		0.762120247f, -1.46047449f, 0.701713145f, 1.80427384f, -0.807737052f, -1.0f, 0.99896884f,
+		0.847946882f, -1.63193357f, 0.787347853f, 1.80427384f, -0.807737052f, -1.0f, 0.99896884f,
+		0.933773518f, -1.80339253f, 0.872982562f, 1.80427384f, -0.807737052f, -1.0f, 0.99896884f,
+		0.28892979f, -0.510093093f, 0.22434178f, 1.80654585f, -0.809828162f, -1.0f, 0.998969197f,
+		0.369994551f, -0.672038555f, 0.305224717f, 1.80654585f, -0.809828162f, -1.0f, 0.998969197f,
+		0.451059312f, -0.833984077f, 0.386107653f, 1.80654585f, -0.809828162f, -1.0f, 0.998969197f,
+		0.532124102f, -0.995929599f, 0.46699056f, 1.80654585f, -0.809828162f, -1.0f, 0.998969197f,
+		0.613188863f, -1.15787506f, 0.547873497f, 1.80654585f, -0.809828162f, -1.0f, 0.998969197f,
+		0.694253623f, -1.31982064f, 0.628756404f, 1.80654585f, -0.809828162f, -1.0f, 0.998969197f,
+		0.775318384f, -1.4817661f, 0.70963937f, 1.80654585f, -0.809828162f, -1.0f, 0.998969197f,
+		0.856383145f, -1.64371157f, 0.790522277f, 1.80654585f, -0.809828162f, -1.0f, 0.998969197f,
+		0.937447906f, -1.80565703f, 0.871405244f, 1.80654585f, -0.809828162f, -1.0f, 0.998969197f,
+		0.326307803f, -0.580225527f, 0.256947339f, 1.80857825f, -0.811698794f, -1.0f, 0.998969615f,
+		0.403111339f, -0.733657658f, 0.33357805f, 1.80857825f, -0.811698794f, -1.0f, 0.998969615f,
+		0.479914844f, -0.887089849f, 0.410208762f, 1.80857825f, -0.811698794f, -1.0f, 0.998969615f,
+		0.556718409f, -1.04052198f, 0.486839473f, 1.80857825f, -0.811698794f, -1.0f, 0.998969615f,
+		0.633521914f, -1.19395411f, 0.563470185f, 1.80857825f, -0.811698794f, -1.0f, 0.998969615f,
+		0.71032542f, -1.34738624f, 0.640100896f, 1.80857825f, -0.811698794f, -1.0f, 0.998969615f,
+		0.787128985f, -1.50081849f, 0.716731608f, 1.80857825f, -0.811698794f, -1.0f, 0.998969615f,
+		0.86393249f, -1.65425062f, 0.793362319f, 1.80857825f, -0.811698794f, -1.0f, 0.998969615f,
+		0.940735996f, -1.80768275f, 0.869993031f, 1.80857825f, -0.811698794f, -1.0f, 0.998969615f,
+		0.35995245f, -0.64335233f, 0.286295593f, 1.8104068f, -0.813381851f, -1.0f, 0.998969972f,
+		0.432920367f, -0.789121449f, 0.359098792f, 1.8104068f, -0.813381851f, -1.0f, 0.998969972f,
+		0.505888283f, -0.934890568f, 0.431902021f, 1.8104068f, -0.813381851f, -1.0f, 0.998969972f,
+		0.57885617f, -1.08065975f, 0.50470525f, 1.8104068f, -0.813381851f, -1.0f, 0.998969972f,
+		0.651824057f, -1.22642887f, 0.57750845f, 1.8104068f, -0.813381851f, -1.0f, 0.998969972f,
+		0.724792004f, -1.37219799f, 0.650311649f, 1.8104068f, -0.813381851f, -1.0f, 0.998969972f,
+		0.797759891f, -1.5179671f, 0.723114848f, 1.8104068f, -0.813381851f, -1.0f, 0.998969972f,
+		0.870727777f, -1.66373622f, 0.795918047f, 1.8104068f, -0.813381851f, -1.0f, 0.998969972f,
+		0.943695664f, -1.80950534f, 0.868721306f, 1.8104068f, -0.813381851f, -1.0f, 0.998969972f,
+		0.390396476f, -0.70047313f, 0.31285134f, 1.81206059f, -0.814904153f, -1.0f, 0.998970389f,
+		0.459893644f, -0.839308262f, 0.382191181f, 1.81206059f, -0.814904153f, -1.0f, 0.998970389f,
+		0.529390812f, -0.978143334f, 0.451530993f, 1.81206059f, -0.814904153f, -1.0f, 0.998970389f,
+		0.59888798f, -1.11697841f, 0.520870805f, 1.81206059f, -0.814904153f, -1.0f, 0.998970389f,
+		0.668385148f, -1.25581348f, 0.590210617f, 1.81206059f, -0.814904153f, -1.0f, 0.998970389f,
+		0.737882316f, -1.39464855f, 0.659550428f, 1.81206059f, -0.814904153f, -1.0f, 0.998970389f,
+		0.807379484f, -1.53348374f, 0.72889024f, 1.81206059f, -0.814904153f, -1.0f, 0.998970389f,
+		0.876876652f, -1.67231882f, 0.798230112f, 1.81206059f, -0.814904153f, -1.0f, 0.998970389f,
+		0.94637382f, -1.81115389f, 0.867569923f, 1.81206059f, -0.814904153f, -1.0f, 0.998970389f,
+	},
+};
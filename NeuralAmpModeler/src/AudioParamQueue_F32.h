@@ -0,0 +1,130 @@
+/**
+ * @file AudioParamQueue_F32.h
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Parameter changes from loop() / MIDI callbacks to the audio
+ * 		interrupt without disabling the interrupts.
+ * 		AudioParamQueue_F32 is a lock-free single producer (loop) single
+ * 		consumer (audio update) ring of timestamped events. The audio
+ * 		object drains the events due in the current block at the block
+ * 		start, each event carries its sample offset within the block.
+ * 		AudioParamRamp_F32 smooths a parameter to the new value over
+ * 		a fixed number of samples to avoid zipper noise.
+ * @version 0.1
+ * @date 2024-03-08
+ */
+#ifndef _AUDIOPARAMQUEUE_F32_H_
+#define _AUDIOPARAMQUEUE_F32_H_
+
+#include <Arduino.h>
+#include "arm_math.h"
+
+typedef struct
+{
+	uint32_t time;		// sample time, 0 = next block start; offset in the block when popped
+	uint8_t id;			// parameter, defined by the audio object
+	float32_t value;
+} audio_param_event_t;
+
+/**
+ * @brief SPSC event ring, size has to be a power of 2
+ */
+template <uint16_t N>
+class AudioParamQueue_F32
+{
+	static_assert((N & (N - 1)) == 0, "queue size has to be a power of 2");
+public:
+	/**
+	 * @brief Producer: add an event
+	 *
+	 * @param id parameter
+	 * @param value new value
+	 * @param time sample time from now(), 0 = at the next block start,
+	 * 			the times have to be posted in order
+	 * @return false if the queue is full
+	 */
+	bool post(uint8_t id, float32_t value, uint32_t time = 0)
+	{
+		const uint32_t t = __atomic_load_n(&tail, __ATOMIC_RELAXED);
+		if (t - __atomic_load_n(&head, __ATOMIC_ACQUIRE) >= N) return false;
+		audio_param_event_t &e = events[t & (N - 1)];
+		e.time = time;
+		e.id = id;
+		e.value = value;
+		__atomic_store_n(&tail, t + 1, __ATOMIC_RELEASE);
+		return true;
+	}
+	/**
+	 * @brief Producer: sample time of the next audio block start
+	 */
+	uint32_t now() {return __atomic_load_n(&clock, __ATOMIC_ACQUIRE);}
+	/**
+	 * @brief Consumer: take the next event due before the end of the block,
+	 * 			late events are due at the block start
+	 *
+	 * @param e event, time replaced by the sample offset in the block
+	 * @param len block length
+	 * @return false if no event is due in this block
+	 */
+	bool pop(audio_param_event_t &e, uint16_t len)
+	{
+		const uint32_t h = __atomic_load_n(&head, __ATOMIC_RELAXED);
+		if (h == __atomic_load_n(&tail, __ATOMIC_ACQUIRE)) return false;
+		e = events[h & (N - 1)];
+		int32_t offset = e.time ? (int32_t)(e.time - clock) : 0;
+		if (offset >= (int32_t)len) return false;
+		e.time = offset > 0 ? offset : 0;
+		__atomic_store_n(&head, h + 1, __ATOMIC_RELEASE);
+		return true;
+	}
+	/**
+	 * @brief Consumer: advance the sample time at the end of the block
+	 */
+	void advance(uint16_t len) {__atomic_store_n(&clock, clock + len, __ATOMIC_RELEASE);}
+private:
+	audio_param_event_t events[N];
+	uint32_t head = 0;
+	uint32_t tail = 0;
+	uint32_t clock = 1;		// 0 is reserved for "now"
+};
+
+/**
+ * @brief Linear parameter ramp, updated once per sample
+ */
+class AudioParamRamp_F32
+{
+public:
+	AudioParamRamp_F32(float32_t value, uint16_t rampSamples) : value(value), target(value), samples(rampSamples) {}
+	void set(float32_t newTarget)
+	{
+		target = newTarget;
+		step = (target - value) / samples;
+		remaining = samples;
+	}
+	/**
+	 * @brief Jump to the value without a ramp
+	 */
+	void reset(float32_t newValue)
+	{
+		value = target = newValue;
+		remaining = 0;
+	}
+	float32_t next()
+	{
+		if (remaining)
+		{
+			value = --remaining ? value + step : target;
+		}
+		return value;
+	}
+	float32_t get() {return value;}
+	float32_t getTarget() {return target;}
+	bool isRamping() {return remaining != 0;}
+private:
+	float32_t value;
+	float32_t target;
+	float32_t step = 0.0f;
+	uint16_t samples;
+	uint16_t remaining = 0;
+};
+
+#endif // _AUDIOPARAMQUEUE_F32_H_
@@ -0,0 +1,159 @@
+/**
+ * @file AudioProfiler_F32.cpp
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Per object CPU load histograms of the audio graph.
+ * @version 0.1
+ * @date 2024-03-06
+ */
+#include "AudioProfiler_F32.h"
+
+float32_t AudioProfiler_F32::binEdges[AUDIO_PROFILER_BINS - 1];
+
+AudioProfiler_F32::AudioProfiler_F32() : AudioStream_F32(0, NULL)
+{
+	// no connections, always updated
+	active = true;
+	const float32_t ratio = powf(AUDIO_PROFILER_LOAD_MAX / AUDIO_PROFILER_LOAD_MIN, 1.0f / (AUDIO_PROFILER_BINS - 2));
+	float32_t edge = AUDIO_PROFILER_LOAD_MIN;
+	for (uint8_t i = 0; i < AUDIO_PROFILER_BINS - 1; i++)
+	{
+		binEdges[i] = edge;
+		edge *= ratio;
+	}
+	memset(entries, 0, sizeof(entries));
+	entries[AUDIO_PROFILER_MAX_OBJECTS].name = "graph";
+}
+
+void AudioProfiler_F32::update()
+{
+	float32_t loads[AUDIO_PROFILER_MAX_OBJECTS];
+	float32_t total = 0.0f, largest = 0.0f;
+	uint8_t largestIdx = 0;
+	// update() times of this audio cycle, the profiler runs last
+	for (uint8_t i = 0; i < count; i++)
+	{
+		loads[i] = entries[i].obj->processorUsage();
+		total += loads[i];
+		addLoad(entries[i], loads[i]);
+		if (loads[i] > largest)
+		{
+			largest = loads[i];
+			largestIdx = i;
+		}
+	}
+	entry_t &graph = entries[AUDIO_PROFILER_MAX_OBJECTS];
+	if (total > graph.max || blocks == 0)
+	{
+		graph.worst = total;
+		for (uint8_t i = 0; i < count; i++) entries[i].worst = loads[i];
+	}
+	addLoad(graph, total);
+	if (total > threshold)
+	{
+		graph.overruns++;
+		if (count) entries[largestIdx].overruns++;
+	}
+	blocks++;
+}
+
+void AudioProfiler_F32::addLoad(entry_t &e, float32_t load)
+{
+	e.hist[bin(load)]++;
+	e.sum += load;
+	if (load > e.max) e.max = load;
+}
+
+uint8_t AudioProfiler_F32::bin(float32_t load)
+{
+	// number of edges <= load
+	uint8_t lo = 0, hi = AUDIO_PROFILER_BINS - 1;
+	while (lo < hi)
+	{
+		uint8_t mid = (lo + hi) >> 1;
+		if (binEdges[mid] <= load) lo = mid + 1;
+		else hi = mid;
+	}
+	return lo;
+}
+
+float32_t AudioProfiler_F32::percentile(const uint32_t *hist, uint32_t n, float32_t q, float32_t max)
+{
+	if (n == 0) return 0.0f;
+	uint32_t target = (uint32_t)ceilf(q * n);
+	if (target == 0) target = 1;
+	uint32_t acc = 0;
+	for (uint8_t b = 0; b < AUDIO_PROFILER_BINS - 1; b++)
+	{
+		acc += hist[b];
+		// upper edge of the bin, never more than the measured max
+		if (acc >= target) return binEdges[b] < max ? binEdges[b] : max;
+	}
+	return max;
+}
+
+bool AudioProfiler_F32::add(AudioStream &obj, const char *name)
+{
+	if (count >= AUDIO_PROFILER_MAX_OBJECTS) return false;
+	__disable_irq();
+	memset(&entries[count], 0, sizeof(entry_t));
+	entries[count].obj = &obj;
+	entries[count].name = name;
+	count++;
+	__enable_irq();
+	reset();
+	return true;
+}
+
+bool AudioProfiler_F32::getStats(uint8_t idx, stats_t &st)
+{
+	if (idx > count) return false;
+	static entry_t e;	// too large for the loop() stack
+	__disable_irq();
+	e = entries[idx == count ? AUDIO_PROFILER_MAX_OBJECTS : idx];
+	uint32_t n = blocks;
+	__enable_irq();
+	st.blocks = n;
+	st.max = e.max;
+	st.mean = n ? (float32_t)(e.sum / n) : 0.0f;
+	st.p50 = percentile(e.hist, n, 0.50f, e.max);
+	st.p99 = percentile(e.hist, n, 0.99f, e.max);
+	st.worst = e.worst;
+	st.overruns = e.overruns;
+	return true;
+}
+
+void AudioProfiler_F32::print(Print &out)
+{
+	stats_t st;
+	out.print("CPU p50/p99/max%:");
+	for (uint8_t i = 0; i <= count; i++)
+	{
+		getStats(i, st);
+		out.printf(" %s %.1f/%.1f/%.1f", getName(i), st.p50, st.p99, st.max);
+	}
+	out.print("    \r\n");
+	getStats(count, st);
+	out.printf("Overruns %u/%u, slowest block %.1f%%:", st.overruns, st.blocks, st.worst);
+	for (uint8_t i = 0; i < count; i++)
+	{
+		getStats(i, st);
+		out.printf(" %s %.1f", getName(i), st.worst);
+		if (st.overruns) out.printf("(%u)", st.overruns);
+	}
+	out.print("    \r\n");
+}
+
+void AudioProfiler_F32::reset()
+{
+	__disable_irq();
+	for (uint8_t i = 0; i <= AUDIO_PROFILER_MAX_OBJECTS; i++)
+	{
+		memset(entries[i].hist, 0, sizeof(entries[i].hist));
+		entries[i].sum = 0.0;
+		entries[i].max = 0.0f;
+		entries[i].worst = 0.0f;
+		entries[i].overruns = 0;
+	}
+	blocks = 0;
+	__enable_irq();
+}
@@ -0,0 +1,110 @@
+/**
+ * @file AudioProfiler_F32.h
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Per object CPU load histograms of the audio graph.
+ * 		The audio scheduler measures the update() time of every object
+ * 		with the DWT cycle counter (host clock in the simulator). The
+ * 		profiler is an audio object updated last in every audio cycle,
+ * 		it reads the time of each registered object for the current block
+ * 		and adds it to a histogram. Unlike processorUsageMax() sampled
+ * 		in loop(), nothing is lost between the reads: the p50/p99/max
+ * 		of every object, the blocks exceeding the overrun threshold and
+ * 		which object was the largest part of each of them are kept.
+ * 		The objects of the graph run one after another, the whole block
+ * 		time is the critical path. The breakdown of the slowest block
+ * 		seen is stored to show what made it slow.
+ *
+ * 		The profiler has to be declared after all the audio objects,
+ * 		the update order is the construction order.
+ * @version 0.1
+ * @date 2024-03-06
+ */
+#ifndef _AUDIOPROFILER_F32_H_
+#define _AUDIOPROFILER_F32_H_
+
+#include <Arduino.h>
+#include "AudioStream_F32.h"
+#include "arm_math.h"
+
+#define AUDIO_PROFILER_MAX_OBJECTS	(16)
+// log spaced bins, 0.1% .. 200% of the block time, ~13% wide
+#define AUDIO_PROFILER_BINS			(64)
+#define AUDIO_PROFILER_LOAD_MIN		(0.1f)
+#define AUDIO_PROFILER_LOAD_MAX		(200.0f)
+
+class AudioProfiler_F32 : public AudioStream_F32
+{
+public:
+	AudioProfiler_F32();
+	virtual void update(void);
+
+	typedef struct
+	{
+		float32_t p50;			// % of the audio block time
+		float32_t p99;
+		float32_t max;
+		float32_t mean;
+		float32_t worst;		// share in the slowest block
+		uint32_t blocks;
+		uint32_t overruns;		// overrun blocks where the object was the largest load
+	} stats_t;
+
+	/**
+	 * @brief Register an object to profile
+	 *
+	 * @param obj audio object
+	 * @param name short name used in the snapshot
+	 * @return false if the profiler is full
+	 */
+	bool add(AudioStream &obj, const char *name);
+	uint8_t size() {return count;}
+	const char *getName(uint8_t idx) {return idx < count ? entries[idx].name : "graph";}
+	/**
+	 * @brief Statistics of one object since the last reset,
+	 * 			idx = size() returns the whole graph (sum of the objects)
+	 */
+	bool getStats(uint8_t idx, stats_t &st);
+	/**
+	 * @brief Number of blocks with the graph load over the threshold
+	 */
+	uint32_t getOverruns() {return entries[AUDIO_PROFILER_MAX_OBJECTS].overruns;}
+	/**
+	 * @brief Graph load counted as an overrun, default 100% of the block time
+	 */
+	void setOverrunThreshold(float32_t percent)
+	{
+		__disable_irq();
+		threshold = percent;
+		__enable_irq();
+	}
+	/**
+	 * @brief Print a compact snapshot, two lines:
+	 * 			p50/p99/max of every object and the graph, then the overruns
+	 * 			and the loads in the slowest block
+	 */
+	void print(Print &out);
+	void reset();
+
+private:
+	typedef struct
+	{
+		AudioStream *obj;
+		const char *name;
+		uint32_t hist[AUDIO_PROFILER_BINS];
+		float64_t sum;
+		float32_t max;
+		float32_t worst;
+		uint32_t overruns;
+	} entry_t;
+	entry_t entries[AUDIO_PROFILER_MAX_OBJECTS + 1];	// + graph total
+	uint8_t count = 0;
+	uint32_t blocks = 0;
+	float32_t threshold = 100.0f;
+	static float32_t binEdges[AUDIO_PROFILER_BINS - 1];
+
+	static uint8_t bin(float32_t load);
+	static float32_t percentile(const uint32_t *hist, uint32_t n, float32_t q, float32_t max);
+	void addLoad(entry_t &e, float32_t load);
+};
+
+#endif // _AUDIOPROFILER_F32_H_
@@ -0,0 +1,86 @@
+/**
+ * @file AudioTasks_F32.cpp
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Cooperative background jobs for the non real time DSP work
+ * @version 0.1
+ * @date 2024-03-13
+ */
+#include "AudioTasks_F32.h"
+
+bool AudioTaskScheduler_F32::post(AudioTask_F32 &task, uint8_t priority, AudioTask_F32::done_cb_t done, void *ctx)
+{
+	if (!task.queued)
+	{
+		if (count >= AUDIO_TASKS_MAX) return false;
+		tasks[count++] = &task;
+		task.queued = true;
+		task.seq = seq++;
+		task.steps = 0;
+		task.stepMax = 0;
+	}
+	task.priority = priority;
+	task.done = done;
+	task.ctx = ctx;
+	return true;
+}
+
+bool AudioTaskScheduler_F32::cancel(AudioTask_F32 &task)
+{
+	for (uint8_t i = 0; i < count; i++)
+	{
+		if (tasks[i] != &task) continue;
+		remove(i);
+		return true;
+	}
+	return false;
+}
+
+void AudioTaskScheduler_F32::remove(uint8_t idx)
+{
+	tasks[idx]->queued = false;
+	for (uint8_t i = idx + 1; i < count; i++) tasks[i - 1] = tasks[i];
+	count--;
+}
+
+// highest priority, then the oldest, skipping the tasks waiting for the audio update
+AudioTask_F32 *AudioTaskScheduler_F32::next()
+{
+	AudioTask_F32 *best = NULL;
+	for (uint8_t i = 0; i < count; i++)
+	{
+		AudioTask_F32 *t = tasks[i];
+		if (t->waiting) continue;
+		if (!best || t->priority > best->priority ||
+			(t->priority == best->priority && (int32_t)(t->seq - best->seq) < 0))
+			best = t;
+	}
+	return best;
+}
+
+uint32_t AudioTaskScheduler_F32::run(uint32_t budgetUs)
+{
+	const uint32_t budget = budgetUs * (F_CPU_ACTUAL / 1000000);
+	const uint32_t start = ARM_DWT_CYCCNT;
+	uint32_t steps = 0;
+	for (uint8_t i = 0; i < count; i++) tasks[i]->waiting = false;
+	AudioTask_F32 *t;
+	while ((t = next()) != NULL)
+	{
+		const uint32_t t0 = ARM_DWT_CYCCNT;
+		const AudioTask_F32::state_t state = t->step();
+		const uint32_t cycles = ARM_DWT_CYCCNT - t0;
+		steps++;
+		t->steps++;
+		if (cycles > t->stepMax) t->stepMax = cycles;
+		if (cycles > budget) overBudget++;
+		if (state == AudioTask_F32::TASK_WAIT) t->waiting = true;
+		else if (state == AudioTask_F32::TASK_DONE)
+		{
+			cancel(*t);
+			// the callback may post the task again or post new ones
+			if (t->done) t->done(*t, t->ctx);
+		}
+		if (ARM_DWT_CYCCNT - start >= budget) break;
+	}
+	return steps;
+}
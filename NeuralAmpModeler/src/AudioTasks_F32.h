@@ -0,0 +1,172 @@
+/**
+ * @file AudioTasks_F32.h
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Cooperative background jobs for the non real time DSP work
+ * 		(model weights, filter coefficients, IR spectra) done in loop()
+ * 		instead of the MIDI callbacks or the audio interrupt.
+ * 		A task is split into steps of bounded duration. The scheduler
+ * 		runs the steps of the highest priority task (FIFO within the same
+ * 		priority) until the time budget of the run() call is used up,
+ * 		so loop() keeps polling MIDI and the serial port between them.
+ * 		A step waiting for the audio interrupt returns TASK_WAIT and the
+ * 		task is skipped until the next run(). A finished task calls its
+ * 		completion callback.
+ * 		AudioPublished_F32 passes the results to the audio interrupt:
+ * 		the task fills the back buffer, publish() swaps the buffer index
+ * 		atomically, the audio update picks it up at the block start.
+ *
+ * 		The scheduler and the tasks are used from loop() only,
+ * 		post() from the MIDI callbacks is fine (called by usbMIDI.read()).
+ * @version 0.1
+ * @date 2024-03-13
+ */
+#ifndef _AUDIOTASKS_F32_H_
+#define _AUDIOTASKS_F32_H_
+
+#include <Arduino.h>
+#include "AudioStream_F32.h"
+#include "arm_math.h"
+
+#define AUDIO_TASKS_MAX			(8)
+#define AUDIO_TASKS_BUDGET_US	(1000)		// default time spent in one run() call
+
+class AudioTaskScheduler_F32;
+
+class AudioTask_F32
+{
+public:
+	typedef enum
+	{
+		TASK_CONTINUE,		// more steps to do
+		TASK_WAIT,			// waiting for the audio update, try again in the next run()
+		TASK_DONE
+	} state_t;
+	typedef void (*done_cb_t)(AudioTask_F32 &task, void *ctx);
+
+	virtual ~AudioTask_F32() {}
+	/**
+	 * @brief Do one piece of the work, should take well below the run() budget
+	 */
+	virtual state_t step() = 0;
+	bool isQueued() {return queued;}
+	uint32_t getSteps() {return steps;}
+	/**
+	 * @brief Longest step in us since the task was posted
+	 */
+	float32_t getStepMax() {return (float32_t)stepMax * (1000000.0f / F_CPU_ACTUAL);}
+private:
+	friend class AudioTaskScheduler_F32;
+	bool queued = false;
+	bool waiting = false;
+	uint8_t priority = 0;
+	uint32_t seq = 0;
+	uint32_t steps = 0;
+	uint32_t stepMax = 0;		// cycles
+	done_cb_t done = NULL;
+	void *ctx = NULL;
+};
+
+/**
+ * @brief Task calling a function until it returns true,
+ * 			ie. to move a library call out of a MIDI callback
+ */
+class AudioTaskCall_F32 : public AudioTask_F32
+{
+public:
+	typedef bool (*func_t)(void *arg);
+	AudioTaskCall_F32(func_t func, void *arg = NULL) : func(func), arg(arg) {}
+	state_t step() override {return func(arg) ? TASK_DONE : TASK_CONTINUE;}
+private:
+	func_t func;
+	void *arg;
+};
+
+class AudioTaskScheduler_F32
+{
+public:
+	enum
+	{
+		PRIO_LOW = 0,
+		PRIO_NORMAL = 1,
+		PRIO_HIGH = 2
+	};
+	/**
+	 * @brief Queue a task, a task already queued keeps its place
+	 * 			and gets the new priority and callback
+	 *
+	 * @param priority higher runs first
+	 * @param done called from run() when the task is finished
+	 * @return false if the scheduler is full
+	 */
+	bool post(AudioTask_F32 &task, uint8_t priority = PRIO_NORMAL, AudioTask_F32::done_cb_t done = NULL, void *ctx = NULL);
+	/**
+	 * @brief Remove a queued task, the completion callback is not called
+	 */
+	bool cancel(AudioTask_F32 &task);
+	/**
+	 * @brief Run the task steps, call from loop()
+	 *
+	 * @param budgetUs time for this call, at least one step is run
+	 * 			if a task is ready
+	 * @return number of steps run
+	 */
+	uint32_t run(uint32_t budgetUs = AUDIO_TASKS_BUDGET_US);
+	uint8_t pending() {return count;}
+	/**
+	 * @brief Steps which took longer than the whole run() budget
+	 */
+	uint32_t getOverBudget() {return overBudget;}
+private:
+	AudioTask_F32 *tasks[AUDIO_TASKS_MAX];
+	uint8_t count = 0;
+	uint32_t seq = 0;
+	uint32_t overBudget = 0;
+	AudioTask_F32 *next();
+	void remove(uint8_t idx);
+};
+
+/**
+ * @brief Double buffered result passed to the audio update
+ * 		The producer (task) may only write the back buffer after the
+ * 		consumer (audio update) took the last published one, the consumer
+ * 		takes the front buffer once per block and must not keep the pointer
+ * 		beyond it.
+ */
+template <typename T>
+class AudioPublished_F32
+{
+public:
+	/**
+	 * @brief Producer: buffer to prepare, NULL while the audio update
+	 * 			has not taken the previous result yet
+	 */
+	T *edit()
+	{
+		const uint8_t f = __atomic_load_n(&front, __ATOMIC_RELAXED);
+		if (__atomic_load_n(&taken, __ATOMIC_ACQUIRE) != f) return NULL;
+		return &buf[f ^ 1];
+	}
+	/**
+	 * @brief Producer: make the buffer from edit() the current one
+	 */
+	void publish() {__atomic_store_n(&front, front ^ 1, __ATOMIC_RELEASE);}
+	/**
+	 * @brief Producer: the last published result
+	 */
+	const T *current() {return &buf[front];}
+	/**
+	 * @brief Consumer: take the current result at the block start
+	 */
+	const T *acquire()
+	{
+		const uint8_t f = __atomic_load_n(&front, __ATOMIC_ACQUIRE);
+		__atomic_store_n(&taken, f, __ATOMIC_RELEASE);
+		return &buf[f];
+	}
+private:
+	T buf[2];
+	uint8_t front = 0;
+	uint8_t taken = 0;
+};
+
+#endif // _AUDIOTASKS_F32_H_
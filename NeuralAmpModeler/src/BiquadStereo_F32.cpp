@@ -0,0 +1,82 @@
+/**
+ * @file BiquadStereo_F32.cpp
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Biquad cascade with the channels as two lanes
+ * @version 0.1
+ * @date 2024-03-19
+ */
+#include "BiquadStereo_F32.h"
+
+bool BiquadStereo_F32::init(uint8_t stages, const float32_t *coeffs)
+{
+	if (!stages || stages > BIQUAD_STEREO_STAGES_MAX) return false;
+	this->stages = stages;
+	this->coeffs = coeffs;
+	reset();
+	return true;
+}
+
+void BiquadStereo_F32::reset()
+{
+	memset(state, 0, sizeof(state));
+}
+
+// N stages known to the compiler: the stages unroll, the lanes vectorize on the host
+template <uint8_t N, bool RAMP>
+static void cascade(float32_t *L, float32_t *R, uint16_t len, const float32_t *from, const float32_t *to, float32_t *st)
+{
+	float32_t c[5 * N], dc[5 * N], d[4 * N];
+	const float32_t k = 1.0f / len;
+	for (uint8_t n = 0; n < 5 * N; n++)
+	{
+		c[n] = from[n];
+		if (RAMP) dc[n] = (to[n] - from[n]) * k;
+	}
+	memcpy(d, st, sizeof(d));
+	for (uint16_t i = 0; i < len; i++)
+	{
+		if (RAMP)
+			for (uint8_t n = 0; n < 5 * N; n++) c[n] += dc[n];
+		float32_t x[2] = {L[i], R[i]};
+		for (uint8_t s = 0; s < N; s++)
+		{
+			const float32_t *cs = c + 5 * s;
+			float32_t *ds = d + 4 * s;
+			for (uint8_t ch = 0; ch < 2; ch++)
+			{
+				const float32_t y = cs[0] * x[ch] + ds[ch];
+				ds[ch] = cs[1] * x[ch] + cs[3] * y + ds[2 + ch];
+				ds[2 + ch] = cs[2] * x[ch] + cs[4] * y;
+				x[ch] = y;
+			}
+		}
+		L[i] = x[0];
+		R[i] = x[1];
+	}
+	memcpy(st, d, sizeof(d));
+}
+
+template <bool RAMP>
+static void dispatch(uint8_t stages, float32_t *L, float32_t *R, uint16_t len, const float32_t *from, const float32_t *to, float32_t *st)
+{
+	switch (stages)
+	{
+		case 1: cascade<1, RAMP>(L, R, len, from, to, st); break;
+		case 2: cascade<2, RAMP>(L, R, len, from, to, st); break;
+		case 3: cascade<3, RAMP>(L, R, len, from, to, st); break;
+		case 4: cascade<4, RAMP>(L, R, len, from, to, st); break;
+		default: break;
+	}
+}
+
+void BiquadStereo_F32::process(float32_t *L, float32_t *R, uint16_t len)
+{
+	if (!coeffs || !len) return;
+	dispatch<false>(stages, L, R, len, coeffs, coeffs, state);
+}
+
+void BiquadStereo_F32::ramp(float32_t *L, float32_t *R, uint16_t len, const float32_t *from, const float32_t *to)
+{
+	if (!len) return;
+	dispatch<true>(stages, L, R, len, from, to, state);
+}
@@ -0,0 +1,67 @@
+/**
+ * @file BiquadStereo_F32.h
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Biquad cascade (df2T) running both channels as two lanes of one
+ * 		loop, shared by the stereo filters with the same coefficients on
+ * 		the left and the right channel.
+ * 		The CMSIS cascade runs one channel and one stage over the block at
+ * 		a time: every output sample waits for the previous one (the
+ * 		feedback), the FPU pipeline stalls on each multiply-add chain.
+ * 		Here the left and the right sample go through all the stages in
+ * 		the same iteration: two independent chains the M7 dual issue
+ * 		interleaves (the host compiler vectorizes the lanes), the block is
+ * 		read and written once instead of once per stage and channel.
+ * 		A stage holds 9 floats (5 coefficients, 2 states per channel),
+ * 		ramp() adds 5 steps: one or two fixed stages fit the 32 FPU
+ * 		registers of the M7, with more stages or the ramp (up to 56
+ * 		floats) part of them is reloaded from the stack every sample.
+ * 		Unlike arm_biquad_cascade_stereo_df2T_f32, the channels are
+ * 		separate buffers, the audio blocks need no interleaving.
+ * 		ramp() moves the coefficients linearly over the block for filters
+ * 		changing every block (smoothed knobs).
+ * 		bench_biquad of the host simulator compares it with the
+ * 		per-channel CMSIS cascades.
+ * @version 0.1
+ * @date 2024-03-19
+ */
+#ifndef _BIQUADSTEREO_F32_H_
+#define _BIQUADSTEREO_F32_H_
+
+#include <Arduino.h>
+#include "AudioStream_F32.h"
+#include "arm_math.h"
+
+#define BIQUAD_STEREO_STAGES_MAX	(4)
+
+class BiquadStereo_F32
+{
+public:
+	/**
+	 * @brief Set the stage count and the coefficients, the states are cleared
+	 *
+	 * @param stages 1 .. BIQUAD_STEREO_STAGES_MAX
+	 * @param coeffs 5 per stage, CMSIS format: b0, b1, b2, -a1, -a2.
+	 * 			Not copied, the array can be changed between the blocks.
+	 * @return false if the stage count is not supported
+	 */
+	bool init(uint8_t stages, const float32_t *coeffs);
+	void setCoeffs(const float32_t *coeffs) {this->coeffs = coeffs;}
+	uint8_t getStages() {return stages;}
+	void reset();
+	/**
+	 * @brief Filter both channels in place
+	 */
+	void process(float32_t *L, float32_t *R, uint16_t len);
+	/**
+	 * @brief Filter with the coefficients moving linearly from the ones
+	 * 			of from to the ones of to, the last sample uses to.
+	 * 			The coefficients set by init() are not used.
+	 */
+	void ramp(float32_t *L, float32_t *R, uint16_t len, const float32_t *from, const float32_t *to);
+private:
+	const float32_t *coeffs = NULL;
+	uint8_t stages = 0;
+	float32_t state[4 * BIQUAD_STEREO_STAGES_MAX];		// per stage: d1 left, d1 right, d2 left, d2 right
+};
+
+#endif // _BIQUADSTEREO_F32_H_
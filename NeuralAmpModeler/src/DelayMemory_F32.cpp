@@ -0,0 +1,359 @@
+/**
+ * @file DelayMemory_F32.cpp
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Delay line memory with block access and DMA staging of the PSRAM
+ * @version 0.1
+ * @date 2024-03-21
+ */
+#include <new>
+#include "DelayMemory_F32.h"
+
+DelayMemory_F32::~DelayMemory_F32()
+{
+	end();
+}
+
+bool DelayMemory_F32::begin(uint8_t count, const uint32_t *sizes, bool psram)
+{
+	end();
+	if (!count || count > DELAY_MEM_LINES_MAX) return false;
+	uint32_t floats = 0;
+	for (uint8_t l = 0; l < count; l++) floats += sizes[l];
+	ext = psram;
+	bytes = floats * sizeof(float32_t);
+	mem = (float32_t *)(ext ? extmem_malloc(bytes) : malloc(bytes));
+	if (!mem)
+	{
+		bytes = 0;
+		return false;
+	}
+	lines = count;
+	float32_t *p = mem;
+	for (uint8_t l = 0; l < count; l++)
+	{
+		line[l].buf = p;
+		line[l].mask = sizes[l] - 1;
+		p += sizes[l];
+	}
+	memset(&stats, 0, sizeof(stats));
+	if (ext)
+	{
+		// staging buffers from malloc() in the RAM2 (OCRAM), cached:
+		// flush/delete around the transfers
+		dmaAlloc = malloc(sizeof(dma_t) + DELAY_MEM_CACHE_LINE);
+		if (dmaAlloc) dma = new ((void *)(((uintptr_t)dmaAlloc + DELAY_MEM_CACHE_LINE - 1) & ~(uintptr_t)(DELAY_MEM_CACHE_LINE - 1))) dma_t;
+		stageAlloc = malloc(DELAY_MEM_STAGE * sizeof(float32_t) + DELAY_MEM_CACHE_LINE);
+		wbuf = (float32_t *)malloc(DELAY_MEM_LINES_MAX * AUDIO_BLOCK_SAMPLES * sizeof(float32_t));
+		if (dma && stageAlloc && wbuf)
+		{
+			stage = (float32_t *)(((uintptr_t)stageAlloc + DELAY_MEM_CACHE_LINE - 1) & ~(uintptr_t)(DELAY_MEM_CACHE_LINE - 1));
+			dma->ch.begin();
+		}
+		else
+		{
+			if (dma) dma->~dma_t();
+			free(dmaAlloc);
+			free(stageAlloc);
+			free(wbuf);
+			dma = NULL;
+			dmaAlloc = NULL;
+			stageAlloc = NULL;
+			wbuf = NULL;
+		}
+	}
+	reset();
+	staging_set(stage != NULL);
+	return true;
+}
+
+void DelayMemory_F32::end()
+{
+	sync();
+	if (mem)
+	{
+		if (ext) extmem_free(mem);
+		else free(mem);
+	}
+	if (dma) dma->~dma_t();
+	free(dmaAlloc);
+	free(stageAlloc);
+	free(wbuf);
+	mem = NULL;
+	dma = NULL;
+	dmaAlloc = NULL;
+	stageAlloc = NULL;
+	stage = NULL;
+	wbuf = NULL;
+	bytes = 0;
+	lines = 0;
+	staged = false;
+}
+
+void DelayMemory_F32::reset()
+{
+	if (!mem) return;
+	sync();
+	memset(mem, 0, bytes);
+	if (staged) arm_dcache_flush_delete(mem, bytes);
+	spanCount = 0;
+	for (uint8_t l = 0; l < DELAY_MEM_LINES_MAX; l++) wlo[l] = whi[l] = 0;
+}
+
+void DelayMemory_F32::staging_set(bool state)
+{
+	state = state && stage;
+	if (state == staged) return;
+	sync();
+	// no dirty cache lines of the PSRAM left to overwrite the DMA transfers
+	if (state) arm_dcache_flush_delete(mem, bytes);
+	spanCount = 0;
+	for (uint8_t l = 0; l < DELAY_MEM_LINES_MAX; l++) wlo[l] = whi[l] = 0;
+	staged = state;
+}
+
+void DelayMemory_F32::ringRead(const float32_t *buf, uint32_t mask, uint32_t start, float32_t *dst, uint16_t len)
+{
+	const uint32_t i = start & mask, n = min((uint32_t)len, mask + 1 - i);
+	memcpy(dst, buf + i, n * sizeof(float32_t));
+	if (n < len) memcpy(dst + n, buf, (len - n) * sizeof(float32_t));
+}
+
+void DelayMemory_F32::ringWrite(float32_t *buf, uint32_t mask, uint32_t start, const float32_t *src, uint16_t len)
+{
+	const uint32_t i = start & mask, n = min((uint32_t)len, mask + 1 - i);
+	memcpy(buf + i, src, n * sizeof(float32_t));
+	if (n < len) memcpy(buf, src + n, (len - n) * sizeof(float32_t));
+}
+
+// cache lines of the PSRAM the CPU touches with a ring access
+void DelayMemory_F32::countLines(uint8_t l, uint32_t start, uint16_t len)
+{
+	if (!ext || !len) return;
+	const line_t &ln = line[l];
+	const uint32_t i = start & ln.mask, n = min((uint32_t)len, ln.mask + 1 - i);
+	uintptr_t a = (uintptr_t)(ln.buf + i);
+	stats.cpuLines += (a + n * sizeof(float32_t) - 1) / DELAY_MEM_CACHE_LINE - a / DELAY_MEM_CACHE_LINE + 1;
+	if (n < len)
+	{
+		a = (uintptr_t)ln.buf;
+		stats.cpuLines += (a + (len - n) * sizeof(float32_t) - 1) / DELAY_MEM_CACHE_LINE - a / DELAY_MEM_CACHE_LINE + 1;
+	}
+}
+
+void DelayMemory_F32::readDirect(uint8_t l, uint32_t start, float32_t *dst, uint16_t len)
+{
+	const line_t &ln = line[l];
+	if (staged)
+	{
+		// the DMA may have written the lines cached by an earlier miss
+		sync();
+		const uint32_t i = start & ln.mask, n = min((uint32_t)len, ln.mask + 1 - i);
+		arm_dcache_delete(ln.buf + i, n * sizeof(float32_t));
+		if (n < len) arm_dcache_delete(ln.buf, (len - n) * sizeof(float32_t));
+		stats.misses++;
+	}
+	ringRead(ln.buf, ln.mask, start, dst, len);
+	countLines(l, start, len);
+}
+
+void DelayMemory_F32::writeDirect(uint8_t l, uint32_t start, const float32_t *src, uint16_t len)
+{
+	const line_t &ln = line[l];
+	if (staged) sync();
+	ringWrite(ln.buf, ln.mask, start, src, len);
+	countLines(l, start, len);
+	if (staged)
+	{
+		const uint32_t i = start & ln.mask, n = min((uint32_t)len, ln.mask + 1 - i);
+		arm_dcache_flush_delete(ln.buf + i, n * sizeof(float32_t));
+		if (n < len) arm_dcache_flush_delete(ln.buf, (len - n) * sizeof(float32_t));
+		stats.misses++;
+	}
+}
+
+void DelayMemory_F32::block(uint32_t pos, uint16_t len)
+{
+	stats.blocks++;
+	if (!staged) return;
+	blockPos = pos;
+	blockLen = min(len, (uint16_t)AUDIO_BLOCK_SAMPLES);
+	spanCount = 0;
+	stageUsed = 0;
+	for (uint8_t l = 0; l < lines; l++) wlo[l] = whi[l] = 0;
+}
+
+void DelayMemory_F32::request(uint8_t l, uint32_t start, uint16_t len)
+{
+	if (!staged) return;
+	// only the samples written before the block
+	const int32_t rel = (int32_t)(start - blockPos);
+	if (rel >= 0) return;
+	len = min((uint32_t)len, min((uint32_t)-rel, line[l].mask + 1));
+	for (uint8_t s = 0; s < spanCount; s++)
+	{
+		const span_t &sp = spans[s];
+		if (sp.line == l && len <= sp.len && start - sp.start <= (uint32_t)(sp.len - len)) return;
+	}
+	// spans start on a cache line of the staging area
+	const uint32_t offset = (stageUsed + DELAY_MEM_CACHE_LINE / sizeof(float32_t) - 1) & ~(DELAY_MEM_CACHE_LINE / sizeof(float32_t) - 1);
+	if (spanCount >= DELAY_MEM_SPANS_MAX || offset + len > DELAY_MEM_STAGE) return;	// read() falls back to the CPU
+	span_t &sp = spans[spanCount++];
+	sp.line = l;
+	sp.start = start;
+	sp.len = len;
+	sp.offset = offset;
+	stageUsed = offset + len;
+}
+
+uint8_t DelayMemory_F32::addTransfer(uint8_t n, const float32_t *src, float32_t *dst, uint32_t floats)
+{
+	DMASetting &t = dma->tcd[n];
+	t.sourceBuffer((volatile const unsigned int *)src, floats * sizeof(float32_t));
+	t.destinationBuffer((volatile unsigned int *)dst, floats * sizeof(float32_t));
+	// the whole span in one minor loop: a START or a manual trigger runs one minor loop only
+	t.TCD->NBYTES = floats * sizeof(float32_t);
+	t.TCD->BITER = t.TCD->CITER = 1;
+	t.TCD->CSR = n ? DMA_TCD_CSR_START : 0;		// the chained ones start when loaded
+	if (n) dma->tcd[n - 1].replaceSettingsOnCompletion(t);
+	stats.dmaTransfers++;
+	stats.dmaBytes += floats * sizeof(float32_t);
+	return n + 1;
+}
+
+// a ring span is one or two transfers
+uint8_t DelayMemory_F32::addRing(uint8_t n, uint8_t l, uint32_t start, float32_t *ram, uint16_t len, bool toLine)
+{
+	const line_t &ln = line[l];
+	const uint32_t i = start & ln.mask, k = min((uint32_t)len, ln.mask + 1 - i);
+	n = toLine ? addTransfer(n, ram, ln.buf + i, k) : addTransfer(n, ln.buf + i, ram, k);
+	if (k < len) n = toLine ? addTransfer(n, ram + k, ln.buf, len - k) : addTransfer(n, ln.buf, ram + k, len - k);
+	return n;
+}
+
+void DelayMemory_F32::start(uint8_t n)
+{
+	if (!n) return;
+	dma->tcd[n - 1].disableOnCompletion();
+	dma->ch = dma->tcd[0];
+	tcdCount = n;
+	busy = true;
+	// the TCDs are in the cached OCRAM: the scatter/gather loads the TCDs 2..n
+	// from the memory, not through the cache, they have to be written back first
+	arm_dcache_flush(dma->tcd, n * sizeof(DMASetting));
+	dma->ch.triggerManual();
+}
+
+void DelayMemory_F32::fetch()
+{
+	if (!staged) return;
+	sync();		// the write back of the previous block
+	uint8_t n = 0;
+	for (uint8_t s = 0; s < spanCount; s++)
+		n = addRing(n, spans[s].line, spans[s].start, stage + spans[s].offset, spans[s].len, false);
+	fetching = n != 0;
+	start(n);
+}
+
+void DelayMemory_F32::read(uint8_t l, uint32_t start, float32_t *dst, uint16_t len)
+{
+	if (!staged)
+	{
+		readDirect(l, start, dst, len);
+		return;
+	}
+	sync();
+	const int32_t rel = (int32_t)(start - blockPos);
+	uint16_t old = rel >= 0 ? 0 : min((uint32_t)len, (uint32_t)-rel);
+	if (old)
+	{
+		uint8_t s = 0;
+		for (; s < spanCount; s++)
+		{
+			const span_t &sp = spans[s];
+			if (sp.line == l && old <= sp.len && start - sp.start <= (uint32_t)(sp.len - old)) break;
+		}
+		if (s < spanCount) memcpy(dst, stage + spans[s].offset + (start - spans[s].start), old * sizeof(float32_t));
+		else readDirect(l, start, dst, old);
+	}
+	// the samples written in the block, the rest is still in the PSRAM
+	for (uint16_t i = old; i < len;)
+	{
+		const uint32_t k = start + i - blockPos;
+		uint16_t n;
+		if (k >= wlo[l] && k < whi[l])
+		{
+			n = min((uint32_t)(len - i), whi[l] - k);
+			memcpy(dst + i, wbuf + l * AUDIO_BLOCK_SAMPLES + k, n * sizeof(float32_t));
+		}
+		else
+		{
+			n = k < wlo[l] ? min((uint32_t)(len - i), wlo[l] - k) : len - i;
+			readDirect(l, start + i, dst + i, n);
+		}
+		i += n;
+	}
+}
+
+void DelayMemory_F32::write(uint8_t l, uint32_t start, const float32_t *src, uint16_t len)
+{
+	if (!staged)
+	{
+		writeDirect(l, start, src, len);
+		return;
+	}
+	// writes of a line in a block are contiguous, inside the block
+	const uint32_t k = start - blockPos;
+	const bool empty = wlo[l] == whi[l];
+	if (k + len > blockLen || (!empty && (k > whi[l] || k + len < wlo[l])))
+	{
+		writeDirect(l, start, src, len);
+		return;
+	}
+	memcpy(wbuf + l * AUDIO_BLOCK_SAMPLES + k, src, len * sizeof(float32_t));
+	wlo[l] = empty ? k : min((uint32_t)wlo[l], k);
+	whi[l] = empty ? k + len : max((uint32_t)whi[l], k + len);
+}
+
+void DelayMemory_F32::commit()
+{
+	if (!staged) return;
+	sync();
+	arm_dcache_flush(wbuf, lines * AUDIO_BLOCK_SAMPLES * sizeof(float32_t));
+	uint8_t n = 0;
+	for (uint8_t l = 0; l < lines; l++)
+	{
+		if (wlo[l] < whi[l]) n = addRing(n, l, blockPos + wlo[l], wbuf + l * AUDIO_BLOCK_SAMPLES + wlo[l], whi[l] - wlo[l], true);
+	}
+	start(n);
+}
+
+void DelayMemory_F32::sync()
+{
+	if (!busy) return;
+	const uint32_t t0 = ARM_DWT_CYCCNT, timeout = DELAY_MEM_DMA_TIMEOUT_US * (F_CPU_ACTUAL / 1000000);
+	while (!dma->ch.complete())
+	{
+		if (ARM_DWT_CYCCNT - t0 < timeout) continue;
+		// stopped chain: the CPU copies all its transfers again, the sources are unchanged
+		dma->ch.disable();
+		for (uint8_t i = 0; i < tcdCount; i++)
+		{
+			const DMABaseClass::TCD_t *t = dma->tcd[i].TCD;
+			const uint32_t n = t->NBYTES;
+			arm_dcache_flush_delete((void *)t->SADDR, n);
+			memcpy((void *)t->DADDR, (const void *)t->SADDR, n);
+			arm_dcache_flush_delete((void *)t->DADDR, n);
+			stats.cpuLines += (n + DELAY_MEM_CACHE_LINE - 1) / DELAY_MEM_CACHE_LINE;
+		}
+		stats.dmaTimeouts++;
+		break;
+	}
+	dma->ch.clearComplete();
+	busy = false;
+	if (fetching)
+	{
+		// drop the stale lines, incl. the ones prefetched during the transfer
+		arm_dcache_delete(stage, ((stageUsed * sizeof(float32_t)) + DELAY_MEM_CACHE_LINE - 1) & ~(DELAY_MEM_CACHE_LINE - 1));
+		fetching = false;
+	}
+}
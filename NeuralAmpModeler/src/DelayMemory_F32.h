@@ -0,0 +1,163 @@
+/**
+ * @file DelayMemory_F32.h
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Delay line memory with block access, in the RAM or in the PSRAM.
+ * 		Reading taps from the PSRAM sample by sample costs a cache line
+ * 		fill over the FlexSPI bus for every few samples and evicts the
+ * 		audio buffers from the cache. With the staging on, the CPU does
+ * 		not touch the PSRAM at all:
+ * 		- block() starts a block, request() lists the spans of the lines
+ * 		  the block will read (all known at the block start: fixed taps
+ * 		  and the range of the modulated ones),
+ * 		- fetch() copies the spans to a staging area in the on-chip RAM
+ * 		  with one DMA scatter/gather chain, the CPU can do other work
+ * 		  (ie. the input filters) meanwhile,
+ * 		- read() takes the samples from the staging area, the samples
+ * 		  written in the same block from the write buffers,
+ * 		- write() goes to a write buffer per line, commit() copies the
+ * 		  written spans to the PSRAM by DMA, running in the background
+ * 		  until the next fetch().
+ * 		A read outside the requested spans falls back to a CPU access
+ * 		and counts as a miss. A DMA chain not done within
+ * 		DELAY_MEM_DMA_TIMEOUT_US is stopped and copied by the CPU.
+ * 		The statistics count the cache lines the
+ * 		CPU reads/writes in the PSRAM and the DMA transfers, the host
+ * 		simulator uses them to compare the access patterns.
+ * 		The lines have power of 2 sizes, the write position is common.
+ * @version 0.1
+ * @date 2024-03-21
+ */
+#ifndef _DELAYMEMORY_F32_H_
+#define _DELAYMEMORY_F32_H_
+
+#include <Arduino.h>
+#include <DMAChannel.h>
+#include "AudioStream_F32.h"
+#include "arm_math.h"
+
+#define DELAY_MEM_LINES_MAX		(8)
+#define DELAY_MEM_SPANS_MAX		(32)			// requested spans per block
+#define DELAY_MEM_STAGE			(4096)			// staging area, floats
+#define DELAY_MEM_CACHE_LINE	(32)			// bytes
+#define DELAY_MEM_TCDS			(2 * (DELAY_MEM_SPANS_MAX + DELAY_MEM_LINES_MAX))	// a span can wrap
+#define DELAY_MEM_DMA_TIMEOUT_US	(1000)		// longest wait for a DMA chain in sync()
+
+class DelayMemory_F32
+{
+public:
+	typedef struct
+	{
+		uint32_t blocks;
+		uint32_t cpuLines;			// cache lines the CPU read or wrote in the PSRAM
+		uint32_t dmaTransfers;
+		uint32_t dmaBytes;
+		uint32_t misses;			// accesses outside the staged spans
+		uint32_t dmaTimeouts;		// chains copied by the CPU after the timeout
+	} stats_t;
+	~DelayMemory_F32();
+	/**
+	 * @brief Allocate the lines
+	 *
+	 * @param sizes in floats, powers of 2
+	 * @param psram lines in the PSRAM, the staging is on if it can be allocated
+	 * @return false if out of memory
+	 */
+	bool begin(uint8_t count, const uint32_t *sizes, bool psram);
+	void end();
+	/**
+	 * @brief Clear the lines
+	 */
+	void reset();
+	/**
+	 * @brief DMA staging of the PSRAM lines on/off, false: the CPU
+	 * 			accesses the PSRAM through the cache
+	 */
+	void staging_set(bool state);
+	bool staging_get() {return staged;}
+	bool isPSRAM() {return ext;}
+	uint32_t getBytes() {return bytes;}
+	/**
+	 * @brief Direct access for the sample by sample processing, only with
+	 * 			the staging off
+	 */
+	float32_t *getLine(uint8_t l) {return line[l].buf;}
+	uint32_t getMask(uint8_t l) {return line[l].mask;}
+	/**
+	 * @brief Start of a block, pos: write position of its first sample
+	 */
+	void block(uint32_t pos, uint16_t len);
+	/**
+	 * @brief Span read in this block, start: position of the first sample,
+	 * 			the part written in the block is not fetched
+	 */
+	void request(uint8_t l, uint32_t start, uint16_t len);
+	/**
+	 * @brief Start the DMA of the requested spans
+	 */
+	void fetch();
+	void read(uint8_t l, uint32_t start, float32_t *dst, uint16_t len);
+	void write(uint8_t l, uint32_t start, const float32_t *src, uint16_t len);
+	/**
+	 * @brief Start the DMA of the samples written in the block
+	 */
+	void commit();
+	/**
+	 * @brief Wait for the running DMA, at most DELAY_MEM_DMA_TIMEOUT_US
+	 */
+	void sync();
+	const stats_t &getStats() {return stats;}
+	void resetStats() {memset(&stats, 0, sizeof(stats));}
+	/**
+	 * @brief Ring buffer copies, len <= mask + 1
+	 */
+	static void ringRead(const float32_t *buf, uint32_t mask, uint32_t start, float32_t *dst, uint16_t len);
+	static void ringWrite(float32_t *buf, uint32_t mask, uint32_t start, const float32_t *src, uint16_t len);
+private:
+	typedef struct
+	{
+		float32_t *buf;
+		uint32_t mask;
+	} line_t;
+	typedef struct
+	{
+		uint8_t line;
+		uint16_t len;
+		uint32_t start;
+		uint32_t offset;			// in the staging area
+	} span_t;
+	typedef struct
+	{
+		DMAChannel ch;
+		DMASetting tcd[DELAY_MEM_TCDS];
+	} dma_t;
+	line_t line[DELAY_MEM_LINES_MAX];
+	uint8_t lines = 0;
+	float32_t *mem = NULL;
+	uint32_t bytes = 0;
+	bool ext = false;
+	bool staged = false;
+	// staging, allocated for the PSRAM only
+	dma_t *dma = NULL;						// TCDs 32 byte aligned for the scatter/gather
+	void *dmaAlloc = NULL;
+	void *stageAlloc = NULL;
+	float32_t *stage = NULL;				// fetched spans, cache line aligned
+	float32_t *wbuf = NULL;					// writes of the block, AUDIO_BLOCK_SAMPLES per line
+	span_t spans[DELAY_MEM_SPANS_MAX];
+	uint8_t spanCount = 0;
+	uint32_t stageUsed = 0;
+	uint16_t wlo[DELAY_MEM_LINES_MAX], whi[DELAY_MEM_LINES_MAX];	// written range per line
+	uint32_t blockPos = 0;
+	uint16_t blockLen = 0;
+	bool busy = false;						// DMA chain running
+	bool fetching = false;
+	stats_t stats;
+	void countLines(uint8_t l, uint32_t start, uint16_t len);
+	void readDirect(uint8_t l, uint32_t start, float32_t *dst, uint16_t len);
+	void writeDirect(uint8_t l, uint32_t start, const float32_t *src, uint16_t len);
+	uint8_t addTransfer(uint8_t n, const float32_t *src, float32_t *dst, uint32_t floats);
+	uint8_t addRing(uint8_t n, uint8_t l, uint32_t start, float32_t *ram, uint16_t len, bool toLine);
+	void start(uint8_t n);
+	uint8_t tcdCount = 0;					// TCDs of the running chain
+};
+
+#endif // _DELAYMEMORY_F32_H_
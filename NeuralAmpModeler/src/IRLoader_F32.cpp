@@ -0,0 +1,499 @@
+/**
+ * @file IRLoader_F32.cpp
+ * @author Piotr Zapart www.hexefx.com
+ * @brief User impulse responses from WAV files with a spectrum cache
+ * @version 0.1
+ * @date 2024-03-15
+ */
+#include "IRLoader_F32.h"
+
+#define IR_CACHE_VERSION	(3)
+#define IR_MINPHASE_DONE	(1)			// cache key minPhase
+#define IR_MINPHASE_SKIPPED	(2)			// requested, the IR too long
+#define IR_CRC_BYTES		(1024)
+#define IR_READ_FRAMES		(256)
+
+static uint32_t crc32(uint32_t crc, const uint8_t *data, uint32_t len)
+{
+	crc = ~crc;
+	while (len--)
+	{
+		crc ^= *data++;
+		for (uint8_t b = 0; b < 8; b++) crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+	}
+	return ~crc;
+}
+
+static float32_t besselI0(float32_t x)
+{
+	float32_t sum = 1.0f, term = 1.0f;
+	for (int32_t k = 1; k < 32; k++)
+	{
+		term *= (x / (2.0f * k)) * (x / (2.0f * k));
+		sum += term;
+	}
+	return sum;
+}
+
+static uint32_t readLE(const uint8_t *p, uint8_t bytes)
+{
+	uint32_t v = 0;
+	for (uint8_t i = 0; i < bytes; i++) v |= (uint32_t)p[i] << (8 * i);
+	return v;
+}
+
+bool IRLoader_F32::wavHeader(File &f, wav_t &w, float32_t &rate)
+{
+	uint8_t hdr[12];
+	if (f.read(hdr, 12) != 12 || memcmp(hdr, "RIFF", 4) || memcmp(hdr + 8, "WAVE", 4)) return false;
+	uint16_t format = 0, channels = 0, bits = 0;
+	uint32_t dataBytes = 0;
+	rate = 0.0f;
+	// chunks: fmt first, stop at data
+	while (true)
+	{
+		uint8_t ch[8];
+		if (f.read(ch, 8) != 8) return false;
+		const uint32_t size = readLE(ch + 4, 4);
+		if (!memcmp(ch, "fmt ", 4))
+		{
+			uint8_t fmt[40];
+			const uint32_t n = min(size, (uint32_t)sizeof(fmt));
+			if (n < 16 || f.read(fmt, n) != n) return false;
+			format = readLE(fmt, 2);
+			channels = readLE(fmt + 2, 2);
+			rate = (float32_t)readLE(fmt + 4, 4);
+			bits = readLE(fmt + 14, 2);
+			if (format == 0xFFFE && n >= 26) format = readLE(fmt + 24, 2);	// WAVE_FORMAT_EXTENSIBLE subformat
+			if (!f.seek(size - n + (size & 1), SeekCur)) return false;
+		}
+		else if (!memcmp(ch, "data", 4))
+		{
+			dataBytes = size;
+			break;
+		}
+		else if (!f.seek(size + (size & 1), SeekCur)) return false;
+	}
+	const bool pcm = format == 1 && (bits == 16 || bits == 24 || bits == 32);
+	w.flt = format == 3 && bits == 32;
+	if ((!pcm && !w.flt) || !channels || rate <= 0.0f) return false;
+	w.bits = bits;
+	w.frameBytes = channels * bits / 8;
+	w.frames = min(dataBytes / w.frameBytes, (uint32_t)(IR_LOADER_MAX_SECONDS * rate));
+	return w.frames != 0;
+}
+
+// first channel of the next frames, returns the number read
+uint32_t IRLoader_F32::wavRead(File &f, const wav_t &w, float32_t *data, uint32_t frames)
+{
+	uint8_t *buf = (uint8_t *)malloc(IR_READ_FRAMES * w.frameBytes);
+	if (!buf) return 0;
+	const uint8_t bytes = w.bits / 8;
+	const float32_t scale = 1.0f / (float32_t)(1u << (w.bits - 1));
+	uint32_t pos = 0;
+	while (pos < frames)
+	{
+		const uint32_t n = min(frames - pos, (uint32_t)IR_READ_FRAMES);
+		if (f.read(buf, n * w.frameBytes) != n * w.frameBytes) break;
+		for (uint32_t i = 0; i < n; i++)
+		{
+			const uint8_t *s = buf + i * w.frameBytes;
+			float32_t v;
+			if (w.flt) memcpy(&v, s, 4);
+			else v = (float32_t)((int32_t)(readLE(s, bytes) << (32 - w.bits)) >> (32 - w.bits)) * scale;
+			data[pos + i] = v;
+		}
+		pos += n;
+	}
+	::free(buf);
+	return pos;
+}
+
+bool IRLoader_F32::resampleBegin(resampler_t &r, uint32_t inLen, float32_t inRate, float32_t outRate)
+{
+	r.ratio = inRate / outRate;
+	r.fc = min(1.0f, outRate / inRate);
+	r.halfWidth = IR_LOADER_SINC_ZC / r.fc;
+	r.inLen = inLen;
+	r.outLen = (uint32_t)((inLen - 1) / r.ratio) + 1;
+	const uint32_t tableLen = IR_LOADER_SINC_ZC * IR_LOADER_SINC_STEPS + 2;
+	r.table = (float32_t *)malloc(tableLen * sizeof(float32_t));
+	if (!r.table) return false;
+	// kernel sinc(u) * kaiser(u / ZC), u = 0..ZC
+	const float32_t beta = 8.0f;
+	for (uint32_t i = 0; i < tableLen; i++)
+	{
+		const float32_t u = (float32_t)i / IR_LOADER_SINC_STEPS;
+		const float32_t x = u / IR_LOADER_SINC_ZC;
+		const float32_t w = x < 1.0f ? besselI0(beta * sqrtf(1.0f - x * x)) / besselI0(beta) : 0.0f;
+		r.table[i] = (i ? sinf(PI * u) / (PI * u) : 1.0f) * w;
+	}
+	return true;
+}
+
+// output samples n0 .. n1 - 1
+void IRLoader_F32::resampleRun(const resampler_t &r, const float32_t *in, float32_t *out, uint32_t n0, uint32_t n1)
+{
+	const uint32_t tableLen = IR_LOADER_SINC_ZC * IR_LOADER_SINC_STEPS + 2;
+	for (uint32_t n = n0; n < n1; n++)
+	{
+		const float32_t t = n * r.ratio;
+		const int32_t k0 = max((int32_t)ceilf(t - r.halfWidth), (int32_t)0);
+		const int32_t k1 = min((int32_t)floorf(t + r.halfWidth), (int32_t)r.inLen - 1);
+		float32_t acc = 0.0f;
+		for (int32_t k = k0; k <= k1; k++)
+		{
+			const float32_t u = fabsf(t - k) * r.fc * IR_LOADER_SINC_STEPS;
+			const uint32_t i = (uint32_t)u;
+			if (i >= tableLen - 1) continue;
+			const float32_t frac = u - i;
+			acc += in[k] * (r.table[i] + frac * (r.table[i + 1] - r.table[i]));
+		}
+		out[n] = acc * r.fc;
+	}
+}
+
+void IRLoader_F32::resampleEnd(resampler_t &r)
+{
+	if (r.table) ::free(r.table);
+	r.table = NULL;
+}
+
+float32_t *IRLoader_F32::resample(const float32_t *in, uint32_t inLen, float32_t inRate, float32_t outRate, uint32_t &outLen)
+{
+	resampler_t r;
+	if (!resampleBegin(r, inLen, inRate, outRate))
+	{
+		resampleEnd(r);
+		return NULL;
+	}
+	outLen = r.outLen;
+	float32_t *out = (float32_t *)extmem_malloc(outLen * sizeof(float32_t));
+	if (out) resampleRun(r, in, out, 0, outLen);
+	resampleEnd(r);
+	return out;
+}
+
+// trimming and normalization at the audio rate, returns the new length
+uint32_t IRLoader_F32::trim(float32_t *data, uint32_t n, const options_t &opt)
+{
+	if (opt.leadDb < 0.0f) n = IRTrim_F32::leading(data, n, opt.leadDb);
+	minPhaseDone = false;
+	if (opt.minPhase)
+	{
+		// the cepstrum FFT size is limited, the tail below the threshold goes first
+		if (n > IR_TRIM_MINPHASE_FFT / 2 && opt.tailDb < 0.0f) n = IRTrim_F32::tail(data, n, opt.tailDb);
+		minPhaseDone = IRTrim_F32::minimumPhase(data, n);
+	}
+	if (opt.tailDb < 0.0f) n = IRTrim_F32::tail(data, n, opt.tailDb);
+	if (opt.maxMs > 0.0f)
+	{
+		const uint32_t maxLen = max((uint32_t)(opt.maxMs * 0.001f * AUDIO_SAMPLE_RATE_EXACT), (uint32_t)1);
+		if (n > maxLen)
+		{
+			n = maxLen;
+			IRTrim_F32::fadeOut(data, n);
+		}
+	}
+	float32_t gain = opt.level;
+	if (opt.normalize != NORM_NONE)
+	{
+		float32_t ref = 0.0f;
+		for (uint32_t i = 0; i < n; i++)
+		{
+			if (opt.normalize == NORM_PEAK) ref = max(ref, fabsf(data[i]));
+			else ref += data[i] * data[i];
+		}
+		if (opt.normalize == NORM_ENERGY) ref = sqrtf(ref);
+		if (ref > 0.0f) gain /= ref;
+	}
+	for (uint32_t i = 0; i < n; i++) data[i] *= gain;
+	return n;
+}
+
+bool IRLoader_F32::readSamples(const char *path, const options_t &opt, float32_t *&ir, uint32_t &len)
+{
+	File f = fs.open(path);
+	ir = NULL;
+	if (!f) return false;
+	wav_t w;
+	float32_t *data = NULL;
+	uint32_t n = 0;
+	if (wavHeader(f, w, fileRate) && (data = (float32_t *)extmem_malloc(w.frames * sizeof(float32_t))))
+		n = wavRead(f, w, data, w.frames);
+	f.close();
+	if (!n)
+	{
+		if (data) extmem_free(data);
+		return false;
+	}
+	if (fabsf(fileRate / AUDIO_SAMPLE_RATE_EXACT - 1.0f) > IR_LOADER_RATE_TOLERANCE)
+	{
+		float32_t *res = resample(data, n, fileRate, AUDIO_SAMPLE_RATE_EXACT, n);
+		extmem_free(data);
+		if (!res) return false;
+		data = res;
+	}
+	lengthIn = n;
+	len = trim(data, n, opt);
+	ir = data;
+	return true;
+}
+
+void IRLoader_F32::cachePath(const char *path, char *out, size_t len)
+{
+	snprintf(out, len, "%s", path);
+	char *dot = strrchr(out, '.');
+	char *slash = strrchr(out, '/');
+	if (!dot || (slash && dot < slash)) dot = out + strlen(out);
+	snprintf(dot, len - (dot - out), ".irc");
+}
+
+bool IRLoader_F32::makeKey(const char *path, const options_t &opt, uint16_t partMax, cache_key_t &key)
+{
+	memset(&key, 0, sizeof(key));
+	File f = fs.open(path);
+	if (!f) return false;
+	uint8_t buf[IR_CRC_BYTES];
+	const uint32_t n = f.read(buf, sizeof(buf));
+	key.srcSize = (uint32_t)f.size();
+	key.srcCrc = crc32(0, buf, n);
+	f.close();
+	key.sampleRate = AUDIO_SAMPLE_RATE_EXACT;
+	key.leadDb = opt.leadDb;
+	key.tailDb = opt.tailDb;
+	key.maxMs = opt.maxMs;
+	key.level = opt.level;
+	key.normalize = opt.normalize;
+	key.minPhase = opt.minPhase ? IR_MINPHASE_DONE : 0;
+	key.blockSamples = AUDIO_BLOCK_SAMPLES;
+	key.partMax = partMax;
+	return true;
+}
+
+bool IRLoader_F32::readCache(const char *path, const cache_key_t &key, IRPartitions_F32 &parts)
+{
+	File f = fs.open(path);
+	if (!f) return false;
+	cache_header_t hdr;
+	if (f.read(&hdr, sizeof(hdr)) != sizeof(hdr) || memcmp(hdr.magic, "HXIR", 4) || hdr.version != IR_CACHE_VERSION)
+		return false;
+	// the same request, the conversion is known not to fit
+	cache_key_t k = hdr.key;
+	if (key.minPhase == IR_MINPHASE_DONE && k.minPhase == IR_MINPHASE_SKIPPED) k.minPhase = IR_MINPHASE_DONE;
+	if (memcmp(&k, &key, sizeof(key))) return false;
+	if (!parts.setup(hdr.length, key.partMax) || parts.getLevels() != hdr.levels) return false;
+	lengthIn = hdr.lengthIn;
+	minPhaseDone = hdr.key.minPhase == IR_MINPHASE_DONE;
+	for (uint8_t l = 0; l < parts.getLevels(); l++)
+	{
+		const IRPartitions_F32::level_t &lv = parts.getLevel(l);
+		const uint32_t bytes = lv.count * 2 * lv.size * sizeof(float32_t);
+		if (f.read(lv.spectra, bytes) != bytes)
+		{
+			parts.free();
+			return false;
+		}
+	}
+	return true;
+}
+
+bool IRLoader_F32::writeCache(const char *path, const cache_key_t &key, IRPartitions_F32 &parts)
+{
+	if (fs.exists(path)) fs.remove(path);
+	File f = fs.open(path, FILE_WRITE);
+	if (!f) return false;
+	cache_header_t hdr;
+	memset(&hdr, 0, sizeof(hdr));
+	memcpy(hdr.magic, "HXIR", 4);
+	hdr.version = IR_CACHE_VERSION;
+	hdr.levels = parts.getLevels();
+	hdr.length = parts.getLength();
+	hdr.lengthIn = lengthIn;
+	hdr.key = key;
+	bool ok = f.write(&hdr, sizeof(hdr)) == sizeof(hdr);
+	for (uint8_t l = 0; ok && l < parts.getLevels(); l++)
+	{
+		const IRPartitions_F32::level_t &lv = parts.getLevel(l);
+		const uint32_t bytes = lv.count * 2 * lv.size * sizeof(float32_t);
+		ok = f.write(lv.spectra, bytes) == bytes;
+	}
+	f.close();
+	// no partial cache files
+	if (!ok) fs.remove(path);
+	return ok;
+}
+
+IRLoader_F32::~IRLoader_F32()
+{
+	if (ir) extmem_free(ir);
+	if (raw) extmem_free(raw);
+	resampleEnd(rs);
+}
+
+bool IRLoader_F32::load(const char *path, IRPartitions_F32 &parts, const options_t &opt, uint16_t partMax)
+{
+	start(path, parts, opt, partMax);
+	while (step() != TASK_DONE);
+	return ok;
+}
+
+void IRLoader_F32::start(const char *path, IRPartitions_F32 &parts, const options_t &opt, uint16_t partMax)
+{
+	if (wav) wav.close();
+	if (ir) extmem_free(ir);
+	if (raw) extmem_free(raw);
+	ir = raw = NULL;
+	resampleEnd(rs);
+	strncpy(this->path, path, sizeof(this->path) - 1);
+	this->path[sizeof(this->path) - 1] = 0;
+	this->parts = &parts;
+	this->opt = opt;
+	this->partMax = partMax;
+	source = SRC_NONE;
+	cycles = 0;
+	ok = false;
+	minPhaseDone = false;
+	parts.free();
+	ldState = LD_OPEN;
+}
+
+AudioTask_F32::state_t IRLoader_F32::step()
+{
+	const uint32_t t0 = ARM_DWT_CYCCNT;
+	const state_t s = stepLoad();
+	cycles += ARM_DWT_CYCCNT - t0;
+	if (s == TASK_DONE) loadTime = (float32_t)cycles * (1000.0f / F_CPU_ACTUAL);
+	return s;
+}
+
+AudioTask_F32::state_t IRLoader_F32::stepLoad()
+{
+	switch (ldState)
+	{
+		case LD_IDLE:
+			return TASK_DONE;
+		case LD_OPEN:
+			if (!makeKey(path, opt, partMax, key)) return finish(false);
+			cachePath(path, cache, sizeof(cache));
+			if (opt.cache && readCache(cache, key, *parts))
+			{
+				source = SRC_CACHE;
+				return finish(true);
+			}
+			ldState = LD_HEADER;
+			return TASK_CONTINUE;
+		case LD_HEADER:
+			wav = fs.open(path);
+			if (!wav || !wavHeader(wav, wavFmt, fileRate)) return finish(false);
+			raw = (float32_t *)extmem_malloc(wavFmt.frames * sizeof(float32_t));
+			if (!raw) return finish(false);
+			pos = 0;
+			ldState = LD_READ;
+			return TASK_CONTINUE;
+		case LD_READ:
+		{
+			const uint32_t n = min(wavFmt.frames - pos, (uint32_t)IR_LOADER_READ_CHUNK);
+			const uint32_t got = wavRead(wav, wavFmt, raw + pos, n);
+			pos += got;
+			if (got == n && pos < wavFmt.frames) return TASK_CONTINUE;
+			wav.close();
+			if (!pos) return finish(false);
+			if (fabsf(fileRate / AUDIO_SAMPLE_RATE_EXACT - 1.0f) <= IR_LOADER_RATE_TOLERANCE)
+			{
+				ir = raw;
+				irLen = pos;
+				raw = NULL;
+				ldState = LD_TRIM;
+				return TASK_CONTINUE;
+			}
+			if (!resampleBegin(rs, pos, fileRate, AUDIO_SAMPLE_RATE_EXACT)) return finish(false);
+			irLen = rs.outLen;
+			ir = (float32_t *)extmem_malloc(irLen * sizeof(float32_t));
+			if (!ir) return finish(false);
+			pos = 0;
+			ldState = LD_RESAMPLE;
+			return TASK_CONTINUE;
+		}
+		case LD_RESAMPLE:
+		{
+			const uint32_t n = min(irLen - pos, (uint32_t)IR_LOADER_RESAMPLE_CHUNK);
+			resampleRun(rs, raw, ir, pos, pos + n);
+			pos += n;
+			if (pos < irLen) return TASK_CONTINUE;
+			resampleEnd(rs);
+			extmem_free(raw);
+			raw = NULL;
+			ldState = LD_TRIM;
+			return TASK_CONTINUE;
+		}
+		case LD_TRIM:
+			lengthIn = irLen;
+			irLen = trim(ir, irLen, opt);
+			if (!parts->setup(irLen, partMax)) return finish(false);
+			part = 0;
+			ldState = LD_TRANSFORM;
+			return TASK_CONTINUE;
+		case LD_TRANSFORM:
+			parts->transform(ir, part++);
+			if (part < parts->getPartitions()) return TASK_CONTINUE;
+			extmem_free(ir);
+			ir = NULL;
+			source = SRC_WAV;
+			if (!opt.cache) return finish(true);
+			ldState = LD_CACHE;
+			return TASK_CONTINUE;
+		case LD_CACHE:
+		{
+			// the key records what was applied
+			cache_key_t k = key;
+			if (k.minPhase && !minPhaseDone) k.minPhase = IR_MINPHASE_SKIPPED;
+			writeCache(cache, k, *parts);
+			return finish(true);
+		}
+	}
+	return TASK_DONE;
+}
+
+IRLoader_F32::state_t IRLoader_F32::finish(bool result)
+{
+	if (wav) wav.close();
+	if (ir) extmem_free(ir);
+	if (raw) extmem_free(raw);
+	ir = raw = NULL;
+	resampleEnd(rs);
+	if (!result)
+	{
+		parts->free();
+		source = SRC_NONE;
+	}
+	ok = result;
+	lengthOut = parts->getLength();
+	ldState = LD_IDLE;
+	return TASK_DONE;
+}
+
+uint16_t IRLoader_F32::scan(const char *dir, char names[][IR_LOADER_NAME_MAX], uint16_t maxCount)
+{
+	File d = fs.open(dir);
+	uint16_t count = 0;
+	if (!d || !d.isDirectory()) return 0;
+	while (count < maxCount)
+	{
+		File f = d.openNextFile();
+		if (!f) break;
+		char name[IR_LOADER_NAME_MAX];
+		const size_t n = strlen(f.name());
+		const bool wav = n > 4 && n < IR_LOADER_NAME_MAX && !f.isDirectory() &&
+						 (!strcmp(f.name() + n - 4, ".wav") || !strcmp(f.name() + n - 4, ".WAV"));
+		if (wav) strcpy(name, f.name());
+		f.close();
+		if (!wav) continue;
+		// insertion sort
+		uint16_t i = count++;
+		for (; i > 0 && strcmp(names[i - 1], name) > 0; i--) memcpy(names[i], names[i - 1], IR_LOADER_NAME_MAX);
+		strcpy(names[i], name);
+	}
+	d.close();
+	return count;
+}
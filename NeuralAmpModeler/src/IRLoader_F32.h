@@ -0,0 +1,237 @@
+/**
+ * @file IRLoader_F32.h
+ * @author Piotr Zapart www.hexefx.com
+ * @brief User impulse responses from WAV files on the SD card or
+ * 		LittleFS (a directory in the host simulator) for
+ * 		AudioFilterIRConvolver_F32.
+ * 		The IR is read from the first channel of a 16/24/32bit PCM or
+ * 		32bit float WAV file, resampled to the audio sample rate with
+ * 		a Kaiser windowed sinc interpolator, optionally shortened
+ * 		(leading silence, minimum phase, tail below an energy threshold,
+ * 		see IRTrim_F32, and a maximum length) and normalized. The spectra
+ * 		of the partitions are then written to a cache file next to the
+ * 		WAV file (name.wav -> name.irc). The next load of the same IR
+ * 		with the same settings reads the spectra straight from the cache
+ * 		file, no WAV decoding, resampling or FFT. The cache is rebuilt
+ * 		if the WAV file (size, start of the data), the options, the
+ * 		sample rate, the block size or the partition layout change.
+ * 		The samples and the spectra are allocated in the PSRAM.
+ *
+ * 		Call from loop() or a background task, not from the audio update.
+ * 		The loader is also an AudioTask_F32: start() a load and post the
+ * 		loader to the task scheduler. The steps read the cache file, or
+ * 		decode the WAV file and resample it in chunks of
+ * 		IR_LOADER_READ_CHUNK/IR_LOADER_RESAMPLE_CHUNK samples, trim it and
+ * 		transform one partition each, so a new IR is prepared while the
+ * 		current one keeps playing, then
+ * 		AudioFilterIRConvolver_F32::crossfade() switches to it.
+ * @version 0.1
+ * @date 2024-03-15
+ */
+#ifndef _IRLOADER_F32_H_
+#define _IRLOADER_F32_H_
+
+#include <Arduino.h>
+#include <FS.h>
+#include "AudioStream_F32.h"
+#include "arm_math.h"
+#include "AudioFilterIRConvolver_F32.h"
+#include "IRTrim_F32.h"
+#include "AudioTasks_F32.h"
+
+#define IR_LOADER_MAX_SECONDS		(4.0f)		// longer WAV files are cut
+#define IR_LOADER_NAME_MAX			(64)		// file name length in scan()
+#define IR_LOADER_RATE_TOLERANCE	(0.001f)	// files closer to the audio rate are used as they are
+#define IR_LOADER_SINC_ZC			(16)		// resampler kernel half width in zero crossings
+#define IR_LOADER_SINC_STEPS		(64)		// kernel table steps per zero crossing
+#define IR_LOADER_READ_CHUNK		(2048)		// WAV frames decoded per task step
+#define IR_LOADER_RESAMPLE_CHUNK	(1024)		// output samples resampled per task step
+
+class IRLoader_F32 : public AudioTask_F32
+{
+public:
+	typedef enum
+	{
+		NORM_NONE,			// level is a plain gain
+		NORM_PEAK,			// peak sample = level
+		NORM_ENERGY			// IR energy = level^2: the same loudness for all IRs with a broadband input
+	} normalize_t;
+	typedef struct
+	{
+		float32_t leadDb = 0.0f;			// remove the leading silence below this level re peak, 0 = off
+		bool minPhase = false;				// convert to minimum phase (cabinet IRs), see getMinPhase()
+		float32_t tailDb = 0.0f;			// cut the tail below this remaining energy, 0 = off
+		float32_t maxMs = 0.0f;				// trim to this length, 0 = whole file
+		normalize_t normalize = NORM_ENERGY;
+		float32_t level = 1.0f;
+		bool cache = true;					// read/write the spectrum cache file
+	} options_t;
+	typedef enum
+	{
+		SRC_NONE,
+		SRC_WAV,			// decoded and transformed, cache written
+		SRC_CACHE			// spectra read from the cache file
+	} source_t;
+
+	IRLoader_F32(FS &fs) : fs(fs) {}
+	~IRLoader_F32();
+	/**
+	 * @brief Load an IR into the spectra for the convolver,
+	 * 			then switch the convolver to it with conv.load(parts)
+	 *
+	 * @param path WAV file
+	 * @param parts destination, previous content is freed
+	 * @param partMax largest partition, see IRPartitions_F32::setup()
+	 * @return false if the file can't be read or out of memory
+	 */
+	bool load(const char *path, IRPartitions_F32 &parts, const options_t &opt, uint16_t partMax = IR_CONV_PART_MAX);
+	bool load(const char *path, IRPartitions_F32 &parts) {return load(path, parts, options_t());}
+	/**
+	 * @brief Start a background load, then post the loader to the task
+	 * 			scheduler. parts must not be used until the task is done,
+	 * 			isOk() gives the result. Don't start a new load while the
+	 * 			loader is queued.
+	 */
+	void start(const char *path, IRPartitions_F32 &parts, const options_t &opt, uint16_t partMax = IR_CONV_PART_MAX);
+	state_t step() override;
+	bool isOk() {return ok;}
+	/**
+	 * @brief Read and prepare the samples of a WAV file without the FFTs:
+	 * 			resampled, trimmed and normalized
+	 *
+	 * @param ir allocated with extmem_malloc(), free with extmem_free()
+	 * @return false if the file can't be read or out of memory
+	 */
+	bool readSamples(const char *path, const options_t &opt, float32_t *&ir, uint32_t &len);
+	/**
+	 * @brief Find the WAV files in a directory, sorted by name
+	 *
+	 * @param names file names without the directory
+	 * @return number of files found, max maxCount
+	 */
+	uint16_t scan(const char *dir, char names[][IR_LOADER_NAME_MAX], uint16_t maxCount);
+	/**
+	 * @brief Cache file name for a WAV file
+	 */
+	static void cachePath(const char *path, char *out, size_t len);
+	/**
+	 * @brief Resample to another rate
+	 *
+	 * @return output allocated with extmem_malloc(), NULL if out of memory
+	 */
+	static float32_t *resample(const float32_t *in, uint32_t inLen, float32_t inRate, float32_t outRate, uint32_t &outLen);
+
+	source_t getSource() {return source;}
+	/**
+	 * @brief CPU time of the last load in ms, the sum of its steps
+	 */
+	float32_t getLoadTime() {return loadTime;}
+	/**
+	 * @brief Sample rate of the last WAV file read
+	 */
+	float32_t getFileRate() {return fileRate;}
+	/**
+	 * @brief IR length of the last load() before and after the trimming,
+	 * 			at the audio sample rate
+	 */
+	uint32_t getLengthIn() {return lengthIn;}
+	uint32_t getLengthOut() {return lengthOut;}
+	/**
+	 * @brief The last load converted the IR to minimum phase. false with
+	 * 			the minPhase option: the IR was longer than
+	 * 			IR_TRIM_MINPHASE_FFT/2 even after the tail trim and is
+	 * 			used as it is.
+	 */
+	bool getMinPhase() {return minPhaseDone;}
+private:
+	// the cache is valid only for the same source and settings
+	typedef struct
+	{
+		uint32_t srcSize;
+		uint32_t srcCrc;			// CRC32 of the first kB of the file
+		float32_t sampleRate;
+		float32_t leadDb;
+		float32_t tailDb;
+		float32_t maxMs;
+		float32_t level;
+		uint16_t normalize;
+		uint16_t minPhase;			// 0: off, in the cache file: what was applied
+		uint16_t blockSamples;
+		uint16_t partMax;
+	} cache_key_t;
+	typedef struct
+	{
+		char magic[4];
+		uint16_t version;
+		uint16_t levels;
+		uint32_t length;
+		uint32_t lengthIn;
+		cache_key_t key;
+	} cache_header_t;
+
+	typedef struct
+	{
+		uint32_t frames;			// to read, max IR_LOADER_MAX_SECONDS
+		uint16_t frameBytes;
+		uint8_t bits;
+		bool flt;
+	} wav_t;
+	typedef struct
+	{
+		float32_t *table;			// kernel, IR_LOADER_SINC_ZC zero crossings
+		float32_t ratio;			// input samples per output sample
+		float32_t fc;				// cutoff relative to the input Nyquist
+		float32_t halfWidth;
+		uint32_t inLen;
+		uint32_t outLen;
+	} resampler_t;
+	typedef enum
+	{
+		LD_IDLE,
+		LD_OPEN,			// cache file
+		LD_HEADER,			// WAV file header
+		LD_READ,			// WAV samples, a chunk per step
+		LD_RESAMPLE,		// a chunk per step
+		LD_TRIM,			// trimming, normalization
+		LD_TRANSFORM,		// one partition per step
+		LD_CACHE			// write the cache file
+	} load_state_t;
+
+	FS &fs;
+	load_state_t ldState = LD_IDLE;
+	char path[IR_LOADER_NAME_MAX * 2];
+	char cache[IR_LOADER_NAME_MAX * 2];
+	cache_key_t key;
+	options_t opt;
+	uint16_t partMax = IR_CONV_PART_MAX;
+	IRPartitions_F32 *parts = NULL;
+	float32_t *ir = NULL;				// samples waiting for the transform
+	uint32_t irLen = 0;
+	File wav;
+	wav_t wavFmt;
+	float32_t *raw = NULL;				// samples at the file rate
+	uint32_t pos = 0;					// read/resampled so far
+	resampler_t rs = {};
+	uint16_t part = 0;
+	uint32_t cycles = 0;
+	bool ok = false;
+	source_t source = SRC_NONE;
+	float32_t loadTime = 0.0f;
+	float32_t fileRate = 0.0f;
+	uint32_t lengthIn = 0;
+	uint32_t lengthOut = 0;
+	bool minPhaseDone = false;
+	bool makeKey(const char *path, const options_t &opt, uint16_t partMax, cache_key_t &key);
+	bool readCache(const char *path, const cache_key_t &key, IRPartitions_F32 &parts);
+	bool writeCache(const char *path, const cache_key_t &key, IRPartitions_F32 &parts);
+	static bool wavHeader(File &f, wav_t &w, float32_t &rate);
+	static uint32_t wavRead(File &f, const wav_t &w, float32_t *data, uint32_t frames);
+	static bool resampleBegin(resampler_t &r, uint32_t inLen, float32_t inRate, float32_t outRate);
+	static void resampleRun(const resampler_t &r, const float32_t *in, float32_t *out, uint32_t n0, uint32_t n1);
+	static void resampleEnd(resampler_t &r);
+	uint32_t trim(float32_t *data, uint32_t n, const options_t &opt);
+	state_t stepLoad();
+	state_t finish(bool result);
+};
+
+#endif // _IRLOADER_F32_H_
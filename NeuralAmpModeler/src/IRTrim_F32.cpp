@@ -0,0 +1,97 @@
+/**
+ * @file IRTrim_F32.cpp
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Impulse response preprocessing to cut the convolution cost
+ * @version 0.1
+ * @date 2024-03-16
+ */
+#include "IRTrim_F32.h"
+
+uint32_t IRTrim_F32::leading(float32_t *ir, uint32_t len, float32_t thresholdDb)
+{
+	float32_t peak = 0.0f;
+	for (uint32_t i = 0; i < len; i++) peak = max(peak, fabsf(ir[i]));
+	if (peak == 0.0f) return len;
+	const float32_t threshold = peak * powf(10.0f, thresholdDb / 20.0f);
+	uint32_t start = 0;
+	while (start < len && fabsf(ir[start]) < threshold) start++;
+	start = start > IR_TRIM_PREROLL ? start - IR_TRIM_PREROLL : 0;
+	if (start) memmove(ir, ir + start, (len - start) * sizeof(float32_t));
+	return len - start;
+}
+
+bool IRTrim_F32::minimumPhase(float32_t *ir, uint32_t len)
+{
+	uint32_t N = 64;
+	// 4x the IR length if possible, the cepstrum aliasing gets smaller with the FFT size
+	while (N < 4 * len && N < IR_TRIM_MINPHASE_FFT) N <<= 1;
+	if (len > N / 2) return false;
+	float32_t *a = (float32_t *)extmem_malloc(N * sizeof(float32_t));
+	float32_t *b = (float32_t *)extmem_malloc(N * sizeof(float32_t));
+	if (!a || !b)
+	{
+		if (a) extmem_free(a);
+		if (b) extmem_free(b);
+		return false;
+	}
+	arm_rfft_fast_instance_f32 fft;
+	arm_rfft_fast_init_f32(&fft, N);
+	memset(a, 0, N * sizeof(float32_t));
+	memcpy(a, ir, len * sizeof(float32_t));
+	arm_rfft_fast_f32(&fft, a, b, 0);
+	// log magnitude, a real spectrum, -> real cepstrum
+	const float32_t eps = 1e-9f;
+	b[0] = logf(max(fabsf(b[0]), eps));
+	b[1] = logf(max(fabsf(b[1]), eps));
+	for (uint32_t k = 2; k < N; k += 2)
+	{
+		b[k] = 0.5f * logf(max(b[k] * b[k] + b[k + 1] * b[k + 1], eps * eps));
+		b[k + 1] = 0.0f;
+	}
+	arm_rfft_fast_f32(&fft, b, a, 1);
+	// fold the anti-causal part onto the causal one
+	for (uint32_t n = 1; n < N / 2; n++) a[n] *= 2.0f;
+	memset(a + N / 2 + 1, 0, (N / 2 - 1) * sizeof(float32_t));
+	arm_rfft_fast_f32(&fft, a, b, 0);
+	// spectrum of the minimum phase IR = exp(FFT(folded cepstrum))
+	b[0] = expf(b[0]);
+	b[1] = expf(b[1]);
+	for (uint32_t k = 2; k < N; k += 2)
+	{
+		const float32_t m = expf(b[k]);
+		const float32_t ph = b[k + 1];
+		b[k] = m * cosf(ph);
+		b[k + 1] = m * sinf(ph);
+	}
+	arm_rfft_fast_f32(&fft, b, a, 1);
+	memcpy(ir, a, len * sizeof(float32_t));
+	extmem_free(a);
+	extmem_free(b);
+	return true;
+}
+
+uint32_t IRTrim_F32::tail(float32_t *ir, uint32_t len, float32_t thresholdDb)
+{
+	double total = 0.0;
+	for (uint32_t i = 0; i < len; i++) total += (double)ir[i] * ir[i];
+	if (total == 0.0) return len;
+	const double threshold = total * pow(10.0, thresholdDb / 10.0);
+	// backward integration: energy of ir[n..len-1]
+	double rest = 0.0;
+	uint32_t n = len;
+	while (n > 1)
+	{
+		rest += (double)ir[n - 1] * ir[n - 1];
+		if (rest >= threshold) break;
+		n--;
+	}
+	if (n < len) fadeOut(ir, n);
+	return n;
+}
+
+void IRTrim_F32::fadeOut(float32_t *ir, uint32_t len, float32_t ms)
+{
+	const uint32_t fade = min(len / 4, (uint32_t)(ms * 0.001f * AUDIO_SAMPLE_RATE_EXACT));
+	for (uint32_t i = 0; i < fade; i++)
+		ir[len - fade + i] *= 0.5f + 0.5f * cosf(PI * (i + 1) / fade);
+}
@@ -0,0 +1,63 @@
+/**
+ * @file IRTrim_F32.h
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Impulse response preprocessing to cut the convolution cost:
+ * 		- leading silence removal: the samples before the first one
+ * 		  above a threshold relative to the peak (mic distance, file
+ * 		  padding) are dropped
+ * 		- minimum phase conversion (real cepstrum method): the energy
+ * 		  of the IR is moved to its start, the magnitude response stays,
+ * 		  the phase changes. Well suited for cabinet IRs, not for rooms
+ * 		  and reverbs, where the time structure is the sound.
+ * 		- tail truncation where the remaining energy (backward
+ * 		  integrated, Schroeder curve) falls below a threshold,
+ * 		  with a short fade out
+ * 		Every sample cut is convolution work saved in every block and
+ * 		every convolver, fewer partitions and less memory.
+ * 		Used by IRLoader_F32 on the device and by the ir_tool of the
+ * 		host simulator.
+ * @version 0.1
+ * @date 2024-03-16
+ */
+#ifndef _IRTRIM_F32_H_
+#define _IRTRIM_F32_H_
+
+#include <Arduino.h>
+#include "AudioStream_F32.h"
+#include "arm_math.h"
+
+#define IR_TRIM_PREROLL			(4)			// samples kept before the first one above the threshold
+#define IR_TRIM_MINPHASE_FFT	(4096)		// max FFT size of the cepstrum, IRs up to half of it are converted
+#define IR_TRIM_FADE_MS			(5.0f)
+
+class IRTrim_F32
+{
+public:
+	/**
+	 * @brief Remove the leading silence, the samples are moved to the start
+	 *
+	 * @param thresholdDb level relative to the peak, ie. -60
+	 * @return new length
+	 */
+	static uint32_t leading(float32_t *ir, uint32_t len, float32_t thresholdDb);
+	/**
+	 * @brief Convert to minimum phase in place, same length
+	 *
+	 * @return false if the IR is longer than IR_TRIM_MINPHASE_FFT/2 or out of memory
+	 */
+	static bool minimumPhase(float32_t *ir, uint32_t len);
+	/**
+	 * @brief Find where the remaining energy falls below the threshold
+	 * 			and fade out there
+	 *
+	 * @param thresholdDb remaining energy relative to the total, ie. -60
+	 * @return new length
+	 */
+	static uint32_t tail(float32_t *ir, uint32_t len, float32_t thresholdDb);
+	/**
+	 * @brief Raised cosine fade out of the last samples, max a quarter of the IR
+	 */
+	static void fadeOut(float32_t *ir, uint32_t len, float32_t ms = IR_TRIM_FADE_MS);
+};
+
+#endif // _IRTRIM_F32_H_
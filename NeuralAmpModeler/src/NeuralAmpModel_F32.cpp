@@ -0,0 +1,60 @@
+/**
+ * @file NeuralAmpModel_F32.cpp
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Neural network architectures and model registry for the
+ * 		AudioEffectRTNeural_F32 amp.
+ * @version 0.1
+ * @date 2024-02-22
+ */
+#include "NeuralAmpModel_F32.h"
+
+float32_t NeuralAmpModel_F32::probe()
+{
+	float32_t buf[AUDIO_BLOCK_SAMPLES];
+	float32_t phase = 0.0f;
+	const float32_t phaseInc = TWO_PI * 110.0f / AUDIO_SAMPLE_RATE_EXACT;
+	float32_t time_us = 0.0f;
+	// same amount of work for any block size, small blocks still give a stable result
+	const uint32_t blocks = (NEURAL_AMP_PROBE_SAMPLES + AUDIO_BLOCK_SAMPLES - 1) / AUDIO_BLOCK_SAMPLES;
+
+	reset();
+	for (uint32_t b = 0; b < blocks; b++)
+	{
+		// guitar-ish test signal, keeps the activations out of the trivial zero state
+		for (uint32_t i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+		{
+			buf[i] = 0.5f * sinf(phase);
+			phase += phaseInc;
+			if (phase > TWO_PI) phase -= TWO_PI;
+		}
+#if defined(ARM_DWT_CYCCNT)
+		uint32_t t0 = ARM_DWT_CYCCNT;
+		process(buf, AUDIO_BLOCK_SAMPLES);
+		time_us += (float32_t)(ARM_DWT_CYCCNT - t0) / (float32_t)(F_CPU_ACTUAL / 1000000);
+#else
+		uint32_t t0 = micros();
+		process(buf, AUDIO_BLOCK_SAMPLES);
+		time_us += (float32_t)(micros() - t0);
+#endif
+	}
+	reset();
+	const float32_t block_us = (float32_t)AUDIO_BLOCK_SAMPLES / AUDIO_SAMPLE_RATE_EXACT * 1000000.0f;
+	load = 100.0f * time_us / (block_us * blocks);
+	if (twin) twin->load = load;
+	return load;
+}
+
+int16_t NeuralAmpRegistry_F32::add(NeuralAmpModel_F32 &arch, const void *weights, float32_t levelAdjust)
+{
+	if (count >= NEURAL_AMP_REGISTRY_SIZE) return -1;
+	if (arch.getLoad() < 0.0f)
+	{
+		arch.loadWeights(weights);
+		arch.probe();
+	}
+	if (refuseOverBudget && !fits(arch, 1)) return -1;
+	entries[count].arch = &arch;
+	entries[count].weights = weights;
+	entries[count].levelAdjust = levelAdjust;
+	return count++;
+}
@@ -0,0 +1,222 @@
+/**
+ * @file NeuralAmpModel_F32.h
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Neural network architectures and model registry for the
+ * 		AudioEffectRTNeural_F32 amp.
+ * 		NeuralAmpModelT_F32 wraps any RTNeural::ModelT type behind a common
+ * 		interface, so models with different architectures (GRU, LSTM, deeper
+ * 		networks, conv front ends) can be used by the same amp object.
+ * 		The registry holds the model list (architecture + weights) and
+ * 		the result of a per architecture CPU cost probe, models that do not
+ * 		fit into the audio block budget are refused or flagged.
+ * @version 0.1
+ * @date 2024-02-22
+ */
+#ifndef _NEURALAMPMODEL_F32_H_
+#define _NEURALAMPMODEL_F32_H_
+
+#include <Arduino.h>
+#include "AudioStream_F32.h"
+#include "arm_math.h"
+// Wiring abs causes problems within RTNeural
+#undef abs
+
+#include "RTNeural/RTNeural.h"
+#include "Oversampler_F32.h"
+
+#define NEURAL_AMP_REGISTRY_SIZE	(16)
+#define NEURAL_AMP_CPU_BUDGET		(60.0f)		// default budget in % of the audio block time
+#define NEURAL_AMP_PROBE_SAMPLES	(2048)		// length of the cost probe signal, independent of the block size
+
+/**
+ * @brief Common interface of all the amp model architectures
+ */
+class NeuralAmpModel_F32
+{
+public:
+	NeuralAmpModel_F32(const char *archName, bool skipConnection) : name(archName), skip(skipConnection) {}
+	virtual ~NeuralAmpModel_F32() {}
+	/**
+	 * @brief Copy a set of weights into the network
+	 *
+	 * @param weights pointer to the weights, format depends on the architecture loader
+	 */
+	virtual void loadWeights(const void *weights) = 0;
+	virtual void reset() = 0;
+	/**
+	 * @brief Set the delay of the recurrent layers using sample rate correction
+	 * 			to the oversampling factor
+	 */
+	virtual void setRateFactor(uint8_t factor) = 0;
+	/**
+	 * @brief Run the network in place over len samples, adds the input
+	 * 			to the output if the model was trained with a skip connection
+	 */
+	virtual void process(float32_t *buf, uint32_t len) = 0;
+#if RTNEURAL_ENABLE_PROFILING
+	virtual RTNeural::LayerProfile getLayerProfile(size_t idx) = 0;
+	virtual void resetLayerProfiles() = 0;
+#endif
+	/**
+	 * @brief Measure the cost of the architecture at 1x rate
+	 * 			Runs a test signal through the network, has to be called
+	 * 			while the audio interrupt is not using this object.
+	 *
+	 * @return CPU load in % of the audio block time
+	 */
+	float32_t probe();
+	/**
+	 * @brief Last probed CPU load at 1x rate, negative if not probed yet
+	 */
+	float32_t getLoad() {return load;}
+	const char *getName() {return name;}
+	/**
+	 * @brief Oversampling factor set with setRateFactor()
+	 */
+	uint8_t getRateFactor() {return rateFactor;}
+	/**
+	 * @brief Pair with a second instance of the same architecture,
+	 * 			the amp loads the next model into the one not playing
+	 * 			in the background, see AudioEffectRTNeural_F32::setTaskScheduler
+	 */
+	void setTwin(NeuralAmpModel_F32 &other)
+	{
+		twin = &other;
+		other.twin = this;
+		other.load = load;
+	}
+	NeuralAmpModel_F32 *getTwin() {return twin;}
+protected:
+	const char *name;
+	bool skip;
+	float32_t load = -1.0f;
+	uint8_t rateFactor = 1;
+	NeuralAmpModel_F32 *twin = NULL;
+};
+
+/**
+ * @brief Amp model architecture based on a static RTNeural model
+ *
+ * @tparam ModelType RTNeural::ModelT with one input and one output
+ */
+template <typename ModelType>
+class NeuralAmpModelT_F32 : public NeuralAmpModel_F32
+{
+public:
+	typedef void (*loader_t)(ModelType &model, const void *weights);
+	/**
+	 * @param archName name printed in the model info
+	 * @param weightsLoader function copying the weights into the model
+	 * @param skipConnection model output is added to the input
+	 */
+	NeuralAmpModelT_F32(const char *archName, loader_t weightsLoader, bool skipConnection = true)
+		: NeuralAmpModel_F32(archName, skipConnection), loader(weightsLoader)
+	{
+		static_assert(ModelType::input_size == 1 && ModelType::output_size == 1, "Amp model has to be mono in, mono out");
+		// allocate the delay lines for the highest factor once,
+		// later changes of the factor only resize within the capacity
+		setRateFactor(OVERSAMPLER_MAX_FACTOR);
+		setRateFactor(1);
+	}
+	void loadWeights(const void *weights) override
+	{
+		if (loader) loader(model, weights);
+		model.reset();
+	}
+	void reset() override { model.reset(); }
+	void setRateFactor(uint8_t factor) override
+	{
+		prepareLayers(factor, decltype(layerIndices(model)) {});
+		model.reset();
+		rateFactor = factor;
+	}
+	void process(float32_t *buf, uint32_t len) override
+	{
+		float32_t sigIn[1];
+		while (len--)
+		{
+			sigIn[0] = *buf;
+			*buf++ = skip ? model.forward(sigIn) + sigIn[0] : model.forward(sigIn);
+		}
+	}
+#if RTNEURAL_ENABLE_PROFILING
+	RTNeural::LayerProfile getLayerProfile(size_t idx) override { return model.getLayerProfile(idx); }
+	void resetLayerProfiles() override { model.resetLayerProfiles(); }
+#endif
+	ModelType &getModel() {return model;}
+private:
+	ModelType model;
+	loader_t loader;
+
+	template <typename T, int in_size, int out_size, typename... Layers>
+	static std::index_sequence_for<Layers...> layerIndices(const RTNeural::ModelT<T, in_size, out_size, Layers...> &);
+
+	template <size_t... Ix>
+	void prepareLayers(uint8_t factor, std::index_sequence<Ix...>)
+	{
+		(void)std::initializer_list<int> { (prepareLayer(model.template get<Ix>(), factor, 0), 0)... };
+	}
+	// only the recurrent layers with sample rate correction have prepare()
+	template <typename LayerType>
+	static auto prepareLayer(LayerType &layer, uint8_t factor, int) -> decltype(layer.prepare((int)factor), void())
+	{
+		layer.prepare((int)factor);
+	}
+	template <typename LayerType>
+	static void prepareLayer(LayerType &, uint8_t, long) {}
+};
+
+/**
+ * @brief List of the available amp models
+ * 		Each entry is an architecture + a set of weights for it,
+ * 		many entries can share the same architecture object.
+ */
+class NeuralAmpRegistry_F32
+{
+public:
+	typedef struct
+	{
+		NeuralAmpModel_F32 *arch;
+		const void *weights;
+		float32_t levelAdjust;
+	} entry_t;
+
+	/**
+	 * @brief Add a model, probes the architecture cost on first use
+	 * 			Call before the amp uses the architecture (ie. in setup())
+	 *
+	 * @return index of the new entry, -1 if the registry is full
+	 * 			or the model was refused for exceeding the cpu budget
+	 */
+	int16_t add(NeuralAmpModel_F32 &arch, const void *weights, float32_t levelAdjust);
+	uint8_t size() {return count;}
+	const entry_t *get(uint8_t idx) {return idx < count ? &entries[idx] : NULL;}
+	/**
+	 * @brief Set the cpu budget for the amp model
+	 *
+	 * @param percent max allowed load in % of the audio block time
+	 * @param refuse true = models over budget are not loaded,
+	 * 				false = they are loaded and only reported by fits()
+	 */
+	void setBudget(float32_t percent, bool refuse)
+	{
+		budget = percent;
+		refuseOverBudget = refuse;
+	}
+	float32_t getBudget() {return budget;}
+	bool getRefuse() {return refuseOverBudget;}
+	/**
+	 * @brief Check if the architecture fits into the budget at given oversampling factor
+	 */
+	bool fits(NeuralAmpModel_F32 &arch, uint8_t osFactor)
+	{
+		return arch.getLoad() * (float32_t)osFactor <= budget;
+	}
+private:
+	entry_t entries[NEURAL_AMP_REGISTRY_SIZE];
+	uint8_t count = 0;
+	float32_t budget = NEURAL_AMP_CPU_BUDGET;
+	bool refuseOverBudget = false;
+};
+
+#endif // _NEURALAMPMODEL_F32_H_
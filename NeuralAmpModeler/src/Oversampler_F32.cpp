@@ -0,0 +1,67 @@
+/**
+ * @file Oversampler_F32.cpp
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Polyphase half-band FIR up/down samplers used to run the
+ * 		neural amp model at 2x or 4x the audio sample rate.
+ * @version 0.1
+ * @date 2024-02-20
+ */
+#include "Oversampler_F32.h"
+
+bool Oversampler_F32::setFactor(uint8_t f)
+{
+	if (f != 1 && f != 2 && f != 4) return false;
+	factor = f;
+	reset();
+	return true;
+}
+
+float32_t Oversampler_F32::getLatency()
+{
+	switch(factor)
+	{
+		case 2:		return stage1.latency();
+		case 4:		return stage1.latency() + 0.5f * stage2.latency();
+		default:	return 0.0f;
+	}
+}
+
+void Oversampler_F32::reset()
+{
+	stage1.reset();
+	stage2.reset();
+}
+
+void Oversampler_F32::upsample(const float32_t *in, float32_t *out, uint32_t len)
+{
+	switch(factor)
+	{
+		case 2:
+			stage1.interpolate(in, out, len);
+			break;
+		case 4:
+			stage1.interpolate(in, tmp, len);
+			stage2.interpolate(tmp, out, len*2);
+			break;
+		default:
+			memcpy(out, in, len * sizeof(float32_t));
+			break;
+	}
+}
+
+void Oversampler_F32::downsample(const float32_t *in, float32_t *out, uint32_t len)
+{
+	switch(factor)
+	{
+		case 2:
+			stage1.decimate(in, out, len);
+			break;
+		case 4:
+			stage2.decimate(in, tmp, len*2);
+			stage1.decimate(tmp, out, len);
+			break;
+		default:
+			memcpy(out, in, len * sizeof(float32_t));
+			break;
+	}
+}
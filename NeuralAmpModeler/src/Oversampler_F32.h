@@ -0,0 +1,160 @@
+/**
+ * @file Oversampler_F32.h
+ * @author Piotr Zapart www.hexefx.com
+ * @brief Polyphase half-band FIR up/down samplers used to run the
+ * 		neural amp model at 2x or 4x the audio sample rate.
+ * 		Each 2x stage is a linear phase half-band lowpass split into
+ * 		two polyphase branches. Every second coefficient of a half-band
+ * 		filter is zero and the remaining ones are symmetric, so a stage
+ * 		costs K multiplies per output pair for a 4K-1 tap filter.
+ * 		4x oversampling is a cascade of two 2x stages, the second one
+ * 		uses a shorter filter, since the signal is already band limited.
+ * @version 0.1
+ * @date 2024-02-20
+ */
+#ifndef _OVERSAMPLER_F32_H_
+#define _OVERSAMPLER_F32_H_
+
+#include <Arduino.h>
+#include "AudioStream_F32.h"
+#include "arm_math.h"
+
+#define OVERSAMPLER_MAX_FACTOR	(4)
+
+/**
+ * @brief Half-band polyphase interpolator/decimator
+ *
+ * @tparam K number of unique non-zero side coefficients,
+ * 			filter length is 4K-1 taps
+ */
+template <int K>
+class HalfbandFIR_F32
+{
+public:
+	HalfbandFIR_F32()
+	{
+		design(8.0f);
+		reset();
+	}
+	/**
+	 * @brief Design the filter using a Kaiser windowed sinc
+	 *
+	 * @param beta Kaiser window shape, higher = more stopband attenuation, wider transition band
+	 */
+	void design(float32_t beta)
+	{
+		const int32_t center = 2*K - 1;
+		float32_t sum = 0.0f;
+		for (int32_t k = 0; k < K; k++)
+		{
+			int32_t m = 2*k - center; // odd distance from the center tap
+			float32_t x = (float32_t)m / (float32_t)(2*K);
+			float32_t w = besselI0(beta * sqrtf(1.0f - x*x)) / besselI0(beta);
+			coef[k] = sinf(PI * 0.5f * m) / (PI * m) * w;
+			sum += coef[k];
+		}
+		// normalize for unity DC gain: side taps of a half-band filter sum to 0.5
+		for (int32_t k = 0; k < K; k++) coef[k] *= 0.25f / sum;
+	}
+	void reset()
+	{
+		memset(upHist, 0, sizeof(upHist));
+		memset(dnHistEven, 0, sizeof(dnHistEven));
+		memset(dnHistOdd, 0, sizeof(dnHistOdd));
+		upIdx = 0;
+		dnIdxEven = 0;
+		dnIdxOdd = 0;
+	}
+	/**
+	 * @brief 2x interpolation, produces 2*len output samples
+	 */
+	void interpolate(const float32_t *in, float32_t *out, uint32_t len)
+	{
+		while (len--)
+		{
+			upIdx = upIdx ? upIdx - 1 : N - 1;
+			upHist[upIdx] = upHist[upIdx + N] = *in++;
+			const float32_t *h = &upHist[upIdx]; // newest sample first
+			float32_t acc = 0.0f;
+			for (int32_t k = 0; k < K; k++)
+				acc += coef[k] * (h[k] + h[N - 1 - k]);
+			*out++ = 2.0f * acc;	// branch with the side taps
+			*out++ = h[K - 1];		// branch with the center tap (0.5 * 2)
+		}
+	}
+	/**
+	 * @brief 2x decimation, consumes 2*len input samples
+	 */
+	void decimate(const float32_t *in, float32_t *out, uint32_t len)
+	{
+		while (len--)
+		{
+			dnIdxEven = dnIdxEven ? dnIdxEven - 1 : N - 1;
+			dnHistEven[dnIdxEven] = dnHistEven[dnIdxEven + N] = *in++;
+			dnIdxOdd = dnIdxOdd ? dnIdxOdd - 1 : K;
+			dnHistOdd[dnIdxOdd] = dnHistOdd[dnIdxOdd + K + 1] = *in++;
+			const float32_t *h = &dnHistEven[dnIdxEven];
+			float32_t acc = 0.0f;
+			for (int32_t k = 0; k < K; k++)
+				acc += coef[k] * (h[k] + h[N - 1 - k]);
+			*out++ = acc + 0.5f * dnHistOdd[dnIdxOdd + K];
+		}
+	}
+	/**
+	 * @brief group delay introduced by one interpolate + decimate pass,
+	 * 			in lower rate samples
+	 */
+	static constexpr float32_t latency() { return (float32_t)(2*K - 1); }
+private:
+	static constexpr int32_t N = 2*K;
+	float32_t coef[K];
+	// double length history buffers, always readable as one contiguous block
+	float32_t upHist[2*N];
+	float32_t dnHistEven[2*N];
+	float32_t dnHistOdd[2*(K+1)];
+	int32_t upIdx, dnIdxEven, dnIdxOdd;
+
+	static float32_t besselI0(float32_t x)
+	{
+		float32_t sum = 1.0f, term = 1.0f;
+		for (int32_t i = 1; i < 20; i++)
+		{
+			term *= (x * 0.5f) / (float32_t)i;
+			sum += term * term;
+		}
+		return sum;
+	}
+};
+
+class Oversampler_F32
+{
+public:
+	Oversampler_F32() : factor(1) {}
+	/**
+	 * @brief Set the oversampling factor, 1, 2 or 4
+	 *
+	 * @return true if the factor is supported
+	 */
+	bool setFactor(uint8_t f);
+	uint8_t getFactor() { return factor; }
+	/**
+	 * @brief Round trip (up + down) latency in base rate samples
+	 */
+	float32_t getLatency();
+	void reset();
+	/**
+	 * @brief Upsample len input samples into len*factor output samples
+	 */
+	void upsample(const float32_t *in, float32_t *out, uint32_t len);
+	/**
+	 * @brief Downsample len*factor input samples into len output samples
+	 */
+	void downsample(const float32_t *in, float32_t *out, uint32_t len);
+private:
+	uint8_t factor;
+	HalfbandFIR_F32<8> stage1;	// fs <-> 2fs, 31 taps
+	HalfbandFIR_F32<4> stage2;	// 2fs <-> 4fs, 15 taps
+	float32_t tmp[AUDIO_BLOCK_SAMPLES * 2];
+};
+
+#endif // _OVERSAMPLER_F32_H_
@@ -7,52 +7,174 @@
  * 			- adjusted model volume to match unity gain with bypass signal
  * 			- dual mono input and output
  * 			- added bypass system
+ * 			- optional 2x/4x oversampling with GRU sample rate correction
+ * 			- model registry accepting any RTNeural::ModelT architecture,
+ * 			  with a CPU cost probe and budget check
+ * 			- parameter changes passed to the audio update through a
+ * 			  lock-free event queue, gain changes are ramped
+ * 			- optional background model loading in loop()
  * @version 0.1
  * @date 2024-01-31
  */
 #include "RTNeural_F32.h"
 #include "RTNeural_models.h"
 
-AudioEffectRTNeural_F32::AudioEffectRTNeural_F32() : AudioStream_F32(2, inputQueueArray_f32)
+static void loadGRU9(ModelGRU9_t &model, const void *weights)
 {
+	const modelData *data = (const modelData *)weights;
+	auto& gru = (model).template get<0>();
+	auto& dense = (model).template get<1>();
+	gru.setWVals(data->rec_weight_ih_l0);
+	gru.setUVals(data->rec_weight_hh_l0);
+	gru.setBVals(data->rec_bias);
+	dense.setWeights(data->lin_weight);
+	dense.setBias(data->lin_bias.data());
+}
+
+AudioEffectRTNeural_F32::AudioEffectRTNeural_F32() : AudioStream_F32(2, inputQueueArray_f32),
+	gru9("GRU-9", loadGRU9), gru9twin("GRU-9", loadGRU9)
+{
+	gru9.setTwin(gru9twin);
 	setupWeights();
+	for (uint32_t i = 0; i < model_collection.size(); i++)
+		registry.add(gru9, &model_collection[i], model_collection[i].levelAdjust);
+	model = &gru9;
+	modelIndex = 0;
+	nnLevelAdjust = 1.0f;
+	if (registry.size())
+	{
+		nnLevelAdjust = registry.get(0)->levelAdjust;
+		model->loadWeights(registry.get(0)->weights);
+	}
+	model_slot_t *slot = nextModel.edit();
+	*slot = {model, registry.size() ? registry.get(0)->weights : NULL, nnLevelAdjust, 0, true};
+	nextModel.publish();
+	modelSlot = nextModel.acquire();
 	initialized =true;
 }
 
-void AudioEffectRTNeural_F32::changeModel(uint8_t modelNo)
+bool AudioEffectRTNeural_F32::oversample(uint8_t factor)
+{
+	if (factor != 1 && factor != 2 && factor != 4) return false;
+	if (registry.getRefuse() && !registry.fits(*model, factor)) return false;
+	return events.post(PARAM_OVERSAMPLE, factor);
+}
+
+bool AudioEffectRTNeural_F32::changeModel(uint8_t modelNo)
 {
-	if (modelNo == 0)
+	const NeuralAmpRegistry_F32::entry_t *e = modelNo ? registry.get(modelNo - 1) : NULL;
+	if (modelNo && !e) return false;
+	if (e && registry.getRefuse() && !registry.fits(*e->arch, os.getFactor())) return false;
+	if (tasks)
+	{
+		requestedModel = modelNo;
+		return tasks->post(loader, taskPriority);
+	}
+	return events.post(PARAM_MODEL, modelNo);
+}
+
+// Runs in loop(), prepares the requested model and publishes it to the audio update.
+AudioTask_F32::state_t AudioEffectRTNeural_F32::ModelLoader::step()
+{
+	model_slot_t *slot = amp.nextModel.edit();
+	if (!slot) return TASK_WAIT;	// the last change was not taken yet
+	const uint8_t modelNo = amp.requestedModel;
+	const NeuralAmpRegistry_F32::entry_t *e = modelNo ? amp.registry.get(modelNo - 1) : NULL;
+	slot->arch = NULL;
+	if (e)
+	{
+		NeuralAmpModel_F32 *inst = e->arch;
+		// the instance the audio update last used can't be touched, load into its twin.
+		// amp.model, not the slot: in bypass the slot is empty, but the update
+		// still changes the rate factor of the model on an oversampling change
+		if (inst == amp.model) inst = inst->getTwin();
+		slot->loaded = inst != NULL;
+		if (inst)
+		{
+			inst->setRateFactor(amp.os.getFactor());
+			inst->loadWeights(e->weights);
+		}
+		slot->arch = inst ? inst : e->arch;
+		slot->weights = e->weights;
+		slot->levelAdjust = e->levelAdjust;
+		slot->index = modelNo - 1;
+	}
+	amp.nextModel.publish();
+	// changed again meanwhile: one more round
+	return modelNo == amp.requestedModel ? TASK_DONE : TASK_CONTINUE;
+}
+
+void AudioEffectRTNeural_F32::setModel(NeuralAmpModel_F32 *arch, const void *weights, float32_t levelAdjust, uint8_t index, bool load)
+{
+	if (!arch)
 	{
 		bp = true;
 		return;
 	}
-    if ( modelNo > (model_collection.size()) ) return; 
-	else 
+	if (load) arch->loadWeights(weights);
+	if (arch->getRateFactor() != os.getFactor()) arch->setRateFactor(os.getFactor());
+	model = arch;
+	modelIndex = index;
+	nnLevelAdjust = levelAdjust;
+	bp = false;
+}
+
+// Runs in the audio update, applies the events due in this block.
+// Model and oversampling changes take effect at the block start,
+// gain changes are kept with their sample offset for process().
+void AudioEffectRTNeural_F32::beginBlock(uint16_t len)
+{
+	audio_param_event_t ev;
+	gainEventCount = 0;
+	// model prepared by the background task
+	const model_slot_t *slot = nextModel.acquire();
+	if (slot != modelSlot)
+	{
+		modelSlot = slot;
+		setModel(slot->arch, slot->weights, slot->levelAdjust, slot->index, !slot->loaded);
+	}
+	while (events.pop(ev, len))
 	{
-		bp = false;
-        modelIndex = modelNo - 1;
-        auto& gru = (model).template get<0>();
-        auto& dense = (model).template get<1>();
-		__disable_irq();
-        gru.setWVals(model_collection[modelIndex].rec_weight_ih_l0);
-        gru.setUVals(model_collection[modelIndex].rec_weight_hh_l0);
-        gru.setBVals(model_collection[modelIndex].rec_bias);
-        dense.setWeights(model_collection[modelIndex].lin_weight);
-        dense.setBias(model_collection[modelIndex].lin_bias.data());
-        model.reset();
-        nnLevelAdjust = model_collection[modelIndex].levelAdjust;
-		__enable_irq();
-    }
+		switch (ev.id)
+		{
+			case PARAM_GAIN:
+				gainEvents[gainEventCount++] = ev;	// queue size, can't overflow
+				break;
+			case PARAM_MODEL:
+			{
+				const uint8_t modelNo = (uint8_t)ev.value;
+				const NeuralAmpRegistry_F32::entry_t *e = modelNo ? registry.get(modelNo - 1) : NULL;
+				if (e) setModel(e->arch, e->weights, e->levelAdjust, modelNo - 1, true);
+				else setModel(NULL, NULL, 1.0f, 0, false);
+				break;
+			}
+			case PARAM_OVERSAMPLE:
+				if ((uint8_t)ev.value == os.getFactor()) break;	// setFactor() resets the filters
+				os.setFactor((uint8_t)ev.value);
+				model->setRateFactor((uint8_t)ev.value);
+				break;
+			default:
+				break;
+		}
+	}
+	events.advance(len);
+	if (bp) gainJump();
+}
+
+// process() does not run in this block: the gain jumps to the last value
+void AudioEffectRTNeural_F32::gainJump()
+{
+	if (gainEventCount) inputGain.reset(gainEvents[gainEventCount - 1].value);
+	else if (inputGain.isRamping()) inputGain.reset(inputGain.getTarget());
+	gainEventCount = 0;
 }
 
 void AudioEffectRTNeural_F32::update()
 {
 	if (!initialized) return;
 	audio_block_f32_t *blockL, *blockR;
-	int16_t i;
-	float32_t sigIn[1] = {0.0f};
-	float32_t output;
 
+	beginBlock(AUDIO_BLOCK_SAMPLES);
 	if (bp) // handle bypass
 	{
 		blockL = AudioStream_F32::receiveReadOnly_f32(0);
@@ -78,16 +200,45 @@ void AudioEffectRTNeural_F32::update()
 		if (blockR) AudioStream_F32::release(blockR);
 		return;
 	}
-	for (i=0; i < blockL->length; i++) 
-    {
-		sigIn[0] = (blockL->data[i] + blockR->data[i]) * 0.5f * inputGain; // sum both channels
-		output = model.forward(sigIn) + sigIn[0];
-		output *= nnLevelAdjust;
-		blockL->data[i] = output;
-		blockR->data[i] = output;
-	}
+	process(blockL->data, blockR->data, blockL->length);
 	AudioStream_F32::transmit(blockL, 0);
 	AudioStream_F32::transmit(blockR, 1);
 	AudioStream_F32::release(blockL);
 	AudioStream_F32::release(blockR);
-}
\ No newline at end of file
+}
+
+void AudioEffectRTNeural_F32::processBlock(float32_t *L, float32_t *R, uint16_t len)
+{
+	if (!initialized) return;
+	beginBlock(len);
+	if (!bp) process(L, R, len);
+}
+
+void AudioEffectRTNeural_F32::idleBlock(uint16_t len)
+{
+	if (!initialized) return;
+	beginBlock(len);
+	gainJump();
+}
+
+void AudioEffectRTNeural_F32::process(float32_t *L, float32_t *R, uint16_t len)
+{
+	int16_t i;
+	float32_t output;
+	uint8_t ev = 0;
+
+	for (i=0; i < len; i++) 
+    {
+		while (ev < gainEventCount && gainEvents[ev].time == (uint32_t)i) inputGain.set(gainEvents[ev++].value);
+		monoBuf[i] = (L[i] + R[i]) * 0.5f * inputGain.next(); // sum both channels
+	}
+	os.upsample(monoBuf, osBuf, len);
+	model->process(osBuf, len * os.getFactor());
+	os.downsample(osBuf, monoBuf, len);
+	for (i=0; i < len; i++) 
+    {
+		output = monoBuf[i] * nnLevelAdjust;
+		L[i] = output;
+		R[i] = output;
+	}
+}
@@ -7,6 +7,13 @@
  * 			- adjusted model volume to match unity gain with bypass signal
  * 			- dual mono input and output
  * 			- added bypass system
+ * 			- optional 2x/4x oversampling with GRU sample rate correction
+ * 			- model registry accepting any RTNeural::ModelT architecture,
+ * 			  with a CPU cost probe and budget check
+ * 			- can run as a stage of AudioChain_F32
+ * 			- parameter changes passed to the audio update through a
+ * 			  lock-free event queue, gain changes are ramped
+ * 			- optional background model loading in loop()
  * 
  * 		Required libraries:
  * 				https://github.com/chipaudette/OpenAudio_ArduinoLibrary.git
@@ -26,32 +33,207 @@
 #undef abs
 
 #include "RTNeural/RTNeural.h"
+#include "Oversampler_F32.h"
+#include "NeuralAmpModel_F32.h"
+#include "AudioChain_F32.h"
+#include "AudioParamQueue_F32.h"
+#include "AudioTasks_F32.h"
 
-class AudioEffectRTNeural_F32 : public AudioStream_F32
+#define NEURAL_AMP_EVENT_QUEUE		(16)	// pending parameter changes, power of 2
+#define NEURAL_AMP_GAIN_RAMP		(64)	// gain smoothing time in samples
+
+// built in models: GRU with 9 hidden units + Dense output layer
+// sample rate correction keeps the recurrent delay equal to one sample
+// at the training rate when the model runs oversampled
+typedef RTNeural::ModelT<float, 1, 1,
+	RTNeural::GRULayerT<float, 1, 9, RTNeural::SampleRateCorrectionMode::NoInterp>,
+	RTNeural::DenseT<float, 9, 1>> ModelGRU9_t;
+
+class AudioEffectRTNeural_F32 : public AudioStream_F32, public AudioChainStage_F32
 {
 public:
 	AudioEffectRTNeural_F32();
 	~AudioEffectRTNeural_F32(){};
 	virtual void update(void);
-	void changeModel(uint8_t modelNo);
-	void gain(float32_t g)
+	/**
+	 * @brief Run the amp in place, used by update() and by AudioChain_F32
+	 * 			Output is mono, copied to both channels.
+	 */
+	void processBlock(float32_t *L, float32_t *R, uint16_t len) override;
+	/**
+	 * @brief Stage off in AudioChain_F32: the queued settings are applied,
+	 * 			the gain without the ramp
+	 */
+	void idleBlock(uint16_t len) override;
+	/**
+	 * @brief Select the amp model
+	 * 			The change is queued and done by the audio update at the
+	 * 			start of the next block, getModel() returns the new model
+	 * 			from then on.
+	 * 
+	 * 			With a task scheduler set the weights are loaded by a
+	 * 			background task first, see setTaskScheduler().
+	 * 
+	 * @param modelNo 0 = bypass, 1..getModelCount() registry entries
+	 * @return false if the model does not exist, was refused
+	 * 			for exceeding the cpu budget at the current oversampling
+	 * 			or the event queue is full
+	 */
+	bool changeModel(uint8_t modelNo);
+	/**
+	 * @brief Load the models in the background: changeModel() posts a task,
+	 * 			the scheduler run in loop() copies the weights into the
+	 * 			instance of the architecture which is not playing (see
+	 * 			NeuralAmpModel_F32::setTwin) and publishes it, the audio
+	 * 			update switches to it at the next block start.
+	 * 			Architectures without a twin are loaded by the audio update
+	 * 			when the new model uses the playing instance.
+	 * 
+	 * @param sched scheduler run from loop()
+	 * @param priority task priority
+	 */
+	void setTaskScheduler(AudioTaskScheduler_F32 &sched, uint8_t priority = AudioTaskScheduler_F32::PRIO_HIGH)
+	{
+		tasks = &sched;
+		taskPriority = priority;
+	}
+	/**
+	 * @brief A model change is being prepared or was not taken by the audio update yet
+	 */
+	bool modelPending() {return loader.isQueued() || !nextModel.edit();}
+	/**
+	 * @brief Set the input gain, ramped over NEURAL_AMP_GAIN_RAMP samples
+	 * 
+	 * @param g gain 0.0 to 1.0
+	 * @param sampleTime start of the ramp, sample time from sampleTime(),
+	 * 			0 = start of the next block
+	 * @return false if the event queue is full
+	 */
+	bool gain(float32_t g, uint32_t sampleTime = 0)
+	{
+		return events.post(PARAM_GAIN, constrain(g, 0.0f, 1.0f), sampleTime);
+	}
+	/**
+	 * @brief Input gain of the last processed sample
+	 */
+	float32_t getGain() {return inputGain.get();}
+	/**
+	 * @brief Sample time of the next audio block processed by the amp
+	 */
+	uint32_t sampleTime() {return events.now();}
+	uint8_t getModel() {return modelIndex + 1;}
+	/**
+	 * @brief Register a new model, architectures can be mixed freely.
+	 * 			Call from setup(), the first use of an architecture
+	 * 			runs the cost probe on it.
+	 * 
+	 * @param arch architecture object, ie. NeuralAmpModelT_F32<RTNeural::ModelT<...>>
+	 * @param weights weights passed to the loader of the architecture
+	 * @param levelAdjust output gain matching the bypass level
+	 * @return model number for changeModel(), 0 if refused
+	 */
+	uint8_t addModel(NeuralAmpModel_F32 &arch, const void *weights, float32_t levelAdjust)
+	{
+		return registry.add(arch, weights, levelAdjust) + 1;
+	}
+	uint8_t getModelCount() {return registry.size();}
+	const NeuralAmpRegistry_F32::entry_t *getModelInfo(uint8_t modelNo) {return modelNo ? registry.get(modelNo - 1) : NULL;}
+	/**
+	 * @brief Set the cpu budget for the amp, see NeuralAmpRegistry_F32::setBudget
+	 */
+	void setCpuBudget(float32_t percent, bool refuse) {registry.setBudget(percent, refuse);}
+	/**
+	 * @brief Check if a model fits into the cpu budget at the oversampling factor
+	 */
+	bool fitsBudget(uint8_t modelNo, uint8_t factor)
+	{
+		const NeuralAmpRegistry_F32::entry_t *e = getModelInfo(modelNo);
+		return e ? registry.fits(*e->arch, factor) : true;
+	}
+	/**
+	 * @brief Set the oversampling factor for the neural network
+	 * 			Higher rates reduce aliasing of the high gain models
+	 * 			at the cost of proportionally more cpu load.
+	 * 
+	 * 			Queued like changeModel(), applied at the next block start.
+	 * 
+	 * @param factor 1, 2 or 4
+	 * @return true if the factor is supported
+	 */
+	bool oversample(uint8_t factor);
+	uint8_t getOversample() {return os.getFactor();}
+#if RTNEURAL_ENABLE_PROFILING
+	/**
+	 * @brief Get a copy of the per layer cycle statistics of the active model
+	 * 			built in models: layer 0 = GRU, 1 = Dense
+	 */
+	RTNeural::LayerProfile getLayerProfile(size_t idx)
 	{
-		g = constrain(g, 0.0f, 1.0f);
 		__disable_irq();
-		inputGain = g;
+		RTNeural::LayerProfile p = model->getLayerProfile(idx);
 		__enable_irq();
+		return p;
 	}
-	uint8_t getModel() {return modelIndex + 1;}
+	void resetLayerProfiles()
+	{
+		__disable_irq();
+		model->resetLayerProfiles();
+		__enable_irq();
+	}
+#endif
 private:
+	enum
+	{
+		PARAM_GAIN,
+		PARAM_MODEL,
+		PARAM_OVERSAMPLE
+	};
 	audio_block_f32_t *inputQueueArray_f32[2];
-	RTNeural::ModelT<float, 1, 1,
-		RTNeural::GRULayerT<float, 1, 9>,
-		RTNeural::DenseT<float, 9, 1>> model;
+	AudioParamQueue_F32<NEURAL_AMP_EVENT_QUEUE> events;
+	// gain changes of the current block, sample accurate
+	audio_param_event_t gainEvents[NEURAL_AMP_EVENT_QUEUE];
+	uint8_t gainEventCount = 0;
+	void beginBlock(uint16_t len);
+	void gainJump();
+	void process(float32_t *L, float32_t *R, uint16_t len);
+	void setModel(NeuralAmpModel_F32 *arch, const void *weights, float32_t levelAdjust, uint8_t index, bool load);
+
+	// model prepared in loop(), arch = NULL is bypass, loaded = false: the audio update loads the weights
+	typedef struct
+	{
+		NeuralAmpModel_F32 *arch;
+		const void *weights;
+		float32_t levelAdjust;
+		uint8_t index;
+		bool loaded;
+	} model_slot_t;
+	class ModelLoader : public AudioTask_F32
+	{
+	public:
+		ModelLoader(AudioEffectRTNeural_F32 &amp) : amp(amp) {}
+		state_t step() override;
+	private:
+		AudioEffectRTNeural_F32 &amp;
+	};
+	AudioTaskScheduler_F32 *tasks = NULL;
+	uint8_t taskPriority = AudioTaskScheduler_F32::PRIO_HIGH;
+	ModelLoader loader = ModelLoader(*this);
+	AudioPublished_F32<model_slot_t> nextModel;
+	const model_slot_t *modelSlot;		// last slot taken by the audio update
+	volatile uint8_t requestedModel = 0;
+
+	NeuralAmpModelT_F32<ModelGRU9_t> gru9;
+	NeuralAmpModelT_F32<ModelGRU9_t> gru9twin;	// background loading of the built in models
+	NeuralAmpRegistry_F32 registry;
+	NeuralAmpModel_F32 *model;	// active architecture, kept in bypass
+	Oversampler_F32 os;
+	float32_t monoBuf[AUDIO_BLOCK_SAMPLES];
+	float32_t osBuf[AUDIO_BLOCK_SAMPLES * OVERSAMPLER_MAX_FACTOR];
 
 	uint8_t modelIndex;
 	float nnLevelAdjust;
 	bool bp = false; //bypass
-	float32_t inputGain = 1.0f;
+	AudioParamRamp_F32 inputGain = AudioParamRamp_F32(1.0f, NEURAL_AMP_GAIN_RAMP);
 	bool initialized = false;
 };
 
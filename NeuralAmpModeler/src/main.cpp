@@ -30,6 +30,8 @@
 #include "BasicTerm.h"
 #include "stats.h"
 #include "RTNeural_F32.h"
+#include "AudioProfiler_F32.h"
+#include "AudioTasks_F32.h"
 
 // uncomment the line below to make examlpe work with TeensyAudioAdapter board (SGTL5000)
 //#define USE_TEENSY_AUDIO_BOARD
@@ -41,6 +43,8 @@
 #define WET_CTRL_PIN    29
 #define CTRL_HI     	LOW
 #define CTRL_LO     	HIGH
+// audio block pool size, check the "Audio blocks" line or calibrate with the host simulator
+#define AUDIO_BLOCKS_F32	(20)
 
 // Teensy audio adaptor is using I2S1 and SGTL5000 codec chip
 #ifdef USE_TEENSY_AUDIO_BOARD
@@ -90,6 +94,13 @@ AudioConnection_F32		cable21(masterVol, 1, cabsim, 1);
 AudioConnection_F32     cable50(cabsim, 0, i2s_out, 0);
 AudioConnection_F32     cable51(cabsim, 1, i2s_out, 1);
 
+AudioProfiler_F32				profiler;	// has to be the last audio object
+
+// non real time work (amp model weights, cabinet IRs) is done in loop(), not in the MIDI callbacks
+AudioTaskScheduler_F32			tasks;
+bool loadIR(void *arg);
+AudioTaskCall_F32				irTask(loadIR);
+
 BasicTerm term(&DBG_SERIAL); // terminal is used to print out the status and info via WebSerial
 
 // Callbacks for MIDI
@@ -118,7 +129,7 @@ void setup()
 	digitalWriteFast(DRY_CTRL_PIN, CTRL_LO); 	// mute analog dry passthrough
 	digitalWriteFast(WET_CTRL_PIN, CTRL_HI);	// turn on wet signal
 #endif	
-	AudioMemory_F32(20);
+	AudioMemory_F32(AUDIO_BLOCKS_F32);
 
 #ifdef USE_TEENSY_AUDIO_BOARD
 	if (!codec.enable()) DBG_SERIAL.println("Codec init error!");
@@ -137,7 +148,15 @@ void setup()
     usbMIDI.setHandleControlChange(cb_ControlChange);
 	usbMIDI.setHandleClock(cb_MidiClock);
 
+	amp.setTaskScheduler(tasks);
 	amp.changeModel(0);
+	// cost of the amp models measured at startup, warn about the ones not fitting into the budget
+	for (uint8_t i = 1; i <= amp.getModelCount(); i++)
+	{
+		const NeuralAmpRegistry_F32::entry_t *m = amp.getModelInfo(i);
+		DBG_SERIAL.printf("Amp model %d: %s load=%2.2f%% %s\r\n", i, m->arch->getName(), m->arch->getLoad(),
+							amp.fitsBudget(i, 1) ? "" : "OVER BUDGET!");
+	}
 	// default sound settings:
 	cabsim.ir_load(IRno);
 	cabsim.doubler_set(false);
@@ -161,6 +180,14 @@ void setup()
 	echo.mix(0.20f);
 	reverb.bypass_set(true);
 
+	profiler.add(amp, "amp");
+	profiler.add(toneStack, "tone");
+	profiler.add(gate, "gate");
+	profiler.add(echo, "delay");
+	profiler.add(reverb, "reverb");
+	profiler.add(masterVol, "vol");
+	profiler.add(cabsim, "cabsim");
+
 	term.init();
     term.cls();
     term.show_cursor(false);
@@ -169,6 +196,7 @@ void setup()
 void loop()
 {
 	usbMIDI.read();
+	tasks.run(AUDIO_TASKS_BUDGET_US);
 	timeNow = millis();
     if (timeNow - timeLast > 500)
     {
@@ -198,7 +226,7 @@ void cb_NoteOn(byte channel, byte note, byte velocity)
             break;
 		case 6 ... 16:
 			IRno = note - 6;
-			cabsim.ir_load(IRno);
+			tasks.post(irTask, AudioTaskScheduler_F32::PRIO_LOW);	// latest IRno is loaded
 			break;
         case 17:
             SCB_AIRCR = 0x05FA0004; // MCU reset
@@ -243,6 +271,15 @@ void cb_NoteOn(byte channel, byte note, byte velocity)
 		case 40 ... 48:
 			amp.changeModel(note-40);
 			break;
+		case 50:
+			amp.oversample(1);
+			break;
+		case 51:
+			amp.oversample(2);
+			break;
+		case 52:
+			amp.oversample(4);
+			break;
         default:
             break;
     }
@@ -318,6 +355,13 @@ void cb_ControlChange(byte channel, byte control, byte value)
     }
 }
 
+bool loadIR(void *arg)
+{
+	(void)arg;
+	cabsim.ir_load(IRno);
+	return true;
+}
+
 void cb_MidiClock(void)
 {
 	static uint32_t clk_count = 0;
@@ -335,21 +379,6 @@ void printMemInfo(void)
     const char *on = "\x1b[32mon \x1b[0m";
     const char *off = "\x1b[31moff\x1b[0m";
 
-	float32_t load_amp = amp.processorUsageMax();
-	amp.processorUsageMaxReset();
-    float32_t load_cb = cabsim.processorUsageMax();
-    cabsim.processorUsageMaxReset();
-	float32_t load_eq = toneStack.processorUsageMax();
-	toneStack.processorUsageMaxReset();
-	float32_t load_gate = gate.processorUsageMax();
-	gate.processorUsageMaxReset();
-	float32_t load_rv = reverb.processorUsageMax();
-	reverb.processorUsageMaxReset();
-	float32_t load_dly = echo.processorUsageMax();
-	echo.processorUsageMaxReset();
-
-	float32_t load = AudioProcessorUsageMax();
-    AudioProcessorUsageMaxReset();
 	char bf[20] = "";
 	
 	switch(IRno)
@@ -365,10 +394,17 @@ void printMemInfo(void)
 			break;
 		default: break;
 	}
-    DBG_SERIAL.printf("CPU usage: amp=%2.2f%% cabsim=%2.2f%% tone=%2.2F%%    \r\n",
-						 load_amp, load_cb, load_eq);
-    DBG_SERIAL.printf("           gate=%2.2f%% delay=%2.2f%% reverb=%2.2f%% max = %2.2f%%     \r\n",
-						 load_gate, load_dly, load_rv, load);						 
+	// load histograms since the start, rare overruns are not lost between the prints
+	profiler.print(DBG_SERIAL);
+	DBG_SERIAL.printf("Audio blocks: max %u of %u used    \r\n", AudioMemoryUsageMax_F32(), AUDIO_BLOCKS_F32);
+#if RTNEURAL_ENABLE_PROFILING
+	RTNeural::LayerProfile prof_gru = amp.getLayerProfile(0);
+	RTNeural::LayerProfile prof_dense = amp.getLayerProfile(1);
+	amp.resetLayerProfiles();
+	DBG_SERIAL.printf("NN cycles: gru min=%u avg=%.1f max=%u dense min=%u avg=%.1f max=%u    \r\n",
+						 (uint32_t)prof_gru.min, prof_gru.mean(), (uint32_t)prof_gru.max,
+						 (uint32_t)prof_dense.min, prof_dense.mean(), (uint32_t)prof_dense.max);
+#endif
 	DBG_SERIAL.printf("Doubler %s Reverb %s Delay %s  \r\n", 
 							doublerState ? on : off,
 							reverbState ? on : off,
@@ -390,7 +426,11 @@ void printMemInfo(void)
 			break;
 		default: break;
 	}							
-	DBG_SERIAL.print("Amp model: ");
+	DBG_SERIAL.printf("Amp model (%dx): ", amp.getOversample());
+	if (model && !amp.fitsBudget(model, amp.getOversample()))
+		DBG_SERIAL.print("(over cpu budget) ");
+	if (amp.modelPending())
+		DBG_SERIAL.print("(loading) ");
 	DBG_SERIAL.print(bf);
 	switch(IRno)
 	{